@@ -6,6 +6,7 @@
 
 #include "nvapi/fakenvapi.h"
 #include <hooks/Streamline_Hooks.h>
+#include <misc/OptimalSettings.h>
 
 #include <SimpleIni.h>
 
@@ -140,10 +141,13 @@ bool Config::Reload(std::filesystem::path iniPath)
         {
             FGHUDFix.set_from_config(readBool("OptiFG", "HUDFix"));
             FGHUDLimit.set_from_config(readInt("OptiFG", "HUDLimit"));
+            FGHudfixScoring.set_from_config(readBool("OptiFG", "HUDFixScoring"));
+            FGHudfixValidateBudget.set_from_config(readInt("OptiFG", "HUDFixValidateBudget"));
             FGHUDFixExtended.set_from_config(readBool("OptiFG", "HUDFixExtended"));
             FGImmediateCapture.set_from_config(readBool("OptiFG", "HUDFixImmediate"));
             FGUseShards.set_from_config(readBool("OptiFG", "UseShards"));
             FGAlwaysTrackHeaps.set_from_config(readBool("OptiFG", "AlwaysTrackHeaps"));
+            FGTrackingTraceFrames.set_from_config(readInt("OptiFG", "TrackingTraceFrames"));
             FGResourceBlocking.set_from_config(readBool("OptiFG", "ResourceBlocking"));
             FGMakeDepthCopy.set_from_config(readBool("OptiFG", "MakeDepthCopy"));
             FGMakeMVCopy.set_from_config(readBool("OptiFG", "MakeMVCopy"));
@@ -167,6 +171,9 @@ bool Config::Reload(std::filesystem::path iniPath)
             FGResourceFlipOffset.set_from_config(readBool("OptiFG", "ResourceFlipOffset"));
 
             FGAlwaysCaptureFSRFGSwapchain.set_from_config(readBool("OptiFG", "AlwaysCaptureFSRFGSwapchain"));
+
+            FGRegionCopy.set_from_config(readBool("OptiFG", "RegionCopy"));
+            FGCopyAliasing.set_from_config(readBool("OptiFG", "CopyAliasing"));
         }
 
         {
@@ -196,6 +203,8 @@ bool Config::Reload(std::filesystem::path iniPath)
         // Framerate
         {
             FramerateLimit.set_from_config(readFloat("Framerate", "FramerateLimit"));
+            PresentDeferBookkeeping.set_from_config(readBool("Framerate", "PresentDeferBookkeeping"));
+            PresentWorkBudget.set_from_config(readFloat("Framerate", "PresentWorkBudget"));
         }
 
         // FSR Common
@@ -347,6 +356,7 @@ bool Config::Reload(std::filesystem::path iniPath)
             LogSingleFile.set_from_config(readBool("Log", "SingleFile"));
             LogAsync.set_from_config(readBool("Log", "LogAsync"));
             LogAsyncThreads.set_from_config(readInt("Log", "LogAsyncThreads"));
+            LogDeferred.set_from_config(readBool("Log", "LogDeferred"));
 
             {
                 auto setting = readString("Log", "LogFile", false);
@@ -422,6 +432,16 @@ bool Config::Reload(std::filesystem::path iniPath)
             TTFFontPath.set_from_config(readWString("Menu", "TTFFontPath"));
 
             FGShortcutKey.set_from_config(readInt("Menu", "FGShortcutKey"));
+            BenchmarkShortcutKey.set_from_config(readInt("Menu", "BenchmarkShortcutKey"));
+
+            if (auto setting = readInt("Menu", "BenchmarkDuration"); setting.has_value())
+                BenchmarkDuration.set_from_config(std::clamp(setting.value(), 1, 3600));
+
+            if (auto setting = readInt("Menu", "BenchmarkFrames"); setting.has_value())
+                BenchmarkFrames.set_from_config(std::clamp(setting.value(), 0, 1000000));
+
+            if (auto setting = readInt("Menu", "BenchmarkAutoStartDelay"); setting.has_value())
+                BenchmarkAutoStartDelay.set_from_config(std::max(setting.value(), 0));
         }
 
         // Hooks
@@ -464,6 +484,8 @@ bool Config::Reload(std::filesystem::path iniPath)
 
             if (auto setting = readFloat("OutputScaling", "Multiplier"); setting.has_value())
                 OutputScalingMultiplier.set_from_config(std::clamp(setting.value(), 0.5f, 3.0f));
+
+            OutputScalingFuseRcas.set_from_config(readBool("OutputScaling", "FuseRcas"));
         }
 
         // Init Flags
@@ -480,6 +502,10 @@ bool Config::Reload(std::filesystem::path iniPath)
         {
             DrsMinOverrideEnabled.set_from_config(readBool("DRS", "DrsMinOverrideEnabled"));
             DrsMaxOverrideEnabled.set_from_config(readBool("DRS", "DrsMaxOverrideEnabled"));
+            DrsControllerEnabled.set_from_config(readBool("DRS", "DrsControllerEnabled"));
+
+            if (auto setting = readFloat("DRS", "DrsTargetFrameTime"); setting.has_value())
+                DrsTargetFrameTime.set_from_config(std::clamp(setting.value(), 2.0f, 100.0f));
         }
 
         // Upscale Ratio Override
@@ -659,6 +685,9 @@ bool Config::Reload(std::filesystem::path iniPath)
             VsyncInterval.set_from_config(readInt("V-Sync", "SyncInterval"));
         }
 
+        // Cached optimal settings tables are built from values above
+        OptimalSettings::ConfigChanged();
+
         if (fakenvapi::isUsingFakenvapi())
             return ReloadFakenvapi();
 
@@ -834,12 +863,17 @@ bool Config::SaveIni()
     {
         ini.SetValue("OptiFG", "HUDFix", GetBoolValue(Instance()->FGHUDFix.value_for_config()).c_str());
         ini.SetValue("OptiFG", "HUDLimit", GetIntValue(Instance()->FGHUDLimit.value_for_config()).c_str());
+        ini.SetValue("OptiFG", "HUDFixScoring", GetBoolValue(Instance()->FGHudfixScoring.value_for_config()).c_str());
+        ini.SetValue("OptiFG", "HUDFixValidateBudget",
+                     GetIntValue(Instance()->FGHudfixValidateBudget.value_for_config()).c_str());
         ini.SetValue("OptiFG", "HUDFixExtended", GetBoolValue(Instance()->FGHUDFixExtended.value_for_config()).c_str());
         ini.SetValue("OptiFG", "HUDFixImmediate",
                      GetBoolValue(Instance()->FGImmediateCapture.value_for_config()).c_str());
         ini.SetValue("OptiFG", "UseShards", GetBoolValue(Instance()->FGUseShards.value_for_config()).c_str());
         ini.SetValue("OptiFG", "AlwaysTrackHeaps",
                      GetBoolValue(Instance()->FGAlwaysTrackHeaps.value_for_config()).c_str());
+        ini.SetValue("OptiFG", "TrackingTraceFrames",
+                     GetIntValue(Instance()->FGTrackingTraceFrames.value_for_config()).c_str());
         ini.SetValue("OptiFG", "ResourceBlocking",
                      GetBoolValue(Instance()->FGResourceBlocking.value_for_config()).c_str());
         ini.SetValue("OptiFG", "MakeDepthCopy", GetBoolValue(Instance()->FGMakeDepthCopy.value_for_config()).c_str());
@@ -878,6 +912,9 @@ bool Config::SaveIni()
 
         ini.SetValue("OptiFG", "AlwaysCaptureFSRFGSwapchain",
                      GetBoolValue(Instance()->FGAlwaysCaptureFSRFGSwapchain.value_for_config()).c_str());
+
+        ini.SetValue("OptiFG", "RegionCopy", GetBoolValue(Instance()->FGRegionCopy.value_for_config()).c_str());
+        ini.SetValue("OptiFG", "CopyAliasing", GetBoolValue(Instance()->FGCopyAliasing.value_for_config()).c_str());
     }
 
     // FSR FG Inputs
@@ -892,6 +929,10 @@ bool Config::SaveIni()
     {
         ini.SetValue("Framerate", "FramerateLimit",
                      GetFloatValue(Instance()->FramerateLimit.value_for_config()).c_str());
+        ini.SetValue("Framerate", "PresentDeferBookkeeping",
+                     GetBoolValue(Instance()->PresentDeferBookkeeping.value_for_config()).c_str());
+        ini.SetValue("Framerate", "PresentWorkBudget",
+                     GetFloatValue(Instance()->PresentWorkBudget.value_for_config()).c_str());
     }
 
     // Output Scaling
@@ -901,6 +942,8 @@ bool Config::SaveIni()
         ini.SetValue("OutputScaling", "Multiplier",
                      GetFloatValue(Instance()->OutputScalingMultiplier.value_for_config()).c_str());
         ini.SetValue("OutputScaling", "Downscaler", GetIntValue(Instance()->OutputScalingDownscaler).c_str());
+        ini.SetValue("OutputScaling", "FuseRcas",
+                     GetBoolValue(Instance()->OutputScalingFuseRcas.value_for_config()).c_str());
     }
 
     // FSR common
@@ -1035,6 +1078,16 @@ bool Config::SaveIni()
         ini.SetValue("Menu", "FGShortcutKey",
                      GetIntValue(Instance()->FGShortcutKey.value_for_config(), setting > 0).c_str());
 
+        setting = Instance()->BenchmarkShortcutKey.value_for_config();
+        ini.SetValue("Menu", "BenchmarkShortcutKey",
+                     GetIntValue(Instance()->BenchmarkShortcutKey.value_for_config(), setting > 0).c_str());
+
+        ini.SetValue("Menu", "BenchmarkDuration",
+                     GetIntValue(Instance()->BenchmarkDuration.value_for_config()).c_str());
+        ini.SetValue("Menu", "BenchmarkFrames", GetIntValue(Instance()->BenchmarkFrames.value_for_config()).c_str());
+        ini.SetValue("Menu", "BenchmarkAutoStartDelay",
+                     GetIntValue(Instance()->BenchmarkAutoStartDelay.value_for_config()).c_str());
+
         setting = Instance()->FpsShortcutKey.value_for_config();
         ini.SetValue("Menu", "FpsShortcutKey",
                      GetIntValue(Instance()->FpsShortcutKey.value_for_config(), setting > 0).c_str());
@@ -1203,6 +1256,7 @@ bool Config::SaveIni()
         ini.SetValue("Log", "SingleFile", GetBoolValue(Instance()->LogSingleFile.value_for_config()).c_str());
         ini.SetValue("Log", "LogAsync", GetBoolValue(Instance()->LogAsync.value_for_config()).c_str());
         ini.SetValue("Log", "LogAsyncThreads", GetIntValue(Instance()->LogAsyncThreads.value_for_config()).c_str());
+        ini.SetValue("Log", "LogDeferred", GetBoolValue(Instance()->LogDeferred.value_for_config()).c_str());
     }
 
     // NvApi
@@ -1221,6 +1275,10 @@ bool Config::SaveIni()
                      GetBoolValue(Instance()->DrsMinOverrideEnabled.value_for_config()).c_str());
         ini.SetValue("DRS", "DrsMaxOverrideEnabled",
                      GetBoolValue(Instance()->DrsMaxOverrideEnabled.value_for_config()).c_str());
+        ini.SetValue("DRS", "DrsControllerEnabled",
+                     GetBoolValue(Instance()->DrsControllerEnabled.value_for_config()).c_str());
+        ini.SetValue("DRS", "DrsTargetFrameTime",
+                     GetFloatValue(Instance()->DrsTargetFrameTime.value_for_config()).c_str());
     }
 
     // Spoofing
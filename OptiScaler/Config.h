@@ -210,6 +210,7 @@ class Config
     CustomOptional<bool> LogSingleFile { true };
     CustomOptional<bool> LogAsync { false };
     CustomOptional<int> LogAsyncThreads { 4 };
+    CustomOptional<bool> LogDeferred { false };
 
     // XeSS
     CustomOptional<bool> BuildPipelines { true };
@@ -280,6 +281,10 @@ class Config
     CustomOptional<bool> DisableSplash { false };
     CustomOptional<std::wstring, NoDefault> TTFFontPath;
     CustomOptional<int> FGShortcutKey { VK_END };
+    CustomOptional<int> BenchmarkShortcutKey { -1 };
+    CustomOptional<int> BenchmarkDuration { 60 };      // Seconds
+    CustomOptional<int> BenchmarkFrames { 0 };         // 0 means duration limited
+    CustomOptional<int> BenchmarkAutoStartDelay { 0 }; // Seconds after first present, 0 disabled
 
     // Hooks
     CustomOptional<bool> HookOriginalNvngxOnly { false };
@@ -293,6 +298,8 @@ class Config
     // DRS
     CustomOptional<bool> DrsMinOverrideEnabled { false };
     CustomOptional<bool> DrsMaxOverrideEnabled { false };
+    CustomOptional<bool> DrsControllerEnabled { false };
+    CustomOptional<float> DrsTargetFrameTime { 16.667f }; // ms
 
     // Quality Overrides
     CustomOptional<bool> QualityRatioOverrideEnabled { false };
@@ -358,6 +365,7 @@ class Config
     CustomOptional<bool> OutputScalingEnabled { false };
     CustomOptional<float> OutputScalingMultiplier { 1.5f };
     CustomOptional<Scaler> OutputScalingDownscaler { Scaler::FSR1 };
+    CustomOptional<bool> OutputScalingFuseRcas { false };
 
     // FSR
     CustomOptional<bool> FsrDebugView { false };
@@ -450,6 +458,8 @@ class Config
     CustomOptional<bool> FGResourceFlip { false };
     CustomOptional<bool> FGResourceFlipOffset { false };
     CustomOptional<bool> FGAlwaysCaptureFSRFGSwapchain { false };
+    CustomOptional<bool> FGRegionCopy { true };
+    CustomOptional<bool> FGCopyAliasing { false };
 
     CustomOptional<int, NoDefault> FGRectLeft;
     CustomOptional<int, NoDefault> FGRectTop;
@@ -459,6 +469,8 @@ class Config
     // OptiFG - Hudfix
     CustomOptional<bool> FGHUDFix { false };
     CustomOptional<int> FGHUDLimit { 1 };
+    CustomOptional<bool> FGHudfixScoring { false };
+    CustomOptional<int> FGHudfixValidateBudget { 2 };
     CustomOptional<bool> FGHUDFixExtended { false };
     CustomOptional<bool> FGImmediateCapture { false };
     CustomOptional<bool> FGDontUseSwapchainBuffers { false };
@@ -477,6 +489,7 @@ class Config
     CustomOptional<bool> FGAlwaysTrackHeaps { false };
     CustomOptional<bool> FGResourceBlocking { false };
     CustomOptional<bool> FGUseShards { false };
+    CustomOptional<int> FGTrackingTraceFrames { 300 };
 
     // OptiFG - DLSS-D Depth scale
     CustomOptional<bool> FGEnableDepthScale { false };
@@ -538,6 +551,8 @@ class Config
 
     // Framerate
     CustomOptional<float> FramerateLimit { 0.0f };
+    CustomOptional<bool> PresentDeferBookkeeping { true };
+    CustomOptional<float> PresentWorkBudget { 0.5f };
 
     // HDR
     CustomOptional<bool> ForceHDR { false };
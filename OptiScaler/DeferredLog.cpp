@@ -0,0 +1,212 @@
+#include "pch.h"
+#include "DeferredLog.h"
+
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <condition_variable>
+
+static std::mutex _ringsMutex;
+static std::vector<std::shared_ptr<DeferredLogRing>> _rings;
+
+static std::thread _logThread;
+static std::timed_mutex _drainMutex; // Single consumer of the rings, log thread or a flushing thread
+static std::mutex _wakeMutex;
+static std::condition_variable _wakeCv;
+static bool _stopRequested = false;
+
+struct PendingLog
+{
+    DeferredLogRecord* record;
+};
+
+// Keeps ring alive for the log thread after owner thread exits
+struct ThreadRingHolder
+{
+    std::shared_ptr<DeferredLogRing> ring;
+
+    ~ThreadRingHolder()
+    {
+        if (ring != nullptr)
+            ring->ownerAlive.store(false, std::memory_order_release);
+    }
+};
+
+static thread_local ThreadRingHolder _threadRing;
+
+DeferredLogRing* DeferredLog::ThreadRing()
+{
+    if (_threadRing.ring == nullptr)
+    {
+        _threadRing.ring = std::make_shared<DeferredLogRing>();
+
+        std::lock_guard<std::mutex> lock(_ringsMutex);
+        _rings.push_back(_threadRing.ring);
+    }
+
+    return _threadRing.ring.get();
+}
+
+// Caller must hold _drainMutex
+static void WriteRings(const std::vector<std::shared_ptr<DeferredLogRing>>& rings, std::vector<PendingLog>& pending,
+                       std::vector<uint32_t>& heads)
+{
+    pending.clear();
+    heads.resize(rings.size());
+
+    for (size_t i = 0; i < rings.size(); i++)
+    {
+        auto ring = rings[i].get();
+        auto tail = ring->tail.load(std::memory_order_relaxed);
+        heads[i] = ring->head.load(std::memory_order_acquire);
+
+        for (auto index = tail; index != heads[i]; index++)
+            pending.push_back({ &ring->records[index & (DEFERRED_LOG_RING_SIZE - 1)] });
+
+        auto dropped = ring->dropped.exchange(0, std::memory_order_relaxed);
+        if (dropped > 0)
+            spdlog::warn("DeferredLog dropped {} messages, log thread can't keep up", dropped);
+    }
+
+    // Rings are drained per thread, restore global order by capture time
+    std::stable_sort(pending.begin(), pending.end(),
+                     [](const PendingLog& a, const PendingLog& b) { return a.record->time < b.record->time; });
+
+    auto logger = spdlog::default_logger();
+
+    for (auto& item : pending)
+    {
+        auto record = item.record;
+
+        if (logger == nullptr)
+            break;
+
+        try
+        {
+            auto msg = record->decode(std::string_view(record->fmt, record->fmtSize), record->payload);
+            logger->log(record->time, spdlog::source_loc {}, record->level, msg);
+        }
+        catch (const std::exception& ex)
+        {
+            logger->log(record->time, spdlog::source_loc {}, spdlog::level::err,
+                        std::string("DeferredLog can't format: ") + record->fmt + " (" + ex.what() + ")");
+        }
+    }
+
+    // Release slots back to producers
+    for (size_t i = 0; i < rings.size(); i++)
+        rings[i]->tail.store(heads[i], std::memory_order_release);
+}
+
+// Caller must hold _drainMutex
+static void DrainRings(std::vector<PendingLog>& pending, std::vector<uint32_t>& heads)
+{
+    std::vector<std::shared_ptr<DeferredLogRing>> rings;
+
+    {
+        std::lock_guard<std::mutex> lock(_ringsMutex);
+        rings = _rings;
+    }
+
+    WriteRings(rings, pending, heads);
+
+    // Forget rings of exited threads once they are empty
+    std::lock_guard<std::mutex> lock(_ringsMutex);
+    std::erase_if(_rings,
+                  [](const std::shared_ptr<DeferredLogRing>& ring)
+                  {
+                      return !ring->ownerAlive.load(std::memory_order_acquire) &&
+                             ring->tail.load(std::memory_order_relaxed) == ring->head.load(std::memory_order_acquire);
+                  });
+}
+
+static void LogThread()
+{
+    std::vector<PendingLog> pending;
+    std::vector<uint32_t> heads;
+    pending.reserve(DEFERRED_LOG_RING_SIZE * 4);
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(_wakeMutex);
+            _wakeCv.wait_for(lock, std::chrono::milliseconds(2), [] { return _stopRequested; });
+
+            if (_stopRequested)
+                break;
+        }
+
+        std::lock_guard<std::timed_mutex> lock(_drainMutex);
+        DrainRings(pending, heads);
+    }
+}
+
+void DeferredLog::FlushThread()
+{
+    auto ring = _threadRing.ring;
+
+    if (ring == nullptr || ring->head.load(std::memory_order_relaxed) == ring->tail.load(std::memory_order_acquire))
+        return;
+
+    std::vector<std::shared_ptr<DeferredLogRing>> rings { ring };
+    std::vector<PendingLog> pending;
+    std::vector<uint32_t> heads;
+
+    std::lock_guard<std::timed_mutex> lock(_drainMutex);
+    WriteRings(rings, pending, heads);
+}
+
+void DeferredLog::Init()
+{
+    if (_enabled.load(std::memory_order_relaxed))
+        return;
+
+    // Pinned so the module is only detached on process exit, when the log thread is already terminated and
+    // Shutdown can join it under loader lock. Without the pin everything is logged directly.
+    HMODULE module = nullptr;
+    if (!GetModuleHandleExW(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_PIN,
+                            (LPCWSTR) &DeferredLog::Init, &module))
+    {
+        spdlog::warn("DeferredLog can't pin module, logs stay on calling threads");
+        return;
+    }
+
+    _stopRequested = false;
+    _logThread = std::thread(LogThread);
+    _enabled.store(true, std::memory_order_release);
+
+    spdlog::info("DeferredLog enabled, ring size: {}, payload size: {}", DEFERRED_LOG_RING_SIZE,
+                 DEFERRED_LOG_PAYLOAD_SIZE);
+}
+
+void DeferredLog::Shutdown()
+{
+    if (!_enabled.exchange(false, std::memory_order_acq_rel))
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(_wakeMutex);
+        _stopRequested = true;
+    }
+
+    _wakeCv.notify_all();
+
+    if (_logThread.joinable())
+        _logThread.join();
+
+    // Final drain so nothing captured before shutdown is lost. On process exit a thread terminated while
+    // flushing can leave the lock taken, it has not released its records yet so they are written again.
+    std::vector<PendingLog> pending;
+    std::vector<uint32_t> heads;
+
+    if (_drainMutex.try_lock_for(std::chrono::milliseconds(100)))
+    {
+        DrainRings(pending, heads);
+        _drainMutex.unlock();
+    }
+    else
+    {
+        DrainRings(pending, heads);
+    }
+}
@@ -0,0 +1,190 @@
+#pragma once
+
+// Included from SysUtils.h after spdlog, don't include SysUtils.h here
+
+#include <atomic>
+#include <format>
+#include <tuple>
+#include <cstring>
+#include <type_traits>
+#include <string_view>
+
+// Deferred logging for hot path LOG_TRACE / LOG_DEBUG calls
+//
+// Instead of formatting on the calling thread, the format string pointer and raw argument bytes
+// are pushed into a per-thread lock-free ring. A background thread decodes, formats and sends
+// them to spdlog with the original timestamp.
+//
+// Only trivially copyable arguments (numbers, enums, bools) are deferred, anything else
+// (strings, wide strings, string views) falls back to normal spdlog logging on the calling thread.
+// Before anything is logged directly, records already deferred by the calling thread are written,
+// so each thread's log keeps its order. Log thread keeps the module pinned and is joined on shutdown.
+
+inline constexpr size_t DEFERRED_LOG_PAYLOAD_SIZE = 80;
+inline constexpr uint32_t DEFERRED_LOG_RING_SIZE = 1024; // Must be power of two
+
+typedef std::string (*PFN_DeferredDecode)(std::string_view fmt, const uint8_t* payload);
+
+struct alignas(64) DeferredLogRecord
+{
+    PFN_DeferredDecode decode = nullptr;
+    const char* fmt = nullptr;
+    uint32_t fmtSize = 0;
+    spdlog::level::level_enum level = spdlog::level::trace;
+    spdlog::log_clock::time_point time {};
+    uint8_t payload[DEFERRED_LOG_PAYLOAD_SIZE] {};
+};
+
+struct DeferredLogRing
+{
+    DeferredLogRecord records[DEFERRED_LOG_RING_SIZE];
+
+    // Written by owner thread
+    alignas(64) std::atomic<uint32_t> head { 0 };
+    std::atomic<uint64_t> dropped { 0 };
+
+    // Written by log thread
+    alignas(64) std::atomic<uint32_t> tail { 0 };
+
+    std::atomic<bool> ownerAlive { true };
+};
+
+class DeferredLog
+{
+  private:
+    inline static std::atomic<bool> _enabled { false };
+
+    template <typename T> static constexpr bool IsDeferrable()
+    {
+        using D = std::remove_cvref_t<T>;
+
+        if constexpr (!std::is_trivially_copyable_v<D> || !std::is_default_constructible_v<D>)
+            return false;
+        else if constexpr (std::is_pointer_v<D> || std::is_array_v<D>)
+            return false;
+        else if constexpr (std::is_same_v<D, std::string_view> || std::is_same_v<D, std::wstring_view>)
+            return false;
+        else
+            return true;
+    }
+
+    template <typename... Args> static std::string Decode(std::string_view fmt, const uint8_t* payload)
+    {
+        std::tuple<Args...> values;
+
+        std::apply(
+            [payload](auto&... value)
+            {
+                size_t offset = 0;
+                ((memcpy(&value, payload + offset, sizeof(value)), offset += sizeof(value)), ...);
+            },
+            values);
+
+        return std::apply([fmt](auto&... value) { return std::vformat(fmt, std::make_format_args(value...)); },
+                          values);
+    }
+
+    static DeferredLogRing* ThreadRing();
+
+    // Writes calling thread's deferred records, no-op when it has none
+    static void FlushThread();
+
+  public:
+    static void Init();
+    static void Shutdown();
+
+    static bool IsEnabled() { return _enabled.load(std::memory_order_relaxed); }
+
+    // Used by log macros before evaluating arguments
+    static bool ShouldLog(spdlog::level::level_enum level)
+    {
+        auto logger = spdlog::default_logger_raw();
+        return logger != nullptr && logger->should_log(level);
+    }
+
+    template <typename... Args>
+    static void Log(spdlog::level::level_enum level, std::format_string<Args...> fmt, Args&&... args)
+    {
+        auto logger = spdlog::default_logger_raw();
+
+        if (logger == nullptr || !logger->should_log(level))
+            return;
+
+        constexpr bool deferrable = (IsDeferrable<Args>() && ...);
+        constexpr size_t payloadSize = (size_t(0) + ... + sizeof(std::remove_cvref_t<Args>));
+
+        if constexpr (deferrable && payloadSize <= DEFERRED_LOG_PAYLOAD_SIZE)
+        {
+            if (IsEnabled())
+            {
+                auto ring = ThreadRing();
+                auto head = ring->head.load(std::memory_order_relaxed);
+
+                // Never block the caller, count and drop when log thread can't keep up
+                if (head - ring->tail.load(std::memory_order_acquire) >= DEFERRED_LOG_RING_SIZE)
+                {
+                    ring->dropped.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+
+                auto& record = ring->records[head & (DEFERRED_LOG_RING_SIZE - 1)];
+                auto fmtView = fmt.get();
+
+                record.decode = &Decode<std::remove_cvref_t<Args>...>;
+                record.fmt = fmtView.data();
+                record.fmtSize = (uint32_t) fmtView.size();
+                record.level = level;
+                record.time = spdlog::log_clock::now();
+
+                [[maybe_unused]] size_t offset = 0;
+                ((memcpy(record.payload + offset, &args, sizeof(std::remove_cvref_t<Args>)),
+                  offset += sizeof(std::remove_cvref_t<Args>)),
+                 ...);
+
+                ring->head.store(head + 1, std::memory_order_release);
+                return;
+            }
+        }
+
+        if (IsEnabled())
+            FlushThread();
+
+        logger->log(level, fmt, std::forward<Args>(args)...);
+    }
+
+    // Wide format strings are rare, always log them directly
+    template <typename... Args>
+    static void Log(spdlog::level::level_enum level, std::wformat_string<Args...> fmt, Args&&... args)
+    {
+        auto logger = spdlog::default_logger_raw();
+
+        if (logger == nullptr)
+            return;
+
+        if (IsEnabled())
+            FlushThread();
+
+        logger->log(level, fmt, std::forward<Args>(args)...);
+    }
+
+    // Info and above, never deferred
+    template <typename... Args>
+    static void LogNow(spdlog::level::level_enum level, std::format_string<Args...> fmt, Args&&... args)
+    {
+        auto logger = spdlog::default_logger_raw();
+
+        if (logger == nullptr || !logger->should_log(level))
+            return;
+
+        if (IsEnabled())
+            FlushThread();
+
+        logger->log(level, fmt, std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    static void LogNow(spdlog::level::level_enum level, std::wformat_string<Args...> fmt, Args&&... args)
+    {
+        Log(level, fmt, std::forward<Args>(args)...);
+    }
+};
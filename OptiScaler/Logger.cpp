@@ -163,6 +163,9 @@ void PrepareLogger()
             shared_logger->flush_on(spdlog::level::trace);
 
             spdlog::set_default_logger(shared_logger);
+
+            if (Config::Instance()->LogDeferred.value_or_default())
+                DeferredLog::Init();
         }
     }
     catch (const spdlog::spdlog_ex& ex)
@@ -178,6 +181,7 @@ void PrepareLogger()
 
 void CloseLogger()
 {
+    DeferredLog::Shutdown();
     spdlog::default_logger()->flush();
     spdlog::shutdown();
 }
@@ -2,6 +2,8 @@
 #include "SysUtils.h"
 
 #include "Config.h"
+#include <misc/DynamicResolution.h>
+#include <misc/OptimalSettings.h>
 
 #include <ankerl/unordered_dense.h>
 
@@ -18,71 +20,42 @@
 #define LOG_PARAM(msg, ...)
 #endif
 
-/// @brief Calculates the resolution scaling ratio override based on the provided quality level and current
-/// configuration.
-/// @param input The performance quality value (e.g. Quality, Balanced, Performance).
-/// @return An optional float containing the ratio if an override applies.
-inline static std::optional<float> GetQualityOverrideRatio(const NVSDK_NGX_PerfQuality_Value input)
+/// @brief Replaces the advertised render resolution with the one picked by the dynamic resolution controller.
+/// Dynamic min/max render sizes must already be set, controller stays inside them.
+inline static void ApplyDynamicResolution(NVSDK_NGX_Parameter* InParams, unsigned int Width, unsigned int Height,
+                                          unsigned int& OutWidth, unsigned int& OutHeight, float& scalingRatio)
 {
-    std::optional<float> output;
+    if (!DynamicResolution::IsEnabled() || Width == 0 || Height == 0)
+        return;
 
-    auto sliderLimit = Config::Instance()->ExtendedLimits.value_or_default() ? 0.1f : 1.0f;
+    unsigned int minWidth = OutWidth;
+    unsigned int maxWidth = Width;
+    InParams->Get(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Width, &minWidth);
+    InParams->Get(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Max_Render_Width, &maxWidth);
 
-    if (Config::Instance()->UpscaleRatioOverrideEnabled.value_or_default() &&
-        Config::Instance()->UpscaleRatioOverrideValue.value_or_default() >= sliderLimit)
-    {
-        output = Config::Instance()->UpscaleRatioOverrideValue.value_or_default();
-
-        return output;
-    }
+    auto scale = DynamicResolution::RenderScale((float) OutWidth / (float) Width, (float) minWidth / (float) Width,
+                                                (float) maxWidth / (float) Width);
 
-    if (!Config::Instance()->QualityRatioOverrideEnabled.value_or_default())
-        return output; // override not enabled
+    OutWidth = (unsigned int) ((float) Width * scale);
+    OutHeight = (unsigned int) ((float) Height * scale);
 
-    switch (input)
+    if (Config::Instance()->RoundInternalResolution.has_value())
     {
-    case NVSDK_NGX_PerfQuality_Value_UltraPerformance:
-        if (Config::Instance()->QualityRatio_UltraPerformance.value_or_default() >= sliderLimit)
-            output = Config::Instance()->QualityRatio_UltraPerformance.value_or_default();
-
-        break;
-
-    case NVSDK_NGX_PerfQuality_Value_MaxPerf:
-        if (Config::Instance()->QualityRatio_Performance.value_or_default() >= sliderLimit)
-            output = Config::Instance()->QualityRatio_Performance.value_or_default();
-
-        break;
-
-    case NVSDK_NGX_PerfQuality_Value_Balanced:
-        if (Config::Instance()->QualityRatio_Balanced.value_or_default() >= sliderLimit)
-            output = Config::Instance()->QualityRatio_Balanced.value_or_default();
-
-        break;
-
-    case NVSDK_NGX_PerfQuality_Value_MaxQuality:
-        if (Config::Instance()->QualityRatio_Quality.value_or_default() >= sliderLimit)
-            output = Config::Instance()->QualityRatio_Quality.value_or_default();
-
-        break;
-
-    case NVSDK_NGX_PerfQuality_Value_UltraQuality:
-        if (Config::Instance()->QualityRatio_UltraQuality.value_or_default() >= sliderLimit)
-            output = Config::Instance()->QualityRatio_UltraQuality.value_or_default();
-
-        break;
-
-    case NVSDK_NGX_PerfQuality_Value_DLAA:
-        if (Config::Instance()->QualityRatio_DLAA.value_or_default() >= sliderLimit)
-            output = Config::Instance()->QualityRatio_DLAA.value_or_default();
+        OutHeight -= OutHeight % Config::Instance()->RoundInternalResolution.value();
+        OutWidth -= OutWidth % Config::Instance()->RoundInternalResolution.value();
+    }
 
-        break;
+    scalingRatio = (float) OutWidth / (float) Width;
 
-    default:
-        LOG_WARN("Unknown quality: {0}", (int) input);
-        break;
-    }
+    InParams->Set(NVSDK_NGX_Parameter_Scale, scalingRatio);
+    InParams->Set(NVSDK_NGX_Parameter_SuperSampling_ScaleFactor, scalingRatio);
+    InParams->Set(NVSDK_NGX_Parameter_OutWidth, OutWidth);
+    InParams->Set(NVSDK_NGX_Parameter_OutHeight, OutHeight);
+    InParams->Set(NVSDK_NGX_EParameter_Scale, scalingRatio);
+    InParams->Set(NVSDK_NGX_EParameter_OutWidth, OutWidth);
+    InParams->Set(NVSDK_NGX_EParameter_OutHeight, OutHeight);
 
-    return output;
+    LOG_DEBUG("Dynamic resolution: {}x{} ({:.3f})", OutWidth, OutHeight, scalingRatio);
 }
 
 /// @brief Callback invoked by the game/SDK to calculate optimal DLSS render settings (resolution, scaling) based on
@@ -93,142 +66,32 @@ inline static NVSDK_NGX_Result NVSDK_CONV NVSDK_NGX_DLSS_GetOptimalSettingsCallb
 {
     unsigned int Width;
     unsigned int Height;
-    unsigned int OutWidth;
-    unsigned int OutHeight;
-    float scalingRatio = 0.0f;
     int PerfQualityValue;
 
+    // If any of these params are uninitialized, return fail
     if (InParams->Get(NVSDK_NGX_Parameter_Width, &Width) != NVSDK_NGX_Result_Success ||
         InParams->Get(NVSDK_NGX_Parameter_Height, &Height) != NVSDK_NGX_Result_Success ||
         InParams->Get(NVSDK_NGX_Parameter_PerfQualityValue, &PerfQualityValue) != NVSDK_NGX_Result_Success)
         return NVSDK_NGX_Result_Fail;
 
-    auto enumPQValue = (NVSDK_NGX_PerfQuality_Value) PerfQualityValue;
+    LOG_DEBUG("Display Resolution: {0}x{1} Quality: {2}", Width, Height, PerfQualityValue);
 
-    LOG_DEBUG("Display Resolution: {0}x{1}", Width, Height);
+    auto settings = OptimalSettings::Get(OptimalSettingsFeature::DLSS, (NVSDK_NGX_PerfQuality_Value) PerfQualityValue,
+                                         Width, Height);
 
-    const std::optional<float> QualityRatio = GetQualityOverrideRatio(enumPQValue);
-
-    if (QualityRatio.has_value())
-    {
-        OutHeight = (unsigned int) ((float) Height / QualityRatio.value());
-        OutWidth = (unsigned int) ((float) Width / QualityRatio.value());
-        scalingRatio = 1.0f / QualityRatio.value();
-    }
-    else
-    {
-        LOG_DEBUG("Quality: {0}", PerfQualityValue);
-
-        switch (enumPQValue)
-        {
-        case NVSDK_NGX_PerfQuality_Value_UltraPerformance:
-            OutHeight = (unsigned int) ((float) Height / 3.0);
-            OutWidth = (unsigned int) ((float) Width / 3.0);
-            scalingRatio = 0.33333333f;
-            break;
-
-        case NVSDK_NGX_PerfQuality_Value_MaxPerf:
-            OutHeight = (unsigned int) ((float) Height / 2.0);
-            OutWidth = (unsigned int) ((float) Width / 2.0);
-            scalingRatio = 0.5f;
-            break;
-
-        case NVSDK_NGX_PerfQuality_Value_Balanced:
-            OutHeight = (unsigned int) ((float) Height / 1.7);
-            OutWidth = (unsigned int) ((float) Width / 1.7);
-            scalingRatio = 1.0f / 1.7f;
-            break;
-
-        case NVSDK_NGX_PerfQuality_Value_MaxQuality:
-            OutHeight = (unsigned int) ((float) Height / 1.5);
-            OutWidth = (unsigned int) ((float) Width / 1.5);
-            scalingRatio = 1.0f / 1.5f;
-            break;
-
-        case NVSDK_NGX_PerfQuality_Value_UltraQuality:
-            OutHeight = (unsigned int) ((float) Height / 1.3);
-            OutWidth = (unsigned int) ((float) Width / 1.3);
-            scalingRatio = 1.0f / 1.3f;
-            break;
-
-        case NVSDK_NGX_PerfQuality_Value_DLAA:
-            OutHeight = Height;
-            OutWidth = Width;
-            scalingRatio = 1.0f;
-            break;
-
-        default:
-            OutHeight = (unsigned int) ((float) Height / 1.7);
-            OutWidth = (unsigned int) ((float) Width / 1.7);
-            scalingRatio = 1.0f / 1.7f;
-            break;
-        }
-    }
-
-    if (Config::Instance()->RoundInternalResolution.has_value())
-    {
-        OutHeight -= OutHeight % Config::Instance()->RoundInternalResolution.value();
-        OutWidth -= OutWidth % Config::Instance()->RoundInternalResolution.value();
-        scalingRatio = (float) OutWidth / (float) Width;
-    }
+    unsigned int OutWidth = settings.renderWidth;
+    unsigned int OutHeight = settings.renderHeight;
+    float scalingRatio = settings.scale;
 
     InParams->Set(NVSDK_NGX_Parameter_Scale, scalingRatio);
     InParams->Set(NVSDK_NGX_Parameter_SuperSampling_ScaleFactor, scalingRatio);
     InParams->Set(NVSDK_NGX_Parameter_OutWidth, OutWidth);
     InParams->Set(NVSDK_NGX_Parameter_OutHeight, OutHeight);
 
-    // DRS minimum resolution
-    if (Config::Instance()->DrsMinOverrideEnabled.value_or_default() || enumPQValue == NVSDK_NGX_PerfQuality_Value_DLAA)
-    {
-        InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Width, OutWidth);
-        InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Height, OutHeight);
-    }
-    else
-    {
-        if (Config::Instance()->ExtendedLimits.value_or_default() && OutWidth > Width)
-        {
-            InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Width, OutWidth);
-            InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Height, OutHeight);
-        }
-        else
-        {
-            // DLSS normally only supports DRS in range of 0.5 and 1.0
-            auto drsMinWidth = (unsigned int) ((float) Width * 0.5f);
-            auto drsMinHeight = (unsigned int) ((float) Height * 0.5f);
-
-            if (OutWidth < drsMinWidth || OutHeight < drsMinHeight)
-            {
-                InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Width, OutWidth);
-                InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Height, OutHeight);
-            }
-            else
-            {
-                InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Width, drsMinWidth);
-                InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Height, drsMinHeight);
-            }
-        }
-    }
-
-    // DRS maximum resolution
-
-    if (Config::Instance()->DrsMaxOverrideEnabled.value_or_default())
-    {
-        InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Max_Render_Width, OutWidth);
-        InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Max_Render_Height, OutHeight);
-    }
-    else
-    {
-        if (Config::Instance()->ExtendedLimits.value_or_default() && OutWidth > Width)
-        {
-            InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Max_Render_Width, OutWidth);
-            InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Max_Render_Height, OutHeight);
-        }
-        else
-        {
-            InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Max_Render_Width, Width);
-            InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Max_Render_Height, Height);
-        }
-    }
+    InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Width, settings.minWidth);
+    InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Height, settings.minHeight);
+    InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Max_Render_Width, settings.maxWidth);
+    InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Max_Render_Height, settings.maxHeight);
 
     InParams->Set(NVSDK_NGX_Parameter_SizeInBytes, Width * Height * 31);
     InParams->Set(NVSDK_NGX_Parameter_DLSSMode, NVSDK_NGX_DLSS_Mode_DLSS_DLISP);
@@ -239,6 +102,8 @@ inline static NVSDK_NGX_Result NVSDK_CONV NVSDK_NGX_DLSS_GetOptimalSettingsCallb
     InParams->Set(NVSDK_NGX_EParameter_SizeInBytes, Width * Height * 31);
     InParams->Set(NVSDK_NGX_EParameter_DLSSMode, NVSDK_NGX_DLSS_Mode_DLSS_DLISP);
 
+    ApplyDynamicResolution(InParams, Width, Height, OutWidth, OutHeight, scalingRatio);
+
     LOG_DEBUG("NVSDK_NGX_DLSS_GetOptimalSettingsCallback: Display Resolution: {0}x{1} Render Resolution: {2}x{3}",
               Width, Height, OutWidth, OutHeight);
     return NVSDK_NGX_Result_Success;
@@ -251,9 +116,6 @@ inline static NVSDK_NGX_Result NVSDK_CONV NVSDK_NGX_DLSSD_GetOptimalSettingsCall
 {
     unsigned int Width;
     unsigned int Height;
-    unsigned int OutWidth;
-    unsigned int OutHeight;
-    float scalingRatio = 0.0f;
     int PerfQualityValue;
 
     // If any of these params are uninitialized, return fail
@@ -262,119 +124,24 @@ inline static NVSDK_NGX_Result NVSDK_CONV NVSDK_NGX_DLSSD_GetOptimalSettingsCall
         InParams->Get(NVSDK_NGX_Parameter_PerfQualityValue, &PerfQualityValue) != NVSDK_NGX_Result_Success)
         return NVSDK_NGX_Result_Fail;
 
-    auto enumPQValue = (NVSDK_NGX_PerfQuality_Value) PerfQualityValue;
+    LOG_DEBUG("Display Resolution: {0}x{1} Quality: {2}", Width, Height, PerfQualityValue);
 
-    LOG_DEBUG("Display Resolution: {0}x{1}", Width, Height);
-
-    const std::optional<float> QualityRatio = GetQualityOverrideRatio(enumPQValue);
-
-    if (QualityRatio.has_value())
-    {
-        OutHeight = (unsigned int) ((float) Height / QualityRatio.value());
-        OutWidth = (unsigned int) ((float) Width / QualityRatio.value());
-        scalingRatio = 1.0f / QualityRatio.value();
-    }
-    else
-    {
-        LOG_DEBUG("Quality: {0}", PerfQualityValue);
-
-        switch (enumPQValue)
-        {
-        case NVSDK_NGX_PerfQuality_Value_UltraPerformance:
-            OutHeight = (unsigned int) ((float) Height / 3.0);
-            OutWidth = (unsigned int) ((float) Width / 3.0);
-            scalingRatio = 0.33333333f;
-            break;
-
-        case NVSDK_NGX_PerfQuality_Value_MaxPerf:
-            OutHeight = (unsigned int) ((float) Height / 2.0);
-            OutWidth = (unsigned int) ((float) Width / 2.0);
-            scalingRatio = 0.5f;
-            break;
-
-        case NVSDK_NGX_PerfQuality_Value_Balanced:
-            OutHeight = (unsigned int) ((float) Height / 1.7);
-            OutWidth = (unsigned int) ((float) Width / 1.7);
-            scalingRatio = 1.0f / 1.7f;
-            break;
-
-        case NVSDK_NGX_PerfQuality_Value_MaxQuality:
-            OutHeight = (unsigned int) ((float) Height / 1.5);
-            OutWidth = (unsigned int) ((float) Width / 1.5);
-            scalingRatio = 1.0f / 1.5f;
-            break;
-
-        case NVSDK_NGX_PerfQuality_Value_UltraQuality:
-            OutHeight = (unsigned int) ((float) Height / 1.3);
-            OutWidth = (unsigned int) ((float) Width / 1.3);
-            scalingRatio = 1.0f / 1.3f;
-            break;
-
-        case NVSDK_NGX_PerfQuality_Value_DLAA:
-            OutHeight = Height;
-            OutWidth = Width;
-            scalingRatio = 1.0f;
-            break;
-
-        default:
-            OutHeight = (unsigned int) ((float) Height / 1.7);
-            OutWidth = (unsigned int) ((float) Width / 1.7);
-            scalingRatio = 1.0f / 1.7f;
-            break;
-        }
-    }
+    auto settings = OptimalSettings::Get(OptimalSettingsFeature::DLSSD, (NVSDK_NGX_PerfQuality_Value) PerfQualityValue,
+                                         Width, Height);
 
-    if (Config::Instance()->RoundInternalResolution.has_value())
-    {
-        OutHeight -= OutHeight % Config::Instance()->RoundInternalResolution.value();
-        OutWidth -= OutWidth % Config::Instance()->RoundInternalResolution.value();
-    }
+    unsigned int OutWidth = settings.renderWidth;
+    unsigned int OutHeight = settings.renderHeight;
+    float scalingRatio = settings.scale;
 
     InParams->Set(NVSDK_NGX_Parameter_Scale, scalingRatio);
     InParams->Set(NVSDK_NGX_Parameter_SuperSampling_ScaleFactor, scalingRatio);
     InParams->Set(NVSDK_NGX_Parameter_OutWidth, OutWidth);
     InParams->Set(NVSDK_NGX_Parameter_OutHeight, OutHeight);
 
-    // DRS minimum resolution
-    if (Config::Instance()->DrsMinOverrideEnabled.value_or_default())
-    {
-        InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Width, OutWidth);
-        InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Height, OutHeight);
-    }
-    else if (enumPQValue == NVSDK_NGX_PerfQuality_Value_DLAA)
-    {
-        InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Width, Width);
-        InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Height, Height);
-    }
-    else
-    {
-        // DLSS normally only supports DRS in range of 0.5 and 1.0
-        auto drsMinWidth = (unsigned int) ((float) Width * 0.5f);
-        auto drsMinHeight = (unsigned int) ((float) Height * 0.5f);
-
-        if (OutWidth < drsMinWidth || OutHeight < drsMinHeight)
-        {
-            InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Width, OutWidth);
-            InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Height, OutHeight);
-        }
-        else
-        {
-            InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Width, drsMinWidth);
-            InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Height, drsMinHeight);
-        }
-    }
-
-    // DRS maximum resolution
-    if (Config::Instance()->DrsMaxOverrideEnabled.value_or_default())
-    {
-        InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Max_Render_Width, OutWidth);
-        InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Max_Render_Height, OutHeight);
-    }
-    else
-    {
-        InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Max_Render_Width, Width);
-        InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Max_Render_Height, Height);
-    }
+    InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Width, settings.minWidth);
+    InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Height, settings.minHeight);
+    InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Max_Render_Width, settings.maxWidth);
+    InParams->Set(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Max_Render_Height, settings.maxHeight);
 
     InParams->Set(NVSDK_NGX_Parameter_SizeInBytes, Width * Height * 31);
     InParams->Set(NVSDK_NGX_Parameter_DLSSMode, NVSDK_NGX_DLSS_Mode_DLSS_DLISP);
@@ -385,6 +152,8 @@ inline static NVSDK_NGX_Result NVSDK_CONV NVSDK_NGX_DLSSD_GetOptimalSettingsCall
     InParams->Set(NVSDK_NGX_EParameter_SizeInBytes, Width * Height * 31);
     InParams->Set(NVSDK_NGX_EParameter_DLSSMode, NVSDK_NGX_DLSS_Mode_DLSS_DLISP);
 
+    ApplyDynamicResolution(InParams, Width, Height, OutWidth, OutHeight, scalingRatio);
+
     LOG_DEBUG("Display Resolution: {0}x{1} Render Resolution: {2}x{3}", Width, Height, OutWidth, OutHeight);
     return NVSDK_NGX_Result_Success;
 }
@@ -9,6 +9,7 @@
 #include <vulkan/vulkan.h>
 #include <ankerl/unordered_dense.h>
 #include <mutex>
+#include <atomic>
 
 typedef enum API
 {
@@ -220,6 +221,7 @@ class State
     std::deque<double> frameTimes;
     double lastFGFrameTime = 0.0;
     double presentFrameTime = 0.0;
+    bool presentIsGenerated = false; // Current present is an FG generated frame
     std::mutex frameTimeMutex;
 
     // Version check
@@ -230,6 +232,7 @@ class State
     std::string latestVersionTag;
     std::string latestVersionUrl;
     std::string versionCheckError;
+    std::atomic<bool> updateNoticePending = false; // Set with a newer release, cleared when the menu takes it
 
     // Swapchain info
     float screenWidth = 800.0;
@@ -26,6 +26,8 @@
 #define SPDLOG_WCHAR_TO_UTF8_SUPPORT
 #include "spdlog/spdlog.h"
 
+#include "DeferredLog.h"
+
 #define VK_USE_PLATFORM_WIN32_KHR
 
 #define BUFFER_COUNT 4
@@ -72,12 +74,22 @@ inline HMODULE d3d12AgilityModule = nullptr;
 inline HMODULE slInterposerModule = nullptr;
 inline DWORD processId;
 
-#define LOG_TRACE(msg, ...) spdlog::trace(__FUNCTION__ " " msg, ##__VA_ARGS__)
+// Trace and debug logs go through DeferredLog, formatted on log thread when LogDeferred is enabled.
+// Level is checked before arguments are evaluated, disabled levels cost a single compare.
+// Info and above are logged directly, after the calling thread's deferred records.
+#define LOG_LEVEL_GATED(level, msg, ...)                                                                               \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if (DeferredLog::ShouldLog(level))                                                                             \
+            DeferredLog::Log(level, msg, ##__VA_ARGS__);                                                               \
+    } while (0)
+
+#define LOG_TRACE(msg, ...) LOG_LEVEL_GATED(spdlog::level::trace, __FUNCTION__ " " msg, ##__VA_ARGS__)
 
-#define LOG_DEBUG(msg, ...) spdlog::debug(__FUNCTION__ " " msg, ##__VA_ARGS__)
+#define LOG_DEBUG(msg, ...) LOG_LEVEL_GATED(spdlog::level::debug, __FUNCTION__ " " msg, ##__VA_ARGS__)
 
 #ifdef DETAILED_DEBUG_LOGS
-#define LOG_DEBUG_ONLY(msg, ...) spdlog::debug(__FUNCTION__ " " msg, ##__VA_ARGS__)
+#define LOG_DEBUG_ONLY(msg, ...) LOG_LEVEL_GATED(spdlog::level::debug, __FUNCTION__ " " msg, ##__VA_ARGS__)
 #else
 #define LOG_DEBUG_ONLY(msg, ...)
 #endif
@@ -88,20 +100,20 @@ inline DWORD processId;
 #define LOG_DEBUG_ASYNC(msg, ...)
 #endif
 
-#define LOG_INFO(msg, ...) spdlog::info(__FUNCTION__ " " msg, ##__VA_ARGS__)
+#define LOG_INFO(msg, ...) DeferredLog::LogNow(spdlog::level::info, __FUNCTION__ " " msg, ##__VA_ARGS__)
 
-#define LOG_WARN(msg, ...) spdlog::warn(__FUNCTION__ " " msg, ##__VA_ARGS__)
+#define LOG_WARN(msg, ...) DeferredLog::LogNow(spdlog::level::warn, __FUNCTION__ " " msg, ##__VA_ARGS__)
 
-#define LOG_ERROR(msg, ...) spdlog::error(__FUNCTION__ " " msg, ##__VA_ARGS__)
+#define LOG_ERROR(msg, ...) DeferredLog::LogNow(spdlog::level::err, __FUNCTION__ " " msg, ##__VA_ARGS__)
 
-#define LOG_FUNC() spdlog::trace(__FUNCTION__)
+#define LOG_FUNC() LOG_LEVEL_GATED(spdlog::level::trace, __FUNCTION__)
 
-#define LOG_FUNC_RESULT(result) spdlog::trace(__FUNCTION__ " result: {0:X}", (UINT64) result)
+#define LOG_FUNC_RESULT(result) LOG_LEVEL_GATED(spdlog::level::trace, __FUNCTION__ " result: {0:X}", (UINT64) result)
 
 // #define TRACKING_LOGS
 
 #ifdef TRACKING_LOGS
-#define LOG_TRACK(msg, ...) spdlog::debug(__FUNCTION__ " [RT] " msg, ##__VA_ARGS__)
+#define LOG_TRACK(msg, ...) LOG_LEVEL_GATED(spdlog::level::debug, __FUNCTION__ " [RT] " msg, ##__VA_ARGS__)
 #else
 #define LOG_TRACK(msg, ...)
 #endif
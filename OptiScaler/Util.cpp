@@ -3,6 +3,8 @@
 #include "Util.h"
 #include "Config.h"
 
+#include <misc/ModuleRanges.h>
+
 #include <shlobj.h>
 
 typedef LONG(WINAPI* RtlGetVersionPtr)(PRTL_OSVERSIONINFOW);
@@ -20,6 +22,9 @@ static IID streamlineRiid {};
 /// <returns>Caller module filename</returns>
 std::string Util::WhoIsTheCaller(void* returnAddress)
 {
+    if (ModuleRanges::IsActive())
+        return ModuleRanges::Name(returnAddress);
+
     char callerPath[MAX_PATH] = { 0 };
 
     // Get the return address from the current function call.
@@ -40,6 +45,9 @@ std::string Util::WhoIsTheCaller(void* returnAddress)
 
 HMODULE Util::GetCallerModule(void* returnAddress)
 {
+    if (ModuleRanges::IsActive())
+        return ModuleRanges::Find(returnAddress);
+
     HMODULE hModule = NULL;
 
     GetModuleHandleExA(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
@@ -48,6 +56,15 @@ HMODULE Util::GetCallerModule(void* returnAddress)
     return hModule;
 }
 
+bool Util::IsCallerModule(void* returnAddress, std::string_view moduleName)
+{
+    if (ModuleRanges::IsActive())
+        return ModuleRanges::IsInModule(returnAddress, moduleName);
+
+    auto caller = WhoIsTheCaller(returnAddress);
+    return caller.size() == moduleName.size() && _strnicmp(caller.c_str(), moduleName.data(), caller.size()) == 0;
+}
+
 std::wstring Util::GetWindowTitle(HWND hwnd)
 {
     const int maxLength = 512;
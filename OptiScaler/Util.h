@@ -44,6 +44,7 @@ std::optional<std::filesystem::path> FindFilePath(const std::filesystem::path& s
                                                   const std::filesystem::path fileName);
 std::string WhoIsTheCaller(void* returnAddress);
 HMODULE GetCallerModule(void* returnAddress);
+bool IsCallerModule(void* returnAddress, std::string_view moduleName);
 MonitorInfo GetMonitorInfoForWindow(HWND hwnd);
 MonitorInfo GetMonitorInfoForOutput(IDXGIOutput* pOutput);
 int GetActiveRefreshRate(HWND hwnd);
@@ -39,6 +39,9 @@
 
 #include <nvapi/NvApiHooks.h>
 
+#include <misc/PresentScheduler.h>
+#include <misc/ModuleRanges.h>
+
 #include "spoofing/User32_Spoofing.h"
 
 #include <cwctype>
@@ -1659,6 +1662,9 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD ul_reason_for_call, LPVOID lpReserv
         KernelBaseProxy::Init();
         Kernel32Proxy::Init();
 
+        // Address to module table for caller checks
+        ModuleRanges::Init();
+
         // Check for Wine
         spdlog::info("");
         State::Instance().isRunningOnLinux = IsRunningOnWine();
@@ -1885,6 +1891,9 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD ul_reason_for_call, LPVOID lpReserv
             NtdllProxy::FreeLibrary_Ldr(v);
         }
 
+        ModuleRanges::Shutdown();
+        PresentScheduler::Shutdown();
+
         spdlog::info("");
         spdlog::info("DLL_PROCESS_DETACH");
         spdlog::info("Unloading OptiScaler");
@@ -0,0 +1,137 @@
+#include "pch.h"
+#include "FG_CopyPlanner.h"
+
+bool FG_CopyPlanner::CanAlias(const FG_CopyRequest& request)
+{
+    auto& lifetime = _lifetimes[request.type];
+
+    return lifetime.resource == request.resource && lifetime.cooldown == 0 &&
+           lifetime.cleanFrames >= AliasCleanFrames;
+}
+
+FG_CopyPlan FG_CopyPlanner::Plan(const FG_CopyRequest& request, bool allowAlias, bool allowRegion)
+{
+    FG_CopyPlan plan {};
+
+    if (request.type >= FG_ResourceType::ResourceTypeCOUNT || request.resource == 0)
+        return plan;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (allowAlias && !request.depthStencil && CanAlias(request))
+    {
+        plan.mode = FG_CopyMode::Alias;
+    }
+    else if (allowRegion && !request.wholeOnly && request.rectWidth > 0 && request.rectHeight > 0 &&
+             request.rectLeft + request.rectWidth <= request.width &&
+             request.rectTop + request.rectHeight <= request.height &&
+             (request.rectWidth < request.width || request.rectHeight < request.height))
+    {
+        plan.mode = FG_CopyMode::Region;
+        plan.left = request.rectLeft;
+        plan.top = request.rectTop;
+        plan.right = request.rectLeft + (UINT) request.rectWidth;
+        plan.bottom = request.rectTop + request.rectHeight;
+    }
+
+    _planned[(size_t) plan.mode]++;
+
+    return plan;
+}
+
+void FG_CopyPlanner::Tagged(FG_ResourceType type, uintptr_t resource, bool observed)
+{
+    if (type >= FG_ResourceType::ResourceTypeCOUNT || resource == 0)
+        return;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto& lifetime = _lifetimes[type];
+
+    // Different resource, history of the old one says nothing about this one
+    if (lifetime.resource != resource)
+    {
+        lifetime.resource = resource;
+        lifetime.cleanFrames = 0;
+        lifetime.cooldown = 0;
+    }
+
+    lifetime.pending = true;
+
+    if (!observed)
+        _unobserved = true;
+
+    _written[type].store(false, std::memory_order_relaxed);
+    _watched[type].store(resource, std::memory_order_release);
+    _watching.store(true, std::memory_order_release);
+}
+
+void FG_CopyPlanner::Written(uintptr_t resource)
+{
+    if (resource == 0 || !_watching.load(std::memory_order_acquire))
+        return;
+
+    for (size_t i = 0; i < FG_ResourceType::ResourceTypeCOUNT; i++)
+    {
+        if (_watched[i].load(std::memory_order_acquire) == resource)
+            _written[i].store(true, std::memory_order_release);
+    }
+}
+
+void FG_CopyPlanner::Consumed(bool observed)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _watching.store(false, std::memory_order_release);
+
+    observed = observed && !_unobserved;
+    _unobserved = false;
+
+    for (size_t i = 0; i < FG_ResourceType::ResourceTypeCOUNT; i++)
+    {
+        auto& lifetime = _lifetimes[i];
+
+        if (!lifetime.pending)
+            continue;
+
+        lifetime.pending = false;
+        _watched[i].store(0, std::memory_order_release);
+
+        if (lifetime.cooldown > 0)
+            lifetime.cooldown--;
+
+        if (_written[i].load(std::memory_order_acquire))
+        {
+            if (lifetime.cleanFrames >= AliasCleanFrames)
+            {
+                LOG_DEBUG("Resource {:X} of type {} written before FG used it, back to copies", lifetime.resource, i);
+                _aliasDrops++;
+            }
+
+            lifetime.cleanFrames = 0;
+            lifetime.cooldown = AliasCooldownFrames;
+        }
+        else if (observed && lifetime.cleanFrames < AliasCleanFrames)
+        {
+            lifetime.cleanFrames++;
+        }
+    }
+}
+
+void FG_CopyPlanner::Reset()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _watching.store(false, std::memory_order_release);
+
+    for (size_t i = 0; i < FG_ResourceType::ResourceTypeCOUNT; i++)
+    {
+        _lifetimes[i] = {};
+        _watched[i].store(0, std::memory_order_release);
+        _written[i].store(false, std::memory_order_release);
+    }
+
+    _unobserved = false;
+    _planned[0] = _planned[1] = _planned[2] = 0;
+    _aliasDrops = 0;
+}
@@ -0,0 +1,110 @@
+#pragma once
+#include "SysUtils.h"
+#include "IFGFeature.h"
+
+#include <mutex>
+#include <atomic>
+
+// Copy planning for frame generation inputs
+//
+// Tagged inputs which are only valid now are copied before the game can overwrite them. Planner picks the
+// cheapest way which still gives FG the data it needs:
+//   - Alias:  no copy, source is used directly. Only when write tracking saw the game leave this resource alone
+//             between tagging and FG consumption for several observed frames in a row.
+//   - Region: only the interpolation rect is copied (CopyTextureRegion), target keeps the full size so
+//             offsets of the rect stay valid.
+//   - Full:   whole resource (CopyResource).
+//
+// Lifetime of tagged resources is fed by the caller:
+//   Tagged   -> resource is sent to FG
+//   Written  -> write of a tagged resource (RTV / UAV bind, clear, copy or resolve destination), called from
+//               resource tracking hooks
+//   Consumed -> FG used the inputs (after present), observed tells if write tracking was active meanwhile
+//
+// A frame only counts as clean when tracking was active both at tagging and at consumption.
+// Any write between tagging and consumption drops the resource back to copies for a cooldown period.
+// Depth stencil resources are never aliased, depth writes are not tracked.
+// Resources are opaque keys, no graphics API calls are made here.
+
+enum class FG_CopyMode : uint8_t
+{
+    Full,
+    Region,
+    Alias,
+};
+
+struct FG_CopyRequest
+{
+    FG_ResourceType type = FG_ResourceType::ResourceTypeCOUNT;
+    uintptr_t resource = 0;
+
+    UINT64 width = 0;
+    UINT height = 0;
+
+    // Interpolation rect, width or height 0 means not set
+    UINT rectLeft = 0;
+    UINT rectTop = 0;
+    UINT64 rectWidth = 0;
+    UINT rectHeight = 0;
+
+    // Depth stencil and multisampled resources can only be copied whole
+    bool wholeOnly = false;
+    bool depthStencil = false;
+};
+
+struct FG_CopyPlan
+{
+    FG_CopyMode mode = FG_CopyMode::Full;
+
+    // Region box, valid when mode is Region
+    UINT left = 0;
+    UINT top = 0;
+    UINT right = 0;
+    UINT bottom = 0;
+};
+
+struct FG_CopyLifetime
+{
+    uintptr_t resource = 0;
+    UINT cleanFrames = 0; // Observed frames in a row without writes after tagging
+    UINT cooldown = 0;    // Frames left before alias is allowed again after a write
+    bool pending = false; // Tagged and not consumed yet
+};
+
+class FG_CopyPlanner
+{
+  private:
+    inline static std::mutex _mutex;
+    inline static FG_CopyLifetime _lifetimes[FG_ResourceType::ResourceTypeCOUNT] {};
+
+    // Written from resource tracking hooks, checked without the lock
+    inline static std::atomic<uintptr_t> _watched[FG_ResourceType::ResourceTypeCOUNT] {};
+    inline static std::atomic<bool> _written[FG_ResourceType::ResourceTypeCOUNT] {};
+    inline static std::atomic<bool> _watching { false };
+    inline static bool _unobserved = false; // Tracking was off when something was tagged
+
+    inline static UINT64 _planned[3] {};
+    inline static UINT64 _aliasDrops = 0;
+
+    static bool CanAlias(const FG_CopyRequest& request);
+
+  public:
+    // Frames in a row without writes before a resource can be aliased
+    static constexpr UINT AliasCleanFrames = 8;
+
+    // Frames to wait after a write was seen on an aliased resource
+    static constexpr UINT AliasCooldownFrames = 120;
+
+    static FG_CopyPlan Plan(const FG_CopyRequest& request, bool allowAlias, bool allowRegion);
+
+    static void Tagged(FG_ResourceType type, uintptr_t resource, bool observed);
+    static void Written(uintptr_t resource);
+    static void Consumed(bool observed);
+
+    static bool IsWatching() { return _watching.load(std::memory_order_relaxed); }
+
+    static void Reset();
+
+    static UINT64 PlannedCount(FG_CopyMode mode) { return _planned[(size_t) mode]; }
+    static UINT64 AliasDrops() { return _aliasDrops; }
+};
@@ -0,0 +1,128 @@
+#include "pch.h"
+#include "FG_Pacing.h"
+
+UINT64 FG_Pacing::NewFrame()
+{
+    auto frame = _frameCount.fetch_add(1, std::memory_order_acq_rel) + 1;
+    auto lastDispatched = _lastDispatchedFrame.load(std::memory_order_acquire);
+
+    if (lastDispatched == 0 || (frame - lastDispatched) > 2)
+    {
+        LOG_WARN("Frame count jumped too much! _frameCount: {}, _lastDispatchedFrame: {}", frame, lastDispatched);
+
+        // Only move it if nobody dispatched meanwhile
+        _lastDispatchedFrame.compare_exchange_strong(lastDispatched, frame - 1, std::memory_order_acq_rel);
+    }
+
+    auto index = IndexOf(frame);
+    LOG_DEBUG("_frameCount: {}, fIndex: {}", frame, index);
+
+    _ready[index].store(0, std::memory_order_release);
+    _waitingExecute[index].store(false, std::memory_order_release);
+
+    return frame;
+}
+
+void FG_Pacing::FrameIdHint(UINT64 frameId, UINT64 allowedAhead)
+{
+    auto current = _frameCount.load(std::memory_order_acquire);
+
+    // Only increment frame count if it's higher than current one
+    // Also take allowed frame ahead into account to prevent wrong frame count
+    while (frameId > current && (frameId - current) > allowedAhead)
+    {
+        if (_frameCount.compare_exchange_weak(current, frameId, std::memory_order_acq_rel))
+        {
+            LOG_DEBUG("Old: {}, New: {}", current, frameId);
+            break;
+        }
+    }
+}
+
+void FG_Pacing::ResourceTagged(FG_ResourceType type, int index)
+{
+    _ready[index].fetch_or(1u << (uint32_t) type, std::memory_order_acq_rel);
+}
+
+bool FG_Pacing::IsReady(FG_ResourceType type, int index) const
+{
+    return (_ready[index].load(std::memory_order_acquire) & (1u << (uint32_t) type)) != 0;
+}
+
+int FG_Pacing::WillDispatchIndex(UINT64 allowedAhead, bool latestHasDepth) const
+{
+    auto frame = _frameCount.load(std::memory_order_acquire);
+    auto lastDispatched = _lastDispatchedFrame.load(std::memory_order_acquire);
+
+    // Render next one by default
+    auto willDispatch = lastDispatched + 1;
+
+    // Counter restarted or fell behind, if current frame has resources skip to it
+    if ((frame - lastDispatched) > allowedAhead || lastDispatched == 0 || lastDispatched > frame)
+    {
+        if (latestHasDepth)
+        {
+            LOG_DEBUG("Skipping not presented frames! _frameCount: {}, _lastDispatchedFrame: {}", frame,
+                      lastDispatched);
+
+            willDispatch = frame;
+        }
+    }
+
+    return IndexOf(willDispatch);
+}
+
+int FG_Pacing::Dispatch(UINT64 allowedAhead, bool latestHasResources, UINT64& willDispatchFrame)
+{
+    auto lastDispatched = _lastDispatchedFrame.load(std::memory_order_acquire);
+    UINT64 frame = 0;
+    UINT64 willDispatch = 0;
+
+    do
+    {
+        frame = _frameCount.load(std::memory_order_acquire);
+
+        // We are in same frame
+        if (frame == lastDispatched)
+            return -1;
+
+        // Render next one by default
+        willDispatch = lastDispatched + 1;
+
+        // Set dispatch frame as latest one
+        if (((frame - lastDispatched) > allowedAhead || lastDispatched == 0 || lastDispatched > frame) &&
+            latestHasResources)
+        {
+            willDispatch = frame;
+        }
+
+    } while (!_lastDispatchedFrame.compare_exchange_weak(lastDispatched, willDispatch, std::memory_order_acq_rel));
+
+    LOG_DEBUG("_lastDispatchedFrame: {}, _frameCount: {}, willDispatchFrame: {}", lastDispatched, frame, willDispatch);
+
+    willDispatchFrame = willDispatch;
+    return IndexOf(willDispatch);
+}
+
+void FG_Pacing::Pause()
+{
+    auto frame = _frameCount.load(std::memory_order_acquire);
+    _targetFrame.store(frame + PauseFrames, std::memory_order_release);
+    LOG_DEBUG("Current frame: {} target frame: {}", frame, frame + PauseFrames);
+}
+
+void FG_Pacing::ResetTarget()
+{
+    _targetFrame.store(_frameCount.load(std::memory_order_acquire), std::memory_order_release);
+}
+
+bool FG_Pacing::IsPaused() const
+{
+    auto target = _targetFrame.load(std::memory_order_acquire);
+    return target != 0 && target >= _frameCount.load(std::memory_order_acquire);
+}
+
+bool FG_Pacing::IsDispatched() const
+{
+    return _lastDispatchedFrame.load(std::memory_order_acquire) == _frameCount.load(std::memory_order_acquire);
+}
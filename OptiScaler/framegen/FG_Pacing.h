@@ -0,0 +1,77 @@
+#pragma once
+#include "SysUtils.h"
+
+#include <atomic>
+
+// Defined in IFGFeature.h
+enum FG_ResourceType : uint32_t;
+
+// Frame generation pacing state
+//
+// Frame counter, dispatch bookkeeping and per buffer readiness used by IFGFeature, as a lock free state machine.
+// Events come from different threads:
+//   - upscaler / FG inputs: NewFrame, ResourceTagged, FrameIdHint
+//   - present:              Dispatch, SetWaitingExecution, Executed
+//   - control:              Pause, ResetTarget, DispatchReset, Restart (context recreated on resize / FG change)
+//
+// All values are atomics. Dispatch claims the frame with a compare exchange, two presents racing for the same
+// frame can't both dispatch it. Inputs which depend on config or FG resources are passed in by the caller, so
+// orderings can be replayed without a device (see tests/tools/FG_PacingSim).
+
+class FG_Pacing
+{
+  private:
+    std::atomic<UINT64> _frameCount { 0 };
+    std::atomic<UINT64> _lastDispatchedFrame { 0 };
+    std::atomic<UINT64> _targetFrame { 0 };
+
+    std::atomic<uint32_t> _ready[BUFFER_COUNT] {}; // Bit per FG_ResourceType
+    std::atomic<bool> _waitingExecute[BUFFER_COUNT] {};
+
+  public:
+    // Frames FG stays paused after Pause
+    static constexpr UINT64 PauseFrames = 10;
+
+    static int IndexOf(UINT64 frame) { return (int) (frame % BUFFER_COUNT); }
+
+    int GetIndex() const { return IndexOf(_frameCount.load(std::memory_order_acquire)); }
+
+    // Upscaler / FG inputs started a new frame, clears readiness of its buffer. Returns the new frame id.
+    UINT64 NewFrame();
+
+    // Game provided frame id, only moves forward and only when it is more than allowedAhead frames ahead
+    void FrameIdHint(UINT64 frameId, UINT64 allowedAhead);
+
+    void ResourceTagged(FG_ResourceType type, int index);
+    bool IsReady(FG_ResourceType type, int index) const;
+
+    // Buffer index of the frame next Dispatch will pick, latestHasDepth is depth state of current frame buffer
+    int WillDispatchIndex(UINT64 allowedAhead, bool latestHasDepth) const;
+
+    // Claims the frame to generate, -1 when current frame is already dispatched.
+    // latestHasResources: buffer of current frame has any FG input, allows skipping frames which fell behind.
+    int Dispatch(UINT64 allowedAhead, bool latestHasResources, UINT64& willDispatchFrame);
+
+    void SetWaitingExecution(int index) { _waitingExecute[index].store(true, std::memory_order_release); }
+    bool WaitingExecution(int index) const { return _waitingExecute[index].load(std::memory_order_acquire); }
+    void Executed(int index) { _waitingExecute[index].store(false, std::memory_order_release); }
+
+    // Stops FG for PauseFrames frames
+    void Pause();
+
+    // Pause ends with the next frame
+    void ResetTarget();
+
+    // Next dispatch starts from the latest frame
+    void DispatchReset() { _lastDispatchedFrame.store(0, std::memory_order_release); }
+
+    // Frame counter restarts, used when FG context is recreated
+    void Restart() { _frameCount.store(1, std::memory_order_release); }
+
+    bool IsPaused() const;
+    bool IsDispatched() const;
+
+    UINT64 FrameCount() const { return _frameCount.load(std::memory_order_acquire); }
+    UINT64 LastDispatchedFrame() const { return _lastDispatchedFrame.load(std::memory_order_acquire); }
+    UINT64 TargetFrame() const { return _targetFrame.load(std::memory_order_acquire); }
+};
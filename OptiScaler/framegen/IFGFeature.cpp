@@ -2,53 +2,19 @@
 #include "IFGFeature.h"
 #include <Config.h>
 
-int IFGFeature::GetIndex() { return (_frameCount % BUFFER_COUNT); }
+int IFGFeature::GetIndex() { return _pacing.GetIndex(); }
 
 int IFGFeature::GetIndexWillBeDispatched()
 {
-    UINT64 df;
-
-    auto diff = _frameCount - _lastDispatchedFrame;
-    if (diff > Config::Instance()->FGAllowedFrameAhead.value_or_default() || diff < 0 || _lastDispatchedFrame == 0)
-    {
-        // If current index has resources, skip to it
-        if (HasResource(FG_ResourceType::Depth))
-        {
-            LOG_DEBUG("Skipping not presented frames! _frameCount: {}, _lastDispatchedFrame: {}", _frameCount,
-                      _lastDispatchedFrame);
-
-            df = _frameCount; // Set dispatch frame as new one
-        }
-        else
-        {
-            df = _lastDispatchedFrame + 1; // Render next one
-        }
-    }
-    else
-    {
-        df = _lastDispatchedFrame + 1; // Render next one
-    }
-
-    return (df % BUFFER_COUNT);
+    // If current index has resources, skip to it
+    return _pacing.WillDispatchIndex((UINT64) Config::Instance()->FGAllowedFrameAhead.value_or_default(),
+                                     HasResource(FG_ResourceType::Depth));
 }
 
 UINT64 IFGFeature::StartNewFrame()
 {
-    _frameCount++;
-
-    if (_lastDispatchedFrame == 0 || (_frameCount - _lastDispatchedFrame) > 2)
-    {
-        LOG_WARN("Frame count jumped too much! _frameCount: {}, _lastDispatchedFrame: {}", _frameCount,
-                 _lastDispatchedFrame);
-
-        _lastDispatchedFrame = _frameCount - 1;
-    }
-
-    auto fIndex = GetIndex();
-    LOG_DEBUG("_frameCount: {}, fIndex: {}", _frameCount, fIndex);
-
-    _resourceReady[fIndex].clear();
-    _waitingExecute[fIndex] = false;
+    auto frame = _pacing.NewFrame();
+    auto fIndex = FG_Pacing::IndexOf(frame);
 
     _noUi[fIndex] = true;
     _noDistortionField[fIndex] = true;
@@ -56,7 +22,7 @@ UINT64 IFGFeature::StartNewFrame()
 
     NewFrame();
 
-    return _frameCount;
+    return frame;
 }
 
 bool IFGFeature::IsResourceReady(FG_ResourceType type, int index)
@@ -64,7 +30,7 @@ bool IFGFeature::IsResourceReady(FG_ResourceType type, int index)
     if (index < 0)
         index = GetIndex();
 
-    return _resourceReady[index].contains(type);
+    return _pacing.IsReady(type, index);
 }
 
 bool IFGFeature::WaitingExecution(int index)
@@ -72,14 +38,14 @@ bool IFGFeature::WaitingExecution(int index)
     if (index < 0)
         index = GetIndex();
 
-    return _waitingExecute[index];
+    return _pacing.WaitingExecution(index);
 }
 void IFGFeature::SetExecuted(int index)
 {
     if (index < 0)
         index = GetIndex();
 
-    _waitingExecute[index] = false;
+    _pacing.Executed(index);
 }
 
 bool IFGFeature::IsUsingUI() { return !_noUi[GetIndex()]; }
@@ -133,37 +99,39 @@ bool IFGFeature::CheckForRealObject(std::string functionName, IUnknown* pObject,
 
 int IFGFeature::GetDispatchIndex(UINT64& willDispatchFrame)
 {
-    LOG_DEBUG("_lastDispatchedFrame: {},  _frameCount: {}", _lastDispatchedFrame, _frameCount);
+    auto index = GetIndex();
+    bool hasResources = false;
 
-    // We are in same frame
-    if (_frameCount == _lastDispatchedFrame)
-        return -1;
+    // Streamline decides per frame token when present is marked, resource tables are not checked
+    if (State::Instance().activeFgInput == FGInput::DLSSG)
+        hasResources = State::Instance().slFGInputs.IsPresentedFrameReady();
+    else
+        hasResources = HasResource(FG_ResourceType::Depth, index) || HasResource(FG_ResourceType::Velocity, index) ||
+                       HasResource(FG_ResourceType::UIColor, index) ||
+                       HasResource(FG_ResourceType::HudlessColor, index);
 
-    willDispatchFrame = _lastDispatchedFrame + 1; // By default render next one
+    auto allowedAhead = (UINT64) Config::Instance()->FGAllowedFrameAhead.value_or_default();
+    auto result = _pacing.Dispatch(allowedAhead, hasResources, willDispatchFrame);
 
-    auto diff = _frameCount - _lastDispatchedFrame;
-    if (diff > Config::Instance()->FGAllowedFrameAhead.value_or_default() || diff < 0 || _lastDispatchedFrame == 0)
-    {
-        auto index = GetIndex();
+    if (result >= 0)
+        _lastFGFrame = State::Instance().FGLastFrame;
 
-        if (HasResource(FG_ResourceType::Depth, index) || HasResource(FG_ResourceType::Velocity, index) ||
-            HasResource(FG_ResourceType::UIColor, index) || HasResource(FG_ResourceType::HudlessColor, index))
-        {
-            willDispatchFrame = _frameCount; // Set dispatch frame as latest one
-        }
-    }
+    return result;
+}
 
-    _lastDispatchedFrame = willDispatchFrame;
-    _lastFGFrame = State::Instance().FGLastFrame;
+bool IFGFeature::InputsReady(int index)
+{
+    if (State::Instance().activeFgInput == FGInput::DLSSG)
+        return State::Instance().slFGInputs.IsPresentedFrameReady();
 
-    return (willDispatchFrame % BUFFER_COUNT);
+    return _pacing.IsReady(FG_ResourceType::Depth, index) && _pacing.IsReady(FG_ResourceType::Velocity, index);
 }
 
 bool IFGFeature::IsActive() { return _isActive || _waitingNewFrameData; }
 
-bool IFGFeature::IsPaused() { return _targetFrame != 0 && _targetFrame >= _frameCount; }
+bool IFGFeature::IsPaused() { return _pacing.IsPaused(); }
 
-bool IFGFeature::IsDispatched() { return _lastDispatchedFrame == _frameCount; }
+bool IFGFeature::IsDispatched() { return _pacing.IsDispatched(); }
 
 bool IFGFeature::IsLowResMV() { return !_constants.flags[FG_Flags::DisplayResolutionMVs]; }
 
@@ -179,13 +147,7 @@ bool IFGFeature::IsInfiniteDepth() { return _constants.flags[FG_Flags::InfiniteD
 
 void IFGFeature::SetFrameCount(UINT64 frameId)
 {
-    // Only increment frame count, if it's higher than current one
-    // Also take allowed frame ahead into account to prevent wrong frame count
-    if (frameId > _frameCount && (frameId - _frameCount) > Config::Instance()->FGAllowedFrameAhead.value_or_default())
-    {
-        LOG_DEBUG("Old: {}, New: {}", _frameCount, frameId);
-        _frameCount = frameId;
-    }
+    _pacing.FrameIdHint(frameId, (UINT64) Config::Instance()->FGAllowedFrameAhead.value_or_default());
 }
 
 void IFGFeature::SetJitter(float x, float y, int index)
@@ -290,28 +252,23 @@ void IFGFeature::GetInterpolationPos(UINT& left, UINT& top, int index)
         top = 0;
 }
 
-void IFGFeature::ResetCounters() { _targetFrame = _frameCount; }
+void IFGFeature::ResetCounters() { _pacing.ResetTarget(); }
 
-void IFGFeature::UpdateTarget()
-{
-    _targetFrame = _frameCount + 10;
-    //_lastDispatchedFrame = 0;
-    LOG_DEBUG("Current frame: {} target frame: {}", _frameCount, _targetFrame);
-}
+void IFGFeature::UpdateTarget() { _pacing.Pause(); }
 
-UINT64 IFGFeature::FrameCount() { return _frameCount; }
+UINT64 IFGFeature::FrameCount() { return _pacing.FrameCount(); }
 
-UINT64 IFGFeature::LastDispatchedFrame() { return _lastDispatchedFrame; }
+UINT64 IFGFeature::LastDispatchedFrame() { return _pacing.LastDispatchedFrame(); }
 
-UINT64 IFGFeature::TargetFrame() { return _targetFrame; }
+UINT64 IFGFeature::TargetFrame() { return _pacing.TargetFrame(); }
 
 void IFGFeature::SetResourceReady(FG_ResourceType type, int index)
 {
     if (index < 0)
         index = GetIndex();
 
-    _resourceReady[index][type] = true;
-    _resourceFrame[type] = _frameCount;
+    _pacing.ResourceTagged(type, index);
+    _resourceFrame[type] = _pacing.FrameCount();
 }
 
 UINT IFGFeature::GetInterpolatedFrameCount() { return _framesToInterpolate; }
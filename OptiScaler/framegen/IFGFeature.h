@@ -1,5 +1,6 @@
 #pragma once
 #include "SysUtils.h"
+#include "FG_Pacing.h"
 #include <OwnedMutex.h>
 #include <dxgi1_6.h>
 #include <flag-set-cpp/flag_set.hpp>
@@ -69,28 +70,27 @@ class IFGFeature
     std::optional<UINT> _interpolationTop[BUFFER_COUNT];
     UINT _reset[BUFFER_COUNT] = {};
 
-    UINT64 _frameCount = 0;
-    UINT64 _lastDispatchedFrame = 0;
+    FG_Pacing _pacing;
     UINT64 _lastFGFrame = 0;
     bool _waitingNewFrameData = false;
     int _framesToInterpolate = 1;
 
     bool _isActive = false;
-    UINT64 _targetFrame = 0;
     FG_Constants _constants {};
 
-    std::unordered_map<FG_ResourceType, bool> _resourceReady[BUFFER_COUNT] {};
     std::unordered_map<FG_ResourceType, UINT64> _resourceFrame {};
 
     bool _noHudless[BUFFER_COUNT] = { true, true, true, true };
     bool _noUi[BUFFER_COUNT] = { true, true, true, true };
     bool _noDistortionField[BUFFER_COUNT] = { true, true, true, true };
-    bool _waitingExecute[BUFFER_COUNT] {};
 
     IID streamlineRiid {};
 
     bool CheckForRealObject(std::string functionName, IUnknown* pObject, IUnknown** ppRealObject);
     int GetDispatchIndex(UINT64& willDispatchFrame);
+
+    // Depth and velocity of the buffer are ready, for Streamline inputs the presented frame token has all inputs
+    bool InputsReady(int index);
     virtual void NewFrame() = 0;
 
   public:
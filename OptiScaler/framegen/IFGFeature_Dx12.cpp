@@ -3,6 +3,9 @@
 #include <State.h>
 #include <Config.h>
 
+#include <hooks/FG_ResizeState.h>
+#include <resource_tracking/ResTrack_dx12.h>
+
 #include <magic_enum.hpp>
 
 bool IFGFeature_Dx12::GetResourceCopy(FG_ResourceType type, D3D12_RESOURCE_STATES bufferState, ID3D12Resource* output)
@@ -187,7 +190,7 @@ void IFGFeature_Dx12::NewFrame()
 
     std::unique_lock<std::shared_mutex> lock(_resourceMutex[fIndex]);
 
-    LOG_DEBUG("_frameCount: {}, fIndex: {}", _frameCount, fIndex);
+    LOG_DEBUG("_frameCount: {}, fIndex: {}", _pacing.FrameCount(), fIndex);
 
     _frameResources[fIndex].clear();
     _uiCommandListResetted[fIndex] = false;
@@ -274,7 +277,8 @@ bool IFGFeature_Dx12::CreateBufferResourceWithSize(ID3D12Device* device, ID3D12R
         if (bufDesc.Width != width || bufDesc.Height != height || bufDesc.Format != inDesc.Format ||
             bufDesc.Flags != inDesc.Flags)
         {
-            (*target)->Release();
+            // Might be still in use by GPU, release after next present
+            FGResizeState::Retire(*target);
             (*target) = nullptr;
         }
         else
@@ -403,7 +407,8 @@ bool IFGFeature_Dx12::CreateBufferResource(ID3D12Device* device, ID3D12Resource*
         if (bufDesc.Width != inDesc.Width || bufDesc.Height != inDesc.Height || bufDesc.Format != inDesc.Format ||
             bufDesc.Flags != inDesc.Flags)
         {
-            (*target)->Release();
+            // Might be still in use by GPU, release after next present
+            FGResizeState::Retire(*target);
             (*target) = nullptr;
         }
         else
@@ -446,18 +451,80 @@ void IFGFeature_Dx12::ResourceBarrier(ID3D12GraphicsCommandList* cmdList, ID3D12
 }
 
 bool IFGFeature_Dx12::CopyResource(ID3D12GraphicsCommandList* cmdList, ID3D12Resource* source, ID3D12Resource** target,
-                                   D3D12_RESOURCE_STATES sourceState)
+                                   D3D12_RESOURCE_STATES sourceState, const FG_CopyPlan& plan)
 {
     auto result = true;
 
     ResourceBarrier(cmdList, source, sourceState, D3D12_RESOURCE_STATE_COPY_SOURCE);
 
     if (CreateBufferResource(_device, source, D3D12_RESOURCE_STATE_COPY_DEST, target))
-        cmdList->CopyResource(*target, source);
+    {
+        if (plan.mode == FG_CopyMode::Region)
+        {
+            // Target has the full size, region is copied to the same position
+            D3D12_TEXTURE_COPY_LOCATION dst {};
+            dst.pResource = *target;
+            dst.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+            dst.SubresourceIndex = 0;
+
+            D3D12_TEXTURE_COPY_LOCATION src {};
+            src.pResource = source;
+            src.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+            src.SubresourceIndex = 0;
+
+            D3D12_BOX box { plan.left, plan.top, 0, plan.right, plan.bottom, 1 };
+            cmdList->CopyTextureRegion(&dst, plan.left, plan.top, 0, &src, &box);
+        }
+        else
+        {
+            cmdList->CopyResource(*target, source);
+        }
+    }
     else
+    {
         result = false;
+    }
 
     ResourceBarrier(cmdList, source, D3D12_RESOURCE_STATE_COPY_SOURCE, sourceState);
 
     return result;
 }
+
+FG_CopyPlan IFGFeature_Dx12::PlanCopy(Dx12Resource* resource, int index)
+{
+    FG_CopyRequest request {};
+    request.type = resource->type;
+    request.resource = (uintptr_t) resource->resource;
+
+    auto desc = resource->resource->GetDesc();
+    request.width = desc.Width;
+    request.height = desc.Height;
+    request.depthStencil = (desc.Flags & D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL) != 0;
+    request.wholeOnly = desc.Dimension != D3D12_RESOURCE_DIMENSION_TEXTURE2D || desc.MipLevels > 1 ||
+                        desc.DepthOrArraySize > 1 || desc.SampleDesc.Count > 1 || request.depthStencil;
+
+    // Interpolation rect is in display coordinates and writes are only tracked for swapchain sized resources
+    auto& scDesc = State::Instance().currentSwapchainDesc.BufferDesc;
+    auto displaySized = desc.Width == scDesc.Width && desc.Height == scDesc.Height;
+
+    if (displaySized)
+    {
+        GetInterpolationRect(request.rectWidth, request.rectHeight, index);
+        GetInterpolationPos(request.rectLeft, request.rectTop, index);
+    }
+
+    // UI and hudless compare overlays read the whole resource
+    auto allowRegion = Config::Instance()->FGRegionCopy.value_or_default() &&
+                       resource->type != FG_ResourceType::UIColor && !State::Instance().FGHudlessCompare;
+
+    // Async FG can still be reading when the game starts the next frame
+    auto allowAlias = Config::Instance()->FGCopyAliasing.value_or_default() && displaySized && !IsAsync();
+
+    auto plan = FG_CopyPlanner::Plan(request, allowAlias, allowRegion);
+    FG_CopyPlanner::Tagged(request.type, request.resource, ResTrack_Dx12::IsWriteTrackingActive());
+
+    LOG_TRACE("{}, plan: {}, box: {},{} - {},{}", magic_enum::enum_name(resource->type),
+              magic_enum::enum_name(plan.mode), plan.left, plan.top, plan.right, plan.bottom);
+
+    return plan;
+}
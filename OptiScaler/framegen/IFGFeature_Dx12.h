@@ -1,6 +1,7 @@
 #pragma once
 #include "SysUtils.h"
 #include "IFGFeature.h"
+#include "FG_CopyPlanner.h"
 
 #include <upscalers/IFeature.h>
 
@@ -74,7 +75,10 @@ class IFGFeature_Dx12 : public virtual IFGFeature
     void ResourceBarrier(ID3D12GraphicsCommandList* InCommandList, ID3D12Resource* InResource,
                          D3D12_RESOURCE_STATES InBeforeState, D3D12_RESOURCE_STATES InAfterState);
     bool CopyResource(ID3D12GraphicsCommandList* cmdList, ID3D12Resource* source, ID3D12Resource** target,
-                      D3D12_RESOURCE_STATES sourceState);
+                      D3D12_RESOURCE_STATES sourceState, const FG_CopyPlan& plan = {});
+
+    // Decides how a ValidNow input of this frame will be copied, see FG_CopyPlanner
+    FG_CopyPlan PlanCopy(Dx12Resource* resource, int index);
 
     void NewFrame() override final;
     void FlipResource(Dx12Resource* resource);
@@ -4,6 +4,7 @@
 #include <State.h>
 
 #include <hudfix/Hudfix_Dx12.h>
+#include <resource_tracking/ResTrack_dx12.h>
 #include <menu/menu_overlay_dx.h>
 
 #include <magic_enum.hpp>
@@ -129,24 +130,30 @@ bool FSRFG_Dx12::HudlessFormatTransfer(int index, ID3D12Device* device, DXGI_FOR
         return false;
     }
 
+    // Sources which stay valid until present are transferred directly, others are copied first
+    FG_CopyPlan plan {};
+    auto copyFirst = false;
+
+    if (resource->cmdList != nullptr && resource->validity != FG_ResourceValidity::UntilPresent &&
+        resource->validity != FG_ResourceValidity::UntilPresentFromDispatch)
+    {
+        plan = PlanCopy(resource, index);
+        copyFirst = plan.mode != FG_CopyMode::Alias;
+    }
+
     if (_hudlessTransfer[index].get() != nullptr &&
         _hudlessTransfer[index].get()->CreateBufferResource(device, resource->GetResource(),
-                                                            D3D12_RESOURCE_STATE_UNORDERED_ACCESS) &&
-        (resource->cmdList == nullptr ||
-         CreateBufferResource(device, resource->GetResource(), D3D12_RESOURCE_STATE_COPY_DEST,
-                              &_hudlessCopyResource[index])))
+                                                            D3D12_RESOURCE_STATE_UNORDERED_ACCESS))
     {
         auto cmdList = GetUICommandList(index);
 
-        if (resource->cmdList != nullptr && _hudlessCopyResource[index] != nullptr)
+        if (copyFirst)
         {
-            ResourceBarrier(resource->cmdList, resource->GetResource(), resource->state,
-                            D3D12_RESOURCE_STATE_COPY_SOURCE);
-
-            resource->cmdList->CopyResource(_hudlessCopyResource[index], resource->GetResource());
-
-            ResourceBarrier(resource->cmdList, resource->GetResource(), D3D12_RESOURCE_STATE_COPY_SOURCE,
-                            resource->state);
+            if (!CopyResource(resource->cmdList, resource->GetResource(), &_hudlessCopyResource[index],
+                              resource->state, plan))
+            {
+                return false;
+            }
 
             ResourceBarrier(resource->cmdList, _hudlessCopyResource[index], D3D12_RESOURCE_STATE_COPY_DEST,
                             D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
@@ -304,12 +311,9 @@ bool FSRFG_Dx12::Dispatch()
     if (state.FSRFGFTPchanged)
         ConfigureFramePaceTuning();
 
-    LOG_DEBUG("_frameCount: {}, willDispatchFrame: {}, fIndex: {}", _frameCount, willDispatchFrame, fIndex);
+    LOG_DEBUG("_frameCount: {}, willDispatchFrame: {}, fIndex: {}", _pacing.FrameCount(), willDispatchFrame, fIndex);
 
-    if (!_resourceReady[fIndex].contains(FG_ResourceType::Depth) ||
-        !_resourceReady[fIndex].at(FG_ResourceType::Depth) ||
-        !_resourceReady[fIndex].contains(FG_ResourceType::Velocity) ||
-        !_resourceReady[fIndex].at(FG_ResourceType::Velocity))
+    if (!InputsReady(fIndex))
     {
         LOG_WARN("Depth or Velocity is not ready, skipping");
         return false;
@@ -530,7 +534,7 @@ bool FSRFG_Dx12::Dispatch()
         if (retCode == FFX_API_RETURN_OK)
         {
             _fgCommandList[fIndex]->Close();
-            _waitingExecute[fIndex] = true;
+            _pacing.SetWaitingExecution(fIndex);
             dispatchResult = ExecuteCommandList(fIndex);
         }
     }
@@ -664,7 +668,7 @@ void* FSRFG_Dx12::SwapchainContext()
 
 void FSRFG_Dx12::DestroyFGContext()
 {
-    _frameCount = 1;
+    _pacing.Restart();
     // _lastDispatchedFrame = 0;
     _version = {};
 
@@ -682,6 +686,8 @@ void FSRFG_Dx12::DestroyFGContext()
         _fgContext = nullptr;
     }
 
+    FG_CopyPlanner::Reset();
+
     ReleaseObjects();
 }
 
@@ -1036,7 +1042,7 @@ void FSRFG_Dx12::CreateContext(ID3D12Device* device, FG_Constants& fgConstants)
 
         LOG_INFO("D3D12_CreateContext result: {:X}", retCode);
         _isActive = (retCode == FFX_API_RETURN_OK);
-        _lastDispatchedFrame = 0;
+        _pacing.DispatchReset();
     }
 
     LOG_DEBUG("Create");
@@ -1058,7 +1064,7 @@ void FSRFG_Dx12::Activate()
         if (result == FFX_API_RETURN_OK)
         {
             _isActive = true;
-            _lastDispatchedFrame = 0;
+            _pacing.DispatchReset();
         }
 
         LOG_INFO("D3D12_Configure Enabled: true, result: {} ({})", magic_enum::enum_name((FfxApiReturnCodes) result),
@@ -1077,9 +1083,14 @@ void FSRFG_Dx12::Deactivate()
             auto closeResult = _uiCommandList[fIndex]->Close();
 
             if (closeResult == S_OK)
+            {
                 _gameCommandQueue->ExecuteCommandLists(1, (ID3D12CommandList**) &_uiCommandList[fIndex]);
+                DescriptorRing_Dx12::FrameDone(_gameCommandQueue, _uiCommandList[fIndex]);
+            }
             else
+            {
                 LOG_ERROR("_uiCommandList[{}]->Close() error: {:X}", fIndex, (UINT) closeResult);
+            }
 
             _uiCommandListResetted[fIndex] = false;
         }
@@ -1254,10 +1265,11 @@ void FSRFG_Dx12::ReleaseObjects()
 
 bool FSRFG_Dx12::ExecuteCommandList(int index)
 {
-    if (_waitingExecute[index])
+    if (_pacing.WaitingExecution(index))
     {
         LOG_DEBUG("Executing FG cmdList: {:X}", (size_t) _fgCommandList[index]);
         _gameCommandQueue->ExecuteCommandLists(1, (ID3D12CommandList**) &_fgCommandList[index]);
+        DescriptorRing_Dx12::FrameDone(_gameCommandQueue, _fgCommandList[index]);
         SetExecuted(index);
     }
 
@@ -1396,6 +1408,15 @@ bool FSRFG_Dx12::SetResource(Dx12Resource* inputResource)
                               ? FG_ResourceValidity::UntilPresent
                               : FG_ResourceValidity::ValidNow;
 
+    auto plan = (fResource->validity == FG_ResourceValidity::ValidNow) ? PlanCopy(fResource, fIndex) : FG_CopyPlan {};
+
+    // Game leaves it alone until FG uses it, no need for a copy
+    if (plan.mode == FG_CopyMode::Alias)
+    {
+        fResource->validity = FG_ResourceValidity::UntilPresent;
+        LOG_TRACE("Using input: {:X} without copy", (size_t) fResource->resource);
+    }
+
     // Copy ValidNow
     if (fResource->validity == FG_ResourceValidity::ValidNow)
     {
@@ -1404,7 +1425,7 @@ bool FSRFG_Dx12::SetResource(Dx12Resource* inputResource)
         if (_resourceCopy[fIndex].contains(type))
             copyOutput = _resourceCopy[fIndex].at(type);
 
-        if (!CopyResource(inputResource->cmdList, inputResource->resource, &copyOutput, inputResource->state))
+        if (!CopyResource(inputResource->cmdList, inputResource->resource, &copyOutput, inputResource->state, plan))
         {
             LOG_ERROR("{}, CopyResource error!", magic_enum::enum_name(type));
             return false;
@@ -1611,9 +1632,14 @@ bool FSRFG_Dx12::Present()
             auto closeResult = _uiCommandList[fIndex]->Close();
 
             if (closeResult == S_OK)
+            {
                 _gameCommandQueue->ExecuteCommandLists(1, (ID3D12CommandList**) &_uiCommandList[fIndex]);
+                DescriptorRing_Dx12::FrameDone(_gameCommandQueue, _uiCommandList[fIndex]);
+            }
             else
+            {
                 LOG_ERROR("_uiCommandList[{}]->Close() error: {:X}", fIndex, (UINT) closeResult);
+            }
 
             _uiCommandListResetted[fIndex] = false;
         }
@@ -1624,9 +1650,14 @@ bool FSRFG_Dx12::Present()
             auto closeResult = _scCommandList[fIndex]->Close();
 
             if (closeResult == S_OK)
+            {
                 _gameCommandQueue->ExecuteCommandLists(1, (ID3D12CommandList**) &_scCommandList[fIndex]);
+                DescriptorRing_Dx12::FrameDone(_gameCommandQueue, _scCommandList[fIndex]);
+            }
             else
+            {
                 LOG_ERROR("_scCommandList[{}]->Close() error: {:X}", fIndex, (UINT) closeResult);
+            }
 
             _scCommandListResetted[fIndex] = false;
         }
@@ -1642,5 +1673,10 @@ bool FSRFG_Dx12::Present()
 
     _fgFramePresentId++;
 
-    return Dispatch();
+    auto result = Dispatch();
+
+    // Inputs of this frame are used, close their write tracking window
+    FG_CopyPlanner::Consumed(ResTrack_Dx12::IsWriteTrackingActive());
+
+    return result;
 }
@@ -627,7 +627,7 @@ void XeFG_Dx12::CreateContext(ID3D12Device* device, FG_Constants& fgConstants)
     if (_fgContext == nullptr && _swapChainContext != nullptr)
     {
         _fgContext = _swapChainContext;
-        _lastDispatchedFrame = 0;
+        _pacing.DispatchReset();
     }
 
     if (_isActive)
@@ -656,7 +656,7 @@ void XeFG_Dx12::Activate()
         if (result == XEFG_SWAPCHAIN_RESULT_SUCCESS)
         {
             _isActive = true;
-            _lastDispatchedFrame = 0;
+            _pacing.DispatchReset();
         }
 
         LOG_INFO("SetEnabled: true, result: {} ({})", magic_enum::enum_name(result), (UINT) result);
@@ -676,9 +676,14 @@ void XeFG_Dx12::Deactivate()
             auto closeResult = _uiCommandList[fIndex]->Close();
 
             if (closeResult == S_OK)
+            {
                 _gameCommandQueue->ExecuteCommandLists(1, (ID3D12CommandList**) &_uiCommandList[fIndex]);
+                DescriptorRing_Dx12::FrameDone(_gameCommandQueue, _uiCommandList[fIndex]);
+            }
             else
+            {
                 LOG_ERROR("_uiCommandList[{}]->Close() error: {:X}", fIndex, (UINT) closeResult);
+            }
 
             _uiCommandListResetted[fIndex] = false;
         }
@@ -740,12 +745,9 @@ bool XeFG_Dx12::Dispatch()
     if (!IsActive() || IsPaused())
         return false;
 
-    LOG_DEBUG("_frameCount: {}, willDispatchFrame: {}, fIndex: {}", _frameCount, willDispatchFrame, fIndex);
+    LOG_DEBUG("_frameCount: {}, willDispatchFrame: {}, fIndex: {}", _pacing.FrameCount(), willDispatchFrame, fIndex);
 
-    if (!_resourceReady[fIndex].contains(FG_ResourceType::Depth) ||
-        !_resourceReady[fIndex].at(FG_ResourceType::Depth) ||
-        !_resourceReady[fIndex].contains(FG_ResourceType::Velocity) ||
-        !_resourceReady[fIndex].at(FG_ResourceType::Velocity))
+    if (!InputsReady(fIndex))
     {
         LOG_WARN("Depth or Velocity is not ready, skipping");
         return false;
@@ -1258,9 +1260,14 @@ bool XeFG_Dx12::Present()
             auto closeResult = _uiCommandList[fIndex]->Close();
 
             if (closeResult == S_OK)
+            {
                 _gameCommandQueue->ExecuteCommandLists(1, (ID3D12CommandList**) &_uiCommandList[fIndex]);
+                DescriptorRing_Dx12::FrameDone(_gameCommandQueue, _uiCommandList[fIndex]);
+            }
             else
+            {
                 LOG_ERROR("_uiCommandList[{}]->Close() error: {:X}", fIndex, (UINT) closeResult);
+            }
 
             _uiCommandListResetted[fIndex] = false;
         }
@@ -1271,9 +1278,14 @@ bool XeFG_Dx12::Present()
             auto closeResult = _scCommandList[fIndex]->Close();
 
             if (closeResult == S_OK)
+            {
                 _gameCommandQueue->ExecuteCommandLists(1, (ID3D12CommandList**) &_scCommandList[fIndex]);
+                DescriptorRing_Dx12::FrameDone(_gameCommandQueue, _scCommandList[fIndex]);
+            }
             else
+            {
                 LOG_ERROR("_scCommandList[{}]->Close() error: {:X}", fIndex, (UINT) closeResult);
+            }
 
             _scCommandListResetted[fIndex] = false;
         }
@@ -1508,7 +1520,7 @@ bool XeFG_Dx12::SetResource(Dx12Resource* inputResource)
         // We will us UI color later with Render UI
         if (type != FG_ResourceType::UIColor)
         {
-            auto frameId = static_cast<uint32_t>(_frameCount - indexDiff);
+            auto frameId = static_cast<uint32_t>(_pacing.FrameCount() - indexDiff);
             auto result =
                 XeFGProxy::D3D12TagFrameResource()(_swapChainContext, fResource->cmdList, frameId, &resourceParam);
             LOG_DEBUG("D3D12TagFrameResource, frameId: {}, type: {} result: {} ({})", frameId,
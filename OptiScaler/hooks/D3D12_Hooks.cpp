@@ -1023,6 +1023,9 @@ static void HookToDevice(ID3D12Device* InDevice)
 
     HookToCommandList(InDevice);
 
+    // Descriptor ring closes ranges of game's command lists from the queue executing them
+    ResTrack_Dx12::HookToQueue(InDevice);
+
     if (State::Instance().activeFgInput == FGInput::Upscaler)
         ResTrack_Dx12::HookDevice(InDevice);
 }
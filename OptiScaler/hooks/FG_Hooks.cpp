@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "FG_Hooks.h"
+#include "FG_ResizeState.h"
 #include <Config.h>
 
 #include <framegen/ffx/FSRFG_Dx12.h>
@@ -12,6 +13,7 @@
 #include <resource_tracking/ResTrack_Dx12.h>
 
 #include <misc/FrameLimit.h>
+#include <misc/PresentScheduler.h>
 #include <upscaler_time/UpscalerTime_Dx12.h>
 
 #include <detours/detours.h>
@@ -19,11 +21,90 @@
 #include <d3d12.h>
 
 inline static ID3D12Fence* resizeFence = nullptr;
-inline static UINT64 resizeFenceValue = 0;
 inline static HANDLE resizeFenceEvent = nullptr;
 inline static bool readyToRelease = false;
 inline static IUnknown* oldSwapChain = nullptr;
 
+// Blocks until GPU passes fenceValue, max 5 sec
+static void WaitForFenceValue(UINT64 fenceValue)
+{
+    if (resizeFence->GetCompletedValue() >= fenceValue)
+        return;
+
+    resizeFence->SetEventOnCompletion(fenceValue, resizeFenceEvent);
+    auto waitResult = WaitForSingleObject(resizeFenceEvent, 5000);
+    LOG_DEBUG("WaitForSingleObject result: {:X}", waitResult);
+}
+
+// Blocking wait, only used when FG swapchain itself is released or recreated
+static void WaitForResizeFence()
+{
+    if (State::Instance().currentCommandQueue == nullptr || resizeFence == nullptr || resizeFenceEvent == nullptr)
+        return;
+
+    LOG_DEBUG("Waiting for GPU to finish before releasing swapchain");
+
+    auto fenceValue = FGResizeState::NextSignalValue();
+    State::Instance().currentCommandQueue->Signal(resizeFence, fenceValue);
+    WaitForFenceValue(fenceValue);
+
+    FGResizeState::Update(resizeFence->GetCompletedValue(), Util::MillisecondsNow());
+}
+
+// Signals the resize value and waits for it, real ResizeBuffers must not run while FG work still uses the buffers.
+// FG resources are recreated at a later present.
+static void BeginResize()
+{
+    if (State::Instance().currentCommandQueue == nullptr || resizeFence == nullptr || resizeFenceEvent == nullptr)
+        return;
+
+    auto fenceValue = FGResizeState::BeginResize(Util::MillisecondsNow());
+    State::Instance().currentCommandQueue->Signal(resizeFence, fenceValue);
+    WaitForFenceValue(fenceValue);
+
+    // Retiring -> Recreate, stays Retiring until the timeout when the wait gave up
+    FGResizeState::Update(resizeFence->GetCompletedValue(), Util::MillisecondsNow());
+}
+
+static void ResizeDone()
+{
+    auto fg = State::Instance().currentFG;
+
+    if (fg == nullptr)
+        return;
+
+    fg->Deactivate();
+    fg->UpdateTarget();
+
+    // Without a fence there is nothing to wait for, recreate at next frame like before
+    if (FGResizeState::Phase() == FGResizePhase::Idle)
+        State::Instance().FGchanged = true;
+}
+
+static void UpdateResizeState()
+{
+    if (resizeFence == nullptr)
+        return;
+
+    auto queue = State::Instance().currentCommandQueue;
+
+    if (queue != nullptr && FGResizeState::NeedsSignal())
+        queue->Signal(resizeFence, FGResizeState::NextSignalValue());
+
+    auto fg = State::Instance().currentFG;
+
+    // Keep FG paused until old resources are out of flight
+    if (fg != nullptr && FGResizeState::Phase() == FGResizePhase::Retiring)
+        fg->UpdateTarget();
+
+    if (FGResizeState::Update(resizeFence->GetCompletedValue(), Util::MillisecondsNow()) && fg != nullptr)
+    {
+        LOG_DEBUG("Recreating FG resources after resize");
+        State::Instance().FGchanged = true;
+        fg->UpdateTarget();
+    }
+}
+
 static bool CheckForFGStatus()
 {
     // Need to check overlay menu parameter, goes to places it shouldn't go
@@ -124,22 +205,7 @@ HRESULT FGHooks::CreateSwapChain(IDXGIFactory* pFactory, IUnknown* pDevice, DXGI
         {
             LOG_DEBUG("Ready to release: {}", readyToRelease);
 
-            if (State::Instance().currentCommandQueue != nullptr && resizeFence != nullptr &&
-                resizeFenceEvent != nullptr)
-            {
-                LOG_DEBUG("Waiting for GPU to finish before resizing buffers");
-
-                resizeFenceValue++;
-                State::Instance().currentCommandQueue->Signal(resizeFence, resizeFenceValue);
-
-                if (resizeFence->GetCompletedValue() < resizeFenceValue)
-                {
-                    resizeFence->SetEventOnCompletion(resizeFenceValue, resizeFenceEvent);
-                    // Max 5 sec
-                    auto waitResult = WaitForSingleObject(resizeFenceEvent, 5000);
-                    LOG_DEBUG("WaitForSingleObject result: {:X}", waitResult);
-                }
-            }
+            WaitForResizeFence();
 
             oldSwapChain = State::Instance().currentFGSwapchain;
         }
@@ -156,8 +222,15 @@ HRESULT FGHooks::CreateSwapChain(IDXGIFactory* pFactory, IUnknown* pDevice, DXGI
 
         if (State::Instance().currentD3D12Device != nullptr)
         {
+            UINT64 completedValue = 0;
+
             if (resizeFence != nullptr)
             {
+                // Retired objects wait for this fence, let GPU pass them before it's replaced
+                if (FGResizeState::RetiredCount() > 0)
+                    WaitForResizeFence();
+
+                completedValue = resizeFence->GetCompletedValue();
                 resizeFence->Release();
                 resizeFence = nullptr;
             }
@@ -170,6 +243,9 @@ HRESULT FGHooks::CreateSwapChain(IDXGIFactory* pFactory, IUnknown* pDevice, DXGI
 
             State::Instance().currentD3D12Device->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&resizeFence));
             resizeFenceEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+
+            // New fence starts from 0, objects old one didn't pass yet are moved to it
+            FGResizeState::Reset(resizeFence != nullptr, completedValue);
         }
 
         _hwnd = pDesc->OutputWindow;
@@ -248,22 +324,7 @@ HRESULT FGHooks::CreateSwapChainForHwnd(IDXGIFactory* pFactory, IUnknown* pDevic
         // without releasing old one, be sure gpu is in idle state
         if (readyToRelease && State::Instance().currentFGSwapchain != nullptr)
         {
-            if (State::Instance().currentCommandQueue != nullptr && resizeFence != nullptr &&
-                resizeFenceEvent != nullptr)
-            {
-                LOG_DEBUG("Waiting for GPU to finish before resizing buffers");
-
-                resizeFenceValue++;
-                State::Instance().currentCommandQueue->Signal(resizeFence, resizeFenceValue);
-
-                if (resizeFence->GetCompletedValue() < resizeFenceValue)
-                {
-                    resizeFence->SetEventOnCompletion(resizeFenceValue, resizeFenceEvent);
-                    // Max 5 sec
-                    auto waitResult = WaitForSingleObject(resizeFenceEvent, 5000);
-                    LOG_DEBUG("WaitForSingleObject result: {:X}", waitResult);
-                }
-            }
+            WaitForResizeFence();
 
             oldSwapChain = State::Instance().currentFGSwapchain;
         }
@@ -280,8 +341,15 @@ HRESULT FGHooks::CreateSwapChainForHwnd(IDXGIFactory* pFactory, IUnknown* pDevic
 
         if (State::Instance().currentD3D12Device != nullptr)
         {
+            UINT64 completedValue = 0;
+
             if (resizeFence != nullptr)
             {
+                // Retired objects wait for this fence, let GPU pass them before it's replaced
+                if (FGResizeState::RetiredCount() > 0)
+                    WaitForResizeFence();
+
+                completedValue = resizeFence->GetCompletedValue();
                 resizeFence->Release();
                 resizeFence = nullptr;
             }
@@ -294,6 +362,9 @@ HRESULT FGHooks::CreateSwapChainForHwnd(IDXGIFactory* pFactory, IUnknown* pDevic
 
             State::Instance().currentD3D12Device->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&resizeFence));
             resizeFenceEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+
+            // New fence starts from 0, objects old one didn't pass yet are moved to it
+            FGResizeState::Reset(resizeFence != nullptr, completedValue);
         }
 
         _hwnd = hWnd;
@@ -507,21 +578,8 @@ HRESULT FGHooks::hkResizeBuffers(IDXGISwapChain* This, UINT BufferCount, UINT Wi
         return o_FGSCResizeBuffers(This, BufferCount, Width, Height, NewFormat, SwapChainFlags);
     }
 
-    if (State::Instance().currentCommandQueue != nullptr && resizeFence != nullptr && resizeFenceEvent != nullptr)
-    {
-        LOG_DEBUG("Waiting for GPU to finish before resizing buffers");
-
-        resizeFenceValue++;
-        State::Instance().currentCommandQueue->Signal(resizeFence, resizeFenceValue);
-
-        if (resizeFence->GetCompletedValue() < resizeFenceValue)
-        {
-            resizeFence->SetEventOnCompletion(resizeFenceValue, resizeFenceEvent);
-            // Max 5 sec
-            auto waitResult = WaitForSingleObject(resizeFenceEvent, 5000);
-            LOG_DEBUG("WaitForSingleObject result: {:X}", waitResult);
-        }
-    }
+    // Wait for GPU before the real resize, FG resources are recreated at a later present
+    BeginResize();
 
     if (State::Instance().activeFgOutput == FGOutput::XeFG)
     {
@@ -642,15 +700,7 @@ HRESULT FGHooks::hkResizeBuffers(IDXGISwapChain* This, UINT BufferCount, UINT Wi
     LOG_DEBUG("Result: {:X}, Caller: {}", (UINT) result, Util::WhoIsTheCaller(_ReturnAddress()));
 
     if (result == S_OK)
-    {
-        auto fg = State::Instance().currentFG;
-        if (fg != nullptr)
-        {
-            State::Instance().FGchanged = true;
-            fg->Deactivate();
-            fg->UpdateTarget();
-        }
-    }
+        ResizeDone();
 
     // Resize window to cover the screen
     if (result == S_OK && Config::Instance()->FGXeFGForceBorderless.value_or_default() &&
@@ -714,21 +764,8 @@ HRESULT FGHooks::hkResizeBuffers1(IDXGISwapChain* This, UINT BufferCount, UINT W
                                     ppPresentQueue);
     }
 
-    if (State::Instance().currentCommandQueue != nullptr && resizeFence != nullptr && resizeFenceEvent != nullptr)
-    {
-        LOG_DEBUG("Waiting for GPU to finish before resizing buffers");
-
-        resizeFenceValue++;
-        State::Instance().currentCommandQueue->Signal(resizeFence, resizeFenceValue);
-
-        if (resizeFence->GetCompletedValue() < resizeFenceValue)
-        {
-            resizeFence->SetEventOnCompletion(resizeFenceValue, resizeFenceEvent);
-            // Max 5 sec
-            auto waitResult = WaitForSingleObject(resizeFenceEvent, 5000);
-            LOG_DEBUG("WaitForSingleObject result: {:X}", waitResult);
-        }
-    }
+    // Wait for GPU before the real resize, FG resources are recreated at a later present
+    BeginResize();
 
     if (State::Instance().activeFgOutput == FGOutput::XeFG)
     {
@@ -848,15 +885,7 @@ HRESULT FGHooks::hkResizeBuffers1(IDXGISwapChain* This, UINT BufferCount, UINT W
     LOG_DEBUG("Result: {:X}, Caller: {}", (UINT) result, Util::WhoIsTheCaller(_ReturnAddress()));
 
     if (result == S_OK)
-    {
-        auto fg = State::Instance().currentFG;
-        if (fg != nullptr)
-        {
-            State::Instance().FGchanged = true;
-            fg->Deactivate();
-            fg->UpdateTarget();
-        }
-    }
+        ResizeDone();
 
     // Resize window to cover the screen
     if (result == S_OK && Config::Instance()->FGXeFGForceBorderless.value_or_default() &&
@@ -961,6 +990,8 @@ HRESULT FGHooks::FGPresent(void* This, UINT SyncInterval, UINT Flags, const DXGI
 
     if (willPresent)
     {
+        PresentScheduler::BeginPresent();
+
         State::Instance().FGLastFrame++;
 
         double ftDelta = 0.0f;
@@ -977,9 +1008,13 @@ HRESULT FGHooks::FGPresent(void* This, UINT SyncInterval, UINT Flags, const DXGI
 
     if (willPresent && State::Instance().currentCommandQueue != nullptr)
     {
+        ScopedPresentStep step(PresentStep::UpscalerTime);
         UpscalerTimeDx12::ReadUpscalingTime(State::Instance().currentCommandQueue);
     }
 
+    if (willPresent)
+        UpdateResizeState();
+
     auto fg = State::Instance().currentFG;
     bool mutexUsed = false;
     if (willPresent && fg != nullptr && fg->IsActive() &&
@@ -1043,7 +1078,10 @@ HRESULT FGHooks::FGPresent(void* This, UINT SyncInterval, UINT Flags, const DXGI
 
     // Used at wrapped_swapchain LocalPresent to determine is frame is interpolated or not
     if (willPresent)
+    {
         State::Instance().FGPresentIsCalled = true;
+        PresentScheduler::EndPresent();
+    }
 
     HRESULT result;
     if (pPresentParameters == nullptr)
@@ -1056,7 +1094,10 @@ HRESULT FGHooks::FGPresent(void* This, UINT SyncInterval, UINT Flags, const DXGI
 
     if (willPresent && !State::Instance().reflexLimitsFps && State::Instance().activeFgOutput != FGOutput::NoFG &&
         !State::Instance().isRunningOnDXVK)
+    {
+        ScopedPresentStep step(PresentStep::FrameLimit);
         FrameLimit::sleep(fg != nullptr ? fg->IsActive() : false);
+    }
 
     if (mutexUsed && fg != nullptr)
     {
@@ -1089,22 +1130,7 @@ HRESULT FGHooks::hkFGRelease(IDXGISwapChain* This)
         {
             LOG_DEBUG("");
 
-            if (State::Instance().currentCommandQueue != nullptr && resizeFence != nullptr &&
-                resizeFenceEvent != nullptr)
-            {
-                LOG_DEBUG("Waiting for GPU to finish before resizing buffers");
-
-                resizeFenceValue++;
-                State::Instance().currentCommandQueue->Signal(resizeFence, resizeFenceValue);
-
-                if (resizeFence->GetCompletedValue() < resizeFenceValue)
-                {
-                    resizeFence->SetEventOnCompletion(resizeFenceValue, resizeFenceEvent);
-                    // Max 5 sec
-                    auto waitResult = WaitForSingleObject(resizeFenceEvent, 5000);
-                    LOG_DEBUG("WaitForSingleObject result: {:X}", waitResult);
-                }
-            }
+            WaitForResizeFence();
 
             // To prevent deadlock when FG release the swapchain
             skipReleaseChecks = true;
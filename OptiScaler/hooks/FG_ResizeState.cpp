@@ -0,0 +1,122 @@
+#include "pch.h"
+#include "FG_ResizeState.h"
+
+#include <magic_enum.hpp>
+
+void FGResizeState::ReleaseCompleted(UINT64 completedValue)
+{
+    // Values are queued in increasing order
+    while (!_retired.empty() && _retired.front().fenceValue <= completedValue)
+    {
+        _retired.front().object->Release();
+        _retired.pop_front();
+    }
+}
+
+void FGResizeState::Reset(bool fenceReady, UINT64 completedValue)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    ReleaseCompleted(completedValue);
+
+    // Their work is queued before anything signaled on the new fence
+    if (!_retired.empty())
+    {
+        LOG_WARN("{} retired objects still in flight, moving them to new fence", _retired.size());
+
+        for (auto& retired : _retired)
+            retired.fenceValue = 1;
+    }
+
+    _phase = FGResizePhase::Idle;
+    _fenceReady = fenceReady;
+    _lastSignaled = 0;
+    _resizeFenceValue = 0;
+}
+
+void FGResizeState::Retire(IUnknown* object)
+{
+    if (object == nullptr)
+        return;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (!_fenceReady)
+    {
+        object->Release();
+        return;
+    }
+
+    _retired.push_back({ object, _lastSignaled + 1 });
+}
+
+UINT64 FGResizeState::NextSignalValue()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return ++_lastSignaled;
+}
+
+bool FGResizeState::NeedsSignal()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return !_retired.empty() && _retired.back().fenceValue > _lastSignaled;
+}
+
+UINT64 FGResizeState::BeginResize(double now)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _resizeFenceValue = ++_lastSignaled;
+    _resizeStartTime = now;
+
+    LOG_DEBUG("{} -> Retiring, fence value: {}", magic_enum::enum_name(_phase), _resizeFenceValue);
+    _phase = FGResizePhase::Retiring;
+
+    return _resizeFenceValue;
+}
+
+bool FGResizeState::Update(UINT64 completedValue, double now)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    ReleaseCompleted(completedValue);
+
+    switch (_phase)
+    {
+    case FGResizePhase::Retiring:
+        if (completedValue >= _resizeFenceValue)
+        {
+            LOG_DEBUG("Retiring -> Recreate, fence value: {}, took: {:.2f} ms", completedValue,
+                      now - _resizeStartTime);
+            _phase = FGResizePhase::Recreate;
+        }
+        else if (now - _resizeStartTime > _timeoutMs)
+        {
+            // Same limit as old blocking wait, retired objects stay queued until fence really passes
+            LOG_WARN("Resize fence timeout, completed: {}, expected: {}", completedValue, _resizeFenceValue);
+            _phase = FGResizePhase::Recreate;
+        }
+
+        return false;
+
+    case FGResizePhase::Recreate:
+        LOG_DEBUG("Recreate -> Idle");
+        _phase = FGResizePhase::Idle;
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+FGResizePhase FGResizeState::Phase()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _phase;
+}
+
+size_t FGResizeState::RetiredCount()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _retired.size();
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include "SysUtils.h"
+
+#include <deque>
+#include <mutex>
+
+// Swapchain resize handling for FG hooks
+//
+// Idle     -> Retiring : ResizeBuffers called, fence signaled with the returned value and waited
+//                        before the real ResizeBuffers
+// Retiring -> Recreate : Fence reached resize value (or timeout passed)
+// Recreate -> Idle     : Next present, FG resources are recreated lazily
+//
+// Resources replaced while FG is running are not released immediately, they are queued with
+// the fence value which will be signaled at next present and released once GPU passes it.
+// Fence value and time are passed in by the caller, no D3D12 calls are made here.
+
+enum class FGResizePhase : uint8_t
+{
+    Idle,
+    Retiring,
+    Recreate,
+};
+
+class FGResizeState
+{
+  private:
+    struct RetiredObject
+    {
+        IUnknown* object = nullptr;
+        UINT64 fenceValue = 0;
+    };
+
+    inline static std::mutex _mutex;
+    inline static std::deque<RetiredObject> _retired;
+
+    inline static FGResizePhase _phase = FGResizePhase::Idle;
+    inline static bool _fenceReady = false;
+
+    // Last value signaled on the resize fence
+    inline static UINT64 _lastSignaled = 0;
+    inline static UINT64 _resizeFenceValue = 0;
+    inline static double _resizeStartTime = 0.0;
+    inline static double _timeoutMs = 5000.0;
+
+    static void ReleaseCompleted(UINT64 completedValue);
+
+  public:
+    // Fence is (re)created and counters start from 0. Objects old fence passed (completedValue) are released,
+    // others wait for the first value signaled on the new fence.
+    static void Reset(bool fenceReady, UINT64 completedValue);
+
+    // Queues object for release after GPU passes the next signaled value,
+    // releases immediately when there is no fence to track it
+    static void Retire(IUnknown* object);
+
+    // Returns new fence value, caller must signal it on the queue
+    static UINT64 NextSignalValue();
+
+    // Retired objects are waiting for a signal which is not queued yet
+    static bool NeedsSignal();
+
+    // Returns fence value to signal for the resize
+    static UINT64 BeginResize(double now);
+
+    // Called at present with fence completed value, releases finished objects and
+    // returns true once when FG resources should be recreated
+    static bool Update(UINT64 completedValue, double now);
+
+    static FGResizePhase Phase();
+    static size_t RetiredCount();
+    static void SetTimeout(double timeoutMs) { _timeoutMs = timeoutMs; }
+};
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <string_view>
+
+// Name -> resolver tables of proc address hooks
+//
+// Tables are sorted at compile time, lookup is a binary search on string_view without any allocation.
+// Resolve is whatever the hook table stores per name, usually a function pointer.
+
+template <class Resolve> struct ProcTableEntry
+{
+    std::string_view name;
+    Resolve resolve = nullptr;
+};
+
+template <class Resolve, size_t N>
+consteval std::array<ProcTableEntry<Resolve>, N> SortProcTable(std::array<ProcTableEntry<Resolve>, N> entries)
+{
+    std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) { return a.name < b.name; });
+    return entries;
+}
+
+template <class Resolve, size_t N>
+consteval bool ProcTableIsUnique(const std::array<ProcTableEntry<Resolve>, N>& entries)
+{
+    for (size_t i = 1; i < N; i++)
+    {
+        if (entries[i - 1].name == entries[i].name)
+            return false;
+    }
+
+    return true;
+}
+
+// Entry of name in a sorted table, nullptr if the name isn't hooked
+template <class Resolve, size_t N>
+constexpr const ProcTableEntry<Resolve>* FindProc(const std::array<ProcTableEntry<Resolve>, N>& entries,
+                                                  std::string_view name)
+{
+    auto it = std::lower_bound(entries.begin(), entries.end(), name,
+                               [](const auto& entry, std::string_view value) { return entry.name < value; });
+
+    if (it == entries.end() || it->name != name)
+        return nullptr;
+
+    return &*it;
+}
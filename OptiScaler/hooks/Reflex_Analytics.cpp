@@ -0,0 +1,197 @@
+#include "pch.h"
+#include "Reflex_Analytics.h"
+
+// Same values as NV_LATENCY_MARKER_TYPE
+static constexpr uint32_t MarkerSimulationStart = 0;
+static constexpr uint32_t MarkerPresentStart = 4;
+static constexpr uint32_t MarkerPresentEnd = 5;
+static constexpr uint32_t MarkerOutOfBandPresentStart = 11;
+
+std::array<ReflexAnalytics::RollingStat, static_cast<size_t>(LatencyStage::Count)> ReflexAnalytics::_stages {};
+ReflexAnalytics::RollingStat ReflexAnalytics::_presentInterval {};
+ReflexAnalytics::RollingStat ReflexAnalytics::_markerLatency {};
+std::array<ReflexAnalytics::SimStart, ReflexAnalytics::_simHistorySize> ReflexAnalytics::_simStarts {};
+
+void ReflexAnalytics::RollingStat::Add(double value)
+{
+    if (count == samples.size())
+        sum -= samples[next];
+    else
+        count++;
+
+    samples[next] = value;
+    sum += value;
+    next = (next + 1) % samples.size();
+}
+
+void ReflexAnalytics::RollingStat::Reset()
+{
+    count = 0;
+    next = 0;
+    sum = 0.0;
+}
+
+std::optional<double> ReflexAnalytics::RollingStat::Mean() const
+{
+    if (count < _minSamples)
+        return std::nullopt;
+
+    return sum / static_cast<double>(count);
+}
+
+void ReflexAnalytics::RecordMarker(uint64_t frameId, uint32_t markerType, double now)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    switch (markerType)
+    {
+    case MarkerSimulationStart:
+        _simStarts[frameId % _simHistorySize] = { frameId, now };
+        break;
+
+    case MarkerPresentStart:
+        // Frame id restarted (new level, game restart etc.)
+        if (frameId < _lastPresentFrameId)
+        {
+            LOG_DEBUG("Present frame id restarted: {} -> {}", _lastPresentFrameId, frameId);
+            _presentInterval.Reset();
+            _lastPresentTime = 0.0;
+        }
+        else if (frameId == _lastPresentFrameId)
+        {
+            // Duplicate marker, keep first
+            break;
+        }
+
+        if (_lastPresentTime > 0.0 && now - _lastPresentTime < _maxIntervalMs)
+            _presentInterval.Add((now - _lastPresentTime) / static_cast<double>(frameId - _lastPresentFrameId));
+
+        _lastPresentFrameId = frameId;
+        _lastPresentTime = now;
+        break;
+
+    case MarkerPresentEnd:
+        if (auto& sim = _simStarts[frameId % _simHistorySize]; sim.frameId == frameId && sim.time > 0.0)
+        {
+            if (now - sim.time < _maxIntervalMs)
+                _markerLatency.Add(now - sim.time);
+
+            sim.time = 0.0;
+        }
+
+        break;
+
+    default:
+        break;
+    }
+}
+
+size_t ReflexAnalytics::RecordAsyncMarker(uint64_t frameId, uint32_t markerType)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (markerType != MarkerOutOfBandPresentStart)
+        return 0;
+
+    _asyncPresentIds[_asyncPresentCount % REFLEX_ASYNC_HISTORY_SIZE] = frameId;
+    _asyncPresentCount++;
+
+    // Walk in insertion order so repeats across the wrap are counted too
+    auto filled = (std::min)(_asyncPresentCount, REFLEX_ASYNC_HISTORY_SIZE);
+    auto oldest = _asyncPresentCount - filled;
+    size_t repeatCount = 0;
+
+    for (size_t i = 1; i < filled; i++)
+    {
+        if (_asyncPresentIds[(oldest + i) % REFLEX_ASYNC_HISTORY_SIZE] ==
+            _asyncPresentIds[(oldest + i - 1) % REFLEX_ASYNC_HISTORY_SIZE])
+        {
+            repeatCount++;
+        }
+    }
+
+    return repeatCount;
+}
+
+size_t ReflexAnalytics::IngestReports(const LatencyFrameReport* reports, size_t count)
+{
+    if (reports == nullptr || count == 0)
+        return 0;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    // Newest report is older than what we have, frame ids restarted
+    if (reports[count - 1].frameId != 0 && reports[count - 1].frameId < _lastReportFrameId)
+    {
+        LOG_DEBUG("Report frame id restarted: {} -> {}", _lastReportFrameId, reports[count - 1].frameId);
+        _lastReportFrameId = 0;
+    }
+
+    size_t added = 0;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        auto& report = reports[i];
+
+        if (report.frameId == 0 || report.frameId <= _lastReportFrameId)
+            continue;
+
+        for (size_t s = 0; s < REFLEX_REPORT_STAGE_COUNT; s++)
+        {
+            auto& stage = report.stages[s];
+
+            // Missing stages are reported as 0
+            if (stage.start != 0 && stage.end >= stage.start)
+                _stages[s].Add(static_cast<double>(stage.end - stage.start));
+        }
+
+        auto simStart = report.stages[static_cast<size_t>(LatencyStage::Simulation)].start;
+        auto gpuEnd = report.stages[static_cast<size_t>(LatencyStage::GpuRender)].end;
+
+        if (simStart != 0 && gpuEnd >= simStart)
+            _stages[static_cast<size_t>(LatencyStage::Total)].Add(static_cast<double>(gpuEnd - simStart));
+
+        _lastReportFrameId = report.frameId;
+        added++;
+    }
+
+    return added;
+}
+
+std::optional<double> ReflexAnalytics::StageMeanUs(LatencyStage stage)
+{
+    if (stage >= LatencyStage::Count)
+        return std::nullopt;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _stages[static_cast<size_t>(stage)].Mean();
+}
+
+std::optional<double> ReflexAnalytics::PresentIntervalMs()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _presentInterval.Mean();
+}
+
+std::optional<double> ReflexAnalytics::MarkerLatencyMs()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _markerLatency.Mean();
+}
+
+void ReflexAnalytics::Reset()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    for (auto& stage : _stages)
+        stage.Reset();
+
+    _presentInterval.Reset();
+    _markerLatency.Reset();
+    _lastReportFrameId = 0;
+    _lastPresentFrameId = 0;
+    _lastPresentTime = 0.0;
+    _simStarts = {};
+    _asyncPresentIds = {};
+    _asyncPresentCount = 0;
+}
@@ -0,0 +1,106 @@
+#pragma once
+#include "SysUtils.h"
+
+#include <array>
+#include <mutex>
+#include <optional>
+
+// Rolling latency model built from Reflex markers and latency reports
+//
+// Latency reports (all 64 frames of NvAPI_D3D_GetLatency) are converted by the caller and only
+// frames newer than the last ingested one are added, so polling more often than every 64 frames
+// doesn't lose or double count any frame. Report stage durations are in microseconds.
+// SetLatencyMarker / SetAsyncFrameMarker calls are timestamped by the caller in milliseconds,
+// present interval and marker latency are measured from those.
+// Times are passed in by the caller, no NvAPI calls are made here.
+
+enum class LatencyStage : uint8_t
+{
+    Simulation,
+    RenderSubmit,
+    Present,
+    Driver,
+    OsRenderQueue,
+    GpuRender,
+
+    // Simulation start -> GPU render end, not part of the reports
+    Total,
+
+    Count
+};
+
+inline constexpr size_t REFLEX_REPORT_STAGE_COUNT = static_cast<size_t>(LatencyStage::Total);
+inline constexpr size_t REFLEX_ASYNC_HISTORY_SIZE = 12;
+
+struct LatencyStageTimes
+{
+    uint64_t start = 0;
+    uint64_t end = 0;
+};
+
+struct LatencyFrameReport
+{
+    uint64_t frameId = 0;
+    std::array<LatencyStageTimes, REFLEX_REPORT_STAGE_COUNT> stages {};
+};
+
+class ReflexAnalytics
+{
+  private:
+    static constexpr size_t _windowSize = 64;
+    static constexpr size_t _minSamples = 8;
+    static constexpr size_t _simHistorySize = 8;
+
+    // Longer gaps are pauses / loading screens, not frames
+    static constexpr double _maxIntervalMs = 1000.0;
+
+    struct RollingStat
+    {
+        std::array<double, _windowSize> samples {};
+        size_t count = 0;
+        size_t next = 0;
+        double sum = 0.0;
+
+        void Add(double value);
+        void Reset();
+        std::optional<double> Mean() const;
+    };
+
+    struct SimStart
+    {
+        uint64_t frameId = 0;
+        double time = 0.0;
+    };
+
+    inline static std::mutex _mutex;
+
+    static std::array<RollingStat, static_cast<size_t>(LatencyStage::Count)> _stages;
+    inline static uint64_t _lastReportFrameId = 0;
+
+    static RollingStat _presentInterval;
+    static RollingStat _markerLatency;
+    inline static uint64_t _lastPresentFrameId = 0;
+    inline static double _lastPresentTime = 0.0;
+    static std::array<SimStart, _simHistorySize> _simStarts;
+
+    // Out of band present frame ids, circular
+    inline static std::array<uint64_t, REFLEX_ASYNC_HISTORY_SIZE> _asyncPresentIds {};
+    inline static size_t _asyncPresentCount = 0;
+
+  public:
+    // Marker type values are same for NV_LATENCY_MARKER_TYPE and NV_VULKAN_LATENCY_MARKER_TYPE
+    static void RecordMarker(uint64_t frameId, uint32_t markerType, double now);
+
+    // Returns number of repeated frame ids in out of band present history, DLSS-G presents
+    // generated and real frames with the same id
+    static size_t RecordAsyncMarker(uint64_t frameId, uint32_t markerType);
+
+    // Reports are ordered oldest to newest, returns number of newly added frames
+    static size_t IngestReports(const LatencyFrameReport* reports, size_t count);
+
+    static std::optional<double> StageMeanUs(LatencyStage stage);
+    static std::optional<double> PresentIntervalMs();
+    static std::optional<double> MarkerLatencyMs();
+
+    static void Reset();
+};
@@ -1,7 +1,10 @@
 #include "pch.h"
 #include "Reflex_Hooks.h"
+#include "Reflex_Analytics.h"
 #include <Config.h>
 
+#include <misc/PresentScheduler.h>
+
 #include <nvapi/fakenvapi.h>
 
 #include <magic_enum.hpp>
@@ -63,6 +66,9 @@ NvAPI_Status ReflexHooks::hkNvAPI_D3D_SetLatencyMarker(IUnknown* pDev,
 #endif
     _updatesWithoutMarker = 0;
 
+    ReflexAnalytics::RecordMarker(pSetLatencyMarkerParams->frameID, pSetLatencyMarkerParams->markerType,
+                                  Util::MillisecondsNow());
+
     // LOG_DEBUG("frameID: {}, markerType: {}", pSetLatencyMarkerParams->frameID,
     //           magic_enum::enum_name(pSetLatencyMarkerParams->markerType));
 
@@ -142,23 +148,10 @@ NvAPI_Status ReflexHooks::hkNvAPI_D3D12_SetAsyncFrameMarker(ID3D12CommandQueue*
 
     if (pSetAsyncFrameMarkerParams->markerType == OUT_OF_BAND_PRESENT_START)
     {
-        constexpr size_t history_size = 12;
-        static size_t counter = 0;
-        static NvU64 previous_frame_ids[history_size] = {};
-
-        previous_frame_ids[counter % history_size] = pSetAsyncFrameMarkerParams->frameID;
-        counter++;
+        constexpr size_t history_size = REFLEX_ASYNC_HISTORY_SIZE;
 
-        size_t repeat_count = 0;
-
-        for (size_t i = 1; i < history_size; i++)
-        {
-            // won't catch repeat frame ids across array wrap around
-            if (previous_frame_ids[i] == previous_frame_ids[i - 1])
-            {
-                repeat_count++;
-            }
-        }
+        auto repeat_count = ReflexAnalytics::RecordAsyncMarker(pSetAsyncFrameMarkerParams->frameID,
+                                                               pSetAsyncFrameMarkerParams->markerType);
 
         if (_dlssgDetected && repeat_count == 0)
         {
@@ -187,6 +180,9 @@ NvAPI_Status ReflexHooks::hkNvAPI_Vulkan_SetLatencyMarker(HANDLE vkDevice,
 
     _updatesWithoutMarker = 0;
 
+    ReflexAnalytics::RecordMarker(pSetLatencyMarkerParams->frameID, pSetLatencyMarkerParams->markerType,
+                                  Util::MillisecondsNow());
+
     return o_NvAPI_Vulkan_SetLatencyMarker(vkDevice, pSetLatencyMarkerParams);
 }
 
@@ -282,7 +278,7 @@ void* ReflexHooks::getHookedReflex(unsigned int InterfaceId)
         timingData[TimingType::type].reset();                                                                          \
     }
 
-bool ReflexHooks::updateTimingData()
+bool ReflexHooks::getLatencyReport(NV_LATENCY_RESULT_PARAMS* results)
 {
     bool canCall = ((State::Instance().activeFgOutput == FGOutput::XeFG && fakenvapi::ForNvidia_GetLatency) ||
                     o_NvAPI_D3D_GetLatency);
@@ -290,10 +286,41 @@ bool ReflexHooks::updateTimingData()
     if (!canCall || !_lastSleepDev)
         return false;
 
+    results->version = NV_LATENCY_RESULT_PARAMS_VER;
+
+    if (auto result = hkNvAPI_D3D_GetLatency(_lastSleepDev, results); result != NVAPI_OK)
+        return false;
+
+    // Feed all 64 frames to latency model, already ingested frames are skipped there
+    std::array<LatencyFrameReport, std::size(results->frameReport)> reports {};
+
+    for (size_t i = 0; i < reports.size(); i++)
+    {
+        auto& frameReport = results->frameReport[i];
+        auto& report = reports[i];
+
+        report.frameId = frameReport.frameID;
+        report.stages[(size_t) LatencyStage::Simulation] = { frameReport.simStartTime, frameReport.simEndTime };
+        report.stages[(size_t) LatencyStage::RenderSubmit] = { frameReport.renderSubmitStartTime,
+                                                               frameReport.renderSubmitEndTime };
+        report.stages[(size_t) LatencyStage::Present] = { frameReport.presentStartTime, frameReport.presentEndTime };
+        report.stages[(size_t) LatencyStage::Driver] = { frameReport.driverStartTime, frameReport.driverEndTime };
+        report.stages[(size_t) LatencyStage::OsRenderQueue] = { frameReport.osRenderQueueStartTime,
+                                                                frameReport.osRenderQueueEndTime };
+        report.stages[(size_t) LatencyStage::GpuRender] = { frameReport.gpuRenderStartTime,
+                                                            frameReport.gpuRenderEndTime };
+    }
+
+    ReflexAnalytics::IngestReports(reports.data(), reports.size());
+
+    return true;
+}
+
+bool ReflexHooks::updateTimingData()
+{
     NV_LATENCY_RESULT_PARAMS results {};
-    results.version = NV_LATENCY_RESULT_PARAMS_VER;
 
-    if (auto result = hkNvAPI_D3D_GetLatency(_lastSleepDev, &results); result != NVAPI_OK)
+    if (!getLatencyReport(&results))
         return false;
 
     // 64th element have the latest data
@@ -348,6 +375,20 @@ void ReflexHooks::update(bool optiFg_FgState, bool isVulkan)
         return;
     }
 
+    // Report holds last 64 frames, polling at half of it is enough to keep latency model complete.
+    // Only feeds the latency model, polled on bookkeeping worker.
+    if (!isVulkan && ++_updatesSinceReport >= 32)
+    {
+        _updatesSinceReport = 0;
+
+        PresentScheduler::Defer(PresentStep::LatencyReport,
+                                [](uintptr_t)
+                                {
+                                    NV_LATENCY_RESULT_PARAMS results {};
+                                    getLatencyReport(&results);
+                                });
+    }
+
     if (isVulkan)
     {
         // optiFg_FgState doesn't matter for vulkan
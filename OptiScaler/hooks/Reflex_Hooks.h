@@ -31,6 +31,7 @@ class ReflexHooks
     inline static bool _dlssgDetected = false;
     inline static uint64_t _lastAsyncMarkerFrameId = 0;
     inline static uint64_t _updatesWithoutMarker = 0;
+    inline static uint64_t _updatesSinceReport = 0;
 
     inline static NV_VULKAN_SET_SLEEP_MODE_PARAMS _lastVkSleepParams {};
     inline static HANDLE _lastVkSleepDev = nullptr;
@@ -51,6 +52,9 @@ class ReflexHooks
     static NvAPI_Status hkNvAPI_D3D12_SetAsyncFrameMarker(ID3D12CommandQueue* pCommandQueue,
                                                           NV_ASYNC_FRAME_MARKER_PARAMS* pSetAsyncFrameMarkerParams);
 
+    // Gets latency report and feeds it to ReflexAnalytics
+    static bool getLatencyReport(NV_LATENCY_RESULT_PARAMS* results);
+
     // Vulkan
     inline static decltype(&NvAPI_Vulkan_SetLatencyMarker) o_NvAPI_Vulkan_SetLatencyMarker = nullptr;
     inline static decltype(&NvAPI_Vulkan_SetSleepMode) o_NvAPI_Vulkan_SetSleepMode = nullptr;
@@ -766,14 +766,8 @@ void* StreamlineHooks::hkdlssg_slGetPluginFunction(const char* functionName)
     if (strcmp(functionName, "slDLSSGSetOptions") == 0)
     {
         // Give steam overlay the original as it seems to be hooking it
-        auto steamOverlay = KernelBaseProxy::GetModuleHandleA_()("gameoverlayrenderer64.dll");
-        if (steamOverlay != nullptr)
-        {
-            if (HMODULE callerModule = Util::GetCallerModule(_ReturnAddress()); callerModule == steamOverlay)
-            {
-                return o_dlssg_slGetPluginFunction(functionName);
-            }
-        }
+        if (Util::IsCallerModule(_ReturnAddress(), "gameoverlayrenderer64.dll"))
+            return o_dlssg_slGetPluginFunction(functionName);
 
         o_slDLSSGSetOptions = (decltype(&slDLSSGSetOptions)) o_dlssg_slGetPluginFunction(functionName);
         return &hkslDLSSGSetOptions;
@@ -782,14 +776,8 @@ void* StreamlineHooks::hkdlssg_slGetPluginFunction(const char* functionName)
     if (strcmp(functionName, "slDLSSGGetState") == 0)
     {
         // Give steam overlay the original as it seems to be hooking it
-        auto steamOverlay = KernelBaseProxy::GetModuleHandleA_()("gameoverlayrenderer64.dll");
-        if (steamOverlay != nullptr)
-        {
-            if (HMODULE callerModule = Util::GetCallerModule(_ReturnAddress()); callerModule == steamOverlay)
-            {
-                return o_dlssg_slGetPluginFunction(functionName);
-            }
-        }
+        if (Util::IsCallerModule(_ReturnAddress(), "gameoverlayrenderer64.dll"))
+            return o_dlssg_slGetPluginFunction(functionName);
 
         o_slDLSSGGetState = (decltype(&slDLSSGGetState)) o_dlssg_slGetPluginFunction(functionName);
         return &hkslDLSSGGetState;
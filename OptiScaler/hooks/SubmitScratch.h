@@ -0,0 +1,57 @@
+#pragma once
+
+#include <array>
+#include <algorithm>
+#include <vector>
+
+// Growable array for submit hooks, first InlineCount items are stored in the object itself and
+// bigger requests spill to a vector which keeps its capacity, Clear() never frees memory
+template <typename T, size_t InlineCount> class SubmitScratch
+{
+  private:
+    std::array<T, InlineCount> _inline {};
+    std::vector<T> _overflow;
+    size_t _size = 0;
+    bool _spilled = false;
+
+  public:
+    void Clear()
+    {
+        _size = 0;
+        _spilled = false;
+    }
+
+    // Returns count uninitialized items, previous content is discarded
+    T* Acquire(size_t count)
+    {
+        _spilled = count > InlineCount;
+
+        if (_spilled && _overflow.size() < count)
+            _overflow.resize(count);
+
+        _size = count;
+        return data();
+    }
+
+    void push_back(const T& item)
+    {
+        if (!_spilled && _size == InlineCount)
+        {
+            if (_overflow.size() < InlineCount * 2)
+                _overflow.resize(InlineCount * 2);
+
+            std::copy(_inline.begin(), _inline.end(), _overflow.begin());
+            _spilled = true;
+        }
+        else if (_spilled && _size == _overflow.size())
+        {
+            _overflow.resize(_size * 2);
+        }
+
+        data()[_size++] = item;
+    }
+
+    T* data() { return _spilled ? _overflow.data() : _inline.data(); }
+    size_t size() const { return _size; }
+    bool empty() const { return _size == 0; }
+};
@@ -9,8 +9,11 @@
 #include <menu/menu_overlay_vk.h>
 #include <proxies/KernelBase_Proxy.h>
 #include <upscaler_time/UpscalerTime_Vk.h>
+#include <upscalers/FeatureProvider_Vk.h>
 
 #include <misc/FrameLimit.h>
+#include <misc/BenchmarkCapture.h>
+#include <misc/PresentScheduler.h>
 #include "Reflex_Hooks.h"
 
 #include <spoofing/Vulkan_Spoofing.h>
@@ -180,35 +183,67 @@ static VkResult hkvkQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR* pPres
 {
     LOG_FUNC();
 
+    PresentScheduler::BeginPresent();
+
     // get upscaler time
-    UpscalerTimeVk::ReadUpscalingTime(_device);
+    {
+        ScopedPresentStep step(PresentStep::UpscalerTime);
+        UpscalerTimeVk::ReadUpscalingTime(_device);
+    }
 
     if (!State::Instance().isRunningOnDXVK)
         State::Instance().swapchainApi = Vulkan;
 
+    // Game holds the queue for present, retired upscalers which ran on it can be fenced
+    FeatureProvider_Vk::FramePresented(queue);
+
     // Tick feature to let it know if it's frozen
     if (auto currentFeature = State::Instance().currentFeature; currentFeature != nullptr)
+    {
+        ScopedPresentStep step(PresentStep::FrozenCheck);
         currentFeature->TickFrozenCheck();
+    }
 
     VkPresentInfoKHR localPresentInfo {};
     memcpy(&localPresentInfo, pPresentInfo, sizeof(VkPresentInfoKHR));
 
     // render menu if needed
-    if (!MenuOverlayVk::QueuePresent(queue, &localPresentInfo))
+    bool menuResult;
     {
+        ScopedPresentStep step(PresentStep::Menu);
+        menuResult = MenuOverlayVk::QueuePresent(queue, &localPresentInfo);
+    }
+
+    if (!menuResult)
+    {
+        PresentScheduler::EndPresent();
         LOG_ERROR("QueuePresent: false!");
         return VK_ERROR_OUT_OF_DATE_KHR;
     }
 
-    ReflexHooks::update(false, true);
+    {
+        ScopedPresentStep step(PresentStep::Reflex);
+        ReflexHooks::update(false, true);
+    }
+
+    PresentScheduler::EndPresent();
 
     // original call
     ScopedVulkanCreatingSC scopedVulkanCreatingSC {};
+    auto presentStart = Util::MillisecondsNow();
     auto result = o_QueuePresentKHR(queue, &localPresentInfo);
 
+    // Vulkan has no sync interval or present flags, they are reported as 0
+    auto swapchain = localPresentInfo.swapchainCount > 0 ? (uint64_t) localPresentInfo.pSwapchains[0] : 0;
+    BenchmarkCapture::FramePresented(BenchmarkRuntime::Vulkan, swapchain, 0, 0, presentStart, Util::MillisecondsNow(),
+                                     false);
+
     // Unsure about Vulkan Reflex fps limit and if that could be causing an issue here
     if (!State::Instance().reflexLimitsFps)
+    {
+        ScopedPresentStep step(PresentStep::FrameLimit);
         FrameLimit::sleep(false);
+    }
 
     LOG_FUNC_RESULT(result);
     return result;
@@ -1,16 +1,23 @@
 #include <pch.h>
 
 #include "VulkanwDx12_Hooks.h"
+#include "ProcTable.h"
+#include "SubmitScratch.h"
 
 #include <State.h>
 #include <Config.h>
 
+#include <upscalers/FeatureProvider_Vk.h>
+
 #include <magic_enum.hpp>
 
 #include <detours/detours.h>
 
 #include <vulkan/vulkan_core.h>
 
+#include <array>
+#include <algorithm>
+
 typedef VkResult (*PFN_vkQueueSubmitL)(VkQueue queue, uint32_t submitCount, VkSubmitInfo* pSubmits, VkFence fence);
 typedef VkResult (*PFN_vkQueueSubmit2L)(VkQueue queue, uint32_t submitCount, VkSubmitInfo2* pSubmits, VkFence fence);
 
@@ -20,6 +27,83 @@ typedef struct VkDummyProps
     void* pNext;
 } VkDummyProps;
 
+// Storage for injected submits, one per thread and reused so submit hooks don't allocate.
+// Pointers into it stay valid until the next injection on the same thread.
+struct SubmitScratchSet
+{
+    SubmitScratch<VkSubmitInfo, 8> submitInfos;
+    SubmitScratch<VkSubmitInfo2, 8> submitInfos2;
+    SubmitScratch<VkCommandBuffer, 16> cmdBuffers;
+    SubmitScratch<VkCommandBufferSubmitInfo, 16> cmdBufferInfos;
+    SubmitScratch<VkSemaphoreSubmitInfo, 8> waitSemaphores;
+    SubmitScratch<VkSemaphoreSubmitInfo, 8> signalSemaphores;
+    SubmitScratch<uint64_t, 8> signalValues;
+
+    // Referenced from the game's submit info after injection, can't live on the stack
+    VkSemaphoreSubmitInfo resourceCopySignal {};
+    VkCommandBufferSubmitInfo copyBackCmd {};
+
+    void Clear()
+    {
+        submitInfos.Clear();
+        submitInfos2.Clear();
+        cmdBuffers.Clear();
+        cmdBufferInfos.Clear();
+        waitSemaphores.Clear();
+        signalSemaphores.Clear();
+        signalValues.Clear();
+    }
+};
+
+static SubmitScratchSet& ThreadSubmitScratch()
+{
+    static thread_local SubmitScratchSet scratch;
+    return scratch;
+}
+
+// Single pass search for the upscaler command buffer, returns submit and command buffer index
+static bool FindCmdBuffer(const VkSubmitInfo* pSubmits, uint32_t submitCount, VkCommandBuffer cmdBuffer,
+                          uint32_t& submitIndex, uint32_t& bufferIndex)
+{
+    for (uint32_t i = 0; i < submitCount; i++)
+    {
+        auto buffers = pSubmits[i].pCommandBuffers;
+
+        for (uint32_t j = 0; j < pSubmits[i].commandBufferCount; j++)
+        {
+            if (buffers[j] == cmdBuffer)
+            {
+                submitIndex = i;
+                bufferIndex = j;
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+static bool FindCmdBuffer(const VkSubmitInfo2* pSubmits, uint32_t submitCount, VkCommandBuffer cmdBuffer,
+                          uint32_t& submitIndex, uint32_t& bufferIndex)
+{
+    for (uint32_t i = 0; i < submitCount; i++)
+    {
+        auto infos = pSubmits[i].pCommandBufferInfos;
+
+        for (uint32_t j = 0; j < pSubmits[i].commandBufferInfoCount; j++)
+        {
+            if (infos[j].commandBuffer == cmdBuffer)
+            {
+                submitIndex = i;
+                bufferIndex = j;
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
 static PFN_vkQueueSubmitL o_vkQueueSubmit = nullptr;
 static PFN_vkQueueSubmit2L o_vkQueueSubmit2 = nullptr;
 static PFN_vkQueueSubmit2L o_vkQueueSubmit2KHR = nullptr;
@@ -6099,183 +6183,157 @@ VkResult Vulkan_wDx12::hk_vkQueueSubmit(VkQueue queue, uint32_t submitCount, VkS
     LOG_DEBUG("queue: {:X}, submitCount: {}, fence: {:X}", (size_t) queue, submitCount, (size_t) fence);
 #endif
 
-    std::vector<VkSemaphore> semaphores;
-    std::vector<VkSubmitInfo> submitInfos;
-    std::vector<uint64_t> signalValues;
-    std::vector<VkCommandBuffer> cmdBuffers;
     bool injected = false;
 
     if (commandBufferFoundCount < 1 && lastCmdBuffer != VK_NULL_HANDLE && submitCount > 0)
     {
-        for (uint32_t i = 0; i < submitCount; i++)
+        uint32_t submitIndex = 0;
+        uint32_t bufferIndex = 0;
+
+        if (FindCmdBuffer(pSubmits, submitCount, lastCmdBuffer, submitIndex, bufferIndex))
         {
-            bool addSemaphore = false;
-            uint32_t submitIndex = 0;
+            LOG_DEBUG("Found upscaling command buffer: {:X}, submit: {}, index: {}, queue: {:X}",
+                      (size_t) lastCmdBuffer, submitIndex, bufferIndex, (size_t) queue);
 
-            if (pSubmits[i].commandBufferCount > 0)
-            {
-                for (uint32_t j = 0; j < pSubmits[i].commandBufferCount; j++)
-                {
-                    if (pSubmits[i].pCommandBuffers[j] == lastCmdBuffer)
-                    {
-                        LOG_DEBUG("Found upscaling command buffer: {:X}, submit: {}, queue: {:X}",
-                                  (size_t) lastCmdBuffer, i, (size_t) queue);
+            // Upscaling command buffer found, inject timeline semaphore
+            commandBufferFoundCount++;
 
-                        // Upscaling command buffer found, inject timeline semaphore
-                        commandBufferFoundCount++;
-                        submitIndex = i;
+            auto& scratch = ThreadSubmitScratch();
+            scratch.Clear();
 
-                        if (commandBufferFoundCount == 1)
-                        {
-                            addSemaphore = true;
-                            break;
-                        }
-                    }
-                }
-            }
+            // Original signals in submit
+            auto signalCount = pSubmits[submitIndex].signalSemaphoreCount;
+            auto signals = pSubmits[submitIndex].pSignalSemaphores;
+            bool allFound = false;
+            VkDummyProps* lastNode = nullptr;
 
-            if (addSemaphore)
-            {
-                // Original signals in submit
-                auto signalCount = pSubmits[submitIndex].signalSemaphoreCount;
-                auto signals = pSubmits[submitIndex].pSignalSemaphores;
-                bool allFound = false;
-                VkDummyProps* lastNode = nullptr;
+            VkDummyProps* next = (VkDummyProps*) &pSubmits[submitIndex];
+            lastNode = next;
 
-                VkDummyProps* next = (VkDummyProps*) &pSubmits[submitIndex];
-                lastNode = next;
+            // collect all signal semaphore submit infos
+            while (next->pNext != nullptr)
+            {
+                next = (VkDummyProps*) next->pNext;
 
-                // collect all signal semaphore submit infos
-                while (next->pNext != nullptr)
+                if (next->sType == VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO)
                 {
-                    next = (VkDummyProps*) next->pNext;
+                    auto tlSemaphoreInfo = (VkTimelineSemaphoreSubmitInfo*) next;
 
-                    if (next->sType == VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO)
+                    if (tlSemaphoreInfo->signalSemaphoreValueCount > 0)
                     {
-                        auto tlSemaphoreInfo = (VkTimelineSemaphoreSubmitInfo*) next;
-
-                        if (tlSemaphoreInfo->signalSemaphoreValueCount > 0)
+                        // Store signal values
+                        for (size_t a = 0; a < tlSemaphoreInfo->signalSemaphoreValueCount; a++)
                         {
-                            // Store signal values
-                            for (size_t a = 0; a < tlSemaphoreInfo->signalSemaphoreValueCount; a++)
-                            {
-                                signalValues.push_back(tlSemaphoreInfo->pSignalSemaphoreValues[a]);
-                            }
+                            scratch.signalValues.push_back(tlSemaphoreInfo->pSignalSemaphoreValues[a]);
+                        }
 
-                            if (tlSemaphoreInfo->waitSemaphoreValueCount > 0)
-                            {
-                                // only removing signal info
-                                LOG_DEBUG("Clear signals from timeline semaphore submit info");
-                                tlSemaphoreInfo->signalSemaphoreValueCount = 0;
-                                tlSemaphoreInfo->pSignalSemaphoreValues = nullptr;
-                            }
-                            else if (lastNode != nullptr && lastNode->pNext == next)
-                            {
-                                // removing this signal info so update previous nodes pNext
-                                LOG_DEBUG("Remove timeline semaphore submit info");
-                                lastNode->pNext = next->pNext;
-                            }
+                        if (tlSemaphoreInfo->waitSemaphoreValueCount > 0)
+                        {
+                            // only removing signal info
+                            LOG_DEBUG("Clear signals from timeline semaphore submit info");
+                            tlSemaphoreInfo->signalSemaphoreValueCount = 0;
+                            tlSemaphoreInfo->pSignalSemaphoreValues = nullptr;
+                        }
+                        else if (lastNode != nullptr && lastNode->pNext == next)
+                        {
+                            // removing this signal info so update previous nodes pNext
+                            LOG_DEBUG("Remove timeline semaphore submit info");
+                            lastNode->pNext = next->pNext;
                         }
-                    }
-                    else
-                    {
-                        lastNode = next;
                     }
                 }
+                else
+                {
+                    lastNode = next;
+                }
+            }
 
-                // insert out signal info structure after lastNode
-                if (lastNode != nullptr)
-                    lastNode->pNext = &timelineInfoResourceCopy;
-
-                LOG_DEBUG("Original submit command buffer count: {}", pSubmits[submitIndex].commandBufferCount);
+            // insert out signal info structure after lastNode
+            if (lastNode != nullptr)
+                lastNode->pNext = &timelineInfoResourceCopy;
 
-                // Find upscaler command buffer and move all after it to dummy submit
-                cmdBuffers.push_back(syncSubmitInfo.pCommandBuffers[0]); // Barrier command buffer
+            LOG_DEBUG("Original submit command buffer count: {}", pSubmits[submitIndex].commandBufferCount);
 
-                bool bufferFound = false;
-                uint32_t newCommandCount = pSubmits[submitIndex].commandBufferCount;
-                for (uint32_t b = 0; b < pSubmits[submitIndex].commandBufferCount; b++)
-                {
-                    if (bufferFound)
-                        cmdBuffers.push_back(pSubmits[submitIndex].pCommandBuffers[b]);
+            // Find upscaler command buffer and move all after it to dummy submit
+            scratch.cmdBuffers.push_back(syncSubmitInfo.pCommandBuffers[0]); // Barrier command buffer
 
-                    if (!bufferFound && pSubmits[submitIndex].pCommandBuffers[b] == lastCmdBuffer)
-                    {
-                        newCommandCount = b + 1;
-                        bufferFound = true;
-                    }
-                }
+            for (uint32_t b = bufferIndex + 1; b < pSubmits[submitIndex].commandBufferCount; b++)
+                scratch.cmdBuffers.push_back(pSubmits[submitIndex].pCommandBuffers[b]);
 
-                // Remove moved command buffers from original submit
-                pSubmits[submitIndex].commandBufferCount = newCommandCount;
+            // Remove moved command buffers from original submit
+            pSubmits[submitIndex].commandBufferCount = bufferIndex + 1;
 
-                LOG_DEBUG("Moved {} command buffers to new submit", cmdBuffers.size() - 1);
-                LOG_DEBUG("Original submit command buffer count: {}", pSubmits[submitIndex].commandBufferCount);
+            LOG_DEBUG("Moved {} command buffers to new submit", scratch.cmdBuffers.size() - 1);
+            LOG_DEBUG("Original submit command buffer count: {}", pSubmits[submitIndex].commandBufferCount);
 
-                // now inserting our signal to it
-                pSubmits[submitIndex].signalSemaphoreCount = resourceCopySubmitInfo.signalSemaphoreCount;
-                pSubmits[submitIndex].pSignalSemaphores = resourceCopySubmitInfo.pSignalSemaphores;
-                timelineInfoResourceCopy.waitSemaphoreValueCount = pSubmits[submitIndex].waitSemaphoreCount;
+            // now inserting our signal to it
+            pSubmits[submitIndex].signalSemaphoreCount = resourceCopySubmitInfo.signalSemaphoreCount;
+            pSubmits[submitIndex].pSignalSemaphores = resourceCopySubmitInfo.pSignalSemaphores;
+            timelineInfoResourceCopy.waitSemaphoreValueCount = pSubmits[submitIndex].waitSemaphoreCount;
 
-                // Inject signal semaphore info to out submit info
-                syncSubmitInfo.commandBufferCount = static_cast<uint32_t>(cmdBuffers.size());
-                syncSubmitInfo.pCommandBuffers = cmdBuffers.data();
+            // Inject signal semaphore info to out submit info
+            syncSubmitInfo.commandBufferCount = static_cast<uint32_t>(scratch.cmdBuffers.size());
+            syncSubmitInfo.pCommandBuffers = scratch.cmdBuffers.data();
 
-                // move signal semaphores to new submit
-                syncSubmitInfo.signalSemaphoreCount = signalCount;
-                syncSubmitInfo.pSignalSemaphores = signals;
+            // move signal semaphores to new submit
+            syncSubmitInfo.signalSemaphoreCount = signalCount;
+            syncSubmitInfo.pSignalSemaphores = signals;
 
-                // move signal values to new submit
-                if (signalValues.size() > 0)
-                {
-                    syncTimelineInfo.signalSemaphoreValueCount =
-                        static_cast<uint32_t>(signalValues.size()) + signalCount;
-                    syncTimelineInfo.pSignalSemaphoreValues = signalValues.data();
-                }
-                else
-                {
-                    syncTimelineInfo.signalSemaphoreValueCount = signalCount;
-                    syncTimelineInfo.pSignalSemaphoreValues = nullptr;
-                }
+            // move signal values to new submit
+            if (scratch.signalValues.size() > 0)
+            {
+                syncTimelineInfo.signalSemaphoreValueCount =
+                    static_cast<uint32_t>(scratch.signalValues.size()) + signalCount;
+                syncTimelineInfo.pSignalSemaphoreValues = scratch.signalValues.data();
+            }
+            else
+            {
+                syncTimelineInfo.signalSemaphoreValueCount = signalCount;
+                syncTimelineInfo.pSignalSemaphoreValues = nullptr;
+            }
 
-                // prepare new submit infos list
-                submitInfos.reserve(submitCount + 2);
+            // copyback old submit infos
+            for (uint32_t n = 0; n < submitCount; n++)
+            {
+                scratch.submitInfos.push_back(pSubmits[n]);
 
-                // copyback old submit infos
-                for (uint32_t n = 0; n < submitCount; n++)
+                // add our submit info
+                if (n == submitIndex)
                 {
-                    submitInfos.push_back(pSubmits[n]);
-
-                    // add our submit info
-                    if (n == submitIndex)
-                    {
-                        submitInfos.push_back(copyBackSubmitInfo);
-                        submitInfos.push_back(syncSubmitInfo);
-                    }
+                    scratch.submitInfos.push_back(copyBackSubmitInfo);
+                    scratch.submitInfos.push_back(syncSubmitInfo);
                 }
+            }
 
-                // update submit infos
-                submitCount = static_cast<uint32_t>(submitInfos.size());
-                pSubmits = submitInfos.data();
+            // update submit infos
+            submitCount = static_cast<uint32_t>(scratch.submitInfos.size());
+            pSubmits = scratch.submitInfos.data();
 
-                LOG_DEBUG("Injected w/Dx12 submits");
-                lastCmdBuffer = VK_NULL_HANDLE;
-                injected = true;
-                break;
-            }
+            LOG_DEBUG("Injected w/Dx12 submits");
+            lastCmdBuffer = VK_NULL_HANDLE;
+            injected = true;
         }
     }
 
     // Convert VkSubmitInfo to VkSubmitInfo2 and call o_vkQueueSubmit2
-    std::vector<VkSubmitInfo2> submitInfos2;
-    std::vector<std::vector<VkSemaphoreSubmitInfo>> waitSemaphoreInfos;
-    std::vector<std::vector<VkSemaphoreSubmitInfo>> signalSemaphoreInfos;
-    std::vector<std::vector<VkCommandBufferSubmitInfo>> commandBufferInfos;
+    // All semaphore and command buffer infos go to flat per-thread arrays, submits point into them
+    auto& scratch = ThreadSubmitScratch();
+
+    size_t waitTotal = 0;
+    size_t cmdTotal = 0;
+    size_t signalTotal = 0;
+
+    for (uint32_t i = 0; i < submitCount; i++)
+    {
+        waitTotal += pSubmits[i].waitSemaphoreCount;
+        cmdTotal += pSubmits[i].commandBufferCount;
+        signalTotal += pSubmits[i].signalSemaphoreCount;
+    }
 
-    submitInfos2.reserve(submitCount);
-    waitSemaphoreInfos.reserve(submitCount);
-    signalSemaphoreInfos.reserve(submitCount);
-    commandBufferInfos.reserve(submitCount);
+    auto submitInfos2 = scratch.submitInfos2.Acquire(submitCount);
+    auto waitInfos = scratch.waitSemaphores.Acquire(waitTotal);
+    auto cmdInfos = scratch.cmdBufferInfos.Acquire(cmdTotal);
+    auto signalInfos = scratch.signalSemaphores.Acquire(signalTotal);
 
     for (uint32_t i = 0; i < submitCount; i++)
     {
@@ -6299,8 +6357,6 @@ VkResult Vulkan_wDx12::hk_vkQueueSubmit(VkQueue queue, uint32_t submitCount, VkS
         }
 
         // Convert wait semaphores
-        std::vector<VkSemaphoreSubmitInfo> waitInfos;
-        waitInfos.reserve(pSubmits[i].waitSemaphoreCount);
         for (uint32_t j = 0; j < pSubmits[i].waitSemaphoreCount; j++)
         {
             VkSemaphoreSubmitInfo waitInfo = {};
@@ -6332,26 +6388,20 @@ VkResult Vulkan_wDx12::hk_vkQueueSubmit(VkQueue queue, uint32_t submitCount, VkS
                 waitInfo.stageMask = static_cast<VkPipelineStageFlags2>(stageMask);
 
             waitInfo.deviceIndex = 0;
-            waitInfos.push_back(waitInfo);
+            waitInfos[j] = waitInfo;
         }
-        waitSemaphoreInfos.push_back(std::move(waitInfos));
 
         // Convert command buffers
-        std::vector<VkCommandBufferSubmitInfo> cmdInfos;
-        cmdInfos.reserve(pSubmits[i].commandBufferCount);
         for (uint32_t j = 0; j < pSubmits[i].commandBufferCount; j++)
         {
             VkCommandBufferSubmitInfo cmdInfo = {};
             cmdInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO;
             cmdInfo.commandBuffer = pSubmits[i].pCommandBuffers[j];
             cmdInfo.deviceMask = 0;
-            cmdInfos.push_back(cmdInfo);
+            cmdInfos[j] = cmdInfo;
         }
-        commandBufferInfos.push_back(std::move(cmdInfos));
 
         // Convert signal semaphores
-        std::vector<VkSemaphoreSubmitInfo> signalInfos;
-        signalInfos.reserve(pSubmits[i].signalSemaphoreCount);
         for (uint32_t j = 0; j < pSubmits[i].signalSemaphoreCount; j++)
         {
             VkSemaphoreSubmitInfo signalInfo = {};
@@ -6370,26 +6420,32 @@ VkResult Vulkan_wDx12::hk_vkQueueSubmit(VkQueue queue, uint32_t submitCount, VkS
 
             signalInfo.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
             signalInfo.deviceIndex = 0;
-            signalInfos.push_back(signalInfo);
+            signalInfos[j] = signalInfo;
         }
-        signalSemaphoreInfos.push_back(std::move(signalInfos));
 
-        // Set pointers in VkSubmitInfo2
-        submitInfo2.waitSemaphoreInfoCount = static_cast<uint32_t>(waitSemaphoreInfos[i].size());
-        submitInfo2.pWaitSemaphoreInfos = waitSemaphoreInfos[i].empty() ? nullptr : waitSemaphoreInfos[i].data();
-        submitInfo2.commandBufferInfoCount = static_cast<uint32_t>(commandBufferInfos[i].size());
-        submitInfo2.pCommandBufferInfos = commandBufferInfos[i].empty() ? nullptr : commandBufferInfos[i].data();
-        submitInfo2.signalSemaphoreInfoCount = static_cast<uint32_t>(signalSemaphoreInfos[i].size());
-        submitInfo2.pSignalSemaphoreInfos = signalSemaphoreInfos[i].empty() ? nullptr : signalSemaphoreInfos[i].data();
+        // Set pointers in VkSubmitInfo2 and advance to next submits slices
+        submitInfo2.waitSemaphoreInfoCount = pSubmits[i].waitSemaphoreCount;
+        submitInfo2.pWaitSemaphoreInfos = pSubmits[i].waitSemaphoreCount == 0 ? nullptr : waitInfos;
+        submitInfo2.commandBufferInfoCount = pSubmits[i].commandBufferCount;
+        submitInfo2.pCommandBufferInfos = pSubmits[i].commandBufferCount == 0 ? nullptr : cmdInfos;
+        submitInfo2.signalSemaphoreInfoCount = pSubmits[i].signalSemaphoreCount;
+        submitInfo2.pSignalSemaphoreInfos = pSubmits[i].signalSemaphoreCount == 0 ? nullptr : signalInfos;
 
-        submitInfos2.push_back(submitInfo2);
+        waitInfos += pSubmits[i].waitSemaphoreCount;
+        cmdInfos += pSubmits[i].commandBufferCount;
+        signalInfos += pSubmits[i].signalSemaphoreCount;
+
+        submitInfos2[i] = submitInfo2;
     }
 
     // Call original function using VkSubmitInfo2
     if (injected)
         LOG_DEBUG("Submitting {} submits with vkQueueSubmit2KHR", submitCount);
 
-    auto result = o_vkQueueSubmit2KHR(queue, submitCount, submitInfos2.data(), fence);
+    auto result = o_vkQueueSubmit2KHR(queue, submitCount, submitInfos2, fence);
+
+    if (result == VK_SUCCESS && FeatureProvider_Vk::TracksSubmits())
+        FeatureProvider_Vk::QueueSubmitted(queue, submitCount, submitInfos2);
 
     if (injected)
         LOG_DEBUG("Submitted {} submits with vkQueueSubmit2KHR", submitCount);
@@ -6478,175 +6534,144 @@ VkResult Vulkan_wDx12::hk_vkQueueSubmit(VkQueue queue, uint32_t submitCount, VkS
     LOG_DEBUG("queue: {:X}, submitCount: {}, fence: {:X}", (size_t) queue, submitCount, (size_t) fence);
 #endif
 
-    std::vector<VkSemaphore> semaphores;
-    std::vector<VkSubmitInfo> submitInfos;
-    std::vector<uint64_t> signalValues;
-    std::vector<VkCommandBuffer> cmdBuffers;
     bool injected = false;
 
     if (commandBufferFoundCount < 1 && lastCmdBuffer != VK_NULL_HANDLE && submitCount > 0)
     {
-        for (uint32_t i = 0; i < submitCount; i++)
+        uint32_t submitIndex = 0;
+        uint32_t bufferIndex = 0;
+
+        if (FindCmdBuffer(pSubmits, submitCount, lastCmdBuffer, submitIndex, bufferIndex))
         {
-            bool addSemaphore = false;
-            uint32_t submitIndex = 0;
+            LOG_DEBUG("Found upscaling command buffer: {:X}, submit: {}, index: {}, queue: {:X}",
+                      (size_t) lastCmdBuffer, submitIndex, bufferIndex, (size_t) queue);
 
-            if (pSubmits[i].commandBufferCount > 0)
-            {
-                for (uint32_t j = 0; j < pSubmits[i].commandBufferCount; j++)
-                {
-                    if (pSubmits[i].pCommandBuffers[j] == lastCmdBuffer)
-                    {
-                        LOG_DEBUG("Found upscaling command buffer: {:X}, submit: {}, queue: {:X}",
-                                  (size_t) lastCmdBuffer, i, (size_t) queue);
+            // Upscaling command buffer found, inject timeline semaphore
+            commandBufferFoundCount++;
 
-                        // Upscaling command buffer found, inject timeline semaphore
-                        commandBufferFoundCount++;
-                        submitIndex = i;
+            auto& scratch = ThreadSubmitScratch();
+            scratch.Clear();
 
-                        if (commandBufferFoundCount == 1)
-                        {
-                            addSemaphore = true;
-                            break;
-                        }
-                    }
-                }
-            }
+            // Original signals in submit
+            auto signalCount = pSubmits[submitIndex].signalSemaphoreCount;
+            auto signals = pSubmits[submitIndex].pSignalSemaphores;
+            bool allFound = false;
+            VkDummyProps* lastNode = nullptr;
 
-            if (addSemaphore)
-            {
-                // Original signals in submit
-                auto signalCount = pSubmits[submitIndex].signalSemaphoreCount;
-                auto signals = pSubmits[submitIndex].pSignalSemaphores;
-                bool allFound = false;
-                VkDummyProps* lastNode = nullptr;
+            VkDummyProps* next = (VkDummyProps*) &pSubmits[submitIndex];
+            lastNode = next;
 
-                VkDummyProps* next = (VkDummyProps*) &pSubmits[submitIndex];
-                lastNode = next;
+            // collect all signal semaphore submit infos
+            while (next->pNext != nullptr)
+            {
+                next = (VkDummyProps*) next->pNext;
 
-                // collect all signal semaphore submit infos
-                while (next->pNext != nullptr)
+                if (next->sType == VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO)
                 {
-                    next = (VkDummyProps*) next->pNext;
+                    auto tlSemaphoreInfo = (VkTimelineSemaphoreSubmitInfo*) next;
 
-                    if (next->sType == VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO)
+                    if (tlSemaphoreInfo->signalSemaphoreValueCount > 0)
                     {
-                        auto tlSemaphoreInfo = (VkTimelineSemaphoreSubmitInfo*) next;
-
-                        if (tlSemaphoreInfo->signalSemaphoreValueCount > 0)
+                        // Store signal values
+                        for (size_t a = 0; a < tlSemaphoreInfo->signalSemaphoreValueCount; a++)
                         {
-                            // Store signal values
-                            for (size_t a = 0; a < tlSemaphoreInfo->signalSemaphoreValueCount; a++)
-                            {
-                                signalValues.push_back(tlSemaphoreInfo->pSignalSemaphoreValues[a]);
-                            }
+                            scratch.signalValues.push_back(tlSemaphoreInfo->pSignalSemaphoreValues[a]);
+                        }
 
-                            if (tlSemaphoreInfo->waitSemaphoreValueCount > 0)
-                            {
-                                // only removing signal info
-                                LOG_DEBUG("Clear signals from timeline semaphore submit info");
-                                tlSemaphoreInfo->signalSemaphoreValueCount = 0;
-                                tlSemaphoreInfo->pSignalSemaphoreValues = nullptr;
-                            }
-                            else if (lastNode != nullptr && lastNode->pNext == next)
-                            {
-                                // removing this signal info so update previous nodes pNext
-                                LOG_DEBUG("Remove timeline semaphore submit info");
-                                lastNode->pNext = next->pNext;
-                            }
+                        if (tlSemaphoreInfo->waitSemaphoreValueCount > 0)
+                        {
+                            // only removing signal info
+                            LOG_DEBUG("Clear signals from timeline semaphore submit info");
+                            tlSemaphoreInfo->signalSemaphoreValueCount = 0;
+                            tlSemaphoreInfo->pSignalSemaphoreValues = nullptr;
+                        }
+                        else if (lastNode != nullptr && lastNode->pNext == next)
+                        {
+                            // removing this signal info so update previous nodes pNext
+                            LOG_DEBUG("Remove timeline semaphore submit info");
+                            lastNode->pNext = next->pNext;
                         }
-                    }
-                    else
-                    {
-                        lastNode = next;
                     }
                 }
+                else
+                {
+                    lastNode = next;
+                }
+            }
 
-                // insert out signal info structure after lastNode
-                if (lastNode != nullptr)
-                    lastNode->pNext = &timelineInfoResourceCopy;
-
-                LOG_DEBUG("Original submit command buffer count: {}", pSubmits[submitIndex].commandBufferCount);
+            // insert out signal info structure after lastNode
+            if (lastNode != nullptr)
+                lastNode->pNext = &timelineInfoResourceCopy;
 
-                // Find upscaler command buffer and move all after it to dummy submit
-                cmdBuffers.push_back(syncSubmitInfo.pCommandBuffers[0]); // Barrier command buffer
+            LOG_DEBUG("Original submit command buffer count: {}", pSubmits[submitIndex].commandBufferCount);
 
-                bool bufferFound = false;
-                uint32_t newCommandCount = pSubmits[submitIndex].commandBufferCount;
-                for (uint32_t b = 0; b < pSubmits[submitIndex].commandBufferCount; b++)
-                {
-                    if (bufferFound)
-                        cmdBuffers.push_back(pSubmits[submitIndex].pCommandBuffers[b]);
+            // Find upscaler command buffer and move all after it to dummy submit
+            scratch.cmdBuffers.push_back(syncSubmitInfo.pCommandBuffers[0]); // Barrier command buffer
 
-                    if (!bufferFound && pSubmits[submitIndex].pCommandBuffers[b] == lastCmdBuffer)
-                    {
-                        newCommandCount = b + 1;
-                        bufferFound = true;
-                    }
-                }
+            for (uint32_t b = bufferIndex + 1; b < pSubmits[submitIndex].commandBufferCount; b++)
+                scratch.cmdBuffers.push_back(pSubmits[submitIndex].pCommandBuffers[b]);
 
-                // Remove moved command buffers from original submit
-                pSubmits[submitIndex].commandBufferCount = newCommandCount;
+            // Remove moved command buffers from original submit
+            pSubmits[submitIndex].commandBufferCount = bufferIndex + 1;
 
-                LOG_DEBUG("Moved {} command buffers to new submit", cmdBuffers.size() - 1);
-                LOG_DEBUG("Original submit command buffer count: {}", pSubmits[submitIndex].commandBufferCount);
+            LOG_DEBUG("Moved {} command buffers to new submit", scratch.cmdBuffers.size() - 1);
+            LOG_DEBUG("Original submit command buffer count: {}", pSubmits[submitIndex].commandBufferCount);
 
-                // now inserting our signal to it
-                pSubmits[submitIndex].signalSemaphoreCount = resourceCopySubmitInfo.signalSemaphoreCount;
-                pSubmits[submitIndex].pSignalSemaphores = resourceCopySubmitInfo.pSignalSemaphores;
-                timelineInfoResourceCopy.waitSemaphoreValueCount = pSubmits[submitIndex].waitSemaphoreCount;
+            // now inserting our signal to it
+            pSubmits[submitIndex].signalSemaphoreCount = resourceCopySubmitInfo.signalSemaphoreCount;
+            pSubmits[submitIndex].pSignalSemaphores = resourceCopySubmitInfo.pSignalSemaphores;
+            timelineInfoResourceCopy.waitSemaphoreValueCount = pSubmits[submitIndex].waitSemaphoreCount;
 
-                // Inject signal semaphore info to out submit info
-                syncSubmitInfo.commandBufferCount = static_cast<uint32_t>(cmdBuffers.size());
-                syncSubmitInfo.pCommandBuffers = cmdBuffers.data();
+            // Inject signal semaphore info to out submit info
+            syncSubmitInfo.commandBufferCount = static_cast<uint32_t>(scratch.cmdBuffers.size());
+            syncSubmitInfo.pCommandBuffers = scratch.cmdBuffers.data();
 
-                // move signal semaphores to new submit
-                syncSubmitInfo.signalSemaphoreCount = signalCount;
-                syncSubmitInfo.pSignalSemaphores = signals;
+            // move signal semaphores to new submit
+            syncSubmitInfo.signalSemaphoreCount = signalCount;
+            syncSubmitInfo.pSignalSemaphores = signals;
 
-                // move signal values to new submit
-                if (signalValues.size() > 0)
-                {
-                    syncTimelineInfo.signalSemaphoreValueCount =
-                        static_cast<uint32_t>(signalValues.size()) + signalCount;
-                    syncTimelineInfo.pSignalSemaphoreValues = signalValues.data();
-                }
-                else
-                {
-                    syncTimelineInfo.signalSemaphoreValueCount = signalCount;
-                    syncTimelineInfo.pSignalSemaphoreValues = nullptr;
-                }
+            // move signal values to new submit
+            if (scratch.signalValues.size() > 0)
+            {
+                syncTimelineInfo.signalSemaphoreValueCount =
+                    static_cast<uint32_t>(scratch.signalValues.size()) + signalCount;
+                syncTimelineInfo.pSignalSemaphoreValues = scratch.signalValues.data();
+            }
+            else
+            {
+                syncTimelineInfo.signalSemaphoreValueCount = signalCount;
+                syncTimelineInfo.pSignalSemaphoreValues = nullptr;
+            }
 
-                // prepare new submit infos list
-                submitInfos.reserve(submitCount + 2);
+            // copyback old submit infos
+            for (uint32_t n = 0; n < submitCount; n++)
+            {
+                scratch.submitInfos.push_back(pSubmits[n]);
 
-                // copyback old submit infos
-                for (uint32_t n = 0; n < submitCount; n++)
+                // add our submit info
+                if (n == submitIndex)
                 {
-                    submitInfos.push_back(pSubmits[n]);
-
-                    // add our submit info
-                    if (n == submitIndex)
-                    {
-                        submitInfos.push_back(copyBackSubmitInfo);
-                        submitInfos.push_back(syncSubmitInfo);
-                    }
+                    scratch.submitInfos.push_back(copyBackSubmitInfo);
+                    scratch.submitInfos.push_back(syncSubmitInfo);
                 }
+            }
 
-                // update submit infos
-                submitCount = static_cast<uint32_t>(submitInfos.size());
-                pSubmits = submitInfos.data();
+            // update submit infos
+            submitCount = static_cast<uint32_t>(scratch.submitInfos.size());
+            pSubmits = scratch.submitInfos.data();
 
-                LOG_DEBUG("Injected w/Dx12 submits");
-                lastCmdBuffer = VK_NULL_HANDLE;
-                injected = true;
-                break;
-            }
+            LOG_DEBUG("Injected w/Dx12 submits");
+            lastCmdBuffer = VK_NULL_HANDLE;
+            injected = true;
         }
     }
 
     // Call original function
     auto result = o_vkQueueSubmit(queue, submitCount, pSubmits, fence);
+
+    if (result == VK_SUCCESS && FeatureProvider_Vk::TracksSubmits())
+        FeatureProvider_Vk::QueueSubmitted(queue, submitCount, pSubmits);
+
     if (result != VK_SUCCESS)
     {
         LOG_ERROR("vkQueueSubmit failed with error code: {}", magic_enum::enum_name(result));
@@ -6732,150 +6757,120 @@ VkResult Vulkan_wDx12::hk_vkQueueSubmit2(VkQueue queue, uint32_t submitCount, Vk
     LOG_DEBUG("queue: {:X}, submitCount: {}, fence: {:X}", (size_t) queue, submitCount, (size_t) fence);
 #endif
 
-    std::vector<VkSemaphoreSubmitInfo> waitSemaphores;
-    std::vector<VkSemaphoreSubmitInfo> signalSemaphores;
-    std::vector<VkSubmitInfo2> submitInfos;
-    std::vector<VkCommandBufferSubmitInfo> cmdBufferInfos;
-    std::vector<uint64_t> signalValues;
     bool injected = false;
 
     if (commandBufferFoundCount < 1 && lastCmdBuffer != VK_NULL_HANDLE && submitCount > 0)
     {
-        for (uint32_t i = 0; i < submitCount; i++)
-        {
-            bool addSemaphore = false;
-            uint32_t submitIndex = 0;
+        uint32_t submitIndex = 0;
+        uint32_t bufferIndex = 0;
 
-            if (pSubmits[i].commandBufferInfoCount > 0)
+        if (FindCmdBuffer(pSubmits, submitCount, lastCmdBuffer, submitIndex, bufferIndex))
+        {
+            LOG_DEBUG("Found upscaling command buffer: {:X}, submit: {}, index: {}, queue: {:X}",
+                      (size_t) lastCmdBuffer, submitIndex, bufferIndex, (size_t) queue);
+
+            // Upscaling command buffer found, inject timeline semaphore
+            commandBufferFoundCount++;
+
+            auto& scratch = ThreadSubmitScratch();
+            scratch.Clear();
+
+            // Collect original signal semaphores
+            auto signalCount = pSubmits[submitIndex].signalSemaphoreInfoCount;
+            auto signals = pSubmits[submitIndex].pSignalSemaphoreInfos;
+
+            LOG_DEBUG("Original submit command buffer count: {}", pSubmits[submitIndex].commandBufferInfoCount);
+
+            // Find upscaler command buffer and move all after it to new submit
+            VkCommandBufferSubmitInfo barrierCmdInfo = {};
+            barrierCmdInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO;
+            barrierCmdInfo.commandBuffer = syncSubmitInfo.pCommandBuffers[0]; // Barrier command buffer
+            scratch.cmdBufferInfos.push_back(barrierCmdInfo);
+
+            for (uint32_t b = bufferIndex + 1; b < pSubmits[submitIndex].commandBufferInfoCount; b++)
+                scratch.cmdBufferInfos.push_back(pSubmits[submitIndex].pCommandBufferInfos[b]);
+
+            // Remove moved command buffers from original submit
+            pSubmits[submitIndex].commandBufferInfoCount = bufferIndex + 1;
+
+            LOG_DEBUG("Moved {} command buffers to new submit", scratch.cmdBufferInfos.size() - 1);
+            LOG_DEBUG("Original submit command buffer count: {}", pSubmits[submitIndex].commandBufferInfoCount);
+
+            // Create wait semaphore info for resource copy
+            VkSemaphoreSubmitInfo resourceCopyWaitInfo = {};
+            resourceCopyWaitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+            resourceCopyWaitInfo.semaphore = resourceCopySubmitInfo.pSignalSemaphores[0];
+            resourceCopyWaitInfo.value = timelineInfoResourceCopy.pSignalSemaphoreValues[0];
+            resourceCopyWaitInfo.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+            scratch.waitSemaphores.push_back(resourceCopyWaitInfo);
+
+            // Create signal semaphore info for original submit
+            auto& resourceCopySignalInfo = scratch.resourceCopySignal;
+            resourceCopySignalInfo = {};
+            resourceCopySignalInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+            resourceCopySignalInfo.semaphore = resourceCopySubmitInfo.pSignalSemaphores[0];
+            resourceCopySignalInfo.value = timelineInfoResourceCopy.pSignalSemaphoreValues[0];
+            resourceCopySignalInfo.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+
+            // Update original submit to signal our semaphore
+            pSubmits[submitIndex].signalSemaphoreInfoCount = 1;
+            pSubmits[submitIndex].pSignalSemaphoreInfos = &resourceCopySignalInfo;
+
+            // Create copyBack submit (Dx12 -> Vulkan)
+            VkSubmitInfo2 copyBackSubmit2 = {};
+            copyBackSubmit2.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2;
+            copyBackSubmit2.waitSemaphoreInfoCount = 1;
+            copyBackSubmit2.pWaitSemaphoreInfos = scratch.waitSemaphores.data();
+            copyBackSubmit2.commandBufferInfoCount = 1;
+
+            auto& copyBackCmdInfo = scratch.copyBackCmd;
+            copyBackCmdInfo = {};
+            copyBackCmdInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO;
+            copyBackCmdInfo.commandBuffer = copyBackSubmitInfo.pCommandBuffers[0];
+            copyBackSubmit2.pCommandBufferInfos = &copyBackCmdInfo;
+
+            // Move original signal semaphores to final submit
+            for (uint32_t s = 0; s < signalCount; s++)
             {
-                for (uint32_t j = 0; j < pSubmits[i].commandBufferInfoCount; j++)
-                {
-                    if (pSubmits[i].pCommandBufferInfos[j].commandBuffer == lastCmdBuffer)
-                    {
-                        LOG_DEBUG("Found upscaling command buffer: {:X}, submit: {}, queue: {:X}",
-                                  (size_t) lastCmdBuffer, i, (size_t) queue);
-                        // Upscaling command buffer found, inject timeline semaphore
-                        commandBufferFoundCount++;
-                        submitIndex = i;
-
-                        if (commandBufferFoundCount == 1)
-                        {
-                            addSemaphore = true;
-                            break;
-                        }
-                    }
-                }
+                scratch.signalSemaphores.push_back(signals[s]);
             }
 
-            if (addSemaphore)
-            {
-                // Collect original signal semaphores
-                auto signalCount = pSubmits[submitIndex].signalSemaphoreInfoCount;
-                auto signals = pSubmits[submitIndex].pSignalSemaphoreInfos;
-
-                LOG_DEBUG("Original submit command buffer count: {}", pSubmits[submitIndex].commandBufferInfoCount);
-
-                // Find upscaler command buffer and move all after it to new submit
-                VkCommandBufferSubmitInfo barrierCmdInfo = {};
-                barrierCmdInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO;
-                barrierCmdInfo.commandBuffer = syncSubmitInfo.pCommandBuffers[0]; // Barrier command buffer
-                cmdBufferInfos.push_back(barrierCmdInfo);
-
-                bool bufferFound = false;
-                uint32_t newCommandCount = pSubmits[submitIndex].commandBufferInfoCount;
-                for (uint32_t b = 0; b < pSubmits[submitIndex].commandBufferInfoCount; b++)
-                {
-                    if (bufferFound)
-                        cmdBufferInfos.push_back(pSubmits[submitIndex].pCommandBufferInfos[b]);
-
-                    if (!bufferFound && pSubmits[submitIndex].pCommandBufferInfos[b].commandBuffer == lastCmdBuffer)
-                    {
-                        newCommandCount = b + 1;
-                        bufferFound = true;
-                    }
-                }
-
-                // Remove moved command buffers from original submit
-                pSubmits[submitIndex].commandBufferInfoCount = newCommandCount;
-
-                LOG_DEBUG("Moved {} command buffers to new submit", cmdBufferInfos.size() - 1);
-                LOG_DEBUG("Original submit command buffer count: {}", pSubmits[submitIndex].commandBufferInfoCount);
-
-                // Create wait semaphore info for resource copy
-                VkSemaphoreSubmitInfo resourceCopyWaitInfo = {};
-                resourceCopyWaitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
-                resourceCopyWaitInfo.semaphore = resourceCopySubmitInfo.pSignalSemaphores[0];
-                resourceCopyWaitInfo.value = timelineInfoResourceCopy.pSignalSemaphoreValues[0];
-                resourceCopyWaitInfo.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
-                waitSemaphores.push_back(resourceCopyWaitInfo);
-
-                // Create signal semaphore info for original submit
-                VkSemaphoreSubmitInfo resourceCopySignalInfo = {};
-                resourceCopySignalInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
-                resourceCopySignalInfo.semaphore = resourceCopySubmitInfo.pSignalSemaphores[0];
-                resourceCopySignalInfo.value = timelineInfoResourceCopy.pSignalSemaphoreValues[0];
-                resourceCopySignalInfo.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
-
-                // Update original submit to signal our semaphore
-                pSubmits[submitIndex].signalSemaphoreInfoCount = 1;
-                pSubmits[submitIndex].pSignalSemaphoreInfos = &resourceCopySignalInfo;
-
-                // Create copyBack submit (Dx12 -> Vulkan)
-                VkSubmitInfo2 copyBackSubmit2 = {};
-                copyBackSubmit2.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2;
-                copyBackSubmit2.waitSemaphoreInfoCount = 1;
-                copyBackSubmit2.pWaitSemaphoreInfos = waitSemaphores.data();
-                copyBackSubmit2.commandBufferInfoCount = 1;
-
-                VkCommandBufferSubmitInfo copyBackCmdInfo = {};
-                copyBackCmdInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO;
-                copyBackCmdInfo.commandBuffer = copyBackSubmitInfo.pCommandBuffers[0];
-                copyBackSubmit2.pCommandBufferInfos = &copyBackCmdInfo;
-
-                // Move original signal semaphores to final submit
-                for (uint32_t s = 0; s < signalCount; s++)
-                {
-                    signalSemaphores.push_back(signals[s]);
-                }
-
-                // Create final sync submit with moved command buffers
-                VkSubmitInfo2 syncSubmit2 = {};
-                syncSubmit2.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2;
-                syncSubmit2.commandBufferInfoCount = static_cast<uint32_t>(cmdBufferInfos.size());
-                syncSubmit2.pCommandBufferInfos = cmdBufferInfos.data();
-                syncSubmit2.signalSemaphoreInfoCount = static_cast<uint32_t>(signalSemaphores.size());
-                syncSubmit2.pSignalSemaphoreInfos = signalSemaphores.data();
+            // Create final sync submit with moved command buffers
+            VkSubmitInfo2 syncSubmit2 = {};
+            syncSubmit2.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2;
+            syncSubmit2.commandBufferInfoCount = static_cast<uint32_t>(scratch.cmdBufferInfos.size());
+            syncSubmit2.pCommandBufferInfos = scratch.cmdBufferInfos.data();
+            syncSubmit2.signalSemaphoreInfoCount = static_cast<uint32_t>(scratch.signalSemaphores.size());
+            syncSubmit2.pSignalSemaphoreInfos = scratch.signalSemaphores.data();
 
-                // Prepare new submit infos list
-                submitInfos.reserve(submitCount + 2);
+            // Copy old submit infos and insert our submits
+            for (uint32_t n = 0; n < submitCount; n++)
+            {
+                scratch.submitInfos2.push_back(pSubmits[n]);
 
-                // Copy old submit infos and insert our submits
-                for (uint32_t n = 0; n < submitCount; n++)
+                if (n == submitIndex)
                 {
-                    submitInfos.push_back(pSubmits[n]);
-
-                    if (n == submitIndex)
-                    {
-                        submitInfos.push_back(copyBackSubmit2);
-                        submitInfos.push_back(syncSubmit2);
-                    }
+                    scratch.submitInfos2.push_back(copyBackSubmit2);
+                    scratch.submitInfos2.push_back(syncSubmit2);
                 }
+            }
 
-                // Update submit infos
-                submitCount = static_cast<uint32_t>(submitInfos.size());
-                pSubmits = submitInfos.data();
+            // Update submit infos
+            submitCount = static_cast<uint32_t>(scratch.submitInfos2.size());
+            pSubmits = scratch.submitInfos2.data();
 
-                LOG_DEBUG("Injected w/Dx12 submits");
-                lastCmdBuffer = VK_NULL_HANDLE;
-                injected = true;
-                break;
-            }
+            LOG_DEBUG("Injected w/Dx12 submits");
+            lastCmdBuffer = VK_NULL_HANDLE;
+            injected = true;
         }
     }
 
     // Call original function
     auto result = o_vkQueueSubmit2(queue, submitCount, pSubmits, fence);
 
+    if (result == VK_SUCCESS && FeatureProvider_Vk::TracksSubmits())
+        FeatureProvider_Vk::QueueSubmitted(queue, submitCount, pSubmits);
+
     if (result != VK_SUCCESS)
     {
         LOG_ERROR("o_vkQueueSubmit2 result: {}", magic_enum::enum_name(result));
@@ -6927,178 +6922,148 @@ VkResult Vulkan_wDx12::hk_vkQueueSubmit2KHR(VkQueue queue, uint32_t submitCount,
     LOG_DEBUG("queue: {:X}, submitCount: {}, fence: {:X}", (size_t) queue, submitCount, (size_t) fence);
 #endif
 
-    std::vector<VkSemaphoreSubmitInfo> waitSemaphores;
-    std::vector<VkSemaphoreSubmitInfo> signalSemaphores;
-    std::vector<VkSubmitInfo2> submitInfos;
-    std::vector<VkCommandBufferSubmitInfo> cmdBufferInfos;
-    std::vector<uint64_t> signalValues;
 
     if (commandBufferFoundCount < 1 && lastCmdBuffer != VK_NULL_HANDLE && submitCount > 0)
     {
-        for (uint32_t i = 0; i < submitCount; i++)
-        {
-            bool addSemaphore = false;
-            uint32_t submitIndex = 0;
+        uint32_t submitIndex = 0;
+        uint32_t bufferIndex = 0;
 
-            if (pSubmits[i].commandBufferInfoCount > 0)
+        if (FindCmdBuffer(pSubmits, submitCount, lastCmdBuffer, submitIndex, bufferIndex))
+        {
+            LOG_DEBUG("Found upscaling command buffer: {:X}, submit: {}, index: {}, queue: {:X}",
+                      (size_t) lastCmdBuffer, submitIndex, bufferIndex, (size_t) queue);
+
+            // Upscaling command buffer found, inject timeline semaphore
+            commandBufferFoundCount++;
+
+            auto& scratch = ThreadSubmitScratch();
+            scratch.Clear();
+
+            // Collect original signal semaphores
+            auto signalCount = pSubmits[submitIndex].signalSemaphoreInfoCount;
+            auto signals = pSubmits[submitIndex].pSignalSemaphoreInfos;
+
+            LOG_DEBUG("Original submit command buffer count: {}", pSubmits[submitIndex].commandBufferInfoCount);
+
+            // Find upscaler command buffer and move all after it to new submit
+            VkCommandBufferSubmitInfo barrierCmdInfo = {};
+            barrierCmdInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO;
+            barrierCmdInfo.commandBuffer = syncSubmitInfo.pCommandBuffers[0]; // Barrier command buffer
+            scratch.cmdBufferInfos.push_back(barrierCmdInfo);
+
+            for (uint32_t b = bufferIndex + 1; b < pSubmits[submitIndex].commandBufferInfoCount; b++)
+                scratch.cmdBufferInfos.push_back(pSubmits[submitIndex].pCommandBufferInfos[b]);
+
+            // Remove moved command buffers from original submit
+            pSubmits[submitIndex].commandBufferInfoCount = bufferIndex + 1;
+
+            LOG_DEBUG("Moved {} command buffers to new submit", scratch.cmdBufferInfos.size() - 1);
+            LOG_DEBUG("Original submit command buffer count: {}", pSubmits[submitIndex].commandBufferInfoCount);
+
+            // Create wait semaphore info for resource copy
+            VkSemaphoreSubmitInfo resourceCopyWaitInfo = {};
+            resourceCopyWaitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+            resourceCopyWaitInfo.semaphore = resourceCopySubmitInfo.pSignalSemaphores[0];
+            resourceCopyWaitInfo.value = timelineInfoResourceCopy.pSignalSemaphoreValues[0];
+            resourceCopyWaitInfo.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+            scratch.waitSemaphores.push_back(resourceCopyWaitInfo);
+
+            // Create signal semaphore info for original submit
+            auto& resourceCopySignalInfo = scratch.resourceCopySignal;
+            resourceCopySignalInfo = {};
+            resourceCopySignalInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+            resourceCopySignalInfo.semaphore = resourceCopySubmitInfo.pSignalSemaphores[0];
+            resourceCopySignalInfo.value = timelineInfoResourceCopy.pSignalSemaphoreValues[0];
+            resourceCopySignalInfo.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+
+            // Update original submit to signal our semaphore
+            pSubmits[submitIndex].signalSemaphoreInfoCount = 1;
+            pSubmits[submitIndex].pSignalSemaphoreInfos = &resourceCopySignalInfo;
+
+            // Create copyBack submit (Dx12 -> Vulkan)
+            VkSubmitInfo2 copyBackSubmit2 = {};
+            copyBackSubmit2.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2;
+            copyBackSubmit2.waitSemaphoreInfoCount = 1;
+            copyBackSubmit2.pWaitSemaphoreInfos = scratch.waitSemaphores.data();
+            copyBackSubmit2.commandBufferInfoCount = 1;
+
+            auto& copyBackCmdInfo = scratch.copyBackCmd;
+            copyBackCmdInfo = {};
+            copyBackCmdInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO;
+            copyBackCmdInfo.commandBuffer = copyBackSubmitInfo.pCommandBuffers[0];
+            copyBackSubmit2.pCommandBufferInfos = &copyBackCmdInfo;
+
+            // Move original signal semaphores to final submit
+            for (uint32_t s = 0; s < signalCount; s++)
             {
-                for (uint32_t j = 0; j < pSubmits[i].commandBufferInfoCount; j++)
-                {
-                    if (pSubmits[i].pCommandBufferInfos[j].commandBuffer == lastCmdBuffer)
-                    {
-                        LOG_DEBUG("Found upscaling command buffer: {:X}, submit: {}, queue: {:X}",
-                                  (size_t) lastCmdBuffer, i, (size_t) queue);
-                        // Upscaling command buffer found, inject timeline semaphore
-                        commandBufferFoundCount++;
-                        submitIndex = i;
-
-                        if (commandBufferFoundCount == 1)
-                        {
-                            addSemaphore = true;
-                            break;
-                        }
-                    }
-                }
+                scratch.signalSemaphores.push_back(signals[s]);
             }
 
-            if (addSemaphore)
-            {
-                // Collect original signal semaphores
-                auto signalCount = pSubmits[submitIndex].signalSemaphoreInfoCount;
-                auto signals = pSubmits[submitIndex].pSignalSemaphoreInfos;
-
-                LOG_DEBUG("Original submit command buffer count: {}", pSubmits[submitIndex].commandBufferInfoCount);
+            // Create final sync submit with moved command buffers
+            VkSubmitInfo2 syncSubmit2 = {};
+            syncSubmit2.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2;
+            syncSubmit2.commandBufferInfoCount = static_cast<uint32_t>(scratch.cmdBufferInfos.size());
+            syncSubmit2.pCommandBufferInfos = scratch.cmdBufferInfos.data();
+            syncSubmit2.signalSemaphoreInfoCount = static_cast<uint32_t>(scratch.signalSemaphores.size());
+            syncSubmit2.pSignalSemaphoreInfos = scratch.signalSemaphores.data();
 
-                // Find upscaler command buffer and move all after it to new submit
-                VkCommandBufferSubmitInfo barrierCmdInfo = {};
-                barrierCmdInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO;
-                barrierCmdInfo.commandBuffer = syncSubmitInfo.pCommandBuffers[0]; // Barrier command buffer
-                cmdBufferInfos.push_back(barrierCmdInfo);
+            // Copy old submit infos and insert our submits
+            for (uint32_t n = 0; n < submitCount; n++)
+            {
+                scratch.submitInfos2.push_back(pSubmits[n]);
 
-                bool bufferFound = false;
-                uint32_t newCommandCount = pSubmits[submitIndex].commandBufferInfoCount;
-                for (uint32_t b = 0; b < pSubmits[submitIndex].commandBufferInfoCount; b++)
+                if (n == submitIndex)
                 {
-                    if (bufferFound)
-                        cmdBufferInfos.push_back(pSubmits[submitIndex].pCommandBufferInfos[b]);
-
-                    if (!bufferFound && pSubmits[submitIndex].pCommandBufferInfos[b].commandBuffer == lastCmdBuffer)
-                    {
-                        newCommandCount = b + 1;
-                        bufferFound = true;
-                    }
+                    scratch.submitInfos2.push_back(copyBackSubmit2);
+                    scratch.submitInfos2.push_back(syncSubmit2);
                 }
+            }
 
-                // Remove moved command buffers from original submit
-                pSubmits[submitIndex].commandBufferInfoCount = newCommandCount;
-
-                LOG_DEBUG("Moved {} command buffers to new submit", cmdBufferInfos.size() - 1);
-                LOG_DEBUG("Original submit command buffer count: {}", pSubmits[submitIndex].commandBufferInfoCount);
-
-                // Create wait semaphore info for resource copy
-                VkSemaphoreSubmitInfo resourceCopyWaitInfo = {};
-                resourceCopyWaitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
-                resourceCopyWaitInfo.semaphore = resourceCopySubmitInfo.pSignalSemaphores[0];
-                resourceCopyWaitInfo.value = timelineInfoResourceCopy.pSignalSemaphoreValues[0];
-                resourceCopyWaitInfo.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
-                waitSemaphores.push_back(resourceCopyWaitInfo);
-
-                // Create signal semaphore info for original submit
-                VkSemaphoreSubmitInfo resourceCopySignalInfo = {};
-                resourceCopySignalInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
-                resourceCopySignalInfo.semaphore = resourceCopySubmitInfo.pSignalSemaphores[0];
-                resourceCopySignalInfo.value = timelineInfoResourceCopy.pSignalSemaphoreValues[0];
-                resourceCopySignalInfo.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
-
-                // Update original submit to signal our semaphore
-                pSubmits[submitIndex].signalSemaphoreInfoCount = 1;
-                pSubmits[submitIndex].pSignalSemaphoreInfos = &resourceCopySignalInfo;
-
-                // Create copyBack submit (Dx12 -> Vulkan)
-                VkSubmitInfo2 copyBackSubmit2 = {};
-                copyBackSubmit2.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2;
-                copyBackSubmit2.waitSemaphoreInfoCount = 1;
-                copyBackSubmit2.pWaitSemaphoreInfos = waitSemaphores.data();
-                copyBackSubmit2.commandBufferInfoCount = 1;
-
-                VkCommandBufferSubmitInfo copyBackCmdInfo = {};
-                copyBackCmdInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO;
-                copyBackCmdInfo.commandBuffer = copyBackSubmitInfo.pCommandBuffers[0];
-                copyBackSubmit2.pCommandBufferInfos = &copyBackCmdInfo;
-
-                // Move original signal semaphores to final submit
-                for (uint32_t s = 0; s < signalCount; s++)
-                {
-                    signalSemaphores.push_back(signals[s]);
-                }
+            // Update submit infos
+            submitCount = static_cast<uint32_t>(scratch.submitInfos2.size());
+            pSubmits = scratch.submitInfos2.data();
 
-                // Create final sync submit with moved command buffers
-                VkSubmitInfo2 syncSubmit2 = {};
-                syncSubmit2.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2;
-                syncSubmit2.commandBufferInfoCount = static_cast<uint32_t>(cmdBufferInfos.size());
-                syncSubmit2.pCommandBufferInfos = cmdBufferInfos.data();
-                syncSubmit2.signalSemaphoreInfoCount = static_cast<uint32_t>(signalSemaphores.size());
-                syncSubmit2.pSignalSemaphoreInfos = signalSemaphores.data();
+            LOG_DEBUG("Injected w/Dx12 submits (VkSubmitInfo2)");
+#ifdef LOG_ALL_RECORDS
+            LOG_DEBUG("==================================================");
 
-                // Prepare new submit infos list
-                submitInfos.reserve(submitCount + 2);
+            for (size_t a = 0; a < submitCount; a++)
+            {
+                LOG_DEBUG("  Submit[{}]: cmdBufferInfoCount: {}", a, pSubmits[a].commandBufferInfoCount);
 
-                // Copy old submit infos and insert our submits
-                for (uint32_t n = 0; n < submitCount; n++)
+                for (size_t b = 0; b < pSubmits[a].commandBufferInfoCount; b++)
                 {
-                    submitInfos.push_back(pSubmits[n]);
-
-                    if (n == submitIndex)
-                    {
-                        submitInfos.push_back(copyBackSubmit2);
-                        submitInfos.push_back(syncSubmit2);
-                    }
+                    LOG_DEBUG("    CmdBuffer[{}]: {:X}", b,
+                              (size_t) pSubmits[a].pCommandBufferInfos[b].commandBuffer);
                 }
 
-                // Update submit infos
-                submitCount = static_cast<uint32_t>(submitInfos.size());
-                pSubmits = submitInfos.data();
-
-                LOG_DEBUG("Injected w/Dx12 submits (VkSubmitInfo2)");
-#ifdef LOG_ALL_RECORDS
-                LOG_DEBUG("==================================================");
-
-                for (size_t a = 0; a < submitCount; a++)
+                LOG_DEBUG("    waitSemaphoreInfoCount: {}", pSubmits[a].waitSemaphoreInfoCount);
+                for (size_t c = 0; c < pSubmits[a].waitSemaphoreInfoCount; c++)
                 {
-                    LOG_DEBUG("  Submit[{}]: cmdBufferInfoCount: {}", a, pSubmits[a].commandBufferInfoCount);
-
-                    for (size_t b = 0; b < pSubmits[a].commandBufferInfoCount; b++)
-                    {
-                        LOG_DEBUG("    CmdBuffer[{}]: {:X}", b,
-                                  (size_t) pSubmits[a].pCommandBufferInfos[b].commandBuffer);
-                    }
-
-                    LOG_DEBUG("    waitSemaphoreInfoCount: {}", pSubmits[a].waitSemaphoreInfoCount);
-                    for (size_t c = 0; c < pSubmits[a].waitSemaphoreInfoCount; c++)
-                    {
-                        LOG_DEBUG("    WaitSemaphore[{}]: {:X}, value: {}", c,
-                                  (size_t) pSubmits[a].pWaitSemaphoreInfos[c].semaphore,
-                                  pSubmits[a].pWaitSemaphoreInfos[c].value);
-                    }
+                    LOG_DEBUG("    WaitSemaphore[{}]: {:X}, value: {}", c,
+                              (size_t) pSubmits[a].pWaitSemaphoreInfos[c].semaphore,
+                              pSubmits[a].pWaitSemaphoreInfos[c].value);
+                }
 
-                    LOG_DEBUG("    signalSemaphoreInfoCount: {}", pSubmits[a].signalSemaphoreInfoCount);
-                    for (size_t d = 0; d < pSubmits[a].signalSemaphoreInfoCount; d++)
-                    {
-                        LOG_DEBUG("    SignalSemaphore[{}]: {:X}, value: {}", d,
-                                  (size_t) pSubmits[a].pSignalSemaphoreInfos[d].semaphore,
-                                  pSubmits[a].pSignalSemaphoreInfos[d].value);
-                    }
+                LOG_DEBUG("    signalSemaphoreInfoCount: {}", pSubmits[a].signalSemaphoreInfoCount);
+                for (size_t d = 0; d < pSubmits[a].signalSemaphoreInfoCount; d++)
+                {
+                    LOG_DEBUG("    SignalSemaphore[{}]: {:X}, value: {}", d,
+                              (size_t) pSubmits[a].pSignalSemaphoreInfos[d].semaphore,
+                              pSubmits[a].pSignalSemaphoreInfos[d].value);
                 }
-#endif
-                lastCmdBuffer = VK_NULL_HANDLE;
-                break;
             }
+#endif
+            lastCmdBuffer = VK_NULL_HANDLE;
         }
     }
 
     // Call original function
     auto result = o_vkQueueSubmit2KHR(queue, submitCount, pSubmits, fence);
 
+    if (result == VK_SUCCESS && FeatureProvider_Vk::TracksSubmits())
+        FeatureProvider_Vk::QueueSubmitted(queue, submitCount, pSubmits);
+
 #ifdef LOG_ALL_RECORDS
     LOG_DEBUG("o_vkQueueSubmit2KHR result: {}", magic_enum::enum_name(result));
 #endif
@@ -7228,2515 +7193,324 @@ PFN_vkVoidFunction Vulkan_wDx12::GetInstanceProcAddr(const PFN_vkVoidFunction or
 
 void Vulkan_wDx12::EndCmdBuffer(VkCommandBuffer commandBuffer) { o_vkEndCommandBuffer(commandBuffer); }
 
+// Captures original function at first query and returns the hook
+template <auto& Original, auto Hook> static PFN_vkVoidFunction ResolveHook(PFN_vkVoidFunction original)
+{
+    if (Original == nullptr)
+        Original = (std::remove_reference_t<decltype(Original)>) original;
+
+    return (PFN_vkVoidFunction) Hook;
+}
+
+using VkHookEntry = ProcTableEntry<PFN_vkVoidFunction (*)(PFN_vkVoidFunction original)>;
+
 PFN_vkVoidFunction Vulkan_wDx12::GetAddress(const PFN_vkVoidFunction original, const char* pName)
 {
     if (original == nullptr || pName == nullptr)
         return VK_NULL_HANDLE;
 
-    auto procName = std::string(pName);
+#define VK_HOOK_ENTRY(name) VkHookEntry { #name, &ResolveHook<o_##name, hk_##name> }
+
+    // Sorted at compile time, lookup is a binary search without any allocation
+    static constexpr auto hooks = SortProcTable(std::array {
+        VK_HOOK_ENTRY(vkQueueSubmit),
+        VK_HOOK_ENTRY(vkQueueSubmit2),
+        VK_HOOK_ENTRY(vkQueueSubmit2KHR),
+        VK_HOOK_ENTRY(vkBeginCommandBuffer),
+        VK_HOOK_ENTRY(vkEndCommandBuffer),
+        VK_HOOK_ENTRY(vkResetCommandBuffer),
+        VK_HOOK_ENTRY(vkCmdExecuteCommands),
+        VK_HOOK_ENTRY(vkCreateCommandPool),
+        VK_HOOK_ENTRY(vkFreeCommandBuffers),
+        VK_HOOK_ENTRY(vkResetCommandPool),
+        VK_HOOK_ENTRY(vkAllocateCommandBuffers),
+        VK_HOOK_ENTRY(vkDestroyCommandPool),
+        VK_HOOK_ENTRY(vkCmdBindPipeline),
+        VK_HOOK_ENTRY(vkCmdSetViewport),
+        VK_HOOK_ENTRY(vkCmdSetScissor),
+        VK_HOOK_ENTRY(vkCmdSetLineWidth),
+        VK_HOOK_ENTRY(vkCmdSetDepthBias),
+        VK_HOOK_ENTRY(vkCmdSetBlendConstants),
+        VK_HOOK_ENTRY(vkCmdSetDepthBounds),
+        VK_HOOK_ENTRY(vkCmdSetStencilCompareMask),
+        VK_HOOK_ENTRY(vkCmdSetStencilWriteMask),
+        VK_HOOK_ENTRY(vkCmdSetStencilReference),
+        VK_HOOK_ENTRY(vkCmdBindDescriptorSets),
+        VK_HOOK_ENTRY(vkCmdBindIndexBuffer),
+        VK_HOOK_ENTRY(vkCmdBindVertexBuffers),
+        VK_HOOK_ENTRY(vkCmdDraw),
+        VK_HOOK_ENTRY(vkCmdDrawIndexed),
+        VK_HOOK_ENTRY(vkCmdDrawIndirect),
+        VK_HOOK_ENTRY(vkCmdDrawIndexedIndirect),
+        VK_HOOK_ENTRY(vkCmdDispatch),
+        VK_HOOK_ENTRY(vkCmdDispatchIndirect),
+        VK_HOOK_ENTRY(vkCmdCopyBuffer),
+        VK_HOOK_ENTRY(vkCmdCopyImage),
+        VK_HOOK_ENTRY(vkCmdBlitImage),
+        VK_HOOK_ENTRY(vkCmdCopyBufferToImage),
+        VK_HOOK_ENTRY(vkCmdCopyImageToBuffer),
+        VK_HOOK_ENTRY(vkCmdUpdateBuffer),
+        VK_HOOK_ENTRY(vkCmdFillBuffer),
+        VK_HOOK_ENTRY(vkCmdClearColorImage),
+        VK_HOOK_ENTRY(vkCmdClearDepthStencilImage),
+        VK_HOOK_ENTRY(vkCmdClearAttachments),
+        VK_HOOK_ENTRY(vkCmdResolveImage),
+        VK_HOOK_ENTRY(vkCmdSetEvent),
+        VK_HOOK_ENTRY(vkCmdResetEvent),
+        VK_HOOK_ENTRY(vkCmdWaitEvents),
+        VK_HOOK_ENTRY(vkCmdPipelineBarrier),
+        VK_HOOK_ENTRY(vkCmdBeginQuery),
+        VK_HOOK_ENTRY(vkCmdEndQuery),
+        VK_HOOK_ENTRY(vkCmdResetQueryPool),
+        VK_HOOK_ENTRY(vkCmdWriteTimestamp),
+        VK_HOOK_ENTRY(vkCmdCopyQueryPoolResults),
+        VK_HOOK_ENTRY(vkCmdPushConstants),
+        VK_HOOK_ENTRY(vkCmdBeginRenderPass),
+        VK_HOOK_ENTRY(vkCmdNextSubpass),
+        VK_HOOK_ENTRY(vkCmdEndRenderPass),
+        VK_HOOK_ENTRY(vkCmdSetDeviceMask),
+        VK_HOOK_ENTRY(vkCmdDispatchBase),
+        VK_HOOK_ENTRY(vkCmdDrawIndirectCount),
+        VK_HOOK_ENTRY(vkCmdDrawIndexedIndirectCount),
+        VK_HOOK_ENTRY(vkCmdBeginRenderPass2),
+        VK_HOOK_ENTRY(vkCmdNextSubpass2),
+        VK_HOOK_ENTRY(vkCmdEndRenderPass2),
+        VK_HOOK_ENTRY(vkCmdSetEvent2),
+        VK_HOOK_ENTRY(vkCmdResetEvent2),
+        VK_HOOK_ENTRY(vkCmdWaitEvents2),
+        VK_HOOK_ENTRY(vkCmdPipelineBarrier2),
+        VK_HOOK_ENTRY(vkCmdWriteTimestamp2),
+        VK_HOOK_ENTRY(vkCmdCopyBuffer2),
+        VK_HOOK_ENTRY(vkCmdCopyImage2),
+        VK_HOOK_ENTRY(vkCmdCopyBufferToImage2),
+        VK_HOOK_ENTRY(vkCmdCopyImageToBuffer2),
+        VK_HOOK_ENTRY(vkCmdBlitImage2),
+        VK_HOOK_ENTRY(vkCmdResolveImage2),
+        VK_HOOK_ENTRY(vkCmdBeginRendering),
+        VK_HOOK_ENTRY(vkCmdEndRendering),
+        VK_HOOK_ENTRY(vkCmdSetCullMode),
+        VK_HOOK_ENTRY(vkCmdSetFrontFace),
+        VK_HOOK_ENTRY(vkCmdSetPrimitiveTopology),
+        VK_HOOK_ENTRY(vkCmdSetViewportWithCount),
+        VK_HOOK_ENTRY(vkCmdSetScissorWithCount),
+        VK_HOOK_ENTRY(vkCmdBindVertexBuffers2),
+        VK_HOOK_ENTRY(vkCmdSetDepthTestEnable),
+        VK_HOOK_ENTRY(vkCmdSetDepthWriteEnable),
+        VK_HOOK_ENTRY(vkCmdSetDepthCompareOp),
+        VK_HOOK_ENTRY(vkCmdSetDepthBoundsTestEnable),
+        VK_HOOK_ENTRY(vkCmdSetStencilTestEnable),
+        VK_HOOK_ENTRY(vkCmdSetStencilOp),
+        VK_HOOK_ENTRY(vkCmdSetRasterizerDiscardEnable),
+        VK_HOOK_ENTRY(vkCmdSetDepthBiasEnable),
+        VK_HOOK_ENTRY(vkCmdSetPrimitiveRestartEnable),
+        VK_HOOK_ENTRY(vkCmdSetLineStipple),
+        VK_HOOK_ENTRY(vkCmdBindIndexBuffer2),
+        VK_HOOK_ENTRY(vkCmdPushDescriptorSet),
+        VK_HOOK_ENTRY(vkCmdPushDescriptorSetWithTemplate),
+        VK_HOOK_ENTRY(vkCmdSetRenderingAttachmentLocations),
+        VK_HOOK_ENTRY(vkCmdSetRenderingInputAttachmentIndices),
+        VK_HOOK_ENTRY(vkCmdBindDescriptorSets2),
+        VK_HOOK_ENTRY(vkCmdPushConstants2),
+        VK_HOOK_ENTRY(vkCmdPushDescriptorSet2),
+        VK_HOOK_ENTRY(vkCmdPushDescriptorSetWithTemplate2),
+        VK_HOOK_ENTRY(vkCmdBeginVideoCodingKHR),
+        VK_HOOK_ENTRY(vkCmdEndVideoCodingKHR),
+        VK_HOOK_ENTRY(vkCmdControlVideoCodingKHR),
+        VK_HOOK_ENTRY(vkCmdDecodeVideoKHR),
+        VK_HOOK_ENTRY(vkCmdBeginRenderingKHR),
+        VK_HOOK_ENTRY(vkCmdEndRenderingKHR),
+        VK_HOOK_ENTRY(vkCmdSetDeviceMaskKHR),
+        VK_HOOK_ENTRY(vkCmdDispatchBaseKHR),
+        VK_HOOK_ENTRY(vkCmdPushDescriptorSetKHR),
+        VK_HOOK_ENTRY(vkCmdPushDescriptorSetWithTemplateKHR),
+        VK_HOOK_ENTRY(vkCmdBeginRenderPass2KHR),
+        VK_HOOK_ENTRY(vkCmdNextSubpass2KHR),
+        VK_HOOK_ENTRY(vkCmdEndRenderPass2KHR),
+        VK_HOOK_ENTRY(vkCmdDrawIndirectCountKHR),
+        VK_HOOK_ENTRY(vkCmdDrawIndexedIndirectCountKHR),
+        VK_HOOK_ENTRY(vkCmdSetFragmentShadingRateKHR),
+        VK_HOOK_ENTRY(vkCmdSetRenderingAttachmentLocationsKHR),
+        VK_HOOK_ENTRY(vkCmdSetRenderingInputAttachmentIndicesKHR),
+        VK_HOOK_ENTRY(vkCmdEncodeVideoKHR),
+        VK_HOOK_ENTRY(vkCmdSetEvent2KHR),
+        VK_HOOK_ENTRY(vkCmdResetEvent2KHR),
+        VK_HOOK_ENTRY(vkCmdWaitEvents2KHR),
+        VK_HOOK_ENTRY(vkCmdPipelineBarrier2KHR),
+        VK_HOOK_ENTRY(vkCmdWriteTimestamp2KHR),
+        VK_HOOK_ENTRY(vkCmdCopyBuffer2KHR),
+        VK_HOOK_ENTRY(vkCmdCopyImage2KHR),
+        VK_HOOK_ENTRY(vkCmdCopyBufferToImage2KHR),
+        VK_HOOK_ENTRY(vkCmdCopyImageToBuffer2KHR),
+        VK_HOOK_ENTRY(vkCmdBlitImage2KHR),
+        VK_HOOK_ENTRY(vkCmdResolveImage2KHR),
+        VK_HOOK_ENTRY(vkCmdTraceRaysIndirect2KHR),
+        VK_HOOK_ENTRY(vkCmdBindIndexBuffer2KHR),
+        VK_HOOK_ENTRY(vkCmdSetLineStippleKHR),
+        VK_HOOK_ENTRY(vkCmdBindDescriptorSets2KHR),
+        VK_HOOK_ENTRY(vkCmdPushConstants2KHR),
+        VK_HOOK_ENTRY(vkCmdPushDescriptorSet2KHR),
+        VK_HOOK_ENTRY(vkCmdPushDescriptorSetWithTemplate2KHR),
+        VK_HOOK_ENTRY(vkCmdSetDescriptorBufferOffsets2EXT),
+        VK_HOOK_ENTRY(vkCmdBindDescriptorBufferEmbeddedSamplers2EXT),
+        VK_HOOK_ENTRY(vkCmdDebugMarkerBeginEXT),
+        VK_HOOK_ENTRY(vkCmdDebugMarkerEndEXT),
+        VK_HOOK_ENTRY(vkCmdDebugMarkerInsertEXT),
+        VK_HOOK_ENTRY(vkCmdBindTransformFeedbackBuffersEXT),
+        VK_HOOK_ENTRY(vkCmdBeginTransformFeedbackEXT),
+        VK_HOOK_ENTRY(vkCmdEndTransformFeedbackEXT),
+        VK_HOOK_ENTRY(vkCmdBeginQueryIndexedEXT),
+        VK_HOOK_ENTRY(vkCmdEndQueryIndexedEXT),
+        VK_HOOK_ENTRY(vkCmdDrawIndirectByteCountEXT),
+        VK_HOOK_ENTRY(vkCmdCuLaunchKernelNVX),
+        VK_HOOK_ENTRY(vkCmdDrawIndirectCountAMD),
+        VK_HOOK_ENTRY(vkCmdDrawIndexedIndirectCountAMD),
+        VK_HOOK_ENTRY(vkCmdBeginConditionalRenderingEXT),
+        VK_HOOK_ENTRY(vkCmdEndConditionalRenderingEXT),
+        VK_HOOK_ENTRY(vkCmdSetViewportWScalingNV),
+        VK_HOOK_ENTRY(vkCmdSetDiscardRectangleEXT),
+        VK_HOOK_ENTRY(vkCmdSetDiscardRectangleEnableEXT),
+        VK_HOOK_ENTRY(vkCmdSetDiscardRectangleModeEXT),
+        VK_HOOK_ENTRY(vkCmdBeginDebugUtilsLabelEXT),
+        VK_HOOK_ENTRY(vkCmdEndDebugUtilsLabelEXT),
+        VK_HOOK_ENTRY(vkCmdInsertDebugUtilsLabelEXT),
+        VK_HOOK_ENTRY(vkCmdSetSampleLocationsEXT),
+        VK_HOOK_ENTRY(vkCmdBindShadingRateImageNV),
+        VK_HOOK_ENTRY(vkCmdSetViewportShadingRatePaletteNV),
+        VK_HOOK_ENTRY(vkCmdSetCoarseSampleOrderNV),
+        VK_HOOK_ENTRY(vkCmdBuildAccelerationStructureNV),
+        VK_HOOK_ENTRY(vkCmdCopyAccelerationStructureNV),
+        VK_HOOK_ENTRY(vkCmdTraceRaysNV),
+        VK_HOOK_ENTRY(vkCmdWriteAccelerationStructuresPropertiesNV),
+        VK_HOOK_ENTRY(vkCmdWriteBufferMarkerAMD),
+        VK_HOOK_ENTRY(vkCmdWriteBufferMarker2AMD),
+        VK_HOOK_ENTRY(vkCmdDrawMeshTasksNV),
+        VK_HOOK_ENTRY(vkCmdDrawMeshTasksIndirectNV),
+        VK_HOOK_ENTRY(vkCmdDrawMeshTasksIndirectCountNV),
+        VK_HOOK_ENTRY(vkCmdSetExclusiveScissorEnableNV),
+        VK_HOOK_ENTRY(vkCmdSetExclusiveScissorNV),
+        VK_HOOK_ENTRY(vkCmdSetCheckpointNV),
+        VK_HOOK_ENTRY(vkCmdSetPerformanceMarkerINTEL),
+        VK_HOOK_ENTRY(vkCmdSetPerformanceStreamMarkerINTEL),
+        VK_HOOK_ENTRY(vkCmdSetPerformanceOverrideINTEL),
+        VK_HOOK_ENTRY(vkCmdSetLineStippleEXT),
+        VK_HOOK_ENTRY(vkCmdSetCullModeEXT),
+        VK_HOOK_ENTRY(vkCmdSetFrontFaceEXT),
+        VK_HOOK_ENTRY(vkCmdSetPrimitiveTopologyEXT),
+        VK_HOOK_ENTRY(vkCmdSetViewportWithCountEXT),
+        VK_HOOK_ENTRY(vkCmdSetScissorWithCountEXT),
+        VK_HOOK_ENTRY(vkCmdBindVertexBuffers2EXT),
+        VK_HOOK_ENTRY(vkCmdSetDepthTestEnableEXT),
+        VK_HOOK_ENTRY(vkCmdSetDepthWriteEnableEXT),
+        VK_HOOK_ENTRY(vkCmdSetDepthCompareOpEXT),
+        VK_HOOK_ENTRY(vkCmdSetDepthBoundsTestEnableEXT),
+        VK_HOOK_ENTRY(vkCmdSetStencilTestEnableEXT),
+        VK_HOOK_ENTRY(vkCmdSetStencilOpEXT),
+        VK_HOOK_ENTRY(vkCmdPreprocessGeneratedCommandsNV),
+        VK_HOOK_ENTRY(vkCmdExecuteGeneratedCommandsNV),
+        VK_HOOK_ENTRY(vkCmdBindPipelineShaderGroupNV),
+        VK_HOOK_ENTRY(vkCmdSetDepthBias2EXT),
+        VK_HOOK_ENTRY(vkCmdCudaLaunchKernelNV),
+        VK_HOOK_ENTRY(vkCmdBindDescriptorBuffersEXT),
+        VK_HOOK_ENTRY(vkCmdSetDescriptorBufferOffsetsEXT),
+        VK_HOOK_ENTRY(vkCmdBindDescriptorBufferEmbeddedSamplersEXT),
+        VK_HOOK_ENTRY(vkCmdSetFragmentShadingRateEnumNV),
+        VK_HOOK_ENTRY(vkCmdSetVertexInputEXT),
+        VK_HOOK_ENTRY(vkCmdSubpassShadingHUAWEI),
+        VK_HOOK_ENTRY(vkCmdBindInvocationMaskHUAWEI),
+        VK_HOOK_ENTRY(vkCmdSetPatchControlPointsEXT),
+        VK_HOOK_ENTRY(vkCmdSetRasterizerDiscardEnableEXT),
+        VK_HOOK_ENTRY(vkCmdSetDepthBiasEnableEXT),
+        VK_HOOK_ENTRY(vkCmdSetLogicOpEXT),
+        VK_HOOK_ENTRY(vkCmdSetPrimitiveRestartEnableEXT),
+        VK_HOOK_ENTRY(vkCmdSetColorWriteEnableEXT),
+        VK_HOOK_ENTRY(vkCmdDrawMultiEXT),
+        VK_HOOK_ENTRY(vkCmdDrawMultiIndexedEXT),
+        VK_HOOK_ENTRY(vkCmdBuildMicromapsEXT),
+        VK_HOOK_ENTRY(vkCmdCopyMicromapEXT),
+        VK_HOOK_ENTRY(vkCmdCopyMicromapToMemoryEXT),
+        VK_HOOK_ENTRY(vkCmdCopyMemoryToMicromapEXT),
+        VK_HOOK_ENTRY(vkCmdWriteMicromapsPropertiesEXT),
+        VK_HOOK_ENTRY(vkCmdDrawClusterHUAWEI),
+        VK_HOOK_ENTRY(vkCmdDrawClusterIndirectHUAWEI),
+        VK_HOOK_ENTRY(vkCmdCopyMemoryIndirectNV),
+        VK_HOOK_ENTRY(vkCmdCopyMemoryToImageIndirectNV),
+        VK_HOOK_ENTRY(vkCmdDecompressMemoryNV),
+        VK_HOOK_ENTRY(vkCmdDecompressMemoryIndirectCountNV),
+        VK_HOOK_ENTRY(vkCmdUpdatePipelineIndirectBufferNV),
+        VK_HOOK_ENTRY(vkCmdSetDepthClampEnableEXT),
+        VK_HOOK_ENTRY(vkCmdSetPolygonModeEXT),
+        VK_HOOK_ENTRY(vkCmdSetRasterizationSamplesEXT),
+        VK_HOOK_ENTRY(vkCmdSetSampleMaskEXT),
+        VK_HOOK_ENTRY(vkCmdSetAlphaToCoverageEnableEXT),
+        VK_HOOK_ENTRY(vkCmdSetAlphaToOneEnableEXT),
+        VK_HOOK_ENTRY(vkCmdSetLogicOpEnableEXT),
+        VK_HOOK_ENTRY(vkCmdSetColorBlendEnableEXT),
+        VK_HOOK_ENTRY(vkCmdSetColorBlendEquationEXT),
+        VK_HOOK_ENTRY(vkCmdSetColorWriteMaskEXT),
+        VK_HOOK_ENTRY(vkCmdSetTessellationDomainOriginEXT),
+        VK_HOOK_ENTRY(vkCmdSetRasterizationStreamEXT),
+        VK_HOOK_ENTRY(vkCmdSetConservativeRasterizationModeEXT),
+        VK_HOOK_ENTRY(vkCmdSetExtraPrimitiveOverestimationSizeEXT),
+        VK_HOOK_ENTRY(vkCmdSetDepthClipEnableEXT),
+        VK_HOOK_ENTRY(vkCmdSetSampleLocationsEnableEXT),
+        VK_HOOK_ENTRY(vkCmdSetColorBlendAdvancedEXT),
+        VK_HOOK_ENTRY(vkCmdSetProvokingVertexModeEXT),
+        VK_HOOK_ENTRY(vkCmdSetLineRasterizationModeEXT),
+        VK_HOOK_ENTRY(vkCmdSetLineStippleEnableEXT),
+        VK_HOOK_ENTRY(vkCmdSetDepthClipNegativeOneToOneEXT),
+        VK_HOOK_ENTRY(vkCmdSetViewportWScalingEnableNV),
+        VK_HOOK_ENTRY(vkCmdSetViewportSwizzleNV),
+        VK_HOOK_ENTRY(vkCmdSetCoverageToColorEnableNV),
+        VK_HOOK_ENTRY(vkCmdSetCoverageToColorLocationNV),
+        VK_HOOK_ENTRY(vkCmdSetCoverageModulationModeNV),
+        VK_HOOK_ENTRY(vkCmdSetCoverageModulationTableEnableNV),
+        VK_HOOK_ENTRY(vkCmdSetCoverageModulationTableNV),
+        VK_HOOK_ENTRY(vkCmdSetShadingRateImageEnableNV),
+        VK_HOOK_ENTRY(vkCmdSetRepresentativeFragmentTestEnableNV),
+        VK_HOOK_ENTRY(vkCmdSetCoverageReductionModeNV),
+        VK_HOOK_ENTRY(vkCmdOpticalFlowExecuteNV),
+        VK_HOOK_ENTRY(vkCmdBindShadersEXT),
+        VK_HOOK_ENTRY(vkCmdSetDepthClampRangeEXT),
+        VK_HOOK_ENTRY(vkCmdConvertCooperativeVectorMatrixNV),
+        VK_HOOK_ENTRY(vkCmdSetAttachmentFeedbackLoopEnableEXT),
+        VK_HOOK_ENTRY(vkCmdBuildClusterAccelerationStructureIndirectNV),
+        VK_HOOK_ENTRY(vkCmdBuildPartitionedAccelerationStructuresNV),
+        VK_HOOK_ENTRY(vkCmdPreprocessGeneratedCommandsEXT),
+        VK_HOOK_ENTRY(vkCmdExecuteGeneratedCommandsEXT),
+        VK_HOOK_ENTRY(vkCmdBuildAccelerationStructuresKHR),
+        VK_HOOK_ENTRY(vkCmdBuildAccelerationStructuresIndirectKHR),
+        VK_HOOK_ENTRY(vkCmdCopyAccelerationStructureKHR),
+        VK_HOOK_ENTRY(vkCmdCopyAccelerationStructureToMemoryKHR),
+        VK_HOOK_ENTRY(vkCmdCopyMemoryToAccelerationStructureKHR),
+        VK_HOOK_ENTRY(vkCmdWriteAccelerationStructuresPropertiesKHR),
+        VK_HOOK_ENTRY(vkCmdTraceRaysKHR),
+        VK_HOOK_ENTRY(vkCmdTraceRaysIndirectKHR),
+        VK_HOOK_ENTRY(vkCmdSetRayTracingPipelineStackSizeKHR),
+        VK_HOOK_ENTRY(vkCmdDrawMeshTasksEXT),
+        VK_HOOK_ENTRY(vkCmdDrawMeshTasksIndirectEXT),
+        VK_HOOK_ENTRY(vkCmdDrawMeshTasksIndirectCountEXT),
+    });
+
+#undef VK_HOOK_ENTRY
+
+    static_assert(ProcTableIsUnique(hooks), "Duplicate Vulkan hook entry");
+
+    auto entry = FindProc(hooks, pName);
+
+    if (entry == nullptr)
+        return VK_NULL_HANDLE;
 
-    if (procName == std::string("vkQueueSubmit"))
-    {
-        // LOG_DEBUG("vkQueueSubmit");
+    return entry->resolve(original);
+}
 
-        if (o_vkQueueSubmit == nullptr)
-            o_vkQueueSubmit = (PFN_vkQueueSubmitL) original;
+void Vulkan_wDx12::InitializeStateTrackerFunctionTable()
+{
+    static bool initialized = false;
 
-        return (PFN_vkVoidFunction) hk_vkQueueSubmit;
-    }
-    if (procName == std::string("vkQueueSubmit2"))
-    {
-        // LOG_DEBUG("vkQueueSubmit2");
+    if (initialized)
+        return;
 
-        if (o_vkQueueSubmit2 == nullptr)
-            o_vkQueueSubmit2 = (PFN_vkQueueSubmit2L) original;
-
-        return (PFN_vkVoidFunction) hk_vkQueueSubmit2;
-    }
-    if (procName == std::string("vkQueueSubmit2KHR"))
-    {
-        // LOG_DEBUG("vkQueueSubmit2KHR");
-
-        if (o_vkQueueSubmit2KHR == nullptr)
-            o_vkQueueSubmit2KHR = (PFN_vkQueueSubmit2L) original;
-
-        return (PFN_vkVoidFunction) hk_vkQueueSubmit2KHR;
-    }
-    if (procName == std::string("vkBeginCommandBuffer"))
-    {
-        // LOG_DEBUG("vkBeginCommandBuffer");
-
-        if (o_vkBeginCommandBuffer == nullptr)
-            o_vkBeginCommandBuffer = (PFN_vkBeginCommandBuffer) original;
-
-        return (PFN_vkVoidFunction) hk_vkBeginCommandBuffer;
-    }
-    if (procName == std::string("vkEndCommandBuffer"))
-    {
-        // LOG_DEBUG("vkEndCommandBuffer");
-
-        if (o_vkEndCommandBuffer == nullptr)
-            o_vkEndCommandBuffer = (PFN_vkEndCommandBuffer) original;
-
-        return (PFN_vkVoidFunction) hk_vkEndCommandBuffer;
-    }
-    if (procName == std::string("vkResetCommandBuffer"))
-    {
-        // LOG_DEBUG("vkResetCommandBuffer");
-
-        if (o_vkResetCommandBuffer == nullptr)
-            o_vkResetCommandBuffer = (PFN_vkResetCommandBuffer) original;
-
-        return (PFN_vkVoidFunction) hk_vkResetCommandBuffer;
-    }
-    if (procName == std::string("vkCmdExecuteCommands"))
-    {
-        // LOG_DEBUG("vkCmdExecuteCommands");
-
-        if (o_vkCmdExecuteCommands == nullptr)
-            o_vkCmdExecuteCommands = (PFN_vkCmdExecuteCommands) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdExecuteCommands;
-    }
-    if (procName == std::string("vkCreateCommandPool"))
-    {
-        // LOG_DEBUG("vkCreateCommandPool");
-
-        if (o_vkCreateCommandPool == nullptr)
-            o_vkCreateCommandPool = (PFN_vkCreateCommandPool) original;
-
-        return (PFN_vkVoidFunction) hk_vkCreateCommandPool;
-    }
-    if (procName == std::string("vkFreeCommandBuffers"))
-    {
-        // LOG_DEBUG("vkFreeCommandBuffers");
-
-        if (o_vkFreeCommandBuffers == nullptr)
-            o_vkFreeCommandBuffers = (PFN_vkFreeCommandBuffers) original;
-
-        return (PFN_vkVoidFunction) hk_vkFreeCommandBuffers;
-    }
-    if (procName == std::string("vkResetCommandPool"))
-    {
-        // LOG_DEBUG("vkResetCommandPool");
-
-        if (o_vkResetCommandPool == nullptr)
-            o_vkResetCommandPool = (PFN_vkResetCommandPool) original;
-
-        return (PFN_vkVoidFunction) hk_vkResetCommandPool;
-    }
-    if (procName == std::string("vkAllocateCommandBuffers"))
-    {
-        // LOG_DEBUG("vkAllocateCommandBuffers");
-
-        if (o_vkAllocateCommandBuffers == nullptr)
-            o_vkAllocateCommandBuffers = (PFN_vkAllocateCommandBuffers) original;
-
-        return (PFN_vkVoidFunction) hk_vkAllocateCommandBuffers;
-    }
-    if (procName == std::string("vkDestroyCommandPool"))
-    {
-        // LOG_DEBUG("vkDestroyCommandPool");
-
-        if (o_vkDestroyCommandPool == nullptr)
-            o_vkDestroyCommandPool = (PFN_vkDestroyCommandPool) original;
-
-        return (PFN_vkVoidFunction) hk_vkDestroyCommandPool;
-    }
-    if (procName == std::string("vkCmdBindPipeline"))
-    {
-        // LOG_DEBUG("vkCmdBindPipeline");
-
-        if (o_vkCmdBindPipeline == nullptr)
-            o_vkCmdBindPipeline = (PFN_vkCmdBindPipeline) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdBindPipeline;
-    }
-    if (procName == std::string("vkCmdSetViewport"))
-    {
-        // LOG_DEBUG("vkCmdSetViewport");
-
-        if (o_vkCmdSetViewport == nullptr)
-            o_vkCmdSetViewport = (PFN_vkCmdSetViewport) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetViewport;
-    }
-    if (procName == std::string("vkCmdSetScissor"))
-    {
-        // LOG_DEBUG("vkCmdSetScissor");
-
-        if (o_vkCmdSetScissor == nullptr)
-            o_vkCmdSetScissor = (PFN_vkCmdSetScissor) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetScissor;
-    }
-    if (procName == std::string("vkCmdSetLineWidth"))
-    {
-        // LOG_DEBUG("vkCmdSetLineWidth");
-
-        if (o_vkCmdSetLineWidth == nullptr)
-            o_vkCmdSetLineWidth = (PFN_vkCmdSetLineWidth) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetLineWidth;
-    }
-    if (procName == std::string("vkCmdSetDepthBias"))
-    {
-        // LOG_DEBUG("vkCmdSetDepthBias");
-
-        if (o_vkCmdSetDepthBias == nullptr)
-            o_vkCmdSetDepthBias = (PFN_vkCmdSetDepthBias) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetDepthBias;
-    }
-    if (procName == std::string("vkCmdSetBlendConstants"))
-    {
-        // LOG_DEBUG("vkCmdSetBlendConstants");
-
-        if (o_vkCmdSetBlendConstants == nullptr)
-            o_vkCmdSetBlendConstants = (PFN_vkCmdSetBlendConstants) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetBlendConstants;
-    }
-    if (procName == std::string("vkCmdSetDepthBounds"))
-    {
-        // LOG_DEBUG("vkCmdSetDepthBounds");
-
-        if (o_vkCmdSetDepthBounds == nullptr)
-            o_vkCmdSetDepthBounds = (PFN_vkCmdSetDepthBounds) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetDepthBounds;
-    }
-    if (procName == std::string("vkCmdSetStencilCompareMask"))
-    {
-        // LOG_DEBUG("vkCmdSetStencilCompareMask");
-
-        if (o_vkCmdSetStencilCompareMask == nullptr)
-            o_vkCmdSetStencilCompareMask = (PFN_vkCmdSetStencilCompareMask) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetStencilCompareMask;
-    }
-    if (procName == std::string("vkCmdSetStencilWriteMask"))
-    {
-        // LOG_DEBUG("vkCmdSetStencilWriteMask");
-
-        if (o_vkCmdSetStencilWriteMask == nullptr)
-            o_vkCmdSetStencilWriteMask = (PFN_vkCmdSetStencilWriteMask) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetStencilWriteMask;
-    }
-    if (procName == std::string("vkCmdSetStencilReference"))
-    {
-        // LOG_DEBUG("vkCmdSetStencilReference");
-
-        if (o_vkCmdSetStencilReference == nullptr)
-            o_vkCmdSetStencilReference = (PFN_vkCmdSetStencilReference) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetStencilReference;
-    }
-    if (procName == std::string("vkCmdBindDescriptorSets"))
-    {
-        // LOG_DEBUG("vkCmdBindDescriptorSets");
-
-        if (o_vkCmdBindDescriptorSets == nullptr)
-            o_vkCmdBindDescriptorSets = (PFN_vkCmdBindDescriptorSets) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdBindDescriptorSets;
-    }
-    if (procName == std::string("vkCmdBindIndexBuffer"))
-    {
-        // LOG_DEBUG("vkCmdBindIndexBuffer");
-
-        if (o_vkCmdBindIndexBuffer == nullptr)
-            o_vkCmdBindIndexBuffer = (PFN_vkCmdBindIndexBuffer) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdBindIndexBuffer;
-    }
-    if (procName == std::string("vkCmdBindVertexBuffers"))
-    {
-        // LOG_DEBUG("vkCmdBindVertexBuffers");
-
-        if (o_vkCmdBindVertexBuffers == nullptr)
-            o_vkCmdBindVertexBuffers = (PFN_vkCmdBindVertexBuffers) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdBindVertexBuffers;
-    }
-    if (procName == std::string("vkCmdDraw"))
-    {
-        // LOG_DEBUG("vkCmdDraw");
-
-        if (o_vkCmdDraw == nullptr)
-            o_vkCmdDraw = (PFN_vkCmdDraw) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdDraw;
-    }
-    if (procName == std::string("vkCmdDrawIndexed"))
-    {
-        // LOG_DEBUG("vkCmdDrawIndexed");
-
-        if (o_vkCmdDrawIndexed == nullptr)
-            o_vkCmdDrawIndexed = (PFN_vkCmdDrawIndexed) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdDrawIndexed;
-    }
-    if (procName == std::string("vkCmdDrawIndirect"))
-    {
-        // LOG_DEBUG("vkCmdDrawIndirect");
-
-        if (o_vkCmdDrawIndirect == nullptr)
-            o_vkCmdDrawIndirect = (PFN_vkCmdDrawIndirect) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdDrawIndirect;
-    }
-    if (procName == std::string("vkCmdDrawIndexedIndirect"))
-    {
-        // LOG_DEBUG("vkCmdDrawIndexedIndirect");
-
-        if (o_vkCmdDrawIndexedIndirect == nullptr)
-            o_vkCmdDrawIndexedIndirect = (PFN_vkCmdDrawIndexedIndirect) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdDrawIndexedIndirect;
-    }
-    if (procName == std::string("vkCmdDispatch"))
-    {
-        // LOG_DEBUG("vkCmdDispatch");
-
-        if (o_vkCmdDispatch == nullptr)
-            o_vkCmdDispatch = (PFN_vkCmdDispatch) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdDispatch;
-    }
-    if (procName == std::string("vkCmdDispatchIndirect"))
-    {
-        // LOG_DEBUG("vkCmdDispatchIndirect");
-
-        if (o_vkCmdDispatchIndirect == nullptr)
-            o_vkCmdDispatchIndirect = (PFN_vkCmdDispatchIndirect) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdDispatchIndirect;
-    }
-    if (procName == std::string("vkCmdCopyBuffer"))
-    {
-        // LOG_DEBUG("vkCmdCopyBuffer");
-
-        if (o_vkCmdCopyBuffer == nullptr)
-            o_vkCmdCopyBuffer = (PFN_vkCmdCopyBuffer) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdCopyBuffer;
-    }
-    if (procName == std::string("vkCmdCopyImage"))
-    {
-        // LOG_DEBUG("vkCmdCopyImage");
-
-        if (o_vkCmdCopyImage == nullptr)
-            o_vkCmdCopyImage = (PFN_vkCmdCopyImage) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdCopyImage;
-    }
-    if (procName == std::string("vkCmdBlitImage"))
-    {
-        // LOG_DEBUG("vkCmdBlitImage");
-
-        if (o_vkCmdBlitImage == nullptr)
-            o_vkCmdBlitImage = (PFN_vkCmdBlitImage) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdBlitImage;
-    }
-    if (procName == std::string("vkCmdCopyBufferToImage"))
-    {
-        // LOG_DEBUG("vkCmdCopyBufferToImage");
-
-        if (o_vkCmdCopyBufferToImage == nullptr)
-            o_vkCmdCopyBufferToImage = (PFN_vkCmdCopyBufferToImage) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdCopyBufferToImage;
-    }
-    if (procName == std::string("vkCmdCopyImageToBuffer"))
-    {
-        // LOG_DEBUG("vkCmdCopyImageToBuffer");
-
-        if (o_vkCmdCopyImageToBuffer == nullptr)
-            o_vkCmdCopyImageToBuffer = (PFN_vkCmdCopyImageToBuffer) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdCopyImageToBuffer;
-    }
-    if (procName == std::string("vkCmdUpdateBuffer"))
-    {
-        // LOG_DEBUG("vkCmdUpdateBuffer");
-
-        if (o_vkCmdUpdateBuffer == nullptr)
-            o_vkCmdUpdateBuffer = (PFN_vkCmdUpdateBuffer) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdUpdateBuffer;
-    }
-    if (procName == std::string("vkCmdFillBuffer"))
-    {
-        // LOG_DEBUG("vkCmdFillBuffer");
-
-        if (o_vkCmdFillBuffer == nullptr)
-            o_vkCmdFillBuffer = (PFN_vkCmdFillBuffer) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdFillBuffer;
-    }
-    if (procName == std::string("vkCmdClearColorImage"))
-    {
-        // LOG_DEBUG("vkCmdClearColorImage");
-
-        if (o_vkCmdClearColorImage == nullptr)
-            o_vkCmdClearColorImage = (PFN_vkCmdClearColorImage) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdClearColorImage;
-    }
-    if (procName == std::string("vkCmdClearDepthStencilImage"))
-    {
-        // LOG_DEBUG("vkCmdClearDepthStencilImage");
-
-        if (o_vkCmdClearDepthStencilImage == nullptr)
-            o_vkCmdClearDepthStencilImage = (PFN_vkCmdClearDepthStencilImage) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdClearDepthStencilImage;
-    }
-    if (procName == std::string("vkCmdClearAttachments"))
-    {
-        // LOG_DEBUG("vkCmdClearAttachments");
-
-        if (o_vkCmdClearAttachments == nullptr)
-            o_vkCmdClearAttachments = (PFN_vkCmdClearAttachments) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdClearAttachments;
-    }
-    if (procName == std::string("vkCmdResolveImage"))
-    {
-        // LOG_DEBUG("vkCmdResolveImage");
-
-        if (o_vkCmdResolveImage == nullptr)
-            o_vkCmdResolveImage = (PFN_vkCmdResolveImage) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdResolveImage;
-    }
-    if (procName == std::string("vkCmdSetEvent"))
-    {
-        // LOG_DEBUG("vkCmdSetEvent");
-
-        if (o_vkCmdSetEvent == nullptr)
-            o_vkCmdSetEvent = (PFN_vkCmdSetEvent) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetEvent;
-    }
-    if (procName == std::string("vkCmdResetEvent"))
-    {
-        // LOG_DEBUG("vkCmdResetEvent");
-
-        if (o_vkCmdResetEvent == nullptr)
-            o_vkCmdResetEvent = (PFN_vkCmdResetEvent) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdResetEvent;
-    }
-    if (procName == std::string("vkCmdWaitEvents"))
-    {
-        // LOG_DEBUG("vkCmdWaitEvents");
-
-        if (o_vkCmdWaitEvents == nullptr)
-            o_vkCmdWaitEvents = (PFN_vkCmdWaitEvents) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdWaitEvents;
-    }
-    if (procName == std::string("vkCmdPipelineBarrier"))
-    {
-        // LOG_DEBUG("vkCmdPipelineBarrier");
-
-        if (o_vkCmdPipelineBarrier == nullptr)
-            o_vkCmdPipelineBarrier = (PFN_vkCmdPipelineBarrier) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdPipelineBarrier;
-    }
-    if (procName == std::string("vkCmdBeginQuery"))
-    {
-        // LOG_DEBUG("vkCmdBeginQuery");
-
-        if (o_vkCmdBeginQuery == nullptr)
-            o_vkCmdBeginQuery = (PFN_vkCmdBeginQuery) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdBeginQuery;
-    }
-    if (procName == std::string("vkCmdEndQuery"))
-    {
-        // LOG_DEBUG("vkCmdEndQuery");
-
-        if (o_vkCmdEndQuery == nullptr)
-            o_vkCmdEndQuery = (PFN_vkCmdEndQuery) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdEndQuery;
-    }
-    if (procName == std::string("vkCmdResetQueryPool"))
-    {
-        // LOG_DEBUG("vkCmdResetQueryPool");
-
-        if (o_vkCmdResetQueryPool == nullptr)
-            o_vkCmdResetQueryPool = (PFN_vkCmdResetQueryPool) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdResetQueryPool;
-    }
-    if (procName == std::string("vkCmdWriteTimestamp"))
-    {
-        // LOG_DEBUG("vkCmdWriteTimestamp");
-
-        if (o_vkCmdWriteTimestamp == nullptr)
-            o_vkCmdWriteTimestamp = (PFN_vkCmdWriteTimestamp) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdWriteTimestamp;
-    }
-    if (procName == std::string("vkCmdCopyQueryPoolResults"))
-    {
-        // LOG_DEBUG("vkCmdCopyQueryPoolResults");
-
-        if (o_vkCmdCopyQueryPoolResults == nullptr)
-            o_vkCmdCopyQueryPoolResults = (PFN_vkCmdCopyQueryPoolResults) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdCopyQueryPoolResults;
-    }
-    if (procName == std::string("vkCmdPushConstants"))
-    {
-        // LOG_DEBUG("vkCmdPushConstants");
-
-        if (o_vkCmdPushConstants == nullptr)
-            o_vkCmdPushConstants = (PFN_vkCmdPushConstants) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdPushConstants;
-    }
-    if (procName == std::string("vkCmdBeginRenderPass"))
-    {
-        // LOG_DEBUG("vkCmdBeginRenderPass");
-
-        if (o_vkCmdBeginRenderPass == nullptr)
-            o_vkCmdBeginRenderPass = (PFN_vkCmdBeginRenderPass) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdBeginRenderPass;
-    }
-    if (procName == std::string("vkCmdNextSubpass"))
-    {
-        // LOG_DEBUG("vkCmdNextSubpass");
-
-        if (o_vkCmdNextSubpass == nullptr)
-            o_vkCmdNextSubpass = (PFN_vkCmdNextSubpass) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdNextSubpass;
-    }
-    if (procName == std::string("vkCmdEndRenderPass"))
-    {
-        // LOG_DEBUG("vkCmdEndRenderPass");
-
-        if (o_vkCmdEndRenderPass == nullptr)
-            o_vkCmdEndRenderPass = (PFN_vkCmdEndRenderPass) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdEndRenderPass;
-    }
-    if (procName == std::string("vkCmdSetDeviceMask"))
-    {
-        // LOG_DEBUG("vkCmdSetDeviceMask");
-
-        if (o_vkCmdSetDeviceMask == nullptr)
-            o_vkCmdSetDeviceMask = (PFN_vkCmdSetDeviceMask) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetDeviceMask;
-    }
-    if (procName == std::string("vkCmdDispatchBase"))
-    {
-        // LOG_DEBUG("vkCmdDispatchBase");
-
-        if (o_vkCmdDispatchBase == nullptr)
-            o_vkCmdDispatchBase = (PFN_vkCmdDispatchBase) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdDispatchBase;
-    }
-    if (procName == std::string("vkCmdDrawIndirectCount"))
-    {
-        // LOG_DEBUG("vkCmdDrawIndirectCount");
-
-        if (o_vkCmdDrawIndirectCount == nullptr)
-            o_vkCmdDrawIndirectCount = (PFN_vkCmdDrawIndirectCount) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdDrawIndirectCount;
-    }
-    if (procName == std::string("vkCmdDrawIndexedIndirectCount"))
-    {
-        // LOG_DEBUG("vkCmdDrawIndexedIndirectCount");
-
-        if (o_vkCmdDrawIndexedIndirectCount == nullptr)
-            o_vkCmdDrawIndexedIndirectCount = (PFN_vkCmdDrawIndexedIndirectCount) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdDrawIndexedIndirectCount;
-    }
-    if (procName == std::string("vkCmdBeginRenderPass2"))
-    {
-        // LOG_DEBUG("vkCmdBeginRenderPass2");
-
-        if (o_vkCmdBeginRenderPass2 == nullptr)
-            o_vkCmdBeginRenderPass2 = (PFN_vkCmdBeginRenderPass2) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdBeginRenderPass2;
-    }
-    if (procName == std::string("vkCmdNextSubpass2"))
-    {
-        // LOG_DEBUG("vkCmdNextSubpass2");
-
-        if (o_vkCmdNextSubpass2 == nullptr)
-            o_vkCmdNextSubpass2 = (PFN_vkCmdNextSubpass2) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdNextSubpass2;
-    }
-    if (procName == std::string("vkCmdEndRenderPass2"))
-    {
-        // LOG_DEBUG("vkCmdEndRenderPass2");
-
-        if (o_vkCmdEndRenderPass2 == nullptr)
-            o_vkCmdEndRenderPass2 = (PFN_vkCmdEndRenderPass2) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdEndRenderPass2;
-    }
-    if (procName == std::string("vkCmdSetEvent2"))
-    {
-        // LOG_DEBUG("vkCmdSetEvent2");
-
-        if (o_vkCmdSetEvent2 == nullptr)
-            o_vkCmdSetEvent2 = (PFN_vkCmdSetEvent2) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetEvent2;
-    }
-    if (procName == std::string("vkCmdResetEvent2"))
-    {
-        // LOG_DEBUG("vkCmdResetEvent2");
-
-        if (o_vkCmdResetEvent2 == nullptr)
-            o_vkCmdResetEvent2 = (PFN_vkCmdResetEvent2) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdResetEvent2;
-    }
-    if (procName == std::string("vkCmdWaitEvents2"))
-    {
-        // LOG_DEBUG("vkCmdWaitEvents2");
-
-        if (o_vkCmdWaitEvents2 == nullptr)
-            o_vkCmdWaitEvents2 = (PFN_vkCmdWaitEvents2) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdWaitEvents2;
-    }
-    if (procName == std::string("vkCmdPipelineBarrier2"))
-    {
-        // LOG_DEBUG("vkCmdPipelineBarrier2");
-
-        if (o_vkCmdPipelineBarrier2 == nullptr)
-            o_vkCmdPipelineBarrier2 = (PFN_vkCmdPipelineBarrier2) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdPipelineBarrier2;
-    }
-    if (procName == std::string("vkCmdWriteTimestamp2"))
-    {
-        // LOG_DEBUG("vkCmdWriteTimestamp2");
-
-        if (o_vkCmdWriteTimestamp2 == nullptr)
-            o_vkCmdWriteTimestamp2 = (PFN_vkCmdWriteTimestamp2) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdWriteTimestamp2;
-    }
-    if (procName == std::string("vkCmdCopyBuffer2"))
-    {
-        // LOG_DEBUG("vkCmdCopyBuffer2");
-
-        if (o_vkCmdCopyBuffer2 == nullptr)
-            o_vkCmdCopyBuffer2 = (PFN_vkCmdCopyBuffer2) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdCopyBuffer2;
-    }
-    if (procName == std::string("vkCmdCopyImage2"))
-    {
-        // LOG_DEBUG("vkCmdCopyImage2");
-
-        if (o_vkCmdCopyImage2 == nullptr)
-            o_vkCmdCopyImage2 = (PFN_vkCmdCopyImage2) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdCopyImage2;
-    }
-    if (procName == std::string("vkCmdCopyBufferToImage2"))
-    {
-        // LOG_DEBUG("vkCmdCopyBufferToImage2");
-
-        if (o_vkCmdCopyBufferToImage2 == nullptr)
-            o_vkCmdCopyBufferToImage2 = (PFN_vkCmdCopyBufferToImage2) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdCopyBufferToImage2;
-    }
-    if (procName == std::string("vkCmdCopyImageToBuffer2"))
-    {
-        // LOG_DEBUG("vkCmdCopyImageToBuffer2");
-
-        if (o_vkCmdCopyImageToBuffer2 == nullptr)
-            o_vkCmdCopyImageToBuffer2 = (PFN_vkCmdCopyImageToBuffer2) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdCopyImageToBuffer2;
-    }
-    if (procName == std::string("vkCmdBlitImage2"))
-    {
-        // LOG_DEBUG("vkCmdBlitImage2");
-
-        if (o_vkCmdBlitImage2 == nullptr)
-            o_vkCmdBlitImage2 = (PFN_vkCmdBlitImage2) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdBlitImage2;
-    }
-    if (procName == std::string("vkCmdResolveImage2"))
-    {
-        // LOG_DEBUG("vkCmdResolveImage2");
-
-        if (o_vkCmdResolveImage2 == nullptr)
-            o_vkCmdResolveImage2 = (PFN_vkCmdResolveImage2) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdResolveImage2;
-    }
-    if (procName == std::string("vkCmdBeginRendering"))
-    {
-        // LOG_DEBUG("vkCmdBeginRendering");
-
-        if (o_vkCmdBeginRendering == nullptr)
-            o_vkCmdBeginRendering = (PFN_vkCmdBeginRendering) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdBeginRendering;
-    }
-    if (procName == std::string("vkCmdEndRendering"))
-    {
-        // LOG_DEBUG("vkCmdEndRendering");
-
-        if (o_vkCmdEndRendering == nullptr)
-            o_vkCmdEndRendering = (PFN_vkCmdEndRendering) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdEndRendering;
-    }
-    if (procName == std::string("vkCmdSetCullMode"))
-    {
-        // LOG_DEBUG("vkCmdSetCullMode");
-
-        if (o_vkCmdSetCullMode == nullptr)
-            o_vkCmdSetCullMode = (PFN_vkCmdSetCullMode) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetCullMode;
-    }
-    if (procName == std::string("vkCmdSetFrontFace"))
-    {
-        // LOG_DEBUG("vkCmdSetFrontFace");
-
-        if (o_vkCmdSetFrontFace == nullptr)
-            o_vkCmdSetFrontFace = (PFN_vkCmdSetFrontFace) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetFrontFace;
-    }
-    if (procName == std::string("vkCmdSetPrimitiveTopology"))
-    {
-        // LOG_DEBUG("vkCmdSetPrimitiveTopology");
-
-        if (o_vkCmdSetPrimitiveTopology == nullptr)
-            o_vkCmdSetPrimitiveTopology = (PFN_vkCmdSetPrimitiveTopology) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetPrimitiveTopology;
-    }
-    if (procName == std::string("vkCmdSetViewportWithCount"))
-    {
-        // LOG_DEBUG("vkCmdSetViewportWithCount");
-
-        if (o_vkCmdSetViewportWithCount == nullptr)
-            o_vkCmdSetViewportWithCount = (PFN_vkCmdSetViewportWithCount) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetViewportWithCount;
-    }
-    if (procName == std::string("vkCmdSetScissorWithCount"))
-    {
-        // LOG_DEBUG("vkCmdSetScissorWithCount");
-
-        if (o_vkCmdSetScissorWithCount == nullptr)
-            o_vkCmdSetScissorWithCount = (PFN_vkCmdSetScissorWithCount) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetScissorWithCount;
-    }
-    if (procName == std::string("vkCmdBindVertexBuffers2"))
-    {
-        // LOG_DEBUG("vkCmdBindVertexBuffers2");
-
-        if (o_vkCmdBindVertexBuffers2 == nullptr)
-            o_vkCmdBindVertexBuffers2 = (PFN_vkCmdBindVertexBuffers2) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdBindVertexBuffers2;
-    }
-    if (procName == std::string("vkCmdSetDepthTestEnable"))
-    {
-        // LOG_DEBUG("vkCmdSetDepthTestEnable");
-
-        if (o_vkCmdSetDepthTestEnable == nullptr)
-            o_vkCmdSetDepthTestEnable = (PFN_vkCmdSetDepthTestEnable) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetDepthTestEnable;
-    }
-    if (procName == std::string("vkCmdSetDepthWriteEnable"))
-    {
-        // LOG_DEBUG("vkCmdSetDepthWriteEnable");
-
-        if (o_vkCmdSetDepthWriteEnable == nullptr)
-            o_vkCmdSetDepthWriteEnable = (PFN_vkCmdSetDepthWriteEnable) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetDepthWriteEnable;
-    }
-    if (procName == std::string("vkCmdSetDepthCompareOp"))
-    {
-        // LOG_DEBUG("vkCmdSetDepthCompareOp");
-
-        if (o_vkCmdSetDepthCompareOp == nullptr)
-            o_vkCmdSetDepthCompareOp = (PFN_vkCmdSetDepthCompareOp) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetDepthCompareOp;
-    }
-    if (procName == std::string("vkCmdSetDepthBoundsTestEnable"))
-    {
-        // LOG_DEBUG("vkCmdSetDepthBoundsTestEnable");
-
-        if (o_vkCmdSetDepthBoundsTestEnable == nullptr)
-            o_vkCmdSetDepthBoundsTestEnable = (PFN_vkCmdSetDepthBoundsTestEnable) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetDepthBoundsTestEnable;
-    }
-    if (procName == std::string("vkCmdSetStencilTestEnable"))
-    {
-        // LOG_DEBUG("vkCmdSetStencilTestEnable");
-
-        if (o_vkCmdSetStencilTestEnable == nullptr)
-            o_vkCmdSetStencilTestEnable = (PFN_vkCmdSetStencilTestEnable) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetStencilTestEnable;
-    }
-    if (procName == std::string("vkCmdSetStencilOp"))
-    {
-        // LOG_DEBUG("vkCmdSetStencilOp");
-
-        if (o_vkCmdSetStencilOp == nullptr)
-            o_vkCmdSetStencilOp = (PFN_vkCmdSetStencilOp) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetStencilOp;
-    }
-    if (procName == std::string("vkCmdSetRasterizerDiscardEnable"))
-    {
-        // LOG_DEBUG("vkCmdSetRasterizerDiscardEnable");
-
-        if (o_vkCmdSetRasterizerDiscardEnable == nullptr)
-            o_vkCmdSetRasterizerDiscardEnable = (PFN_vkCmdSetRasterizerDiscardEnable) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetRasterizerDiscardEnable;
-    }
-    if (procName == std::string("vkCmdSetDepthBiasEnable"))
-    {
-        // LOG_DEBUG("vkCmdSetDepthBiasEnable");
-
-        if (o_vkCmdSetDepthBiasEnable == nullptr)
-            o_vkCmdSetDepthBiasEnable = (PFN_vkCmdSetDepthBiasEnable) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetDepthBiasEnable;
-    }
-    if (procName == std::string("vkCmdSetPrimitiveRestartEnable"))
-    {
-        // LOG_DEBUG("vkCmdSetPrimitiveRestartEnable");
-
-        if (o_vkCmdSetPrimitiveRestartEnable == nullptr)
-            o_vkCmdSetPrimitiveRestartEnable = (PFN_vkCmdSetPrimitiveRestartEnable) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetPrimitiveRestartEnable;
-    }
-    if (procName == std::string("vkCmdSetLineStipple"))
-    {
-        // LOG_DEBUG("vkCmdSetLineStipple");
-
-        if (o_vkCmdSetLineStipple == nullptr)
-            o_vkCmdSetLineStipple = (PFN_vkCmdSetLineStipple) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetLineStipple;
-    }
-    if (procName == std::string("vkCmdBindIndexBuffer2"))
-    {
-        // LOG_DEBUG("vkCmdBindIndexBuffer2");
-
-        if (o_vkCmdBindIndexBuffer2 == nullptr)
-            o_vkCmdBindIndexBuffer2 = (PFN_vkCmdBindIndexBuffer2) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdBindIndexBuffer2;
-    }
-    if (procName == std::string("vkCmdPushDescriptorSet"))
-    {
-        // LOG_DEBUG("vkCmdPushDescriptorSet");
-
-        if (o_vkCmdPushDescriptorSet == nullptr)
-            o_vkCmdPushDescriptorSet = (PFN_vkCmdPushDescriptorSet) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdPushDescriptorSet;
-    }
-    if (procName == std::string("vkCmdPushDescriptorSetWithTemplate"))
-    {
-        // LOG_DEBUG("vkCmdPushDescriptorSetWithTemplate");
-
-        if (o_vkCmdPushDescriptorSetWithTemplate == nullptr)
-            o_vkCmdPushDescriptorSetWithTemplate = (PFN_vkCmdPushDescriptorSetWithTemplate) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdPushDescriptorSetWithTemplate;
-    }
-    if (procName == std::string("vkCmdSetRenderingAttachmentLocations"))
-    {
-        // LOG_DEBUG("vkCmdSetRenderingAttachmentLocations");
-
-        if (o_vkCmdSetRenderingAttachmentLocations == nullptr)
-            o_vkCmdSetRenderingAttachmentLocations = (PFN_vkCmdSetRenderingAttachmentLocations) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetRenderingAttachmentLocations;
-    }
-    if (procName == std::string("vkCmdSetRenderingInputAttachmentIndices"))
-    {
-        // LOG_DEBUG("vkCmdSetRenderingInputAttachmentIndices");
-
-        if (o_vkCmdSetRenderingInputAttachmentIndices == nullptr)
-            o_vkCmdSetRenderingInputAttachmentIndices = (PFN_vkCmdSetRenderingInputAttachmentIndices) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetRenderingInputAttachmentIndices;
-    }
-    if (procName == std::string("vkCmdBindDescriptorSets2"))
-    {
-        // LOG_DEBUG("vkCmdBindDescriptorSets2");
-
-        if (o_vkCmdBindDescriptorSets2 == nullptr)
-            o_vkCmdBindDescriptorSets2 = (PFN_vkCmdBindDescriptorSets2) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdBindDescriptorSets2;
-    }
-    if (procName == std::string("vkCmdPushConstants2"))
-    {
-        // LOG_DEBUG("vkCmdPushConstants2");
-
-        if (o_vkCmdPushConstants2 == nullptr)
-            o_vkCmdPushConstants2 = (PFN_vkCmdPushConstants2) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdPushConstants2;
-    }
-    if (procName == std::string("vkCmdPushDescriptorSet2"))
-    {
-        // LOG_DEBUG("vkCmdPushDescriptorSet2");
-
-        if (o_vkCmdPushDescriptorSet2 == nullptr)
-            o_vkCmdPushDescriptorSet2 = (PFN_vkCmdPushDescriptorSet2) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdPushDescriptorSet2;
-    }
-    if (procName == std::string("vkCmdPushDescriptorSetWithTemplate2"))
-    {
-        // LOG_DEBUG("vkCmdPushDescriptorSetWithTemplate2");
-
-        if (o_vkCmdPushDescriptorSetWithTemplate2 == nullptr)
-            o_vkCmdPushDescriptorSetWithTemplate2 = (PFN_vkCmdPushDescriptorSetWithTemplate2) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdPushDescriptorSetWithTemplate2;
-    }
-    if (procName == std::string("vkCmdBeginVideoCodingKHR"))
-    {
-        // LOG_DEBUG("vkCmdBeginVideoCodingKHR");
-
-        if (o_vkCmdBeginVideoCodingKHR == nullptr)
-            o_vkCmdBeginVideoCodingKHR = (PFN_vkCmdBeginVideoCodingKHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdBeginVideoCodingKHR;
-    }
-    if (procName == std::string("vkCmdEndVideoCodingKHR"))
-    {
-        // LOG_DEBUG("vkCmdEndVideoCodingKHR");
-
-        if (o_vkCmdEndVideoCodingKHR == nullptr)
-            o_vkCmdEndVideoCodingKHR = (PFN_vkCmdEndVideoCodingKHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdEndVideoCodingKHR;
-    }
-    if (procName == std::string("vkCmdControlVideoCodingKHR"))
-    {
-        // LOG_DEBUG("vkCmdControlVideoCodingKHR");
-
-        if (o_vkCmdControlVideoCodingKHR == nullptr)
-            o_vkCmdControlVideoCodingKHR = (PFN_vkCmdControlVideoCodingKHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdControlVideoCodingKHR;
-    }
-    if (procName == std::string("vkCmdDecodeVideoKHR"))
-    {
-        // LOG_DEBUG("vkCmdDecodeVideoKHR");
-
-        if (o_vkCmdDecodeVideoKHR == nullptr)
-            o_vkCmdDecodeVideoKHR = (PFN_vkCmdDecodeVideoKHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdDecodeVideoKHR;
-    }
-    if (procName == std::string("vkCmdBeginRenderingKHR"))
-    {
-        // LOG_DEBUG("vkCmdBeginRenderingKHR");
-
-        if (o_vkCmdBeginRenderingKHR == nullptr)
-            o_vkCmdBeginRenderingKHR = (PFN_vkCmdBeginRenderingKHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdBeginRenderingKHR;
-    }
-    if (procName == std::string("vkCmdEndRenderingKHR"))
-    {
-        // LOG_DEBUG("vkCmdEndRenderingKHR");
-
-        if (o_vkCmdEndRenderingKHR == nullptr)
-            o_vkCmdEndRenderingKHR = (PFN_vkCmdEndRenderingKHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdEndRenderingKHR;
-    }
-    if (procName == std::string("vkCmdSetDeviceMaskKHR"))
-    {
-        // LOG_DEBUG("vkCmdSetDeviceMaskKHR");
-
-        if (o_vkCmdSetDeviceMaskKHR == nullptr)
-            o_vkCmdSetDeviceMaskKHR = (PFN_vkCmdSetDeviceMaskKHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetDeviceMaskKHR;
-    }
-    if (procName == std::string("vkCmdDispatchBaseKHR"))
-    {
-        // LOG_DEBUG("vkCmdDispatchBaseKHR");
-
-        if (o_vkCmdDispatchBaseKHR == nullptr)
-            o_vkCmdDispatchBaseKHR = (PFN_vkCmdDispatchBaseKHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdDispatchBaseKHR;
-    }
-    if (procName == std::string("vkCmdPushDescriptorSetKHR"))
-    {
-        // LOG_DEBUG("vkCmdPushDescriptorSetKHR");
-
-        if (o_vkCmdPushDescriptorSetKHR == nullptr)
-            o_vkCmdPushDescriptorSetKHR = (PFN_vkCmdPushDescriptorSetKHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdPushDescriptorSetKHR;
-    }
-    if (procName == std::string("vkCmdPushDescriptorSetWithTemplateKHR"))
-    {
-        // LOG_DEBUG("vkCmdPushDescriptorSetWithTemplateKHR");
-
-        if (o_vkCmdPushDescriptorSetWithTemplateKHR == nullptr)
-            o_vkCmdPushDescriptorSetWithTemplateKHR = (PFN_vkCmdPushDescriptorSetWithTemplateKHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdPushDescriptorSetWithTemplateKHR;
-    }
-    if (procName == std::string("vkCmdBeginRenderPass2KHR"))
-    {
-        // LOG_DEBUG("vkCmdBeginRenderPass2KHR");
-
-        if (o_vkCmdBeginRenderPass2KHR == nullptr)
-            o_vkCmdBeginRenderPass2KHR = (PFN_vkCmdBeginRenderPass2KHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdBeginRenderPass2KHR;
-    }
-    if (procName == std::string("vkCmdNextSubpass2KHR"))
-    {
-        // LOG_DEBUG("vkCmdNextSubpass2KHR");
-
-        if (o_vkCmdNextSubpass2KHR == nullptr)
-            o_vkCmdNextSubpass2KHR = (PFN_vkCmdNextSubpass2KHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdNextSubpass2KHR;
-    }
-    if (procName == std::string("vkCmdEndRenderPass2KHR"))
-    {
-        // LOG_DEBUG("vkCmdEndRenderPass2KHR");
-
-        if (o_vkCmdEndRenderPass2KHR == nullptr)
-            o_vkCmdEndRenderPass2KHR = (PFN_vkCmdEndRenderPass2KHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdEndRenderPass2KHR;
-    }
-    if (procName == std::string("vkCmdDrawIndirectCountKHR"))
-    {
-        // LOG_DEBUG("vkCmdDrawIndirectCountKHR");
-
-        if (o_vkCmdDrawIndirectCountKHR == nullptr)
-            o_vkCmdDrawIndirectCountKHR = (PFN_vkCmdDrawIndirectCountKHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdDrawIndirectCountKHR;
-    }
-    if (procName == std::string("vkCmdDrawIndexedIndirectCountKHR"))
-    {
-        // LOG_DEBUG("vkCmdDrawIndexedIndirectCountKHR");
-
-        if (o_vkCmdDrawIndexedIndirectCountKHR == nullptr)
-            o_vkCmdDrawIndexedIndirectCountKHR = (PFN_vkCmdDrawIndexedIndirectCountKHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdDrawIndexedIndirectCountKHR;
-    }
-    if (procName == std::string("vkCmdSetFragmentShadingRateKHR"))
-    {
-        // LOG_DEBUG("vkCmdSetFragmentShadingRateKHR");
-
-        if (o_vkCmdSetFragmentShadingRateKHR == nullptr)
-            o_vkCmdSetFragmentShadingRateKHR = (PFN_vkCmdSetFragmentShadingRateKHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetFragmentShadingRateKHR;
-    }
-    if (procName == std::string("vkCmdSetRenderingAttachmentLocationsKHR"))
-    {
-        // LOG_DEBUG("vkCmdSetRenderingAttachmentLocationsKHR");
-
-        if (o_vkCmdSetRenderingAttachmentLocationsKHR == nullptr)
-            o_vkCmdSetRenderingAttachmentLocationsKHR = (PFN_vkCmdSetRenderingAttachmentLocationsKHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetRenderingAttachmentLocationsKHR;
-    }
-    if (procName == std::string("vkCmdSetRenderingInputAttachmentIndicesKHR"))
-    {
-        // LOG_DEBUG("vkCmdSetRenderingInputAttachmentIndicesKHR");
-
-        if (o_vkCmdSetRenderingInputAttachmentIndicesKHR == nullptr)
-            o_vkCmdSetRenderingInputAttachmentIndicesKHR = (PFN_vkCmdSetRenderingInputAttachmentIndicesKHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetRenderingInputAttachmentIndicesKHR;
-    }
-    if (procName == std::string("vkCmdEncodeVideoKHR"))
-    {
-        // LOG_DEBUG("vkCmdEncodeVideoKHR");
-
-        if (o_vkCmdEncodeVideoKHR == nullptr)
-            o_vkCmdEncodeVideoKHR = (PFN_vkCmdEncodeVideoKHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdEncodeVideoKHR;
-    }
-    if (procName == std::string("vkCmdSetEvent2KHR"))
-    {
-        // LOG_DEBUG("vkCmdSetEvent2KHR");
-
-        if (o_vkCmdSetEvent2KHR == nullptr)
-            o_vkCmdSetEvent2KHR = (PFN_vkCmdSetEvent2KHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetEvent2KHR;
-    }
-    if (procName == std::string("vkCmdResetEvent2KHR"))
-    {
-        // LOG_DEBUG("vkCmdResetEvent2KHR");
-
-        if (o_vkCmdResetEvent2KHR == nullptr)
-            o_vkCmdResetEvent2KHR = (PFN_vkCmdResetEvent2KHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdResetEvent2KHR;
-    }
-    if (procName == std::string("vkCmdWaitEvents2KHR"))
-    {
-        // LOG_DEBUG("vkCmdWaitEvents2KHR");
-
-        if (o_vkCmdWaitEvents2KHR == nullptr)
-            o_vkCmdWaitEvents2KHR = (PFN_vkCmdWaitEvents2KHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdWaitEvents2KHR;
-    }
-    if (procName == std::string("vkCmdPipelineBarrier2KHR"))
-    {
-        // LOG_DEBUG("vkCmdPipelineBarrier2KHR");
-
-        if (o_vkCmdPipelineBarrier2KHR == nullptr)
-            o_vkCmdPipelineBarrier2KHR = (PFN_vkCmdPipelineBarrier2KHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdPipelineBarrier2KHR;
-    }
-    if (procName == std::string("vkCmdWriteTimestamp2KHR"))
-    {
-        // LOG_DEBUG("vkCmdWriteTimestamp2KHR");
-
-        if (o_vkCmdWriteTimestamp2KHR == nullptr)
-            o_vkCmdWriteTimestamp2KHR = (PFN_vkCmdWriteTimestamp2KHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdWriteTimestamp2KHR;
-    }
-    if (procName == std::string("vkCmdCopyBuffer2KHR"))
-    {
-        // LOG_DEBUG("vkCmdCopyBuffer2KHR");
-
-        if (o_vkCmdCopyBuffer2KHR == nullptr)
-            o_vkCmdCopyBuffer2KHR = (PFN_vkCmdCopyBuffer2KHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdCopyBuffer2KHR;
-    }
-    if (procName == std::string("vkCmdCopyImage2KHR"))
-    {
-        // LOG_DEBUG("vkCmdCopyImage2KHR");
-
-        if (o_vkCmdCopyImage2KHR == nullptr)
-            o_vkCmdCopyImage2KHR = (PFN_vkCmdCopyImage2KHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdCopyImage2KHR;
-    }
-    if (procName == std::string("vkCmdCopyBufferToImage2KHR"))
-    {
-        // LOG_DEBUG("vkCmdCopyBufferToImage2KHR");
-
-        if (o_vkCmdCopyBufferToImage2KHR == nullptr)
-            o_vkCmdCopyBufferToImage2KHR = (PFN_vkCmdCopyBufferToImage2KHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdCopyBufferToImage2KHR;
-    }
-    if (procName == std::string("vkCmdCopyImageToBuffer2KHR"))
-    {
-        // LOG_DEBUG("vkCmdCopyImageToBuffer2KHR");
-
-        if (o_vkCmdCopyImageToBuffer2KHR == nullptr)
-            o_vkCmdCopyImageToBuffer2KHR = (PFN_vkCmdCopyImageToBuffer2KHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdCopyImageToBuffer2KHR;
-    }
-    if (procName == std::string("vkCmdBlitImage2KHR"))
-    {
-        // LOG_DEBUG("vkCmdBlitImage2KHR");
-
-        if (o_vkCmdBlitImage2KHR == nullptr)
-            o_vkCmdBlitImage2KHR = (PFN_vkCmdBlitImage2KHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdBlitImage2KHR;
-    }
-    if (procName == std::string("vkCmdResolveImage2KHR"))
-    {
-        // LOG_DEBUG("vkCmdResolveImage2KHR");
-
-        if (o_vkCmdResolveImage2KHR == nullptr)
-            o_vkCmdResolveImage2KHR = (PFN_vkCmdResolveImage2KHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdResolveImage2KHR;
-    }
-    if (procName == std::string("vkCmdTraceRaysIndirect2KHR"))
-    {
-        // LOG_DEBUG("vkCmdTraceRaysIndirect2KHR");
-
-        if (o_vkCmdTraceRaysIndirect2KHR == nullptr)
-            o_vkCmdTraceRaysIndirect2KHR = (PFN_vkCmdTraceRaysIndirect2KHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdTraceRaysIndirect2KHR;
-    }
-    if (procName == std::string("vkCmdBindIndexBuffer2KHR"))
-    {
-        // LOG_DEBUG("vkCmdBindIndexBuffer2KHR");
-
-        if (o_vkCmdBindIndexBuffer2KHR == nullptr)
-            o_vkCmdBindIndexBuffer2KHR = (PFN_vkCmdBindIndexBuffer2KHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdBindIndexBuffer2KHR;
-    }
-    if (procName == std::string("vkCmdSetLineStippleKHR"))
-    {
-        // LOG_DEBUG("vkCmdSetLineStippleKHR");
-
-        if (o_vkCmdSetLineStippleKHR == nullptr)
-            o_vkCmdSetLineStippleKHR = (PFN_vkCmdSetLineStippleKHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetLineStippleKHR;
-    }
-    if (procName == std::string("vkCmdBindDescriptorSets2KHR"))
-    {
-        // LOG_DEBUG("vkCmdBindDescriptorSets2KHR");
-
-        if (o_vkCmdBindDescriptorSets2KHR == nullptr)
-            o_vkCmdBindDescriptorSets2KHR = (PFN_vkCmdBindDescriptorSets2KHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdBindDescriptorSets2KHR;
-    }
-    if (procName == std::string("vkCmdPushConstants2KHR"))
-    {
-        // LOG_DEBUG("vkCmdPushConstants2KHR");
-
-        if (o_vkCmdPushConstants2KHR == nullptr)
-            o_vkCmdPushConstants2KHR = (PFN_vkCmdPushConstants2KHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdPushConstants2KHR;
-    }
-    if (procName == std::string("vkCmdPushDescriptorSet2KHR"))
-    {
-        // LOG_DEBUG("vkCmdPushDescriptorSet2KHR");
-
-        if (o_vkCmdPushDescriptorSet2KHR == nullptr)
-            o_vkCmdPushDescriptorSet2KHR = (PFN_vkCmdPushDescriptorSet2KHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdPushDescriptorSet2KHR;
-    }
-    if (procName == std::string("vkCmdPushDescriptorSetWithTemplate2KHR"))
-    {
-        // LOG_DEBUG("vkCmdPushDescriptorSetWithTemplate2KHR");
-
-        if (o_vkCmdPushDescriptorSetWithTemplate2KHR == nullptr)
-            o_vkCmdPushDescriptorSetWithTemplate2KHR = (PFN_vkCmdPushDescriptorSetWithTemplate2KHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdPushDescriptorSetWithTemplate2KHR;
-    }
-    if (procName == std::string("vkCmdSetDescriptorBufferOffsets2EXT"))
-    {
-        // LOG_DEBUG("vkCmdSetDescriptorBufferOffsets2EXT");
-
-        if (o_vkCmdSetDescriptorBufferOffsets2EXT == nullptr)
-            o_vkCmdSetDescriptorBufferOffsets2EXT = (PFN_vkCmdSetDescriptorBufferOffsets2EXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetDescriptorBufferOffsets2EXT;
-    }
-    if (procName == std::string("vkCmdBindDescriptorBufferEmbeddedSamplers2EXT"))
-    {
-        // LOG_DEBUG("vkCmdBindDescriptorBufferEmbeddedSamplers2EXT");
-
-        if (o_vkCmdBindDescriptorBufferEmbeddedSamplers2EXT == nullptr)
-            o_vkCmdBindDescriptorBufferEmbeddedSamplers2EXT =
-                (PFN_vkCmdBindDescriptorBufferEmbeddedSamplers2EXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdBindDescriptorBufferEmbeddedSamplers2EXT;
-    }
-    if (procName == std::string("vkCmdDebugMarkerBeginEXT"))
-    {
-        // LOG_DEBUG("vkCmdDebugMarkerBeginEXT");
-
-        if (o_vkCmdDebugMarkerBeginEXT == nullptr)
-            o_vkCmdDebugMarkerBeginEXT = (PFN_vkCmdDebugMarkerBeginEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdDebugMarkerBeginEXT;
-    }
-    if (procName == std::string("vkCmdDebugMarkerEndEXT"))
-    {
-        // LOG_DEBUG("vkCmdDebugMarkerEndEXT");
-
-        if (o_vkCmdDebugMarkerEndEXT == nullptr)
-            o_vkCmdDebugMarkerEndEXT = (PFN_vkCmdDebugMarkerEndEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdDebugMarkerEndEXT;
-    }
-    if (procName == std::string("vkCmdDebugMarkerInsertEXT"))
-    {
-        // LOG_DEBUG("vkCmdDebugMarkerInsertEXT");
-
-        if (o_vkCmdDebugMarkerInsertEXT == nullptr)
-            o_vkCmdDebugMarkerInsertEXT = (PFN_vkCmdDebugMarkerInsertEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdDebugMarkerInsertEXT;
-    }
-    if (procName == std::string("vkCmdBindTransformFeedbackBuffersEXT"))
-    {
-        // LOG_DEBUG("vkCmdBindTransformFeedbackBuffersEXT");
-
-        if (o_vkCmdBindTransformFeedbackBuffersEXT == nullptr)
-            o_vkCmdBindTransformFeedbackBuffersEXT = (PFN_vkCmdBindTransformFeedbackBuffersEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdBindTransformFeedbackBuffersEXT;
-    }
-    if (procName == std::string("vkCmdBeginTransformFeedbackEXT"))
-    {
-        // LOG_DEBUG("vkCmdBeginTransformFeedbackEXT");
-
-        if (o_vkCmdBeginTransformFeedbackEXT == nullptr)
-            o_vkCmdBeginTransformFeedbackEXT = (PFN_vkCmdBeginTransformFeedbackEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdBeginTransformFeedbackEXT;
-    }
-    if (procName == std::string("vkCmdEndTransformFeedbackEXT"))
-    {
-        // LOG_DEBUG("vkCmdEndTransformFeedbackEXT");
-
-        if (o_vkCmdEndTransformFeedbackEXT == nullptr)
-            o_vkCmdEndTransformFeedbackEXT = (PFN_vkCmdEndTransformFeedbackEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdEndTransformFeedbackEXT;
-    }
-    if (procName == std::string("vkCmdBeginQueryIndexedEXT"))
-    {
-        // LOG_DEBUG("vkCmdBeginQueryIndexedEXT");
-
-        if (o_vkCmdBeginQueryIndexedEXT == nullptr)
-            o_vkCmdBeginQueryIndexedEXT = (PFN_vkCmdBeginQueryIndexedEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdBeginQueryIndexedEXT;
-    }
-    if (procName == std::string("vkCmdEndQueryIndexedEXT"))
-    {
-        // LOG_DEBUG("vkCmdEndQueryIndexedEXT");
-
-        if (o_vkCmdEndQueryIndexedEXT == nullptr)
-            o_vkCmdEndQueryIndexedEXT = (PFN_vkCmdEndQueryIndexedEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdEndQueryIndexedEXT;
-    }
-    if (procName == std::string("vkCmdDrawIndirectByteCountEXT"))
-    {
-        // LOG_DEBUG("vkCmdDrawIndirectByteCountEXT");
-
-        if (o_vkCmdDrawIndirectByteCountEXT == nullptr)
-            o_vkCmdDrawIndirectByteCountEXT = (PFN_vkCmdDrawIndirectByteCountEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdDrawIndirectByteCountEXT;
-    }
-    if (procName == std::string("vkCmdCuLaunchKernelNVX"))
-    {
-        // LOG_DEBUG("vkCmdCuLaunchKernelNVX");
-
-        if (o_vkCmdCuLaunchKernelNVX == nullptr)
-            o_vkCmdCuLaunchKernelNVX = (PFN_vkCmdCuLaunchKernelNVX) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdCuLaunchKernelNVX;
-    }
-    if (procName == std::string("vkCmdDrawIndirectCountAMD"))
-    {
-        // LOG_DEBUG("vkCmdDrawIndirectCountAMD");
-
-        if (o_vkCmdDrawIndirectCountAMD == nullptr)
-            o_vkCmdDrawIndirectCountAMD = (PFN_vkCmdDrawIndirectCountAMD) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdDrawIndirectCountAMD;
-    }
-    if (procName == std::string("vkCmdDrawIndexedIndirectCountAMD"))
-    {
-        // LOG_DEBUG("vkCmdDrawIndexedIndirectCountAMD");
-
-        if (o_vkCmdDrawIndexedIndirectCountAMD == nullptr)
-            o_vkCmdDrawIndexedIndirectCountAMD = (PFN_vkCmdDrawIndexedIndirectCountAMD) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdDrawIndexedIndirectCountAMD;
-    }
-    if (procName == std::string("vkCmdBeginConditionalRenderingEXT"))
-    {
-        // LOG_DEBUG("vkCmdBeginConditionalRenderingEXT");
-
-        if (o_vkCmdBeginConditionalRenderingEXT == nullptr)
-            o_vkCmdBeginConditionalRenderingEXT = (PFN_vkCmdBeginConditionalRenderingEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdBeginConditionalRenderingEXT;
-    }
-    if (procName == std::string("vkCmdEndConditionalRenderingEXT"))
-    {
-        // LOG_DEBUG("vkCmdEndConditionalRenderingEXT");
-
-        if (o_vkCmdEndConditionalRenderingEXT == nullptr)
-            o_vkCmdEndConditionalRenderingEXT = (PFN_vkCmdEndConditionalRenderingEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdEndConditionalRenderingEXT;
-    }
-    if (procName == std::string("vkCmdSetViewportWScalingNV"))
-    {
-        // LOG_DEBUG("vkCmdSetViewportWScalingNV");
-
-        if (o_vkCmdSetViewportWScalingNV == nullptr)
-            o_vkCmdSetViewportWScalingNV = (PFN_vkCmdSetViewportWScalingNV) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetViewportWScalingNV;
-    }
-    if (procName == std::string("vkCmdSetDiscardRectangleEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetDiscardRectangleEXT");
-
-        if (o_vkCmdSetDiscardRectangleEXT == nullptr)
-            o_vkCmdSetDiscardRectangleEXT = (PFN_vkCmdSetDiscardRectangleEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetDiscardRectangleEXT;
-    }
-    if (procName == std::string("vkCmdSetDiscardRectangleEnableEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetDiscardRectangleEnableEXT");
-
-        if (o_vkCmdSetDiscardRectangleEnableEXT == nullptr)
-            o_vkCmdSetDiscardRectangleEnableEXT = (PFN_vkCmdSetDiscardRectangleEnableEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetDiscardRectangleEnableEXT;
-    }
-    if (procName == std::string("vkCmdSetDiscardRectangleModeEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetDiscardRectangleModeEXT");
-
-        if (o_vkCmdSetDiscardRectangleModeEXT == nullptr)
-            o_vkCmdSetDiscardRectangleModeEXT = (PFN_vkCmdSetDiscardRectangleModeEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetDiscardRectangleModeEXT;
-    }
-    if (procName == std::string("vkCmdBeginDebugUtilsLabelEXT"))
-    {
-        // LOG_DEBUG("vkCmdBeginDebugUtilsLabelEXT");
-
-        if (o_vkCmdBeginDebugUtilsLabelEXT == nullptr)
-            o_vkCmdBeginDebugUtilsLabelEXT = (PFN_vkCmdBeginDebugUtilsLabelEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdBeginDebugUtilsLabelEXT;
-    }
-    if (procName == std::string("vkCmdEndDebugUtilsLabelEXT"))
-    {
-        // LOG_DEBUG("vkCmdEndDebugUtilsLabelEXT");
-
-        if (o_vkCmdEndDebugUtilsLabelEXT == nullptr)
-            o_vkCmdEndDebugUtilsLabelEXT = (PFN_vkCmdEndDebugUtilsLabelEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdEndDebugUtilsLabelEXT;
-    }
-    if (procName == std::string("vkCmdInsertDebugUtilsLabelEXT"))
-    {
-        // LOG_DEBUG("vkCmdInsertDebugUtilsLabelEXT");
-
-        if (o_vkCmdInsertDebugUtilsLabelEXT == nullptr)
-            o_vkCmdInsertDebugUtilsLabelEXT = (PFN_vkCmdInsertDebugUtilsLabelEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdInsertDebugUtilsLabelEXT;
-    }
-    if (procName == std::string("vkCmdSetSampleLocationsEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetSampleLocationsEXT");
-
-        if (o_vkCmdSetSampleLocationsEXT == nullptr)
-            o_vkCmdSetSampleLocationsEXT = (PFN_vkCmdSetSampleLocationsEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetSampleLocationsEXT;
-    }
-    if (procName == std::string("vkCmdBindShadingRateImageNV"))
-    {
-        // LOG_DEBUG("vkCmdBindShadingRateImageNV");
-
-        if (o_vkCmdBindShadingRateImageNV == nullptr)
-            o_vkCmdBindShadingRateImageNV = (PFN_vkCmdBindShadingRateImageNV) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdBindShadingRateImageNV;
-    }
-    if (procName == std::string("vkCmdSetViewportShadingRatePaletteNV"))
-    {
-        // LOG_DEBUG("vkCmdSetViewportShadingRatePaletteNV");
-
-        if (o_vkCmdSetViewportShadingRatePaletteNV == nullptr)
-            o_vkCmdSetViewportShadingRatePaletteNV = (PFN_vkCmdSetViewportShadingRatePaletteNV) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetViewportShadingRatePaletteNV;
-    }
-    if (procName == std::string("vkCmdSetCoarseSampleOrderNV"))
-    {
-        // LOG_DEBUG("vkCmdSetCoarseSampleOrderNV");
-
-        if (o_vkCmdSetCoarseSampleOrderNV == nullptr)
-            o_vkCmdSetCoarseSampleOrderNV = (PFN_vkCmdSetCoarseSampleOrderNV) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetCoarseSampleOrderNV;
-    }
-    if (procName == std::string("vkCmdBuildAccelerationStructureNV"))
-    {
-        // LOG_DEBUG("vkCmdBuildAccelerationStructureNV");
-
-        if (o_vkCmdBuildAccelerationStructureNV == nullptr)
-            o_vkCmdBuildAccelerationStructureNV = (PFN_vkCmdBuildAccelerationStructureNV) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdBuildAccelerationStructureNV;
-    }
-    if (procName == std::string("vkCmdCopyAccelerationStructureNV"))
-    {
-        // LOG_DEBUG("vkCmdCopyAccelerationStructureNV");
-
-        if (o_vkCmdCopyAccelerationStructureNV == nullptr)
-            o_vkCmdCopyAccelerationStructureNV = (PFN_vkCmdCopyAccelerationStructureNV) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdCopyAccelerationStructureNV;
-    }
-    if (procName == std::string("vkCmdTraceRaysNV"))
-    {
-        // LOG_DEBUG("vkCmdTraceRaysNV");
-
-        if (o_vkCmdTraceRaysNV == nullptr)
-            o_vkCmdTraceRaysNV = (PFN_vkCmdTraceRaysNV) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdTraceRaysNV;
-    }
-    if (procName == std::string("vkCmdWriteAccelerationStructuresPropertiesNV"))
-    {
-        // LOG_DEBUG("vkCmdWriteAccelerationStructuresPropertiesNV");
-
-        if (o_vkCmdWriteAccelerationStructuresPropertiesNV == nullptr)
-            o_vkCmdWriteAccelerationStructuresPropertiesNV =
-                (PFN_vkCmdWriteAccelerationStructuresPropertiesNV) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdWriteAccelerationStructuresPropertiesNV;
-    }
-    if (procName == std::string("vkCmdWriteBufferMarkerAMD"))
-    {
-        // LOG_DEBUG("vkCmdWriteBufferMarkerAMD");
-
-        if (o_vkCmdWriteBufferMarkerAMD == nullptr)
-            o_vkCmdWriteBufferMarkerAMD = (PFN_vkCmdWriteBufferMarkerAMD) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdWriteBufferMarkerAMD;
-    }
-    if (procName == std::string("vkCmdWriteBufferMarker2AMD"))
-    {
-        // LOG_DEBUG("vkCmdWriteBufferMarker2AMD");
-
-        if (o_vkCmdWriteBufferMarker2AMD == nullptr)
-            o_vkCmdWriteBufferMarker2AMD = (PFN_vkCmdWriteBufferMarker2AMD) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdWriteBufferMarker2AMD;
-    }
-    if (procName == std::string("vkCmdDrawMeshTasksNV"))
-    {
-        // LOG_DEBUG("vkCmdDrawMeshTasksNV");
-
-        if (o_vkCmdDrawMeshTasksNV == nullptr)
-            o_vkCmdDrawMeshTasksNV = (PFN_vkCmdDrawMeshTasksNV) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdDrawMeshTasksNV;
-    }
-    if (procName == std::string("vkCmdDrawMeshTasksIndirectNV"))
-    {
-        // LOG_DEBUG("vkCmdDrawMeshTasksIndirectNV");
-
-        if (o_vkCmdDrawMeshTasksIndirectNV == nullptr)
-            o_vkCmdDrawMeshTasksIndirectNV = (PFN_vkCmdDrawMeshTasksIndirectNV) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdDrawMeshTasksIndirectNV;
-    }
-    if (procName == std::string("vkCmdDrawMeshTasksIndirectCountNV"))
-    {
-        // LOG_DEBUG("vkCmdDrawMeshTasksIndirectCountNV");
-
-        if (o_vkCmdDrawMeshTasksIndirectCountNV == nullptr)
-            o_vkCmdDrawMeshTasksIndirectCountNV = (PFN_vkCmdDrawMeshTasksIndirectCountNV) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdDrawMeshTasksIndirectCountNV;
-    }
-    if (procName == std::string("vkCmdSetExclusiveScissorEnableNV"))
-    {
-        // LOG_DEBUG("vkCmdSetExclusiveScissorEnableNV");
-
-        if (o_vkCmdSetExclusiveScissorEnableNV == nullptr)
-            o_vkCmdSetExclusiveScissorEnableNV = (PFN_vkCmdSetExclusiveScissorEnableNV) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetExclusiveScissorEnableNV;
-    }
-    if (procName == std::string("vkCmdSetExclusiveScissorNV"))
-    {
-        // LOG_DEBUG("vkCmdSetExclusiveScissorNV");
-
-        if (o_vkCmdSetExclusiveScissorNV == nullptr)
-            o_vkCmdSetExclusiveScissorNV = (PFN_vkCmdSetExclusiveScissorNV) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetExclusiveScissorNV;
-    }
-    if (procName == std::string("vkCmdSetCheckpointNV"))
-    {
-        // LOG_DEBUG("vkCmdSetCheckpointNV");
-
-        if (o_vkCmdSetCheckpointNV == nullptr)
-            o_vkCmdSetCheckpointNV = (PFN_vkCmdSetCheckpointNV) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetCheckpointNV;
-    }
-    if (procName == std::string("vkCmdSetPerformanceMarkerINTEL"))
-    {
-        // LOG_DEBUG("vkCmdSetPerformanceMarkerINTEL");
-
-        if (o_vkCmdSetPerformanceMarkerINTEL == nullptr)
-            o_vkCmdSetPerformanceMarkerINTEL = (PFN_vkCmdSetPerformanceMarkerINTEL) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetPerformanceMarkerINTEL;
-    }
-    if (procName == std::string("vkCmdSetPerformanceStreamMarkerINTEL"))
-    {
-        // LOG_DEBUG("vkCmdSetPerformanceStreamMarkerINTEL");
-
-        if (o_vkCmdSetPerformanceStreamMarkerINTEL == nullptr)
-            o_vkCmdSetPerformanceStreamMarkerINTEL = (PFN_vkCmdSetPerformanceStreamMarkerINTEL) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetPerformanceStreamMarkerINTEL;
-    }
-    if (procName == std::string("vkCmdSetPerformanceOverrideINTEL"))
-    {
-        // LOG_DEBUG("vkCmdSetPerformanceOverrideINTEL");
-
-        if (o_vkCmdSetPerformanceOverrideINTEL == nullptr)
-            o_vkCmdSetPerformanceOverrideINTEL = (PFN_vkCmdSetPerformanceOverrideINTEL) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetPerformanceOverrideINTEL;
-    }
-    if (procName == std::string("vkCmdSetLineStippleEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetLineStippleEXT");
-
-        if (o_vkCmdSetLineStippleEXT == nullptr)
-            o_vkCmdSetLineStippleEXT = (PFN_vkCmdSetLineStippleEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetLineStippleEXT;
-    }
-    if (procName == std::string("vkCmdSetCullModeEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetCullModeEXT");
-
-        if (o_vkCmdSetCullModeEXT == nullptr)
-            o_vkCmdSetCullModeEXT = (PFN_vkCmdSetCullModeEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetCullModeEXT;
-    }
-    if (procName == std::string("vkCmdSetFrontFaceEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetFrontFaceEXT");
-
-        if (o_vkCmdSetFrontFaceEXT == nullptr)
-            o_vkCmdSetFrontFaceEXT = (PFN_vkCmdSetFrontFaceEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetFrontFaceEXT;
-    }
-    if (procName == std::string("vkCmdSetPrimitiveTopologyEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetPrimitiveTopologyEXT");
-
-        if (o_vkCmdSetPrimitiveTopologyEXT == nullptr)
-            o_vkCmdSetPrimitiveTopologyEXT = (PFN_vkCmdSetPrimitiveTopologyEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetPrimitiveTopologyEXT;
-    }
-    if (procName == std::string("vkCmdSetViewportWithCountEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetViewportWithCountEXT");
-
-        if (o_vkCmdSetViewportWithCountEXT == nullptr)
-            o_vkCmdSetViewportWithCountEXT = (PFN_vkCmdSetViewportWithCountEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetViewportWithCountEXT;
-    }
-    if (procName == std::string("vkCmdSetScissorWithCountEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetScissorWithCountEXT");
-
-        if (o_vkCmdSetScissorWithCountEXT == nullptr)
-            o_vkCmdSetScissorWithCountEXT = (PFN_vkCmdSetScissorWithCountEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetScissorWithCountEXT;
-    }
-    if (procName == std::string("vkCmdBindVertexBuffers2EXT"))
-    {
-        // LOG_DEBUG("vkCmdBindVertexBuffers2EXT");
-
-        if (o_vkCmdBindVertexBuffers2EXT == nullptr)
-            o_vkCmdBindVertexBuffers2EXT = (PFN_vkCmdBindVertexBuffers2EXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdBindVertexBuffers2EXT;
-    }
-    if (procName == std::string("vkCmdSetDepthTestEnableEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetDepthTestEnableEXT");
-
-        if (o_vkCmdSetDepthTestEnableEXT == nullptr)
-            o_vkCmdSetDepthTestEnableEXT = (PFN_vkCmdSetDepthTestEnableEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetDepthTestEnableEXT;
-    }
-    if (procName == std::string("vkCmdSetDepthWriteEnableEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetDepthWriteEnableEXT");
-
-        if (o_vkCmdSetDepthWriteEnableEXT == nullptr)
-            o_vkCmdSetDepthWriteEnableEXT = (PFN_vkCmdSetDepthWriteEnableEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetDepthWriteEnableEXT;
-    }
-    if (procName == std::string("vkCmdSetDepthCompareOpEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetDepthCompareOpEXT");
-
-        if (o_vkCmdSetDepthCompareOpEXT == nullptr)
-            o_vkCmdSetDepthCompareOpEXT = (PFN_vkCmdSetDepthCompareOpEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetDepthCompareOpEXT;
-    }
-    if (procName == std::string("vkCmdSetDepthBoundsTestEnableEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetDepthBoundsTestEnableEXT");
-
-        if (o_vkCmdSetDepthBoundsTestEnableEXT == nullptr)
-            o_vkCmdSetDepthBoundsTestEnableEXT = (PFN_vkCmdSetDepthBoundsTestEnableEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetDepthBoundsTestEnableEXT;
-    }
-    if (procName == std::string("vkCmdSetStencilTestEnableEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetStencilTestEnableEXT");
-
-        if (o_vkCmdSetStencilTestEnableEXT == nullptr)
-            o_vkCmdSetStencilTestEnableEXT = (PFN_vkCmdSetStencilTestEnableEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetStencilTestEnableEXT;
-    }
-    if (procName == std::string("vkCmdSetStencilOpEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetStencilOpEXT");
-
-        if (o_vkCmdSetStencilOpEXT == nullptr)
-            o_vkCmdSetStencilOpEXT = (PFN_vkCmdSetStencilOpEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetStencilOpEXT;
-    }
-    if (procName == std::string("vkCmdPreprocessGeneratedCommandsNV"))
-    {
-        // LOG_DEBUG("vkCmdPreprocessGeneratedCommandsNV");
-
-        if (o_vkCmdPreprocessGeneratedCommandsNV == nullptr)
-            o_vkCmdPreprocessGeneratedCommandsNV = (PFN_vkCmdPreprocessGeneratedCommandsNV) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdPreprocessGeneratedCommandsNV;
-    }
-    if (procName == std::string("vkCmdExecuteGeneratedCommandsNV"))
-    {
-        // LOG_DEBUG("vkCmdExecuteGeneratedCommandsNV");
-
-        if (o_vkCmdExecuteGeneratedCommandsNV == nullptr)
-            o_vkCmdExecuteGeneratedCommandsNV = (PFN_vkCmdExecuteGeneratedCommandsNV) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdExecuteGeneratedCommandsNV;
-    }
-    if (procName == std::string("vkCmdBindPipelineShaderGroupNV"))
-    {
-        // LOG_DEBUG("vkCmdBindPipelineShaderGroupNV");
-
-        if (o_vkCmdBindPipelineShaderGroupNV == nullptr)
-            o_vkCmdBindPipelineShaderGroupNV = (PFN_vkCmdBindPipelineShaderGroupNV) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdBindPipelineShaderGroupNV;
-    }
-    if (procName == std::string("vkCmdSetDepthBias2EXT"))
-    {
-        // LOG_DEBUG("vkCmdSetDepthBias2EXT");
-
-        if (o_vkCmdSetDepthBias2EXT == nullptr)
-            o_vkCmdSetDepthBias2EXT = (PFN_vkCmdSetDepthBias2EXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetDepthBias2EXT;
-    }
-    if (procName == std::string("vkCmdCudaLaunchKernelNV"))
-    {
-        // LOG_DEBUG("vkCmdCudaLaunchKernelNV");
-
-        if (o_vkCmdCudaLaunchKernelNV == nullptr)
-            o_vkCmdCudaLaunchKernelNV = (PFN_vkCmdCudaLaunchKernelNV) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdCudaLaunchKernelNV;
-    }
-    if (procName == std::string("vkCmdBindDescriptorBuffersEXT"))
-    {
-        // LOG_DEBUG("vkCmdBindDescriptorBuffersEXT");
-
-        if (o_vkCmdBindDescriptorBuffersEXT == nullptr)
-            o_vkCmdBindDescriptorBuffersEXT = (PFN_vkCmdBindDescriptorBuffersEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdBindDescriptorBuffersEXT;
-    }
-    if (procName == std::string("vkCmdSetDescriptorBufferOffsetsEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetDescriptorBufferOffsetsEXT");
-
-        if (o_vkCmdSetDescriptorBufferOffsetsEXT == nullptr)
-            o_vkCmdSetDescriptorBufferOffsetsEXT = (PFN_vkCmdSetDescriptorBufferOffsetsEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetDescriptorBufferOffsetsEXT;
-    }
-    if (procName == std::string("vkCmdBindDescriptorBufferEmbeddedSamplersEXT"))
-    {
-        // LOG_DEBUG("vkCmdBindDescriptorBufferEmbeddedSamplersEXT");
-
-        if (o_vkCmdBindDescriptorBufferEmbeddedSamplersEXT == nullptr)
-            o_vkCmdBindDescriptorBufferEmbeddedSamplersEXT =
-                (PFN_vkCmdBindDescriptorBufferEmbeddedSamplersEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdBindDescriptorBufferEmbeddedSamplersEXT;
-    }
-    if (procName == std::string("vkCmdSetFragmentShadingRateEnumNV"))
-    {
-        // LOG_DEBUG("vkCmdSetFragmentShadingRateEnumNV");
-
-        if (o_vkCmdSetFragmentShadingRateEnumNV == nullptr)
-            o_vkCmdSetFragmentShadingRateEnumNV = (PFN_vkCmdSetFragmentShadingRateEnumNV) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetFragmentShadingRateEnumNV;
-    }
-    if (procName == std::string("vkCmdSetVertexInputEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetVertexInputEXT");
-
-        if (o_vkCmdSetVertexInputEXT == nullptr)
-            o_vkCmdSetVertexInputEXT = (PFN_vkCmdSetVertexInputEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetVertexInputEXT;
-    }
-    if (procName == std::string("vkCmdSubpassShadingHUAWEI"))
-    {
-        // LOG_DEBUG("vkCmdSubpassShadingHUAWEI");
-
-        if (o_vkCmdSubpassShadingHUAWEI == nullptr)
-            o_vkCmdSubpassShadingHUAWEI = (PFN_vkCmdSubpassShadingHUAWEI) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSubpassShadingHUAWEI;
-    }
-    if (procName == std::string("vkCmdBindInvocationMaskHUAWEI"))
-    {
-        // LOG_DEBUG("vkCmdBindInvocationMaskHUAWEI");
-
-        if (o_vkCmdBindInvocationMaskHUAWEI == nullptr)
-            o_vkCmdBindInvocationMaskHUAWEI = (PFN_vkCmdBindInvocationMaskHUAWEI) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdBindInvocationMaskHUAWEI;
-    }
-    if (procName == std::string("vkCmdSetPatchControlPointsEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetPatchControlPointsEXT");
-
-        if (o_vkCmdSetPatchControlPointsEXT == nullptr)
-            o_vkCmdSetPatchControlPointsEXT = (PFN_vkCmdSetPatchControlPointsEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetPatchControlPointsEXT;
-    }
-    if (procName == std::string("vkCmdSetRasterizerDiscardEnableEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetRasterizerDiscardEnableEXT");
-
-        if (o_vkCmdSetRasterizerDiscardEnableEXT == nullptr)
-            o_vkCmdSetRasterizerDiscardEnableEXT = (PFN_vkCmdSetRasterizerDiscardEnableEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetRasterizerDiscardEnableEXT;
-    }
-    if (procName == std::string("vkCmdSetDepthBiasEnableEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetDepthBiasEnableEXT");
-
-        if (o_vkCmdSetDepthBiasEnableEXT == nullptr)
-            o_vkCmdSetDepthBiasEnableEXT = (PFN_vkCmdSetDepthBiasEnableEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetDepthBiasEnableEXT;
-    }
-    if (procName == std::string("vkCmdSetLogicOpEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetLogicOpEXT");
-
-        if (o_vkCmdSetLogicOpEXT == nullptr)
-            o_vkCmdSetLogicOpEXT = (PFN_vkCmdSetLogicOpEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetLogicOpEXT;
-    }
-    if (procName == std::string("vkCmdSetPrimitiveRestartEnableEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetPrimitiveRestartEnableEXT");
-
-        if (o_vkCmdSetPrimitiveRestartEnableEXT == nullptr)
-            o_vkCmdSetPrimitiveRestartEnableEXT = (PFN_vkCmdSetPrimitiveRestartEnableEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetPrimitiveRestartEnableEXT;
-    }
-    if (procName == std::string("vkCmdSetColorWriteEnableEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetColorWriteEnableEXT");
-
-        if (o_vkCmdSetColorWriteEnableEXT == nullptr)
-            o_vkCmdSetColorWriteEnableEXT = (PFN_vkCmdSetColorWriteEnableEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetColorWriteEnableEXT;
-    }
-    if (procName == std::string("vkCmdDrawMultiEXT"))
-    {
-        // LOG_DEBUG("vkCmdDrawMultiEXT");
-
-        if (o_vkCmdDrawMultiEXT == nullptr)
-            o_vkCmdDrawMultiEXT = (PFN_vkCmdDrawMultiEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdDrawMultiEXT;
-    }
-    if (procName == std::string("vkCmdDrawMultiIndexedEXT"))
-    {
-        // LOG_DEBUG("vkCmdDrawMultiIndexedEXT");
-
-        if (o_vkCmdDrawMultiIndexedEXT == nullptr)
-            o_vkCmdDrawMultiIndexedEXT = (PFN_vkCmdDrawMultiIndexedEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdDrawMultiIndexedEXT;
-    }
-    if (procName == std::string("vkCmdBuildMicromapsEXT"))
-    {
-        // LOG_DEBUG("vkCmdBuildMicromapsEXT");
-
-        if (o_vkCmdBuildMicromapsEXT == nullptr)
-            o_vkCmdBuildMicromapsEXT = (PFN_vkCmdBuildMicromapsEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdBuildMicromapsEXT;
-    }
-    if (procName == std::string("vkCmdCopyMicromapEXT"))
-    {
-        // LOG_DEBUG("vkCmdCopyMicromapEXT");
-
-        if (o_vkCmdCopyMicromapEXT == nullptr)
-            o_vkCmdCopyMicromapEXT = (PFN_vkCmdCopyMicromapEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdCopyMicromapEXT;
-    }
-    if (procName == std::string("vkCmdCopyMicromapToMemoryEXT"))
-    {
-        // LOG_DEBUG("vkCmdCopyMicromapToMemoryEXT");
-
-        if (o_vkCmdCopyMicromapToMemoryEXT == nullptr)
-            o_vkCmdCopyMicromapToMemoryEXT = (PFN_vkCmdCopyMicromapToMemoryEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdCopyMicromapToMemoryEXT;
-    }
-    if (procName == std::string("vkCmdCopyMemoryToMicromapEXT"))
-    {
-        // LOG_DEBUG("vkCmdCopyMemoryToMicromapEXT");
-
-        if (o_vkCmdCopyMemoryToMicromapEXT == nullptr)
-            o_vkCmdCopyMemoryToMicromapEXT = (PFN_vkCmdCopyMemoryToMicromapEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdCopyMemoryToMicromapEXT;
-    }
-    if (procName == std::string("vkCmdWriteMicromapsPropertiesEXT"))
-    {
-        // LOG_DEBUG("vkCmdWriteMicromapsPropertiesEXT");
-
-        if (o_vkCmdWriteMicromapsPropertiesEXT == nullptr)
-            o_vkCmdWriteMicromapsPropertiesEXT = (PFN_vkCmdWriteMicromapsPropertiesEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdWriteMicromapsPropertiesEXT;
-    }
-    if (procName == std::string("vkCmdDrawClusterHUAWEI"))
-    {
-        // LOG_DEBUG("vkCmdDrawClusterHUAWEI");
-
-        if (o_vkCmdDrawClusterHUAWEI == nullptr)
-            o_vkCmdDrawClusterHUAWEI = (PFN_vkCmdDrawClusterHUAWEI) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdDrawClusterHUAWEI;
-    }
-    if (procName == std::string("vkCmdDrawClusterIndirectHUAWEI"))
-    {
-        // LOG_DEBUG("vkCmdDrawClusterIndirectHUAWEI");
-
-        if (o_vkCmdDrawClusterIndirectHUAWEI == nullptr)
-            o_vkCmdDrawClusterIndirectHUAWEI = (PFN_vkCmdDrawClusterIndirectHUAWEI) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdDrawClusterIndirectHUAWEI;
-    }
-    if (procName == std::string("vkCmdCopyMemoryIndirectNV"))
-    {
-        // LOG_DEBUG("vkCmdCopyMemoryIndirectNV");
-
-        if (o_vkCmdCopyMemoryIndirectNV == nullptr)
-            o_vkCmdCopyMemoryIndirectNV = (PFN_vkCmdCopyMemoryIndirectNV) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdCopyMemoryIndirectNV;
-    }
-    if (procName == std::string("vkCmdCopyMemoryToImageIndirectNV"))
-    {
-        // LOG_DEBUG("vkCmdCopyMemoryToImageIndirectNV");
-
-        if (o_vkCmdCopyMemoryToImageIndirectNV == nullptr)
-            o_vkCmdCopyMemoryToImageIndirectNV = (PFN_vkCmdCopyMemoryToImageIndirectNV) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdCopyMemoryToImageIndirectNV;
-    }
-    if (procName == std::string("vkCmdDecompressMemoryNV"))
-    {
-        // LOG_DEBUG("vkCmdDecompressMemoryNV");
-
-        if (o_vkCmdDecompressMemoryNV == nullptr)
-            o_vkCmdDecompressMemoryNV = (PFN_vkCmdDecompressMemoryNV) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdDecompressMemoryNV;
-    }
-    if (procName == std::string("vkCmdDecompressMemoryIndirectCountNV"))
-    {
-        // LOG_DEBUG("vkCmdDecompressMemoryIndirectCountNV");
-
-        if (o_vkCmdDecompressMemoryIndirectCountNV == nullptr)
-            o_vkCmdDecompressMemoryIndirectCountNV = (PFN_vkCmdDecompressMemoryIndirectCountNV) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdDecompressMemoryIndirectCountNV;
-    }
-    if (procName == std::string("vkCmdUpdatePipelineIndirectBufferNV"))
-    {
-        // LOG_DEBUG("vkCmdUpdatePipelineIndirectBufferNV");
-
-        if (o_vkCmdUpdatePipelineIndirectBufferNV == nullptr)
-            o_vkCmdUpdatePipelineIndirectBufferNV = (PFN_vkCmdUpdatePipelineIndirectBufferNV) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdUpdatePipelineIndirectBufferNV;
-    }
-    if (procName == std::string("vkCmdSetDepthClampEnableEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetDepthClampEnableEXT");
-
-        if (o_vkCmdSetDepthClampEnableEXT == nullptr)
-            o_vkCmdSetDepthClampEnableEXT = (PFN_vkCmdSetDepthClampEnableEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetDepthClampEnableEXT;
-    }
-    if (procName == std::string("vkCmdSetPolygonModeEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetPolygonModeEXT");
-
-        if (o_vkCmdSetPolygonModeEXT == nullptr)
-            o_vkCmdSetPolygonModeEXT = (PFN_vkCmdSetPolygonModeEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetPolygonModeEXT;
-    }
-    if (procName == std::string("vkCmdSetRasterizationSamplesEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetRasterizationSamplesEXT");
-
-        if (o_vkCmdSetRasterizationSamplesEXT == nullptr)
-            o_vkCmdSetRasterizationSamplesEXT = (PFN_vkCmdSetRasterizationSamplesEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetRasterizationSamplesEXT;
-    }
-    if (procName == std::string("vkCmdSetSampleMaskEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetSampleMaskEXT");
-
-        if (o_vkCmdSetSampleMaskEXT == nullptr)
-            o_vkCmdSetSampleMaskEXT = (PFN_vkCmdSetSampleMaskEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetSampleMaskEXT;
-    }
-    if (procName == std::string("vkCmdSetAlphaToCoverageEnableEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetAlphaToCoverageEnableEXT");
-
-        if (o_vkCmdSetAlphaToCoverageEnableEXT == nullptr)
-            o_vkCmdSetAlphaToCoverageEnableEXT = (PFN_vkCmdSetAlphaToCoverageEnableEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetAlphaToCoverageEnableEXT;
-    }
-    if (procName == std::string("vkCmdSetAlphaToOneEnableEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetAlphaToOneEnableEXT");
-
-        if (o_vkCmdSetAlphaToOneEnableEXT == nullptr)
-            o_vkCmdSetAlphaToOneEnableEXT = (PFN_vkCmdSetAlphaToOneEnableEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetAlphaToOneEnableEXT;
-    }
-    if (procName == std::string("vkCmdSetLogicOpEnableEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetLogicOpEnableEXT");
-
-        if (o_vkCmdSetLogicOpEnableEXT == nullptr)
-            o_vkCmdSetLogicOpEnableEXT = (PFN_vkCmdSetLogicOpEnableEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetLogicOpEnableEXT;
-    }
-    if (procName == std::string("vkCmdSetColorBlendEnableEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetColorBlendEnableEXT");
-
-        if (o_vkCmdSetColorBlendEnableEXT == nullptr)
-            o_vkCmdSetColorBlendEnableEXT = (PFN_vkCmdSetColorBlendEnableEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetColorBlendEnableEXT;
-    }
-    if (procName == std::string("vkCmdSetColorBlendEquationEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetColorBlendEquationEXT");
-
-        if (o_vkCmdSetColorBlendEquationEXT == nullptr)
-            o_vkCmdSetColorBlendEquationEXT = (PFN_vkCmdSetColorBlendEquationEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetColorBlendEquationEXT;
-    }
-    if (procName == std::string("vkCmdSetColorWriteMaskEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetColorWriteMaskEXT");
-
-        if (o_vkCmdSetColorWriteMaskEXT == nullptr)
-            o_vkCmdSetColorWriteMaskEXT = (PFN_vkCmdSetColorWriteMaskEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetColorWriteMaskEXT;
-    }
-    if (procName == std::string("vkCmdSetTessellationDomainOriginEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetTessellationDomainOriginEXT");
-
-        if (o_vkCmdSetTessellationDomainOriginEXT == nullptr)
-            o_vkCmdSetTessellationDomainOriginEXT = (PFN_vkCmdSetTessellationDomainOriginEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetTessellationDomainOriginEXT;
-    }
-    if (procName == std::string("vkCmdSetRasterizationStreamEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetRasterizationStreamEXT");
-
-        if (o_vkCmdSetRasterizationStreamEXT == nullptr)
-            o_vkCmdSetRasterizationStreamEXT = (PFN_vkCmdSetRasterizationStreamEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetRasterizationStreamEXT;
-    }
-    if (procName == std::string("vkCmdSetConservativeRasterizationModeEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetConservativeRasterizationModeEXT");
-
-        if (o_vkCmdSetConservativeRasterizationModeEXT == nullptr)
-            o_vkCmdSetConservativeRasterizationModeEXT = (PFN_vkCmdSetConservativeRasterizationModeEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetConservativeRasterizationModeEXT;
-    }
-    if (procName == std::string("vkCmdSetExtraPrimitiveOverestimationSizeEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetExtraPrimitiveOverestimationSizeEXT");
-
-        if (o_vkCmdSetExtraPrimitiveOverestimationSizeEXT == nullptr)
-            o_vkCmdSetExtraPrimitiveOverestimationSizeEXT = (PFN_vkCmdSetExtraPrimitiveOverestimationSizeEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetExtraPrimitiveOverestimationSizeEXT;
-    }
-    if (procName == std::string("vkCmdSetDepthClipEnableEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetDepthClipEnableEXT");
-
-        if (o_vkCmdSetDepthClipEnableEXT == nullptr)
-            o_vkCmdSetDepthClipEnableEXT = (PFN_vkCmdSetDepthClipEnableEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetDepthClipEnableEXT;
-    }
-    if (procName == std::string("vkCmdSetSampleLocationsEnableEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetSampleLocationsEnableEXT");
-
-        if (o_vkCmdSetSampleLocationsEnableEXT == nullptr)
-            o_vkCmdSetSampleLocationsEnableEXT = (PFN_vkCmdSetSampleLocationsEnableEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetSampleLocationsEnableEXT;
-    }
-    if (procName == std::string("vkCmdSetColorBlendAdvancedEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetColorBlendAdvancedEXT");
-
-        if (o_vkCmdSetColorBlendAdvancedEXT == nullptr)
-            o_vkCmdSetColorBlendAdvancedEXT = (PFN_vkCmdSetColorBlendAdvancedEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetColorBlendAdvancedEXT;
-    }
-    if (procName == std::string("vkCmdSetProvokingVertexModeEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetProvokingVertexModeEXT");
-
-        if (o_vkCmdSetProvokingVertexModeEXT == nullptr)
-            o_vkCmdSetProvokingVertexModeEXT = (PFN_vkCmdSetProvokingVertexModeEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetProvokingVertexModeEXT;
-    }
-    if (procName == std::string("vkCmdSetLineRasterizationModeEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetLineRasterizationModeEXT");
-
-        if (o_vkCmdSetLineRasterizationModeEXT == nullptr)
-            o_vkCmdSetLineRasterizationModeEXT = (PFN_vkCmdSetLineRasterizationModeEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetLineRasterizationModeEXT;
-    }
-    if (procName == std::string("vkCmdSetLineStippleEnableEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetLineStippleEnableEXT");
-
-        if (o_vkCmdSetLineStippleEnableEXT == nullptr)
-            o_vkCmdSetLineStippleEnableEXT = (PFN_vkCmdSetLineStippleEnableEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetLineStippleEnableEXT;
-    }
-    if (procName == std::string("vkCmdSetDepthClipNegativeOneToOneEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetDepthClipNegativeOneToOneEXT");
-
-        if (o_vkCmdSetDepthClipNegativeOneToOneEXT == nullptr)
-            o_vkCmdSetDepthClipNegativeOneToOneEXT = (PFN_vkCmdSetDepthClipNegativeOneToOneEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetDepthClipNegativeOneToOneEXT;
-    }
-    if (procName == std::string("vkCmdSetViewportWScalingEnableNV"))
-    {
-        // LOG_DEBUG("vkCmdSetViewportWScalingEnableNV");
-
-        if (o_vkCmdSetViewportWScalingEnableNV == nullptr)
-            o_vkCmdSetViewportWScalingEnableNV = (PFN_vkCmdSetViewportWScalingEnableNV) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetViewportWScalingEnableNV;
-    }
-    if (procName == std::string("vkCmdSetViewportSwizzleNV"))
-    {
-        // LOG_DEBUG("vkCmdSetViewportSwizzleNV");
-
-        if (o_vkCmdSetViewportSwizzleNV == nullptr)
-            o_vkCmdSetViewportSwizzleNV = (PFN_vkCmdSetViewportSwizzleNV) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetViewportSwizzleNV;
-    }
-    if (procName == std::string("vkCmdSetCoverageToColorEnableNV"))
-    {
-        // LOG_DEBUG("vkCmdSetCoverageToColorEnableNV");
-
-        if (o_vkCmdSetCoverageToColorEnableNV == nullptr)
-            o_vkCmdSetCoverageToColorEnableNV = (PFN_vkCmdSetCoverageToColorEnableNV) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetCoverageToColorEnableNV;
-    }
-    if (procName == std::string("vkCmdSetCoverageToColorLocationNV"))
-    {
-        // LOG_DEBUG("vkCmdSetCoverageToColorLocationNV");
-
-        if (o_vkCmdSetCoverageToColorLocationNV == nullptr)
-            o_vkCmdSetCoverageToColorLocationNV = (PFN_vkCmdSetCoverageToColorLocationNV) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetCoverageToColorLocationNV;
-    }
-    if (procName == std::string("vkCmdSetCoverageModulationModeNV"))
-    {
-        // LOG_DEBUG("vkCmdSetCoverageModulationModeNV");
-
-        if (o_vkCmdSetCoverageModulationModeNV == nullptr)
-            o_vkCmdSetCoverageModulationModeNV = (PFN_vkCmdSetCoverageModulationModeNV) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetCoverageModulationModeNV;
-    }
-    if (procName == std::string("vkCmdSetCoverageModulationTableEnableNV"))
-    {
-        // LOG_DEBUG("vkCmdSetCoverageModulationTableEnableNV");
-
-        if (o_vkCmdSetCoverageModulationTableEnableNV == nullptr)
-            o_vkCmdSetCoverageModulationTableEnableNV = (PFN_vkCmdSetCoverageModulationTableEnableNV) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetCoverageModulationTableEnableNV;
-    }
-    if (procName == std::string("vkCmdSetCoverageModulationTableNV"))
-    {
-        // LOG_DEBUG("vkCmdSetCoverageModulationTableNV");
-
-        if (o_vkCmdSetCoverageModulationTableNV == nullptr)
-            o_vkCmdSetCoverageModulationTableNV = (PFN_vkCmdSetCoverageModulationTableNV) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetCoverageModulationTableNV;
-    }
-    if (procName == std::string("vkCmdSetShadingRateImageEnableNV"))
-    {
-        // LOG_DEBUG("vkCmdSetShadingRateImageEnableNV");
-
-        if (o_vkCmdSetShadingRateImageEnableNV == nullptr)
-            o_vkCmdSetShadingRateImageEnableNV = (PFN_vkCmdSetShadingRateImageEnableNV) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetShadingRateImageEnableNV;
-    }
-    if (procName == std::string("vkCmdSetRepresentativeFragmentTestEnableNV"))
-    {
-        // LOG_DEBUG("vkCmdSetRepresentativeFragmentTestEnableNV");
-
-        if (o_vkCmdSetRepresentativeFragmentTestEnableNV == nullptr)
-            o_vkCmdSetRepresentativeFragmentTestEnableNV = (PFN_vkCmdSetRepresentativeFragmentTestEnableNV) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetRepresentativeFragmentTestEnableNV;
-    }
-    if (procName == std::string("vkCmdSetCoverageReductionModeNV"))
-    {
-        // LOG_DEBUG("vkCmdSetCoverageReductionModeNV");
-
-        if (o_vkCmdSetCoverageReductionModeNV == nullptr)
-            o_vkCmdSetCoverageReductionModeNV = (PFN_vkCmdSetCoverageReductionModeNV) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetCoverageReductionModeNV;
-    }
-    if (procName == std::string("vkCmdOpticalFlowExecuteNV"))
-    {
-        // LOG_DEBUG("vkCmdOpticalFlowExecuteNV");
-
-        if (o_vkCmdOpticalFlowExecuteNV == nullptr)
-            o_vkCmdOpticalFlowExecuteNV = (PFN_vkCmdOpticalFlowExecuteNV) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdOpticalFlowExecuteNV;
-    }
-    if (procName == std::string("vkCmdBindShadersEXT"))
-    {
-        // LOG_DEBUG("vkCmdBindShadersEXT");
-
-        if (o_vkCmdBindShadersEXT == nullptr)
-            o_vkCmdBindShadersEXT = (PFN_vkCmdBindShadersEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdBindShadersEXT;
-    }
-    if (procName == std::string("vkCmdSetDepthClampRangeEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetDepthClampRangeEXT");
-
-        if (o_vkCmdSetDepthClampRangeEXT == nullptr)
-            o_vkCmdSetDepthClampRangeEXT = (PFN_vkCmdSetDepthClampRangeEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetDepthClampRangeEXT;
-    }
-    if (procName == std::string("vkCmdConvertCooperativeVectorMatrixNV"))
-    {
-        // LOG_DEBUG("vkCmdConvertCooperativeVectorMatrixNV");
-
-        if (o_vkCmdConvertCooperativeVectorMatrixNV == nullptr)
-            o_vkCmdConvertCooperativeVectorMatrixNV = (PFN_vkCmdConvertCooperativeVectorMatrixNV) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdConvertCooperativeVectorMatrixNV;
-    }
-    if (procName == std::string("vkCmdSetAttachmentFeedbackLoopEnableEXT"))
-    {
-        // LOG_DEBUG("vkCmdSetAttachmentFeedbackLoopEnableEXT");
-
-        if (o_vkCmdSetAttachmentFeedbackLoopEnableEXT == nullptr)
-            o_vkCmdSetAttachmentFeedbackLoopEnableEXT = (PFN_vkCmdSetAttachmentFeedbackLoopEnableEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetAttachmentFeedbackLoopEnableEXT;
-    }
-    if (procName == std::string("vkCmdBuildClusterAccelerationStructureIndirectNV"))
-    {
-        // LOG_DEBUG("vkCmdBuildClusterAccelerationStructureIndirectNV");
-
-        if (o_vkCmdBuildClusterAccelerationStructureIndirectNV == nullptr)
-            o_vkCmdBuildClusterAccelerationStructureIndirectNV =
-                (PFN_vkCmdBuildClusterAccelerationStructureIndirectNV) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdBuildClusterAccelerationStructureIndirectNV;
-    }
-    if (procName == std::string("vkCmdBuildPartitionedAccelerationStructuresNV"))
-    {
-        // LOG_DEBUG("vkCmdBuildPartitionedAccelerationStructuresNV");
-
-        if (o_vkCmdBuildPartitionedAccelerationStructuresNV == nullptr)
-            o_vkCmdBuildPartitionedAccelerationStructuresNV =
-                (PFN_vkCmdBuildPartitionedAccelerationStructuresNV) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdBuildPartitionedAccelerationStructuresNV;
-    }
-    if (procName == std::string("vkCmdPreprocessGeneratedCommandsEXT"))
-    {
-        // LOG_DEBUG("vkCmdPreprocessGeneratedCommandsEXT");
-
-        if (o_vkCmdPreprocessGeneratedCommandsEXT == nullptr)
-            o_vkCmdPreprocessGeneratedCommandsEXT = (PFN_vkCmdPreprocessGeneratedCommandsEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdPreprocessGeneratedCommandsEXT;
-    }
-    if (procName == std::string("vkCmdExecuteGeneratedCommandsEXT"))
-    {
-        // LOG_DEBUG("vkCmdExecuteGeneratedCommandsEXT");
-
-        if (o_vkCmdExecuteGeneratedCommandsEXT == nullptr)
-            o_vkCmdExecuteGeneratedCommandsEXT = (PFN_vkCmdExecuteGeneratedCommandsEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdExecuteGeneratedCommandsEXT;
-    }
-    if (procName == std::string("vkCmdBuildAccelerationStructuresKHR"))
-    {
-        // LOG_DEBUG("vkCmdBuildAccelerationStructuresKHR");
-
-        if (o_vkCmdBuildAccelerationStructuresKHR == nullptr)
-            o_vkCmdBuildAccelerationStructuresKHR = (PFN_vkCmdBuildAccelerationStructuresKHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdBuildAccelerationStructuresKHR;
-    }
-    if (procName == std::string("vkCmdBuildAccelerationStructuresIndirectKHR"))
-    {
-        // LOG_DEBUG("vkCmdBuildAccelerationStructuresIndirectKHR");
-
-        if (o_vkCmdBuildAccelerationStructuresIndirectKHR == nullptr)
-            o_vkCmdBuildAccelerationStructuresIndirectKHR = (PFN_vkCmdBuildAccelerationStructuresIndirectKHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdBuildAccelerationStructuresIndirectKHR;
-    }
-    if (procName == std::string("vkCmdCopyAccelerationStructureKHR"))
-    {
-        // LOG_DEBUG("vkCmdCopyAccelerationStructureKHR");
-
-        if (o_vkCmdCopyAccelerationStructureKHR == nullptr)
-            o_vkCmdCopyAccelerationStructureKHR = (PFN_vkCmdCopyAccelerationStructureKHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdCopyAccelerationStructureKHR;
-    }
-    if (procName == std::string("vkCmdCopyAccelerationStructureToMemoryKHR"))
-    {
-        // LOG_DEBUG("vkCmdCopyAccelerationStructureToMemoryKHR");
-
-        if (o_vkCmdCopyAccelerationStructureToMemoryKHR == nullptr)
-            o_vkCmdCopyAccelerationStructureToMemoryKHR = (PFN_vkCmdCopyAccelerationStructureToMemoryKHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdCopyAccelerationStructureToMemoryKHR;
-    }
-    if (procName == std::string("vkCmdCopyMemoryToAccelerationStructureKHR"))
-    {
-        // LOG_DEBUG("vkCmdCopyMemoryToAccelerationStructureKHR");
-
-        if (o_vkCmdCopyMemoryToAccelerationStructureKHR == nullptr)
-            o_vkCmdCopyMemoryToAccelerationStructureKHR = (PFN_vkCmdCopyMemoryToAccelerationStructureKHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdCopyMemoryToAccelerationStructureKHR;
-    }
-    if (procName == std::string("vkCmdWriteAccelerationStructuresPropertiesKHR"))
-    {
-        // LOG_DEBUG("vkCmdWriteAccelerationStructuresPropertiesKHR");
-
-        if (o_vkCmdWriteAccelerationStructuresPropertiesKHR == nullptr)
-            o_vkCmdWriteAccelerationStructuresPropertiesKHR =
-                (PFN_vkCmdWriteAccelerationStructuresPropertiesKHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdWriteAccelerationStructuresPropertiesKHR;
-    }
-    if (procName == std::string("vkCmdTraceRaysKHR"))
-    {
-        // LOG_DEBUG("vkCmdTraceRaysKHR");
-
-        if (o_vkCmdTraceRaysKHR == nullptr)
-            o_vkCmdTraceRaysKHR = (PFN_vkCmdTraceRaysKHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdTraceRaysKHR;
-    }
-    if (procName == std::string("vkCmdTraceRaysIndirectKHR"))
-    {
-        // LOG_DEBUG("vkCmdTraceRaysIndirectKHR");
-
-        if (o_vkCmdTraceRaysIndirectKHR == nullptr)
-            o_vkCmdTraceRaysIndirectKHR = (PFN_vkCmdTraceRaysIndirectKHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdTraceRaysIndirectKHR;
-    }
-    if (procName == std::string("vkCmdSetRayTracingPipelineStackSizeKHR"))
-    {
-        // LOG_DEBUG("vkCmdSetRayTracingPipelineStackSizeKHR");
-
-        if (o_vkCmdSetRayTracingPipelineStackSizeKHR == nullptr)
-            o_vkCmdSetRayTracingPipelineStackSizeKHR = (PFN_vkCmdSetRayTracingPipelineStackSizeKHR) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdSetRayTracingPipelineStackSizeKHR;
-    }
-    if (procName == std::string("vkCmdDrawMeshTasksEXT"))
-    {
-        // LOG_DEBUG("vkCmdDrawMeshTasksEXT");
-
-        if (o_vkCmdDrawMeshTasksEXT == nullptr)
-            o_vkCmdDrawMeshTasksEXT = (PFN_vkCmdDrawMeshTasksEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdDrawMeshTasksEXT;
-    }
-    if (procName == std::string("vkCmdDrawMeshTasksIndirectEXT"))
-    {
-        // LOG_DEBUG("vkCmdDrawMeshTasksIndirectEXT");
-
-        if (o_vkCmdDrawMeshTasksIndirectEXT == nullptr)
-            o_vkCmdDrawMeshTasksIndirectEXT = (PFN_vkCmdDrawMeshTasksIndirectEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdDrawMeshTasksIndirectEXT;
-    }
-    if (procName == std::string("vkCmdDrawMeshTasksIndirectCountEXT"))
-    {
-        // LOG_DEBUG("vkCmdDrawMeshTasksIndirectCountEXT");
-
-        if (o_vkCmdDrawMeshTasksIndirectCountEXT == nullptr)
-            o_vkCmdDrawMeshTasksIndirectCountEXT = (PFN_vkCmdDrawMeshTasksIndirectCountEXT) original;
-
-        return (PFN_vkVoidFunction) hk_vkCmdDrawMeshTasksIndirectCountEXT;
-    }
-
-    return VK_NULL_HANDLE;
-}
-
-void Vulkan_wDx12::InitializeStateTrackerFunctionTable()
-{
-    static bool initialized = false;
-
-    if (initialized)
-        return;
-
-    vk_state::VulkanCmdFns fns {};
+    vk_state::VulkanCmdFns fns {};
 
     // Core command buffer functions
     fns.CmdBindPipeline = o_vkCmdBindPipeline;
@@ -11071,6 +8845,8 @@ void Vulkan_wDx12::Hook(HMODULE vulkanModule)
 
         DetourTransactionCommit();
 
+        FeatureProvider_Vk::SubmitsHooked((PFN_vkQueueSubmit) o_vkQueueSubmit);
+
         InitializeStateTrackerFunctionTable();
     }
 }
@@ -11082,6 +8858,8 @@ void Vulkan_wDx12::Unhook()
 
     LOG_INFO("Detaching Vulkan hooks");
 
+    FeatureProvider_Vk::SubmitsHooked(nullptr);
+
     DetourTransactionBegin();
     DetourUpdateThread(GetCurrentThread());
 
@@ -11092,7 +8870,7 @@ void Vulkan_wDx12::Unhook()
         DetourDetach(&(PVOID&) o_vkQueueSubmit2, hk_vkQueueSubmit2);
 
     if (o_vkQueueSubmit2KHR)
-        DetourDetach(&(PVOID&) o_vkQueueSubmit2KHR, hk_vkQueueSubmit2);
+        DetourDetach(&(PVOID&) o_vkQueueSubmit2KHR, hk_vkQueueSubmit2KHR);
 
     DetourTransactionCommit();
 
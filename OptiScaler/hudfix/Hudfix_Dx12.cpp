@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "Hudfix_Dx12.h"
+#include "Hudfix_Scoring.h"
 
 #include <Util.h>
 #include <State.h>
@@ -192,7 +193,7 @@ void Hudfix_Dx12::ResourceBarrier(ID3D12GraphicsCommandList* InCommandList, ID3D
     InCommandList->ResourceBarrier(1, &barrier);
 }
 
-bool Hudfix_Dx12::CheckCapture()
+bool Hudfix_Dx12::CheckCapture(bool selected)
 {
     auto fIndex = GetIndex();
 
@@ -210,8 +211,9 @@ bool Hudfix_Dx12::CheckCapture()
         LOG_TRACE("frameCounter: {}, _captureCounter: {}, Limit: {}", State::Instance().currentFeature->FrameCount(),
                   _captureCounter[fIndex], Config::Instance()->FGHUDLimit.value_or_default());
 
+        // Ranked candidate doesn't wait for the limit
         if (_captureCounter[fIndex] > 999 ||
-            _captureCounter[fIndex] != Config::Instance()->FGHUDLimit.value_or_default())
+            (!selected && _captureCounter[fIndex] != Config::Instance()->FGHUDLimit.value_or_default()))
             return false;
     }
 
@@ -357,6 +359,16 @@ bool Hudfix_Dx12::CheckResource(ResourceInfo* resource)
 
 int Hudfix_Dx12::GetIndex() { return _upscaleCounter % BUFFER_COUNT; }
 
+bool Hudfix_Dx12::UseRanking()
+{
+    auto& s = State::Instance();
+
+    // Manual limit and resource lists select candidates on their own
+    return Config::Instance()->FGHudfixScoring.value_or_default() &&
+           Config::Instance()->FGHUDLimit.value_or_default() == 1 && !s.FGcaptureResources &&
+           !s.FGonlyUseCapturedResources;
+}
+
 void Hudfix_Dx12::HudlessFound(ID3D12GraphicsCommandList* cmdList)
 {
     LOG_DEBUG("_upscaleCounter: {}, _fgCounter: {}", _upscaleCounter, _fgCounter);
@@ -614,7 +626,17 @@ bool Hudfix_Dx12::CheckForHudless(ID3D12GraphicsCommandList* cmdList, ResourceIn
             }
         }
 
-        if (!CheckCapture())
+        auto key = (uintptr_t) resource->buffer;
+        auto write = IsWriteBind(resource);
+
+        Hudfix_Scoring::Observe(_upscaleCounter, key, write,
+                                resource->format == s.currentSwapchainDesc.BufferDesc.Format, resource->extended);
+
+        auto decision =
+            Hudfix_Scoring::Decide(key, write, Config::Instance()->FGHudfixValidateBudget.value_or_default(),
+                                   UseRanking());
+
+        if (decision == HudlessDecision::Skip || !CheckCapture(decision == HudlessDecision::Capture))
             break;
 
         auto fIndex = GetIndex();
@@ -625,6 +647,7 @@ bool Hudfix_Dx12::CheckForHudless(ID3D12GraphicsCommandList* cmdList, ResourceIn
         {
             LOG_WARN("Can't create command queue!");
             _captureCounter[fIndex]--;
+            Hudfix_Scoring::Validated(key, false);
             return false;
         }
 
@@ -655,6 +678,7 @@ bool Hudfix_Dx12::CheckForHudless(ID3D12GraphicsCommandList* cmdList, ResourceIn
             {
                 LOG_WARN("Can't create _captureBuffer!");
                 _captureCounter[fIndex]--;
+                Hudfix_Scoring::Validated(key, false);
                 break;
             }
         }
@@ -714,6 +738,7 @@ bool Hudfix_Dx12::CheckForHudless(ID3D12GraphicsCommandList* cmdList, ResourceIn
             {
                 LOG_WARN("Can't create _captureBuffer!");
                 _captureCounter[fIndex]--;
+                Hudfix_Scoring::Validated(key, false);
                 break;
             }
         }
@@ -747,6 +772,7 @@ bool Hudfix_Dx12::CheckForHudless(ID3D12GraphicsCommandList* cmdList, ResourceIn
                                                                    D3D12_RESOURCE_STATE_UNORDERED_ACCESS))
                 {
                     _captureCounter[fIndex]--;
+                    Hudfix_Scoring::Validated(key, false);
                     break;
                 }
 
@@ -791,6 +817,7 @@ bool Hudfix_Dx12::CheckForHudless(ID3D12GraphicsCommandList* cmdList, ResourceIn
             {
                 LOG_WARN("_formatTransfer is null or can't create _formatTransfer buffer!");
                 _captureCounter[fIndex]--;
+                Hudfix_Scoring::Validated(key, false);
                 break;
             }
         }
@@ -831,6 +858,7 @@ bool Hudfix_Dx12::CheckForHudless(ID3D12GraphicsCommandList* cmdList, ResourceIn
         // This will prevent resource tracker to check these operations
         // Will reset after FG dispatch
         _skipHudlessChecks = true;
+        Hudfix_Scoring::Validated(key, true);
         HudlessFound(cmdList);
 
         if (capturedHudlessInfo != nullptr)
@@ -861,6 +889,7 @@ void Hudfix_Dx12::ResetCounters()
     _frameTime = 0.0;
 
     _hudlessList.clear();
+    Hudfix_Scoring::Reset();
 
     _captureCounter[0] = 0;
     _captureCounter[1] = 0;
@@ -1,5 +1,7 @@
 #pragma once
 #include "SysUtils.h"
+#include "Hudfix_Types.h"
+
 #include <shaders/format_transfer/FT_Dx12.h>
 
 #include <ankerl/unordered_dense.h>
@@ -9,54 +11,6 @@
 #include <d3d12.h>
 #include <shared_mutex>
 
-enum ResourceType
-{
-    SRV,
-    RTV,
-    UAV
-};
-
-enum CaptureInfo
-{
-    None = 0,
-    CreateRTV = 1,
-    CreateSRV = 2,
-    CreateUAV = 4,
-    OMSetRTV = 8,
-    Upscaler = 16,
-    SetCR = 32,
-    SetGR = 64,
-    Dispatch = 256,
-    DrawInstanced = 512,
-    DrawIndexedInstanced = 1024,
-};
-
-typedef struct ResourceInfo
-{
-    ID3D12Resource* buffer = nullptr;
-    UINT64 width = 0;
-    UINT height = 0;
-    DXGI_FORMAT format = DXGI_FORMAT_UNKNOWN;
-    D3D12_RESOURCE_STATES state = D3D12_RESOURCE_STATE_COMMON;
-    D3D12_RESOURCE_FLAGS flags = D3D12_RESOURCE_FLAG_NONE;
-    ResourceType type = SRV;
-    double lastUsedFrame = 0;
-    bool extended = false;
-    UINT captureInfo = 0;
-} resource_info;
-
-typedef struct HudlessInfo
-{
-    UINT64 lastUsedFrame = 0;
-    UINT64 retryStartFrame = 0;
-    UINT64 lastTriedFrame = 0;
-    UINT64 retryCount = 0;
-    UINT64 reuseCount = 0;
-    UINT64 useCount = 0;
-    bool ignore = false;
-    bool dontReuse = false;
-} hudless_info;
-
 class Hudfix_Dx12
 {
   private:
@@ -105,13 +59,16 @@ class Hudfix_Dx12
     static void ResourceBarrier(ID3D12GraphicsCommandList* InCommandList, ID3D12Resource* InResource,
                                 D3D12_RESOURCE_STATES InBeforeState, D3D12_RESOURCE_STATES InAfterState);
 
-    // Check _captureCounter for current frame
-    static bool CheckCapture();
+    // Check _captureCounter for current frame, selected is the ranked candidate
+    static bool CheckCapture(bool selected);
 
     static void HudlessFound(ID3D12GraphicsCommandList* cmdList);
 
     static int GetIndex();
 
+    // Candidate ranking is used instead of HUDLimit counter
+    static bool UseRanking();
+
     inline static IID streamlineRiid {};
     static bool CheckForRealObject(std::string functionName, IUnknown* pObject, IUnknown** ppRealObject);
 
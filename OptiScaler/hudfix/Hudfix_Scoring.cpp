@@ -0,0 +1,242 @@
+#include "pch.h"
+#include "Hudfix_Scoring.h"
+
+#include <cmath>
+
+// Weight of the last frame in decaying values
+static constexpr double ScoreAlpha = 0.25;
+
+// Challenger must be this much better than current top
+static constexpr double TopHysteresis = 1.15;
+
+// Frames a candidate needs to be seen before it can be top
+static constexpr UINT64 MinSeenFrames = 4;
+
+// Frames top must stay before only it is copied
+static constexpr UINT StableFrames = 3;
+
+// Frames stable top can be bound without being copied before counter is used again
+static constexpr UINT MaxMissedFrames = 2;
+
+// Candidates not seen for this many frames are dropped
+static constexpr UINT64 StaleFrames = 120;
+
+double Hudfix_Scoring::FrameScore(const FrameStat& stat, UINT positions)
+{
+    double score = 0.0;
+
+    // Later in the frame is closer to UI rendering
+    if (stat.writes > 0)
+        score += 2.0 * (double) stat.lastWritePos / (double) positions;
+
+    // Bound for reading after it was written, scene color is read by post process / UI composition
+    if (stat.readAfterWrite)
+        score += 1.5;
+
+    if (stat.formatMatch)
+        score += 1.0;
+
+    if (stat.extended)
+        score -= 0.5;
+
+    score += 0.5 * (double) (std::min)(stat.binds, 8u) / 8.0;
+
+    return score;
+}
+
+void Hudfix_Scoring::FoldFrame()
+{
+    auto positions = (std::max)(_position, 1u);
+    auto wasStable = IsStable();
+
+    uintptr_t best = 0;
+    double bestScore = 0.0;
+    double topScore = 0.0;
+
+    for (auto it = _candidates.begin(); it != _candidates.end();)
+    {
+        auto& candidate = it->second;
+        auto seen = candidate.lastSeenFrame == _frame && candidate.frame.binds > 0;
+
+        if (!seen && _frame - candidate.lastSeenFrame > StaleFrames)
+        {
+            it = _candidates.erase(it);
+            continue;
+        }
+
+        auto frameScore = seen ? FrameScore(candidate.frame, positions) : 0.0;
+        candidate.score += (frameScore - candidate.score) * ScoreAlpha;
+
+        if (seen)
+        {
+            candidate.framesSeen++;
+            candidate.avgWrites += ((double) candidate.frame.writes - candidate.avgWrites) * ScoreAlpha;
+            candidate.readRate += ((candidate.frame.readAfterWrite ? 1.0 : 0.0) - candidate.readRate) * ScoreAlpha;
+        }
+
+        candidate.frame = {};
+
+        if (it->first == _top)
+            topScore = candidate.score;
+
+        if (candidate.framesSeen >= MinSeenFrames && candidate.score > bestScore)
+        {
+            best = it->first;
+            bestScore = candidate.score;
+        }
+
+        ++it;
+    }
+
+    auto topIt = _candidates.find(_top);
+    auto topSeen = topIt != _candidates.end() && topIt->second.lastSeenFrame == _frame;
+
+    if (best != 0 && best != _top && (!topSeen || bestScore > topScore * TopHysteresis))
+    {
+        LOG_DEBUG("Hudless top candidate: {:X} -> {:X}, score: {:.3f} / {:.3f}", _top, best, bestScore, topScore);
+
+        _top = best;
+        _topFrames = 0;
+        _missedFrames = 0;
+        _topChanges++;
+
+        topIt = _candidates.find(_top);
+        topSeen = topIt->second.lastSeenFrame == _frame;
+    }
+    else if (topIt == _candidates.end())
+    {
+        _top = 0;
+    }
+
+    _topFrames = topSeen ? _topFrames + 1 : 0;
+
+    // Top is still bound but ready condition is not met anymore, let the counter select again
+    if (wasStable && topSeen && !_captured)
+    {
+        if (++_missedFrames >= MaxMissedFrames)
+        {
+            LOG_DEBUG("Hudless top candidate {:X} missed {} frames", _top, _missedFrames);
+            _topFrames = 0;
+            _missedFrames = 0;
+        }
+    }
+    else if (_captured)
+    {
+        _missedFrames = 0;
+    }
+
+    _position = 0;
+    _validations = 0;
+    _captured = false;
+}
+
+void Hudfix_Scoring::Observe(UINT64 frame, uintptr_t resource, bool write, bool formatMatch, bool extended)
+{
+    if (resource == 0)
+        return;
+
+    if (frame != _frame)
+    {
+        if (_position > 0)
+            FoldFrame();
+
+        _frame = frame;
+    }
+
+    _position++;
+
+    auto& candidate = _candidates[resource];
+    candidate.lastSeenFrame = frame;
+
+    auto& stat = candidate.frame;
+    stat.binds++;
+    stat.formatMatch = formatMatch;
+    stat.extended = extended;
+
+    if (write)
+    {
+        stat.writes++;
+        stat.lastWritePos = _position;
+    }
+    else if (stat.writes > 0)
+    {
+        stat.readAfterWrite = true;
+    }
+}
+
+HudlessDecision Hudfix_Scoring::Decide(uintptr_t resource, bool write, UINT budget, bool useRanking)
+{
+    if (_captured)
+        return HudlessDecision::Skip;
+
+    if (budget > 0 && _validations >= budget)
+    {
+        _budgetSkips++;
+        return HudlessDecision::Skip;
+    }
+
+    if (!useRanking || !IsStable())
+        return HudlessDecision::Counter;
+
+    if (resource != _top)
+        return HudlessDecision::Skip;
+
+    auto it = _candidates.find(resource);
+    if (it == _candidates.end())
+        return HudlessDecision::Skip;
+
+    auto& candidate = it->second;
+    bool ready;
+
+    if (candidate.readRate >= 0.5)
+    {
+        // Usually sampled after writes, capture at the first read of this frame
+        ready = !write && candidate.frame.readAfterWrite;
+    }
+    else if (candidate.avgWrites < 0.5)
+    {
+        // Never seen written, nothing to wait for
+        ready = true;
+    }
+    else
+    {
+        // Capture when it got as many writes as usual
+        auto target = (std::max)(1l, std::lround(candidate.avgWrites));
+        ready = write && (long) candidate.frame.writes >= target;
+    }
+
+    return ready ? HudlessDecision::Capture : HudlessDecision::Skip;
+}
+
+void Hudfix_Scoring::Validated(uintptr_t resource, bool success)
+{
+    _validations++;
+
+    if (success)
+    {
+        _captured = true;
+        return;
+    }
+
+    if (auto it = _candidates.find(resource); it != _candidates.end())
+        it->second.score *= 0.5;
+
+    if (resource == _top)
+        _topFrames = 0;
+}
+
+void Hudfix_Scoring::Reset()
+{
+    _candidates.clear();
+    _frame = 0;
+    _position = 0;
+    _validations = 0;
+    _captured = false;
+    _top = 0;
+    _topFrames = 0;
+    _missedFrames = 0;
+    _topChanges = 0;
+    _budgetSkips = 0;
+}
+
+bool Hudfix_Scoring::IsStable() { return _top != 0 && _topFrames >= StableFrames; }
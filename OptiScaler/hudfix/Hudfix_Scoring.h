@@ -0,0 +1,86 @@
+#pragma once
+#include "SysUtils.h"
+
+#include <ankerl/unordered_dense.h>
+
+// Hudless candidate ranking
+//
+// Every size matched candidate seen by Hudfix is recorded with the position of the bind inside the frame.
+// When frame id changes statistics of the finished frame are folded into a decaying score per resource:
+//   - position of last write in the frame, hudless is usually the last full size target written before UI
+//   - sampled after it was written, UI / post process passes read the scene color
+//   - swapchain format match and exact size
+//   - bind count
+//
+// Top candidate is replaced only when a challenger is clearly better. After it stayed on top for a few
+// frames only that resource is copied, before that selection is left to the HUDLimit counter.
+// Copy attempts per frame are limited by the budget in both cases.
+//
+// Resources are opaque keys and frame ids are passed in by the caller, no graphics API calls are made here.
+// Not thread safe, callers must serialize access (Hudfix uses _checkMutex, replay is single threaded).
+
+enum class HudlessDecision : uint8_t
+{
+    Skip,    // Not the selected candidate or budget is used
+    Counter, // No stable ranking yet, use HUDLimit counter
+    Capture, // Selected candidate, copy it now
+};
+
+class Hudfix_Scoring
+{
+  private:
+    struct FrameStat
+    {
+        UINT binds = 0;
+        UINT writes = 0;
+        UINT lastWritePos = 0;
+        bool readAfterWrite = false;
+        bool formatMatch = false;
+        bool extended = false;
+    };
+
+    struct Candidate
+    {
+        double score = 0.0;
+        double avgWrites = 0.0;
+        double readRate = 0.0;
+        UINT64 framesSeen = 0;
+        UINT64 lastSeenFrame = 0;
+        FrameStat frame {};
+    };
+
+    inline static ankerl::unordered_dense::map<uintptr_t, Candidate> _candidates;
+
+    inline static UINT64 _frame = 0;
+    inline static UINT _position = 0;
+    inline static UINT _validations = 0;
+    inline static bool _captured = false;
+
+    inline static uintptr_t _top = 0;
+    inline static UINT _topFrames = 0;
+    inline static UINT _missedFrames = 0;
+
+    inline static UINT64 _topChanges = 0;
+    inline static UINT64 _budgetSkips = 0;
+
+    static double FrameScore(const FrameStat& stat, UINT positions);
+    static void FoldFrame();
+
+  public:
+    // Candidate passed size / format checks, write is RTV or UAV bind
+    static void Observe(UINT64 frame, uintptr_t resource, bool write, bool formatMatch, bool extended);
+
+    // Budget is copy attempts per frame, 0 is unlimited. Without useRanking only budget is checked.
+    static HudlessDecision Decide(uintptr_t resource, bool write, UINT budget, bool useRanking);
+
+    // Copy attempt finished, failed candidates lose half of their score
+    static void Validated(uintptr_t resource, bool success);
+
+    static void Reset();
+
+    static uintptr_t Top() { return _top; }
+    static bool IsStable();
+    static UINT64 TopChanges() { return _topChanges; }
+    static UINT64 BudgetSkips() { return _budgetSkips; }
+    static size_t CandidateCount() { return _candidates.size(); }
+};
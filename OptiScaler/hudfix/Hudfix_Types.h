@@ -0,0 +1,63 @@
+#pragma once
+#include "SysUtils.h"
+
+#include <dxgi.h>
+#include <d3d12.h>
+
+// Resource bookkeeping types shared by Hudfix and resource tracking
+
+enum ResourceType
+{
+    SRV,
+    RTV,
+    UAV
+};
+
+enum CaptureInfo
+{
+    None = 0,
+    CreateRTV = 1,
+    CreateSRV = 2,
+    CreateUAV = 4,
+    OMSetRTV = 8,
+    Upscaler = 16,
+    SetCR = 32,
+    SetGR = 64,
+    Dispatch = 256,
+    DrawInstanced = 512,
+    DrawIndexedInstanced = 1024,
+};
+
+typedef struct ResourceInfo
+{
+    ID3D12Resource* buffer = nullptr;
+    UINT64 width = 0;
+    UINT height = 0;
+    DXGI_FORMAT format = DXGI_FORMAT_UNKNOWN;
+    D3D12_RESOURCE_STATES state = D3D12_RESOURCE_STATE_COMMON;
+    D3D12_RESOURCE_FLAGS flags = D3D12_RESOURCE_FLAG_NONE;
+    ResourceType type = SRV;
+    double lastUsedFrame = 0;
+    bool extended = false;
+    UINT captureInfo = 0;
+} resource_info;
+
+typedef struct HudlessInfo
+{
+    UINT64 lastUsedFrame = 0;
+    UINT64 retryStartFrame = 0;
+    UINT64 lastTriedFrame = 0;
+    UINT64 retryCount = 0;
+    UINT64 reuseCount = 0;
+    UINT64 useCount = 0;
+    bool ignore = false;
+    bool dontReuse = false;
+} hudless_info;
+
+// Resource is written by the bind (RTV, UAV or upscaler output)
+inline bool IsWriteBind(const ResourceInfo* resource)
+{
+    auto source = resource->captureInfo & 0xFF;
+    return source == CaptureInfo::OMSetRTV || source == CaptureInfo::Upscaler ||
+           resource->state == D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
+}
@@ -0,0 +1,80 @@
+#include "pch.h"
+#include "Streamline_FrameRing.h"
+
+void Sl_FrameRing::Claim(uint32_t frameId, int fgIndex)
+{
+    // FG index is reused by this frame, older token using it is not valid anymore
+    for (auto& other : _slots)
+    {
+        if (other.fgIndex.load(std::memory_order_relaxed) == fgIndex)
+            other.state.store(Pack(InvalidToken, 0), std::memory_order_release);
+    }
+
+    auto& slot = SlotOf(frameId);
+
+    // Invalidate first so readers never pair the new index with the old token
+    slot.state.store(Pack(InvalidToken, 0), std::memory_order_relaxed);
+    slot.fgIndex.store(fgIndex, std::memory_order_relaxed);
+    slot.state.store(Pack(frameId, 0), std::memory_order_release);
+}
+
+int Sl_FrameRing::IndexOf(uint32_t frameId) const
+{
+    auto& slot = SlotOf(frameId);
+
+    if (TokenOf(slot.state.load(std::memory_order_acquire)) != frameId)
+        return -1;
+
+    auto index = slot.fgIndex.load(std::memory_order_relaxed);
+
+    // Slot might be reclaimed by a newer frame while reading
+    if (TokenOf(slot.state.load(std::memory_order_acquire)) != frameId)
+        return -1;
+
+    return index;
+}
+
+bool Sl_FrameRing::Mark(uint32_t frameId, SlFrameInput input)
+{
+    if (frameId == InvalidToken)
+        return false;
+
+    auto& slot = SlotOf(frameId);
+    auto state = slot.state.load(std::memory_order_acquire);
+
+    // Fails when the slot is reclaimed meanwhile, input is never recorded for the newer token
+    do
+    {
+        if (TokenOf(state) != frameId)
+            return false;
+    } while (!slot.state.compare_exchange_weak(state, state | input, std::memory_order_acq_rel,
+                                               std::memory_order_acquire));
+
+    return true;
+}
+
+bool Sl_FrameRing::Inputs(uint32_t frameId, uint32_t& inputs) const
+{
+    auto state = SlotOf(frameId).state.load(std::memory_order_acquire);
+
+    if (frameId == InvalidToken || TokenOf(state) != frameId)
+        return false;
+
+    inputs = InputsOf(state);
+    return true;
+}
+
+bool Sl_FrameRing::IsReady(uint32_t frameId) const
+{
+    uint32_t inputs = 0;
+    return Inputs(frameId, inputs) && (inputs & SlInput_Required) == SlInput_Required;
+}
+
+void Sl_FrameRing::Reset()
+{
+    for (auto& slot : _slots)
+    {
+        slot.state.store(Pack(InvalidToken, 0), std::memory_order_release);
+        slot.fgIndex.store(-1, std::memory_order_relaxed);
+    }
+}
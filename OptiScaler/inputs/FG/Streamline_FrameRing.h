@@ -0,0 +1,70 @@
+#pragma once
+#include "SysUtils.h"
+
+#include <atomic>
+
+// Inputs received for a Streamline frame token
+enum SlFrameInput : uint32_t
+{
+    SlInput_Constants = 1 << 0,
+    SlInput_Depth = 1 << 1,
+    SlInput_Velocity = 1 << 2,
+    SlInput_Hudless = 1 << 3,
+    SlInput_UI = 1 << 4,
+    SlInput_Present = 1 << 5,
+
+    SlInput_Required = SlInput_Constants | SlInput_Depth | SlInput_Velocity,
+};
+
+// Streamline frame token ring
+//
+// Tags, constants and present markers arrive from different threads, each one only touches the slot of its token
+// (frameId modulo SlotCount). Token and received inputs share one atomic word, so an input is either recorded for
+// the token it was sent for or dropped, never for a newer frame reusing the slot. Claims come from the frame
+// boundary, under Sl_Inputs_Dx12's mutex.
+
+class Sl_FrameRing
+{
+  public:
+    // Must be power of two and bigger than BUFFER_COUNT so token collisions are rare
+    static constexpr uint32_t SlotCount = 8;
+
+  private:
+    static constexpr uint32_t InvalidToken = UINT32_MAX;
+
+    struct Slot
+    {
+        std::atomic<uint64_t> state { Pack(InvalidToken, 0) }; // Token in high half, SlFrameInput bits in low half
+        std::atomic<int> fgIndex { -1 };
+    };
+
+    static constexpr uint64_t Pack(uint32_t frameId, uint32_t inputs) { return ((uint64_t) frameId << 32) | inputs; }
+    static uint32_t TokenOf(uint64_t state) { return (uint32_t) (state >> 32); }
+    static uint32_t InputsOf(uint64_t state) { return (uint32_t) state; }
+
+    Slot _slots[SlotCount];
+
+    Slot& SlotOf(uint32_t frameId) { return _slots[frameId & (SlotCount - 1)]; }
+    const Slot& SlotOf(uint32_t frameId) const { return _slots[frameId & (SlotCount - 1)]; }
+
+  public:
+    // Starts tracking frameId for FG buffer fgIndex, older tokens using the same buffer are dropped
+    void Claim(uint32_t frameId, int fgIndex);
+
+    // FG buffer of a tracked token, -1 when it is not tracked (never claimed, stale or dropped)
+    int IndexOf(uint32_t frameId) const;
+
+    // Records an input, false when token is not tracked
+    bool Mark(uint32_t frameId, SlFrameInput input);
+
+    // Inputs received for a tracked token, false when it is not tracked
+    bool Inputs(uint32_t frameId, uint32_t& inputs) const;
+
+    // Constants, depth and velocity are received
+    bool IsReady(uint32_t frameId) const;
+
+    // Token fell out of the ring, its slot was reused by a newer frame
+    static bool IsStale(uint32_t frameId, uint32_t currentFrameId) { return frameId + SlotCount <= currentFrameId; }
+
+    void Reset();
+};
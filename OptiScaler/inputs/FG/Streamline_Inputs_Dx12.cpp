@@ -23,7 +23,7 @@ void Sl_Inputs_Dx12::CheckForFrame(IFGFeature_Dx12* fg, uint32_t frameId)
         else
             _currentFrameId = _lastFrameId + 1;
 
-        _frameIdIndex[_currentIndex] = _currentFrameId;
+        _frameRing.Claim(_currentFrameId, _currentIndex);
     }
     else if (frameId != 0 && frameId > _currentFrameId)
     {
@@ -36,19 +36,14 @@ void Sl_Inputs_Dx12::CheckForFrame(IFGFeature_Dx12* fg, uint32_t frameId)
         fg->StartNewFrame();
         _currentIndex = fg->GetIndex();
         _currentFrameId = frameId;
-        _frameIdIndex[_currentIndex] = _currentFrameId;
+        _frameRing.Claim(_currentFrameId, _currentIndex);
     }
 }
 
-int Sl_Inputs_Dx12::IndexForFrameId(uint32_t frameId) const
+uint32_t Sl_Inputs_Dx12::ResolveFrameId(uint32_t frameId) const
 {
-    for (int i = 0; i < BUFFER_COUNT; i++)
-    {
-        if (_frameIdIndex[i] == frameId)
-            return i;
-    }
-
-    return -1;
+    // Untokenized calls belong to the frame started by CheckForFrame
+    return frameId != 0 ? frameId : _currentFrameId;
 }
 
 bool Sl_Inputs_Dx12::setConstants(const sl::Constants& values, uint32_t frameId)
@@ -83,6 +78,8 @@ bool Sl_Inputs_Dx12::setConstants(const sl::Constants& values, uint32_t frameId)
 
     if (dataFound)
     {
+        _frameRing.Mark(ResolveFrameId(frameId), SlInput_Constants);
+
         auto config = Config::Instance();
 
         // FG Evaluate part
@@ -321,12 +318,18 @@ bool Sl_Inputs_Dx12::reportResource(const sl::ResourceTag& tag, ID3D12GraphicsCo
 
     if (frameId > 0)
     {
-        int index = IndexForFrameId(frameId);
+        int index = _frameRing.IndexOf(frameId);
 
         if (index >= 0)
         {
             res.frameIndex = index;
         }
+        else if (Sl_FrameRing::IsStale(frameId, _currentFrameId))
+        {
+            LOG_WARN("Stale frame ID {} (current: {}), using current index {}", frameId, _currentFrameId,
+                     _currentIndex);
+            res.frameIndex = _currentIndex;
+        }
         else
         {
             LOG_WARN("Frame ID {} not found in tracking, using current index {}", frameId, _currentIndex);
@@ -421,21 +424,72 @@ bool Sl_Inputs_Dx12::reportResource(const sl::ResourceTag& tag, ID3D12GraphicsCo
         handled = false;
     }
 
+    if (handled)
+    {
+        auto slotFrameId = ResolveFrameId(frameId);
+
+        switch (res.type)
+        {
+        case FG_ResourceType::Depth:
+            _frameRing.Mark(slotFrameId, SlInput_Depth);
+            break;
+        case FG_ResourceType::Velocity:
+            _frameRing.Mark(slotFrameId, SlInput_Velocity);
+            break;
+        case FG_ResourceType::HudlessColor:
+            _frameRing.Mark(slotFrameId, SlInput_Hudless);
+            break;
+        case FG_ResourceType::UIColor:
+            _frameRing.Mark(slotFrameId, SlInput_UI);
+            break;
+        default:
+            break;
+        }
+    }
+
     return handled;
 }
 
-bool Sl_Inputs_Dx12::dispatchFG()
+bool Sl_Inputs_Dx12::dispatchFG(uint32_t frameId)
 {
-    LOG_FUNC();
+    uint32_t inputs = 0;
+
+    if (!_frameRing.Inputs(frameId, inputs))
+    {
+        LOG_DEBUG("frameId: {} is not tracked", frameId);
+        return false;
+    }
+
+    if ((inputs & SlInput_Present) == 0)
+    {
+        LOG_DEBUG("frameId: {} is not presented yet", frameId);
+        return false;
+    }
+
+    if ((inputs & SlInput_Required) != SlInput_Required)
+    {
+        LOG_DEBUG("frameId: {} presented without all required inputs: {:X}", frameId, inputs);
+        return false;
+    }
+
     return true;
 }
 
 void Sl_Inputs_Dx12::markPresent(uint64_t frameId)
 {
-    std::scoped_lock lock(_frameBoundaryMutex);
     LOG_TRACE("frameId: {}", frameId);
-    _isFrameFinished = true;
-    _lastFrameId = static_cast<uint32_t>(frameId);
+
+    auto presentedId = static_cast<uint32_t>(frameId);
+
+    {
+        std::scoped_lock lock(_frameBoundaryMutex);
+        _isFrameFinished = true;
+        _lastFrameId = presentedId;
+    }
+
+    // Token is checked with the inputs in one word, no need to hold the frame boundary
+    _frameRing.Mark(presentedId, SlInput_Present);
+    _presentedFrameReady.store(dispatchFG(presentedId), std::memory_order_release);
 
     if (State::Instance().currentFG != nullptr)
         State::Instance().currentFG->SetFrameCount(frameId);
@@ -2,6 +2,7 @@
 #include "SysUtils.h"
 #include <sl.h>
 #include <framegen/IFGFeature_Dx12.h>
+#include "Streamline_FrameRing.h"
 
 class Sl_Inputs_Dx12
 {
@@ -15,21 +16,30 @@ class Sl_Inputs_Dx12
     uint32_t _currentFrameId = 0;
     uint32_t _currentIndex = -1;
     uint32_t _lastFrameId = UINT32_MAX;
-    uint32_t _frameIdIndex[BUFFER_COUNT] = { UINT32_MAX, UINT32_MAX, UINT32_MAX, UINT32_MAX };
+    Sl_FrameRing _frameRing;
+    std::atomic<bool> _presentedFrameReady { false };
 
     uint64_t mvsWidth = 0;
     uint32_t mvsHeight = 0;
 
     void CheckForFrame(IFGFeature_Dx12* fg, uint32_t frameId);
-    int IndexForFrameId(uint32_t frameId) const;
+    uint32_t ResolveFrameId(uint32_t frameId) const;
 
   public:
     bool setConstants(const sl::Constants& constants, uint32_t frameId);
     bool evaluateState(ID3D12Device* device);
     bool reportResource(const sl::ResourceTag& tag, ID3D12GraphicsCommandList* cmdBuffer, uint32_t frameId);
     void reportEngineType(sl::EngineType type) { engineType = type; };
-    bool dispatchFG();
+
+    // Presented frame token with all required inputs, logs what is missing otherwise
+    bool dispatchFG(uint32_t frameId);
     void markPresent(uint64_t frameId);
 
+    // dispatchFG result of the last marked present, FG skips dispatching the frame when false
+    bool IsPresentedFrameReady() const { return _presentedFrameReady.load(std::memory_order_acquire); }
+
+    // Lock-free check of required inputs (constants, depth, velocity) for a frame token
+    bool IsFrameReady(uint32_t frameId) const { return _frameRing.IsReady(frameId); }
+
     // TODO: some shutdown and cleanup methods
 };
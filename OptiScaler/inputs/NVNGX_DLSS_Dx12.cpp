@@ -14,6 +14,7 @@
 #include "FG/Upscaler_Inputs_Dx12.h"
 
 #include <upscaler_time/UpscalerTime_Dx12.h>
+#include <shaders/DescriptorRing_Dx12.h>
 
 #include <hooks/D3D12_Hooks.h>
 
@@ -26,6 +27,7 @@ static ankerl::unordered_dense::map<unsigned int, ContextData<IFeature_Dx12>> Dx
 
 static ID3D12Device* D3D12Device = nullptr;
 static int evalCounter = 0;
+static ID3D12GraphicsCommandList* lastEvaluateCmdList = nullptr;
 static std::wstring appDataPath = L".";
 static bool shutdown = false;
 static inline bool _skipInit = false;
@@ -812,6 +814,11 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_D3D12_EvaluateFeature(ID3D12GraphicsCom
         D3D12Hooks::SetRootSignatureTracking(false);
     }
 
+    // Passes of the previous evaluate were recorded to game's command list, it's submitted by now.
+    // Closed before this evaluate records anything, game might reuse the same list
+    DescriptorRing_Dx12::GameListSubmitted(State::Instance().currentCommandQueue, lastEvaluateCmdList);
+    lastEvaluateCmdList = InCmdList;
+
     UpscalerInputsDx12::UpscaleStart(InCmdList, InParameters, deviceContext->feature.get());
     FSR3FG::SetUpscalerInputs(InCmdList, InParameters, deviceContext->feature.get());
 
@@ -811,6 +811,8 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_VULKAN_ReleaseFeature(NVSDK_NGX_Handle*
         if (deviceContext == State::Instance().currentFeature)
             State::Instance().currentFeature = nullptr;
 
+        FeatureProvider_Vk::Forget(deviceContext);
+
         vkDeviceWaitIdle(vkDevice);
         std::this_thread::sleep_for(std::chrono::milliseconds(500));
 
@@ -913,6 +915,7 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_VULKAN_EvaluateFeature(VkCommandBuffer
     UpscalerTimeVk::UpscaleStart(InCmdList);
 
     auto upscaleResult = deviceContext->Evaluate(InCmdList, InParameters);
+    FeatureProvider_Vk::Evaluated(deviceContext, vkDevice, InCmdList);
 
     if ((!upscaleResult || !deviceContext->IsInited()) &&
         Config::Instance()->VulkanUpscaler.value_or_default() != "fsr22")
@@ -938,6 +941,8 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_VULKAN_Shutdown(void)
 
     // VkContexts.clear();
 
+    FeatureProvider_Vk::FlushRetired();
+
     vkInstance = nullptr;
     vkPD = nullptr;
     vkDevice = nullptr;
@@ -967,6 +972,8 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_VULKAN_Shutdown1(VkDevice InDevice)
 {
     shutdown = true;
 
+    FeatureProvider_Vk::FlushRetired();
+
     if (Config::Instance()->DLSSEnabled.value_or_default() && NVNGXProxy::IsVulkanInited() &&
         NVNGXProxy::VULKAN_Shutdown1() != nullptr)
     {
@@ -1,5 +1,6 @@
 ﻿#include "pch.h"
 #include "menu_common.h"
+#include "menu_frame_gate.h"
 
 #include "font/Hack_Compressed.h"
 
@@ -13,6 +14,12 @@
 
 #include <nvapi/fakenvapi.h>
 #include <hooks/Reflex_Hooks.h>
+#include <hooks/Reflex_Analytics.h>
+#include <resource_tracking/ResTrack_Trace.h>
+#include <misc/FrameStats.h>
+#include <misc/BenchmarkCapture.h>
+#include <misc/DynamicResolution.h>
+#include <misc/OptimalSettings.h>
 
 #include <version_check.h>
 
@@ -38,6 +45,7 @@ static bool inputMenu = false;
 static bool inputFG = false;
 static bool inputFps = false;
 static bool inputFpsCycle = false;
+static bool inputBenchmark = false;
 static bool hasGamepad = false;
 static bool fsr31InitTried = false;
 static bool xefgInitTried = false;
@@ -795,6 +803,10 @@ LRESULT MenuCommon::WndProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam)
             if (!inputFpsCycle)
                 inputFpsCycle =
                     rawData.data.keyboard.VKey == Config::Instance()->FpsCycleShortcutKey.value_or_default();
+
+            if (!inputBenchmark)
+                inputBenchmark =
+                    rawData.data.keyboard.VKey == Config::Instance()->BenchmarkShortcutKey.value_or_default();
         }
     }
 
@@ -813,6 +825,9 @@ LRESULT MenuCommon::WndProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam)
     if (!inputFpsCycle)
         inputFpsCycle = msg == WM_KEYUP && wParam == Config::Instance()->FpsCycleShortcutKey.value_or_default();
 
+    if (!inputBenchmark)
+        inputBenchmark = msg == WM_KEYUP && wParam == Config::Instance()->BenchmarkShortcutKey.value_or_default();
+
     // SHIFT + DEL - Debug dump
     if (msg == WM_KEYUP && wParam == VK_DELETE && (GetKeyState(VK_SHIFT) & 0x8000))
     {
@@ -969,6 +984,7 @@ void KeyUp(UINT vKey)
     inputFps = vKey == Config::Instance()->FpsShortcutKey.value_or_default();
     inputFG = vKey == Config::Instance()->FGShortcutKey.value_or_default();
     inputFpsCycle = vKey == Config::Instance()->FpsCycleShortcutKey.value_or_default();
+    inputBenchmark = vKey == Config::Instance()->BenchmarkShortcutKey.value_or_default();
 }
 
 std::string MenuCommon::GetBackendName(std::string* code)
@@ -1448,6 +1464,72 @@ inline static std::string GetDispatchString(UINT source)
 static double lastTime = 0.0;
 static UINT64 uwpTargetFrame = 0;
 
+// Frame time history is kept while nothing is drawn, so FPS overlay averages are ready when it is shown
+static double TrackFrameTime(double now)
+{
+    double frameTime = 0.0;
+
+    if (lastTime > 0.0)
+        frameTime = now - lastTime;
+
+    lastTime = now;
+
+    State::Instance().frameTimes.pop_front();
+    State::Instance().frameTimes.push_back(frameTime);
+
+    FrameStats::Add(frameTime, State::Instance().presentIsGenerated);
+
+    if (DynamicResolution::IsEnabled())
+    {
+        auto& state = State::Instance();
+        double upscalerMs = 0.0;
+        float renderScale = 0.0f;
+
+        if (state.frameTimeMutex.try_lock())
+        {
+            if (!state.upscaleTimes.empty())
+                upscalerMs = state.upscaleTimes.back();
+
+            state.frameTimeMutex.unlock();
+        }
+
+        if (auto feature = state.currentFeature; feature != nullptr && feature->DisplayWidth() > 0)
+            renderScale = (float) feature->RenderWidth() / (float) feature->DisplayWidth();
+
+        DynamicResolution::FramePresented(frameTime, state.presentIsGenerated, upscalerMs, renderScale);
+    }
+
+    return frameTime;
+}
+
+bool MenuCommon::SkipFrame()
+{
+    if (!_isInited)
+        return true;
+
+    auto config = Config::Instance();
+    auto now = Util::MillisecondsNow();
+
+    // Same conditions RenderMenu uses to start an ImGui frame, plus anything which can change them this frame
+    OverlayFrameState frameState {};
+    frameState.menuVisible = _isVisible;
+    frameState.fpsOverlay = config->ShowFps.value_or_default();
+    frameState.shortcutPending = inputMenu || inputFps || inputFG || inputFpsCycle || inputBenchmark;
+    frameState.splashDisabled = config->DisableSplash.value_or_default();
+    frameState.splashStart = splashStart;
+    frameState.splashLimit = splashLimit;
+    frameState.updateNoticeVisible = updateNoticeVisible;
+    frameState.updateNoticePending = State::Instance().updateNoticePending.load(std::memory_order_acquire);
+
+    if (OverlayFrameNeeded(frameState, now))
+        return false;
+
+    _frameCount++;
+    TrackFrameTime(now);
+
+    return true;
+}
+
 bool MenuCommon::RenderMenu()
 {
     if (!_isInited)
@@ -1460,19 +1542,11 @@ bool MenuCommon::RenderMenu()
 
     // FPS & frame time calculation
     auto now = Util::MillisecondsNow();
-    double frameTime = 0.0;
+    double frameTime = TrackFrameTime(now);
     double frameRate = 0.0;
 
-    if (lastTime > 0.0)
-    {
-        frameTime = now - lastTime;
+    if (frameTime > 0.0)
         frameRate = 1000.0 / frameTime;
-    }
-
-    lastTime = now;
-
-    state.frameTimes.pop_front();
-    state.frameTimes.push_back(frameTime);
 
     ImGuiIO& io = ImGui::GetIO();
     (void) io;
@@ -1512,6 +1586,12 @@ bool MenuCommon::RenderMenu()
             }
         }
 
+        if (inputBenchmark)
+        {
+            inputBenchmark = false;
+            BenchmarkCapture::Toggle();
+        }
+
         if (inputFps)
         {
             inputFps = false;
@@ -1586,6 +1666,10 @@ bool MenuCommon::RenderMenu()
         versionStatus.latestTag = state.latestVersionTag;
         versionStatus.latestUrl = state.latestVersionUrl;
         versionStatus.error = state.versionCheckError;
+
+        // Pending notice is taken below, hidden frames can be skipped again after it
+        if (versionStatus.completed)
+            state.updateNoticePending.store(false, std::memory_order_relaxed);
     }
 
     const auto& currentVersionText = VersionCheck::CurrentVersionString();
@@ -1772,18 +1856,7 @@ bool MenuCommon::RenderMenu()
 
     if (config->ShowFps.value_or_default() || _isVisible)
     {
-        float frameCnt = 0;
-        frameTime = 0;
-        for (size_t i = 299; i > 199; i--)
-        {
-            if (state.frameTimes[i] > 0.0)
-            {
-                frameTime += state.frameTimes[i];
-                frameCnt++;
-            }
-        }
-
-        frameTime /= frameCnt;
+        frameTime = FrameStats::ShortMeanMs();
         frameRate = 1000.0 / frameTime;
         frameTimesCalculated = true;
 
@@ -1945,7 +2018,10 @@ bool MenuCommon::RenderMenu()
                     ImGui::Spacing();
                 }
 
-                secondLine = StrFmt("Frame Time: %7.2f ms, Avg: %7.2f ms", state.frameTimes.back(), averageFrameTime);
+                auto stats = FrameStats::Summary();
+                secondLine = StrFmt("Frame Time: %7.2f ms, Avg: %7.2f ms, 1%% Low: %6.1f, 0.1%% Low: %6.1f",
+                                    state.frameTimes.back(), averageFrameTime, stats.displayed.low1,
+                                    stats.displayed.low01);
             }
 
             // Prepare Line 3
@@ -2060,6 +2136,14 @@ bool MenuCommon::RenderMenu()
 
                     ImGui::Text("Reflex timings, whole frame: %.1fms", rangeInNs / 1000.0);
 
+                    // Averages of last 64 reported frames
+                    auto avgLatency = ReflexAnalytics::StageMeanUs(LatencyStage::Total);
+                    auto avgGpu = ReflexAnalytics::StageMeanUs(LatencyStage::GpuRender);
+
+                    if (avgLatency.has_value() && avgGpu.has_value())
+                        ImGui::Text("Average latency: %.1fms, gpu: %.1fms", avgLatency.value() / 1000.0,
+                                    avgGpu.value() / 1000.0);
+
                     const auto maxWidth =
                         config->FpsOverlayHorizontal.value_or_default() ? ImGui::GetWindowWidth() : plotSize.x;
 
@@ -2143,18 +2227,7 @@ bool MenuCommon::RenderMenu()
         // If overlay is not visible frame needs to be inited
         if (!frameTimesCalculated)
         {
-            float frameCnt = 0;
-            frameTime = 0;
-            for (size_t i = 299; i > 199; i--)
-            {
-                if (state.frameTimes[i] > 0.0)
-                {
-                    frameTime += state.frameTimes[i];
-                    frameCnt++;
-                }
-            }
-
-            frameTime /= frameCnt;
+            frameTime = FrameStats::ShortMeanMs();
             frameRate = 1000.0 / frameTime;
         }
 
@@ -3907,6 +3980,16 @@ bool MenuCommon::RenderMenu()
                                            "Helps games which use black borders for some \n"
                                            "resolutions and screen ratios (e.g. Witcher 3)");
 
+                            auto scoring = config->FGHudfixScoring.value_or_default();
+                            if (ImGui::Checkbox("Candidate Ranking", &scoring))
+                            {
+                                config->FGHudfixScoring = scoring;
+                                LOG_DEBUG("Enabled set FGHudfixScoring: {}", scoring);
+                            }
+                            ShowHelpMarker("Rank Hudless candidates over frames and only copy\n"
+                                           "the best one once ranking is stable\n\n"
+                                           "Only used when Limit is 1 and lists are not active");
+
                             ImGui::BeginDisabled(state.FGresetCapturedResources);
                             ImGui::PushItemWidth(95.0f * menuResScale);
                             if (ImGui::Checkbox("FG Create List", &state.FGcaptureResources))
@@ -4021,6 +4104,25 @@ bool MenuCommon::RenderMenu()
                                 ShowHelpMarker("Disable tracking of Dispatch\n"
                                                "This might help filtering of wrong Hudless resources");
 
+                                ImGui::Spacing();
+
+                                auto recording = ResTrack_Trace::IsRecording();
+                                ImGui::BeginDisabled(recording);
+
+                                if (ImGui::Button(recording ? "Recording..." : "Record Tracking Trace"))
+                                {
+                                    auto& scDesc = state.currentSwapchainDesc;
+                                    ResTrack_Trace::Start(ResTrack_Trace::DefaultPath(),
+                                                          config->FGTrackingTraceFrames.value_or_default(),
+                                                          scDesc.BufferDesc.Width, scDesc.BufferDesc.Height,
+                                                          (uint32_t) scDesc.BufferDesc.Format);
+                                }
+
+                                ImGui::EndDisabled();
+                                ShowHelpMarker("Records resource tracking calls of next frames\n"
+                                               "to OptiScaler.rttrace for offline replay\n"
+                                               "with restrack_replay from the tests project");
+
                                 ImGui::TreePop();
                             }
 
@@ -4596,6 +4698,8 @@ bool MenuCommon::RenderMenu()
 
                         if (upOverride)
                             config->QualityRatioOverrideEnabled = false;
+
+                        OptimalSettings::ConfigChanged();
                     }
                     ShowHelpMarker("Lets you override every upscaler preset\n"
                                    "with a value set below\n\n"
@@ -4609,6 +4713,8 @@ bool MenuCommon::RenderMenu()
 
                         if (qOverride)
                             config->UpscaleRatioOverrideEnabled = false;
+
+                        OptimalSettings::ConfigChanged();
                     }
 
                     ShowHelpMarker("Lets you override each preset's ratio individually\n"
@@ -4619,35 +4725,57 @@ bool MenuCommon::RenderMenu()
                     if (config->UpscaleRatioOverrideEnabled.value_or_default())
                     {
                         float urOverride = config->UpscaleRatioOverrideValue.value_or_default();
-                        ImGui::SliderFloat("All Ratios", &urOverride, minSliderLimit, maxSliderLimit, "%.3f");
+                        bool changed =
+                            ImGui::SliderFloat("All Ratios", &urOverride, minSliderLimit, maxSliderLimit, "%.3f");
                         config->UpscaleRatioOverrideValue = urOverride;
+
+                        if (changed)
+                            OptimalSettings::ConfigChanged();
                     }
 
                     if (config->QualityRatioOverrideEnabled.value_or_default())
                     {
                         float qDlaa = config->QualityRatio_DLAA.value_or_default();
                         if (ImGui::SliderFloat("DLAA", &qDlaa, minSliderLimit, maxSliderLimit, "%.3f"))
+                        {
                             config->QualityRatio_DLAA = qDlaa;
+                            OptimalSettings::ConfigChanged();
+                        }
 
                         float qUq = config->QualityRatio_UltraQuality.value_or_default();
                         if (ImGui::SliderFloat("Ultra Quality", &qUq, minSliderLimit, maxSliderLimit, "%.3f"))
+                        {
                             config->QualityRatio_UltraQuality = qUq;
+                            OptimalSettings::ConfigChanged();
+                        }
 
                         float qQ = config->QualityRatio_Quality.value_or_default();
                         if (ImGui::SliderFloat("Quality", &qQ, minSliderLimit, maxSliderLimit, "%.3f"))
+                        {
                             config->QualityRatio_Quality = qQ;
+                            OptimalSettings::ConfigChanged();
+                        }
 
                         float qB = config->QualityRatio_Balanced.value_or_default();
                         if (ImGui::SliderFloat("Balanced", &qB, minSliderLimit, maxSliderLimit, "%.3f"))
+                        {
                             config->QualityRatio_Balanced = qB;
+                            OptimalSettings::ConfigChanged();
+                        }
 
                         float qP = config->QualityRatio_Performance.value_or_default();
                         if (ImGui::SliderFloat("Performance", &qP, minSliderLimit, maxSliderLimit, "%.3f"))
+                        {
                             config->QualityRatio_Performance = qP;
+                            OptimalSettings::ConfigChanged();
+                        }
 
                         float qUp = config->QualityRatio_UltraPerformance.value_or_default();
                         if (ImGui::SliderFloat("Ultra Performance", &qUp, minSliderLimit, maxSliderLimit, "%.3f"))
+                        {
                             config->QualityRatio_UltraPerformance = qUp;
+                            OptimalSettings::ConfigChanged();
+                        }
                     }
 
                     if (currentFeature != nullptr && !currentFeature->IsFrozen())
@@ -4947,7 +5075,10 @@ bool MenuCommon::RenderMenu()
                     {
                         bool extendedLimits = config->ExtendedLimits.value_or_default();
                         if (ImGui::Checkbox("Enable Extended Limits", &extendedLimits))
+                        {
                             config->ExtendedLimits = extendedLimits;
+                            OptimalSettings::ConfigChanged();
+                        }
 
                         ShowHelpMarker("Extended sliders limit for quality presets\n\n"
                                        "Using this option changes resolution detection logic\n"
@@ -4969,18 +5100,53 @@ bool MenuCommon::RenderMenu()
                         ImGui::TableNextColumn();
                         if (bool drsMin = config->DrsMinOverrideEnabled.value_or_default();
                             ImGui::Checkbox("Override Minimum", &drsMin))
+                        {
                             config->DrsMinOverrideEnabled = drsMin;
+                            OptimalSettings::ConfigChanged();
+                        }
                         ShowHelpMarker("Fix for games ignoring official DRS limits");
 
                         ImGui::TableNextColumn();
                         if (bool drsMax = config->DrsMaxOverrideEnabled.value_or_default();
                             ImGui::Checkbox("Override Maximum", &drsMax))
+                        {
                             config->DrsMaxOverrideEnabled = drsMax;
+                            OptimalSettings::ConfigChanged();
+                        }
                         ShowHelpMarker("Fix for games ignoring official DRS limits");
 
+                        ImGui::TableNextColumn();
+                        if (bool drsController = config->DrsControllerEnabled.value_or_default();
+                            ImGui::Checkbox("Dynamic Resolution", &drsController))
+                        {
+                            config->DrsControllerEnabled = drsController;
+
+                            if (!drsController)
+                                DynamicResolution::Reset();
+                        }
+                        ShowHelpMarker("Advertise a render resolution which holds the target frame time\n"
+                                       "Only games which query optimal settings again will follow it");
+
                         ImGui::EndTable();
                     }
 
+                    if (config->DrsControllerEnabled.value_or_default())
+                    {
+                        float targetFrameTime = config->DrsTargetFrameTime.value_or_default();
+                        ImGui::PushItemWidth(180.0f * menuResScale);
+
+                        if (ImGui::SliderFloat("Target Frame Time", &targetFrameTime, 2.0f, 100.0f, "%.2f ms"))
+                            config->DrsTargetFrameTime = targetFrameTime;
+
+                        ImGui::PopItemWidth();
+
+                        if (auto scale = DynamicResolution::CurrentScale(); scale > 0.0f)
+                        {
+                            ImGui::Text("Scale: %.3f, Rendered frame time: %.2f ms", scale,
+                                        DynamicResolution::FilteredMs());
+                        }
+                    }
+
                     // Non-DLSS hotfixes -----------------------------
                     if (currentFeature != nullptr && !currentFeature->IsFrozen() && currentBackend != "dlss")
                     {
@@ -5131,6 +5297,83 @@ bool MenuCommon::RenderMenu()
                         else
                             config->FpsScale = values[currentIndex];
                     }
+
+                    ImGui::Spacing();
+                    auto stats = FrameStats::Summary();
+                    ImGui::Text("Last %u frames, %u generated", (UINT) stats.displayed.samples, (UINT) stats.generated);
+                    ImGui::Text("Displayed p50: %.2f, p95: %.2f, p99: %.2f ms, 1%% Low: %.1f, 0.1%% Low: %.1f FPS",
+                                stats.displayed.p50, stats.displayed.p95, stats.displayed.p99, stats.displayed.low1,
+                                stats.displayed.low01);
+
+                    if (stats.generated > 0)
+                    {
+                        ImGui::Text("Rendered p50: %.2f, p95: %.2f, p99: %.2f ms, 1%% Low: %.1f, 0.1%% Low: %.1f FPS",
+                                    stats.rendered.p50, stats.rendered.p95, stats.rendered.p99, stats.rendered.low1,
+                                    stats.rendered.low01);
+                    }
+
+                    ImGui::Text("Stutters: %u in window, %llu total", (UINT) stats.displayed.stutters,
+                                stats.totalStutters);
+                    ShowHelpMarker("Frames longer than 2x the median frame time");
+
+                    if (ImGui::Button("Export Frame Times"))
+                        FrameStats::ExportCsv(FrameStats::DefaultCsvPath());
+
+                    ShowTooltip("Writes frame times of the window to OptiScaler_FrameStats.csv next to OptiScaler");
+
+                    ImGui::SameLine(0.0f, 6.0f);
+
+                    if (ImGui::Button("Reset Stats"))
+                        FrameStats::Reset();
+
+                    ImGui::Spacing();
+
+                    if (BenchmarkCapture::IsCapturing())
+                    {
+                        if (ImGui::Button("Stop Benchmark"))
+                            BenchmarkCapture::Stop();
+
+                        ImGui::SameLine(0.0f, 6.0f);
+                        ImGui::Text("Capturing, %u frames", BenchmarkCapture::CapturedFrames());
+                    }
+                    else
+                    {
+                        ImGui::BeginDisabled(BenchmarkCapture::IsStarting() || BenchmarkCapture::IsFinishing());
+
+                        if (ImGui::Button("Start Benchmark"))
+                            BenchmarkCapture::Start();
+
+                        ImGui::EndDisabled();
+
+                        ShowTooltip("Captures per frame timings to OptiScaler_Benchmark_*.csv and .json "
+                                    "next to OptiScaler");
+
+                        if (BenchmarkCapture::CapturedFrames() > 0)
+                        {
+                            ImGui::SameLine(0.0f, 6.0f);
+                            ImGui::Text(BenchmarkCapture::IsFinishing() ? "Writing %u frames"
+                                                                        : "Last capture %u frames",
+                                        BenchmarkCapture::CapturedFrames());
+                        }
+                    }
+
+                    auto benchmarkFrames = config->BenchmarkFrames.value_or_default();
+                    auto benchmarkDuration = config->BenchmarkDuration.value_or_default();
+
+                    ImGui::BeginDisabled(BenchmarkCapture::IsCapturing());
+                    ImGui::PushItemWidth(95.0f * menuResScale);
+
+                    if (ImGui::InputInt("Frames", &benchmarkFrames, 100, 1000))
+                        config->BenchmarkFrames = std::clamp(benchmarkFrames, 0, 1000000);
+
+                    ShowHelpMarker("0 = Use duration");
+                    ImGui::SameLine(0.0f, 6.0f);
+
+                    if (ImGui::InputInt("Seconds", &benchmarkDuration, 10, 60))
+                        config->BenchmarkDuration = std::clamp(benchmarkDuration, 1, 3600);
+
+                    ImGui::PopItemWidth();
+                    ImGui::EndDisabled();
                 }
 
                 // UPSCALER INPUTS -----------------------------
@@ -5441,11 +5684,13 @@ bool MenuCommon::RenderMenu()
                     static auto fpsOverlay = Keybind("FPS Overlay", 11);
                     static auto fpsOverlayCycle = Keybind("FPS Overlay Cycle", 12);
                     static auto fgEnable = Keybind("Frame Generation", 13);
+                    static auto benchmark = Keybind("Benchmark Capture", 14);
 
                     menu.Render(config->ShortcutKey);
                     fpsOverlay.Render(config->FpsShortcutKey);
                     fpsOverlayCycle.Render(config->FpsCycleShortcutKey);
                     fgEnable.Render(config->FGShortcutKey);
+                    benchmark.Render(config->BenchmarkShortcutKey);
                 }
 
                 ImGui::EndTable();
@@ -5647,7 +5892,11 @@ bool MenuCommon::RenderMenu()
 
                     const char* q[] = { "Ultra Performance", "Performance",   "Balanced",
                                         "Quality",           "Ultra Quality", "DLAA" };
-                    float fr[] = { 3.0f, 2.0f, 1.7f, 1.5f, 1.3f, 1.0f };
+                    const NVSDK_NGX_PerfQuality_Value qv[] = {
+                        NVSDK_NGX_PerfQuality_Value_UltraPerformance, NVSDK_NGX_PerfQuality_Value_MaxPerf,
+                        NVSDK_NGX_PerfQuality_Value_Balanced,         NVSDK_NGX_PerfQuality_Value_MaxQuality,
+                        NVSDK_NGX_PerfQuality_Value_UltraQuality,     NVSDK_NGX_PerfQuality_Value_DLAA
+                    };
                     auto configQ = _mipmapUpscalerQuality;
 
                     const char* selectedQ = q[configQ];
@@ -5662,40 +5911,15 @@ bool MenuCommon::RenderMenu()
                             {
                                 _mipmapUpscalerQuality = n;
 
-                                float ov = -1.0f;
+                                // Same table NGX optimal settings callbacks use
+                                auto modes = OptimalSettings::Modes(OptimalSettingsFeature::DLSS, _displayWidth,
+                                                                    currentFeature->DisplayHeight());
+                                auto& mode = modes[qv[n]];
 
-                                if (config->QualityRatioOverrideEnabled.value_or_default())
-                                {
-                                    switch (n)
-                                    {
-                                    case 0:
-                                        ov = config->QualityRatio_UltraPerformance.value_or(-1.0f);
-                                        break;
-
-                                    case 1:
-                                        ov = config->QualityRatio_Performance.value_or(-1.0f);
-                                        break;
-
-                                    case 2:
-                                        ov = config->QualityRatio_Balanced.value_or(-1.0f);
-                                        break;
-
-                                    case 3:
-                                        ov = config->QualityRatio_Quality.value_or(-1.0f);
-                                        break;
-
-                                    case 4:
-                                        ov = config->QualityRatio_UltraQuality.value_or(-1.0f);
-                                        break;
-                                    }
-                                }
-
-                                if (ov > 0.0f)
-                                    _mipmapUpscalerRatio = ov;
-                                else
-                                    _mipmapUpscalerRatio = fr[n];
+                                if (mode.renderWidth > 0)
+                                    _mipmapUpscalerRatio = (float) _displayWidth / (float) mode.renderWidth;
 
-                                _renderWidth = static_cast<uint32_t>(_displayWidth / _mipmapUpscalerRatio);
+                                _renderWidth = mode.renderWidth;
                                 _mipBiasCalculated = log2((float) _renderWidth / (float) _displayWidth);
                             }
                         }
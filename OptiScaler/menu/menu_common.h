@@ -196,6 +196,8 @@ class MenuCommon
     static bool IsVisible() { return _isVisible; }
     static HWND Handle() { return _handle; }
 
+    // True when RenderMenu would not draw anything this frame, backends can skip their frame setup
+    static bool SkipFrame();
     static bool RenderMenu();
     static void Init(HWND InHwnd, bool isUWP);
     static void Shutdown();
@@ -0,0 +1,36 @@
+#pragma once
+
+// What can make MenuCommon::RenderMenu draw on a present
+//
+// MenuCommon::SkipFrame fills this from the menu state, overlays skip ImGui backend frame setup, RenderMenu and
+// their command submission only when nothing here needs a frame. Kept free of ImGui and Config so it can be
+// checked on its own.
+
+struct OverlayFrameState
+{
+    bool menuVisible = false;
+    bool fpsOverlay = false;
+    bool shortcutPending = false; // Menu, FPS, FG, FPS cycle or benchmark key waiting to be handled
+
+    bool splashDisabled = false;
+    double splashStart = 0.0;
+    double splashLimit = 0.0; // Below 1 until RenderMenu schedules the splash
+
+    bool updateNoticeVisible = false;
+    bool updateNoticePending = false; // Version check found an update, RenderMenu hasn't taken it yet
+};
+
+inline bool OverlayFrameNeeded(const OverlayFrameState& state, double now)
+{
+    if (state.menuVisible || state.fpsOverlay || state.shortcutPending)
+        return true;
+
+    // Splash is scheduled by the first RenderMenu even when it's disabled
+    if (state.splashLimit < 1.0)
+        return true;
+
+    if (!state.splashDisabled && now > state.splashStart && now < state.splashLimit)
+        return true;
+
+    return state.updateNoticeVisible || state.updateNoticePending;
+}
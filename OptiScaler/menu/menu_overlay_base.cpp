@@ -30,6 +30,14 @@ void MenuOverlayBase::Init(HWND InHandle, bool isUWP)
     MenuCommon::Init(InHandle, isUWP);
 }
 
+bool MenuOverlayBase::SkipFrame()
+{
+    if (!Config::Instance()->OverlayMenu.value_or_default())
+        return true;
+
+    return MenuCommon::SkipFrame();
+}
+
 bool MenuOverlayBase::RenderMenu()
 {
     if (!Config::Instance()->OverlayMenu.value_or_default())
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+// Decides when the overlay has to resolve its objects from the presenting swapchain again
+//
+// Objects are tied to the swapchain, present device and window of the present they were resolved for.
+// Invalidate is called from other threads (ResizeBuffers, swapchain release, device loss), it bumps a
+// generation. Resolved stores the generation taken before resolving, so an invalidation which comes in
+// while resolving is not lost.
+
+class OverlayContextCache
+{
+  private:
+    const void* _swapChain = nullptr;
+    const void* _device = nullptr;
+    const void* _window = nullptr;
+    uint64_t _resolvedGeneration = 0;
+    std::atomic<uint64_t> _generation { 1 }; // Nothing resolved yet
+
+  public:
+    uint64_t Generation() const { return _generation.load(std::memory_order_acquire); }
+
+    bool NeedsResolve(const void* swapChain, const void* device, const void* window) const
+    {
+        return _resolvedGeneration != Generation() || _swapChain != swapChain || _device != device ||
+               _window != window;
+    }
+
+    void Resolved(const void* swapChain, const void* device, const void* window, uint64_t generation)
+    {
+        _swapChain = swapChain;
+        _device = device;
+        _window = window;
+        _resolvedGeneration = generation;
+    }
+
+    void Invalidate() { _generation.fetch_add(1, std::memory_order_acq_rel); }
+};
@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "menu_overlay_base.h"
 #include "menu_overlay_dx.h"
+#include "menu_overlay_context.h"
 
 #include <Util.h>
 #include <Logger.h>
@@ -42,6 +43,21 @@ static bool _d3d12Captured = false;
 // for showing
 static bool _showRenderImGuiDebugOnce = true;
 
+// Objects resolved from the presenting swapchain, kept until resize, swapchain release, device loss or window change.
+// Not AddRef'd, swapchain keeps its device and queue alive.
+struct OverlayContext
+{
+    ID3D11Device* device11 = nullptr;
+
+    ID3D12CommandQueue* queue = nullptr;
+    IUnknown* realQueue = nullptr; // Streamline proxy resolved
+    ID3D12Device* device12 = nullptr;
+    IDXGISwapChain3* swapChain3 = nullptr;
+};
+
+static OverlayContext _context {};
+static OverlayContextCache _contextCache {};
+
 static IID streamlineRiid {};
 static bool CheckForRealObject(std::string functionName, IUnknown* pObject, IUnknown** ppRealObject)
 {
@@ -65,6 +81,45 @@ static bool CheckForRealObject(std::string functionName, IUnknown* pObject, IUnk
     return false;
 }
 
+static void ResolveContext(IDXGISwapChain* pSwapChain, IUnknown* pDevice, HWND hWnd)
+{
+    LOG_DEBUG("SwapChain: {:X}, Device: {:X}, HWND: {:X}", (size_t) pSwapChain, (size_t) pDevice, (size_t) hWnd);
+
+    _context = {};
+
+    ID3D11Device* device = nullptr;
+    ID3D12CommandQueue* cq = nullptr;
+
+    // try to obtain directx objects and find the path
+    if (pDevice->QueryInterface(IID_PPV_ARGS(&device)) == S_OK)
+    {
+        device->Release();
+        _context.device11 = device;
+    }
+    else if (pDevice->QueryInterface(IID_PPV_ARGS(&cq)) == S_OK)
+    {
+        cq->Release();
+        _context.queue = cq;
+
+        if (!CheckForRealObject(__FUNCTION__, pDevice, &_context.realQueue))
+            _context.realQueue = pDevice;
+
+        ID3D12Device* device12 = nullptr;
+        if (((ID3D12CommandQueue*) _context.realQueue)->GetDevice(IID_PPV_ARGS(&device12)) == S_OK)
+        {
+            device12->Release();
+            _context.device12 = device12;
+        }
+
+        IDXGISwapChain3* swapChain3 = nullptr;
+        if (pSwapChain->QueryInterface(IID_PPV_ARGS(&swapChain3)) == S_OK && swapChain3 != nullptr)
+        {
+            swapChain3->Release();
+            _context.swapChain3 = swapChain3;
+        }
+    }
+}
+
 static int GetCorrectDXGIFormat(int eCurrentFormat)
 {
     switch (eCurrentFormat)
@@ -271,6 +326,10 @@ static void RenderImGui_DX11(IDXGISwapChain* pSwapChain)
 
         if (ImGui::GetCurrentContext() && g_pd3dRenderTarget)
         {
+            // Nothing visible, skip ImGui frame
+            if (MenuOverlayBase::SkipFrame())
+                return;
+
             ImGui_ImplDX11_NewFrame();
             ImGui_ImplWin32_NewFrame();
 
@@ -285,14 +344,13 @@ static void RenderImGui_DX11(IDXGISwapChain* pSwapChain)
     }
 }
 
-static void RenderImGui_DX12(IDXGISwapChain* pSwapChainPlain)
+static void RenderImGui_DX12(IDXGISwapChain3* pSwapChain)
 {
     bool drawMenu = false;
-    IDXGISwapChain3* pSwapChain = nullptr;
 
     do
     {
-        if (pSwapChainPlain->QueryInterface(IID_PPV_ARGS(&pSwapChain)) != S_OK || pSwapChain == nullptr)
+        if (pSwapChain == nullptr)
             return;
 
         if (!MenuOverlayBase::IsInited())
@@ -312,7 +370,6 @@ static void RenderImGui_DX12(IDXGISwapChain* pSwapChainPlain)
     if (!drawMenu)
     {
         MenuOverlayBase::HideMenu();
-        auto releaseResult = pSwapChain->Release();
         return;
     }
 
@@ -349,7 +406,6 @@ static void RenderImGui_DX12(IDXGISwapChain* pSwapChainPlain)
                 LOG_ERROR("CreateDescriptorHeap(g_pd3dRtvDescHeap): {0:X}", (unsigned long) result);
                 MenuOverlayBase::HideMenu();
                 CleanupRenderTargetDx12(true);
-                pSwapChain->Release();
                 return;
             }
 
@@ -379,7 +435,6 @@ static void RenderImGui_DX12(IDXGISwapChain* pSwapChainPlain)
                 LOG_ERROR("CreateDescriptorHeap(g_pd3dSrvDescHeap): {0:X}", (unsigned long) result);
                 MenuOverlayBase::HideMenu();
                 CleanupRenderTargetDx12(true);
-                pSwapChain->Release();
                 return;
             }
 
@@ -396,7 +451,6 @@ static void RenderImGui_DX12(IDXGISwapChain* pSwapChainPlain)
                 LOG_ERROR("CreateCommandAllocator[{0}]: {1:X}", i, (unsigned long) result);
                 MenuOverlayBase::HideMenu();
                 CleanupRenderTargetDx12(true);
-                pSwapChain->Release();
                 return;
             }
         }
@@ -408,7 +462,6 @@ static void RenderImGui_DX12(IDXGISwapChain* pSwapChainPlain)
             LOG_ERROR("CreateCommandList: {0:X}", (unsigned long) result);
             MenuOverlayBase::HideMenu();
             CleanupRenderTargetDx12(true);
-            pSwapChain->Release();
             return;
         }
 
@@ -418,7 +471,6 @@ static void RenderImGui_DX12(IDXGISwapChain* pSwapChainPlain)
             LOG_ERROR("g_pd3dCommandList->Close: {0:X}", (unsigned long) result);
             MenuOverlayBase::HideMenu();
             CleanupRenderTargetDx12(false);
-            pSwapChain->Release();
             return;
         }
 
@@ -441,7 +493,6 @@ static void RenderImGui_DX12(IDXGISwapChain* pSwapChainPlain)
 
         ImGui_ImplDX12_Init(&initInfo);
 
-        pSwapChain->Release();
         return;
     }
 
@@ -451,7 +502,6 @@ static void RenderImGui_DX12(IDXGISwapChain* pSwapChainPlain)
         if (!g_mainRenderTargetResource[0])
         {
             CreateRenderTargetDx12(device, pSwapChain);
-            pSwapChain->Release();
             return;
         }
 
@@ -460,6 +510,10 @@ static void RenderImGui_DX12(IDXGISwapChain* pSwapChainPlain)
         {
             _showRenderImGuiDebugOnce = true;
 
+            // Nothing visible, skip ImGui frame and menu command list
+            if (MenuOverlayBase::SkipFrame())
+                return;
+
             ImGui_ImplDX12_NewFrame();
 
             if (MenuOverlayBase::RenderMenu())
@@ -474,7 +528,6 @@ static void RenderImGui_DX12(IDXGISwapChain* pSwapChainPlain)
                 {
                     LOG_ERROR("commandAllocator->Reset: {0:X}", (unsigned long) result);
                     CleanupRenderTargetDx12(false);
-                    pSwapChain->Release();
                     return;
                 }
 
@@ -490,7 +543,6 @@ static void RenderImGui_DX12(IDXGISwapChain* pSwapChainPlain)
                 if (result != S_OK)
                 {
                     LOG_ERROR("g_pd3dCommandList->Reset: {0:X}", (unsigned long) result);
-                    pSwapChain->Release();
                     return;
                 }
 
@@ -509,7 +561,6 @@ static void RenderImGui_DX12(IDXGISwapChain* pSwapChainPlain)
                 {
                     LOG_ERROR("g_pd3dCommandList->Close: {0:X}", (unsigned long) result);
                     CleanupRenderTargetDx12(true);
-                    pSwapChain->Release();
                     return;
                 }
 
@@ -526,8 +577,6 @@ static void RenderImGui_DX12(IDXGISwapChain* pSwapChainPlain)
             _showRenderImGuiDebugOnce = false;
         }
     }
-
-    pSwapChain->Release();
 }
 
 ID3D12GraphicsCommandList* MenuOverlayDx::MenuCommandList() { return g_pd3dCommandList; }
@@ -544,12 +593,16 @@ void MenuOverlayDx::CleanupRenderTarget(bool clearQueue, HWND hWnd)
         fg->Deactivate();
     }
 
+    InvalidateContext();
+
     if (_dx11Device)
         CleanupRenderTargetDx11(false);
     else
         CleanupRenderTargetDx12(clearQueue);
 }
 
+void MenuOverlayDx::InvalidateContext() { _contextCache.Invalidate(); }
+
 void MenuOverlayDx::Present(IDXGISwapChain* pSwapChain, UINT SyncInterval, UINT Flags,
                             const DXGI_PRESENT_PARAMETERS* pPresentParameters, IUnknown* pDevice, HWND hWnd, bool isUWP)
 {
@@ -558,27 +611,32 @@ void MenuOverlayDx::Present(IDXGISwapChain* pSwapChain, UINT SyncInterval, UINT
 
     LOG_DEBUG("");
 
-    ID3D12CommandQueue* cq = nullptr;
-    ID3D11Device* device = nullptr;
-    ID3D12Device* device12 = nullptr;
+    if (_contextCache.NeedsResolve(pSwapChain, pDevice, hWnd))
+    {
+        auto generation = _contextCache.Generation();
+        ResolveContext(pSwapChain, pDevice, hWnd);
+        _contextCache.Resolved(pSwapChain, pDevice, hWnd, generation);
+    }
 
-    // try to obtain directx objects and find the path
-    if (pDevice->QueryInterface(IID_PPV_ARGS(&device)) == S_OK)
+    ID3D12CommandQueue* cq = _context.queue;
+    ID3D11Device* device = _context.device11;
+    ID3D12Device* device12 = _context.device12;
+
+    if (device != nullptr)
     {
         if (!_dx11Device)
             LOG_DEBUG("D3D11Device captured");
 
         _dx11Device = true;
     }
-    else if (pDevice->QueryInterface(IID_PPV_ARGS(&cq)) == S_OK)
+    else if (cq != nullptr)
     {
         if (!_dx12Device)
             LOG_DEBUG("D3D12CommandQueue captured");
 
-        if (!CheckForRealObject(__FUNCTION__, pDevice, &currentSCCommandQueue))
-            currentSCCommandQueue = pDevice;
+        currentSCCommandQueue = _context.realQueue;
 
-        if (((ID3D12CommandQueue*) currentSCCommandQueue)->GetDevice(IID_PPV_ARGS(&device12)) == S_OK)
+        if (device12 != nullptr)
         {
             if (!_dx12Device)
                 LOG_DEBUG("D3D12Device captured");
@@ -635,16 +693,6 @@ void MenuOverlayDx::Present(IDXGISwapChain* pSwapChain, UINT SyncInterval, UINT
         if (_dx11Device)
             RenderImGui_DX11(pSwapChain);
         else if (_dx12Device)
-            RenderImGui_DX12(pSwapChain);
+            RenderImGui_DX12(_context.swapChain3);
     }
-
-    // release used objects
-    if (cq != nullptr)
-        cq->Release();
-
-    if (device != nullptr)
-        device->Release();
-
-    if (device12 != nullptr)
-        device12->Release();
 }
@@ -9,6 +9,7 @@ namespace MenuOverlayDx
 {
 ID3D12GraphicsCommandList* MenuCommandList();
 void CleanupRenderTarget(bool clearQueue, HWND hWnd);
+void InvalidateContext(); // Resolve swapchain objects again on next present
 void Present(IDXGISwapChain* pSwapChain, UINT SyncInterval, UINT Flags,
              const DXGI_PRESENT_PARAMETERS* pPresentParameters, IUnknown* pDevice, HWND hWnd, bool isUWP);
 } // namespace MenuOverlayDx
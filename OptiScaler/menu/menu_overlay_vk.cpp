@@ -24,9 +24,42 @@ struct ImGui_ImplVulkan_InitInfo _ImVulkan_Info = {};
 struct ImGui_ImplVulkanH_Frame* _ImVulkan_Frames = VK_NULL_HANDLE;
 static VkSemaphore* _ImVulkan_Semaphores = VK_NULL_HANDLE;
 static VkRenderPass _vkRenderPass = VK_NULL_HANDLE;
+static VkDescriptorPool _vkDescriptorPool = VK_NULL_HANDLE;
 static uint32_t _scImageCount;
 static ULONG64 _frameCount;
 
+// Device & count of current _ImVulkan_Frames
+static VkDevice _framesDevice = VK_NULL_HANDLE;
+static uint32_t _framesCount = 0;
+
+// ImGui backend, render pass and descriptor pool are kept
+// between swapchains when these are not changed
+static VkDevice _imguiDevice = VK_NULL_HANDLE;
+static VkFormat _imguiFormat = VK_FORMAT_UNDEFINED;
+static uint32_t _imguiMinImageCount = 0;
+
+// Frame objects of old swapchains, destroyed when overlay submissions using them
+// are signaled instead of idling the whole device
+struct RetiredVkFrames
+{
+    VkDevice device = VK_NULL_HANDLE;
+    ULONG64 frame = 0;
+    uint32_t count = 0;
+    ImGui_ImplVulkanH_Frame* frames = nullptr;
+    VkSemaphore* semaphores = nullptr;
+};
+
+static std::vector<RetiredVkFrames> _retiredFrames;
+
+// Present of a retired frame might still wait on its semaphore after fence is signaled
+constexpr ULONG64 RETIRE_MIN_FRAMES = 3;
+
+// Fence of a failed submit never signals, don't keep objects forever
+constexpr ULONG64 RETIRE_MAX_FRAMES = 300;
+
+// Max wait for overlay submissions before ImGui objects are destroyed
+constexpr uint64_t OVERLAY_WAIT_TIMEOUT_NS = 1000000000;
+
 static void SetVkObjectName(VkDevice device, VkInstance instance, VkObjectType objectType, uint64_t objectHandle,
                             const char* name)
 {
@@ -45,6 +78,175 @@ static void SetVkObjectName(VkDevice device, VkInstance instance, VkObjectType o
     vkSetDebugUtilsObjectNameEXT(device, &info);
 }
 
+static void DestroyFrames(VkDevice device, ImGui_ImplVulkanH_Frame* frames, VkSemaphore* semaphores, uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++)
+    {
+        ImGui_ImplVulkanH_Frame* fd = &frames[i];
+
+        if (fd->Fence != VK_NULL_HANDLE)
+            vkDestroyFence(device, fd->Fence, VK_NULL_HANDLE);
+
+        if (fd->CommandBuffer != VK_NULL_HANDLE)
+            vkFreeCommandBuffers(device, fd->CommandPool, 1, &fd->CommandBuffer);
+
+        if (fd->CommandPool != VK_NULL_HANDLE)
+            vkDestroyCommandPool(device, fd->CommandPool, VK_NULL_HANDLE);
+
+        if (fd->Framebuffer != VK_NULL_HANDLE)
+            vkDestroyFramebuffer(device, fd->Framebuffer, VK_NULL_HANDLE);
+
+        if (fd->BackbufferView != VK_NULL_HANDLE)
+            vkDestroyImageView(device, fd->BackbufferView, VK_NULL_HANDLE);
+
+        if (semaphores[i] != VK_NULL_HANDLE)
+            vkDestroySemaphore(device, semaphores[i], VK_NULL_HANDLE);
+    }
+
+    IM_FREE(frames);
+    IM_FREE(semaphores);
+}
+
+// Moves current frame objects to retired list, caller must hold _vkCleanMutex
+static void RetireFrames()
+{
+    if (_ImVulkan_Frames == nullptr)
+        return;
+
+    LOG_DEBUG("Retiring {} frames at frame: {}", _framesCount, _frameCount);
+
+    _retiredFrames.push_back({ _framesDevice, _frameCount, _framesCount, _ImVulkan_Frames, _ImVulkan_Semaphores });
+
+    _ImVulkan_Frames = nullptr;
+    _ImVulkan_Semaphores = nullptr;
+    _framesDevice = VK_NULL_HANDLE;
+    _framesCount = 0;
+}
+
+static bool RetiredFramesSignaled(const RetiredVkFrames& retired)
+{
+    for (uint32_t i = 0; i < retired.count; i++)
+    {
+        auto fence = retired.frames[i].Fence;
+
+        if (fence != VK_NULL_HANDLE && vkGetFenceStatus(retired.device, fence) == VK_NOT_READY)
+            return false;
+    }
+
+    return true;
+}
+
+// Caller must hold _vkCleanMutex
+static void CollectRetiredFrames(bool force)
+{
+    std::erase_if(_retiredFrames,
+                  [force](const RetiredVkFrames& retired)
+                  {
+                      auto age = _frameCount - retired.frame;
+
+                      if (!force && (age < RETIRE_MIN_FRAMES ||
+                                     (age < RETIRE_MAX_FRAMES && !RetiredFramesSignaled(retired))))
+                      {
+                          return false;
+                      }
+
+                      LOG_DEBUG("Destroying retired frames from frame: {}, age: {}", retired.frame, age);
+                      DestroyFrames(retired.device, retired.frames, retired.semaphores, retired.count);
+                      return true;
+                  });
+}
+
+// Waits only for overlay submissions on the device, caller must hold _vkCleanMutex
+static void WaitOverlayFences(VkDevice device);
+
+// Caller must hold _vkCleanMutex
+static void CollectOtherDevices(VkDevice device)
+{
+    std::vector<VkDevice> devices;
+
+    for (auto& retired : _retiredFrames)
+    {
+        if (retired.device != device && std::find(devices.begin(), devices.end(), retired.device) == devices.end())
+            devices.push_back(retired.device);
+    }
+
+    for (auto otherDevice : devices)
+        WaitOverlayFences(otherDevice);
+
+    std::erase_if(_retiredFrames,
+                  [device](const RetiredVkFrames& retired)
+                  {
+                      if (retired.device == device)
+                          return false;
+
+                      DestroyFrames(retired.device, retired.frames, retired.semaphores, retired.count);
+                      return true;
+                  });
+}
+
+static void WaitOverlayFences(VkDevice device)
+{
+    std::vector<VkFence> fences;
+
+    auto addFences = [&fences](ImGui_ImplVulkanH_Frame* frames, uint32_t count)
+    {
+        for (uint32_t i = 0; i < count; i++)
+        {
+            if (frames[i].Fence != VK_NULL_HANDLE)
+                fences.push_back(frames[i].Fence);
+        }
+    };
+
+    if (_framesDevice == device && _ImVulkan_Frames != nullptr)
+        addFences(_ImVulkan_Frames, _framesCount);
+
+    for (auto& retired : _retiredFrames)
+    {
+        if (retired.device == device)
+            addFences(retired.frames, retired.count);
+    }
+
+    if (fences.empty())
+        return;
+
+    auto result = vkWaitForFences(device, (uint32_t) fences.size(), fences.data(), VK_TRUE, OVERLAY_WAIT_TIMEOUT_NS);
+
+    if (result != VK_SUCCESS)
+        LOG_WARN("vkWaitForFences error: {0:X}", (UINT) result);
+}
+
+// ImGui backend objects might be in flight, wait for overlay submissions before destroying them
+static void ReleaseImGuiObjects()
+{
+    if (_imguiDevice == VK_NULL_HANDLE)
+        return;
+
+    LOG_DEBUG("Releasing ImGui objects");
+
+    std::lock_guard<std::mutex> lock(_vkCleanMutex);
+
+    WaitOverlayFences(_imguiDevice);
+
+    if (ImGui::GetCurrentContext() != nullptr && ImGui::GetIO().BackendRendererUserData != nullptr)
+        ImGui_ImplVulkan_Shutdown(false);
+
+    if (_vkRenderPass != VK_NULL_HANDLE)
+    {
+        vkDestroyRenderPass(_imguiDevice, _vkRenderPass, VK_NULL_HANDLE);
+        _vkRenderPass = VK_NULL_HANDLE;
+    }
+
+    if (_vkDescriptorPool != VK_NULL_HANDLE)
+    {
+        vkDestroyDescriptorPool(_imguiDevice, _vkDescriptorPool, VK_NULL_HANDLE);
+        _vkDescriptorPool = VK_NULL_HANDLE;
+    }
+
+    _imguiDevice = VK_NULL_HANDLE;
+    _imguiFormat = VK_FORMAT_UNDEFINED;
+    _imguiMinImageCount = 0;
+}
+
 static void CreateVulkanObjects(VkDevice device, VkPhysicalDevice pd, VkInstance instance, HWND hwnd,
                                 const VkSwapchainCreateInfoKHR* pCreateInfo, VkSwapchainKHR* pSwapchain)
 {
@@ -58,18 +260,30 @@ static void CreateVulkanObjects(VkDevice device, VkPhysicalDevice pd, VkInstance
         return;
     }
 
+    // ImGui pipeline only depends on render pass format, keep it when possible
+    bool keepImGui = _imguiDevice == device && _imguiFormat == pCreateInfo->imageFormat &&
+                     _imguiMinImageCount == pCreateInfo->minImageCount && MenuOverlayBase::IsInited() &&
+                     MenuOverlayBase::Handle() == hwnd && ImGui::GetIO().BackendRendererUserData != nullptr;
+
     if (_vulkanObjectsCreated)
     {
-        LOG_DEBUG("_vulkanObjectsCreated, releasing objects");
-
-        if (ImGui::GetIO().BackendRendererUserData != nullptr)
-            ImGui_ImplVulkan_Shutdown(false);
+        LOG_DEBUG("_vulkanObjectsCreated, retiring objects, keepImGui: {}", keepImGui);
 
+        // Swapchain objects are destroyed later when overlay submissions are done
         MenuOverlayVk::DestroyVulkanObjects(false);
 
         _vulkanObjectsCreated = false;
     }
 
+    if (!keepImGui)
+        ReleaseImGuiObjects();
+
+    // Frames of an old device are not tracked by presents of the new one
+    {
+        std::lock_guard<std::mutex> lock(_vkCleanMutex);
+        CollectOtherDevices(device);
+    }
+
     // Initialize ImGui
     if (!MenuOverlayBase::IsInited() || MenuOverlayBase::Handle() != hwnd)
     {
@@ -104,10 +318,19 @@ static void CreateVulkanObjects(VkDevice device, VkPhysicalDevice pd, VkInstance
 
     // Alloc ImGui frame structure/semaphores for every image.
     // For convenience, I am using ImGui_ImplVulkanH_Frame in imgui_impl_vulkan.h
-    if (!_vulkanObjectsCreated)
     {
+        std::lock_guard<std::mutex> lock(_vkCleanMutex);
+
+        // Frames of a previous call which failed halfway
+        RetireFrames();
+
         _ImVulkan_Frames = (ImGui_ImplVulkanH_Frame*) IM_ALLOC(sizeof(ImGui_ImplVulkanH_Frame) * _scImageCount);
         _ImVulkan_Semaphores = (VkSemaphore*) IM_ALLOC(sizeof(VkSemaphore) * _scImageCount);
+        memset(_ImVulkan_Frames, 0, sizeof(ImGui_ImplVulkanH_Frame) * _scImageCount);
+        memset(_ImVulkan_Semaphores, 0, sizeof(VkSemaphore) * _scImageCount);
+
+        _framesDevice = device;
+        _framesCount = _scImageCount;
     }
 
     // Select queue family.
@@ -145,7 +368,7 @@ static void CreateVulkanObjects(VkDevice device, VkPhysicalDevice pd, VkInstance
     vkGetDeviceQueue(device, queueFamily, 0, &queue);
 
     // Create the render pool
-    VkDescriptorPool pool = VK_NULL_HANDLE;
+    if (!keepImGui)
     {
         VkDescriptorPoolSize sampler_pool_size = {};
         sampler_pool_size.type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
@@ -158,15 +381,19 @@ static void CreateVulkanObjects(VkDevice device, VkPhysicalDevice pd, VkInstance
         desc_pool_info.poolSizeCount = 1;
         desc_pool_info.pPoolSizes = &sampler_pool_size;
 
-        result = vkCreateDescriptorPool(device, &desc_pool_info, NULL, &pool);
+        result = vkCreateDescriptorPool(device, &desc_pool_info, NULL, &_vkDescriptorPool);
         if (result != VK_SUCCESS)
         {
             LOG_ERROR("vkCreateDescriptorPool error: {0:X}", (UINT) result);
             return;
         }
+
+        // Owner of pool & render pass, released by ReleaseImGuiObjects
+        _imguiDevice = device;
     }
 
     // Create the render pass
+    if (!keepImGui)
     {
         VkAttachmentDescription attachment_desc = {};
 
@@ -354,26 +581,33 @@ static void CreateVulkanObjects(VkDevice device, VkPhysicalDevice pd, VkInstance
         }
     }
 
-    // Initialize ImGui and upload fonts
+    // Filled for kept ImGui backend too, QueuePresent uses it
     {
         _ImVulkan_Info.Instance = instance;
         _ImVulkan_Info.PhysicalDevice = pd;
         _ImVulkan_Info.Device = device;
         _ImVulkan_Info.QueueFamily = queueFamily;
         _ImVulkan_Info.Queue = queue;
-        _ImVulkan_Info.DescriptorPool = pool;
+        _ImVulkan_Info.DescriptorPool = _vkDescriptorPool;
         _ImVulkan_Info.Subpass = 0;
         _ImVulkan_Info.MinImageCount = pCreateInfo->minImageCount;
         _ImVulkan_Info.ImageCount = _scImageCount;
         _ImVulkan_Info.Allocator = NULL;
         _ImVulkan_Info.RenderPass = _vkRenderPass;
+    }
 
+    // Initialize ImGui and upload fonts
+    if (!keepImGui)
+    {
         bool initResult = ImGui_ImplVulkan_Init(&_ImVulkan_Info);
         LOG_DEBUG("ImGui_ImplVulkan_Init result: {}", initResult);
 
         if (!initResult)
             return;
 
+        _imguiFormat = pCreateInfo->imageFormat;
+        _imguiMinImageCount = pCreateInfo->minImageCount;
+
         // Upload Fonts
         // Use any command queue
         VkCommandPool command_pool = _ImVulkan_Frames[0].CommandPool;
@@ -410,17 +644,13 @@ static void CreateVulkanObjects(VkDevice device, VkPhysicalDevice pd, VkInstance
             return;
         }
 
-        result = vkQueueSubmit(queue, 1, &end_info, VK_NULL_HANDLE);
-        if (result != VK_SUCCESS)
-        {
-            LOG_ERROR("vkQueueSubmit error: {0:X}", (UINT) result);
-            return;
-        }
+        // Frame fence is waited before command pool is used again, no need to idle the device
+        vkResetFences(device, 1, &_ImVulkan_Frames[0].Fence);
 
-        result = vkDeviceWaitIdle(device);
+        result = vkQueueSubmit(queue, 1, &end_info, _ImVulkan_Frames[0].Fence);
         if (result != VK_SUCCESS)
         {
-            LOG_ERROR("vkDeviceWaitIdle error: {0:X}", (UINT) result);
+            LOG_ERROR("vkQueueSubmit error: {0:X}", (UINT) result);
             return;
         }
     }
@@ -431,7 +661,7 @@ static void CreateVulkanObjects(VkDevice device, VkPhysicalDevice pd, VkInstance
 
 void MenuOverlayVk::DestroyVulkanObjects(bool shutdown)
 {
-    if (_ImVulkan_Info.Device == VK_NULL_HANDLE)
+    if (_ImVulkan_Frames == nullptr && _retiredFrames.empty() && (!shutdown || _imguiDevice == VK_NULL_HANDLE))
         return;
 
     if (!shutdown)
@@ -439,58 +669,29 @@ void MenuOverlayVk::DestroyVulkanObjects(bool shutdown)
 
     _vkCleanMutex.lock();
 
-    auto result = vkDeviceWaitIdle(_ImVulkan_Info.Device);
-    if (result != VK_SUCCESS && !shutdown)
-        LOG_WARN("vkDeviceWaitIdle error: {0:X}", (UINT) result);
+    RetireFrames();
 
     if (shutdown)
     {
-        if (_vkRenderPass)
-            vkDestroyRenderPass(_ImVulkan_Info.Device, _vkRenderPass, VK_NULL_HANDLE);
-
-        if (_ImVulkan_Info.DescriptorPool)
-            vkDestroyDescriptorPool(_ImVulkan_Info.Device, _ImVulkan_Info.DescriptorPool, VK_NULL_HANDLE);
-    }
-
-    for (uint32_t i = 0; i < _ImVulkan_Info.ImageCount; i++)
-    {
-        ImGui_ImplVulkanH_Frame* fd = &_ImVulkan_Frames[i];
-
-        if (fd->Fence != VK_NULL_HANDLE)
+        if (_imguiDevice != VK_NULL_HANDLE)
         {
-            vkDestroyFence(_ImVulkan_Info.Device, fd->Fence, VK_NULL_HANDLE);
-            fd->Fence = VK_NULL_HANDLE;
-        }
+            WaitOverlayFences(_imguiDevice);
 
-        if (fd->CommandBuffer != VK_NULL_HANDLE)
-        {
-            vkFreeCommandBuffers(_ImVulkan_Info.Device, fd->CommandPool, 1, &fd->CommandBuffer);
-            fd->CommandBuffer = VK_NULL_HANDLE;
-        }
+            if (_vkRenderPass)
+                vkDestroyRenderPass(_imguiDevice, _vkRenderPass, VK_NULL_HANDLE);
 
-        if (fd->CommandPool != VK_NULL_HANDLE)
-        {
-            vkDestroyCommandPool(_ImVulkan_Info.Device, fd->CommandPool, VK_NULL_HANDLE);
-            fd->CommandPool = VK_NULL_HANDLE;
-        }
+            if (_vkDescriptorPool)
+                vkDestroyDescriptorPool(_imguiDevice, _vkDescriptorPool, VK_NULL_HANDLE);
 
-        if (fd->BackbufferView != VK_NULL_HANDLE)
-        {
-            vkDestroyImageView(_ImVulkan_Info.Device, fd->BackbufferView, VK_NULL_HANDLE);
-            fd->BackbufferView = VK_NULL_HANDLE;
+            _vkRenderPass = VK_NULL_HANDLE;
+            _vkDescriptorPool = VK_NULL_HANDLE;
         }
 
-        if (fd->BackbufferView != VK_NULL_HANDLE)
-        {
-            vkDestroyFramebuffer(_ImVulkan_Info.Device, fd->Framebuffer, VK_NULL_HANDLE);
-            fd->Framebuffer = VK_NULL_HANDLE;
-        }
-
-        if (_ImVulkan_Semaphores[i] != VK_NULL_HANDLE)
-        {
-            vkDestroySemaphore(_ImVulkan_Info.Device, _ImVulkan_Semaphores[i], VK_NULL_HANDLE);
-            _ImVulkan_Semaphores[i] = VK_NULL_HANDLE;
-        }
+        CollectRetiredFrames(true);
+    }
+    else
+    {
+        CollectRetiredFrames(false);
     }
 
     _ImVulkan_Info = {};
@@ -521,13 +722,22 @@ bool MenuOverlayVk::QueuePresent(VkQueue queue, VkPresentInfoKHR* pPresentInfo)
     _frameCount++;
 
     {
-        auto semaphoreIndex = _frameCount % _scImageCount;
+        std::lock_guard<std::mutex> lock(_vkCleanMutex);
+        CollectRetiredFrames(false);
+    }
 
-        ImGui_ImplVulkan_NewFrame();
+    {
+        auto semaphoreIndex = _frameCount % _scImageCount;
 
         if (State::Instance().delayMenuRenderBy > 0)
             State::Instance().delayMenuRenderBy--;
 
+        // Nothing visible, skip ImGui frame and menu submit
+        if (MenuOverlayBase::SkipFrame())
+            return true;
+
+        ImGui_ImplVulkan_NewFrame();
+
         if (MenuOverlayBase::RenderMenu())
         {
             if (State::Instance().delayMenuRenderBy == 0)
@@ -536,7 +746,6 @@ bool MenuOverlayVk::QueuePresent(VkQueue queue, VkPresentInfoKHR* pPresentInfo)
                 ImGui_ImplVulkanH_Frame* fd = &_ImVulkan_Frames[idx];
 
                 vkWaitForFences(_ImVulkan_Info.Device, 1, &fd->Fence, VK_TRUE, UINT64_MAX);
-                vkResetFences(_ImVulkan_Info.Device, 1, &fd->Fence);
 
                 {
                     vkResetCommandPool(_ImVulkan_Info.Device, fd->CommandPool, 0);
@@ -582,6 +791,9 @@ bool MenuOverlayVk::QueuePresent(VkQueue queue, VkPresentInfoKHR* pPresentInfo)
                 submit_info.signalSemaphoreCount = 1;
                 submit_info.pSignalSemaphores = &_ImVulkan_Semaphores[semaphoreIndex];
 
+                // Reset just before submit, an unsubmitted reset fence would never signal
+                vkResetFences(_ImVulkan_Info.Device, 1, &fd->Fence);
+
                 auto qResult = vkQueueSubmit(_ImVulkan_Info.Queue, 1, &submit_info, fd->Fence);
                 if (qResult != VK_SUCCESS)
                 {
@@ -615,7 +827,7 @@ void MenuOverlayVk::CreateSwapchain(VkDevice device, VkPhysicalDevice pd, VkInst
 
         if (MenuOverlayBase::IsInited())
         {
-            ImGui_ImplVulkan_Shutdown(false);
+            ReleaseImGuiObjects();
             LOG_DEBUG("MenuOverlayBase::Shutdown();");
             MenuOverlayBase::Shutdown();
         }
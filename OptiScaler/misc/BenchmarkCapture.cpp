@@ -0,0 +1,367 @@
+#include "pch.h"
+#include "BenchmarkCapture.h"
+#include "PresentScheduler.h"
+
+#include <State.h>
+
+#include <Util.h>
+#include <Config.h>
+
+#include <thread>
+
+bool BenchmarkCapture::OpenMapping(uint32_t capacity)
+{
+    auto path = _basePath;
+    path += L".bin";
+
+    _file = CreateFileW(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS,
+                        FILE_ATTRIBUTE_NORMAL, nullptr);
+
+    if (_file == INVALID_HANDLE_VALUE)
+    {
+        LOG_ERROR("Can't create benchmark file: {}, error: {}", wstring_to_string(path.wstring()), GetLastError());
+        return false;
+    }
+
+    UINT64 size = sizeof(BenchmarkHeader) + (UINT64) capacity * sizeof(BenchmarkFrame);
+    _mapping = CreateFileMappingW(_file, nullptr, PAGE_READWRITE, (DWORD) (size >> 32), (DWORD) size, nullptr);
+
+    if (_mapping == nullptr)
+    {
+        LOG_ERROR("CreateFileMappingW error: {}", GetLastError());
+        CloseMapping(0);
+        return false;
+    }
+
+    auto view = (uint8_t*) MapViewOfFile(_mapping, FILE_MAP_WRITE, 0, 0, (SIZE_T) size);
+
+    if (view == nullptr)
+    {
+        LOG_ERROR("MapViewOfFile error: {}", GetLastError());
+        CloseMapping(0);
+        return false;
+    }
+
+    _header = (BenchmarkHeader*) view;
+    _frames = (BenchmarkFrame*) (view + sizeof(BenchmarkHeader));
+
+    *_header = {};
+    _header->recordSize = sizeof(BenchmarkFrame);
+    _header->capacity = capacity;
+    _header->processId = GetCurrentProcessId();
+
+    return true;
+}
+
+void BenchmarkCapture::CloseMapping(uint32_t frameCount)
+{
+    if (_header != nullptr)
+    {
+        _header->frameCount = frameCount;
+        UnmapViewOfFile(_header);
+        _header = nullptr;
+        _frames = nullptr;
+    }
+
+    if (_mapping != nullptr)
+    {
+        CloseHandle(_mapping);
+        _mapping = nullptr;
+    }
+
+    if (_file != INVALID_HANDLE_VALUE)
+    {
+        // Drop unused capacity
+        LARGE_INTEGER used {};
+        used.QuadPart = sizeof(BenchmarkHeader) + (LONGLONG) frameCount * sizeof(BenchmarkFrame);
+
+        if (SetFilePointerEx(_file, used, nullptr, FILE_BEGIN))
+            SetEndOfFile(_file);
+
+        CloseHandle(_file);
+        _file = INVALID_HANDLE_VALUE;
+    }
+}
+
+bool BenchmarkCapture::Start(uint32_t frames, uint32_t seconds)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        if (_starting.load(std::memory_order_acquire) || _capturing.load(std::memory_order_acquire) ||
+            _finishing.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        if (frames == 0 && seconds == 0)
+            return false;
+
+        _pendingFrames = frames;
+        _pendingSeconds = seconds;
+        _starting.store(true, std::memory_order_release);
+    }
+
+    // Might run inline, lock must be released
+    PresentScheduler::Defer(PresentStep::Benchmark, Open);
+    return true;
+}
+
+void BenchmarkCapture::Open(uintptr_t)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto frames = _pendingFrames;
+    auto seconds = _pendingSeconds;
+    auto capacity = frames > 0 ? frames : seconds * _maxFps;
+
+    SYSTEMTIME now {};
+    GetLocalTime(&now);
+
+    auto name = std::format("OptiScaler_Benchmark_{:04}{:02}{:02}_{:02}{:02}{:02}", now.wYear, now.wMonth, now.wDay,
+                            now.wHour, now.wMinute, now.wSecond);
+    _basePath = Util::DllPath().parent_path() / name;
+
+    if (!OpenMapping(capacity))
+    {
+        _starting.store(false, std::memory_order_release);
+        return;
+    }
+
+    _capacity = capacity;
+    _frameLimit = frames;
+    _startMs = Util::MillisecondsNow();
+    _endMs = frames > 0 ? 0.0 : _startMs + seconds * 1000.0;
+    _count.store(0, std::memory_order_relaxed);
+
+    for (auto& present : _presents)
+    {
+        present.swapChain.store(0, std::memory_order_relaxed);
+        present.lastMs.store(0.0, std::memory_order_relaxed);
+    }
+
+    LOG_INFO("Benchmark capture started, frames: {}, seconds: {}, file: {}", frames, seconds,
+             wstring_to_string(_basePath.wstring()));
+
+    _capturing.store(true, std::memory_order_release);
+    _starting.store(false, std::memory_order_release);
+}
+
+bool BenchmarkCapture::Start()
+{
+    auto config = Config::Instance();
+    return Start((uint32_t) config->BenchmarkFrames.value_or_default(),
+                 (uint32_t) config->BenchmarkDuration.value_or_default());
+}
+
+void BenchmarkCapture::Stop()
+{
+    // Only one caller gets to finish
+    bool expected = true;
+    if (!_capturing.compare_exchange_strong(expected, false, std::memory_order_acq_rel))
+        return;
+
+    _finishing.store(true, std::memory_order_release);
+    LOG_INFO("Benchmark capture stopped, frames: {}", _count.load(std::memory_order_relaxed));
+
+    PresentScheduler::Defer(PresentStep::Benchmark, Finish);
+}
+
+void BenchmarkCapture::Toggle()
+{
+    if (IsCapturing())
+        Stop();
+    else
+        Start();
+}
+
+void BenchmarkCapture::Finish(uintptr_t)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    // Capture is already stopped, only presents which saw it running can still be writing
+    while (_writers.load(std::memory_order_acquire) > 0)
+        std::this_thread::yield();
+
+    auto count = _count.load(std::memory_order_acquire);
+    auto application = wstring_to_string(Util::ExePath().filename().wstring());
+    auto processId = (uint32_t) GetCurrentProcessId();
+
+    std::string csv;
+    std::string json;
+
+    if (_frames != nullptr && count > 0)
+    {
+        BenchmarkReport::AppendCsv(csv, _frames, count, application, processId);
+
+        auto summary = BenchmarkReport::Summarize(_frames, count);
+        BenchmarkReport::AppendJson(json, summary, application, processId);
+
+        LOG_INFO("Benchmark: {} frames, {:.2f} s, avg {:.1f} fps, 1% low {:.1f} fps, 0.1% low {:.1f} fps",
+                 summary.frames, summary.durationSec, summary.avgFps, summary.low1Fps, summary.low01Fps);
+    }
+
+    CloseMapping(count);
+
+    auto write = [](const std::filesystem::path& path, const std::string& data)
+    {
+        FILE* file = _wfopen(path.c_str(), L"wb");
+
+        if (file == nullptr)
+        {
+            LOG_ERROR("Can't open benchmark file: {}", wstring_to_string(path.wstring()));
+            return;
+        }
+
+        fwrite(data.data(), 1, data.size(), file);
+        fclose(file);
+    };
+
+    if (!csv.empty())
+    {
+        auto path = _basePath;
+        write(path += L".csv", csv);
+
+        path = _basePath;
+        write(path += L".json", json);
+    }
+
+    _finishing.store(false, std::memory_order_release);
+}
+
+float BenchmarkCapture::MsBetweenPresents(uint64_t swapChain, double presentStartMs)
+{
+    for (auto& present : _presents)
+    {
+        auto current = present.swapChain.load(std::memory_order_acquire);
+
+        // Claim a free slot for a new swapchain
+        if (current == 0 &&
+            !present.swapChain.compare_exchange_strong(current, swapChain, std::memory_order_acq_rel) &&
+            current != swapChain)
+        {
+            continue;
+        }
+
+        if (current != 0 && current != swapChain)
+            continue;
+
+        auto lastMs = present.lastMs.exchange(presentStartMs, std::memory_order_acq_rel);
+        return lastMs > 0.0 ? (float) (presentStartMs - lastMs) : 0.0f;
+    }
+
+    return 0.0f;
+}
+
+void BenchmarkCapture::FillFromState(BenchmarkFrame& frame)
+{
+    auto& state = State::Instance();
+
+    // Upscaler times can be written by another present, don't wait for it
+    if (state.frameTimeMutex.try_lock())
+    {
+        if (!state.upscaleTimes.empty())
+            _lastUpscalerMs.store((float) state.upscaleTimes.back(), std::memory_order_relaxed);
+
+        state.frameTimeMutex.unlock();
+    }
+
+    frame.msUpscaler = _lastUpscalerMs.load(std::memory_order_relaxed);
+
+    if (auto feature = state.currentFeature; feature != nullptr)
+    {
+        frame.renderWidth = feature->RenderWidth();
+        frame.renderHeight = feature->RenderHeight();
+        frame.displayWidth = feature->DisplayWidth();
+        frame.displayHeight = feature->DisplayHeight();
+
+        // Handle id tells apart a new feature allocated at the same address
+        auto handleId = feature->Handle() != nullptr ? feature->Handle()->Id : 0;
+
+        std::lock_guard<std::mutex> lock(_nameMutex);
+
+        if (_namedFeature != feature || _namedHandleId != handleId)
+        {
+            strncpy_s(_featureName, feature->Name().c_str(), _TRUNCATE);
+            _namedFeature = feature;
+            _namedHandleId = handleId;
+        }
+
+        memcpy(frame.upscaler, _featureName, sizeof(frame.upscaler));
+    }
+
+    auto fg = state.currentFG;
+    frame.fgActive = fg != nullptr && fg->IsActive() && !fg->IsPaused() ? 1 : 0;
+
+    for (size_t s = 0; s < BENCHMARK_REFLEX_STAGES; s++)
+    {
+        if (auto mean = ReflexAnalytics::StageMeanUs(static_cast<LatencyStage>(s)); mean.has_value())
+            frame.msReflex[s] = (float) (mean.value() / 1000.0);
+    }
+}
+
+void BenchmarkCapture::FramePresented(BenchmarkRuntime runtime, uint64_t swapChain, uint32_t syncInterval,
+                                      uint32_t flags, double presentStartMs, double presentEndMs, bool generated)
+{
+    if (!_capturing.load(std::memory_order_acquire))
+    {
+        auto delay = Config::Instance()->BenchmarkAutoStartDelay.value_or_default();
+
+        if (delay <= 0 || _autoStartDone.load(std::memory_order_acquire))
+            return;
+
+        auto firstPresentMs = 0.0;
+        if (_firstPresentMs.compare_exchange_strong(firstPresentMs, presentEndMs, std::memory_order_acq_rel))
+            firstPresentMs = presentEndMs;
+
+        // Only one present starts it
+        if (presentEndMs - firstPresentMs >= delay * 1000.0 && !_autoStartDone.exchange(true))
+            Start();
+
+        return;
+    }
+
+    _writers.fetch_add(1, std::memory_order_acq_rel);
+
+    // Stopped after the first check
+    if (!_capturing.load(std::memory_order_acquire))
+    {
+        _writers.fetch_sub(1, std::memory_order_release);
+        return;
+    }
+
+    // Presents on other threads (multiple swapchains) get their own slot
+    auto index = _count.fetch_add(1, std::memory_order_acq_rel);
+
+    if (index >= _capacity || (_endMs > 0.0 && presentStartMs >= _endMs))
+    {
+        _count.fetch_sub(1, std::memory_order_acq_rel);
+        _writers.fetch_sub(1, std::memory_order_release);
+        Stop();
+        return;
+    }
+
+    auto& frame = _frames[index];
+    frame = {};
+    frame.timeMs = presentStartMs - _startMs;
+    frame.msBetweenPresents = MsBetweenPresents(swapChain, presentStartMs);
+    frame.msInPresentApi = (float) (presentEndMs - presentStartMs);
+    frame.swapChain = swapChain;
+    frame.syncInterval = syncInterval;
+    frame.presentFlags = flags;
+    frame.runtime = runtime;
+    frame.generated = generated ? 1 : 0;
+
+    FillFromState(frame);
+
+    _writers.fetch_sub(1, std::memory_order_release);
+
+    if (_frameLimit > 0 && index + 1 >= _frameLimit)
+        Stop();
+}
+
+std::filesystem::path BenchmarkCapture::LastCapturePath()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _basePath;
+}
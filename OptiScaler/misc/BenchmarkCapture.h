@@ -0,0 +1,91 @@
+#pragma once
+#include "SysUtils.h"
+#include "BenchmarkReport.h"
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <filesystem>
+
+// Benchmark capture mode
+//
+// Started from hotkey, menu or automatically after BenchmarkAutoStartDelay seconds, runs for BenchmarkFrames
+// frames or BenchmarkDuration seconds. Every present appends one BenchmarkFrame to a memory mapped file sized for
+// the whole capture, present thread only fills the record, there is no file IO or allocation on it.
+// Record file is created and mapped by the present bookkeeping worker, capture starts once it is ready.
+// When capture ends CSV (PresentMon column layout) and JSON summary are written next to OptiScaler by the same
+// worker and the raw record file is trimmed to the captured frames.
+// Presents of different swapchains can come from different threads, present intervals are kept per swapchain.
+
+class BenchmarkCapture
+{
+  private:
+    // Frame rate used to size duration limited captures, capture stops early when it is exceeded
+    static constexpr uint32_t _maxFps = 1000;
+
+    // Swapchains with their own present interval, extra ones report 0
+    static constexpr size_t _maxSwapChains = 4;
+
+    struct SwapChainPresent
+    {
+        std::atomic<uint64_t> swapChain { 0 };
+        std::atomic<double> lastMs { 0.0 };
+    };
+
+    inline static std::mutex _mutex; // Start / finish, not taken per frame
+
+    inline static HANDLE _file = INVALID_HANDLE_VALUE;
+    inline static HANDLE _mapping = nullptr;
+    inline static BenchmarkHeader* _header = nullptr;
+    inline static BenchmarkFrame* _frames = nullptr;
+    inline static std::filesystem::path _basePath;
+
+    inline static std::atomic<bool> _starting { false };
+    inline static std::atomic<bool> _capturing { false };
+    inline static std::atomic<bool> _finishing { false };
+    inline static std::atomic<uint32_t> _count { 0 };
+    inline static std::atomic<uint32_t> _writers { 0 }; // Presents filling a record, Finish waits for them
+    inline static uint32_t _pendingFrames = 0; // Start request for the worker
+    inline static uint32_t _pendingSeconds = 0;
+    inline static uint32_t _capacity = 0;
+    inline static uint32_t _frameLimit = 0;
+    inline static double _startMs = 0.0;
+    inline static double _endMs = 0.0;
+    inline static std::array<SwapChainPresent, _maxSwapChains> _presents {};
+    inline static std::atomic<float> _lastUpscalerMs { 0.0f };
+
+    // Feature::Name allocates, it's only called when the feature changes
+    inline static std::mutex _nameMutex;
+    inline static const void* _namedFeature = nullptr;
+    inline static unsigned int _namedHandleId = 0;
+    inline static char _featureName[sizeof(BenchmarkFrame::upscaler)] {};
+
+    inline static std::atomic<double> _firstPresentMs { 0.0 };
+    inline static std::atomic<bool> _autoStartDone { false };
+
+    static bool OpenMapping(uint32_t capacity);
+    static void CloseMapping(uint32_t frameCount);
+    static void Open(uintptr_t);
+    static void Finish(uintptr_t);
+    static float MsBetweenPresents(uint64_t swapChain, double presentStartMs);
+    static void FillFromState(BenchmarkFrame& frame);
+
+  public:
+    // frames 0 means duration limited, returns true when the start is queued
+    static bool Start(uint32_t frames, uint32_t seconds);
+    static bool Start();
+    static void Stop();
+    static void Toggle();
+
+    // Called after the real present returns, times are Util::MillisecondsNow
+    static void FramePresented(BenchmarkRuntime runtime, uint64_t swapChain, uint32_t syncInterval, uint32_t flags,
+                               double presentStartMs, double presentEndMs, bool generated);
+
+    static bool IsStarting() { return _starting.load(std::memory_order_acquire); }
+    static bool IsCapturing() { return _capturing.load(std::memory_order_acquire); }
+    static bool IsFinishing() { return _finishing.load(std::memory_order_acquire); }
+    static uint32_t CapturedFrames() { return _count.load(std::memory_order_relaxed); }
+
+    // Path of last capture without extension (.bin, .csv, .json)
+    static std::filesystem::path LastCapturePath();
+};
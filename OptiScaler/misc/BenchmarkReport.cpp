@@ -0,0 +1,229 @@
+#include "pch.h"
+#include "BenchmarkReport.h"
+
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+static_assert(sizeof(BenchmarkFrame) % 8 == 0, "Records are written back to back");
+
+static double PercentileOf(const std::vector<float>& sorted, double p)
+{
+    if (sorted.empty())
+        return 0.0;
+
+    auto k = (size_t) std::ceil(p * (double) sorted.size());
+    k = std::clamp(k, (size_t) 1, sorted.size());
+
+    return sorted[k - 1];
+}
+
+static std::string JsonEscape(const std::string& value)
+{
+    std::string result;
+    result.reserve(value.size());
+
+    for (auto c : value)
+    {
+        if (c == '"' || c == '\\')
+            result += '\\';
+
+        if ((unsigned char) c < 0x20)
+            continue;
+
+        result += c;
+    }
+
+    return result;
+}
+
+static std::string CsvField(const std::string& value)
+{
+    if (value.find_first_of(",\"\r\n") == std::string::npos)
+        return value;
+
+    std::string result = "\"";
+
+    for (auto c : value)
+    {
+        if (c == '"')
+            result += '"';
+
+        result += c;
+    }
+
+    return result + "\"";
+}
+
+const char* BenchmarkReport::ReflexStageName(size_t stage)
+{
+    switch (static_cast<LatencyStage>(stage))
+    {
+    case LatencyStage::Simulation:
+        return "Simulation";
+    case LatencyStage::RenderSubmit:
+        return "RenderSubmit";
+    case LatencyStage::Present:
+        return "Present";
+    case LatencyStage::Driver:
+        return "Driver";
+    case LatencyStage::OsRenderQueue:
+        return "OsRenderQueue";
+    case LatencyStage::GpuRender:
+        return "GpuRender";
+    case LatencyStage::Total:
+        return "Total";
+    default:
+        return "Unknown";
+    }
+}
+
+BenchmarkSummary BenchmarkReport::Summarize(const BenchmarkFrame* frames, size_t count)
+{
+    BenchmarkSummary summary {};
+    summary.frames = count;
+
+    if (count == 0)
+        return summary;
+
+    std::vector<float> sorted;
+    sorted.reserve(count);
+
+    double sum = 0.0;
+    double presentApiSum = 0.0;
+    double upscalerSum = 0.0;
+    size_t upscalerCount = 0;
+    double reflexSum[BENCHMARK_REFLEX_STAGES] {};
+    size_t reflexCount[BENCHMARK_REFLEX_STAGES] {};
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const auto& frame = frames[i];
+
+        // First frame has no previous present
+        if (i > 0 && frame.msBetweenPresents > 0.0f)
+        {
+            sorted.push_back(frame.msBetweenPresents);
+            sum += frame.msBetweenPresents;
+        }
+
+        presentApiSum += frame.msInPresentApi;
+
+        if (frame.msUpscaler > 0.0f)
+        {
+            upscalerSum += frame.msUpscaler;
+            upscalerCount++;
+        }
+
+        for (size_t s = 0; s < BENCHMARK_REFLEX_STAGES; s++)
+        {
+            if (frame.msReflex[s] > 0.0f)
+            {
+                reflexSum[s] += frame.msReflex[s];
+                reflexCount[s]++;
+            }
+        }
+
+        summary.generatedFrames += frame.generated ? 1 : 0;
+        summary.fgActiveFrames += frame.fgActive ? 1 : 0;
+    }
+
+    const auto& last = frames[count - 1];
+    summary.upscaler = std::string(last.upscaler, strnlen(last.upscaler, sizeof(last.upscaler)));
+    summary.renderWidth = last.renderWidth;
+    summary.renderHeight = last.renderHeight;
+    summary.displayWidth = last.displayWidth;
+    summary.displayHeight = last.displayHeight;
+
+    summary.durationSec = (last.timeMs - frames[0].timeMs) / 1000.0;
+    summary.avgPresentApiMs = presentApiSum / (double) count;
+    summary.avgUpscalerMs = upscalerCount > 0 ? upscalerSum / (double) upscalerCount : 0.0;
+
+    for (size_t s = 0; s < BENCHMARK_REFLEX_STAGES; s++)
+        summary.avgReflexMs[s] = reflexCount[s] > 0 ? reflexSum[s] / (double) reflexCount[s] : 0.0;
+
+    if (sorted.empty())
+        return summary;
+
+    summary.meanMs = sum / (double) sorted.size();
+    summary.avgFps = summary.meanMs > 0.0 ? 1000.0 / summary.meanMs : 0.0;
+
+    std::sort(sorted.begin(), sorted.end());
+    summary.p50Ms = PercentileOf(sorted, 0.5);
+    summary.p95Ms = PercentileOf(sorted, 0.95);
+    summary.p99Ms = PercentileOf(sorted, 0.99);
+    summary.p999Ms = PercentileOf(sorted, 0.999);
+    summary.maxMs = sorted.back();
+    summary.low1Fps = summary.p99Ms > 0.0 ? 1000.0 / summary.p99Ms : 0.0;
+    summary.low01Fps = summary.p999Ms > 0.0 ? 1000.0 / summary.p999Ms : 0.0;
+
+    auto stutterLimit = (float) (summary.p50Ms * StutterFactor);
+    summary.stutters = sorted.end() - std::upper_bound(sorted.begin(), sorted.end(), stutterLimit);
+
+    return summary;
+}
+
+void BenchmarkReport::AppendCsv(std::string& out, const BenchmarkFrame* frames, size_t count,
+                                const std::string& application, uint32_t processId)
+{
+    out.reserve(out.size() + (count + 1) * 256);
+
+    out += "Application,ProcessID,SwapChainAddress,Runtime,SyncInterval,PresentFlags,FrameType,TimeInSeconds,"
+           "MsBetweenPresents,MsInPresentAPI,MsUpscaler,FGActive,Upscaler,RenderWidth,RenderHeight,DisplayWidth,"
+           "DisplayHeight";
+
+    for (size_t s = 0; s < BENCHMARK_REFLEX_STAGES; s++)
+        out += std::format(",MsReflex{}", ReflexStageName(s));
+
+    out += "\n";
+
+    auto app = CsvField(application);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const auto& frame = frames[i];
+        auto upscaler = CsvField(std::string(frame.upscaler, strnlen(frame.upscaler, sizeof(frame.upscaler))));
+
+        out += std::format("{},{},0x{:016X},{},{},{},{},{:.6f},{:.3f},{:.3f},{:.3f},{},{},{},{},{},{}", app,
+                           processId, frame.swapChain, frame.runtime == BenchmarkRuntime::Vulkan ? "Vulkan" : "DXGI",
+                           frame.syncInterval, frame.presentFlags, frame.generated ? "Generated" : "Application",
+                           frame.timeMs / 1000.0, frame.msBetweenPresents, frame.msInPresentApi, frame.msUpscaler,
+                           frame.fgActive, upscaler, frame.renderWidth, frame.renderHeight, frame.displayWidth,
+                           frame.displayHeight);
+
+        for (size_t s = 0; s < BENCHMARK_REFLEX_STAGES; s++)
+            out += std::format(",{:.3f}", frame.msReflex[s]);
+
+        out += "\n";
+    }
+}
+
+void BenchmarkReport::AppendJson(std::string& out, const BenchmarkSummary& summary, const std::string& application,
+                                 uint32_t processId)
+{
+    out += "{\n";
+    out += std::format("  \"application\": \"{}\",\n", JsonEscape(application));
+    out += std::format("  \"processId\": {},\n", processId);
+    out += std::format("  \"upscaler\": \"{}\",\n", JsonEscape(summary.upscaler));
+    out += std::format("  \"renderResolution\": [{}, {}],\n", summary.renderWidth, summary.renderHeight);
+    out += std::format("  \"displayResolution\": [{}, {}],\n", summary.displayWidth, summary.displayHeight);
+    out += std::format("  \"frames\": {},\n", summary.frames);
+    out += std::format("  \"generatedFrames\": {},\n", summary.generatedFrames);
+    out += std::format("  \"fgActiveFrames\": {},\n", summary.fgActiveFrames);
+    out += std::format("  \"durationSeconds\": {:.3f},\n", summary.durationSec);
+    out += std::format("  \"averageFps\": {:.2f},\n", summary.avgFps);
+    out += std::format("  \"low1Fps\": {:.2f},\n", summary.low1Fps);
+    out += std::format("  \"low01Fps\": {:.2f},\n", summary.low01Fps);
+    out += std::format("  \"frameTimeMs\": {{ \"mean\": {:.3f}, \"p50\": {:.3f}, \"p95\": {:.3f}, \"p99\": {:.3f}, "
+                       "\"p999\": {:.3f}, \"max\": {:.3f} }},\n",
+                       summary.meanMs, summary.p50Ms, summary.p95Ms, summary.p99Ms, summary.p999Ms, summary.maxMs);
+    out += std::format("  \"stutters\": {},\n", summary.stutters);
+    out += std::format("  \"presentApiMs\": {:.3f},\n", summary.avgPresentApiMs);
+    out += std::format("  \"upscalerMs\": {:.3f},\n", summary.avgUpscalerMs);
+    out += "  \"reflexMs\": {";
+
+    for (size_t s = 0; s < BENCHMARK_REFLEX_STAGES; s++)
+        out += std::format("{} \"{}\": {:.3f}", s == 0 ? "" : ",", ReflexStageName(s), summary.avgReflexMs[s]);
+
+    out += " }\n}\n";
+}
@@ -0,0 +1,100 @@
+#pragma once
+#include "SysUtils.h"
+
+#include <hooks/Reflex_Analytics.h>
+
+#include <string>
+
+// Benchmark capture records and report writers
+//
+// One fixed size record per presented frame, written by BenchmarkCapture straight into a memory mapped file.
+// Summary and exports are built from the records after capture stops, no graphics or OS calls are made here.
+// CSV starts with PresentMon columns (same names and order, unavailable ones left out) so existing tools can
+// read it, OptiScaler columns follow.
+
+inline constexpr uint32_t BENCHMARK_MAGIC = 0x4B424F4F; // OOBK
+inline constexpr uint32_t BENCHMARK_VERSION = 1;
+inline constexpr size_t BENCHMARK_REFLEX_STAGES = static_cast<size_t>(LatencyStage::Count);
+
+enum class BenchmarkRuntime : uint8_t
+{
+    DXGI,
+    Vulkan,
+};
+
+struct BenchmarkHeader
+{
+    uint32_t magic = BENCHMARK_MAGIC;
+    uint32_t version = BENCHMARK_VERSION;
+    uint32_t recordSize = 0;
+    uint32_t frameCount = 0;
+    uint32_t capacity = 0;
+    uint32_t processId = 0;
+};
+
+struct BenchmarkFrame
+{
+    double timeMs = 0.0; // Present call start, from capture start
+    float msBetweenPresents = 0.0f;
+    float msInPresentApi = 0.0f;
+    float msUpscaler = 0.0f;
+    float msReflex[BENCHMARK_REFLEX_STAGES] {}; // Rolling stage means, 0 when Reflex is not reporting
+
+    uint64_t swapChain = 0;
+    uint32_t renderWidth = 0;
+    uint32_t renderHeight = 0;
+    uint32_t displayWidth = 0;
+    uint32_t displayHeight = 0;
+    uint32_t syncInterval = 0;
+    uint32_t presentFlags = 0;
+
+    BenchmarkRuntime runtime = BenchmarkRuntime::DXGI;
+    uint8_t fgActive = 0;
+    uint8_t generated = 0;
+    char upscaler[29] {};
+};
+
+struct BenchmarkSummary
+{
+    size_t frames = 0;
+    size_t generatedFrames = 0;
+    size_t fgActiveFrames = 0;
+    double durationSec = 0.0;
+    double avgFps = 0.0;
+
+    double meanMs = 0.0;
+    double p50Ms = 0.0;
+    double p95Ms = 0.0;
+    double p99Ms = 0.0;
+    double p999Ms = 0.0;
+    double maxMs = 0.0;
+    double low1Fps = 0.0;
+    double low01Fps = 0.0;
+    size_t stutters = 0; // Frames over StutterFactor x median
+
+    double avgPresentApiMs = 0.0;
+    double avgUpscalerMs = 0.0;
+    double avgReflexMs[BENCHMARK_REFLEX_STAGES] {};
+
+    std::string upscaler; // Of the last frame
+    uint32_t renderWidth = 0;
+    uint32_t renderHeight = 0;
+    uint32_t displayWidth = 0;
+    uint32_t displayHeight = 0;
+};
+
+class BenchmarkReport
+{
+  public:
+    static constexpr double StutterFactor = 2.0;
+
+    static BenchmarkSummary Summarize(const BenchmarkFrame* frames, size_t count);
+
+    static void AppendCsv(std::string& out, const BenchmarkFrame* frames, size_t count, const std::string& application,
+                          uint32_t processId);
+
+    static void AppendJson(std::string& out, const BenchmarkSummary& summary, const std::string& application,
+                           uint32_t processId);
+
+    static const char* ReflexStageName(size_t stage);
+};
@@ -0,0 +1,239 @@
+#include "pch.h"
+#include "DynamicResolution.h"
+
+#include <Config.h>
+
+#include <cmath>
+
+void DrsController::Configure(const DrsControllerSettings& settings)
+{
+    _settings = settings;
+
+    if (_settings.minScale > _settings.maxScale)
+        std::swap(_settings.minScale, _settings.maxScale);
+
+    _scale = std::clamp(_scale, _settings.minScale, _settings.maxScale);
+}
+
+void DrsController::Reset(float scale)
+{
+    _frameMs = 0.0;
+    _upscalerMs = 0.0;
+    _fixedMs = 0.0;
+    _pixelMs = 0.0;
+    _samples = 0;
+    _sinceChange = 0;
+    _area = 0.0f;
+    _areaFrames = 0;
+    _areaMs = 0.0;
+    _pointArea = 0.0f;
+    _pointMs = 0.0;
+    _scale = std::clamp(scale, _settings.minScale, _settings.maxScale);
+}
+
+void DrsController::Fit(float area, double rawRenderMs, double renderMs)
+{
+    // Operating point is the raw average of PointFrames frames at the same render size, filter would lag
+    if (std::fabs(area - _area) > 0.005f)
+    {
+        _area = area;
+        _areaFrames = 0;
+        _areaMs = 0.0;
+    }
+
+    if (_areaFrames < PointFrames)
+    {
+        _areaFrames++;
+        _areaMs += rawRenderMs;
+
+        if (_areaFrames == PointFrames)
+        {
+            auto pointMs = _areaMs / PointFrames;
+
+            // Close points only refresh the reference, noise would dominate the slope
+            if (_pointArea > 0.0f && std::fabs(area - _pointArea) > MinPointDistance)
+            {
+                auto slope = (pointMs - _pointMs) / (double) (area - _pointArea);
+
+                // Slope at or below 0 means a bottleneck elsewhere (CPU bound), everything is fixed cost then
+                if (slope > 0.0)
+                    _fixedMs = std::clamp(pointMs - slope * area, 0.0, pointMs);
+                else
+                    _fixedMs = pointMs;
+            }
+
+            _pointArea = area;
+            _pointMs = pointMs;
+        }
+    }
+
+    // Load changes are put on render size dependent part
+    _pixelMs = std::max((renderMs - _fixedMs) / area, renderMs * 0.05);
+}
+
+double DrsController::PredictMs(float scale) const
+{
+    return _upscalerMs + _fixedMs + _pixelMs * (double) scale * (double) scale;
+}
+
+float DrsController::Desired(bool& reachable) const
+{
+    reachable = true;
+
+    auto minScale = _settings.minScale;
+    auto maxScale = _settings.maxScale;
+
+    // Aim below target when going up so the result doesn't land on the edge of the band
+    auto target = _frameMs > _settings.targetMs ? _settings.targetMs : _settings.targetMs * (1.0 - Hysteresis * 0.5);
+    auto budget = target - _upscalerMs - _fixedMs;
+
+    if (_pixelMs <= 0.0)
+        return _scale;
+
+    if (budget <= _pixelMs * minScale * minScale)
+    {
+        // Target can't be reached, only give up quality when it still buys a meaningful amount of time
+        reachable = false;
+        auto gain = _pixelMs * ((double) maxScale * maxScale - (double) minScale * minScale);
+        return gain < _frameMs * 0.1 ? maxScale : minScale;
+    }
+
+    return std::clamp((float) std::sqrt(budget / _pixelMs), minScale, maxScale);
+}
+
+float DrsController::Update(double frameMs, double upscalerMs, float renderScale)
+{
+    // Loading screens, pauses, alt-tab
+    if (frameMs <= 0.0 || frameMs > 1000.0)
+        return _scale;
+
+    upscalerMs = std::clamp(upscalerMs, 0.0, frameMs);
+
+    if (_samples == 0)
+    {
+        _frameMs = frameMs;
+        _upscalerMs = upscalerMs;
+    }
+    else
+    {
+        auto alpha = frameMs > _frameMs ? RiseSmoothing : FallSmoothing;
+        _frameMs += alpha * (frameMs - _frameMs);
+        _upscalerMs += FallSmoothing * (upscalerMs - _upscalerMs);
+    }
+
+    _samples++;
+    _sinceChange++;
+
+    auto scale = renderScale > 0.0f ? renderScale : _scale;
+    auto area = std::max(scale * scale, 0.01f);
+    Fit(area, std::max(frameMs - upscalerMs, 0.1), std::max(_frameMs - _upscalerMs, 0.1));
+
+    // First operating point is taken before anything changes
+    if (_samples < PointFrames)
+        return _scale;
+
+    auto error = _frameMs / _settings.targetMs - 1.0;
+    auto reachable = true;
+    auto desired = Desired(reachable);
+    auto next = _scale;
+
+    if (error > Hysteresis && desired < _scale)
+    {
+        next = std::max(desired, _scale - MaxStepDown);
+    }
+    else if ((error < -Hysteresis || !reachable) && desired > _scale && _sinceChange >= SettleFrames)
+    {
+        next = std::min(desired, _scale + MaxStepUp);
+    }
+
+    next = std::clamp(next, _settings.minScale, _settings.maxScale);
+
+    auto atBound = next != _scale && (next == _settings.minScale || next == _settings.maxScale);
+
+    if (std::fabs(next - _scale) >= MinStep || atBound)
+    {
+        _scale = next;
+        _sinceChange = 0;
+    }
+
+    return _scale;
+}
+
+bool DynamicResolution::IsEnabled() { return Config::Instance()->DrsControllerEnabled.value_or_default(); }
+
+void DynamicResolution::FramePresented(double frameMs, bool generated, double upscalerMs, float renderScale)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    // Controller works with rendered frames, generated ones only add to the interval
+    if (generated)
+    {
+        _generatedMs += frameMs;
+        return;
+    }
+
+    frameMs += _generatedMs;
+    _generatedMs = 0.0;
+
+    if (_baseScale == 0.0f)
+        return;
+
+    auto settings = _controller.Settings();
+    auto target = (double) Config::Instance()->DrsTargetFrameTime.value_or_default();
+
+    if (settings.targetMs != target)
+    {
+        settings.targetMs = target;
+        _controller.Configure(settings);
+    }
+
+    _controller.Update(frameMs, upscalerMs, renderScale);
+}
+
+float DynamicResolution::RenderScale(float baseScale, float minScale, float maxScale)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    // Games may query every quality mode, only bounds (display size, DRS settings) restart the controller
+    if (_baseScale == 0.0f || minScale != _minScale || maxScale != _maxScale)
+    {
+        LOG_DEBUG("Base: {:.3f}, bounds: {:.3f} - {:.3f}", baseScale, minScale, maxScale);
+
+        _baseScale = baseScale;
+        _minScale = minScale;
+        _maxScale = maxScale;
+
+        DrsControllerSettings settings {};
+        settings.targetMs = Config::Instance()->DrsTargetFrameTime.value_or_default();
+        settings.minScale = minScale;
+        settings.maxScale = maxScale;
+
+        _controller.Configure(settings);
+        _controller.Reset(baseScale);
+    }
+
+    return _controller.Scale();
+}
+
+float DynamicResolution::CurrentScale()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _baseScale == 0.0f ? 0.0f : _controller.Scale();
+}
+
+double DynamicResolution::FilteredMs()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _controller.FilteredMs();
+}
+
+void DynamicResolution::Reset()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _baseScale = 0.0f;
+    _minScale = 0.0f;
+    _maxScale = 0.0f;
+    _generatedMs = 0.0;
+    _controller.Reset(1.0f);
+}
@@ -0,0 +1,106 @@
+#pragma once
+#include "SysUtils.h"
+
+#include <mutex>
+
+// Dynamic resolution controller
+//
+// Picks the render scale (render width / display width) advertised by NGX optimal settings so frames hold a
+// target frame time. Model predictive: rendered frame time is modelled as
+//     frame = upscaler + fixed + pixel * scale^2
+// fixed (cost which doesn't follow render size) comes from two operating points at different scales,
+// pixel is refitted every frame from the filtered frame time, so load changes move the prediction directly
+// and there is no integrator to wind up when the game doesn't follow the advertised size.
+//
+// Hysteresis: frame times inside +-Hysteresis of target keep the scale, going down is immediate and rate limited
+// by MaxStepDown, going up waits SettleFrames after the last change and is limited by MaxStepUp.
+// When target can't be reached and lower resolution doesn't buy much (CPU bound) scale goes back up.
+// Scale stays inside the DRS min / max bounds games get from NGX.
+
+struct DrsControllerSettings
+{
+    double targetMs = 16.667;
+    float minScale = 0.5f;
+    float maxScale = 1.0f;
+};
+
+class DrsController
+{
+  public:
+    static constexpr double Hysteresis = 0.05;  // Relative band around target which keeps the scale
+    static constexpr float MinStep = 0.01f;     // Smaller changes are not published
+    static constexpr float MaxStepDown = 0.10f; // Per update
+    static constexpr float MaxStepUp = 0.03f;   // Per update
+    static constexpr uint32_t SettleFrames = 30;
+    static constexpr uint32_t PointFrames = 8; // Frames averaged for an operating point
+    static constexpr float MinPointDistance = 0.1f; // Scale^2 difference of operating points used for a fit
+
+    // Frame time filter, load spikes are followed faster than relief
+    static constexpr double RiseSmoothing = 0.5;
+    static constexpr double FallSmoothing = 0.1;
+
+  private:
+    DrsControllerSettings _settings;
+
+    double _frameMs = 0.0;
+    double _upscalerMs = 0.0;
+    double _fixedMs = 0.0;
+    double _pixelMs = 0.0; // Render cost at scale 1.0
+    uint32_t _samples = 0;
+
+    float _scale = 1.0f;
+    uint32_t _sinceChange = 0;
+
+    // Operating points for fixed cost fit
+    float _area = 0.0f;
+    uint32_t _areaFrames = 0;
+    double _areaMs = 0.0;
+    float _pointArea = 0.0f;
+    double _pointMs = 0.0;
+
+    void Fit(float area, double rawRenderMs, double renderMs);
+    float Desired(bool& reachable) const;
+
+  public:
+    void Configure(const DrsControllerSettings& settings);
+    void Reset(float scale);
+
+    // frameMs: rendered frame time, upscalerMs: upscaler GPU time of the frame,
+    // renderScale: scale the game actually rendered at, 0 when unknown (advertised one is used)
+    // Returns the scale to advertise
+    float Update(double frameMs, double upscalerMs, float renderScale);
+
+    // Predicted rendered frame time at scale with current model
+    double PredictMs(float scale) const;
+
+    float Scale() const { return _scale; }
+    double FilteredMs() const { return _frameMs; }
+    double FixedMs() const { return _fixedMs; }
+    double PixelMs() const { return _pixelMs; }
+    const DrsControllerSettings& Settings() const { return _settings; }
+};
+
+// Controller fed from presents and read by NGX optimal settings callbacks
+class DynamicResolution
+{
+  private:
+    inline static std::mutex _mutex;
+    inline static DrsController _controller;
+    inline static double _generatedMs = 0.0; // Present intervals of generated frames belong to next real frame
+    inline static float _minScale = 0.0f;
+    inline static float _maxScale = 0.0f;
+    inline static float _baseScale = 0.0f;
+
+  public:
+    static bool IsEnabled();
+
+    static void FramePresented(double frameMs, bool generated, double upscalerMs, float renderScale);
+
+    // Scale to advertise, baseScale is the quality mode scale controller starts from.
+    // Bounds change (display size / DRS settings) restarts the controller.
+    static float RenderScale(float baseScale, float minScale, float maxScale);
+
+    static float CurrentScale();
+    static double FilteredMs();
+    static void Reset();
+};
@@ -0,0 +1,217 @@
+#include "pch.h"
+#include "FrameStats.h"
+
+#include <Util.h>
+
+#include <cmath>
+
+size_t FrameTimeWindow::BucketOf(double ms)
+{
+    if (ms <= 0.0)
+        return 0;
+
+    auto bucket = (size_t) (ms / BucketMs);
+    return bucket < BucketCount ? bucket : BucketCount - 1;
+}
+
+void FrameTimeWindow::TreeAdd(size_t bucket, int32_t delta)
+{
+    for (auto i = bucket + 1; i <= BucketCount; i += i & (~i + 1))
+        _tree[i] += delta;
+}
+
+double FrameTimeWindow::Kth(size_t k) const
+{
+    // Largest position with prefix count < k, result bucket is the next one
+    size_t pos = 0;
+
+    for (size_t step = BucketCount; step > 0; step >>= 1)
+    {
+        if (pos + step <= BucketCount && _tree[pos + step] < k)
+        {
+            pos += step;
+            k -= _tree[pos];
+        }
+    }
+
+    // Middle of the bucket
+    return ((double) pos + 0.5) * BucketMs;
+}
+
+bool FrameTimeWindow::Add(double ms, bool generated, double stutterFactor)
+{
+    bool stutter = _count >= MinStutterSamples && ms > stutterFactor * Percentile(0.5);
+
+    if (_count == WindowSize)
+    {
+        const auto& old = _ring[_head];
+        TreeAdd(BucketOf(old.ms), -1);
+        _sum -= old.ms;
+        _stutters -= old.stutter ? 1 : 0;
+        _generated -= old.generated ? 1 : 0;
+    }
+    else
+    {
+        _count++;
+    }
+
+    // Sample leaving the short window
+    if (_count > ShortWindowSize)
+        _shortSum -= _ring[(_head + WindowSize - ShortWindowSize) % WindowSize].ms;
+
+    // Bucket from stored value, eviction has to find the same bucket
+    auto& sample = _ring[_head];
+    sample = { (float) ms, generated, stutter };
+    _head = (_head + 1) % WindowSize;
+
+    TreeAdd(BucketOf(sample.ms), 1);
+    _sum += sample.ms;
+    _shortSum += sample.ms;
+    _stutters += stutter ? 1 : 0;
+    _generated += generated ? 1 : 0;
+
+    return stutter;
+}
+
+double FrameTimeWindow::Percentile(double p) const
+{
+    if (_count == 0)
+        return 0.0;
+
+    auto k = (size_t) std::ceil(p * (double) _count);
+    k = std::clamp(k, (size_t) 1, _count);
+
+    return Kth(k);
+}
+
+double FrameTimeWindow::ShortMean() const
+{
+    auto count = std::min(_count, ShortWindowSize);
+    return count == 0 ? 0.0 : _shortSum / (double) count;
+}
+
+void FrameTimeWindow::Summarize(FrameTimeSummary& summary) const
+{
+    summary = {};
+    summary.samples = _count;
+
+    if (_count == 0)
+        return;
+
+    summary.mean = Mean();
+    summary.min = Kth(1);
+    summary.max = Kth(_count);
+    summary.p50 = Percentile(0.5);
+    summary.p95 = Percentile(0.95);
+    summary.p99 = Percentile(0.99);
+    summary.p999 = Percentile(0.999);
+    summary.low1 = summary.p99 > 0.0 ? 1000.0 / summary.p99 : 0.0;
+    summary.low01 = summary.p999 > 0.0 ? 1000.0 / summary.p999 : 0.0;
+    summary.stutters = _stutters;
+}
+
+void FrameTimeWindow::Reset()
+{
+    _ring = {};
+    std::fill(_tree.begin(), _tree.end(), 0);
+    _head = 0;
+    _count = 0;
+    _sum = 0.0;
+    _shortSum = 0.0;
+    _stutters = 0;
+    _generated = 0;
+}
+
+void FrameStats::Add(double frameTimeMs, bool generated)
+{
+    if (frameTimeMs <= 0.0 || frameTimeMs > _maxFrameTimeMs)
+        return;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _totalFrames++;
+
+    if (_displayed.Add(frameTimeMs, generated, StutterFactor))
+        _totalStutters++;
+
+    _renderedAccum += frameTimeMs;
+
+    if (!generated)
+    {
+        _rendered.Add(_renderedAccum, false, StutterFactor);
+        _renderedAccum = 0.0;
+    }
+}
+
+FrameStatsSummary FrameStats::Summary()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    FrameStatsSummary summary {};
+    _displayed.Summarize(summary.displayed);
+    _rendered.Summarize(summary.rendered);
+    summary.generated = _displayed.Generated();
+    summary.totalFrames = _totalFrames;
+    summary.totalStutters = _totalStutters;
+
+    return summary;
+}
+
+double FrameStats::ShortMeanMs()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _displayed.ShortMean();
+}
+
+std::filesystem::path FrameStats::DefaultCsvPath()
+{
+    return Util::DllPath().parent_path() / L"OptiScaler_FrameStats.csv";
+}
+
+bool FrameStats::ExportCsv(const std::filesystem::path& path)
+{
+    std::string csv;
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        csv.reserve(32 * (_displayed.Count() + 1));
+        csv += "frame,frame_time_ms,generated,stutter\n";
+
+        size_t index = 0;
+        _displayed.ForEach(
+            [&](float ms, bool generated, bool stutter)
+            { csv += std::format("{},{:.3f},{},{}\n", index++, ms, generated ? 1 : 0, stutter ? 1 : 0); });
+    }
+
+    FILE* file = _wfopen(path.c_str(), L"wb");
+
+    if (file == nullptr)
+    {
+        LOG_ERROR("Can't open frame stats file: {}", wstring_to_string(path.wstring()));
+        return false;
+    }
+
+    auto written = fwrite(csv.data(), 1, csv.size(), file);
+    fclose(file);
+
+    if (written != csv.size())
+    {
+        LOG_ERROR("Can't write frame stats file: {}", wstring_to_string(path.wstring()));
+        return false;
+    }
+
+    LOG_INFO("Frame stats exported to {}", wstring_to_string(path.wstring()));
+    return true;
+}
+
+void FrameStats::Reset()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _displayed.Reset();
+    _rendered.Reset();
+    _renderedAccum = 0.0;
+    _totalFrames = 0;
+    _totalStutters = 0;
+}
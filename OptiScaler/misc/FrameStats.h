@@ -0,0 +1,127 @@
+#pragma once
+#include "SysUtils.h"
+
+#include <array>
+#include <mutex>
+#include <vector>
+#include <filesystem>
+
+// Windowed frame time statistics
+//
+// Fed with displayed frame times (ms) from the overlay, generated tells if frame generation produced the frame.
+// Percentiles are order statistics over the last WindowSize frames, kept in a Fenwick tree of 0.01 ms buckets so
+// adding, evicting and querying a percentile are O(log n). Mean, short mean and stutter counts are running sums.
+// Rendered (real) frame times are the intervals between frames which were not generated.
+// A stutter is a frame longer than StutterFactor times the median of the window before it.
+
+struct FrameTimeSummary
+{
+    size_t samples = 0;
+    double mean = 0.0;
+    double min = 0.0;
+    double max = 0.0;
+    double p50 = 0.0;
+    double p95 = 0.0;
+    double p99 = 0.0;
+    double p999 = 0.0;
+    double low1 = 0.0;  // 1% low fps, from p99
+    double low01 = 0.0; // 0.1% low fps, from p99.9
+    size_t stutters = 0;
+};
+
+struct FrameStatsSummary
+{
+    FrameTimeSummary displayed;
+    FrameTimeSummary rendered;
+    size_t generated = 0; // Generated frames in displayed window
+    UINT64 totalFrames = 0;
+    UINT64 totalStutters = 0;
+};
+
+class FrameTimeWindow
+{
+  public:
+    static constexpr size_t WindowSize = 2000;
+    static constexpr size_t ShortWindowSize = 100;
+
+    static constexpr double BucketMs = 0.01;
+    static constexpr size_t BucketCount = 32768; // Power of two for Fenwick descent, ~327 ms
+    static constexpr size_t MinStutterSamples = 30;
+
+  private:
+    struct Sample
+    {
+        float ms = 0.0f;
+        bool generated = false;
+        bool stutter = false;
+    };
+
+    std::array<Sample, WindowSize> _ring {};
+    std::vector<uint32_t> _tree = std::vector<uint32_t>(BucketCount + 1, 0);
+    size_t _head = 0;
+    size_t _count = 0;
+    double _sum = 0.0;
+    double _shortSum = 0.0;
+    size_t _stutters = 0;
+    size_t _generated = 0;
+
+    static size_t BucketOf(double ms);
+    void TreeAdd(size_t bucket, int32_t delta);
+    double Kth(size_t k) const; // 1 based
+
+  public:
+    // Returns true if the sample was a stutter
+    bool Add(double ms, bool generated, double stutterFactor);
+
+    double Percentile(double p) const;
+    double Mean() const { return _count == 0 ? 0.0 : _sum / (double) _count; }
+    double ShortMean() const;
+    size_t Count() const { return _count; }
+    size_t Generated() const { return _generated; }
+
+    void Summarize(FrameTimeSummary& summary) const;
+
+    // Oldest to newest
+    template <typename F> void ForEach(F&& fn) const
+    {
+        auto start = (_head + WindowSize - _count) % WindowSize;
+
+        for (size_t i = 0; i < _count; i++)
+        {
+            const auto& sample = _ring[(start + i) % WindowSize];
+            fn(sample.ms, sample.generated, sample.stutter);
+        }
+    }
+
+    void Reset();
+};
+
+class FrameStats
+{
+  private:
+    inline static std::mutex _mutex;
+    inline static FrameTimeWindow _displayed;
+    inline static FrameTimeWindow _rendered;
+    inline static double _renderedAccum = 0.0;
+    inline static UINT64 _totalFrames = 0;
+    inline static UINT64 _totalStutters = 0;
+
+    // Longer gaps are pauses / loading screens, not frames
+    static constexpr double _maxFrameTimeMs = 1000.0;
+
+  public:
+    static constexpr double StutterFactor = 2.0;
+
+    static void Add(double frameTimeMs, bool generated);
+
+    static FrameStatsSummary Summary();
+
+    // Mean of last ShortWindowSize displayed frames
+    static double ShortMeanMs();
+
+    // Displayed frames of the window, oldest first
+    static bool ExportCsv(const std::filesystem::path& path);
+    static std::filesystem::path DefaultCsvPath();
+
+    static void Reset();
+};
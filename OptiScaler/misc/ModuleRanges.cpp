@@ -0,0 +1,135 @@
+#include "pch.h"
+#include "ModuleRanges.h"
+
+#include <proxies/Ntdll_Proxy.h>
+
+#include <psapi.h>
+
+// Loader notification structures, not part of the SDK headers
+struct LdrDllNotificationData
+{
+    ULONG Flags;
+    const UNICODE_STRING* FullDllName;
+    const UNICODE_STRING* BaseDllName;
+    PVOID DllBase;
+    ULONG SizeOfImage;
+};
+
+static constexpr ULONG LdrDllNotificationLoaded = 1;
+static constexpr ULONG LdrDllNotificationUnloaded = 2;
+
+typedef VOID(CALLBACK* PFN_LdrDllNotification)(ULONG reason, const LdrDllNotificationData* data, PVOID context);
+typedef NTSTATUS(NTAPI* PFN_LdrRegisterDllNotification)(ULONG flags, PFN_LdrDllNotification callback, PVOID context,
+                                                        PVOID* cookie);
+typedef NTSTATUS(NTAPI* PFN_LdrUnregisterDllNotification)(PVOID cookie);
+
+// Called with loader lock held, only updates the table
+static VOID CALLBACK OnDllNotification(ULONG reason, const LdrDllNotificationData* data, PVOID context)
+{
+    if (data == nullptr)
+        return;
+
+    if (reason == LdrDllNotificationLoaded)
+    {
+        std::string name;
+
+        if (data->BaseDllName != nullptr && data->BaseDllName->Buffer != nullptr)
+        {
+            auto length = data->BaseDllName->Length / sizeof(wchar_t);
+            name = wstring_to_string(std::wstring(data->BaseDllName->Buffer, length));
+        }
+
+        ModuleRanges::Add((uintptr_t) data->DllBase, data->SizeOfImage, (HMODULE) data->DllBase, name);
+    }
+    else if (reason == LdrDllNotificationUnloaded)
+    {
+        ModuleRanges::Remove((uintptr_t) data->DllBase);
+    }
+}
+
+static size_t ImageSize(HMODULE module)
+{
+    auto dosHeader = (const IMAGE_DOS_HEADER*) module;
+    if (dosHeader == nullptr || dosHeader->e_magic != IMAGE_DOS_SIGNATURE)
+        return 0;
+
+    auto ntHeaders = (const IMAGE_NT_HEADERS*) ((const uint8_t*) module + dosHeader->e_lfanew);
+    if (ntHeaders->Signature != IMAGE_NT_SIGNATURE)
+        return 0;
+
+    return ntHeaders->OptionalHeader.SizeOfImage;
+}
+
+void ModuleRanges::Init()
+{
+    if (IsActive() || NtdllProxy::Module() == nullptr)
+        return;
+
+    auto registerNotification =
+        (PFN_LdrRegisterDllNotification) GetProcAddress(NtdllProxy::Module(), "LdrRegisterDllNotification");
+
+    if (registerNotification == nullptr)
+    {
+        LOG_WARN("LdrRegisterDllNotification not found, using Windows APIs for caller checks");
+        return;
+    }
+
+    // Register first so modules loaded while reading the list are not missed, Add replaces duplicates
+    auto status = registerNotification(0, OnDllNotification, nullptr, &_cookie);
+    if (status != 0)
+    {
+        LOG_WARN("LdrRegisterDllNotification result: {:X}, using Windows APIs for caller checks", (UINT) status);
+        _cookie = nullptr;
+        return;
+    }
+
+    std::vector<HMODULE> modules(256);
+    DWORD needed = 0;
+
+    while (K32EnumProcessModules(GetCurrentProcess(), modules.data(), (DWORD) (modules.size() * sizeof(HMODULE)),
+                                 &needed))
+    {
+        if (needed <= modules.size() * sizeof(HMODULE))
+        {
+            modules.resize(needed / sizeof(HMODULE));
+            break;
+        }
+
+        modules.resize(needed / sizeof(HMODULE) + 32);
+    }
+
+    wchar_t path[MAX_PATH];
+
+    for (auto module : modules)
+    {
+        auto size = ImageSize(module);
+        if (size == 0)
+            continue;
+
+        std::string name;
+        if (auto length = GetModuleFileNameW(module, path, MAX_PATH); length > 0)
+            name = wstring_to_string(std::filesystem::path(std::wstring(path, length)).filename().wstring());
+
+        Add((uintptr_t) module, size, module, name);
+    }
+
+    _active.store(true, std::memory_order_release);
+
+    LOG_INFO("Tracking {} modules", Count());
+}
+
+void ModuleRanges::Shutdown()
+{
+    _active.store(false, std::memory_order_release);
+
+    if (_cookie == nullptr || NtdllProxy::Module() == nullptr)
+        return;
+
+    auto unregisterNotification =
+        (PFN_LdrUnregisterDllNotification) GetProcAddress(NtdllProxy::Module(), "LdrUnregisterDllNotification");
+
+    if (unregisterNotification != nullptr)
+        unregisterNotification(_cookie);
+
+    _cookie = nullptr;
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include "SysUtils.h"
+
+#include <atomic>
+#include <string>
+#include <vector>
+#include <shared_mutex>
+
+// Address range table of loaded modules
+//
+// Filled once from the module list and kept up to date with loader notifications,
+// Util::GetCallerModule / WhoIsTheCaller use it instead of GetModuleHandleEx + GetModuleFileName.
+// Lookups are a binary search under a shared lock, no system calls.
+// Until Init is called (or when loader notifications are not available) callers fall back to Windows APIs.
+
+class ModuleRanges
+{
+  private:
+    struct Range
+    {
+        uintptr_t start = 0;
+        uintptr_t end = 0;
+        HMODULE module = nullptr;
+        std::string name; // File name only
+    };
+
+    inline static std::shared_mutex _mutex;
+    inline static std::vector<Range> _ranges; // Sorted by start
+    inline static std::atomic<bool> _active { false };
+    inline static PVOID _cookie = nullptr;
+
+    static const Range* FindRange(uintptr_t address);
+
+  public:
+    // Registers for loader notifications and reads currently loaded modules
+    static void Init();
+    static void Shutdown();
+
+    static bool IsActive() { return _active.load(std::memory_order_acquire); }
+
+    // Overlapping entries (missed unloads) are replaced
+    static void Add(uintptr_t base, size_t size, HMODULE module, std::string_view name);
+    static void Remove(uintptr_t base);
+    static void Clear();
+
+    // nullptr when address is not in a known module
+    static HMODULE Find(const void* address);
+
+    // Empty when address is not in a known module
+    static std::string Name(const void* address);
+
+    // Case insensitive compare against module file name, e.g. "amdxc64.dll"
+    static bool IsInModule(const void* address, std::string_view name);
+
+    static size_t Count();
+};
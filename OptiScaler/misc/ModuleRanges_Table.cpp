@@ -0,0 +1,92 @@
+#include "pch.h"
+#include "ModuleRanges.h"
+
+#include <cctype>
+#include <algorithm>
+
+// Range table part of ModuleRanges, no Windows calls so it's also built by the host tests
+
+static bool EqualsInsensitive(std::string_view a, std::string_view b)
+{
+    if (a.size() != b.size())
+        return false;
+
+    for (size_t i = 0; i < a.size(); i++)
+    {
+        if (std::tolower((unsigned char) a[i]) != std::tolower((unsigned char) b[i]))
+            return false;
+    }
+
+    return true;
+}
+
+void ModuleRanges::Add(uintptr_t base, size_t size, HMODULE module, std::string_view name)
+{
+    if (base == 0 || size == 0)
+        return;
+
+    auto end = base + size;
+
+    std::unique_lock lock(_mutex);
+
+    std::erase_if(_ranges, [base, end](const Range& range) { return range.start < end && base < range.end; });
+
+    auto it = std::lower_bound(_ranges.begin(), _ranges.end(), base,
+                               [](const Range& range, uintptr_t value) { return range.start < value; });
+
+    _ranges.insert(it, Range { base, end, module, std::string(name) });
+}
+
+void ModuleRanges::Remove(uintptr_t base)
+{
+    std::unique_lock lock(_mutex);
+    std::erase_if(_ranges, [base](const Range& range) { return range.start == base; });
+}
+
+void ModuleRanges::Clear()
+{
+    std::unique_lock lock(_mutex);
+    _ranges.clear();
+}
+
+const ModuleRanges::Range* ModuleRanges::FindRange(uintptr_t address)
+{
+    auto it = std::upper_bound(_ranges.begin(), _ranges.end(), address,
+                               [](uintptr_t value, const Range& range) { return value < range.start; });
+
+    if (it == _ranges.begin())
+        return nullptr;
+
+    --it;
+    return address < it->end ? &*it : nullptr;
+}
+
+HMODULE ModuleRanges::Find(const void* address)
+{
+    std::shared_lock lock(_mutex);
+
+    auto range = FindRange((uintptr_t) address);
+    return range != nullptr ? range->module : nullptr;
+}
+
+std::string ModuleRanges::Name(const void* address)
+{
+    std::shared_lock lock(_mutex);
+
+    auto range = FindRange((uintptr_t) address);
+    return range != nullptr ? range->name : std::string();
+}
+
+bool ModuleRanges::IsInModule(const void* address, std::string_view name)
+{
+    std::shared_lock lock(_mutex);
+
+    auto range = FindRange((uintptr_t) address);
+    return range != nullptr && EqualsInsensitive(range->name, name);
+}
+
+size_t ModuleRanges::Count()
+{
+    std::shared_lock lock(_mutex);
+    return _ranges.size();
+}
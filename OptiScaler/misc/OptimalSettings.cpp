@@ -0,0 +1,196 @@
+#include "pch.h"
+#include "OptimalSettings.h"
+
+#include <Config.h>
+
+// Default display / render ratios, indexed by NVSDK_NGX_PerfQuality_Value
+static constexpr double DefaultRatios[OptimalSettings::ModeCount] = { 2.0, 1.7, 1.5, 3.0, 1.3, 1.0 };
+static constexpr float DefaultScales[OptimalSettings::ModeCount] = { 0.5f,        1.0f / 1.7f, 1.0f / 1.5f,
+                                                                     0.33333333f, 1.0f / 1.3f, 1.0f };
+
+OptimalSettingsConfig OptimalSettingsConfig::FromConfig()
+{
+    auto config = Config::Instance();
+
+    OptimalSettingsConfig result;
+    result.extendedLimits = config->ExtendedLimits.value_or_default();
+    result.upscaleRatioOverride = config->UpscaleRatioOverrideEnabled.value_or_default();
+    result.upscaleRatio = config->UpscaleRatioOverrideValue.value_or_default();
+    result.qualityRatioOverride = config->QualityRatioOverrideEnabled.value_or_default();
+    result.qualityRatios[NVSDK_NGX_PerfQuality_Value_MaxPerf] = config->QualityRatio_Performance.value_or_default();
+    result.qualityRatios[NVSDK_NGX_PerfQuality_Value_Balanced] = config->QualityRatio_Balanced.value_or_default();
+    result.qualityRatios[NVSDK_NGX_PerfQuality_Value_MaxQuality] = config->QualityRatio_Quality.value_or_default();
+    result.qualityRatios[NVSDK_NGX_PerfQuality_Value_UltraPerformance] =
+        config->QualityRatio_UltraPerformance.value_or_default();
+    result.qualityRatios[NVSDK_NGX_PerfQuality_Value_UltraQuality] =
+        config->QualityRatio_UltraQuality.value_or_default();
+    result.qualityRatios[NVSDK_NGX_PerfQuality_Value_DLAA] = config->QualityRatio_DLAA.value_or_default();
+    result.roundTo = config->RoundInternalResolution;
+    result.drsMinOverride = config->DrsMinOverrideEnabled.value_or_default();
+    result.drsMaxOverride = config->DrsMaxOverrideEnabled.value_or_default();
+
+    return result;
+}
+
+std::optional<float> OptimalSettings::OverrideRatio(const OptimalSettingsConfig& config,
+                                                    NVSDK_NGX_PerfQuality_Value quality)
+{
+    auto sliderLimit = config.extendedLimits ? 0.1f : 1.0f;
+
+    if (config.upscaleRatioOverride && config.upscaleRatio >= sliderLimit)
+        return config.upscaleRatio;
+
+    if (!config.qualityRatioOverride || (size_t) quality >= ModeCount)
+        return std::nullopt;
+
+    if (config.qualityRatios[quality] >= sliderLimit)
+        return config.qualityRatios[quality];
+
+    return std::nullopt;
+}
+
+OptimalSettingsEntry OptimalSettings::Compute(const OptimalSettingsConfig& config, OptimalSettingsFeature feature,
+                                              NVSDK_NGX_PerfQuality_Value quality, unsigned int width,
+                                              unsigned int height)
+{
+    OptimalSettingsEntry entry;
+
+    if (auto ratio = OverrideRatio(config, quality); ratio.has_value())
+    {
+        entry.renderWidth = (unsigned int) ((float) width / ratio.value());
+        entry.renderHeight = (unsigned int) ((float) height / ratio.value());
+        entry.scale = 1.0f / ratio.value();
+    }
+    else if (quality == NVSDK_NGX_PerfQuality_Value_DLAA)
+    {
+        entry.renderWidth = width;
+        entry.renderHeight = height;
+        entry.scale = 1.0f;
+    }
+    else
+    {
+        auto index = (size_t) quality < ModeCount ? (size_t) quality : (size_t) NVSDK_NGX_PerfQuality_Value_Balanced;
+
+        entry.renderWidth = (unsigned int) ((float) width / DefaultRatios[index]);
+        entry.renderHeight = (unsigned int) ((float) height / DefaultRatios[index]);
+        entry.scale = DefaultScales[index];
+    }
+
+    if (config.roundTo.has_value())
+    {
+        entry.renderHeight -= entry.renderHeight % config.roundTo.value();
+        entry.renderWidth -= entry.renderWidth % config.roundTo.value();
+
+        // DLSSD keeps the unrounded scale
+        if (feature == OptimalSettingsFeature::DLSS)
+            entry.scale = (float) entry.renderWidth / (float) width;
+    }
+
+    // Render size above display only with extended limits, DLSSD doesn't allow it
+    bool aboveDisplay =
+        feature == OptimalSettingsFeature::DLSS && config.extendedLimits && entry.renderWidth > width;
+
+    // DRS minimum resolution
+    if (config.drsMinOverride || aboveDisplay ||
+        (feature == OptimalSettingsFeature::DLSS && quality == NVSDK_NGX_PerfQuality_Value_DLAA))
+    {
+        entry.minWidth = entry.renderWidth;
+        entry.minHeight = entry.renderHeight;
+    }
+    else if (quality == NVSDK_NGX_PerfQuality_Value_DLAA)
+    {
+        entry.minWidth = width;
+        entry.minHeight = height;
+    }
+    else
+    {
+        // DLSS normally only supports DRS in range of 0.5 and 1.0
+        entry.minWidth = (unsigned int) ((float) width * 0.5f);
+        entry.minHeight = (unsigned int) ((float) height * 0.5f);
+
+        if (entry.renderWidth < entry.minWidth || entry.renderHeight < entry.minHeight)
+        {
+            entry.minWidth = entry.renderWidth;
+            entry.minHeight = entry.renderHeight;
+        }
+    }
+
+    // DRS maximum resolution
+    if (config.drsMaxOverride || aboveDisplay)
+    {
+        entry.maxWidth = entry.renderWidth;
+        entry.maxHeight = entry.renderHeight;
+    }
+    else
+    {
+        entry.maxWidth = width;
+        entry.maxHeight = height;
+    }
+
+    return entry;
+}
+
+OptimalSettingsTable OptimalSettings::Build(const OptimalSettingsConfig& config, OptimalSettingsFeature feature,
+                                            unsigned int width, unsigned int height)
+{
+    OptimalSettingsTable table;
+
+    for (size_t i = 0; i < ModeCount; i++)
+        table[i] = Compute(config, feature, (NVSDK_NGX_PerfQuality_Value) i, width, height);
+
+    return table;
+}
+
+const OptimalSettingsCachedTable& OptimalSettings::Lookup(OptimalSettingsFeature feature, unsigned int width,
+                                                         unsigned int height)
+{
+    // Caller holds _mutex
+    auto generation = _generation.load(std::memory_order_acquire);
+
+    for (const auto& cached : _cache)
+    {
+        if (cached.valid && cached.generation == generation && cached.feature == feature &&
+            cached.width == width && cached.height == height)
+        {
+            return cached;
+        }
+    }
+
+    auto& slot = _cache[_next];
+    _next = (_next + 1) % CacheSize;
+
+    slot.valid = true;
+    slot.feature = feature;
+    slot.width = width;
+    slot.height = height;
+    slot.generation = generation;
+    slot.modes = Build(OptimalSettingsConfig::FromConfig(), feature, width, height);
+
+    LOG_DEBUG("Built optimal settings for {}x{}, feature: {}, generation: {}", width, height, (uint32_t) feature,
+              generation);
+
+    return slot;
+}
+
+OptimalSettingsEntry OptimalSettings::Get(OptimalSettingsFeature feature, NVSDK_NGX_PerfQuality_Value quality,
+                                          unsigned int width, unsigned int height)
+{
+    if ((size_t) quality >= ModeCount)
+    {
+        LOG_WARN("Unknown quality: {0}", (int) quality);
+        return Compute(OptimalSettingsConfig::FromConfig(), feature, quality, width, height);
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    return Lookup(feature, width, height).modes[quality];
+}
+
+OptimalSettingsTable OptimalSettings::Modes(OptimalSettingsFeature feature, unsigned int width, unsigned int height)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return Lookup(feature, width, height).modes;
+}
+
+void OptimalSettings::ConfigChanged() { _generation.fetch_add(1, std::memory_order_acq_rel); }
+
+uint32_t OptimalSettings::Generation() { return _generation.load(std::memory_order_acquire); }
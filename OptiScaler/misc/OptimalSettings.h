@@ -0,0 +1,100 @@
+#pragma once
+#include "SysUtils.h"
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <optional>
+
+// Precomputed NGX optimal settings
+//
+// Render sizes, scale and DRS bounds of every quality mode for an output size. Tables are built once per
+// (feature, output size, config generation) so optimal settings callbacks only do a lookup, menu uses the same
+// tables for its previews. Generation is bumped by ConfigChanged from ini reload and menu setters of the values
+// in OptimalSettingsConfig, lookups compare only the generation and output size.
+
+enum class OptimalSettingsFeature : uint32_t
+{
+    DLSS = 0,
+    DLSSD,
+};
+
+// Config values optimal settings depend on
+struct OptimalSettingsConfig
+{
+    bool extendedLimits = false;
+    bool upscaleRatioOverride = false;
+    float upscaleRatio = 1.3f;
+    bool qualityRatioOverride = false;
+    float qualityRatios[NVSDK_NGX_PerfQuality_Value_DLAA + 1] = {}; // Indexed by NVSDK_NGX_PerfQuality_Value
+    std::optional<int> roundTo;
+    bool drsMinOverride = false;
+    bool drsMaxOverride = false;
+
+    bool operator==(const OptimalSettingsConfig&) const = default;
+
+    static OptimalSettingsConfig FromConfig();
+};
+
+struct OptimalSettingsEntry
+{
+    unsigned int renderWidth = 0;
+    unsigned int renderHeight = 0;
+    float scale = 0.0f;
+    unsigned int minWidth = 0; // DRS bounds
+    unsigned int minHeight = 0;
+    unsigned int maxWidth = 0;
+    unsigned int maxHeight = 0;
+
+    bool operator==(const OptimalSettingsEntry&) const = default;
+};
+
+// Every quality mode of an output size, indexed by NVSDK_NGX_PerfQuality_Value
+using OptimalSettingsTable = std::array<OptimalSettingsEntry, NVSDK_NGX_PerfQuality_Value_DLAA + 1>;
+
+struct OptimalSettingsCachedTable
+{
+    bool valid = false;
+    OptimalSettingsFeature feature = OptimalSettingsFeature::DLSS;
+    unsigned int width = 0;
+    unsigned int height = 0;
+    uint32_t generation = 0;
+    OptimalSettingsTable modes {};
+};
+
+class OptimalSettings
+{
+  public:
+    static constexpr size_t ModeCount = std::tuple_size_v<OptimalSettingsTable>;
+    static constexpr size_t CacheSize = 4; // Callbacks and menu may ask for different output sizes
+
+  private:
+    inline static std::mutex _mutex;
+    inline static std::atomic<uint32_t> _generation { 0 };
+    inline static std::array<OptimalSettingsCachedTable, CacheSize> _cache {};
+    inline static size_t _next = 0;
+
+    static const OptimalSettingsCachedTable& Lookup(OptimalSettingsFeature feature, unsigned int width,
+                                                    unsigned int height);
+
+  public:
+    // Ratio (display / render) forced by config for the quality mode
+    static std::optional<float> OverrideRatio(const OptimalSettingsConfig& config,
+                                              NVSDK_NGX_PerfQuality_Value quality);
+
+    // Uncached calculation, unknown quality values get Balanced defaults
+    static OptimalSettingsEntry Compute(const OptimalSettingsConfig& config, OptimalSettingsFeature feature,
+                                        NVSDK_NGX_PerfQuality_Value quality, unsigned int width, unsigned int height);
+
+    static OptimalSettingsTable Build(const OptimalSettingsConfig& config, OptimalSettingsFeature feature,
+                                      unsigned int width, unsigned int height);
+
+    // Cached lookups against current config
+    static OptimalSettingsEntry Get(OptimalSettingsFeature feature, NVSDK_NGX_PerfQuality_Value quality,
+                                    unsigned int width, unsigned int height);
+    static OptimalSettingsTable Modes(OptimalSettingsFeature feature, unsigned int width, unsigned int height);
+
+    // Must be called after any value read by OptimalSettingsConfig::FromConfig changes
+    static void ConfigChanged();
+    static uint32_t Generation();
+};
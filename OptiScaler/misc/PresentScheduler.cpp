@@ -0,0 +1,360 @@
+#include "pch.h"
+#include "PresentScheduler.h"
+
+#include <Config.h>
+
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+
+static std::thread _workerThread;
+static std::mutex _wakeMutex;
+static std::condition_variable _wakeCv;
+static std::mutex _startMutex;
+
+// Critical section nesting of the current thread
+static thread_local uint32_t _presentDepth = 0;
+static thread_local uint64_t _presentStart = 0;
+
+// Worker flushes log file at least this often when it took over flushing
+static constexpr auto LogFlushInterval = std::chrono::milliseconds(100);
+
+std::array<PresentScheduler::QueueSlot, PresentScheduler::_queueSize> PresentScheduler::_queue {};
+std::array<PresentScheduler::StepStat, PRESENT_STEP_COUNT> PresentScheduler::_stats {};
+std::array<PresentScheduler::PublishedStat, PRESENT_STEP_COUNT> PresentScheduler::_published {};
+
+static bool IsDeferrable(PresentStep step)
+{
+    return step == PresentStep::LatencyReport || step == PresentStep::LogFlush || step == PresentStep::Benchmark ||
+           step == PresentStep::TraceWrite;
+}
+
+void PresentScheduler::StepStat::Add(uint64_t ns)
+{
+    count.fetch_add(1, std::memory_order_relaxed);
+    totalNs.fetch_add(ns, std::memory_order_relaxed);
+
+    auto currentMax = maxNs.load(std::memory_order_relaxed);
+    while (ns > currentMax && !maxNs.compare_exchange_weak(currentMax, ns, std::memory_order_relaxed))
+    {
+    }
+}
+
+void PresentScheduler::Record(PresentStep step, uint64_t ns)
+{
+    if (step >= PresentStep::Count)
+        return;
+
+    _stats[static_cast<size_t>(step)].Add(ns);
+}
+
+// Bounded multi producer queue with per slot sequence numbers, FG present and
+// wrapped swapchain present might push from different threads.
+// Sequences are stored relative to slot index so zero initialized slots are valid.
+bool PresentScheduler::TryEnqueue(PresentStep step, PFN_PresentJob job, uintptr_t arg)
+{
+    auto pos = _enqueuePos.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        auto index = pos & (_queueSize - 1);
+        auto& slot = _queue[index];
+        auto sequence = slot.sequence.load(std::memory_order_acquire) + index;
+        auto diff = static_cast<int32_t>(sequence - pos);
+
+        if (diff == 0)
+        {
+            if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                slot.step = step;
+                slot.job = job;
+                slot.arg = arg;
+                slot.sequence.store(pos + 1 - index, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (diff < 0)
+        {
+            // Full
+            return false;
+        }
+        else
+        {
+            pos = _enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+// Only called from worker
+bool PresentScheduler::TryDequeue(PresentStep& step, PFN_PresentJob& job, uintptr_t& arg)
+{
+    auto pos = _dequeuePos.load(std::memory_order_relaxed);
+    auto index = pos & (_queueSize - 1);
+    auto& slot = _queue[index];
+
+    if (static_cast<int32_t>(slot.sequence.load(std::memory_order_acquire) + index - (pos + 1)) < 0)
+        return false;
+
+    step = slot.step;
+    job = slot.job;
+    arg = slot.arg;
+
+    _dequeuePos.store(pos + 1, std::memory_order_relaxed);
+    slot.sequence.store(pos + _queueSize - index, std::memory_order_release);
+
+    return true;
+}
+
+void PresentScheduler::RunJob(PresentStep step, PFN_PresentJob job, uintptr_t arg)
+{
+    auto start = NowNs();
+    job(arg);
+    Record(step, NowNs() - start);
+}
+
+void PresentScheduler::WorkerLoop()
+{
+    auto lastFlush = std::chrono::steady_clock::now();
+
+    while (!_stopRequested.load(std::memory_order_acquire))
+    {
+        auto wake = _wakeCounter.load(std::memory_order_acquire);
+
+        PresentStep step;
+        PFN_PresentJob job;
+        uintptr_t arg;
+
+        while (TryDequeue(step, job, arg))
+        {
+            if (_stopRequested.load(std::memory_order_acquire))
+                return;
+
+            RunJob(step, job, arg);
+
+            if (step == PresentStep::LogFlush)
+                lastFlush = std::chrono::steady_clock::now();
+        }
+
+        // Keep log file up to date when game stops presenting
+        if (std::chrono::steady_clock::now() - lastFlush > LogFlushInterval)
+        {
+            if (auto logger = spdlog::default_logger_raw(); logger != nullptr)
+                logger->flush();
+
+            lastFlush = std::chrono::steady_clock::now();
+        }
+
+        // Producers never take the mutex, a missed notify is caught by the timeout
+        std::unique_lock<std::mutex> lock(_wakeMutex);
+        _wakeCv.wait_for(lock, std::chrono::milliseconds(2),
+                         [wake]
+                         {
+                             return _stopRequested.load(std::memory_order_acquire) ||
+                                    _wakeCounter.load(std::memory_order_acquire) != wake;
+                         });
+    }
+}
+
+void PresentScheduler::StartWorker()
+{
+    std::lock_guard<std::mutex> lock(_startMutex);
+
+    if (_workerRunning.load(std::memory_order_acquire) || _stopRequested.load(std::memory_order_acquire))
+        return;
+
+    // Pinned so the module is only detached on process exit, when the worker is already terminated and
+    // Shutdown can join it under loader lock. Without the pin jobs keep running inline.
+    HMODULE module = nullptr;
+    if (!GetModuleHandleExW(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_PIN,
+                            (LPCWSTR) &PresentScheduler::WorkerLoop, &module))
+    {
+        LOG_WARN("Can't pin module, present bookkeeping stays on present thread");
+        _stopRequested.store(true, std::memory_order_release);
+        return;
+    }
+
+    _workerThread = std::thread(WorkerLoop);
+    _workerRunning.store(true, std::memory_order_release);
+
+    // Flushing every message on the present thread is the most expensive part of logging,
+    // worker flushes once per present instead. Async logger already flushes on its own thread.
+    if (auto logger = spdlog::default_logger_raw();
+        logger != nullptr && !Config::Instance()->LogAsync.value_or_default())
+    {
+        logger->flush_on(spdlog::level::warn);
+    }
+
+    LOG_INFO("Present bookkeeping worker started, queue size: {}", _queueSize);
+}
+
+bool PresentScheduler::IsDeferring()
+{
+    return Config::Instance()->PresentDeferBookkeeping.value_or_default() &&
+           !_stopRequested.load(std::memory_order_relaxed) && !State::Instance().isShuttingDown;
+}
+
+void PresentScheduler::Defer(PresentStep step, PFN_PresentJob job, uintptr_t arg)
+{
+    if (job == nullptr)
+        return;
+
+    if (!IsDeferring() || !IsDeferrable(step))
+    {
+        RunJob(step, job, arg);
+        return;
+    }
+
+    if (!_workerRunning.load(std::memory_order_acquire))
+        StartWorker();
+
+    if (!_workerRunning.load(std::memory_order_acquire) || !TryEnqueue(step, job, arg))
+    {
+        _inlineFallbacks.fetch_add(1, std::memory_order_relaxed);
+
+        // Next frame or worker's idle flush will write it
+        if (step != PresentStep::LogFlush)
+            RunJob(step, job, arg);
+
+        return;
+    }
+
+    _wakeCounter.fetch_add(1, std::memory_order_release);
+    _wakeCv.notify_one();
+}
+
+void PresentScheduler::BeginPresent()
+{
+    if (_presentDepth++ == 0)
+        _presentStart = NowNs();
+}
+
+void PresentScheduler::EndPresent()
+{
+    if (_presentDepth == 0 || --_presentDepth != 0)
+        return;
+
+    auto cost = NowNs() - _presentStart;
+    Record(PresentStep::Critical, cost);
+
+    auto budgetNs = static_cast<uint64_t>(Config::Instance()->PresentWorkBudget.value_or_default() * 1000000.0);
+
+    if (budgetNs > 0 && cost > budgetNs)
+        _overBudget.fetch_add(1, std::memory_order_relaxed);
+
+    // Log flush is queued once per frame, after all present path logs are written
+    if (_workerRunning.load(std::memory_order_relaxed) && IsDeferring())
+    {
+        Defer(PresentStep::LogFlush,
+              [](uintptr_t)
+              {
+                  if (auto logger = spdlog::default_logger_raw(); logger != nullptr)
+                      logger->flush();
+              });
+    }
+
+    if ((_presents.fetch_add(1, std::memory_order_relaxed) + 1) % _reportWindow == 0)
+        Publish();
+}
+
+void PresentScheduler::Publish()
+{
+    for (size_t i = 0; i < PRESENT_STEP_COUNT; i++)
+    {
+        auto count = _stats[i].count.exchange(0, std::memory_order_relaxed);
+        auto total = _stats[i].totalNs.exchange(0, std::memory_order_relaxed);
+        auto max = _stats[i].maxNs.exchange(0, std::memory_order_relaxed);
+
+        _published[i].count.store(count, std::memory_order_relaxed);
+        _published[i].avgNs.store(count > 0 ? total / count : 0, std::memory_order_relaxed);
+        _published[i].maxNs.store(max, std::memory_order_relaxed);
+    }
+
+    auto overBudget = _overBudget.exchange(0, std::memory_order_relaxed);
+    auto fallbacks = _inlineFallbacks.exchange(0, std::memory_order_relaxed);
+
+    _publishedPresents.store(_reportWindow, std::memory_order_relaxed);
+    _publishedOverBudget.store(overBudget, std::memory_order_relaxed);
+    _publishedFallbacks.store(fallbacks, std::memory_order_relaxed);
+
+    auto& critical = _published[static_cast<size_t>(PresentStep::Critical)];
+
+    if (overBudget > 0 || fallbacks > 0)
+    {
+        LOG_DEBUG("Present path over budget: {}/{}, critical avg: {}us, max: {}us, inline fallbacks: {}", overBudget,
+                  _reportWindow, critical.avgNs.load(std::memory_order_relaxed) / 1000,
+                  critical.maxNs.load(std::memory_order_relaxed) / 1000, fallbacks);
+    }
+    else
+    {
+        LOG_TRACE("Present path critical avg: {}us, max: {}us", critical.avgNs.load(std::memory_order_relaxed) / 1000,
+                  critical.maxNs.load(std::memory_order_relaxed) / 1000);
+    }
+}
+
+PresentCostReport PresentScheduler::Report()
+{
+    PresentCostReport report {};
+    auto deferring = IsDeferring() && _workerRunning.load(std::memory_order_relaxed);
+
+    for (size_t i = 0; i < PRESENT_STEP_COUNT; i++)
+    {
+        auto& step = report.steps[i];
+        step.name = StepName(static_cast<PresentStep>(i));
+        step.deferred = deferring && IsDeferrable(static_cast<PresentStep>(i));
+        step.count = _published[i].count.load(std::memory_order_relaxed);
+        step.avgUs = _published[i].avgNs.load(std::memory_order_relaxed) / 1000.0;
+        step.maxUs = _published[i].maxNs.load(std::memory_order_relaxed) / 1000.0;
+    }
+
+    report.presents = _publishedPresents.load(std::memory_order_relaxed);
+    report.overBudget = _publishedOverBudget.load(std::memory_order_relaxed);
+    report.inlineFallbacks = _publishedFallbacks.load(std::memory_order_relaxed);
+
+    return report;
+}
+
+const char* PresentScheduler::StepName(PresentStep step)
+{
+    switch (step)
+    {
+    case PresentStep::UpscalerTime:
+        return "Upscaler time";
+    case PresentStep::FrozenCheck:
+        return "Frozen check";
+    case PresentStep::Menu:
+        return "Menu";
+    case PresentStep::Reflex:
+        return "Reflex";
+    case PresentStep::LatencyReport:
+        return "Latency report";
+    case PresentStep::LogFlush:
+        return "Log flush";
+    case PresentStep::FrameLimit:
+        return "Frame limit";
+    case PresentStep::Benchmark:
+        return "Benchmark export";
+    case PresentStep::TraceWrite:
+        return "Trace write";
+    case PresentStep::Critical:
+        return "Critical section";
+    default:
+        return "Unknown";
+    }
+}
+
+void PresentScheduler::Shutdown()
+{
+    {
+        std::lock_guard<std::mutex> lock(_startMutex);
+        _stopRequested.store(true, std::memory_order_release);
+    }
+
+    _wakeCv.notify_all();
+
+    // Pending jobs are dropped, they touch graphics objects which might be already gone
+    if (_workerRunning.exchange(false, std::memory_order_acq_rel) && _workerThread.joinable())
+        _workerThread.join();
+
+    if (auto logger = spdlog::default_logger_raw(); logger != nullptr)
+        logger->flush_on(spdlog::level::trace);
+}
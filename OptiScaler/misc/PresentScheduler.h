@@ -0,0 +1,150 @@
+#pragma once
+#include "SysUtils.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+
+// Present path work budget and bookkeeping worker
+//
+// Steps done by present hooks before calling the real present are measured with ScopedPresentStep,
+// time between BeginPresent and EndPresent is the critical section and checked against PresentWorkBudget.
+// Bookkeeping which doesn't need to finish before present (latency report polling, log flushing,
+// capture file writes) is pushed to a bounded lock-free queue with Defer and run by a single
+// worker thread.
+// When deferring is disabled or queue is full jobs run inline and are measured the same way,
+// except log flush which is left to the next frame.
+// Worker pins the module, so Shutdown from DLL_PROCESS_DETACH only happens on process exit and can join it.
+//
+// Costs are accumulated for a window of presents and then published, Report returns the last window.
+// No graphics API calls are made here, it can be used without any device.
+
+enum class PresentStep : uint8_t
+{
+    UpscalerTime,
+    FrozenCheck,
+    Menu,
+    Reflex,
+    LatencyReport,
+    LogFlush,
+    FrameLimit,
+    Benchmark,
+    TraceWrite,
+
+    // BeginPresent -> EndPresent, frame limiter is called after present
+    Critical,
+
+    Count
+};
+
+inline constexpr size_t PRESENT_STEP_COUNT = static_cast<size_t>(PresentStep::Count);
+
+typedef void (*PFN_PresentJob)(uintptr_t arg);
+
+struct PresentStepCost
+{
+    const char* name = nullptr;
+    bool deferred = false;
+    uint64_t count = 0;
+    double avgUs = 0.0;
+    double maxUs = 0.0;
+};
+
+struct PresentCostReport
+{
+    std::array<PresentStepCost, PRESENT_STEP_COUNT> steps {};
+    uint64_t presents = 0;
+    uint64_t overBudget = 0;
+    uint64_t inlineFallbacks = 0;
+};
+
+class PresentScheduler
+{
+  private:
+    static constexpr uint32_t _queueSize = 256; // Must be power of two
+    static constexpr uint64_t _reportWindow = 240;
+
+    struct alignas(64) QueueSlot
+    {
+        std::atomic<uint32_t> sequence { 0 };
+        PresentStep step = PresentStep::Count;
+        PFN_PresentJob job = nullptr;
+        uintptr_t arg = 0;
+    };
+
+    struct StepStat
+    {
+        std::atomic<uint64_t> count { 0 };
+        std::atomic<uint64_t> totalNs { 0 };
+        std::atomic<uint64_t> maxNs { 0 };
+
+        void Add(uint64_t ns);
+    };
+
+    struct PublishedStat
+    {
+        std::atomic<uint64_t> count { 0 };
+        std::atomic<uint64_t> avgNs { 0 };
+        std::atomic<uint64_t> maxNs { 0 };
+    };
+
+    static std::array<QueueSlot, _queueSize> _queue;
+    alignas(64) inline static std::atomic<uint32_t> _enqueuePos { 0 };
+    alignas(64) inline static std::atomic<uint32_t> _dequeuePos { 0 };
+
+    static std::array<StepStat, PRESENT_STEP_COUNT> _stats;
+    static std::array<PublishedStat, PRESENT_STEP_COUNT> _published;
+
+    inline static std::atomic<uint64_t> _presents { 0 };
+    inline static std::atomic<uint64_t> _overBudget { 0 };
+    inline static std::atomic<uint64_t> _inlineFallbacks { 0 };
+    inline static std::atomic<uint64_t> _publishedPresents { 0 };
+    inline static std::atomic<uint64_t> _publishedOverBudget { 0 };
+    inline static std::atomic<uint64_t> _publishedFallbacks { 0 };
+
+    inline static std::atomic<bool> _workerRunning { false };
+    inline static std::atomic<bool> _stopRequested { false };
+    inline static std::atomic<uint32_t> _wakeCounter { 0 };
+
+    static bool TryEnqueue(PresentStep step, PFN_PresentJob job, uintptr_t arg);
+    static bool TryDequeue(PresentStep& step, PFN_PresentJob& job, uintptr_t& arg);
+    static void RunJob(PresentStep step, PFN_PresentJob job, uintptr_t arg);
+    static void StartWorker();
+    static void WorkerLoop();
+    static void Publish();
+
+  public:
+    static uint64_t NowNs()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    static void Record(PresentStep step, uint64_t ns);
+
+    // Nested calls from same thread (wrapped swapchain -> FG present) are counted once
+    static void BeginPresent();
+    static void EndPresent();
+
+    // Runs job on bookkeeping worker, or inline when deferring is disabled / queue is full
+    static void Defer(PresentStep step, PFN_PresentJob job, uintptr_t arg = 0);
+
+    static bool IsDeferring();
+    static PresentCostReport Report();
+    static const char* StepName(PresentStep step);
+
+    // Stops and joins the worker, pending jobs are dropped
+    static void Shutdown();
+};
+
+class ScopedPresentStep
+{
+  private:
+    PresentStep _step;
+    uint64_t _start;
+
+  public:
+    ScopedPresentStep(PresentStep step) : _step(step), _start(PresentScheduler::NowNs()) {}
+    ~ScopedPresentStep() { PresentScheduler::Record(_step, PresentScheduler::NowNs() - _start); }
+};
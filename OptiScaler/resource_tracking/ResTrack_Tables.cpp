@@ -0,0 +1,683 @@
+#include "pch.h"
+#include "ResTrack_Tables.h"
+
+static std::mutex _hudlessTrackMutex;
+static ankerl::unordered_dense::map<ID3D12GraphicsCommandList*,
+                                    ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo>>
+    fgPossibleHudless[BUFFER_COUNT];
+
+// heaps section
+
+// #define USE_SPINLOCK_MUTEX_FOR_HEAP_CREATION
+
+#ifdef USE_SPINLOCK_MUTEX_FOR_HEAP_CREATION
+static SpinLock _heapCreationMutex;
+#else
+static std::mutex _heapCreationMutex;
+#endif
+
+static std::vector<std::unique_ptr<HeapInfo>> fgHeaps;
+
+struct HeapCacheTLS
+{
+    unsigned genSeen = 0;
+    HeapInfo* heapPtr = nullptr;
+    uint64_t heapVersion = 0;
+};
+
+static thread_local HeapCacheTLS cache;
+static thread_local HeapCacheTLS cacheRTV;
+static thread_local HeapCacheTLS cacheCBV;
+static thread_local HeapCacheTLS cacheSRV;
+static thread_local HeapCacheTLS cacheUAV;
+static std::atomic<unsigned> gHeapGeneration { 1 };
+
+static thread_local HeapCacheTLS cacheGR;
+static thread_local HeapCacheTLS cacheCR;
+
+void ResTrack_Tables::Init(bool useShards)
+{
+    _useShards = useShards;
+
+    if (fgHeaps.capacity() < 65536)
+    {
+        _trackedResources.reserve(1024);
+        fgHeaps.reserve(65536);
+    }
+}
+
+bool ResTrack_Tables::MatchesSwapchain(const D3D12_RESOURCE_DESC& resDesc, UINT64 width, UINT height, bool relaxed)
+{
+    if (resDesc.Dimension != D3D12_RESOURCE_DIMENSION_TEXTURE2D)
+        return false;
+
+    if (resDesc.Height == height && resDesc.Width == width)
+        return true;
+
+    return relaxed && resDesc.Height >= height - 32 && resDesc.Height <= height + 32 && resDesc.Width >= width - 32 &&
+           resDesc.Width <= width + 32;
+}
+
+#pragma region Heap helpers
+
+HeapInfo* ResTrack_Tables::GetHeapByCpuHandleCBV(SIZE_T cpuHandle)
+{
+    unsigned currentGen = gHeapGeneration.load(std::memory_order_acquire);
+    if (cacheCBV.genSeen == currentGen && cacheCBV.heapPtr != nullptr &&
+        cacheCBV.heapPtr->version == cacheCBV.heapVersion && cacheCBV.heapPtr->active &&
+        cacheCBV.heapPtr->cpuStart <= cpuHandle && cpuHandle < cacheCBV.heapPtr->cpuEnd)
+    {
+        return cacheCBV.heapPtr;
+    }
+
+    size_t count = fgHeaps.size();
+    for (size_t i = 0; i < count; i++)
+    {
+        if (fgHeaps[i] != nullptr && fgHeaps[i]->active && fgHeaps[i]->cpuStart <= cpuHandle &&
+            cpuHandle < fgHeaps[i]->cpuEnd)
+        {
+            cacheCBV.genSeen = currentGen;
+            cacheCBV.heapPtr = fgHeaps[i].get();
+            cacheCBV.heapVersion = cacheCBV.heapPtr->version;
+            return cacheCBV.heapPtr;
+        }
+    }
+
+    cacheCBV.heapVersion = 0;
+    cacheCBV.heapPtr = nullptr;
+    return nullptr;
+}
+
+HeapInfo* ResTrack_Tables::GetHeapByCpuHandleRTV(SIZE_T cpuHandle)
+{
+    unsigned currentGen = gHeapGeneration.load(std::memory_order_acquire);
+    if (cacheRTV.genSeen == currentGen && cacheRTV.heapPtr != nullptr &&
+        cacheRTV.heapPtr->version == cacheRTV.heapVersion && cacheRTV.heapPtr->active &&
+        cacheRTV.heapPtr->cpuStart <= cpuHandle && cpuHandle < cacheRTV.heapPtr->cpuEnd)
+    {
+        return cacheRTV.heapPtr;
+    }
+
+    size_t count = fgHeaps.size();
+    for (size_t i = 0; i < count; i++)
+    {
+        if (fgHeaps[i] != nullptr && fgHeaps[i]->active && fgHeaps[i]->cpuStart <= cpuHandle &&
+            cpuHandle < fgHeaps[i]->cpuEnd)
+        {
+            cacheRTV.genSeen = currentGen;
+            cacheRTV.heapPtr = fgHeaps[i].get();
+            cacheRTV.heapVersion = cacheRTV.heapPtr->version;
+            return cacheRTV.heapPtr;
+        }
+    }
+
+    cacheRTV.heapVersion = 0;
+    cacheRTV.heapPtr = nullptr;
+    return nullptr;
+}
+
+HeapInfo* ResTrack_Tables::GetHeapByCpuHandleSRV(SIZE_T cpuHandle)
+{
+    unsigned currentGen = gHeapGeneration.load(std::memory_order_acquire);
+    if (cacheSRV.genSeen == currentGen && cacheSRV.heapPtr != nullptr &&
+        cacheSRV.heapPtr->version == cacheSRV.heapVersion && cacheSRV.heapPtr->active &&
+        cacheSRV.heapPtr->cpuStart <= cpuHandle && cpuHandle < cacheSRV.heapPtr->cpuEnd)
+    {
+        return cacheSRV.heapPtr;
+    }
+
+    size_t count = fgHeaps.size();
+    for (size_t i = 0; i < count; i++)
+    {
+        if (fgHeaps[i] != nullptr && fgHeaps[i]->active && fgHeaps[i]->cpuStart <= cpuHandle &&
+            cpuHandle < fgHeaps[i]->cpuEnd)
+        {
+            cacheSRV.genSeen = currentGen;
+            cacheSRV.heapPtr = fgHeaps[i].get();
+            cacheSRV.heapVersion = cacheSRV.heapPtr->version;
+            return cacheSRV.heapPtr;
+        }
+    }
+
+    cacheSRV.heapVersion = 0;
+    cacheSRV.heapPtr = nullptr;
+    return nullptr;
+}
+
+HeapInfo* ResTrack_Tables::GetHeapByCpuHandleUAV(SIZE_T cpuHandle)
+{
+    unsigned currentGen = gHeapGeneration.load(std::memory_order_acquire);
+    if (cacheUAV.genSeen == currentGen && cacheUAV.heapPtr != nullptr &&
+        cacheUAV.heapPtr->version == cacheUAV.heapVersion && cacheUAV.heapPtr->active &&
+        cacheUAV.heapPtr->cpuStart <= cpuHandle && cpuHandle < cacheUAV.heapPtr->cpuEnd)
+    {
+        return cacheUAV.heapPtr;
+    }
+
+    size_t count = fgHeaps.size();
+    for (size_t i = 0; i < count; i++)
+    {
+        if (fgHeaps[i] != nullptr && fgHeaps[i]->active && fgHeaps[i]->cpuStart <= cpuHandle &&
+            cpuHandle < fgHeaps[i]->cpuEnd)
+        {
+            cacheUAV.genSeen = currentGen;
+            cacheUAV.heapPtr = fgHeaps[i].get();
+            cacheUAV.heapVersion = cacheUAV.heapPtr->version;
+            return cacheUAV.heapPtr;
+        }
+    }
+
+    cacheUAV.heapVersion = 0;
+    cacheUAV.heapPtr = nullptr;
+    return nullptr;
+}
+
+HeapInfo* ResTrack_Tables::GetHeapByCpuHandle(SIZE_T cpuHandle)
+{
+    unsigned currentGen = gHeapGeneration.load(std::memory_order_acquire);
+    if (cache.genSeen == currentGen && cache.heapPtr != nullptr && cache.heapPtr->version == cache.heapVersion &&
+        cache.heapPtr->active && cache.heapPtr->cpuStart <= cpuHandle && cpuHandle < cache.heapPtr->cpuEnd)
+    {
+        return cache.heapPtr;
+    }
+
+    size_t count = fgHeaps.size();
+    for (size_t i = 0; i < count; i++)
+    {
+        if (fgHeaps[i] != nullptr && fgHeaps[i]->active && fgHeaps[i]->cpuStart <= cpuHandle &&
+            cpuHandle < fgHeaps[i]->cpuEnd)
+        {
+            cache.genSeen = currentGen;
+            cache.heapPtr = fgHeaps[i].get();
+            cache.heapVersion = cache.heapPtr->version;
+            return cache.heapPtr;
+        }
+    }
+
+    cache.heapVersion = 0;
+    cache.heapPtr = nullptr;
+    return nullptr;
+}
+
+HeapInfo* ResTrack_Tables::GetHeapByGpuHandleGR(SIZE_T gpuHandle)
+{
+    if (gpuHandle == NULL)
+        return nullptr;
+
+    unsigned currentGen = gHeapGeneration.load(std::memory_order_acquire);
+    if (cacheGR.genSeen == currentGen && cacheGR.heapPtr != nullptr &&
+        cacheGR.heapPtr->version == cacheGR.heapVersion && cacheGR.heapPtr->active &&
+        cacheGR.heapPtr->gpuStart <= gpuHandle && gpuHandle < cacheGR.heapPtr->gpuEnd)
+    {
+        return cacheGR.heapPtr;
+    }
+
+    size_t count = fgHeaps.size();
+    for (size_t i = 0; i < count; i++)
+    {
+        if (fgHeaps[i] != nullptr && fgHeaps[i]->active && fgHeaps[i]->gpuStart <= gpuHandle &&
+            gpuHandle < fgHeaps[i]->gpuEnd)
+        {
+            cacheGR.genSeen = currentGen;
+            cacheGR.heapPtr = fgHeaps[i].get();
+            cacheGR.heapVersion = cacheGR.heapPtr->version;
+            return cacheGR.heapPtr;
+        }
+    }
+
+    cacheGR.heapVersion = 0;
+    cacheGR.heapPtr = nullptr;
+    return nullptr;
+}
+
+HeapInfo* ResTrack_Tables::GetHeapByGpuHandleCR(SIZE_T gpuHandle)
+{
+    if (gpuHandle == NULL)
+        return nullptr;
+
+    unsigned currentGen = gHeapGeneration.load(std::memory_order_acquire);
+    if (cacheCR.genSeen == currentGen && cacheCR.heapPtr != nullptr &&
+        cacheCR.heapPtr->version == cacheCR.heapVersion && cacheCR.heapPtr->active &&
+        cacheCR.heapPtr->gpuStart <= gpuHandle && gpuHandle < cacheCR.heapPtr->gpuEnd)
+    {
+        return cacheCR.heapPtr;
+    }
+
+    size_t count = fgHeaps.size();
+    for (size_t i = 0; i < count; i++)
+    {
+        if (fgHeaps[i] != nullptr && fgHeaps[i]->active && fgHeaps[i]->gpuStart <= gpuHandle &&
+            gpuHandle < fgHeaps[i]->gpuEnd)
+        {
+            cacheCR.genSeen = currentGen;
+            cacheCR.heapPtr = fgHeaps[i].get();
+            cacheCR.heapVersion = cacheCR.heapPtr->version;
+            return cacheCR.heapPtr;
+        }
+    }
+
+    cacheCR.heapVersion = 0;
+    cacheCR.heapPtr = nullptr;
+    return nullptr;
+}
+
+#pragma endregion
+
+#pragma region Heap tables
+
+void ResTrack_Tables::RegisterHeap(ID3D12DescriptorHeap* heap, SIZE_T cpuStart, SIZE_T cpuEnd, SIZE_T gpuStart,
+                                   SIZE_T gpuEnd, UINT numDescriptors, UINT increment, UINT type)
+{
+#ifdef USE_SPINLOCK_MUTEX_FOR_HEAP_CREATION
+    std::lock_guard<SpinLock> lock(_heapCreationMutex);
+#else
+    std::lock_guard<std::mutex> lock(_heapCreationMutex);
+#endif
+    size_t count = fgHeaps.size();
+    for (size_t i = 0; i < count; i++)
+    {
+        if (fgHeaps[i] != nullptr && !fgHeaps[i]->active)
+        {
+            fgHeaps[i].reset();
+            fgHeaps[i] = std::make_unique<HeapInfo>(heap, cpuStart, cpuEnd, gpuStart, gpuEnd, numDescriptors,
+                                                    increment, type);
+
+            gHeapGeneration.fetch_add(1, std::memory_order_release);
+            LOG_DEBUG("Reusing empty heap slot: {}", i);
+            return;
+        }
+    }
+
+    // Reallocate vector if needed
+    if (fgHeaps.capacity() == fgHeaps.size())
+        fgHeaps.reserve(fgHeaps.size() + 65536);
+
+    fgHeaps.push_back(
+        std::make_unique<HeapInfo>(heap, cpuStart, cpuEnd, gpuStart, gpuEnd, numDescriptors, increment, type));
+
+    gHeapGeneration.fetch_add(1, std::memory_order_release);
+    LOG_DEBUG("Adding new heap slot: {}", fgHeaps.size() - 1);
+}
+
+void ResTrack_Tables::UnregisterHeap(HeapInfo* heapInfo)
+{
+#ifdef USE_SPINLOCK_MUTEX_FOR_HEAP_CREATION
+    std::lock_guard<SpinLock> lock(_heapCreationMutex);
+#else
+    std::lock_guard<std::mutex> lock(_heapCreationMutex);
+#endif
+
+    heapInfo->active = false;
+
+    LOG_INFO("Heap released: {:X}", (size_t) heapInfo->heap);
+
+    // detach all slots from _trackedResources
+    {
+        std::scoped_lock lk(_trackedResourcesMutex);
+
+        for (UINT j = 0; j < heapInfo->numDescriptors; ++j)
+        {
+            auto& slot = heapInfo->info[j];
+
+            if (slot.buffer == nullptr)
+                continue;
+
+            if (auto it = _trackedResources.find(slot.buffer); it != _trackedResources.end())
+            {
+                auto& vec = it->second;
+                vec.erase(std::remove(vec.begin(), vec.end(), &slot), vec.end());
+                if (vec.empty())
+                    _trackedResources.erase(it);
+            }
+
+            slot.buffer = nullptr;
+            slot.lastUsedFrame = 0;
+        }
+    }
+
+    gHeapGeneration.fetch_add(1, std::memory_order_release); // invalidate caches
+}
+
+void ResTrack_Tables::UnregisterAllHeaps()
+{
+    for (auto& up : fgHeaps)
+    {
+        if (up != nullptr && up->active)
+            UnregisterHeap(up.get());
+    }
+}
+
+HeapInfo* ResTrack_Tables::FindHeap(ID3D12DescriptorHeap* heap)
+{
+    size_t count = fgHeaps.size();
+    for (size_t i = 0; i < count; i++)
+    {
+        auto& up = fgHeaps[i];
+
+        if (up != nullptr && up->heap == heap && up->active)
+            return up.get();
+    }
+
+    return nullptr;
+}
+
+void ResTrack_Tables::ReleaseResource(ID3D12Resource* resource)
+{
+    std::vector<ResourceInfo*> toClean;
+
+    {
+        std::lock_guard lock(_trackedResourcesMutex);
+
+        if (auto it = _trackedResources.find(resource); it != _trackedResources.end())
+        {
+            toClean = std::move(it->second);
+            _trackedResources.erase(it);
+        }
+    }
+
+    // Clean up outside lock
+    for (auto* info : toClean)
+    {
+        if (info->buffer == resource)
+        {
+            info->buffer = nullptr;
+            info->lastUsedFrame = 0;
+        }
+    }
+}
+
+void ResTrack_Tables::TrackCopyDescriptors(UINT inc, UINT NumDestDescriptorRanges,
+                                           const D3D12_CPU_DESCRIPTOR_HANDLE* pDestDescriptorRangeStarts,
+                                           const UINT* pDestDescriptorRangeSizes, UINT NumSrcDescriptorRanges,
+                                           const D3D12_CPU_DESCRIPTOR_HANDLE* pSrcDescriptorRangeStarts,
+                                           const UINT* pSrcDescriptorRangeSizes)
+{
+    // Validate that we have source descriptors to copy
+    bool haveSources = (NumSrcDescriptorRanges > 0 && pSrcDescriptorRangeStarts != nullptr);
+
+    // Track positions in both source and destination ranges
+    UINT srcRangeIndex = 0;
+    UINT srcOffsetInRange = 0;
+    UINT destRangeIndex = 0;
+    UINT destOffsetInRange = 0;
+
+    // Cache for heap lookups to avoid repeated lookups within the same range
+    HeapInfo* cachedDestHeap = nullptr;
+    SIZE_T cachedDestRangeStart = 0;
+    UINT cachedDestRangeSize = 0;
+    HeapInfo* cachedSrcHeap = nullptr;
+    SIZE_T cachedSrcRangeStart = 0;
+    UINT cachedSrcRangeSize = 0;
+
+    // Process all destination descriptors
+    while (destRangeIndex < NumDestDescriptorRanges)
+    {
+        // Update destination heap cache if we've moved to a new range
+        if (destOffsetInRange == 0)
+        {
+            cachedDestRangeStart = pDestDescriptorRangeStarts[destRangeIndex].ptr;
+            cachedDestRangeSize =
+                (pDestDescriptorRangeSizes == nullptr) ? 1 : pDestDescriptorRangeSizes[destRangeIndex];
+            cachedDestHeap = GetHeapByCpuHandle(cachedDestRangeStart);
+        }
+
+        // Calculate current destination handle
+        const SIZE_T destHandle = cachedDestRangeStart + (static_cast<SIZE_T>(destOffsetInRange) * inc);
+
+        // Get or update source information
+        ResourceInfo* srcInfo = nullptr;
+        if (haveSources && srcRangeIndex < NumSrcDescriptorRanges)
+        {
+            // Update source heap cache if we've moved to a new range
+            if (srcOffsetInRange == 0)
+            {
+                cachedSrcRangeStart = pSrcDescriptorRangeStarts[srcRangeIndex].ptr;
+                cachedSrcRangeSize =
+                    (pSrcDescriptorRangeSizes == nullptr) ? 1 : pSrcDescriptorRangeSizes[srcRangeIndex];
+                cachedSrcHeap = GetHeapByCpuHandle(cachedSrcRangeStart);
+            }
+
+            // Calculate current source handle
+            const SIZE_T srcHandle = cachedSrcRangeStart + (static_cast<SIZE_T>(srcOffsetInRange) * inc);
+
+            // Get source resource info with proper synchronization
+            if (cachedSrcHeap != nullptr)
+            {
+                // Access to heap info is synchronized through HeapInfo's const methods
+                // which use _trackedResourcesMutex internally
+                srcInfo = cachedSrcHeap->GetByCpuHandle(srcHandle);
+            }
+
+            // Advance source position
+            srcOffsetInRange++;
+            if (srcOffsetInRange >= cachedSrcRangeSize)
+            {
+                srcOffsetInRange = 0;
+                srcRangeIndex++;
+            }
+        }
+
+        // Update destination heap tracking with proper synchronization
+        if (cachedDestHeap != nullptr)
+        {
+            // HeapInfo's Set/Clear methods use _trackedResourcesMutex internally
+            if (srcInfo != nullptr && srcInfo->buffer != nullptr)
+                cachedDestHeap->SetByCpuHandle(destHandle, *srcInfo);
+            else
+                cachedDestHeap->ClearByCpuHandle(destHandle);
+        }
+
+        // Advance destination position
+        destOffsetInRange++;
+        if (destOffsetInRange >= cachedDestRangeSize)
+        {
+            destOffsetInRange = 0;
+            destRangeIndex++;
+        }
+    }
+}
+
+void ResTrack_Tables::TrackCopyDescriptorsSimple(UINT inc, UINT NumDescriptors, SIZE_T destStart, SIZE_T srcStart)
+{
+    for (size_t i = 0; i < NumDescriptors; i++)
+    {
+        HeapInfo* srcHeap = nullptr;
+        SIZE_T srcHandle = 0;
+
+        // source
+        if (srcStart != 0)
+        {
+            srcHandle = srcStart + i * inc;
+            srcHeap = GetHeapByCpuHandle(srcHandle);
+        }
+
+        auto destHandle = destStart + i * inc;
+        auto dstHeap = GetHeapByCpuHandle(destHandle);
+
+        // destination
+        if (dstHeap == nullptr)
+            continue;
+
+        if (srcHeap == nullptr)
+        {
+            dstHeap->ClearByCpuHandle(destHandle);
+            continue;
+        }
+
+        auto buffer = srcHeap->GetByCpuHandle(srcHandle);
+
+        if (buffer == nullptr)
+        {
+            dstHeap->ClearByCpuHandle(destHandle);
+            continue;
+        }
+
+        dstHeap->SetByCpuHandle(destHandle, *buffer);
+    }
+}
+
+#pragma endregion
+
+#pragma region Hudless tables
+
+void ResTrack_Tables::FillResourceInfo(ID3D12Resource* resource, const D3D12_RESOURCE_DESC& desc, ResourceInfo* info)
+{
+    info->buffer = resource;
+    info->width = desc.Width;
+    info->height = desc.Height;
+    info->format = desc.Format;
+    info->flags = desc.Flags;
+}
+
+void ResTrack_Tables::TrackView(HeapInfo* heap, SIZE_T cpuHandle, ID3D12Resource* resource,
+                                const D3D12_RESOURCE_DESC* resDesc, ResourceType type, CaptureInfo captureInfo)
+{
+    // Not a hudless candidate, just clear the slot
+    if (resource == nullptr || resDesc == nullptr)
+    {
+        heap->ClearByCpuHandle(cpuHandle);
+        return;
+    }
+
+    ResourceInfo resInfo {};
+    FillResourceInfo(resource, *resDesc, &resInfo);
+    resInfo.type = type;
+    resInfo.captureInfo = captureInfo;
+    heap->SetByCpuHandle(cpuHandle, resInfo);
+}
+
+void ResTrack_Tables::TrackPossibleHudless(size_t fIndex, ID3D12GraphicsCommandList* cmdList, ResourceInfo* resource)
+{
+    if (!_useShards)
+    {
+        std::lock_guard<std::mutex> lock(_hudlessTrackMutex);
+
+        if (!fgPossibleHudless[fIndex].contains(cmdList))
+        {
+            ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo> newMap;
+            newMap.reserve(32);
+            fgPossibleHudless[fIndex].insert_or_assign(cmdList, std::move(newMap));
+        }
+
+        LOG_TRACK("Tracking Resource: {:X}", (size_t) resource->buffer);
+        fgPossibleHudless[fIndex][cmdList].insert_or_assign(resource->buffer, *resource);
+    }
+    else
+    {
+        size_t shardIdx = GetShardIndex(cmdList);
+        auto& shard = _hudlessShards[fIndex][shardIdx];
+
+#ifdef USE_SPINLOCK_MUTEX
+        std::lock_guard<SpinLock> lock(shard.mutex);
+#else
+        std::lock_guard<std::mutex> lock(shard.mutex);
+#endif
+
+        if (!shard.map.contains(cmdList))
+        {
+            ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo> newMap;
+            newMap.reserve(32);
+            shard.map.insert_or_assign(cmdList, std::move(newMap));
+        }
+
+        LOG_TRACK("CmdList: {:X}, Tracking Resource: {:X}, Format: {}", (size_t) cmdList, (size_t) resource->buffer,
+                  (UINT) resource->format);
+
+        shard.map[cmdList].insert_or_assign(resource->buffer, *resource);
+    }
+}
+
+bool ResTrack_Tables::TakePossibleHudless(size_t fIndex, ID3D12GraphicsCommandList* cmdList,
+                                          ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo>& output)
+{
+    if (!_useShards)
+    {
+        if (fgPossibleHudless[fIndex].size() == 0)
+            return false;
+
+        std::lock_guard<std::mutex> lock(_hudlessTrackMutex);
+
+        auto it = fgPossibleHudless[fIndex].find(cmdList);
+        if (it == fgPossibleHudless[fIndex].end())
+            return false;
+
+        output = std::move(it->second);
+        fgPossibleHudless[fIndex].erase(it);
+    }
+    else
+    {
+        size_t shardIdx = GetShardIndex(cmdList);
+        auto& shard = _hudlessShards[fIndex][shardIdx];
+
+        // if can't find output skip
+        if (shard.map.size() == 0)
+        {
+            LOG_DEBUG_ONLY("Early exit");
+            return false;
+        }
+
+#ifdef USE_SPINLOCK_MUTEX
+        std::lock_guard<SpinLock> lock(shard.mutex);
+#else
+        std::lock_guard<std::mutex> lock(shard.mutex);
+#endif
+
+        auto it = shard.map.find(cmdList);
+        if (it == shard.map.end())
+            return false;
+
+        output = std::move(it->second);
+        shard.map.erase(it);
+    }
+
+    // if this command list does not have entries skip
+    return output.size() > 0;
+}
+
+void ResTrack_Tables::DropPossibleHudless(size_t fIndex, ID3D12GraphicsCommandList* cmdList)
+{
+    if (!_useShards)
+    {
+        std::lock_guard<std::mutex> lock(_hudlessTrackMutex);
+        fgPossibleHudless[fIndex].erase(cmdList);
+        return;
+    }
+
+    auto& shard = _hudlessShards[fIndex][GetShardIndex(cmdList)];
+
+    if (!shard.map.contains(cmdList))
+        return;
+
+#ifdef USE_SPINLOCK_MUTEX
+    std::lock_guard<SpinLock> lock(shard.mutex);
+#else
+    std::lock_guard<std::mutex> lock(shard.mutex);
+#endif
+
+    shard.map.erase(cmdList);
+}
+
+void ResTrack_Tables::ClearPossibleHudless(size_t fIndex)
+{
+    if (!_useShards)
+    {
+        std::lock_guard<std::mutex> lock(_hudlessTrackMutex);
+        fgPossibleHudless[fIndex].clear();
+        return;
+    }
+
+    for (size_t i = 0; i < SHARD_COUNT; i++)
+    {
+        auto& shard = _hudlessShards[fIndex][i];
+
+#ifdef USE_SPINLOCK_MUTEX
+        std::lock_guard<SpinLock> lock(shard.mutex);
+#else
+        std::lock_guard<std::mutex> lock(shard.mutex);
+#endif
+
+        shard.map.clear();
+    }
+}
+
+#pragma endregion
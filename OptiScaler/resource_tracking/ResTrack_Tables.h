@@ -0,0 +1,406 @@
+#pragma once
+
+#include "SysUtils.h"
+
+#include <hudfix/Hudfix_Types.h>
+
+#include <ankerl/unordered_dense.h>
+
+#include <new>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <algorithm>
+
+// Descriptor heap and hudless candidate tables of ResTrack_Dx12
+//
+// Only bookkeeping lives here, no hooks, config or graphics API calls. Heaps, resources and command lists are
+// used as opaque keys, so the trace replay tool drives the same code with recorded values.
+
+// #define DEBUG_TRACKING
+
+#ifdef DEBUG_TRACKING
+static void TestResource(ResourceInfo* info)
+{
+    if (info == nullptr || info->buffer == nullptr)
+        return;
+
+    auto desc = info->buffer->GetDesc();
+
+    if (desc.Width != info->width || desc.Height != info->height || desc.Format != info->format)
+    {
+        LOG_TRACK("Resource mismatch: {:X}, info: {:X}", (size_t) info->buffer, (size_t) info);
+
+        // LOG_WARN("Resource mismatch: {:X}, info: {:X}", (size_t) info->buffer, (size_t) info);
+        //__debugbreak();
+    }
+}
+#endif
+
+#define USE_SPINLOCK_MUTEX
+
+#ifdef USE_SPINLOCK_MUTEX
+
+// #define USE_PERF_SPINLOCK
+
+#ifdef __cpp_lib_hardware_interference_size
+constexpr size_t CACHE_LINE_SIZE = std::hardware_destructive_interference_size;
+#else
+constexpr size_t CACHE_LINE_SIZE = 64;
+#endif
+#else
+#ifdef __cpp_lib_hardware_interference_size
+constexpr size_t CACHE_LINE_SIZE = std::hardware_destructive_interference_size * 2;
+#else
+constexpr size_t CACHE_LINE_SIZE = 128;
+#endif
+#endif
+
+#ifdef USE_SPINLOCK_MUTEX
+#ifdef USE_PERF_SPINLOCK
+class SpinLock
+{
+    std::atomic<bool> _lock = { false };
+
+  public:
+    void lock()
+    {
+        int backoff = 1;
+
+        while (true)
+        {
+            // 1. Optimistic Read (TTAS)
+            // Using 'relaxed' because we don't need ordering until we actually acquire.
+            if (!_lock.load(std::memory_order_relaxed))
+            {
+
+                // 2. Attempt Acquire
+                // 'acquire' ensures no memory ops move before this lock
+                if (!_lock.exchange(true, std::memory_order_acquire))
+                {
+                    return; // Success
+                }
+            }
+
+            // 3. Pause instruction to help HT and branch prediction
+            _mm_pause();
+        }
+    }
+
+    void unlock()
+    {
+        // 'release' ensures all memory ops are finished before unlocking
+        _lock.store(false, std::memory_order_release);
+    }
+};
+#else
+struct SpinLock
+{
+    std::atomic<bool> _lock = { false };
+
+    __forceinline void lock()
+    {
+        // Fast path: try to grab immediately
+        if (!_lock.exchange(true, std::memory_order_acquire))
+            return;
+
+        int backoff = 1;
+        while (true)
+        {
+            while (_lock.load(std::memory_order_relaxed))
+            {
+                for (int i = 0; i < backoff; ++i)
+                    _mm_pause();
+
+                backoff = std::min(backoff * 2, 64);
+            }
+
+            if (!_lock.exchange(true, std::memory_order_acquire))
+                return;
+        }
+    }
+
+    __forceinline void unlock() { _lock.store(false, std::memory_order_release); }
+};
+#endif
+#endif
+
+// Heap slots pointing at each resource, used to clear slots when the resource is released
+inline ankerl::unordered_dense::map<ID3D12Resource*, std::vector<ResourceInfo*>> _trackedResources;
+#ifdef USE_SPINLOCK_MUTEX
+inline SpinLock _trackedResourcesMutex;
+#else
+inline std::mutex _trackedResourcesMutex;
+#endif
+
+struct HeapInfo
+{
+    // mutable std::shared_mutex mutex;
+
+    ID3D12DescriptorHeap* heap = nullptr;
+    SIZE_T cpuStart = NULL;
+    SIZE_T cpuEnd = NULL;
+    SIZE_T gpuStart = NULL;
+    SIZE_T gpuEnd = NULL;
+    UINT numDescriptors = 0;
+    UINT increment = 0;
+    UINT type = 0;
+    std::shared_ptr<ResourceInfo[]> info;
+    UINT lastOffset = 0;
+    bool active = true;
+    std::atomic<uint64_t> version { 0 };
+
+    HeapInfo(ID3D12DescriptorHeap* heap, SIZE_T cpuStart, SIZE_T cpuEnd, SIZE_T gpuStart, SIZE_T gpuEnd,
+             UINT numResources, UINT increment, UINT type)
+        : cpuStart(cpuStart), cpuEnd(cpuEnd), gpuStart(gpuStart), gpuEnd(gpuEnd), numDescriptors(numResources),
+          increment(increment), info(new ResourceInfo[numResources]), type(type), heap(heap)
+    {
+        static std::atomic<uint64_t> globalHeapVersion { 1 };
+        version.store(globalHeapVersion.fetch_add(1, std::memory_order_relaxed), std::memory_order_relaxed);
+
+        for (size_t i = 0; i < numDescriptors; i++)
+        {
+            info[i].buffer = nullptr;
+        }
+    }
+
+    void DetachFromOldResource(SIZE_T index) const
+    {
+        if (info[index].buffer == nullptr)
+            return;
+
+        std::scoped_lock lock(_trackedResourcesMutex);
+        LOG_TRACK("Heap: {:X}, Index: {}, Resource: {:X}, Res: {}x{}, Format: {}", (size_t) this, index,
+                  (size_t) info[index].buffer, info[index].width, info[index].height, (UINT) info[index].format);
+        auto it = _trackedResources.find(info[index].buffer);
+        if (it != _trackedResources.end())
+        {
+            auto& vec = it->second;
+            vec.erase(std::remove(vec.begin(), vec.end(), &info[index]), vec.end());
+            if (vec.empty())
+                _trackedResources.erase(it);
+        }
+    }
+
+    void AttachToNewResource(SIZE_T index) const
+    {
+        std::scoped_lock lock(_trackedResourcesMutex);
+        LOG_TRACK("Heap: {:X}, Index: {}, Resource: {:X}, Res: {}x{}, Format: {}", (size_t) this, index,
+                  (size_t) info[index].buffer, info[index].width, info[index].height, (UINT) info[index].format);
+        auto& vec = _trackedResources[info[index].buffer];
+        if (std::find(vec.begin(), vec.end(), &info[index]) == vec.end())
+            vec.push_back(&info[index]);
+    }
+
+    ResourceInfo* GetByCpuHandle(SIZE_T cpuHandle) const
+    {
+        auto index = (cpuHandle - cpuStart) / increment;
+
+        if (index >= numDescriptors)
+            return nullptr;
+
+        // std::shared_lock<std::shared_mutex> lock(mutex);
+
+        if (info[index].buffer == nullptr)
+            return nullptr;
+
+#ifdef DEBUG_TRACKING
+        TestResource(&info[index]);
+#endif
+
+        return &info[index];
+    }
+
+    ResourceInfo* GetByGpuHandle(SIZE_T gpuHandle) const
+    {
+        auto index = (gpuHandle - gpuStart) / increment;
+
+        if (index >= numDescriptors)
+            return nullptr;
+
+        // std::shared_lock<std::shared_mutex> lock(mutex);
+
+        if (info[index].buffer == nullptr)
+            return nullptr;
+
+#ifdef DEBUG_TRACKING
+        TestResource(&info[index]);
+#endif
+
+        return &info[index];
+    }
+
+    void SetByCpuHandle(SIZE_T cpuHandle, ResourceInfo setInfo) const
+    {
+        auto index = (cpuHandle - cpuStart) / increment;
+
+        if (index >= numDescriptors)
+            return;
+
+        // std::unique_lock<std::shared_mutex> lock(mutex);
+
+#ifdef DEBUG_TRACKING
+        TestResource(&setInfo);
+#endif
+        if (info[index].buffer != setInfo.buffer)
+        {
+            DetachFromOldResource(index);
+            info[index] = setInfo;
+            AttachToNewResource(index);
+        }
+    }
+
+    void SetByGpuHandle(SIZE_T gpuHandle, ResourceInfo setInfo) const
+    {
+        auto index = (gpuHandle - gpuStart) / increment;
+
+        if (index >= numDescriptors)
+            return;
+
+        // std::unique_lock<std::shared_mutex> lock(mutex);
+
+#ifdef DEBUG_TRACKING
+        TestResource(&setInfo);
+#endif
+
+        if (info[index].buffer != setInfo.buffer)
+        {
+            DetachFromOldResource(index);
+            info[index] = setInfo;
+            AttachToNewResource(index);
+        }
+    }
+
+    void ClearByCpuHandle(SIZE_T cpuHandle) const
+    {
+        auto index = (cpuHandle - cpuStart) / increment;
+
+        if (index >= numDescriptors)
+            return;
+
+        // std::unique_lock<std::shared_mutex> lock(mutex);
+
+        if (info[index].buffer != nullptr)
+        {
+            LOG_TRACK("Resource: {:X}, Res: {}x{}, Format: {}", (size_t) info[index].buffer, info[index].width,
+                      info[index].height, (UINT) info[index].format);
+
+            DetachFromOldResource(index);
+        }
+
+        info[index].buffer = nullptr;
+        info[index].lastUsedFrame = 0;
+    }
+
+    void ClearByGpuHandle(SIZE_T gpuHandle) const
+    {
+        auto index = (gpuHandle - gpuStart) / increment;
+
+        if (index >= numDescriptors)
+            return;
+
+        // std::unique_lock<std::shared_mutex> lock(mutex);
+
+        if (info[index].buffer != nullptr)
+        {
+            LOG_TRACK("Resource: {:X}, Res: {}x{}, Format: {}", (size_t) info[index].buffer, info[index].width,
+                      info[index].height, (UINT) info[index].format);
+
+            DetachFromOldResource(index);
+        }
+
+        info[index].buffer = nullptr;
+        info[index].lastUsedFrame = 0;
+    }
+};
+
+struct ResourceHeapInfo
+{
+    SIZE_T cpuStart = NULL;
+    SIZE_T gpuStart = NULL;
+};
+
+#ifdef USE_SPINLOCK_MUTEX
+// Force each struct to start on a new cache line
+struct alignas(CACHE_LINE_SIZE) CommandListShard
+{
+    SpinLock mutex;
+    ankerl::unordered_dense::map<ID3D12GraphicsCommandList*,
+                                 ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo>>
+        map;
+
+    char padding[CACHE_LINE_SIZE - (sizeof(SpinLock) + sizeof(void*) % CACHE_LINE_SIZE)] = {};
+};
+#else
+struct alignas(CACHE_LINE_SIZE) CommandListShard
+{
+    std::mutex mutex;
+    ankerl::unordered_dense::map<ID3D12GraphicsCommandList*,
+                                 ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo>>
+        map;
+
+    char padding[CACHE_LINE_SIZE - (sizeof(std::mutex) + sizeof(void*) % CACHE_LINE_SIZE)] = {};
+};
+#endif
+
+class ResTrack_Tables
+{
+  private:
+    inline static bool _useShards = false;
+
+    // Sharding
+    inline static constexpr size_t SHARD_COUNT = 16;
+    inline static CommandListShard _hudlessShards[BUFFER_COUNT][SHARD_COUNT];
+
+    inline static size_t GetShardIndex(ID3D12GraphicsCommandList* ptr)
+    {
+        auto addr = (UINT64) ptr;
+        return (addr >> 4) % SHARD_COUNT;
+    }
+
+  public:
+    // Reserves tables once, shards can be changed on every call
+    static void Init(bool useShards);
+
+    // Size check of hudless candidates, relaxed allows 32 pixels difference
+    static bool MatchesSwapchain(const D3D12_RESOURCE_DESC& resDesc, UINT64 width, UINT height, bool relaxed);
+
+    static HeapInfo* GetHeapByCpuHandleCBV(SIZE_T cpuHandle);
+    static HeapInfo* GetHeapByCpuHandleRTV(SIZE_T cpuHandle);
+    static HeapInfo* GetHeapByCpuHandleSRV(SIZE_T cpuHandle);
+    static HeapInfo* GetHeapByCpuHandleUAV(SIZE_T cpuHandle);
+    static HeapInfo* GetHeapByCpuHandle(SIZE_T cpuHandle);
+    static HeapInfo* GetHeapByGpuHandleGR(SIZE_T gpuHandle);
+    static HeapInfo* GetHeapByGpuHandleCR(SIZE_T gpuHandle);
+
+    static void FillResourceInfo(ID3D12Resource* resource, const D3D12_RESOURCE_DESC& desc, ResourceInfo* info);
+
+    static void RegisterHeap(ID3D12DescriptorHeap* heap, SIZE_T cpuStart, SIZE_T cpuEnd, SIZE_T gpuStart,
+                             SIZE_T gpuEnd, UINT numDescriptors, UINT increment, UINT type);
+    static void UnregisterHeap(HeapInfo* heapInfo);
+    static void UnregisterAllHeaps();
+
+    // Active heap info of the heap object
+    static HeapInfo* FindHeap(ID3D12DescriptorHeap* heap);
+
+    // Clears every heap slot pointing at the released resource
+    static void ReleaseResource(ID3D12Resource* resource);
+
+    // Null resDesc clears the slot, caller decides if the resource is a hudless candidate
+    static void TrackView(HeapInfo* heap, SIZE_T cpuHandle, ID3D12Resource* resource,
+                          const D3D12_RESOURCE_DESC* resDesc, ResourceType type, CaptureInfo captureInfo);
+    static void TrackCopyDescriptors(UINT inc, UINT NumDestDescriptorRanges,
+                                     const D3D12_CPU_DESCRIPTOR_HANDLE* pDestDescriptorRangeStarts,
+                                     const UINT* pDestDescriptorRangeSizes, UINT NumSrcDescriptorRanges,
+                                     const D3D12_CPU_DESCRIPTOR_HANDLE* pSrcDescriptorRangeStarts,
+                                     const UINT* pSrcDescriptorRangeSizes);
+    static void TrackCopyDescriptorsSimple(UINT inc, UINT NumDescriptors, SIZE_T destStart, SIZE_T srcStart);
+
+    // Hudless candidates bound on command lists, fIndex is the present frame index
+    static void TrackPossibleHudless(size_t fIndex, ID3D12GraphicsCommandList* cmdList, ResourceInfo* resource);
+    static bool TakePossibleHudless(size_t fIndex, ID3D12GraphicsCommandList* cmdList,
+                                    ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo>& output);
+    static void DropPossibleHudless(size_t fIndex, ID3D12GraphicsCommandList* cmdList);
+    static void ClearPossibleHudless(size_t fIndex);
+};
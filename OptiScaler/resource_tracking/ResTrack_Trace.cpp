@@ -0,0 +1,257 @@
+#include "pch.h"
+#include "ResTrack_Trace.h"
+
+#include <Util.h>
+#include <misc/PresentScheduler.h>
+
+// Hand buffer to the writer when it grows over this
+constexpr size_t TRACE_FLUSH_SIZE = 4 * 1024 * 1024;
+
+std::filesystem::path ResTrack_Trace::DefaultPath() { return Util::DllPath().parent_path() / L"OptiScaler.rttrace"; }
+
+uint8_t ResTrack_Trace::ThreadSlot()
+{
+    static thread_local uint8_t slot = _threadCounter.fetch_add(1, std::memory_order_relaxed);
+    return slot;
+}
+
+bool ResTrack_Trace::Start(const std::filesystem::path& path, uint32_t frames, uint32_t swapchainWidth,
+                           uint32_t swapchainHeight, uint32_t swapchainFormat)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (_recording.load(std::memory_order_relaxed) || frames == 0)
+        return false;
+
+    if (_file != nullptr)
+    {
+        LOG_WARN("Previous trace is still being written");
+        return false;
+    }
+
+    _file = _wfopen(path.c_str(), L"wb");
+
+    if (_file == nullptr)
+    {
+        LOG_ERROR("Can't open trace file: {}", wstring_to_string(path.wstring()));
+        return false;
+    }
+
+    _fileHeader = {};
+    _fileHeader.magic = TRACE_MAGIC;
+    _fileHeader.version = TRACE_VERSION;
+    _fileHeader.swapchainWidth = swapchainWidth;
+    _fileHeader.swapchainHeight = swapchainHeight;
+    _fileHeader.swapchainFormat = swapchainFormat;
+
+    // Will be rewritten with recorded frame count when capture is finalized
+    fwrite(&_fileHeader, sizeof(_fileHeader), 1, _file);
+
+    _buffer.clear();
+    _buffer.reserve(TRACE_FLUSH_SIZE + 4096);
+    _pending.clear();
+    _finalize = false;
+    _knownResources.clear();
+    _framesLeft = frames;
+    _startTime = Util::MillisecondsNow();
+
+    LOG_INFO("Recording {} frames to {}", frames, wstring_to_string(path.wstring()));
+
+    _recording.store(true, std::memory_order_release);
+    return true;
+}
+
+void ResTrack_Trace::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        if (!_recording.load(std::memory_order_relaxed))
+            return;
+
+        _recording.store(false, std::memory_order_release);
+
+        if (!_buffer.empty())
+            _pending.push_back(std::move(_buffer));
+
+        _buffer = {};
+        _finalize = true;
+        _knownResources.clear();
+    }
+
+    PresentScheduler::Defer(PresentStep::TraceWrite, WritePending);
+}
+
+void ResTrack_Trace::WritePending(uintptr_t)
+{
+    std::lock_guard<std::mutex> fileLock(_fileMutex);
+
+    std::vector<std::vector<uint8_t>> pending;
+    TraceFileHeader header {};
+    FILE* file = nullptr;
+    bool finalize = false;
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        pending.swap(_pending);
+        header = _fileHeader;
+        file = _file;
+        finalize = _finalize;
+        _finalize = false;
+    }
+
+    if (file == nullptr)
+        return;
+
+    for (auto& buffer : pending)
+    {
+        fwrite(buffer.data(), 1, buffer.size(), file);
+        buffer.clear();
+    }
+
+    if (finalize)
+    {
+        fseek(file, 0, SEEK_SET);
+        fwrite(&header, sizeof(header), 1, file);
+        fclose(file);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        if (finalize)
+        {
+            // Start fails until the file is closed
+            _file = nullptr;
+            _spare.clear();
+        }
+        else
+        {
+            // Written buffers are reused by Append
+            for (auto& buffer : pending)
+                _spare.push_back(std::move(buffer));
+        }
+    }
+
+    if (!finalize)
+        return;
+
+    LOG_INFO("Trace recording done, frames: {}", header.recordedFrames);
+}
+
+void ResTrack_Trace::Append(TraceOp op, const uint64_t* args, uint16_t argCount)
+{
+    TraceRecordHeader header {};
+    header.op = op;
+    header.thread = ThreadSlot();
+    header.argCount = argCount;
+    header.timeUs = (uint32_t) ((Util::MillisecondsNow() - _startTime) * 1000.0);
+
+    auto offset = _buffer.size();
+    auto argSize = sizeof(uint64_t) * argCount;
+    _buffer.resize(offset + sizeof(header) + argSize);
+
+    memcpy(_buffer.data() + offset, &header, sizeof(header));
+
+    if (argCount > 0)
+        memcpy(_buffer.data() + offset + sizeof(header), args, argSize);
+
+    // Written by worker after next present
+    if (_buffer.size() > TRACE_FLUSH_SIZE)
+    {
+        _pending.push_back(std::move(_buffer));
+        _buffer = {};
+
+        if (!_spare.empty())
+        {
+            _buffer = std::move(_spare.back());
+            _spare.pop_back();
+        }
+        else
+        {
+            _buffer.reserve(TRACE_FLUSH_SIZE + 4096);
+        }
+    }
+}
+
+void ResTrack_Trace::Record(TraceOp op, const uint64_t* args, uint16_t argCount)
+{
+    if (!IsRecording())
+        return;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (!_recording.load(std::memory_order_relaxed))
+        return;
+
+    Append(op, args, argCount);
+}
+
+void ResTrack_Trace::Record(TraceOp op, std::initializer_list<uint64_t> args)
+{
+    Record(op, args.begin(), (uint16_t) args.size());
+}
+
+void ResTrack_Trace::RecordResource(ID3D12Resource* resource, const D3D12_RESOURCE_DESC& desc)
+{
+    if (!IsRecording() || resource == nullptr)
+        return;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (!_recording.load(std::memory_order_relaxed) || _knownResources.contains(resource))
+        return;
+
+    _knownResources.insert(resource);
+
+    uint64_t args[] = { (uint64_t) resource, desc.Width, desc.Height,
+                        (uint64_t) desc.Format | ((uint64_t) desc.Dimension << 32), (uint64_t) desc.Flags };
+
+    Append(TraceOp::ResourceDesc, args, (uint16_t) std::size(args));
+}
+
+void ResTrack_Trace::RecordRelease(ID3D12Resource* resource)
+{
+    if (!IsRecording() || resource == nullptr)
+        return;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (!_recording.load(std::memory_order_relaxed))
+        return;
+
+    // Next resource at this address sends its own description
+    _knownResources.erase(resource);
+
+    uint64_t arg = (uint64_t) resource;
+    Append(TraceOp::ReleaseResource, &arg, 1);
+}
+
+void ResTrack_Trace::FrameDone(UINT64 frame)
+{
+    if (!IsRecording())
+        return;
+
+    bool stop = false;
+    bool write = false;
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        if (!_recording.load(std::memory_order_relaxed))
+            return;
+
+        uint64_t arg = frame;
+        Append(TraceOp::Present, &arg, 1);
+
+        _fileHeader.recordedFrames++;
+        stop = --_framesLeft == 0;
+        write = !_pending.empty();
+    }
+
+    if (stop)
+        Stop();
+    else if (write)
+        PresentScheduler::Defer(PresentStep::TraceWrite, WritePending);
+}
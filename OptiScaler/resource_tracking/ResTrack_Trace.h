@@ -0,0 +1,120 @@
+#pragma once
+
+#include "SysUtils.h"
+
+#include <ankerl/unordered_dense.h>
+
+#include <d3d12.h>
+
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <filesystem>
+
+// Compact binary trace of ResTrack_Dx12 hook traffic
+//
+// File layout:
+//   TraceFileHeader
+//   TraceRecordHeader + argCount * uint64_t
+//   TraceRecordHeader + argCount * uint64_t
+//   ...
+//
+// Pointers and handles are stored as raw values, replay uses them as opaque keys
+// Traces are replayed offline by restrack_replay of the tests project (tests/tools)
+
+enum class TraceOp : uint8_t
+{
+    ResourceDesc,          // resource, width, height, format | (dimension << 32), flags
+    CreateHeap,            // heap, cpuStart, gpuStart, numDescriptors | (type << 32), increment
+    ReleaseHeap,           // heap
+    CreateRTV,             // resource, cpuHandle, viewDimension (resource desc is sent before first use)
+    CreateSRV,             // resource, cpuHandle, viewDimension
+    CreateUAV,             // resource, cpuHandle, viewDimension
+    CopyDescriptors,       // type | (increment << 32), numDest, numSrc, [destStart, destSize] * numDest,
+                           // [srcStart, srcSize] * numSrc
+    CopyDescriptorsSimple, // type | (increment << 32), numDescriptors, destStart, srcStart
+    SetGraphicsRootTable,  // cmdList, rootParameterIndex, gpuHandle
+    SetComputeRootTable,   // cmdList, rootParameterIndex, gpuHandle
+    OMSetRenderTargets,    // cmdList, numRTVs, singleHandle, [cpuHandle] * (singleHandle ? 1 : numRTVs)
+    DrawInstanced,         // cmdList
+    DrawIndexedInstanced,  // cmdList
+    Dispatch,              // cmdList
+    ExecuteCommandLists,   // queue, numLists, [cmdList] * numLists
+    ReleaseResource,       // resource
+    Present,               // frame
+    COUNT
+};
+
+#pragma pack(push, 1)
+struct TraceFileHeader
+{
+    uint32_t magic = 0;   // TRACE_MAGIC
+    uint32_t version = 0; // TRACE_VERSION
+    uint32_t swapchainWidth = 0;
+    uint32_t swapchainHeight = 0;
+    uint32_t swapchainFormat = 0;
+    uint32_t recordedFrames = 0;
+};
+
+struct TraceRecordHeader
+{
+    TraceOp op;
+    uint8_t thread;    // Recording thread slot, wraps after 256 threads
+    uint16_t argCount; // Count of uint64_t arguments following the header
+    uint32_t timeUs;   // Microseconds since start of capture
+};
+#pragma pack(pop)
+
+inline constexpr uint32_t TRACE_MAGIC = 0x5454524F; // "ORTT"
+inline constexpr uint32_t TRACE_VERSION = 1;
+inline constexpr uint16_t TRACE_MAX_ARGS = 0xFFFF;
+
+// Records are appended to a memory buffer under _mutex, full buffers are handed to the present bookkeeping
+// worker at the next present and written there, hooks and present never touch the file.
+class ResTrack_Trace
+{
+  private:
+    inline static std::atomic<bool> _recording { false };
+    inline static std::mutex _mutex;     // Recording state, active buffer and pending list
+    inline static std::mutex _fileMutex; // File writes, taken before _mutex
+
+    inline static FILE* _file = nullptr; // Closed by writer job after Stop
+    inline static std::vector<uint8_t> _buffer;
+    inline static std::vector<std::vector<uint8_t>> _pending; // Full buffers waiting for the writer
+    inline static std::vector<std::vector<uint8_t>> _spare;   // Written buffers, reused by Append
+    inline static bool _finalize = false;
+    inline static ankerl::unordered_dense::set<ID3D12Resource*> _knownResources;
+
+    inline static TraceFileHeader _fileHeader {};
+    inline static uint32_t _framesLeft = 0;
+    inline static double _startTime = 0.0;
+
+    inline static std::atomic<uint8_t> _threadCounter { 0 };
+
+    static uint8_t ThreadSlot();
+    static void Append(TraceOp op, const uint64_t* args, uint16_t argCount);
+    static void WritePending(uintptr_t);
+
+  public:
+    // Starts a capture of given frame count, previous file will be overwritten
+    // Fails while previous capture is still being written
+    static bool Start(const std::filesystem::path& path, uint32_t frames, uint32_t swapchainWidth,
+                      uint32_t swapchainHeight, uint32_t swapchainFormat);
+    static void Stop();
+
+    static bool IsRecording() { return _recording.load(std::memory_order_relaxed); }
+
+    static void Record(TraceOp op, const uint64_t* args, uint16_t argCount);
+    static void Record(TraceOp op, std::initializer_list<uint64_t> args);
+
+    // Sends resource description once per resource so replay can fake GetDesc
+    static void RecordResource(ID3D12Resource* resource, const D3D12_RESOURCE_DESC& desc);
+
+    // Resource is destroyed, address might be reused by a new resource with a different description
+    static void RecordRelease(ID3D12Resource* resource);
+
+    // Called at present, queues buffered records and stops the capture when frame limit is reached
+    static void FrameDone(UINT64 frame);
+
+    static std::filesystem::path DefaultPath();
+};
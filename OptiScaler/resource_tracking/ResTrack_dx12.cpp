@@ -6,6 +6,7 @@
 #include <Util.h>
 
 #include <menu/menu_overlay_dx.h>
+#include <shaders/DescriptorRing_Dx12.h>
 
 #include <algorithm>
 #include <future>
@@ -78,6 +79,30 @@ typedef void(STDMETHODCALLTYPE* PFN_ExecuteBundle)(ID3D12GraphicsCommandList* Th
                                                    ID3D12GraphicsCommandList* pCommandList);
 typedef HRESULT(STDMETHODCALLTYPE* PFN_Close)(ID3D12GraphicsCommandList* This);
 
+// Command list write hooks for FG copy planner
+typedef void(STDMETHODCALLTYPE* PFN_ClearRenderTargetView)(ID3D12GraphicsCommandList* This,
+                                                           D3D12_CPU_DESCRIPTOR_HANDLE RenderTargetView,
+                                                           const FLOAT ColorRGBA[4], UINT NumRects,
+                                                           const D3D12_RECT* pRects);
+typedef void(STDMETHODCALLTYPE* PFN_ClearUnorderedAccessViewUint)(
+    ID3D12GraphicsCommandList* This, D3D12_GPU_DESCRIPTOR_HANDLE ViewGPUHandleInCurrentHeap,
+    D3D12_CPU_DESCRIPTOR_HANDLE ViewCPUHandle, ID3D12Resource* pResource, const UINT Values[4], UINT NumRects,
+    const D3D12_RECT* pRects);
+typedef void(STDMETHODCALLTYPE* PFN_ClearUnorderedAccessViewFloat)(
+    ID3D12GraphicsCommandList* This, D3D12_GPU_DESCRIPTOR_HANDLE ViewGPUHandleInCurrentHeap,
+    D3D12_CPU_DESCRIPTOR_HANDLE ViewCPUHandle, ID3D12Resource* pResource, const FLOAT Values[4], UINT NumRects,
+    const D3D12_RECT* pRects);
+typedef void(STDMETHODCALLTYPE* PFN_CopyResource)(ID3D12GraphicsCommandList* This, ID3D12Resource* pDstResource,
+                                                  ID3D12Resource* pSrcResource);
+typedef void(STDMETHODCALLTYPE* PFN_CopyTextureRegion)(ID3D12GraphicsCommandList* This,
+                                                       const D3D12_TEXTURE_COPY_LOCATION* pDst, UINT DstX, UINT DstY,
+                                                       UINT DstZ, const D3D12_TEXTURE_COPY_LOCATION* pSrc,
+                                                       const D3D12_BOX* pSrcBox);
+typedef void(STDMETHODCALLTYPE* PFN_ResolveSubresource)(ID3D12GraphicsCommandList* This,
+                                                        ID3D12Resource* pDstResource, UINT DstSubresource,
+                                                        ID3D12Resource* pSrcResource, UINT SrcSubresource,
+                                                        DXGI_FORMAT Format);
+
 typedef void(STDMETHODCALLTYPE* PFN_ExecuteCommandLists)(ID3D12CommandQueue* This, UINT NumCommandLists,
                                                          ID3D12CommandList* const* ppCommandLists);
 
@@ -110,72 +135,24 @@ static PFN_OMSetRenderTargets o_OMSetRenderTargets = nullptr;
 static PFN_SetGraphicsRootDescriptorTable o_SetGraphicsRootDescriptorTable = nullptr;
 static PFN_SetComputeRootDescriptorTable o_SetComputeRootDescriptorTable = nullptr;
 
-static std::mutex _hudlessTrackMutex;
-static ankerl::unordered_dense::map<ID3D12GraphicsCommandList*,
-                                    ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo>>
-    fgPossibleHudless[BUFFER_COUNT];
-
-// heaps section
-
-// #define USE_SPINLOCK_MUTEX_FOR_HEAP_CREATION
-
-#ifdef USE_SPINLOCK_MUTEX_FOR_HEAP_CREATION
-static SpinLock _heapCreationMutex;
-#else
-static std::mutex _heapCreationMutex;
-#endif
-
-static std::vector<std::unique_ptr<HeapInfo>> fgHeaps;
+static PFN_ClearRenderTargetView o_ClearRenderTargetView = nullptr;
+static PFN_ClearUnorderedAccessViewUint o_ClearUnorderedAccessViewUint = nullptr;
+static PFN_ClearUnorderedAccessViewFloat o_ClearUnorderedAccessViewFloat = nullptr;
+static PFN_CopyResource o_CopyResource = nullptr;
+static PFN_CopyTextureRegion o_CopyTextureRegion = nullptr;
+static PFN_ResolveSubresource o_ResolveSubresource = nullptr;
 
 static std::set<void*> _notFoundCmdLists;
 static std::unordered_map<FG_ResourceType, void*> _resCmdList[BUFFER_COUNT];
 
-struct HeapCacheTLS
-{
-    unsigned genSeen = 0;
-    HeapInfo* heapPtr = nullptr;
-    uint64_t heapVersion = 0;
-};
-
-static thread_local HeapCacheTLS cache;
-static thread_local HeapCacheTLS cacheRTV;
-static thread_local HeapCacheTLS cacheCBV;
-static thread_local HeapCacheTLS cacheSRV;
-static thread_local HeapCacheTLS cacheUAV;
-static std::atomic<unsigned> gHeapGeneration { 1 };
-
-static thread_local HeapCacheTLS cacheGR;
-static thread_local HeapCacheTLS cacheCR;
-
-bool ResTrack_Dx12::CheckResource(ID3D12Resource* resource)
+bool ResTrack_Dx12::CheckResource(const D3D12_RESOURCE_DESC& resDesc)
 {
     if (State::Instance().isShuttingDown)
         return false;
 
-    auto resDesc = resource->GetDesc();
-
-    if (resDesc.Dimension != D3D12_RESOURCE_DIMENSION_TEXTURE2D)
-        return false;
-
-    auto& s = State::Instance();
-
-    if (resDesc.Height != s.currentSwapchainDesc.BufferDesc.Height ||
-        resDesc.Width != s.currentSwapchainDesc.BufferDesc.Width)
-    {
-        auto result = Config::Instance()->FGRelaxedResolutionCheck.value_or_default() &&
-                      resDesc.Height >= s.currentSwapchainDesc.BufferDesc.Height - 32 &&
-                      resDesc.Height <= s.currentSwapchainDesc.BufferDesc.Height + 32 &&
-                      resDesc.Width >= s.currentSwapchainDesc.BufferDesc.Width - 32 &&
-                      resDesc.Width <= s.currentSwapchainDesc.BufferDesc.Width + 32;
-
-        // LOG_TRACK("Resource: {}x{} ({}), Swapchain: {}x{} ({}), Relaxed Result: {}", resDesc.Width, resDesc.Height,
-        //           (UINT) resDesc.Format, scDesc.BufferDesc.Width, scDesc.BufferDesc.Height,
-        //           (UINT) scDesc.BufferDesc.Format, result);
-
-        return result;
-    }
-
-    return true;
+    auto& scDesc = State::Instance().currentSwapchainDesc;
+    return ResTrack_Tables::MatchesSwapchain(resDesc, scDesc.BufferDesc.Width, scDesc.BufferDesc.Height,
+                                             Config::Instance()->FGRelaxedResolutionCheck.value_or_default());
 }
 
 inline static IID streamlineRiid {};
@@ -262,305 +239,131 @@ void ResTrack_Dx12::ResourceBarrier(ID3D12GraphicsCommandList* InCommandList, ID
 
 #pragma region Heap helpers
 
-SIZE_T ResTrack_Dx12::GetGPUHandle(ID3D12Device* This, SIZE_T cpuHandle, D3D12_DESCRIPTOR_HEAP_TYPE type)
-{
-    size_t count = fgHeaps.size();
-    for (size_t i = 0; i < count; i++)
-    {
-        auto val = fgHeaps[i].get();
-        if (fgHeaps[i] != nullptr && val->active && val->cpuStart <= cpuHandle && val->cpuEnd > cpuHandle &&
-            val->gpuStart != 0)
-        {
-            auto incSize = This->GetDescriptorHandleIncrementSize(type);
-            auto addr = cpuHandle - val->cpuStart;
-            auto index = addr / incSize;
-            auto gpuAddr = val->gpuStart + (index * incSize);
-
-            return gpuAddr;
-        }
-    }
-
-    return NULL;
-}
-
-SIZE_T ResTrack_Dx12::GetCPUHandle(ID3D12Device* This, SIZE_T gpuHandle, D3D12_DESCRIPTOR_HEAP_TYPE type)
-{
-    size_t count = fgHeaps.size();
-    for (size_t i = 0; i < count; i++)
-    {
-        auto val = fgHeaps[i].get();
-        if (fgHeaps[i] != nullptr && val->active && val->gpuStart <= gpuHandle && val->gpuEnd > gpuHandle &&
-            val->cpuStart != 0)
-        {
-            auto incSize = This->GetDescriptorHandleIncrementSize(type);
-            auto addr = gpuHandle - val->gpuStart;
-            auto index = addr / incSize;
-            auto cpuAddr = val->cpuStart + (index * incSize);
-
-            return cpuAddr;
-        }
-    }
+#pragma endregion
 
-    return NULL;
-}
+#pragma region Hudless methods
 
-HeapInfo* ResTrack_Dx12::GetHeapByCpuHandleCBV(SIZE_T cpuHandle)
+bool ResTrack_Dx12::IsHudFixActive()
 {
-    unsigned currentGen = gHeapGeneration.load(std::memory_order_acquire);
-    if (cacheCBV.genSeen == currentGen && cacheCBV.heapPtr != nullptr &&
-        cacheCBV.heapPtr->version == cacheCBV.heapVersion && cacheCBV.heapPtr->active &&
-        cacheCBV.heapPtr->cpuStart <= cpuHandle && cpuHandle < cacheCBV.heapPtr->cpuEnd)
+    if (!Config::Instance()->FGEnabled.value_or_default() || !Config::Instance()->FGHUDFix.value_or_default())
     {
-        return cacheCBV.heapPtr;
+        LOG_TRACK(
+            "!Config::Instance()->FGEnabled.value_or_default() || !Config::Instance()->FGHUDFix.value_or_default()");
+        return false;
     }
 
-    size_t count = fgHeaps.size();
-    for (size_t i = 0; i < count; i++)
+    if (State::Instance().currentFG == nullptr || State::Instance().currentFeature == nullptr ||
+        State::Instance().FGchanged)
     {
-        if (fgHeaps[i] != nullptr && fgHeaps[i]->active && fgHeaps[i]->cpuStart <= cpuHandle &&
-            cpuHandle < fgHeaps[i]->cpuEnd)
-        {
-            cacheCBV.genSeen = currentGen;
-            cacheCBV.heapPtr = fgHeaps[i].get();
-            cacheCBV.heapVersion = cacheCBV.heapPtr->version;
-            return cacheCBV.heapPtr;
-        }
+        LOG_TRACK("State::Instance().currentFG == nullptr || State::Instance().currentFeature == nullptr || "
+                  "State::Instance().FGchanged");
+        return false;
     }
 
-    cacheCBV.heapVersion = 0;
-    cacheCBV.heapPtr = nullptr;
-    return nullptr;
-}
-
-HeapInfo* ResTrack_Dx12::GetHeapByCpuHandleRTV(SIZE_T cpuHandle)
-{
-    unsigned currentGen = gHeapGeneration.load(std::memory_order_acquire);
-    if (cacheRTV.genSeen == currentGen && cacheRTV.heapPtr != nullptr &&
-        cacheRTV.heapPtr->version == cacheRTV.heapVersion && cacheRTV.heapPtr->active &&
-        cacheRTV.heapPtr->cpuStart <= cpuHandle && cpuHandle < cacheRTV.heapPtr->cpuEnd)
+    if (!State::Instance().currentFG->IsActive())
     {
-        return cacheRTV.heapPtr;
+        LOG_TRACK("!State::Instance().currentFG->IsActive()");
+        return false;
     }
 
-    size_t count = fgHeaps.size();
-    for (size_t i = 0; i < count; i++)
+    if (!_presentDone)
     {
-        if (fgHeaps[i] != nullptr && fgHeaps[i]->active && fgHeaps[i]->cpuStart <= cpuHandle &&
-            cpuHandle < fgHeaps[i]->cpuEnd)
-        {
-            cacheRTV.genSeen = currentGen;
-            cacheRTV.heapPtr = fgHeaps[i].get();
-            cacheRTV.heapVersion = cacheRTV.heapPtr->version;
-            return cacheRTV.heapPtr;
-        }
+        LOG_TRACK("!_presentDone");
+        return false;
     }
 
-    cacheRTV.heapVersion = 0;
-    cacheRTV.heapPtr = nullptr;
-    return nullptr;
-}
-
-HeapInfo* ResTrack_Dx12::GetHeapByCpuHandleSRV(SIZE_T cpuHandle)
-{
-    unsigned currentGen = gHeapGeneration.load(std::memory_order_acquire);
-    if (cacheSRV.genSeen == currentGen && cacheSRV.heapPtr != nullptr &&
-        cacheSRV.heapPtr->version == cacheSRV.heapVersion && cacheSRV.heapPtr->active &&
-        cacheSRV.heapPtr->cpuStart <= cpuHandle && cpuHandle < cacheSRV.heapPtr->cpuEnd)
+    if (Hudfix_Dx12::SkipHudlessChecks())
     {
-        return cacheSRV.heapPtr;
+        LOG_TRACK("!Hudfix_Dx12::SkipHudlessChecks()");
+        return false;
     }
 
-    size_t count = fgHeaps.size();
-    for (size_t i = 0; i < count; i++)
+    if (!Hudfix_Dx12::IsResourceCheckActive())
     {
-        if (fgHeaps[i] != nullptr && fgHeaps[i]->active && fgHeaps[i]->cpuStart <= cpuHandle &&
-            cpuHandle < fgHeaps[i]->cpuEnd)
-        {
-            cacheSRV.genSeen = currentGen;
-            cacheSRV.heapPtr = fgHeaps[i].get();
-            cacheSRV.heapVersion = cacheSRV.heapPtr->version;
-            return cacheSRV.heapPtr;
-        }
+        // LOG_TRACK("!Hudfix_Dx12::IsResourceCheckActive()");
+        return false;
     }
 
-    cacheSRV.heapVersion = 0;
-    cacheSRV.heapPtr = nullptr;
-    return nullptr;
+    return true;
 }
 
-HeapInfo* ResTrack_Dx12::GetHeapByCpuHandleUAV(SIZE_T cpuHandle)
+void ResTrack_Dx12::TrackCreatedView(HeapInfo* heap, SIZE_T cpuHandle, ID3D12Resource* resource, bool validView,
+                                     UINT viewDimension, TraceOp op, ResourceType type, CaptureInfo captureInfo)
 {
-    unsigned currentGen = gHeapGeneration.load(std::memory_order_acquire);
-    if (cacheUAV.genSeen == currentGen && cacheUAV.heapPtr != nullptr &&
-        cacheUAV.heapPtr->version == cacheUAV.heapVersion && cacheUAV.heapPtr->active &&
-        cacheUAV.heapPtr->cpuStart <= cpuHandle && cpuHandle < cacheUAV.heapPtr->cpuEnd)
-    {
-        return cacheUAV.heapPtr;
-    }
+    auto recording = ResTrack_Trace::IsRecording();
 
-    size_t count = fgHeaps.size();
-    for (size_t i = 0; i < count; i++)
+    // Null or non 2D views only clear the slot, don't query the resource
+    if (!validView)
     {
-        if (fgHeaps[i] != nullptr && fgHeaps[i]->active && fgHeaps[i]->cpuStart <= cpuHandle &&
-            cpuHandle < fgHeaps[i]->cpuEnd)
-        {
-            cacheUAV.genSeen = currentGen;
-            cacheUAV.heapPtr = fgHeaps[i].get();
-            cacheUAV.heapVersion = cacheUAV.heapPtr->version;
-            return cacheUAV.heapPtr;
-        }
-    }
+        if (recording)
+            ResTrack_Trace::Record(op, { 0, cpuHandle, (uint64_t) viewDimension });
 
-    cacheUAV.heapVersion = 0;
-    cacheUAV.heapPtr = nullptr;
-    return nullptr;
-}
-
-HeapInfo* ResTrack_Dx12::GetHeapByCpuHandle(SIZE_T cpuHandle)
-{
-    unsigned currentGen = gHeapGeneration.load(std::memory_order_acquire);
-    if (cache.genSeen == currentGen && cache.heapPtr != nullptr && cache.heapPtr->version == cache.heapVersion &&
-        cache.heapPtr->active && cache.heapPtr->cpuStart <= cpuHandle && cpuHandle < cache.heapPtr->cpuEnd)
-    {
-        return cache.heapPtr;
-    }
+        if (heap != nullptr)
+            heap->ClearByCpuHandle(cpuHandle);
 
-    size_t count = fgHeaps.size();
-    for (size_t i = 0; i < count; i++)
-    {
-        if (fgHeaps[i] != nullptr && fgHeaps[i]->active && fgHeaps[i]->cpuStart <= cpuHandle &&
-            cpuHandle < fgHeaps[i]->cpuEnd)
-        {
-            cache.genSeen = currentGen;
-            cache.heapPtr = fgHeaps[i].get();
-            cache.heapVersion = cache.heapPtr->version;
-            return cache.heapPtr;
-        }
+        return;
     }
 
-    cache.heapVersion = 0;
-    cache.heapPtr = nullptr;
-    return nullptr;
-}
-
-HeapInfo* ResTrack_Dx12::GetHeapByGpuHandleGR(SIZE_T gpuHandle)
-{
-    if (gpuHandle == NULL)
-        return nullptr;
+    if (heap == nullptr && !recording)
+        return;
 
-    unsigned currentGen = gHeapGeneration.load(std::memory_order_acquire);
-    if (cacheGR.genSeen == currentGen && cacheGR.heapPtr != nullptr &&
-        cacheGR.heapPtr->version == cacheGR.heapVersion && cacheGR.heapPtr->active &&
-        cacheGR.heapPtr->gpuStart <= gpuHandle && gpuHandle < cacheGR.heapPtr->gpuEnd)
-    {
-        return cacheGR.heapPtr;
-    }
+    auto resDesc = resource->GetDesc();
 
-    size_t count = fgHeaps.size();
-    for (size_t i = 0; i < count; i++)
+    if (recording)
     {
-        if (fgHeaps[i] != nullptr && fgHeaps[i]->active && fgHeaps[i]->gpuStart <= gpuHandle &&
-            gpuHandle < fgHeaps[i]->gpuEnd)
-        {
-            cacheGR.genSeen = currentGen;
-            cacheGR.heapPtr = fgHeaps[i].get();
-            cacheGR.heapVersion = cacheGR.heapPtr->version;
-            return cacheGR.heapPtr;
-        }
+        ResTrack_Trace::RecordResource(resource, resDesc);
+        ResTrack_Trace::Record(op, { (uint64_t) resource, cpuHandle, (uint64_t) viewDimension });
     }
 
-    cacheGR.heapVersion = 0;
-    cacheGR.heapPtr = nullptr;
-    return nullptr;
+    if (heap != nullptr)
+        ResTrack_Tables::TrackView(heap, cpuHandle, resource, CheckResource(resDesc) ? &resDesc : nullptr, type,
+                                   captureInfo);
 }
 
-HeapInfo* ResTrack_Dx12::GetHeapByGpuHandleCR(SIZE_T gpuHandle)
+void ResTrack_Dx12::TrackPossibleHudless(ID3D12GraphicsCommandList* cmdList, ResourceInfo* resource)
 {
-    if (gpuHandle == NULL)
-        return nullptr;
-
-    unsigned currentGen = gHeapGeneration.load(std::memory_order_acquire);
-    if (cacheCR.genSeen == currentGen && cacheCR.heapPtr != nullptr &&
-        cacheCR.heapPtr->version == cacheCR.heapVersion && cacheCR.heapPtr->active &&
-        cacheCR.heapPtr->gpuStart <= gpuHandle && gpuHandle < cacheCR.heapPtr->gpuEnd)
-    {
-        return cacheCR.heapPtr;
-    }
-
-    size_t count = fgHeaps.size();
-    for (size_t i = 0; i < count; i++)
-    {
-        if (fgHeaps[i] != nullptr && fgHeaps[i]->active && fgHeaps[i]->gpuStart <= gpuHandle &&
-            gpuHandle < fgHeaps[i]->gpuEnd)
-        {
-            cacheCR.genSeen = currentGen;
-            cacheCR.heapPtr = fgHeaps[i].get();
-            cacheCR.heapVersion = cacheCR.heapPtr->version;
-            return cacheCR.heapPtr;
-        }
-    }
-
-    cacheCR.heapVersion = 0;
-    cacheCR.heapPtr = nullptr;
-    return nullptr;
+    ResTrack_Tables::TrackPossibleHudless(Hudfix_Dx12::ActivePresentFrame() % BUFFER_COUNT, cmdList, resource);
 }
 
-#pragma endregion
-
-#pragma region Hudless methods
-
-void ResTrack_Dx12::FillResourceInfo(ID3D12Resource* resource, ResourceInfo* info)
+bool ResTrack_Dx12::TakePossibleHudless(ID3D12GraphicsCommandList* cmdList,
+                                        ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo>& output)
 {
-    auto desc = resource->GetDesc();
-    info->buffer = resource;
-    info->width = desc.Width;
-    info->height = desc.Height;
-    info->format = desc.Format;
-    info->flags = desc.Flags;
-}
+    auto fIndex = Hudfix_Dx12::ActivePresentFrame() % BUFFER_COUNT;
 
-bool ResTrack_Dx12::IsHudFixActive()
-{
-    if (!Config::Instance()->FGEnabled.value_or_default() || !Config::Instance()->FGHUDFix.value_or_default())
+    if (cmdList == MenuOverlayDx::MenuCommandList())
     {
-        LOG_TRACK(
-            "!Config::Instance()->FGEnabled.value_or_default() || !Config::Instance()->FGHUDFix.value_or_default()");
+        ResTrack_Tables::DropPossibleHudless(fIndex, cmdList);
         return false;
     }
 
-    if (State::Instance().currentFG == nullptr || State::Instance().currentFeature == nullptr ||
-        State::Instance().FGchanged)
-    {
-        LOG_TRACK("State::Instance().currentFG == nullptr || State::Instance().currentFeature == nullptr || "
-                  "State::Instance().FGchanged");
-        return false;
-    }
+    return ResTrack_Tables::TakePossibleHudless(fIndex, cmdList, output);
+}
 
-    if (!State::Instance().currentFG->IsActive())
+void ResTrack_Dx12::ReportRenderTargetWrites(UINT count, const D3D12_CPU_DESCRIPTOR_HANDLE* handles,
+                                             BOOL singleHandleToRange)
+{
+    for (UINT i = 0; i < count; i++)
     {
-        LOG_TRACK("!State::Instance().currentFG->IsActive()");
-        return false;
-    }
+        auto handle = singleHandleToRange ? handles[0].ptr : handles[i].ptr;
+        auto heap = ResTrack_Tables::GetHeapByCpuHandleRTV(handle);
+        if (heap == nullptr)
+            continue;
 
-    if (!_presentDone)
-    {
-        LOG_TRACK("!_presentDone");
-        return false;
-    }
+        if (singleHandleToRange)
+            handle += i * heap->increment;
 
-    if (Hudfix_Dx12::SkipHudlessChecks())
-    {
-        LOG_TRACK("!Hudfix_Dx12::SkipHudlessChecks()");
-        return false;
+        if (auto info = heap->GetByCpuHandle(handle); info != nullptr && info->buffer != nullptr)
+            FG_CopyPlanner::Written((uintptr_t) info->buffer);
     }
+}
 
-    if (!Hudfix_Dx12::IsResourceCheckActive())
-    {
-        // LOG_TRACK("!Hudfix_Dx12::IsResourceCheckActive()");
-        return false;
-    }
+void ResTrack_Dx12::ReportTableWrite(HeapInfo* heap, SIZE_T gpuHandle)
+{
+    if (heap == nullptr)
+        return;
 
-    return true;
+    if (auto info = heap->GetByGpuHandle(gpuHandle); info != nullptr && info->buffer != nullptr && info->type == UAV)
+        FG_CopyPlanner::Written((uintptr_t) info->buffer);
 }
 
 #pragma endregion
@@ -593,33 +396,10 @@ void ResTrack_Dx12::hkCreateRenderTargetView(ID3D12Device* This, ID3D12Resource*
     if (Config::Instance()->FGHudfixDisableRTV.value_or_default())
         return;
 
-    if (pResource == nullptr || pDesc == nullptr || pDesc->ViewDimension != D3D12_RTV_DIMENSION_TEXTURE2D ||
-        !CheckResource(pResource))
-    {
-        auto heap = GetHeapByCpuHandleRTV(DestDescriptor.ptr);
-
-        if (heap != nullptr)
-            heap->ClearByCpuHandle(DestDescriptor.ptr);
-
-        return;
-    }
-
-    // if (!CheckResource(pResource))
-    //     return;
-
-    auto heap = GetHeapByCpuHandleRTV(DestDescriptor.ptr);
-    if (heap != nullptr)
-    {
-        ResourceInfo resInfo {};
-        FillResourceInfo(pResource, &resInfo);
-        resInfo.type = RTV;
-        resInfo.captureInfo = CaptureInfo::CreateRTV;
-        heap->SetByCpuHandle(DestDescriptor.ptr, resInfo);
-    }
-    // else
-    //{
-    //     LOG_TRACK("Heap not found for RTV: {:X}", DestDescriptor.ptr);
-    // }
+    auto heap = ResTrack_Tables::GetHeapByCpuHandleRTV(DestDescriptor.ptr);
+    auto validView = pResource != nullptr && pDesc != nullptr && pDesc->ViewDimension == D3D12_RTV_DIMENSION_TEXTURE2D;
+    TrackCreatedView(heap, DestDescriptor.ptr, pResource, validView, pDesc != nullptr ? pDesc->ViewDimension : UINT_MAX,
+                     TraceOp::CreateRTV, RTV, CaptureInfo::CreateRTV);
 }
 
 void ResTrack_Dx12::hkCreateShaderResourceView(ID3D12Device* This, ID3D12Resource* pResource,
@@ -648,33 +428,10 @@ void ResTrack_Dx12::hkCreateShaderResourceView(ID3D12Device* This, ID3D12Resourc
     if (Config::Instance()->FGHudfixDisableSRV.value_or_default())
         return;
 
-    if (pResource == nullptr || pDesc == nullptr || pDesc->ViewDimension != D3D12_SRV_DIMENSION_TEXTURE2D ||
-        !CheckResource(pResource))
-    {
-        auto heap = GetHeapByCpuHandleSRV(DestDescriptor.ptr);
-
-        if (heap != nullptr)
-            heap->ClearByCpuHandle(DestDescriptor.ptr);
-
-        return;
-    }
-
-    // if (!CheckResource(pResource))
-    //     return;
-
-    auto heap = GetHeapByCpuHandleSRV(DestDescriptor.ptr);
-    if (heap != nullptr)
-    {
-        ResourceInfo resInfo {};
-        FillResourceInfo(pResource, &resInfo);
-        resInfo.type = SRV;
-        resInfo.captureInfo = CaptureInfo::CreateSRV;
-        heap->SetByCpuHandle(DestDescriptor.ptr, resInfo);
-    }
-    // else
-    //{
-    //     LOG_TRACK("Heap not found for SRV: {:X}", DestDescriptor.ptr);
-    // }
+    auto heap = ResTrack_Tables::GetHeapByCpuHandleSRV(DestDescriptor.ptr);
+    auto validView = pResource != nullptr && pDesc != nullptr && pDesc->ViewDimension == D3D12_SRV_DIMENSION_TEXTURE2D;
+    TrackCreatedView(heap, DestDescriptor.ptr, pResource, validView, pDesc != nullptr ? pDesc->ViewDimension : UINT_MAX,
+                     TraceOp::CreateSRV, SRV, CaptureInfo::CreateSRV);
 }
 
 void ResTrack_Dx12::hkCreateUnorderedAccessView(ID3D12Device* This, ID3D12Resource* pResource,
@@ -703,33 +460,10 @@ void ResTrack_Dx12::hkCreateUnorderedAccessView(ID3D12Device* This, ID3D12Resour
     if (Config::Instance()->FGHudfixDisableUAV.value_or_default())
         return;
 
-    if (pResource == nullptr || pDesc == nullptr || pDesc->ViewDimension != D3D12_UAV_DIMENSION_TEXTURE2D ||
-        !CheckResource(pResource))
-    {
-        auto heap = GetHeapByCpuHandleUAV(DestDescriptor.ptr);
-
-        if (heap != nullptr)
-            heap->ClearByCpuHandle(DestDescriptor.ptr);
-
-        return;
-    }
-
-    // if (!CheckResource(pResource))
-    //     return;
-
-    auto heap = GetHeapByCpuHandleUAV(DestDescriptor.ptr);
-    if (heap != nullptr)
-    {
-        ResourceInfo resInfo {};
-        FillResourceInfo(pResource, &resInfo);
-        resInfo.type = UAV;
-        resInfo.captureInfo = CaptureInfo::CreateUAV;
-        heap->SetByCpuHandle(DestDescriptor.ptr, resInfo);
-    }
-    // else
-    //{
-    //     LOG_TRACK("Heap not found for UAV: {:X}", DestDescriptor.ptr);
-    // }
+    auto heap = ResTrack_Tables::GetHeapByCpuHandleUAV(DestDescriptor.ptr);
+    auto validView = pResource != nullptr && pDesc != nullptr && pDesc->ViewDimension == D3D12_UAV_DIMENSION_TEXTURE2D;
+    TrackCreatedView(heap, DestDescriptor.ptr, pResource, validView, pDesc != nullptr ? pDesc->ViewDimension : UINT_MAX,
+                     TraceOp::CreateUAV, UAV, CaptureInfo::CreateUAV);
 }
 
 #pragma endregion
@@ -737,6 +471,19 @@ void ResTrack_Dx12::hkCreateUnorderedAccessView(ID3D12Device* This, ID3D12Resour
 void ResTrack_Dx12::hkExecuteCommandLists(ID3D12CommandQueue* This, UINT NumCommandLists,
                                           ID3D12CommandList* const* ppCommandLists)
 {
+    if (ResTrack_Trace::IsRecording() && NumCommandLists + 2 <= TRACE_MAX_ARGS)
+    {
+        std::vector<uint64_t> args;
+        args.reserve(NumCommandLists + 2);
+        args.push_back((uint64_t) This);
+        args.push_back(NumCommandLists);
+
+        for (UINT i = 0; i < NumCommandLists; i++)
+            args.push_back((uint64_t) ppCommandLists[i]);
+
+        ResTrack_Trace::Record(TraceOp::ExecuteCommandLists, args.data(), (uint16_t) args.size());
+    }
+
     auto fg = State::Instance().currentFG;
 
     if (fg != nullptr && fg->IsActive() && !fg->IsPaused())
@@ -794,6 +541,7 @@ void ResTrack_Dx12::hkExecuteCommandLists(ID3D12CommandQueue* This, UINT NumComm
         if (!found.empty())
         {
             o_ExecuteCommandLists(This, NumCommandLists, ppCommandLists);
+            DescriptorRing_Dx12::Executed(This, NumCommandLists, ppCommandLists);
 
             for (size_t i = 0; i < found.size(); i++)
             {
@@ -807,64 +555,26 @@ void ResTrack_Dx12::hkExecuteCommandLists(ID3D12CommandQueue* This, UINT NumComm
     LOG_TRACK("Done NumCommandLists: {}", NumCommandLists);
 
     o_ExecuteCommandLists(This, NumCommandLists, ppCommandLists);
+    DescriptorRing_Dx12::Executed(This, NumCommandLists, ppCommandLists);
 }
 
 #pragma region Heap hooks
 
-static ULONG STDMETHODCALLTYPE hkHeapRelease(ID3D12DescriptorHeap* This)
+ULONG ResTrack_Dx12::hkHeapRelease(ID3D12DescriptorHeap* This)
 {
     if (State::Instance().isShuttingDown)
         return o_HeapRelease(This);
 
-    size_t count = fgHeaps.size();
-    for (size_t i = 0; i < count; i++)
+    if (auto heapInfo = ResTrack_Tables::FindHeap(This); heapInfo != nullptr)
     {
-        auto& up = fgHeaps[i];
-
-        if (up == nullptr || up->heap != This || !up->active)
-            continue;
-
         This->AddRef();
         if (o_HeapRelease(This) <= 1)
         {
-#ifdef USE_SPINLOCK_MUTEX_FOR_HEAP_CREATION
-            std::lock_guard<SpinLock> lock(_heapCreationMutex);
-#else
-            std::lock_guard<std::mutex> lock(_heapCreationMutex);
-#endif
-
-            up->active = false;
+            if (ResTrack_Trace::IsRecording())
+                ResTrack_Trace::Record(TraceOp::ReleaseHeap, { (uint64_t) This });
 
-            LOG_INFO("Heap released: {:X}", (size_t) This);
-
-            // detach all slots from _trackedResources
-            {
-                std::scoped_lock lk(_trackedResourcesMutex);
-
-                for (UINT j = 0; j < up->numDescriptors; ++j)
-                {
-                    auto& slot = up->info[j];
-
-                    if (slot.buffer == nullptr)
-                        continue;
-
-                    if (auto it = _trackedResources.find(slot.buffer); it != _trackedResources.end())
-                    {
-                        auto& vec = it->second;
-                        vec.erase(std::remove(vec.begin(), vec.end(), &slot), vec.end());
-                        if (vec.empty())
-                            _trackedResources.erase(it);
-                    }
-
-                    slot.buffer = nullptr;
-                    slot.lastUsedFrame = 0;
-                }
-            }
-
-            gHeapGeneration.fetch_add(1, std::memory_order_release); // invalidate caches
+            ResTrack_Tables::UnregisterHeap(heapInfo);
         }
-
-        break;
     }
 
     return o_HeapRelease(This);
@@ -904,43 +614,15 @@ HRESULT ResTrack_Dx12::hkCreateDescriptorHeap(ID3D12Device* This, D3D12_DESCRIPT
 
         LOG_TRACE("Heap: {:X}, Heap type: {}, Cpu: {}-{}, Gpu: {}-{}, Desc count: {}", (size_t) *ppvHeap, type,
                   cpuStart, cpuEnd, gpuStart, gpuEnd, numDescriptors);
-        {
-#ifdef USE_SPINLOCK_MUTEX_FOR_HEAP_CREATION
-            std::lock_guard<SpinLock> lock(_heapCreationMutex);
-#else
-            std::lock_guard<std::mutex> lock(_heapCreationMutex);
-#endif
-            size_t count = fgHeaps.size();
-            bool foundEmpty = false;
-            for (size_t i = 0; i < count; i++)
-            {
-                if (fgHeaps[i] != nullptr && !fgHeaps[i]->active)
-                {
-
-                    fgHeaps[i].reset();
-                    fgHeaps[i] = std::make_unique<HeapInfo>(heap, cpuStart, cpuEnd, gpuStart, gpuEnd, numDescriptors,
-                                                            increment, type);
-
-                    gHeapGeneration.fetch_add(1, std::memory_order_release);
-                    foundEmpty = true;
-                    LOG_DEBUG("Reusing empty heap slot: {}", i);
-                    break;
-                }
-            }
-
-            if (!foundEmpty)
-            {
-                // Reallocate vector if needed
-                if (fgHeaps.capacity() == fgHeaps.size())
-                    fgHeaps.reserve(fgHeaps.size() + 65536);
-
-                fgHeaps.push_back(std::make_unique<HeapInfo>(heap, cpuStart, cpuEnd, gpuStart, gpuEnd, numDescriptors,
-                                                             increment, type));
 
-                gHeapGeneration.fetch_add(1, std::memory_order_release);
-                LOG_DEBUG("Adding new heap slot: {}", fgHeaps.size() - 1);
-            }
+        if (ResTrack_Trace::IsRecording())
+        {
+            ResTrack_Trace::Record(TraceOp::CreateHeap, { (uint64_t) heap, cpuStart, gpuStart,
+                                                          (uint64_t) numDescriptors | ((uint64_t) type << 32),
+                                                          increment });
         }
+
+        ResTrack_Tables::RegisterHeap(heap, cpuStart, cpuEnd, gpuStart, gpuEnd, numDescriptors, increment, type);
     }
     else
     {
@@ -967,6 +649,9 @@ ULONG ResTrack_Dx12::hkRelease(ID3D12Resource* This)
         This->AddRef();
         auto refCount = o_Release(This);
 
+        if (refCount <= 1)
+            ResTrack_Trace::RecordRelease(This);
+
         if (refCount <= 1 && _trackedResources.contains(This))
         {
             toClean = _trackedResources[This]; // Copy vector
@@ -988,6 +673,44 @@ ULONG ResTrack_Dx12::hkRelease(ID3D12Resource* This)
     return o_Release(This);
 }
 
+static void RecordCopyDescriptors(UINT inc, UINT NumDestDescriptorRanges,
+                                  D3D12_CPU_DESCRIPTOR_HANDLE* pDestDescriptorRangeStarts,
+                                  UINT* pDestDescriptorRangeSizes, UINT NumSrcDescriptorRanges,
+                                  D3D12_CPU_DESCRIPTOR_HANDLE* pSrcDescriptorRangeStarts,
+                                  UINT* pSrcDescriptorRangeSizes, D3D12_DESCRIPTOR_HEAP_TYPE DescriptorHeapsType)
+{
+    if (pSrcDescriptorRangeStarts == nullptr)
+        NumSrcDescriptorRanges = 0;
+
+    auto argCount = 3 + 2 * (size_t) NumDestDescriptorRanges + 2 * (size_t) NumSrcDescriptorRanges;
+
+    if (argCount > TRACE_MAX_ARGS)
+    {
+        LOG_WARN("Too many ranges to record: {}", argCount);
+        return;
+    }
+
+    std::vector<uint64_t> args;
+    args.reserve(argCount);
+    args.push_back((uint64_t) DescriptorHeapsType | ((uint64_t) inc << 32));
+    args.push_back(NumDestDescriptorRanges);
+    args.push_back(NumSrcDescriptorRanges);
+
+    for (UINT i = 0; i < NumDestDescriptorRanges; i++)
+    {
+        args.push_back(pDestDescriptorRangeStarts[i].ptr);
+        args.push_back(pDestDescriptorRangeSizes == nullptr ? 1 : pDestDescriptorRangeSizes[i]);
+    }
+
+    for (UINT i = 0; i < NumSrcDescriptorRanges; i++)
+    {
+        args.push_back(pSrcDescriptorRangeStarts[i].ptr);
+        args.push_back(pSrcDescriptorRangeSizes == nullptr ? 1 : pSrcDescriptorRangeSizes[i]);
+    }
+
+    ResTrack_Trace::Record(TraceOp::CopyDescriptors, args.data(), (uint16_t) args.size());
+}
+
 void ResTrack_Dx12::hkCopyDescriptors(ID3D12Device* This, UINT NumDestDescriptorRanges,
                                       D3D12_CPU_DESCRIPTOR_HANDLE* pDestDescriptorRangeStarts,
                                       UINT* pDestDescriptorRangeSizes, UINT NumSrcDescriptorRanges,
@@ -1005,94 +728,21 @@ void ResTrack_Dx12::hkCopyDescriptors(ID3D12Device* This, UINT NumDestDescriptor
     if (NumDestDescriptorRanges == 0 || pDestDescriptorRangeStarts == nullptr)
         return;
 
-    if (!Config::Instance()->FGAlwaysTrackHeaps.value_or_default() && !IsHudFixActive())
-        return;
-
     const UINT inc = This->GetDescriptorHandleIncrementSize(DescriptorHeapsType);
 
-    // Validate that we have source descriptors to copy
-    bool haveSources = (NumSrcDescriptorRanges > 0 && pSrcDescriptorRangeStarts != nullptr);
-
-    // Track positions in both source and destination ranges
-    UINT srcRangeIndex = 0;
-    UINT srcOffsetInRange = 0;
-    UINT destRangeIndex = 0;
-    UINT destOffsetInRange = 0;
-
-    // Cache for heap lookups to avoid repeated lookups within the same range
-    HeapInfo* cachedDestHeap = nullptr;
-    SIZE_T cachedDestRangeStart = 0;
-    UINT cachedDestRangeSize = 0;
-    HeapInfo* cachedSrcHeap = nullptr;
-    SIZE_T cachedSrcRangeStart = 0;
-    UINT cachedSrcRangeSize = 0;
-
-    // Process all destination descriptors
-    while (destRangeIndex < NumDestDescriptorRanges)
+    if (ResTrack_Trace::IsRecording())
     {
-        // Update destination heap cache if we've moved to a new range
-        if (destOffsetInRange == 0)
-        {
-            cachedDestRangeStart = pDestDescriptorRangeStarts[destRangeIndex].ptr;
-            cachedDestRangeSize =
-                (pDestDescriptorRangeSizes == nullptr) ? 1 : pDestDescriptorRangeSizes[destRangeIndex];
-            cachedDestHeap = GetHeapByCpuHandle(cachedDestRangeStart);
-        }
-
-        // Calculate current destination handle
-        const SIZE_T destHandle = cachedDestRangeStart + (static_cast<SIZE_T>(destOffsetInRange) * inc);
-
-        // Get or update source information
-        ResourceInfo* srcInfo = nullptr;
-        if (haveSources && srcRangeIndex < NumSrcDescriptorRanges)
-        {
-            // Update source heap cache if we've moved to a new range
-            if (srcOffsetInRange == 0)
-            {
-                cachedSrcRangeStart = pSrcDescriptorRangeStarts[srcRangeIndex].ptr;
-                cachedSrcRangeSize =
-                    (pSrcDescriptorRangeSizes == nullptr) ? 1 : pSrcDescriptorRangeSizes[srcRangeIndex];
-                cachedSrcHeap = GetHeapByCpuHandle(cachedSrcRangeStart);
-            }
-
-            // Calculate current source handle
-            const SIZE_T srcHandle = cachedSrcRangeStart + (static_cast<SIZE_T>(srcOffsetInRange) * inc);
-
-            // Get source resource info with proper synchronization
-            if (cachedSrcHeap != nullptr)
-            {
-                // Access to heap info is synchronized through HeapInfo's const methods
-                // which use _trackedResourcesMutex internally
-                srcInfo = cachedSrcHeap->GetByCpuHandle(srcHandle);
-            }
-
-            // Advance source position
-            srcOffsetInRange++;
-            if (srcOffsetInRange >= cachedSrcRangeSize)
-            {
-                srcOffsetInRange = 0;
-                srcRangeIndex++;
-            }
-        }
+        RecordCopyDescriptors(inc, NumDestDescriptorRanges, pDestDescriptorRangeStarts, pDestDescriptorRangeSizes,
+                              NumSrcDescriptorRanges, pSrcDescriptorRangeStarts, pSrcDescriptorRangeSizes,
+                              DescriptorHeapsType);
+    }
 
-        // Update destination heap tracking with proper synchronization
-        if (cachedDestHeap != nullptr)
-        {
-            // HeapInfo's Set/Clear methods use _trackedResourcesMutex internally
-            if (srcInfo != nullptr && srcInfo->buffer != nullptr)
-                cachedDestHeap->SetByCpuHandle(destHandle, *srcInfo);
-            else
-                cachedDestHeap->ClearByCpuHandle(destHandle);
-        }
+    if (!Config::Instance()->FGAlwaysTrackHeaps.value_or_default() && !IsHudFixActive())
+        return;
 
-        // Advance destination position
-        destOffsetInRange++;
-        if (destOffsetInRange >= cachedDestRangeSize)
-        {
-            destOffsetInRange = 0;
-            destRangeIndex++;
-        }
-    }
+    ResTrack_Tables::TrackCopyDescriptors(inc, NumDestDescriptorRanges, pDestDescriptorRangeStarts,
+                                          pDestDescriptorRangeSizes, NumSrcDescriptorRanges, pSrcDescriptorRangeStarts,
+                                          pSrcDescriptorRangeSizes);
 }
 
 void ResTrack_Dx12::hkCopyDescriptorsSimple(ID3D12Device* This, UINT NumDescriptors,
@@ -1107,46 +757,20 @@ void ResTrack_Dx12::hkCopyDescriptorsSimple(ID3D12Device* This, UINT NumDescript
         DescriptorHeapsType != D3D12_DESCRIPTOR_HEAP_TYPE_RTV)
         return;
 
-    if (!Config::Instance()->FGAlwaysTrackHeaps.value_or_default() && !IsHudFixActive())
-        return;
-
     auto size = This->GetDescriptorHandleIncrementSize(DescriptorHeapsType);
 
-    for (size_t i = 0; i < NumDescriptors; i++)
+    if (ResTrack_Trace::IsRecording())
     {
-        HeapInfo* srcHeap = nullptr;
-        SIZE_T srcHandle = 0;
-
-        // source
-        if (SrcDescriptorRangeStart.ptr != 0)
-        {
-            srcHandle = SrcDescriptorRangeStart.ptr + i * size;
-            srcHeap = GetHeapByCpuHandle(srcHandle);
-        }
-
-        auto destHandle = DestDescriptorRangeStart.ptr + i * size;
-        auto dstHeap = GetHeapByCpuHandle(destHandle);
-
-        // destination
-        if (dstHeap == nullptr)
-            continue;
-
-        if (srcHeap == nullptr)
-        {
-            dstHeap->ClearByCpuHandle(destHandle);
-            continue;
-        }
-
-        auto buffer = srcHeap->GetByCpuHandle(srcHandle);
+        ResTrack_Trace::Record(TraceOp::CopyDescriptorsSimple,
+                               { (uint64_t) DescriptorHeapsType | ((uint64_t) size << 32), NumDescriptors,
+                                 DestDescriptorRangeStart.ptr, SrcDescriptorRangeStart.ptr });
+    }
 
-        if (buffer == nullptr)
-        {
-            dstHeap->ClearByCpuHandle(destHandle);
-            continue;
-        }
+    if (!Config::Instance()->FGAlwaysTrackHeaps.value_or_default() && !IsHudFixActive())
+        return;
 
-        dstHeap->SetByCpuHandle(destHandle, *buffer);
-    }
+    ResTrack_Tables::TrackCopyDescriptorsSimple(size, NumDescriptors, DestDescriptorRangeStart.ptr,
+                                                SrcDescriptorRangeStart.ptr);
 }
 
 #pragma endregion
@@ -1156,6 +780,16 @@ void ResTrack_Dx12::hkCopyDescriptorsSimple(ID3D12Device* This, UINT NumDescript
 void ResTrack_Dx12::hkSetGraphicsRootDescriptorTable(ID3D12GraphicsCommandList* This, UINT RootParameterIndex,
                                                      D3D12_GPU_DESCRIPTOR_HANDLE BaseDescriptor)
 {
+    if (ResTrack_Trace::IsRecording())
+    {
+        ResTrack_Trace::Record(TraceOp::SetGraphicsRootTable,
+                               { (uint64_t) This, RootParameterIndex, BaseDescriptor.ptr });
+    }
+
+    // Copy planner needs writes after hudless capture too
+    if (FG_CopyPlanner::IsWatching() && BaseDescriptor.ptr != 0)
+        ReportTableWrite(ResTrack_Tables::GetHeapByGpuHandleGR(BaseDescriptor.ptr), BaseDescriptor.ptr);
+
     // Consistent early exit - always call original function
     auto shouldTrack = !Config::Instance()->FGHudfixDisableSGR.value_or_default() && BaseDescriptor.ptr != 0 &&
                        IsHudFixActive() && !Hudfix_Dx12::SkipHudlessChecks() &&
@@ -1167,7 +801,7 @@ void ResTrack_Dx12::hkSetGraphicsRootDescriptorTable(ID3D12GraphicsCommandList*
         return;
     }
 
-    auto heap = GetHeapByGpuHandleGR(BaseDescriptor.ptr);
+    auto heap = ResTrack_Tables::GetHeapByGpuHandleGR(BaseDescriptor.ptr);
     if (heap == nullptr)
     {
         LOG_DEBUG_ONLY("No heap for handle: {:X}", BaseDescriptor.ptr);
@@ -1198,47 +832,7 @@ void ResTrack_Dx12::hkSetGraphicsRootDescriptorTable(ID3D12GraphicsCommandList*
     }
 
     if (!capturedImmediately)
-    {
-        auto fIndex = Hudfix_Dx12::ActivePresentFrame() % BUFFER_COUNT;
-
-        if (!_useShards)
-        {
-            std::lock_guard<std::mutex> lock(_hudlessTrackMutex);
-
-            if (!fgPossibleHudless[fIndex].contains(This))
-            {
-                ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo> newMap;
-                newMap.reserve(32);
-                fgPossibleHudless[fIndex].insert_or_assign(This, std::move(newMap));
-            }
-
-            LOG_TRACK("Tracking Resource: {:X}, Desc: {:X}", (size_t) capturedBuffer->buffer, BaseDescriptor.ptr);
-            fgPossibleHudless[fIndex][This].insert_or_assign(capturedBuffer->buffer, *capturedBuffer);
-        }
-        else
-        {
-            size_t shardIdx = GetShardIndex(This);
-            auto& shard = _hudlessShards[fIndex][shardIdx];
-
-#ifdef USE_SPINLOCK_MUTEX
-            std::lock_guard<SpinLock> lock(shard.mutex);
-#else
-            std::lock_guard<std::mutex> lock(shard.mutex);
-#endif
-
-            if (!shard.map.contains(This))
-            {
-                ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo> newMap;
-                newMap.reserve(32);
-                shard.map.insert_or_assign(This, std::move(newMap));
-            }
-
-            LOG_TRACK("CmdList: {:X}, Tracking Resource: {:X}, Desc: {:X}, Format: {}", (size_t) This,
-                      (size_t) capturedBuffer->buffer, BaseDescriptor.ptr, (UINT) capturedBuffer->format);
-
-            shard.map[This].insert_or_assign(capturedBuffer->buffer, *capturedBuffer);
-        }
-    }
+        TrackPossibleHudless(This, capturedBuffer);
 
     o_SetGraphicsRootDescriptorTable(This, RootParameterIndex, BaseDescriptor);
 }
@@ -1252,6 +846,27 @@ void ResTrack_Dx12::hkOMSetRenderTargets(ID3D12GraphicsCommandList* This, UINT N
                                          BOOL RTsSingleHandleToDescriptorRange,
                                          D3D12_CPU_DESCRIPTOR_HANDLE* pDepthStencilDescriptor)
 {
+    if (ResTrack_Trace::IsRecording() && NumRenderTargetDescriptors > 0 && pRenderTargetDescriptors != nullptr)
+    {
+        UINT handleCount = RTsSingleHandleToDescriptorRange ? 1 : NumRenderTargetDescriptors;
+        uint64_t args[3 + D3D12_SIMULTANEOUS_RENDER_TARGET_COUNT] = { (uint64_t) This, NumRenderTargetDescriptors,
+                                                                      (uint64_t) RTsSingleHandleToDescriptorRange };
+
+        handleCount = (std::min)(handleCount, (UINT) D3D12_SIMULTANEOUS_RENDER_TARGET_COUNT);
+
+        for (UINT i = 0; i < handleCount; i++)
+            args[3 + i] = pRenderTargetDescriptors[i].ptr;
+
+        ResTrack_Trace::Record(TraceOp::OMSetRenderTargets, args, (uint16_t) (3 + handleCount));
+    }
+
+    // Copy planner needs writes after hudless capture too
+    if (FG_CopyPlanner::IsWatching() && pRenderTargetDescriptors != nullptr)
+    {
+        ReportRenderTargetWrites(NumRenderTargetDescriptors, pRenderTargetDescriptors,
+                                 RTsSingleHandleToDescriptorRange);
+    }
+
     // Consistent early exit validation
     auto shouldTrack = !Config::Instance()->FGHudfixDisableOM.value_or_default() && NumRenderTargetDescriptors > 0 &&
                        pRenderTargetDescriptors != nullptr && IsHudFixActive() && !Hudfix_Dx12::SkipHudlessChecks() &&
@@ -1266,9 +881,6 @@ void ResTrack_Dx12::hkOMSetRenderTargets(ID3D12GraphicsCommandList* This, UINT N
 
     LOG_DEBUG_ONLY("NumRenderTargetDescriptors: {}", NumRenderTargetDescriptors);
 
-    auto fIndex = Hudfix_Dx12::ActivePresentFrame() % BUFFER_COUNT;
-    bool anyResourceTracked = false;
-
     // Process render targets
     for (size_t i = 0; i < NumRenderTargetDescriptors; i++)
     {
@@ -1278,7 +890,7 @@ void ResTrack_Dx12::hkOMSetRenderTargets(ID3D12GraphicsCommandList* This, UINT N
         // Get the appropriate handle
         if (RTsSingleHandleToDescriptorRange)
         {
-            heap = GetHeapByCpuHandleRTV(pRenderTargetDescriptors[0].ptr);
+            heap = ResTrack_Tables::GetHeapByCpuHandleRTV(pRenderTargetDescriptors[0].ptr);
             if (heap == nullptr)
             {
                 LOG_DEBUG_ONLY("No heap at index: {}", i);
@@ -1290,7 +902,7 @@ void ResTrack_Dx12::hkOMSetRenderTargets(ID3D12GraphicsCommandList* This, UINT N
         else
         {
             handle = pRenderTargetDescriptors[i];
-            heap = GetHeapByCpuHandleRTV(handle.ptr);
+            heap = ResTrack_Tables::GetHeapByCpuHandleRTV(handle.ptr);
             if (heap == nullptr)
             {
                 LOG_DEBUG_ONLY("No heap at index: {}", i);
@@ -1309,58 +921,18 @@ void ResTrack_Dx12::hkOMSetRenderTargets(ID3D12GraphicsCommandList* This, UINT N
         capturedBuffer->state = D3D12_RESOURCE_STATE_RENDER_TARGET;
         capturedBuffer->captureInfo = CaptureInfo::OMSetRTV;
 
-        // Check for immediate capture
-        bool capturedImmediately = false;
-        if (Config::Instance()->FGImmediateCapture.value_or_default())
-        {
-            capturedImmediately = Hudfix_Dx12::CheckForHudless(This, capturedBuffer, capturedBuffer->state);
-            if (capturedImmediately)
-                break; // Early exit if captured
-        }
-
-        // Track for later processing
-        if (!capturedImmediately)
-        {
-            if (!_useShards)
-            {
-                std::lock_guard<std::mutex> lock(_hudlessTrackMutex);
-
-                if (!fgPossibleHudless[fIndex].contains(This))
-                {
-                    ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo> newMap;
-                    newMap.reserve(32);
-                    fgPossibleHudless[fIndex].insert_or_assign(This, std::move(newMap));
-                }
-
-                LOG_TRACK("Tracking Resource: {:X}, Desc: {:X}", (size_t) capturedBuffer->buffer, handle.ptr);
-                fgPossibleHudless[fIndex][This].insert_or_assign(capturedBuffer->buffer, *capturedBuffer);
-                anyResourceTracked = true;
-            }
-            else
-            {
-                size_t shardIdx = GetShardIndex(This);
-                auto& shard = _hudlessShards[fIndex][shardIdx];
-
-#ifdef USE_SPINLOCK_MUTEX
-                std::lock_guard<SpinLock> lock(shard.mutex);
-#else
-                std::lock_guard<std::mutex> lock(shard.mutex);
-#endif
-
-                if (!shard.map.contains(This))
-                {
-                    ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo> newMap;
-                    newMap.reserve(32);
-                    shard.map.insert_or_assign(This, std::move(newMap));
-                }
-
-                LOG_TRACK("CmdList: {:X}, Tracking Resource: {:X}, Desc: {:X}, Format: {}", (size_t) This,
-                          (size_t) capturedBuffer->buffer, handle.ptr, (UINT) capturedBuffer->format);
-
-                shard.map[This].insert_or_assign(capturedBuffer->buffer, *capturedBuffer);
-                anyResourceTracked = true;
-            }
+        // Check for immediate capture
+        bool capturedImmediately = false;
+        if (Config::Instance()->FGImmediateCapture.value_or_default())
+        {
+            capturedImmediately = Hudfix_Dx12::CheckForHudless(This, capturedBuffer, capturedBuffer->state);
+            if (capturedImmediately)
+                break; // Early exit if captured
         }
+
+        // Track for later processing
+        if (!capturedImmediately)
+            TrackPossibleHudless(This, capturedBuffer);
     }
 
     o_OMSetRenderTargets(This, NumRenderTargetDescriptors, pRenderTargetDescriptors, RTsSingleHandleToDescriptorRange,
@@ -1374,6 +946,16 @@ void ResTrack_Dx12::hkOMSetRenderTargets(ID3D12GraphicsCommandList* This, UINT N
 void ResTrack_Dx12::hkSetComputeRootDescriptorTable(ID3D12GraphicsCommandList* This, UINT RootParameterIndex,
                                                     D3D12_GPU_DESCRIPTOR_HANDLE BaseDescriptor)
 {
+    if (ResTrack_Trace::IsRecording())
+    {
+        ResTrack_Trace::Record(TraceOp::SetComputeRootTable,
+                               { (uint64_t) This, RootParameterIndex, BaseDescriptor.ptr });
+    }
+
+    // Copy planner needs writes after hudless capture too
+    if (FG_CopyPlanner::IsWatching() && BaseDescriptor.ptr != 0)
+        ReportTableWrite(ResTrack_Tables::GetHeapByGpuHandleCR(BaseDescriptor.ptr), BaseDescriptor.ptr);
+
     // Consistent early exit - always call original function
     auto shouldTrack = !Config::Instance()->FGHudfixDisableSCR.value_or_default() && BaseDescriptor.ptr != 0 &&
                        IsHudFixActive() && !Hudfix_Dx12::SkipHudlessChecks() &&
@@ -1385,7 +967,7 @@ void ResTrack_Dx12::hkSetComputeRootDescriptorTable(ID3D12GraphicsCommandList* T
         return;
     }
 
-    auto heap = GetHeapByGpuHandleCR(BaseDescriptor.ptr);
+    auto heap = ResTrack_Tables::GetHeapByGpuHandleCR(BaseDescriptor.ptr);
     if (heap == nullptr)
     {
         LOG_DEBUG_ONLY("No heap for handle: {:X}", BaseDescriptor.ptr);
@@ -1420,49 +1002,72 @@ void ResTrack_Dx12::hkSetComputeRootDescriptorTable(ID3D12GraphicsCommandList* T
     }
 
     if (!capturedImmediately)
-    {
-        auto fIndex = Hudfix_Dx12::ActivePresentFrame() % BUFFER_COUNT;
+        TrackPossibleHudless(This, capturedBuffer);
 
-        if (!_useShards)
-        {
-            std::lock_guard<std::mutex> lock(_hudlessTrackMutex);
+    o_SetComputeRootDescriptorTable(This, RootParameterIndex, BaseDescriptor);
+}
 
-            if (!fgPossibleHudless[fIndex].contains(This))
-            {
-                ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo> newMap;
-                newMap.reserve(32);
-                fgPossibleHudless[fIndex].insert_or_assign(This, std::move(newMap));
-            }
+#pragma endregion
 
-            LOG_TRACK("Tracking Resource: {:X}, Desc: {:X}", (size_t) capturedBuffer->buffer, BaseDescriptor.ptr);
-            fgPossibleHudless[fIndex][This].insert_or_assign(capturedBuffer->buffer, *capturedBuffer);
-        }
-        else
-        {
-            size_t shardIdx = GetShardIndex(This);
-            auto& shard = _hudlessShards[fIndex][shardIdx];
+#pragma region Write hooks
 
-#ifdef USE_SPINLOCK_MUTEX
-            std::lock_guard<SpinLock> lock(shard.mutex);
-#else
-            std::lock_guard<std::mutex> lock(shard.mutex);
-#endif
+// Only feed the copy planner, hudless candidates come from binds
 
-            if (!shard.map.contains(This))
-            {
-                ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo> newMap;
-                newMap.reserve(32);
-                shard.map.insert_or_assign(This, std::move(newMap));
-            }
+void ResTrack_Dx12::hkClearRenderTargetView(ID3D12GraphicsCommandList* This,
+                                            D3D12_CPU_DESCRIPTOR_HANDLE RenderTargetView, const FLOAT ColorRGBA[4],
+                                            UINT NumRects, const D3D12_RECT* pRects)
+{
+    if (FG_CopyPlanner::IsWatching())
+        ReportRenderTargetWrites(1, &RenderTargetView, FALSE);
 
-            LOG_TRACK("CmdList: {:X}, Tracking Resource: {:X}, Desc: {:X}, Format: {}", (size_t) This,
-                      (size_t) capturedBuffer->buffer, BaseDescriptor.ptr, (UINT) capturedBuffer->format);
+    o_ClearRenderTargetView(This, RenderTargetView, ColorRGBA, NumRects, pRects);
+}
 
-            shard.map[This].insert_or_assign(capturedBuffer->buffer, *capturedBuffer);
-        }
-    }
+void ResTrack_Dx12::hkClearUnorderedAccessViewUint(ID3D12GraphicsCommandList* This,
+                                                   D3D12_GPU_DESCRIPTOR_HANDLE ViewGPUHandleInCurrentHeap,
+                                                   D3D12_CPU_DESCRIPTOR_HANDLE ViewCPUHandle,
+                                                   ID3D12Resource* pResource, const UINT Values[4], UINT NumRects,
+                                                   const D3D12_RECT* pRects)
+{
+    FG_CopyPlanner::Written((uintptr_t) pResource);
+    o_ClearUnorderedAccessViewUint(This, ViewGPUHandleInCurrentHeap, ViewCPUHandle, pResource, Values, NumRects,
+                                   pRects);
+}
 
-    o_SetComputeRootDescriptorTable(This, RootParameterIndex, BaseDescriptor);
+void ResTrack_Dx12::hkClearUnorderedAccessViewFloat(ID3D12GraphicsCommandList* This,
+                                                    D3D12_GPU_DESCRIPTOR_HANDLE ViewGPUHandleInCurrentHeap,
+                                                    D3D12_CPU_DESCRIPTOR_HANDLE ViewCPUHandle,
+                                                    ID3D12Resource* pResource, const FLOAT Values[4], UINT NumRects,
+                                                    const D3D12_RECT* pRects)
+{
+    FG_CopyPlanner::Written((uintptr_t) pResource);
+    o_ClearUnorderedAccessViewFloat(This, ViewGPUHandleInCurrentHeap, ViewCPUHandle, pResource, Values, NumRects,
+                                    pRects);
+}
+
+void ResTrack_Dx12::hkCopyResource(ID3D12GraphicsCommandList* This, ID3D12Resource* pDstResource,
+                                   ID3D12Resource* pSrcResource)
+{
+    FG_CopyPlanner::Written((uintptr_t) pDstResource);
+    o_CopyResource(This, pDstResource, pSrcResource);
+}
+
+void ResTrack_Dx12::hkCopyTextureRegion(ID3D12GraphicsCommandList* This, const D3D12_TEXTURE_COPY_LOCATION* pDst,
+                                        UINT DstX, UINT DstY, UINT DstZ, const D3D12_TEXTURE_COPY_LOCATION* pSrc,
+                                        const D3D12_BOX* pSrcBox)
+{
+    if (pDst != nullptr)
+        FG_CopyPlanner::Written((uintptr_t) pDst->pResource);
+
+    o_CopyTextureRegion(This, pDst, DstX, DstY, DstZ, pSrc, pSrcBox);
+}
+
+void ResTrack_Dx12::hkResolveSubresource(ID3D12GraphicsCommandList* This, ID3D12Resource* pDstResource,
+                                         UINT DstSubresource, ID3D12Resource* pSrcResource, UINT SrcSubresource,
+                                         DXGI_FORMAT Format)
+{
+    FG_CopyPlanner::Written((uintptr_t) pDstResource);
+    o_ResolveSubresource(This, pDstResource, DstSubresource, pSrcResource, SrcSubresource, Format);
 }
 
 #pragma endregion
@@ -1475,6 +1080,9 @@ void ResTrack_Dx12::hkDrawInstanced(ID3D12GraphicsCommandList* This, UINT Vertex
 {
     o_DrawInstanced(This, VertexCountPerInstance, InstanceCount, StartVertexLocation, StartInstanceLocation);
 
+    if (ResTrack_Trace::IsRecording())
+        ResTrack_Trace::Record(TraceOp::DrawInstanced, { (uint64_t) This });
+
     if (!IsHudFixActive())
     {
         LOG_TRACK("Skipping {:X}", (size_t) This);
@@ -1483,112 +1091,22 @@ void ResTrack_Dx12::hkDrawInstanced(ID3D12GraphicsCommandList* This, UINT Vertex
 
     LOG_TRACK("CmdList: {:X}", (size_t) This);
 
-    auto fIndex = Hudfix_Dx12::ActivePresentFrame() % BUFFER_COUNT;
-
-    if (!_useShards)
-    {
-        if (This == MenuOverlayDx::MenuCommandList())
-        {
-            std::lock_guard<std::mutex> lock(_hudlessTrackMutex);
-            fgPossibleHudless[fIndex].erase(This);
-            return;
-        }
-
-        if (fgPossibleHudless[fIndex].size() == 0)
-            return;
-
-        ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo> val0;
-        {
-            std::lock_guard<std::mutex> lock(_hudlessTrackMutex);
-
-            if (!fgPossibleHudless[fIndex].contains(This))
-                return;
-
-            val0 = std::move(fgPossibleHudless[fIndex][This]);
-            fgPossibleHudless[fIndex].erase(This);
-        }
-
-        do
-        {
-            // if this command list does not have entries skip
-            if (val0.size() == 0)
-                break;
-
-            if (Config::Instance()->FGHudfixDisableDI.value_or_default())
-                break;
-
-            for (auto& [key, val] : val0)
-            {
-                std::lock_guard<std::mutex> lock(_drawMutex);
+    ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo> val0;
 
-                val.captureInfo |= CaptureInfo::DrawInstanced;
+    if (!TakePossibleHudless(This, val0))
+        return;
 
-                if (Hudfix_Dx12::CheckForHudless(This, &val, val.state))
-                    break;
-            }
+    if (Config::Instance()->FGHudfixDisableDI.value_or_default())
+        return;
 
-        } while (false);
-    }
-    else
+    for (auto& [key, val] : val0)
     {
-        size_t shardIdx = GetShardIndex(This);
-        auto& shard = _hudlessShards[fIndex][shardIdx];
-
-        if (This == MenuOverlayDx::MenuCommandList() && shard.map.contains(This))
-        {
-#ifdef USE_SPINLOCK_MUTEX
-            std::lock_guard<SpinLock> lock(shard.mutex);
-#else
-            std::lock_guard<std::mutex> lock(shard.mutex);
-#endif
-
-            shard.map.erase(This);
-            return;
-        }
-
-        // if can't find output skip
-        if (shard.map.size() == 0)
-        {
-            LOG_DEBUG_ONLY("Early exit");
-            return;
-        }
-
-        ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo> val0;
-        {
-
-#ifdef USE_SPINLOCK_MUTEX
-            std::lock_guard<SpinLock> lock(shard.mutex);
-#else
-            std::lock_guard<std::mutex> lock(shard.mutex);
-#endif
-
-            if (!shard.map.contains(This))
-                return;
-
-            val0 = std::move(shard.map[This]);
-            shard.map.erase(This);
-        }
-
-        do
-        {
-            // if this command list does not have entries skip
-            if (val0.size() == 0)
-                break;
+        std::lock_guard<std::mutex> lock(_drawMutex);
 
-            if (Config::Instance()->FGHudfixDisableDI.value_or_default())
-                break;
-
-            for (auto& [key, val] : val0)
-            {
-                std::lock_guard<std::mutex> lock(_drawMutex);
-
-                val.captureInfo |= CaptureInfo::DrawInstanced;
+        val.captureInfo |= CaptureInfo::DrawInstanced;
 
-                if (Hudfix_Dx12::CheckForHudless(This, &val, val.state))
-                    break;
-            }
-
-        } while (false);
+        if (Hudfix_Dx12::CheckForHudless(This, &val, val.state))
+            break;
     }
 }
 
@@ -1599,6 +1117,9 @@ void ResTrack_Dx12::hkDrawIndexedInstanced(ID3D12GraphicsCommandList* This, UINT
     o_DrawIndexedInstanced(This, IndexCountPerInstance, InstanceCount, StartIndexLocation, BaseVertexLocation,
                            StartInstanceLocation);
 
+    if (ResTrack_Trace::IsRecording())
+        ResTrack_Trace::Record(TraceOp::DrawIndexedInstanced, { (uint64_t) This });
+
     if (!IsHudFixActive())
     {
         LOG_TRACK("Skipping CmdList: {:X}", (size_t) This);
@@ -1607,114 +1128,22 @@ void ResTrack_Dx12::hkDrawIndexedInstanced(ID3D12GraphicsCommandList* This, UINT
 
     LOG_TRACK("CmdList: {:X}", (size_t) This);
 
-    auto fIndex = Hudfix_Dx12::ActivePresentFrame() % BUFFER_COUNT;
-
-    if (!_useShards)
-    {
-        if (This == MenuOverlayDx::MenuCommandList())
-        {
-            std::lock_guard<std::mutex> lock(_hudlessTrackMutex);
-            fgPossibleHudless[fIndex].erase(This);
-            return;
-        }
-
-        if (fgPossibleHudless[fIndex].size() == 0)
-            return;
-
-        ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo> val0;
-        {
-            std::lock_guard<std::mutex> lock(_hudlessTrackMutex);
-
-            if (!fgPossibleHudless[fIndex].contains(This))
-                return;
-
-            val0 = std::move(fgPossibleHudless[fIndex][This]);
-            fgPossibleHudless[fIndex].erase(This);
-        }
-
-        do
-        {
-            // if this command list does not have entries skip
-            if (val0.size() == 0)
-                break;
-
-            if (Config::Instance()->FGHudfixDisableDII.value_or_default())
-                break;
+    ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo> val0;
 
-            for (auto& [key, val] : val0)
-            {
-                // LOG_DEBUG("Waiting _drawMutex {:X}", (size_t)val.buffer);
-                std::lock_guard<std::mutex> lock(_drawMutex);
-
-                val.captureInfo |= CaptureInfo::DrawIndexedInstanced;
+    if (!TakePossibleHudless(This, val0))
+        return;
 
-                if (Hudfix_Dx12::CheckForHudless(This, &val, val.state))
-                    break;
-            }
+    if (Config::Instance()->FGHudfixDisableDII.value_or_default())
+        return;
 
-        } while (false);
-    }
-    else
+    for (auto& [key, val] : val0)
     {
-        size_t shardIdx = GetShardIndex(This);
-        auto& shard = _hudlessShards[fIndex][shardIdx];
-
-        if (This == MenuOverlayDx::MenuCommandList() && shard.map.contains(This))
-        {
-#ifdef USE_SPINLOCK_MUTEX
-            std::lock_guard<SpinLock> lock(shard.mutex);
-#else
-            std::lock_guard<std::mutex> lock(shard.mutex);
-#endif
-
-            shard.map.erase(This);
-            return;
-        }
-
-        // if can't find output skip
-        if (shard.map.size() == 0)
-        {
-            LOG_DEBUG_ONLY("Early exit");
-            return;
-        }
-
-        ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo> val0;
-        {
-
-#ifdef USE_SPINLOCK_MUTEX
-            std::lock_guard<SpinLock> lock(shard.mutex);
-#else
-            std::lock_guard<std::mutex> lock(shard.mutex);
-#endif
-
-            if (!shard.map.contains(This))
-                return;
-
-            val0 = std::move(shard.map[This]);
-            shard.map.erase(This);
-        }
-
-        do
-        {
-            // if this command list does not have entries skip
-            if (val0.size() == 0)
-                break;
-
-            if (Config::Instance()->FGHudfixDisableDII.value_or_default())
-                break;
+        std::lock_guard<std::mutex> lock(_drawMutex);
 
-            for (auto& [key, val] : val0)
-            {
-                // LOG_DEBUG("Waiting _drawMutex {:X}", (size_t)val.buffer);
-                std::lock_guard<std::mutex> lock(_drawMutex);
-
-                val.captureInfo |= CaptureInfo::DrawIndexedInstanced;
-
-                if (Hudfix_Dx12::CheckForHudless(This, &val, val.state))
-                    break;
-            }
+        val.captureInfo |= CaptureInfo::DrawIndexedInstanced;
 
-        } while (false);
+        if (Hudfix_Dx12::CheckForHudless(This, &val, val.state))
+            break;
     }
 }
 
@@ -1796,6 +1225,9 @@ void ResTrack_Dx12::hkDispatch(ID3D12GraphicsCommandList* This, UINT ThreadGroup
 {
     o_Dispatch(This, ThreadGroupCountX, ThreadGroupCountY, ThreadGroupCountZ);
 
+    if (ResTrack_Trace::IsRecording())
+        ResTrack_Trace::Record(TraceOp::Dispatch, { (uint64_t) This });
+
     if (!IsHudFixActive())
     {
         LOG_TRACK("Skipping {:X}", (size_t) This);
@@ -1804,114 +1236,22 @@ void ResTrack_Dx12::hkDispatch(ID3D12GraphicsCommandList* This, UINT ThreadGroup
 
     LOG_TRACK("CmdList: {:X}", (size_t) This);
 
-    auto fIndex = Hudfix_Dx12::ActivePresentFrame() % BUFFER_COUNT;
-
-    if (!_useShards)
-    {
-        if (This == MenuOverlayDx::MenuCommandList())
-        {
-            std::lock_guard<std::mutex> lock(_hudlessTrackMutex);
-            fgPossibleHudless[fIndex].erase(This);
-            return;
-        }
-
-        if (fgPossibleHudless[fIndex].size() == 0)
-            return;
-
-        ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo> val0;
-        {
-            std::lock_guard<std::mutex> lock(_hudlessTrackMutex);
-
-            if (!fgPossibleHudless[fIndex].contains(This))
-                return;
-
-            val0 = std::move(fgPossibleHudless[fIndex][This]);
-            fgPossibleHudless[fIndex].erase(This);
-        }
-
-        do
-        {
-            // if this command list does not have entries skip
-            if (val0.size() == 0)
-                break;
+    ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo> val0;
 
-            if (Config::Instance()->FGHudfixDisableDispatch.value_or_default())
-                break;
+    if (!TakePossibleHudless(This, val0))
+        return;
 
-            for (auto& [key, val] : val0)
-            {
-                // LOG_DEBUG("Waiting _drawMutex {:X}", (size_t)val.buffer);
-                std::lock_guard<std::mutex> lock(_drawMutex);
+    if (Config::Instance()->FGHudfixDisableDispatch.value_or_default())
+        return;
 
-                val.captureInfo |= CaptureInfo::Dispatch;
-                if (Hudfix_Dx12::CheckForHudless(This, &val, val.state))
-                {
-                    break;
-                }
-            }
-        } while (false);
-    }
-    else
+    for (auto& [key, val] : val0)
     {
-        size_t shardIdx = GetShardIndex(This);
-        auto& shard = _hudlessShards[fIndex][shardIdx];
-
-        if (This == MenuOverlayDx::MenuCommandList() && shard.map.contains(This))
-        {
-#ifdef USE_SPINLOCK_MUTEX
-            std::lock_guard<SpinLock> lock(shard.mutex);
-#else
-            std::lock_guard<std::mutex> lock(shard.mutex);
-#endif
-
-            shard.map.erase(This);
-            return;
-        }
-
-        // if can't find output skip
-        if (shard.map.size() == 0)
-        {
-            LOG_DEBUG_ONLY("Early exit");
-            return;
-        }
-
-        ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo> val0;
-        {
-
-#ifdef USE_SPINLOCK_MUTEX
-            std::lock_guard<SpinLock> lock(shard.mutex);
-#else
-            std::lock_guard<std::mutex> lock(shard.mutex);
-#endif
-
-            if (!shard.map.contains(This))
-                return;
-
-            val0 = std::move(shard.map[This]);
-            shard.map.erase(This);
-        }
+        std::lock_guard<std::mutex> lock(_drawMutex);
 
-        do
-        {
-            // if this command list does not have entries skip
-            if (val0.size() == 0)
-                break;
-
-            if (Config::Instance()->FGHudfixDisableDispatch.value_or_default())
-                break;
-
-            for (auto& [key, val] : val0)
-            {
-                // LOG_DEBUG("Waiting _drawMutex {:X}", (size_t)val.buffer);
-                std::lock_guard<std::mutex> lock(_drawMutex);
+        val.captureInfo |= CaptureInfo::Dispatch;
 
-                val.captureInfo |= CaptureInfo::Dispatch;
-                if (Hudfix_Dx12::CheckForHudless(This, &val, val.state))
-                {
-                    break;
-                }
-            }
-        } while (false);
+        if (Hudfix_Dx12::CheckForHudless(This, &val, val.state))
+            break;
     }
 }
 
@@ -1985,6 +1325,14 @@ void ResTrack_Dx12::HookCommandList(ID3D12Device* InDevice)
 
             o_ExecuteBundle = (PFN_ExecuteBundle) pVTable[27];
 
+            // copy planner writes
+            o_CopyTextureRegion = (PFN_CopyTextureRegion) pVTable[16];
+            o_CopyResource = (PFN_CopyResource) pVTable[17];
+            o_ResolveSubresource = (PFN_ResolveSubresource) pVTable[19];
+            o_ClearRenderTargetView = (PFN_ClearRenderTargetView) pVTable[48];
+            o_ClearUnorderedAccessViewUint = (PFN_ClearUnorderedAccessViewUint) pVTable[49];
+            o_ClearUnorderedAccessViewFloat = (PFN_ClearUnorderedAccessViewFloat) pVTable[50];
+
             if (o_OMSetRenderTargets != nullptr)
             {
                 DetourTransactionBegin();
@@ -2010,6 +1358,26 @@ void ResTrack_Dx12::HookCommandList(ID3D12Device* InDevice)
 
                     if (o_Dispatch != nullptr)
                         DetourAttach(&(PVOID&) o_Dispatch, hkDispatch);
+
+                    if (o_CopyTextureRegion != nullptr)
+                        DetourAttach(&(PVOID&) o_CopyTextureRegion, hkCopyTextureRegion);
+
+                    if (o_CopyResource != nullptr)
+                        DetourAttach(&(PVOID&) o_CopyResource, hkCopyResource);
+
+                    if (o_ResolveSubresource != nullptr)
+                        DetourAttach(&(PVOID&) o_ResolveSubresource, hkResolveSubresource);
+
+                    if (o_ClearRenderTargetView != nullptr)
+                        DetourAttach(&(PVOID&) o_ClearRenderTargetView, hkClearRenderTargetView);
+
+                    if (o_ClearUnorderedAccessViewUint != nullptr)
+                        DetourAttach(&(PVOID&) o_ClearUnorderedAccessViewUint, hkClearUnorderedAccessViewUint);
+
+                    if (o_ClearUnorderedAccessViewFloat != nullptr)
+                        DetourAttach(&(PVOID&) o_ClearUnorderedAccessViewFloat, hkClearUnorderedAccessViewFloat);
+
+                    _writeHooksAttached = true;
                 }
 
                 if (o_Close != nullptr)
@@ -2063,6 +1431,8 @@ void ResTrack_Dx12::HookToQueue(ID3D12Device* InDevice)
 
         DetourTransactionCommit();
 
+        DescriptorRing_Dx12::SetExecuteHooked(o_ExecuteCommandLists != nullptr);
+
         queue->Release();
     }
 }
@@ -2075,12 +1445,7 @@ void ResTrack_Dx12::HookDevice(ID3D12Device* device)
     if (device == nullptr)
         return;
 
-    if (fgHeaps.capacity() < 65536)
-    {
-        _useShards = Config::Instance()->FGUseShards.value_or_default();
-        _trackedResources.reserve(1024);
-        fgHeaps.reserve(65536);
-    }
+    ResTrack_Tables::Init(Config::Instance()->FGUseShards.value_or_default());
 
     LOG_FUNC();
 
@@ -2184,6 +1549,24 @@ void ResTrack_Dx12::ReleaseDeviceHooks()
     if (o_Dispatch != nullptr)
         DetourDetach(&(PVOID&) o_Dispatch, hkDispatch);
 
+    if (o_CopyTextureRegion != nullptr)
+        DetourDetach(&(PVOID&) o_CopyTextureRegion, hkCopyTextureRegion);
+
+    if (o_CopyResource != nullptr)
+        DetourDetach(&(PVOID&) o_CopyResource, hkCopyResource);
+
+    if (o_ResolveSubresource != nullptr)
+        DetourDetach(&(PVOID&) o_ResolveSubresource, hkResolveSubresource);
+
+    if (o_ClearRenderTargetView != nullptr)
+        DetourDetach(&(PVOID&) o_ClearRenderTargetView, hkClearRenderTargetView);
+
+    if (o_ClearUnorderedAccessViewUint != nullptr)
+        DetourDetach(&(PVOID&) o_ClearUnorderedAccessViewUint, hkClearUnorderedAccessViewUint);
+
+    if (o_ClearUnorderedAccessViewFloat != nullptr)
+        DetourDetach(&(PVOID&) o_ClearUnorderedAccessViewFloat, hkClearUnorderedAccessViewFloat);
+
     if (o_Close != nullptr)
         DetourDetach(&(PVOID&) o_Close, hkClose);
 
@@ -2206,6 +1589,7 @@ void ResTrack_Dx12::ReleaseDeviceHooks()
 
     // Queue
     o_ExecuteCommandLists = nullptr;
+    DescriptorRing_Dx12::SetExecuteHooked(false);
 
     // CommandList
     o_OMSetRenderTargets = nullptr;
@@ -2214,6 +1598,13 @@ void ResTrack_Dx12::ReleaseDeviceHooks()
     o_DrawIndexedInstanced = nullptr;
     o_DrawInstanced = nullptr;
     o_Dispatch = nullptr;
+    o_CopyTextureRegion = nullptr;
+    o_CopyResource = nullptr;
+    o_ResolveSubresource = nullptr;
+    o_ClearRenderTargetView = nullptr;
+    o_ClearUnorderedAccessViewUint = nullptr;
+    o_ClearUnorderedAccessViewFloat = nullptr;
+    _writeHooksAttached = false;
     o_Close = nullptr;
     o_ExecuteBundle = nullptr;
 
@@ -2281,6 +1672,24 @@ void ResTrack_Dx12::ReleaseHooks()
     if (o_Dispatch != nullptr)
         DetourDetach(&(PVOID&) o_Dispatch, hkDispatch);
 
+    if (o_CopyTextureRegion != nullptr)
+        DetourDetach(&(PVOID&) o_CopyTextureRegion, hkCopyTextureRegion);
+
+    if (o_CopyResource != nullptr)
+        DetourDetach(&(PVOID&) o_CopyResource, hkCopyResource);
+
+    if (o_ResolveSubresource != nullptr)
+        DetourDetach(&(PVOID&) o_ResolveSubresource, hkResolveSubresource);
+
+    if (o_ClearRenderTargetView != nullptr)
+        DetourDetach(&(PVOID&) o_ClearRenderTargetView, hkClearRenderTargetView);
+
+    if (o_ClearUnorderedAccessViewUint != nullptr)
+        DetourDetach(&(PVOID&) o_ClearUnorderedAccessViewUint, hkClearUnorderedAccessViewUint);
+
+    if (o_ClearUnorderedAccessViewFloat != nullptr)
+        DetourDetach(&(PVOID&) o_ClearUnorderedAccessViewFloat, hkClearUnorderedAccessViewFloat);
+
     if (o_Close != nullptr)
         DetourDetach(&(PVOID&) o_Close, hkClose);
 
@@ -2293,6 +1702,13 @@ void ResTrack_Dx12::ReleaseHooks()
     o_DrawIndexedInstanced = nullptr;
     o_DrawInstanced = nullptr;
     o_Dispatch = nullptr;
+    o_CopyTextureRegion = nullptr;
+    o_CopyResource = nullptr;
+    o_ResolveSubresource = nullptr;
+    o_ClearRenderTargetView = nullptr;
+    o_ClearUnorderedAccessViewUint = nullptr;
+    o_ClearUnorderedAccessViewFloat = nullptr;
+    _writeHooksAttached = false;
     o_Close = nullptr;
     o_ExecuteBundle = nullptr;
 
@@ -2303,28 +1719,9 @@ void ResTrack_Dx12::ClearPossibleHudless()
 {
     LOG_DEBUG("");
 
-    auto hfIndex = Hudfix_Dx12::ActivePresentFrame() % BUFFER_COUNT;
-
-    if (!_useShards)
-    {
-        std::lock_guard<std::mutex> lock(_hudlessTrackMutex);
-        fgPossibleHudless[hfIndex].clear();
-    }
-    else
-    {
-        for (size_t i = 0; i < SHARD_COUNT; i++)
-        {
-            auto& shard = _hudlessShards[hfIndex][i];
-
-#ifdef USE_SPINLOCK_MUTEX
-            std::lock_guard<SpinLock> lock(shard.mutex);
-#else
-            std::lock_guard<std::mutex> lock(shard.mutex);
-#endif
+    ResTrack_Trace::FrameDone(Hudfix_Dx12::ActivePresentFrame());
 
-            shard.map.clear();
-        }
-    }
+    ResTrack_Tables::ClearPossibleHudless(Hudfix_Dx12::ActivePresentFrame() % BUFFER_COUNT);
 
     std::lock_guard<std::mutex> lock2(_resourceCommandListMutex);
 
@@ -2369,3 +1766,11 @@ void ResTrack_Dx12::SetResourceCmdList(FG_ResourceType type, ID3D12GraphicsComma
         LOG_DEBUG("_resourceCommandList[{}][{}]: {:X}", index, magic_enum::enum_name(type), (size_t) realCmdList);
     }
 }
+
+bool ResTrack_Dx12::IsWriteTrackingActive()
+{
+    // Write reporting doesn't depend on hudfix state, only on the hooks and the view tables
+    return _writeHooksAttached && !State::Instance().isShuttingDown &&
+           !Config::Instance()->FGHudfixDisableRTV.value_or_default() &&
+           !Config::Instance()->FGHudfixDisableUAV.value_or_default();
+}
@@ -2,347 +2,22 @@
 
 #include "SysUtils.h"
 
+#include "ResTrack_Trace.h"
+#include "ResTrack_Tables.h"
+
 #include <hudfix/Hudfix_Dx12.h>
 #include <framegen/IFGFeature_Dx12.h>
 
 #include <ankerl/unordered_dense.h>
 
-#include <new>
 #include <mutex>
-#include <atomic>
 #include <shared_mutex>
 
-// #define DEBUG_TRACKING
-
-#ifdef DEBUG_TRACKING
-static void TestResource(ResourceInfo* info)
-{
-    if (info == nullptr || info->buffer == nullptr)
-        return;
-
-    auto desc = info->buffer->GetDesc();
-
-    if (desc.Width != info->width || desc.Height != info->height || desc.Format != info->format)
-    {
-        LOG_TRACK("Resource mismatch: {:X}, info: {:X}", (size_t) info->buffer, (size_t) info);
-
-        // LOG_WARN("Resource mismatch: {:X}, info: {:X}", (size_t) info->buffer, (size_t) info);
-        //__debugbreak();
-    }
-}
-#endif
-
-#define USE_SPINLOCK_MUTEX
-
-#ifdef USE_SPINLOCK_MUTEX
-
-// #define USE_PERF_SPINLOCK
-
-#ifdef __cpp_lib_hardware_interference_size
-constexpr size_t CACHE_LINE_SIZE = std::hardware_destructive_interference_size;
-#else
-constexpr size_t CACHE_LINE_SIZE = 64;
-#endif
-#else
-#ifdef __cpp_lib_hardware_interference_size
-constexpr size_t CACHE_LINE_SIZE = std::hardware_destructive_interference_size * 2;
-#else
-constexpr size_t CACHE_LINE_SIZE = 128;
-#endif
-#endif
-
-#ifdef USE_SPINLOCK_MUTEX
-#ifdef USE_PERF_SPINLOCK
-class SpinLock
-{
-    std::atomic<bool> _lock = { false };
-
-  public:
-    void lock()
-    {
-        int backoff = 1;
-
-        while (true)
-        {
-            // 1. Optimistic Read (TTAS)
-            // Using 'relaxed' because we don't need ordering until we actually acquire.
-            if (!_lock.load(std::memory_order_relaxed))
-            {
-
-                // 2. Attempt Acquire
-                // 'acquire' ensures no memory ops move before this lock
-                if (!_lock.exchange(true, std::memory_order_acquire))
-                {
-                    return; // Success
-                }
-            }
-
-            // 3. Pause instruction to help HT and branch prediction
-            _mm_pause();
-        }
-    }
-
-    void unlock()
-    {
-        // 'release' ensures all memory ops are finished before unlocking
-        _lock.store(false, std::memory_order_release);
-    }
-};
-#else
-struct SpinLock
-{
-    std::atomic<bool> _lock = { false };
-
-    __forceinline void lock()
-    {
-        // Fast path: try to grab immediately
-        if (!_lock.exchange(true, std::memory_order_acquire))
-            return;
-
-        int backoff = 1;
-        while (true)
-        {
-            while (_lock.load(std::memory_order_relaxed))
-            {
-                for (int i = 0; i < backoff; ++i)
-                    _mm_pause();
-
-                backoff = std::min(backoff * 2, 64);
-            }
-
-            if (!_lock.exchange(true, std::memory_order_acquire))
-                return;
-        }
-    }
-
-    __forceinline void unlock() { _lock.store(false, std::memory_order_release); }
-};
-#endif
-#endif
-
-static ankerl::unordered_dense::map<ID3D12Resource*, std::vector<ResourceInfo*>> _trackedResources;
-#ifdef USE_SPINLOCK_MUTEX
-static SpinLock _trackedResourcesMutex;
-#else
-static std::mutex _trackedResourcesMutex;
-#endif
-
-struct HeapInfo
-{
-    // mutable std::shared_mutex mutex;
-
-    ID3D12DescriptorHeap* heap = nullptr;
-    SIZE_T cpuStart = NULL;
-    SIZE_T cpuEnd = NULL;
-    SIZE_T gpuStart = NULL;
-    SIZE_T gpuEnd = NULL;
-    UINT numDescriptors = 0;
-    UINT increment = 0;
-    UINT type = 0;
-    std::shared_ptr<ResourceInfo[]> info;
-    UINT lastOffset = 0;
-    bool active = true;
-    std::atomic<uint64_t> version { 0 };
-
-    HeapInfo(ID3D12DescriptorHeap* heap, SIZE_T cpuStart, SIZE_T cpuEnd, SIZE_T gpuStart, SIZE_T gpuEnd,
-             UINT numResources, UINT increment, UINT type)
-        : cpuStart(cpuStart), cpuEnd(cpuEnd), gpuStart(gpuStart), gpuEnd(gpuEnd), numDescriptors(numResources),
-          increment(increment), info(new ResourceInfo[numResources]), type(type), heap(heap)
-    {
-        static std::atomic<uint64_t> globalHeapVersion { 1 };
-        version.store(globalHeapVersion.fetch_add(1, std::memory_order_relaxed), std::memory_order_relaxed);
-
-        for (size_t i = 0; i < numDescriptors; i++)
-        {
-            info[i].buffer = nullptr;
-        }
-    }
-
-    void DetachFromOldResource(SIZE_T index) const
-    {
-        if (info[index].buffer == nullptr)
-            return;
-
-        std::scoped_lock lock(_trackedResourcesMutex);
-        LOG_TRACK("Heap: {:X}, Index: {}, Resource: {:X}, Res: {}x{}, Format: {}", (size_t) this, index,
-                  (size_t) info[index].buffer, info[index].width, info[index].height, (UINT) info[index].format);
-        auto it = _trackedResources.find(info[index].buffer);
-        if (it != _trackedResources.end())
-        {
-            auto& vec = it->second;
-            vec.erase(std::remove(vec.begin(), vec.end(), &info[index]), vec.end());
-            if (vec.empty())
-                _trackedResources.erase(it);
-        }
-    }
-
-    void AttachToNewResource(SIZE_T index) const
-    {
-        std::scoped_lock lock(_trackedResourcesMutex);
-        LOG_TRACK("Heap: {:X}, Index: {}, Resource: {:X}, Res: {}x{}, Format: {}", (size_t) this, index,
-                  (size_t) info[index].buffer, info[index].width, info[index].height, (UINT) info[index].format);
-        auto& vec = _trackedResources[info[index].buffer];
-        if (std::find(vec.begin(), vec.end(), &info[index]) == vec.end())
-            vec.push_back(&info[index]);
-    }
-
-    ResourceInfo* GetByCpuHandle(SIZE_T cpuHandle) const
-    {
-        auto index = (cpuHandle - cpuStart) / increment;
-
-        if (index >= numDescriptors)
-            return nullptr;
-
-        // std::shared_lock<std::shared_mutex> lock(mutex);
-
-        if (info[index].buffer == nullptr)
-            return nullptr;
-
-#ifdef DEBUG_TRACKING
-        TestResource(&info[index]);
-#endif
-
-        return &info[index];
-    }
-
-    ResourceInfo* GetByGpuHandle(SIZE_T gpuHandle) const
-    {
-        auto index = (gpuHandle - gpuStart) / increment;
-
-        if (index >= numDescriptors)
-            return nullptr;
-
-        // std::shared_lock<std::shared_mutex> lock(mutex);
-
-        if (info[index].buffer == nullptr)
-            return nullptr;
-
-#ifdef DEBUG_TRACKING
-        TestResource(&info[index]);
-#endif
-
-        return &info[index];
-    }
-
-    void SetByCpuHandle(SIZE_T cpuHandle, ResourceInfo setInfo) const
-    {
-        auto index = (cpuHandle - cpuStart) / increment;
-
-        if (index >= numDescriptors)
-            return;
-
-        // std::unique_lock<std::shared_mutex> lock(mutex);
-
-#ifdef DEBUG_TRACKING
-        TestResource(&setInfo);
-#endif
-        if (info[index].buffer != setInfo.buffer)
-        {
-            DetachFromOldResource(index);
-            info[index] = setInfo;
-            AttachToNewResource(index);
-        }
-    }
-
-    void SetByGpuHandle(SIZE_T gpuHandle, ResourceInfo setInfo) const
-    {
-        auto index = (gpuHandle - gpuStart) / increment;
-
-        if (index >= numDescriptors)
-            return;
-
-        // std::unique_lock<std::shared_mutex> lock(mutex);
-
-#ifdef DEBUG_TRACKING
-        TestResource(&setInfo);
-#endif
-
-        if (info[index].buffer != setInfo.buffer)
-        {
-            DetachFromOldResource(index);
-            info[index] = setInfo;
-            AttachToNewResource(index);
-        }
-    }
-
-    void ClearByCpuHandle(SIZE_T cpuHandle) const
-    {
-        auto index = (cpuHandle - cpuStart) / increment;
-
-        if (index >= numDescriptors)
-            return;
-
-        // std::unique_lock<std::shared_mutex> lock(mutex);
-
-        if (info[index].buffer != nullptr)
-        {
-            LOG_TRACK("Resource: {:X}, Res: {}x{}, Format: {}", (size_t) info[index].buffer, info[index].width,
-                      info[index].height, (UINT) info[index].format);
-
-            DetachFromOldResource(index);
-        }
-
-        info[index].buffer = nullptr;
-        info[index].lastUsedFrame = 0;
-    }
-
-    void ClearByGpuHandle(SIZE_T gpuHandle) const
-    {
-        auto index = (gpuHandle - gpuStart) / increment;
-
-        if (index >= numDescriptors)
-            return;
-
-        // std::unique_lock<std::shared_mutex> lock(mutex);
-
-        if (info[index].buffer != nullptr)
-        {
-            LOG_TRACK("Resource: {:X}, Res: {}x{}, Format: {}", (size_t) info[index].buffer, info[index].width,
-                      info[index].height, (UINT) info[index].format);
-
-            DetachFromOldResource(index);
-        }
-
-        info[index].buffer = nullptr;
-        info[index].lastUsedFrame = 0;
-    }
-};
-
-struct ResourceHeapInfo
-{
-    SIZE_T cpuStart = NULL;
-    SIZE_T gpuStart = NULL;
-};
-
-#ifdef USE_SPINLOCK_MUTEX
-// Force each struct to start on a new cache line
-struct alignas(CACHE_LINE_SIZE) CommandListShard
-{
-    SpinLock mutex;
-    ankerl::unordered_dense::map<ID3D12GraphicsCommandList*,
-                                 ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo>>
-        map;
-
-    char padding[CACHE_LINE_SIZE - (sizeof(SpinLock) + sizeof(void*) % CACHE_LINE_SIZE)] = {};
-};
-#else
-struct alignas(CACHE_LINE_SIZE) CommandListShard
-{
-    std::mutex mutex;
-    ankerl::unordered_dense::map<ID3D12GraphicsCommandList*,
-                                 ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo>>
-        map;
-
-    char padding[CACHE_LINE_SIZE - (sizeof(std::mutex) + sizeof(void*) % CACHE_LINE_SIZE)] = {};
-};
-#endif
-
 class ResTrack_Dx12
 {
   private:
     inline static bool _presentDone = true;
     inline static std::mutex _drawMutex;
-    inline static bool _useShards = false;
 
     inline static std::mutex _resourceCommandListMutex;
     inline static std::unordered_map<FG_ResourceType, ID3D12GraphicsCommandList*> _resourceCommandList[BUFFER_COUNT];
@@ -351,6 +26,8 @@ class ResTrack_Dx12
     inline static std::mutex _hudlessMutex;
     inline static void* _hudlessMutexQueue = nullptr;
 
+    inline static bool _writeHooksAttached = false;
+
     static bool IsHudFixActive();
 
     // static bool IsFGCommandList(IUnknown* cmdList);
@@ -385,6 +62,25 @@ class ResTrack_Dx12
 
     static HRESULT hkClose(ID3D12GraphicsCommandList* This);
 
+    static void hkClearRenderTargetView(ID3D12GraphicsCommandList* This, D3D12_CPU_DESCRIPTOR_HANDLE RenderTargetView,
+                                        const FLOAT ColorRGBA[4], UINT NumRects, const D3D12_RECT* pRects);
+    static void hkClearUnorderedAccessViewUint(ID3D12GraphicsCommandList* This,
+                                               D3D12_GPU_DESCRIPTOR_HANDLE ViewGPUHandleInCurrentHeap,
+                                               D3D12_CPU_DESCRIPTOR_HANDLE ViewCPUHandle, ID3D12Resource* pResource,
+                                               const UINT Values[4], UINT NumRects, const D3D12_RECT* pRects);
+    static void hkClearUnorderedAccessViewFloat(ID3D12GraphicsCommandList* This,
+                                                D3D12_GPU_DESCRIPTOR_HANDLE ViewGPUHandleInCurrentHeap,
+                                                D3D12_CPU_DESCRIPTOR_HANDLE ViewCPUHandle, ID3D12Resource* pResource,
+                                                const FLOAT Values[4], UINT NumRects, const D3D12_RECT* pRects);
+    static void hkCopyResource(ID3D12GraphicsCommandList* This, ID3D12Resource* pDstResource,
+                               ID3D12Resource* pSrcResource);
+    static void hkCopyTextureRegion(ID3D12GraphicsCommandList* This, const D3D12_TEXTURE_COPY_LOCATION* pDst,
+                                    UINT DstX, UINT DstY, UINT DstZ, const D3D12_TEXTURE_COPY_LOCATION* pSrc,
+                                    const D3D12_BOX* pSrcBox);
+    static void hkResolveSubresource(ID3D12GraphicsCommandList* This, ID3D12Resource* pDstResource,
+                                     UINT DstSubresource, ID3D12Resource* pSrcResource, UINT SrcSubresource,
+                                     DXGI_FORMAT Format);
+
     static void hkCreateRenderTargetView(ID3D12Device* This, ID3D12Resource* pResource,
                                          D3D12_RENDER_TARGET_VIEW_DESC* pDesc,
                                          D3D12_CPU_DESCRIPTOR_HANDLE DestDescriptor);
@@ -402,12 +98,12 @@ class ResTrack_Dx12
                                           REFIID riid, void** ppvHeap);
 
     static ULONG hkRelease(ID3D12Resource* This);
+    static ULONG hkHeapRelease(ID3D12DescriptorHeap* This);
 
     static void HookCommandList(ID3D12Device* InDevice);
-    static void HookToQueue(ID3D12Device* InDevice);
     static void HookResource(ID3D12Device* InDevice);
 
-    static bool CheckResource(ID3D12Resource* resource);
+    static bool CheckResource(const D3D12_RESOURCE_DESC& resDesc);
 
     static bool CheckForRealObject(const std::string functionName, IUnknown* pObject, IUnknown** ppRealObject);
 
@@ -417,33 +113,30 @@ class ResTrack_Dx12
     static void ResourceBarrier(ID3D12GraphicsCommandList* InCommandList, ID3D12Resource* InResource,
                                 D3D12_RESOURCE_STATES InBeforeState, D3D12_RESOURCE_STATES InAfterState);
 
-    static SIZE_T GetGPUHandle(ID3D12Device* This, SIZE_T cpuHandle, D3D12_DESCRIPTOR_HEAP_TYPE type);
-    static SIZE_T GetCPUHandle(ID3D12Device* This, SIZE_T gpuHandle, D3D12_DESCRIPTOR_HEAP_TYPE type);
+    // View creation hooks, records the view when tracing and skips GetDesc for invalid views
+    static void TrackCreatedView(HeapInfo* heap, SIZE_T cpuHandle, ID3D12Resource* resource, bool validView,
+                                 UINT viewDimension, TraceOp op, ResourceType type, CaptureInfo captureInfo);
 
-    static HeapInfo* GetHeapByCpuHandleCBV(SIZE_T cpuHandle);
-    static HeapInfo* GetHeapByCpuHandleRTV(SIZE_T cpuHandle);
-    static HeapInfo* GetHeapByCpuHandleSRV(SIZE_T cpuHandle);
-    static HeapInfo* GetHeapByCpuHandleUAV(SIZE_T cpuHandle);
-    static HeapInfo* GetHeapByCpuHandle(SIZE_T cpuHandle);
-    static HeapInfo* GetHeapByGpuHandleGR(SIZE_T gpuHandle);
-    static HeapInfo* GetHeapByGpuHandleCR(SIZE_T gpuHandle);
+    // Hudless candidates of current present frame, menu command list is never tracked
+    static void TrackPossibleHudless(ID3D12GraphicsCommandList* cmdList, ResourceInfo* resource);
+    static bool TakePossibleHudless(ID3D12GraphicsCommandList* cmdList,
+                                    ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo>& output);
 
-    static void FillResourceInfo(ID3D12Resource* resource, ResourceInfo* info);
-
-    // Sharding
-    inline static constexpr size_t SHARD_COUNT = 16;
-    inline static CommandListShard _hudlessShards[BUFFER_COUNT][SHARD_COUNT];
-
-    inline static size_t GetShardIndex(ID3D12GraphicsCommandList* ptr)
-    {
-        auto addr = (UINT64) ptr;
-        return (addr >> 4) % SHARD_COUNT;
-    }
+    // Copy planner write reporting, only views of tracked (swapchain sized) resources resolve
+    static void ReportRenderTargetWrites(UINT count, const D3D12_CPU_DESCRIPTOR_HANDLE* handles,
+                                         BOOL singleHandleToRange);
+    static void ReportTableWrite(HeapInfo* heap, SIZE_T gpuHandle);
 
   public:
     static void HookDevice(ID3D12Device* device);
+
+    // Only ExecuteCommandLists, it's passed through while resource tracking is not active
+    static void HookToQueue(ID3D12Device* InDevice);
     static void ReleaseHooks();
     static void ReleaseDeviceHooks();
     static void ClearPossibleHudless();
     static void SetResourceCmdList(FG_ResourceType type, ID3D12GraphicsCommandList* cmdList);
+
+    // True when write hooks are attached and views are tracked, so writes to FG inputs can be seen
+    static bool IsWriteTrackingActive();
 };
@@ -0,0 +1,347 @@
+#include "pch.h"
+#include "DescriptorRing_Dx12.h"
+
+#include <State.h>
+
+UINT64 DescriptorRing_Dx12::CompletedValue(void* fence) { return ((ID3D12Fence*) fence)->GetCompletedValue(); }
+
+bool DescriptorRing_Dx12::WaitForValue(void* fence, UINT64 value)
+{
+    auto d3dFence = (ID3D12Fence*) fence;
+
+    if (d3dFence->GetCompletedValue() >= value)
+        return true;
+
+    auto event = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+
+    if (event == nullptr)
+        return false;
+
+    // GPU is behind a whole ring, a longer wait means it's stuck on something else
+    auto waited =
+        d3dFence->SetEventOnCompletion(value, event) == S_OK && WaitForSingleObject(event, 500) == WAIT_OBJECT_0;
+
+    CloseHandle(event);
+    return waited;
+}
+
+// Caller must hold _mutex
+DescriptorRing_Dx12::DeviceRing* DescriptorRing_Dx12::GetRing(ID3D12Device* device)
+{
+    if (auto it = _rings.find(device); it != _rings.end())
+        return &it->second;
+
+    ScopedSkipHeapCapture skipHeapCapture {};
+
+    DeviceRing ring {};
+
+    D3D12_DESCRIPTOR_HEAP_DESC desc = {};
+    desc.NumDescriptors = DESCRIPTOR_RING_SIZE;
+    desc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
+    desc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
+
+    auto result = device->CreateDescriptorHeap(&desc, IID_PPV_ARGS(&ring.heap));
+
+    if (result != S_OK)
+    {
+        LOG_ERROR("CreateDescriptorHeap error: {:X}", (UINT) result);
+        return nullptr;
+    }
+
+    ring.heap->SetName(L"OptiScaler_DescriptorRing");
+    ring.descriptorSize = device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+
+    auto bufferDesc = CD3DX12_RESOURCE_DESC::Buffer(CONSTANT_RING_SIZE);
+    auto heapProps = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD);
+
+    result = device->CreateCommittedResource(&heapProps, D3D12_HEAP_FLAG_NONE, &bufferDesc,
+                                             D3D12_RESOURCE_STATE_GENERIC_READ, nullptr,
+                                             IID_PPV_ARGS(&ring.constantBuffer));
+
+    if (result == S_OK)
+    {
+        // Upload heap resources can stay mapped, GPU reads the latest CPU writes at execution
+        CD3DX12_RANGE readRange(0, 0);
+        result = ring.constantBuffer->Map(0, &readRange, reinterpret_cast<void**>(&ring.constantCPU));
+
+        if (result == S_OK && ring.constantCPU != nullptr)
+        {
+            ring.constantBuffer->SetName(L"OptiScaler_ConstantRing");
+            ring.constantGPU = ring.constantBuffer->GetGPUVirtualAddress();
+        }
+        else
+        {
+            LOG_ERROR("Constant ring Map error: {:X}", (UINT) result);
+            ring.constantBuffer->Release();
+            ring.constantBuffer = nullptr;
+            ring.constantCPU = nullptr;
+        }
+    }
+    else
+    {
+        LOG_ERROR("Constant ring CreateCommittedResource error: {:X}", (UINT) result);
+        ring.constantBuffer = nullptr;
+    }
+
+    LOG_INFO("Created descriptor ring for device: {:X}, size: {}, constant ring size: {}", (size_t) device,
+             DESCRIPTOR_RING_SIZE, CONSTANT_RING_SIZE);
+
+    return &_rings.emplace(device, std::move(ring)).first->second;
+}
+
+// Caller must hold _mutex
+void DescriptorRing_Dx12::ReleaseRing(ID3D12Device* device, DeviceRing& ring)
+{
+    // Wait for the last closed frames, passes of the device are gone so nothing records new allocations
+    for (auto& [queue, queueFence] : ring.fences)
+    {
+        if (queueFence.fence->GetCompletedValue() < queueFence.value)
+            queueFence.fence->SetEventOnCompletion(queueFence.value, nullptr);
+
+        queueFence.fence->Release();
+    }
+
+    ring.fences.clear();
+    ring.ranges.Clear();
+
+    if (ring.constantBuffer != nullptr)
+    {
+        ring.constantBuffer->Unmap(0, nullptr);
+        ring.constantBuffer->Release();
+        ring.constantBuffer = nullptr;
+        ring.constantCPU = nullptr;
+    }
+
+    if (ring.heap != nullptr)
+    {
+        ring.heap->Release();
+        ring.heap = nullptr;
+    }
+
+    LOG_INFO("Released descriptor ring for device: {:X}", (size_t) device);
+}
+
+void DescriptorRing_Dx12::AddUser(ID3D12Device* device)
+{
+    if (device == nullptr)
+        return;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _users[device]++;
+}
+
+void DescriptorRing_Dx12::RemoveUser(ID3D12Device* device)
+{
+    if (device == nullptr)
+        return;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto users = _users.find(device);
+
+    if (users == _users.end() || --users->second > 0)
+        return;
+
+    _users.erase(users);
+
+    auto it = _rings.find(device);
+
+    if (it == _rings.end())
+        return;
+
+    // Device might be already destroyed during process exit, objects are left to the runtime
+    if (!State::Instance().isShuttingDown)
+        ReleaseRing(device, it->second);
+
+    _rings.erase(it);
+}
+
+UINT64 DescriptorRing_Dx12::AllocateRange(DeviceRing& ring, RingRanges::RingType type, UINT64 count,
+                                          UINT64 alignment, const void* owner)
+{
+    auto offset = ring.ranges.Allocate(type, count, alignment, owner);
+
+    if (offset == RingRanges::InvalidOffset)
+    {
+        // Either GPU is too far behind or command lists are executed without the ring seeing it
+        ring.failedCount++;
+
+        if (ring.failedCount <= 16 || (ring.failedCount % 1000) == 0)
+        {
+            LOG_WARN("{} ring is full, skipping pass, open lists: {}, count: {}",
+                     type == RingRanges::Descriptors ? "Descriptor" : "Constant", ring.ranges.OpenCount(),
+                     ring.failedCount);
+        }
+
+        return offset;
+    }
+
+    _hasOpen.store(true, std::memory_order_relaxed);
+    return offset;
+}
+
+void DescriptorRing_Dx12::UpdateOpen()
+{
+    bool hasOpen = false;
+
+    for (auto& [device, ring] : _rings)
+        hasOpen |= ring.ranges.OpenCount() > 0;
+
+    _hasOpen.store(hasOpen, std::memory_order_relaxed);
+}
+
+RingDescriptorTable DescriptorRing_Dx12::Allocate(ID3D12Device* device, ID3D12GraphicsCommandList* cmdList,
+                                                  UINT numSrv, UINT numUav, UINT numCbv)
+{
+    RingDescriptorTable table {};
+    auto count = numSrv + numUav + numCbv;
+
+    if (device == nullptr || cmdList == nullptr || count == 0 || count > DESCRIPTOR_RING_SIZE)
+        return table;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto ring = GetRing(device);
+
+    if (ring == nullptr)
+        return table;
+
+    auto range = AllocateRange(*ring, RingRanges::Descriptors, count, 1, cmdList);
+
+    if (range == RingRanges::InvalidOffset)
+        return table;
+
+    auto offset = static_cast<INT>(range);
+
+    table._heap = ring->heap;
+    table._cpuStart =
+        CD3DX12_CPU_DESCRIPTOR_HANDLE(ring->heap->GetCPUDescriptorHandleForHeapStart(), offset, ring->descriptorSize);
+    table._gpuStart =
+        CD3DX12_GPU_DESCRIPTOR_HANDLE(ring->heap->GetGPUDescriptorHandleForHeapStart(), offset, ring->descriptorSize);
+    table._descriptorSize = ring->descriptorSize;
+    table._numSrv = numSrv;
+    table._numUav = numUav;
+    table._numCbv = numCbv;
+
+    return table;
+}
+
+bool DescriptorRing_Dx12::WriteConstants(ID3D12Device* device, ID3D12GraphicsCommandList* cmdList, const void* data,
+                                         UINT size, D3D12_CPU_DESCRIPTOR_HANDLE cbvHandle)
+{
+    // CBV size must be a multiple of 256 bytes too
+    auto blockSize = (size + D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT - 1) &
+                     ~(D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT - 1);
+
+    if (device == nullptr || cmdList == nullptr || data == nullptr || size == 0 || blockSize > CONSTANT_RING_SIZE)
+        return false;
+
+    BYTE* cpuAddress = nullptr;
+    D3D12_GPU_VIRTUAL_ADDRESS gpuAddress = 0;
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        auto ring = GetRing(device);
+
+        if (ring == nullptr || ring->constantCPU == nullptr)
+            return false;
+
+        auto offset = AllocateRange(*ring, RingRanges::Constants, blockSize,
+                                    D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT, cmdList);
+
+        if (offset == RingRanges::InvalidOffset)
+            return false;
+
+        cpuAddress = ring->constantCPU + offset;
+        gpuAddress = ring->constantGPU + offset;
+    }
+
+    memcpy(cpuAddress, data, size);
+
+    D3D12_CONSTANT_BUFFER_VIEW_DESC cbvDesc = {};
+    cbvDesc.BufferLocation = gpuAddress;
+    cbvDesc.SizeInBytes = blockSize;
+    device->CreateConstantBufferView(&cbvDesc, cbvHandle);
+
+    return true;
+}
+
+void DescriptorRing_Dx12::Bind(ID3D12GraphicsCommandList* cmdList, const RingDescriptorTable& table)
+{
+    auto sequence = ScopedDescriptorSequence::_current;
+
+    if (sequence != nullptr && sequence->_boundList == cmdList && sequence->_boundHeap == table._heap)
+        return;
+
+    ID3D12DescriptorHeap* heaps[] = { table._heap };
+    cmdList->SetDescriptorHeaps(_countof(heaps), heaps);
+
+    if (sequence != nullptr)
+    {
+        sequence->_boundList = cmdList;
+        sequence->_boundHeap = table._heap;
+    }
+}
+
+void DescriptorRing_Dx12::Executed(ID3D12CommandQueue* queue, UINT count, ID3D12CommandList* const* cmdLists)
+{
+    CloseLists(queue, count, cmdLists);
+}
+
+void DescriptorRing_Dx12::GameListSubmitted(ID3D12CommandQueue* queue, ID3D12CommandList* cmdList)
+{
+    if (!_executeHooked.load(std::memory_order_relaxed))
+        CloseLists(queue, 1, &cmdList);
+}
+
+void DescriptorRing_Dx12::CloseLists(ID3D12CommandQueue* queue, UINT count, ID3D12CommandList* const* cmdLists)
+{
+    if (queue == nullptr || cmdLists == nullptr || !_hasOpen.load(std::memory_order_relaxed))
+        return;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    // Lists of a queue belong to its device, ring which recorded them is the device's ring
+    for (auto& [device, ring] : _rings)
+    {
+        bool recorded = false;
+
+        for (UINT i = 0; i < count && !recorded; i++)
+            recorded = ring.ranges.IsOpen(cmdLists[i]);
+
+        if (!recorded)
+            continue;
+
+        auto& queueFence = ring.fences[queue];
+
+        if (queueFence.fence == nullptr)
+        {
+            auto result = device->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&queueFence.fence));
+
+            if (result != S_OK)
+            {
+                LOG_ERROR("CreateFence error: {:X}", (UINT) result);
+                ring.fences.erase(queue);
+                continue;
+            }
+        }
+
+        auto result = queue->Signal(queueFence.fence, queueFence.value + 1);
+
+        if (result != S_OK)
+        {
+            LOG_ERROR("Signal error: {:X}", (UINT) result);
+            continue;
+        }
+
+        queueFence.value++;
+
+        for (UINT i = 0; i < count; i++)
+            ring.ranges.Close(cmdLists[i], queueFence.fence, queueFence.value);
+
+        ring.ranges.Retire();
+    }
+
+    UpdateOpen();
+}
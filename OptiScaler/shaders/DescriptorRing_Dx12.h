@@ -0,0 +1,158 @@
+#pragma once
+#include <d3d12.h>
+#include <d3dx/d3dx12.h>
+
+#include "RingRanges.h"
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+// Shared shader visible CBV/SRV/UAV heap and constant upload buffer for all internal Dx12 passes
+//
+// Every dispatch takes a contiguous table (SRVs, then UAVs, then CBVs) from a single ring heap per
+// device instead of each pass cycling its own small heaps. Constants are written to 256 byte aligned
+// blocks of a persistently mapped upload buffer instead of mapping the pass' own buffer every dispatch.
+// Allocations are tracked per command list they are recorded to (RingRanges). When a list is executed
+// its allocations are closed with a fence signaled on the executing queue: from the ExecuteCommandLists
+// hook for any list, and by FrameDone where OptiScaler executes its own lists.
+// When the ring is full the oldest range is waited for, allocation fails if it can't be, in flight
+// ranges are never reused. A device's ring lives while any pass (Shader_Dx12) created on that device exists.
+
+inline constexpr UINT DESCRIPTOR_RING_SIZE = 4096;
+inline constexpr UINT CONSTANT_RING_SIZE = 256 * 1024;
+
+class RingDescriptorTable
+{
+    friend class DescriptorRing_Dx12;
+
+    ID3D12DescriptorHeap* _heap = nullptr;
+    CD3DX12_CPU_DESCRIPTOR_HANDLE _cpuStart {};
+    CD3DX12_GPU_DESCRIPTOR_HANDLE _gpuStart {};
+    UINT _descriptorSize = 0;
+    UINT _numSrv = 0;
+    UINT _numUav = 0;
+    UINT _numCbv = 0;
+
+    CD3DX12_CPU_DESCRIPTOR_HANDLE GetCPU(UINT offset, UINT index, UINT count) const
+    {
+        if (index >= count)
+        {
+            LOG_ERROR("Trying to get a handle outside the range");
+            return {};
+        }
+
+        return CD3DX12_CPU_DESCRIPTOR_HANDLE(_cpuStart, static_cast<INT>(offset + index), _descriptorSize);
+    }
+
+  public:
+    bool IsValid() const { return _heap != nullptr; }
+
+    CD3DX12_CPU_DESCRIPTOR_HANDLE GetSrvCPU(UINT index) const { return GetCPU(0, index, _numSrv); }
+    CD3DX12_CPU_DESCRIPTOR_HANDLE GetUavCPU(UINT index) const { return GetCPU(_numSrv, index, _numUav); }
+    CD3DX12_CPU_DESCRIPTOR_HANDLE GetCbvCPU(UINT index) const { return GetCPU(_numSrv + _numUav, index, _numCbv); }
+
+    // Get the GPU handle for the ENTIRE table (starts at SRV 0)
+    CD3DX12_GPU_DESCRIPTOR_HANDLE GetTableGPUStart() const { return _gpuStart; }
+};
+
+class DescriptorRing_Dx12
+{
+  private:
+    // Signaling a single fence from several queues could move its value backwards
+    struct QueueFence
+    {
+        ID3D12Fence* fence = nullptr;
+        UINT64 value = 0;
+    };
+
+    struct DeviceRing
+    {
+        ID3D12DescriptorHeap* heap = nullptr;
+        UINT descriptorSize = 0;
+
+        // Stays mapped until process exit
+        ID3D12Resource* constantBuffer = nullptr;
+        BYTE* constantCPU = nullptr;
+        D3D12_GPU_VIRTUAL_ADDRESS constantGPU = 0;
+
+        std::unordered_map<ID3D12CommandQueue*, QueueFence> fences;
+
+        RingRanges ranges { DESCRIPTOR_RING_SIZE, CONSTANT_RING_SIZE, CompletedValue, WaitForValue };
+
+        UINT64 failedCount = 0;
+    };
+
+    inline static std::mutex _mutex;
+    inline static std::unordered_map<ID3D12Device*, DeviceRing> _rings;
+    inline static std::unordered_map<ID3D12Device*, UINT> _users;
+
+    // Any ring has allocations which are not closed, executes are not checked otherwise
+    inline static std::atomic<bool> _hasOpen = false;
+
+    // ExecuteCommandLists is hooked, game's command lists are closed by Executed
+    inline static std::atomic<bool> _executeHooked = false;
+
+    static UINT64 CompletedValue(void* fence);
+    static bool WaitForValue(void* fence, UINT64 value);
+
+    static DeviceRing* GetRing(ID3D12Device* device);
+    static void ReleaseRing(ID3D12Device* device, DeviceRing& ring);
+    static UINT64 AllocateRange(DeviceRing& ring, RingRanges::RingType type, UINT64 count, UINT64 alignment,
+                                const void* owner);
+    static void UpdateOpen();
+    static void CloseLists(ID3D12CommandQueue* queue, UINT count, ID3D12CommandList* const* cmdLists);
+
+  public:
+    // Passes register with their device, ring of the device is released when its last pass is destroyed
+    static void AddUser(ID3D12Device* device);
+    static void RemoveUser(ID3D12Device* device);
+
+    // Returns an invalid table when the heap can't be created or the ring is full of in flight ranges
+    static RingDescriptorTable Allocate(ID3D12Device* device, ID3D12GraphicsCommandList* cmdList, UINT numSrv,
+                                       UINT numUav, UINT numCbv);
+
+    // Copies constants to a block of the upload ring and creates the CBV for it at cbvHandle
+    static bool WriteConstants(ID3D12Device* device, ID3D12GraphicsCommandList* cmdList, const void* data, UINT size,
+                               D3D12_CPU_DESCRIPTOR_HANDLE cbvHandle);
+
+    // Sets table's heap to command list, skipped if it's already bound in current ScopedDescriptorSequence
+    static void Bind(ID3D12GraphicsCommandList* cmdList, const RingDescriptorTable& table);
+
+    // Called from the ExecuteCommandLists hook right after the queue executes the lists,
+    // closes allocations recorded to them with a fence signal on the queue
+    static void Executed(ID3D12CommandQueue* queue, UINT count, ID3D12CommandList* const* cmdLists);
+
+    // Same for a list OptiScaler executes itself
+    static void FrameDone(ID3D12CommandQueue* queue, ID3D12CommandList* cmdList) { CloseLists(queue, 1, &cmdList); }
+
+    static void SetExecuteHooked(bool hooked) { _executeHooked.store(hooked, std::memory_order_relaxed); }
+
+    // Game's list is submitted by now, only used when executes are not hooked
+    static void GameListSubmitted(ID3D12CommandQueue* queue, ID3D12CommandList* cmdList);
+};
+
+// Passes dispatched on the same command list within this scope share a single SetDescriptorHeaps call.
+// Only use it where nothing else can change the bound heaps between passes.
+class ScopedDescriptorSequence
+{
+    friend class DescriptorRing_Dx12;
+
+    inline static thread_local ScopedDescriptorSequence* _current = nullptr;
+
+    ScopedDescriptorSequence* _previous = nullptr;
+    ID3D12GraphicsCommandList* _boundList = nullptr;
+    ID3D12DescriptorHeap* _boundHeap = nullptr;
+
+  public:
+    ScopedDescriptorSequence()
+    {
+        _previous = _current;
+        _current = this;
+    }
+
+    ~ScopedDescriptorSequence() { _current = _previous; }
+
+    ScopedDescriptorSequence(const ScopedDescriptorSequence&) = delete;
+    ScopedDescriptorSequence& operator=(const ScopedDescriptorSequence&) = delete;
+};
@@ -0,0 +1,117 @@
+#include "pch.h"
+#include "RingRanges.h"
+
+RingRanges::RingRanges(UINT64 descriptorCount, UINT64 constantSize, CompletedValueFn completedValue, WaitFn wait)
+    : _completedValue(completedValue), _wait(wait)
+{
+    _cursors[Descriptors].size = descriptorCount;
+    _cursors[Constants].size = constantSize;
+}
+
+void RingRanges::PopFront()
+{
+    auto& segment = _segments.front();
+
+    for (size_t i = 0; i < RingTypeCount; i++)
+        _cursors[i].tail = (std::max)(_cursors[i].tail, segment.end[i]);
+
+    if (segment.fence == nullptr)
+        _openCount--;
+
+    _segments.pop_front();
+}
+
+void RingRanges::Retire()
+{
+    // Segments are released in allocation order, a segment of a slower queue holds back the later ones
+    while (!_segments.empty() && _segments.front().fence != nullptr &&
+           _completedValue(_segments.front().fence) >= _segments.front().fenceValue)
+    {
+        PopFront();
+    }
+}
+
+UINT64 RingRanges::Allocate(RingType type, UINT64 count, UINT64 alignment, const void* owner)
+{
+    auto& cursor = _cursors[type];
+
+    if (count == 0 || count > cursor.size)
+        return InvalidOffset;
+
+    // Ranges must be contiguous, skip the remainder at the end of the ring
+    auto start = (cursor.head + alignment - 1) / alignment * alignment;
+    auto position = start % cursor.size;
+
+    if (position + count > cursor.size)
+        start += cursor.size - position;
+
+    if (start + count - cursor.tail > cursor.size)
+        Retire();
+
+    while (start + count - cursor.tail > cursor.size)
+    {
+        // Nothing is in use, skipped space at the end of the ring can be reused too
+        if (_segments.empty())
+        {
+            cursor.tail = start;
+            break;
+        }
+
+        auto& front = _segments.front();
+
+        // An open segment's list is not executed yet, waiting for it would never end
+        if (front.fence == nullptr || _wait == nullptr || !_wait(front.fence, front.fenceValue))
+            return InvalidOffset;
+
+        PopFront();
+    }
+
+    cursor.head = start + count;
+
+    if (_segments.empty() || _segments.back().owner != owner || _segments.back().fence != nullptr)
+    {
+        _segments.push_back({ owner });
+        _openCount++;
+    }
+
+    for (size_t i = 0; i < RingTypeCount; i++)
+        _segments.back().end[i] = _cursors[i].head;
+
+    return start % cursor.size;
+}
+
+bool RingRanges::IsOpen(const void* owner) const
+{
+    if (_openCount == 0)
+        return false;
+
+    for (auto& segment : _segments)
+    {
+        if (segment.owner == owner && segment.fence == nullptr)
+            return true;
+    }
+
+    return false;
+}
+
+void RingRanges::Close(const void* owner, void* fence, UINT64 value)
+{
+    for (auto& segment : _segments)
+    {
+        if (segment.owner != owner || segment.fence != nullptr)
+            continue;
+
+        segment.fence = fence;
+        segment.fenceValue = value;
+        _openCount--;
+    }
+}
+
+void RingRanges::Clear()
+{
+    _segments.clear();
+    _openCount = 0;
+
+    for (auto& cursor : _cursors)
+        cursor.tail = cursor.head;
+}
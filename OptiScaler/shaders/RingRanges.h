@@ -0,0 +1,77 @@
+#pragma once
+#include "SysUtils.h"
+
+#include <array>
+#include <deque>
+
+// Range bookkeeping of DescriptorRing_Dx12, no D3D12 calls are made here
+//
+// Allocations are grouped into segments of the command list they are recorded to. A segment is open until
+// the list is executed, then it's closed with a fence value signaled on the executing queue after it.
+// Ring space is reused in allocation order once the closed segments at the front are completed.
+// When the ring is full the oldest closed segment is waited for, if it's still open (its list is not
+// executed yet) or the wait fails, allocation fails instead of reusing a range which might be in flight.
+
+class RingRanges
+{
+  public:
+    enum RingType : size_t
+    {
+        Descriptors,
+        Constants,
+        RingTypeCount
+    };
+
+    // Fences are opaque to the ring, caller provides how to query and wait them
+    using CompletedValueFn = UINT64 (*)(void* fence);
+    using WaitFn = bool (*)(void* fence, UINT64 value);
+
+    static constexpr UINT64 InvalidOffset = UINT64_MAX;
+
+  private:
+    // Monotonic counters, position in ring is counter % size
+    struct RingCursor
+    {
+        UINT64 size = 0;
+        UINT64 head = 0;
+        UINT64 tail = 0;
+    };
+
+    struct Segment
+    {
+        const void* owner = nullptr;
+        std::array<UINT64, RingTypeCount> end {};
+        void* fence = nullptr; // Null while open
+        UINT64 fenceValue = 0;
+    };
+
+    std::array<RingCursor, RingTypeCount> _cursors;
+    std::deque<Segment> _segments;
+    size_t _openCount = 0;
+
+    CompletedValueFn _completedValue = nullptr;
+    WaitFn _wait = nullptr;
+
+    void PopFront();
+
+  public:
+    RingRanges(UINT64 descriptorCount, UINT64 constantSize, CompletedValueFn completedValue, WaitFn wait);
+
+    // Returns offset of count contiguous elements recorded to owner, InvalidOffset when they don't fit
+    UINT64 Allocate(RingType type, UINT64 count, UINT64 alignment, const void* owner);
+
+    // Owner has allocations which are not closed yet
+    bool IsOpen(const void* owner) const;
+
+    // Closes owner's open allocations, they are reused after fence reaches value
+    void Close(const void* owner, void* fence, UINT64 value);
+
+    // Releases completed segments from the front
+    void Retire();
+
+    // Drops everything, caller made sure GPU is done with the ring
+    void Clear();
+
+    size_t OpenCount() const { return _openCount; }
+    size_t SegmentCount() const { return _segments.size(); }
+};
@@ -1,8 +1,14 @@
 #include "pch.h"
 #include "Shader_Dx12.h"
+#include "DescriptorRing_Dx12.h"
 #include <d3dx/d3dx12.h>
 
-Shader_Dx12::Shader_Dx12(std::string InName, ID3D12Device* InDevice) : _name(InName), _device(InDevice) {}
+Shader_Dx12::Shader_Dx12(std::string InName, ID3D12Device* InDevice) : _name(InName), _device(InDevice)
+{
+    DescriptorRing_Dx12::AddUser(_device);
+}
+
+Shader_Dx12::~Shader_Dx12() { DescriptorRing_Dx12::RemoveUser(_device); }
 
 DXGI_FORMAT Shader_Dx12::TranslateTypelessFormats(DXGI_FORMAT format)
 {
@@ -12,7 +12,6 @@ class Shader_Dx12
     ID3D12PipelineState* _pipelineState = nullptr;
 
     ID3D12Device* _device = nullptr;
-    ID3D12Resource* _constantBuffer = nullptr;
 
     static DXGI_FORMAT TranslateTypelessFormats(DXGI_FORMAT format);
     static bool CreateComputeShader(ID3D12Device* device, ID3D12RootSignature* rootSignature,
@@ -28,4 +27,9 @@ class Shader_Dx12
     bool IsInit() const { return _init; }
 
     Shader_Dx12(std::string InName, ID3D12Device* InDevice);
+    ~Shader_Dx12();
+
+    // Registered as a user of the device's descriptor ring
+    Shader_Dx12(const Shader_Dx12&) = delete;
+    Shader_Dx12& operator=(const Shader_Dx12&) = delete;
 };
\ No newline at end of file
@@ -16,6 +16,15 @@ Shader_Vk::~Shader_Vk()
     }
 }
 
+VkDeviceSize Shader_Vk::GetUniformSlotSize(VkPhysicalDevice physicalDevice, VkDeviceSize size)
+{
+    VkPhysicalDeviceProperties properties {};
+    vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+
+    auto alignment = (std::max)(properties.limits.minUniformBufferOffsetAlignment, (VkDeviceSize) 1);
+    return (size + alignment - 1) / alignment * alignment;
+}
+
 uint32_t Shader_Vk::FindMemoryType(VkPhysicalDevice physicalDevice, uint32_t typeFilter,
                                    VkMemoryPropertyFlags properties)
 {
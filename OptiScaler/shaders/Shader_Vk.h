@@ -18,6 +18,8 @@ class Shader_Vk
     VkPipelineLayout _pipelineLayout = VK_NULL_HANDLE;
     VkDescriptorSetLayout _descriptorSetLayout = VK_NULL_HANDLE;
 
+    // Size of one per frame constant slot, rounded up to device's uniform buffer offset alignment
+    static VkDeviceSize GetUniformSlotSize(VkPhysicalDevice physicalDevice, VkDeviceSize size);
     static uint32_t FindMemoryType(VkPhysicalDevice physicalDevice, uint32_t typeFilter,
                                    VkMemoryPropertyFlags properties);
     static bool CreateComputePipeline(VkDevice device, VkPipelineLayout pipelineLayout, VkPipeline* pipeline,
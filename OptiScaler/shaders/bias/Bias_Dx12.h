@@ -1,11 +1,9 @@
 #pragma once
 #include <d3d12.h>
 #include <d3dx/d3dx12.h>
-#include <shaders/Shader_Dx12Utils.h>
+#include <shaders/DescriptorRing_Dx12.h>
 #include <shaders/Shader_Dx12.h>
 
-#define BIAS_NUM_OF_HEAPS 2
-
 class Bias_Dx12 : public Shader_Dx12
 {
   private:
@@ -14,8 +12,6 @@ class Bias_Dx12 : public Shader_Dx12
         float Bias;
     };
 
-    FrameDescriptorHeap _frameHeaps[BIAS_NUM_OF_HEAPS];
-
     ID3D12Resource* _buffer = nullptr;
     D3D12_RESOURCE_STATES _bufferState = D3D12_RESOURCE_STATE_COMMON;
 
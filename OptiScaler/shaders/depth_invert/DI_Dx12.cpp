@@ -40,9 +40,13 @@ bool DI_Dx12::Dispatch(ID3D12Device* InDevice, ID3D12GraphicsCommandList* InCmdL
 
     LOG_DEBUG("[{0}] Start!", _name);
 
-    _counter++;
-    _counter = _counter % DI_NUM_OF_HEAPS;
-    FrameDescriptorHeap& currentHeap = _frameHeaps[_counter];
+    auto currentHeap = DescriptorRing_Dx12::Allocate(InDevice, InCmdList, 1, 1, 0);
+
+    if (!currentHeap.IsValid())
+    {
+        LOG_ERROR("[{0}] Can't allocate descriptors", _name);
+        return false;
+    }
 
     auto inDesc = InResource->GetDesc();
     auto outDesc = OutResource->GetDesc();
@@ -62,8 +66,7 @@ bool DI_Dx12::Dispatch(ID3D12Device* InDevice, ID3D12GraphicsCommandList* InCmdL
     uavDesc.Texture2D.MipSlice = 0;
     InDevice->CreateUnorderedAccessView(OutResource, nullptr, &uavDesc, currentHeap.GetUavCPU(0));
 
-    ID3D12DescriptorHeap* heaps[] = { currentHeap.GetHeapCSU() };
-    InCmdList->SetDescriptorHeaps(_countof(heaps), heaps);
+    DescriptorRing_Dx12::Bind(InCmdList, currentHeap);
 
     InCmdList->SetComputeRootSignature(_rootSignature);
     InCmdList->SetPipelineState(_pipelineState);
@@ -189,18 +192,6 @@ DI_Dx12::DI_Dx12(std::string InName, ID3D12Device* InDevice) : Shader_Dx12(InNam
         }
     }
 
-    ScopedSkipHeapCapture skipHeapCapture {};
-
-    for (int i = 0; i < DI_NUM_OF_HEAPS; i++)
-    {
-        if (!_frameHeaps[i].Initialize(InDevice, 1, 1, 0))
-        {
-            LOG_ERROR("[{0}] Failed to init heap", _name);
-            _init = false;
-            return;
-        }
-    }
-
     _init = true;
 }
 
@@ -221,11 +212,6 @@ DI_Dx12::~DI_Dx12()
         _rootSignature = nullptr;
     }
 
-    for (int i = 0; i < DI_NUM_OF_HEAPS; i++)
-    {
-        _frameHeaps[i].ReleaseHeaps();
-    }
-
     if (_buffer != nullptr)
     {
         _buffer->Release();
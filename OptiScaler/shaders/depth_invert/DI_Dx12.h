@@ -4,16 +4,12 @@
 
 #include <d3d12.h>
 #include <d3dx/d3dx12.h>
-#include <shaders/Shader_Dx12Utils.h>
+#include <shaders/DescriptorRing_Dx12.h>
 #include <shaders/Shader_Dx12.h>
 
-#define DI_NUM_OF_HEAPS 2
-
 class DI_Dx12 : public Shader_Dx12
 {
   private:
-    FrameDescriptorHeap _frameHeaps[DI_NUM_OF_HEAPS];
-
     ID3D12Resource* _buffer = nullptr;
     D3D12_RESOURCE_STATES _bufferState = D3D12_RESOURCE_STATE_COMMON;
 
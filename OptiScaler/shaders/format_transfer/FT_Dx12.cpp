@@ -71,9 +71,13 @@ bool FT_Dx12::Dispatch(ID3D12Device* InDevice, ID3D12GraphicsCommandList* InCmdL
 
     LOG_DEBUG("[{0}] Start!", _name);
 
-    _counter++;
-    _counter = _counter % FT_NUM_OF_HEAPS;
-    FrameDescriptorHeap& currentHeap = _frameHeaps[_counter];
+    auto currentHeap = DescriptorRing_Dx12::Allocate(InDevice, InCmdList, 1, 1, 0);
+
+    if (!currentHeap.IsValid())
+    {
+        LOG_ERROR("[{0}] Can't allocate descriptors", _name);
+        return false;
+    }
 
     auto inDesc = InResource->GetDesc();
     auto outDesc = OutResource->GetDesc();
@@ -95,8 +99,7 @@ bool FT_Dx12::Dispatch(ID3D12Device* InDevice, ID3D12GraphicsCommandList* InCmdL
     uavDesc.Texture2D.MipSlice = 0;
     InDevice->CreateUnorderedAccessView(OutResource, nullptr, &uavDesc, currentHeap.GetUavCPU(0));
 
-    ID3D12DescriptorHeap* heaps[] = { currentHeap.GetHeapCSU() };
-    InCmdList->SetDescriptorHeaps(_countof(heaps), heaps);
+    DescriptorRing_Dx12::Bind(InCmdList, currentHeap);
 
     InCmdList->SetComputeRootSignature(_rootSignature);
     InCmdList->SetPipelineState(_pipelineState);
@@ -225,18 +228,6 @@ FT_Dx12::FT_Dx12(std::string InName, ID3D12Device* InDevice, DXGI_FORMAT InForma
         }
     }
 
-    ScopedSkipHeapCapture skipHeapCapture {};
-
-    for (int i = 0; i < FT_NUM_OF_HEAPS; i++)
-    {
-        if (!_frameHeaps[i].Initialize(InDevice, 1, 1, 0))
-        {
-            LOG_ERROR("[{0}] Failed to init heap", _name);
-            _init = false;
-            return;
-        }
-    }
-
     _init = true;
 }
 
@@ -263,11 +254,6 @@ FT_Dx12::~FT_Dx12()
         _rootSignature = nullptr;
     }
 
-    for (int i = 0; i < FT_NUM_OF_HEAPS; i++)
-    {
-        _frameHeaps[i].ReleaseHeaps();
-    }
-
     if (_buffer != nullptr)
     {
         _buffer->Release();
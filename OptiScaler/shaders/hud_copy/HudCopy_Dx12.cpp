@@ -28,9 +28,13 @@ bool HudCopy_Dx12::Dispatch(ID3D12Device* InDevice, ID3D12GraphicsCommandList* c
     if (!_init || InDevice == nullptr || hudless == nullptr || present == nullptr || cmdList == nullptr)
         return false;
 
-    _counter++;
-    _counter = _counter % HudCopy_NUM_OF_HEAPS;
-    FrameDescriptorHeap& currentHeap = _frameHeaps[_counter];
+    auto currentHeap = DescriptorRing_Dx12::Allocate(InDevice, cmdList, 2, 1, 1);
+
+    if (!currentHeap.IsValid())
+    {
+        LOG_ERROR("[{0}] Can't allocate descriptors", _name);
+        return false;
+    }
 
     auto hudlessDesc = hudless->GetDesc();
     auto presentDesc = present->GetDesc();
@@ -87,34 +91,14 @@ bool HudCopy_Dx12::Dispatch(ID3D12Device* InDevice, ID3D12GraphicsCommandList* c
     InternalCompareParams constants {};
     constants.DiffThreshold = hudDetectionThreshold;
 
-    // Copy the updated constant buffer data to the constant buffer resource
-    BYTE* pCBDataBegin;
-    CD3DX12_RANGE readRange(0, 0); // We do not intend to read from this resource on the CPU
-    auto result = _constantBuffer->Map(0, &readRange, reinterpret_cast<void**>(&pCBDataBegin));
-
-    if (result != S_OK)
+    if (!DescriptorRing_Dx12::WriteConstants(InDevice, cmdList, &constants, sizeof(constants),
+                                             currentHeap.GetCbvCPU(0)))
     {
-        LOG_ERROR("[{0}] _constantBuffer->Map error {1:x}", _name, (unsigned int) result);
+        LOG_ERROR("[{0}] Can't write constants!", _name);
         return false;
     }
 
-    if (pCBDataBegin == nullptr)
-    {
-        _constantBuffer->Unmap(0, nullptr);
-        LOG_ERROR("[{0}] pCBDataBegin is null!", _name);
-        return false;
-    }
-
-    memcpy(pCBDataBegin, &constants, sizeof(constants));
-    _constantBuffer->Unmap(0, nullptr);
-
-    D3D12_CONSTANT_BUFFER_VIEW_DESC cbvDesc = {};
-    cbvDesc.BufferLocation = _constantBuffer->GetGPUVirtualAddress();
-    cbvDesc.SizeInBytes = sizeof(constants);
-    InDevice->CreateConstantBufferView(&cbvDesc, currentHeap.GetCbvCPU(0));
-
-    ID3D12DescriptorHeap* heaps[] = { currentHeap.GetHeapCSU() };
-    cmdList->SetDescriptorHeaps(_countof(heaps), heaps);
+    DescriptorRing_Dx12::Bind(cmdList, currentHeap);
 
     cmdList->SetComputeRootSignature(_rootSignature);
     cmdList->SetPipelineState(_pipelineState);
@@ -166,19 +150,6 @@ HudCopy_Dx12::HudCopy_Dx12(std::string InName, ID3D12Device* InDevice) : Shader_
     CD3DX12_VERSIONED_ROOT_SIGNATURE_DESC rootSigDesc;
     rootSigDesc.Init_1_1(1, &rootParameter);
 
-    D3D12_RESOURCE_DESC desc = CD3DX12_RESOURCE_DESC::Buffer(sizeof(InternalCompareParams));
-    auto heapProps = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD);
-
-    auto result =
-        InDevice->CreateCommittedResource(&heapProps, D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_GENERIC_READ,
-                                          nullptr, IID_PPV_ARGS(&_constantBuffer));
-
-    if (result != S_OK)
-    {
-        LOG_ERROR("[{0}] CreateCommittedResource error {1:x}", _name, (unsigned int) result);
-        return;
-    }
-
     ID3DBlob* errorBlob;
     ID3DBlob* signatureBlob;
 
@@ -263,18 +234,6 @@ HudCopy_Dx12::HudCopy_Dx12(std::string InName, ID3D12Device* InDevice) : Shader_
         }
     }
 
-    ScopedSkipHeapCapture skipHeapCapture {};
-
-    for (int i = 0; i < HudCopy_NUM_OF_HEAPS; i++)
-    {
-        if (!_frameHeaps[i].Initialize(InDevice, 2, 1, 1))
-        {
-            LOG_ERROR("[{0}] Failed to init heap", _name);
-            _init = false;
-            return;
-        }
-    }
-
     _init = true;
 }
 
@@ -295,20 +254,9 @@ HudCopy_Dx12::~HudCopy_Dx12()
         _rootSignature = nullptr;
     }
 
-    for (int i = 0; i < HudCopy_NUM_OF_HEAPS; i++)
-    {
-        _frameHeaps[i].ReleaseHeaps();
-    }
-
     if (_buffer != nullptr)
     {
         _buffer->Release();
         _buffer = nullptr;
     }
-
-    if (_constantBuffer != nullptr)
-    {
-        _constantBuffer->Release();
-        _constantBuffer = nullptr;
-    }
 }
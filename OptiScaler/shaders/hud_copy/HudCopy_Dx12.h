@@ -5,11 +5,9 @@
 #include <d3d12.h>
 #include <d3dx/d3dx12.h>
 #include <dxgi1_6.h>
-#include <shaders/Shader_Dx12Utils.h>
+#include <shaders/DescriptorRing_Dx12.h>
 #include <shaders/Shader_Dx12.h>
 
-#define HudCopy_NUM_OF_HEAPS 2
-
 class HudCopy_Dx12 : public Shader_Dx12
 {
   private:
@@ -18,8 +16,6 @@ class HudCopy_Dx12 : public Shader_Dx12
         float DiffThreshold = 0.02f;
     };
 
-    FrameDescriptorHeap _frameHeaps[HudCopy_NUM_OF_HEAPS];
-
     ID3D12Resource* _buffer = nullptr;
 
     uint32_t InNumThreadsX = 16;
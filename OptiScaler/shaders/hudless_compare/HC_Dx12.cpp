@@ -160,30 +160,14 @@ HC_Dx12::HC_Dx12(std::string InName, ID3D12Device* InDevice) : Shader_Dx12(InNam
         return;
     }
 
-    // Create Constant Buffer
-    D3D12_RESOURCE_DESC desc = CD3DX12_RESOURCE_DESC::Buffer(sizeof(InternalCompareParams));
-    auto heapProps = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD);
-
-    result =
-        InDevice->CreateCommittedResource(&heapProps, D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_GENERIC_READ,
-                                          nullptr, IID_PPV_ARGS(&_constantBuffer));
-
-    if (result != S_OK)
-    {
-        LOG_ERROR("CreateCommittedResource error {:X}", (unsigned int) result);
-        return;
-    }
-
     ScopedSkipHeapCapture skipHeapCapture {};
 
-    for (int i = 0; i < HC_NUM_OF_HEAPS; i++)
+    // RTV is consumed while recording, shader visible descriptors come from DescriptorRing_Dx12
+    if (!_rtvHeap.Initialize(InDevice, 0, 0, 0, 1))
     {
-        if (!_frameHeaps[i].Initialize(InDevice, 2, 0, 1, 1))
-        {
-            LOG_ERROR("[{0}] Failed to init heap", _name);
-            _init = false;
-            return;
-        }
+        LOG_ERROR("[{0}] Failed to init heap", _name);
+        _init = false;
+        return;
     }
 
     _init = true;
@@ -255,7 +239,13 @@ bool HC_Dx12::Dispatch(IDXGISwapChain3* sc, ID3D12GraphicsCommandList* cmdList,
     UINT outWidth = scDesc.BufferDesc.Width;
     UINT outHeight = scDesc.BufferDesc.Height;
 
-    FrameDescriptorHeap& currentHeap = _frameHeaps[_counter];
+    auto currentHeap = DescriptorRing_Dx12::Allocate(_device, cmdList, 2, 0, 1);
+
+    if (!currentHeap.IsValid())
+    {
+        LOG_ERROR("[{0}] Can't allocate descriptors", _name);
+        return false;
+    }
 
     // Create views
     {
@@ -280,41 +270,20 @@ bool HC_Dx12::Dispatch(IDXGISwapChain3* sc, ID3D12GraphicsCommandList* cmdList,
         D3D12_RENDER_TARGET_VIEW_DESC rtv {};
         rtv.ViewDimension = D3D12_RTV_DIMENSION_TEXTURE2D;
         rtv.Format = Shader_Dx12::TranslateTypelessFormats(scDesc.BufferDesc.Format);
-        _device->CreateRenderTargetView(scBuffer, &rtv, currentHeap.GetRtvCPU(0));
+        _device->CreateRenderTargetView(scBuffer, &rtv, _rtvHeap.GetRtvCPU(0));
     }
 
     InternalCompareParams constants {};
     constants.DiffThreshold = 0.003f;
     constants.PinkAmount = 0.6f;
 
-    BYTE* pCBDataBegin;
-    CD3DX12_RANGE readRange(0, 0);
-    result = _constantBuffer->Map(0, &readRange, reinterpret_cast<void**>(&pCBDataBegin));
-    if (result != S_OK)
+    if (!DescriptorRing_Dx12::WriteConstants(_device, cmdList, &constants, sizeof(constants), currentHeap.GetCbvCPU(0)))
     {
-        LOG_ERROR("_constantBuffer->Map error {:X}", (unsigned int) result);
+        LOG_ERROR("Can't write constants!");
         return false;
     }
 
-    if (pCBDataBegin == nullptr)
-    {
-        _constantBuffer->Unmap(0, nullptr);
-        LOG_ERROR("pCBDataBegin is null!");
-        return false;
-    }
-
-    memcpy(pCBDataBegin, &constants, sizeof(constants));
-    _constantBuffer->Unmap(0, nullptr);
-
-    {
-        D3D12_CONSTANT_BUFFER_VIEW_DESC cbv {};
-        cbv.BufferLocation = _constantBuffer->GetGPUVirtualAddress();
-        cbv.SizeInBytes = sizeof(constants);
-        _device->CreateConstantBufferView(&cbv, currentHeap.GetCbvCPU(0));
-    }
-
-    ID3D12DescriptorHeap* heaps[] = { currentHeap.GetHeapCSU() };
-    cmdList->SetDescriptorHeaps(_countof(heaps), heaps);
+    DescriptorRing_Dx12::Bind(cmdList, currentHeap);
 
     cmdList->SetGraphicsRootSignature(_rootSignature);
     cmdList->SetPipelineState(_pipelineState);
@@ -322,7 +291,7 @@ bool HC_Dx12::Dispatch(IDXGISwapChain3* sc, ID3D12GraphicsCommandList* cmdList,
     cmdList->SetGraphicsRootDescriptorTable(0, currentHeap.GetTableGPUStart());
 
     // Set RTV, viewport, scissor
-    D3D12_CPU_DESCRIPTOR_HANDLE rtvHandles[] = { currentHeap.GetRtvCPU(0) };
+    D3D12_CPU_DESCRIPTOR_HANDLE rtvHandles[] = { _rtvHeap.GetRtvCPU(0) };
     cmdList->OMSetRenderTargets(_countof(rtvHandles), rtvHandles, true, nullptr);
 
     D3D12_VIEWPORT vp {};
@@ -360,14 +329,6 @@ HC_Dx12::~HC_Dx12()
         _rootSignature = nullptr;
     }
 
-    for (int i = 0; i < HC_NUM_OF_HEAPS; i++)
-    {
-        _frameHeaps[i].ReleaseHeaps();
-    }
+    _rtvHeap.ReleaseHeaps();
 
-    if (_constantBuffer != nullptr)
-    {
-        _constantBuffer->Release();
-        _constantBuffer = nullptr;
-    }
 }
\ No newline at end of file
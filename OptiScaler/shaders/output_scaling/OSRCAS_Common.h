@@ -0,0 +1,349 @@
+#pragma once
+
+#include "SysUtils.h"
+#include <d3dcompiler.h>
+
+// Output scaling downscale + RCAS in a single dispatch
+//
+// Each 8x8 group of output pixels first runs RCAS for the source footprint of the group into
+// groupshared memory, then filters from there with the same taps and weights as the two pass
+// Lanczos/Kaiser downscalers. Only separable exact texel filters can be fused this way, so variants
+// are selected with defines:
+//   TAP_COUNT      : 4 (radius 2) or 6 (radius 3)
+//   KERNEL_KAISER  : Kaiser windowed sinc with BETA, otherwise Lanczos
+//
+// Source footprint of 8 output pixels is floor(7 * ratio) + 1 + TAP_COUNT source pixels,
+// tile size limits the downscale ratio to OSRCAS_MAX_RATIO.
+//
+// Matches the two passes up to float rounding when RCAS buffer is float. With a half float RCAS buffer the
+// two passes differ by at most 2^-10 * max value, unsigned buffers also clip RCAS undershoot which this keeps.
+
+inline constexpr float OSRCAS_MAX_RATIO = 3.5f;
+
+inline static std::string osRcasCode = R"(
+cbuffer Params : register(b0)
+{
+    // RCAS, same layout as RCAS pass
+    float Sharpness;
+    float Contrast;
+
+    int DynamicSharpenEnabled;
+    int DisplaySizeMV;
+    int Debug;
+
+    float MotionSharpness;
+    float MotionTextureScale;
+    float MvScaleX;
+    float MvScaleY;
+    float Threshold;
+    float ScaleLimit;
+    int DisplayWidth;
+    int DisplayHeight;
+
+    // Output scaling
+    int _SrcWidth;
+    int _SrcHeight;
+    int _DstWidth;
+    int _DstHeight;
+};
+
+Texture2D<float3> Source : register(t0);
+Texture2D<float2> Motion : register(t1);
+RWTexture2D<float4> OutputTexture : register(u0);
+
+#define GROUP_SIZE 8
+#define TILE_SIZE  32
+
+#if TAP_COUNT == 6
+#define RADIUS 3
+#else
+#define RADIUS 2
+#endif
+
+groupshared float3 Tile[TILE_SIZE * TILE_SIZE];
+
+static int ClampInt(int v, int lo, int hi)
+{
+    return min(max(v, lo), hi);
+}
+
+static float Sinc(float x)
+{
+    x *= 3.1415926535f;
+    if (abs(x) < 1e-5f)
+        return 1.0f;
+    return sin(x) / x;
+}
+
+#ifdef KERNEL_KAISER
+// Modified Bessel function I0 approximation, same as Kaiser downscalers
+static float I0(float x)
+{
+    float ax = abs(x);
+    if (ax < 3.75f)
+    {
+        float t = x / 3.75f;
+        float t2 = t * t;
+        return 1.0f
+            + t2 * (3.5156229f
+            + t2 * (3.0899424f
+            + t2 * (1.2067492f
+            + t2 * (0.2659732f
+            + t2 * (0.0360768f
+            + t2 * 0.0045813f)))));
+    }
+    else
+    {
+        float t = 3.75f / ax;
+        return (exp(ax) / sqrt(ax)) *
+            (0.39894228f
+            + t * (0.01328592f
+            + t * (0.00225319f
+            + t * (-0.00157565f
+            + t * (0.00916281f
+            + t * (-0.02057706f
+            + t * (0.02635537f
+            + t * (-0.01647633f
+            + t * 0.00392377f))))))));
+    }
+}
+
+static float Kernel(float x, float invI0Beta)
+{
+    float ax = abs(x);
+    if (ax >= (float)RADIUS)
+        return 0.0f;
+
+    float r = ax / (float)RADIUS;
+    float t = sqrt(saturate(1.0f - r * r));
+
+    return Sinc(x) * (I0(BETA * t) * invI0Beta);
+}
+#else
+static float Kernel(float x, float invI0Beta)
+{
+    float ax = abs(x);
+    if (ax >= (float)RADIUS)
+        return 0.0f;
+    return Sinc(x) * Sinc(x / (float)RADIUS);
+}
+#endif
+
+static float2 SourcePos(uint2 pixel)
+{
+    float2 dst = float2((float)pixel.x + 0.5f, (float)pixel.y + 0.5f);
+    float2 scale = float2((float)_SrcWidth / (float)_DstWidth,
+                          (float)_SrcHeight / (float)_DstHeight);
+
+    return dst * scale - 0.5f;
+}
+
+static int2 SourceBase(uint2 pixel)
+{
+    return (int2)floor(SourcePos(pixel)) - int2(RADIUS - 1, RADIUS - 1);
+}
+
+// Same as RCAS pass for a single source pixel
+static float3 RcasAt(int2 p)
+{
+    float setSharpness = Sharpness;
+
+    if (DynamicSharpenEnabled > 0)
+    {
+        float2 mv;
+        float motion;
+        float add = 0.0f;
+
+        if (DisplaySizeMV > 0)
+            mv = Motion.Load(int3(p.x, p.y, 0)).rg;
+        else
+            mv = Motion.Load(int3(p.x * MotionTextureScale, p.y * MotionTextureScale, 0)).rg;
+
+        motion = max(abs(mv.r * MvScaleX), abs(mv.g * MvScaleY));
+
+        if (motion > Threshold)
+            add = (motion / (ScaleLimit - Threshold)) * MotionSharpness;
+
+        if ((add > MotionSharpness && MotionSharpness > 0.0f) || (add < MotionSharpness && MotionSharpness < 0.0f))
+            add = MotionSharpness;
+
+        setSharpness += add;
+
+        if (setSharpness > 1.3f)
+            setSharpness = 1.3f;
+        else if (setSharpness < 0.0f)
+            setSharpness = 0.0f;
+    }
+
+    float3 e = Source.Load(int3(p.x, p.y, 0)).rgb;
+
+    if (setSharpness == 0.0f)
+    {
+        if (Debug > 0 && DynamicSharpenEnabled > 0 && Sharpness > 0)
+            e.g *= 1 + (12.0f * Sharpness);
+
+        return e;
+    }
+
+    float3 b = Source.Load(int3(p.x, p.y - 1, 0)).rgb;
+    float3 d = Source.Load(int3(p.x - 1, p.y, 0)).rgb;
+    float3 f = Source.Load(int3(p.x + 1, p.y, 0)).rgb;
+    float3 h = Source.Load(int3(p.x, p.y + 1, 0)).rgb;
+
+    float3 minRGB = min(min(b, d), min(f, h));
+    float3 maxRGB = max(max(b, d), max(f, h));
+
+    float2 peakC = float2(1.0, -4.0);
+
+    float3 hitMin = minRGB * rcp(4.0 * maxRGB);
+    float3 hitMax = (peakC.xxx - maxRGB) * rcp(4.0 * minRGB + peakC.yyy);
+    float3 lobeRGB = max(-hitMin, hitMax);
+    float lobe = max(-0.1875, min(max(lobeRGB.r, max(lobeRGB.g, lobeRGB.b)), 0.0)) * setSharpness;
+
+    if (Contrast >= -10.0)
+    {
+        float3 amp = saturate(min(minRGB, 2.0 - maxRGB) / max(maxRGB, 1e-5));
+        amp = rsqrt(amp);
+
+        float peak = -3.0 * Contrast + 8.0;
+        float contrastFactor = 1.0 / max(amp.g * peak, 1.0);
+
+        lobe *= lerp(1.0, contrastFactor, Contrast);
+    }
+
+    float rcpL = rcp(4.0 * lobe + 1.0);
+    float3 output = ((b + d + f + h) * lobe + e) * rcpL;
+
+    if (Debug > 0 && DynamicSharpenEnabled > 0)
+    {
+        if (Sharpness < setSharpness)
+            output.r *= 1 + (12.0f * (setSharpness - Sharpness));
+        else
+            output.g *= 1 + (12.0f * (Sharpness - setSharpness));
+    }
+
+    return output;
+}
+
+[numthreads(GROUP_SIZE, GROUP_SIZE, 1)]
+void CSMain(uint3 id : SV_DispatchThreadID, uint3 gid : SV_GroupID, uint gi : SV_GroupIndex)
+{
+    // Sharpen source footprint of the group once
+    uint2 groupStart = gid.xy * GROUP_SIZE;
+    int2 tileOrigin = SourceBase(groupStart);
+    int2 tileEnd = SourceBase(groupStart + (GROUP_SIZE - 1)) + TAP_COUNT;
+    int2 tileDim = min(tileEnd - tileOrigin, int2(TILE_SIZE, TILE_SIZE));
+
+    for (int t = (int)gi; t < tileDim.x * tileDim.y; t += GROUP_SIZE * GROUP_SIZE)
+    {
+        int2 local = int2(t % tileDim.x, t / tileDim.x);
+        int2 p = int2(ClampInt(tileOrigin.x + local.x, 0, _SrcWidth - 1),
+                      ClampInt(tileOrigin.y + local.y, 0, _SrcHeight - 1));
+
+        Tile[local.y * TILE_SIZE + local.x] = RcasAt(p);
+    }
+
+    GroupMemoryBarrierWithGroupSync();
+
+    uint ox = id.x;
+    uint oy = id.y;
+    if (ox >= (uint)_DstWidth || oy >= (uint)_DstHeight)
+        return;
+
+    float2 srcPos = SourcePos(id.xy);
+    float2 ip = floor(srcPos);
+    float2 f = srcPos - ip;
+
+    int2 base = (int2)ip - int2(RADIUS - 1, RADIUS - 1);
+    int2 tileBase = base - tileOrigin;
+
+#ifdef KERNEL_KAISER
+    float invI0Beta = 1.0f / I0(BETA);
+#else
+    float invI0Beta = 1.0f;
+#endif
+
+    float wx[TAP_COUNT];
+    float wy[TAP_COUNT];
+    float sumWx = 0.0f;
+    float sumWy = 0.0f;
+
+    [unroll]
+    for (int i = 0; i < TAP_COUNT; ++i)
+    {
+        float dx = (float)i - (float)(RADIUS - 1) - f.x;
+        wx[i] = Kernel(dx, invI0Beta);
+        sumWx += wx[i];
+
+        float dy = (float)i - (float)(RADIUS - 1) - f.y;
+        wy[i] = Kernel(dy, invI0Beta);
+        sumWy += wy[i];
+    }
+
+    float invSumWx = (sumWx != 0.0f) ? (1.0f / sumWx) : 0.0f;
+    float invSumWy = (sumWy != 0.0f) ? (1.0f / sumWy) : 0.0f;
+
+    [unroll]
+    for (int i = 0; i < TAP_COUNT; ++i)
+    {
+        wx[i] *= invSumWx;
+        wy[i] *= invSumWy;
+    }
+
+    float3 acc = 0.0f;
+    float3 mn = 1e30f;
+    float3 mx = -1e30f;
+
+    [unroll]
+    for (int j = 0; j < TAP_COUNT; ++j)
+    {
+        float wyj = wy[j];
+
+        [unroll]
+        for (int i = 0; i < TAP_COUNT; ++i)
+        {
+            float w = wx[i] * wyj;
+            float3 s = Tile[(tileBase.y + j) * TILE_SIZE + tileBase.x + i];
+
+            mn = min(mn, s);
+            mx = max(mx, s);
+
+            acc += s * w;
+        }
+    }
+
+    float3 outRgb = clamp(acc, mn, mx);
+    OutputTexture[uint2(ox, oy)] = float4(outRgb, 1.0f);
+}
+)";
+
+static ID3DBlob* OSRCAS_CompileShader(const char* shaderCode, const char* entryPoint, const char* target,
+                                      const D3D_SHADER_MACRO* defines)
+{
+    ID3DBlob* shaderBlob = nullptr;
+    ID3DBlob* errorBlob = nullptr;
+
+    HRESULT hr = D3DCompile(shaderCode, strlen(shaderCode), nullptr, defines, nullptr, entryPoint, target,
+                            D3DCOMPILE_OPTIMIZATION_LEVEL3, 0, &shaderBlob, &errorBlob);
+
+    if (FAILED(hr))
+    {
+        LOG_ERROR("error while compiling shader");
+
+        if (errorBlob)
+        {
+            LOG_ERROR("error while compiling shader : {0}", (char*) errorBlob->GetBufferPointer());
+            errorBlob->Release();
+        }
+
+        if (shaderBlob)
+            shaderBlob->Release();
+
+        return nullptr;
+    }
+
+    if (errorBlob)
+        errorBlob->Release();
+
+    return shaderBlob;
+}
@@ -0,0 +1,265 @@
+#include "pch.h"
+#include "OSRCAS_Dx12.h"
+
+#include "OSRCAS_Common.h"
+
+#include <Config.h>
+
+bool OSRCAS_Dx12::CanDispatch(uint32_t InSrcWidth, uint32_t InSrcHeight, uint32_t InDstWidth,
+                              uint32_t InDstHeight) const
+{
+    if (!_init || InDstWidth == 0 || InDstHeight == 0)
+        return false;
+
+    // Only downscaling, source footprint of a group must fit the groupshared tile
+    if (InSrcWidth < InDstWidth || InSrcHeight < InDstHeight)
+        return false;
+
+    return (float) InSrcWidth / (float) InDstWidth <= OSRCAS_MAX_RATIO &&
+           (float) InSrcHeight / (float) InDstHeight <= OSRCAS_MAX_RATIO;
+}
+
+bool OSRCAS_Dx12::Dispatch(ID3D12Device* InDevice, ID3D12GraphicsCommandList* InCmdList, ID3D12Resource* InResource,
+                           ID3D12Resource* InMotionVectors, RcasConstants InConstants, ID3D12Resource* OutResource)
+{
+    if (!_init || InDevice == nullptr || InCmdList == nullptr || InResource == nullptr || OutResource == nullptr ||
+        InMotionVectors == nullptr)
+        return false;
+
+    LOG_DEBUG("[{0}] Start!", _name);
+
+    auto currentHeap = DescriptorRing_Dx12::Allocate(InDevice, InCmdList, 2, 1, 1);
+
+    if (!currentHeap.IsValid())
+    {
+        LOG_ERROR("[{0}] Can't allocate descriptors", _name);
+        return false;
+    }
+
+    auto inDesc = InResource->GetDesc();
+    auto mvDesc = InMotionVectors->GetDesc();
+    auto outDesc = OutResource->GetDesc();
+
+    // Create SRV for Input Texture
+    D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
+    srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+    srvDesc.Format = Shader_Dx12::TranslateTypelessFormats(inDesc.Format);
+    srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
+    srvDesc.Texture2D.MipLevels = 1;
+
+    InDevice->CreateShaderResourceView(InResource, &srvDesc, currentHeap.GetSrvCPU(0));
+
+    // Create SRV for Motion Texture
+    D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc2 = {};
+    srvDesc2.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+    srvDesc2.Format = Shader_Dx12::TranslateTypelessFormats(mvDesc.Format);
+    srvDesc2.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
+    srvDesc2.Texture2D.MipLevels = 1;
+
+    InDevice->CreateShaderResourceView(InMotionVectors, &srvDesc2, currentHeap.GetSrvCPU(1));
+
+    // Create UAV for Output Texture
+    D3D12_UNORDERED_ACCESS_VIEW_DESC uavDesc = {};
+    uavDesc.Format = Shader_Dx12::TranslateTypelessFormats(outDesc.Format);
+    uavDesc.ViewDimension = D3D12_UAV_DIMENSION_TEXTURE2D;
+    uavDesc.Texture2D.MipSlice = 0;
+
+    InDevice->CreateUnorderedAccessView(OutResource, nullptr, &uavDesc, currentHeap.GetUavCPU(0));
+
+    InternalConstants constants {};
+
+    if (Config::Instance()->ContrastEnabled.value_or_default())
+        constants.Contrast = Config::Instance()->Contrast.value_or_default() * -1.0f;
+    else
+        constants.Contrast = -100.0f;
+
+    constants.DisplayHeight = InConstants.DisplayHeight;
+    constants.DisplayWidth = InConstants.DisplayWidth;
+    constants.DynamicSharpenEnabled = Config::Instance()->MotionSharpnessEnabled.value_or_default() ? 1 : 0;
+    constants.MotionSharpness = Config::Instance()->MotionSharpness.value_or_default();
+    constants.MvScaleX = InConstants.MvScaleX;
+    constants.MvScaleY = InConstants.MvScaleY;
+    constants.Sharpness = InConstants.Sharpness;
+    constants.Debug = Config::Instance()->MotionSharpnessDebug.value_or_default() ? 1 : 0;
+    constants.Threshold = Config::Instance()->MotionThreshold.value_or_default();
+    constants.ScaleLimit = Config::Instance()->MotionScaleLimit.value_or_default();
+    constants.DisplaySizeMV = InConstants.DisplaySizeMV ? 1 : 0;
+
+    if (InConstants.RenderWidth == 0 || InConstants.DisplayWidth == 0)
+        constants.MotionTextureScale = 1.0f;
+    else
+        constants.MotionTextureScale = (float) InConstants.RenderWidth / (float) InConstants.DisplayWidth;
+
+    // RCAS runs at upscaler output size, same as OS input
+    constants.SrcWidth = InConstants.DisplayWidth;
+    constants.SrcHeight = InConstants.DisplayHeight;
+    constants.DstWidth = State::Instance().currentFeature->DisplayWidth();
+    constants.DstHeight = State::Instance().currentFeature->DisplayHeight();
+
+    if (!CanDispatch(constants.SrcWidth, constants.SrcHeight, constants.DstWidth, constants.DstHeight))
+    {
+        LOG_ERROR("[{0}] Unsupported scaling: {1}x{2} -> {3}x{4}", _name, constants.SrcWidth, constants.SrcHeight,
+                  constants.DstWidth, constants.DstHeight);
+        return false;
+    }
+
+    if (!DescriptorRing_Dx12::WriteConstants(InDevice, InCmdList, &constants, sizeof(constants),
+                                             currentHeap.GetCbvCPU(0)))
+    {
+        LOG_ERROR("[{0}] Can't write constants!", _name);
+        return false;
+    }
+
+    DescriptorRing_Dx12::Bind(InCmdList, currentHeap);
+
+    InCmdList->SetComputeRootSignature(_rootSignature);
+    InCmdList->SetPipelineState(_pipelineState);
+
+    InCmdList->SetComputeRootDescriptorTable(0, currentHeap.GetTableGPUStart());
+
+    UINT dispatchWidth = 0;
+    UINT dispatchHeight = 0;
+
+    dispatchWidth = static_cast<UINT>((constants.DstWidth + InNumThreadsX - 1) / InNumThreadsX);
+    dispatchHeight = (constants.DstHeight + InNumThreadsY - 1) / InNumThreadsY;
+
+    InCmdList->Dispatch(dispatchWidth, dispatchHeight, 1);
+
+    return true;
+}
+
+OSRCAS_Dx12::OSRCAS_Dx12(std::string InName, ID3D12Device* InDevice) : Shader_Dx12(InName, InDevice)
+{
+    if (InDevice == nullptr)
+    {
+        LOG_ERROR("InDevice is nullptr!");
+        return;
+    }
+
+    LOG_DEBUG("{0} start!", _name);
+
+    // Kernel variants, same taps and constants as two pass downscalers
+    std::vector<D3D_SHADER_MACRO> defines;
+
+    switch (Config::Instance()->OutputScalingDownscaler.value_or_default())
+    {
+    case Scaler::Lanczos2:
+        defines = { { "TAP_COUNT", "4" }, { nullptr, nullptr } };
+        break;
+
+    case Scaler::Lanczos3:
+        defines = { { "TAP_COUNT", "6" }, { nullptr, nullptr } };
+        break;
+
+    case Scaler::Kaiser2:
+        defines = { { "TAP_COUNT", "4" }, { "KERNEL_KAISER", "1" }, { "BETA", "5.0f" }, { nullptr, nullptr } };
+        break;
+
+    case Scaler::Kaiser3:
+        defines = { { "TAP_COUNT", "6" }, { "KERNEL_KAISER", "1" }, { "BETA", "6.0f" }, { nullptr, nullptr } };
+        break;
+
+    default:
+        LOG_INFO("[{0}] Downscaler can't be fused with RCAS, using separate passes", _name);
+        return;
+    }
+
+    CD3DX12_DESCRIPTOR_RANGE1 descriptorRanges[] = {
+        // 2 SRVs starting at register t0, space 0
+        CD3DX12_DESCRIPTOR_RANGE1(D3D12_DESCRIPTOR_RANGE_TYPE_SRV, 2, 0, 0),
+
+        // 1 UAV starting at register u0, space 0
+        CD3DX12_DESCRIPTOR_RANGE1(D3D12_DESCRIPTOR_RANGE_TYPE_UAV, 1, 0, 0),
+
+        // 1 CBV starting at register b0, space 0
+        CD3DX12_DESCRIPTOR_RANGE1(D3D12_DESCRIPTOR_RANGE_TYPE_CBV, 1, 0, 0)
+    };
+
+    CD3DX12_ROOT_PARAMETER1 rootParameter {};
+    rootParameter.InitAsDescriptorTable(std::size(descriptorRanges), descriptorRanges);
+
+    CD3DX12_VERSIONED_ROOT_SIGNATURE_DESC rootSigDesc;
+    rootSigDesc.Init_1_1(1, &rootParameter);
+
+    ID3DBlob* errorBlob = nullptr;
+    ID3DBlob* signatureBlob = nullptr;
+
+    do
+    {
+        auto hr = D3D12SerializeVersionedRootSignature(&rootSigDesc, &signatureBlob, &errorBlob);
+
+        if (FAILED(hr))
+        {
+            LOG_ERROR("[{0}] D3D12SerializeVersionedRootSignature error {1:x}", _name, (unsigned int) hr);
+            break;
+        }
+
+        hr = InDevice->CreateRootSignature(0, signatureBlob->GetBufferPointer(), signatureBlob->GetBufferSize(),
+                                           IID_PPV_ARGS(&_rootSignature));
+
+        if (FAILED(hr))
+        {
+            LOG_ERROR("[{0}] CreateRootSignature error {1:x}", _name, (unsigned int) hr);
+            break;
+        }
+
+    } while (false);
+
+    if (errorBlob != nullptr)
+    {
+        errorBlob->Release();
+        errorBlob = nullptr;
+    }
+
+    if (signatureBlob != nullptr)
+    {
+        signatureBlob->Release();
+        signatureBlob = nullptr;
+    }
+
+    if (_rootSignature == nullptr)
+    {
+        LOG_ERROR("[{0}] _rootSignature is null!", _name);
+        return;
+    }
+
+    // No precompiled variants, always compiled on runtime
+    ID3DBlob* _recEncodeShader = OSRCAS_CompileShader(osRcasCode.c_str(), "CSMain", "cs_5_0", defines.data());
+
+    if (_recEncodeShader == nullptr)
+    {
+        LOG_ERROR("[{0}] OSRCAS_CompileShader error!", _name);
+        return;
+    }
+
+    // create pso objects
+    if (!Shader_Dx12::CreateComputeShader(InDevice, _rootSignature, &_pipelineState, _recEncodeShader))
+    {
+        LOG_ERROR("[{0}] CreateComputeShader error!", _name);
+        _recEncodeShader->Release();
+        return;
+    }
+
+    _recEncodeShader->Release();
+    _recEncodeShader = nullptr;
+
+    _init = true;
+}
+
+OSRCAS_Dx12::~OSRCAS_Dx12()
+{
+    if (State::Instance().isShuttingDown)
+        return;
+
+    if (_rootSignature != nullptr)
+    {
+        _rootSignature->Release();
+        _rootSignature = nullptr;
+    }
+
+    if (_pipelineState != nullptr)
+    {
+        _pipelineState->Release();
+        _pipelineState = nullptr;
+    }
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include <shaders/Shader_Dx12.h>
+#include <shaders/DescriptorRing_Dx12.h>
+#include <shaders/rcas/RCAS_Common.h>
+
+#include <d3d12.h>
+#include <d3dx/d3dx12.h>
+
+// Output scaling downscaler with RCAS applied to its input in the same dispatch,
+// replaces RCAS + OS passes and the intermediate buffer round trip between them.
+// Only Lanczos and Kaiser downscalers can be fused, init fails for other downscalers.
+class OSRCAS_Dx12 : public Shader_Dx12
+{
+  private:
+    struct alignas(256) InternalConstants
+    {
+        // Same as RCAS_Dx12
+        float Sharpness;
+        float Contrast;
+
+        int DynamicSharpenEnabled;
+        int DisplaySizeMV;
+        int Debug;
+
+        float MotionSharpness;
+        float MotionTextureScale;
+        float MvScaleX;
+        float MvScaleY;
+        float Threshold;
+        float ScaleLimit;
+        int DisplayWidth;
+        int DisplayHeight;
+
+        // Output scaling
+        int SrcWidth;
+        int SrcHeight;
+        int DstWidth;
+        int DstHeight;
+    };
+
+    uint32_t InNumThreadsX = 8;
+    uint32_t InNumThreadsY = 8;
+
+  public:
+    bool CanDispatch(uint32_t InSrcWidth, uint32_t InSrcHeight, uint32_t InDstWidth, uint32_t InDstHeight) const;
+    bool Dispatch(ID3D12Device* InDevice, ID3D12GraphicsCommandList* InCmdList, ID3D12Resource* InResource,
+                  ID3D12Resource* InMotionVectors, RcasConstants InConstants, ID3D12Resource* OutResource);
+
+    OSRCAS_Dx12(std::string InName, ID3D12Device* InDevice);
+
+    ~OSRCAS_Dx12();
+};
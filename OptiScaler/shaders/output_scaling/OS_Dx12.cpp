@@ -57,9 +57,13 @@ bool OS_Dx12::Dispatch(ID3D12Device* InDevice, ID3D12GraphicsCommandList* InCmdL
 
     LOG_DEBUG("[{0}] Start!", _name);
 
-    _counter++;
-    _counter = _counter % OS_NUM_OF_HEAPS;
-    FrameDescriptorHeap& currentHeap = _frameHeaps[_counter];
+    auto currentHeap = DescriptorRing_Dx12::Allocate(InDevice, InCmdList, 1, 1, 1);
+
+    if (!currentHeap.IsValid())
+    {
+        LOG_ERROR("[{0}] Can't allocate descriptors", _name);
+        return false;
+    }
 
     auto inDesc = InResource->GetDesc();
     auto outDesc = OutResource->GetDesc();
@@ -92,38 +96,27 @@ bool OS_Dx12::Dispatch(ID3D12Device* InDevice, ID3D12GraphicsCommandList* InCmdL
     constants.destHeight = State::Instance().currentFeature->DisplayHeight();
 
     // Create CBV for Constants
-    D3D12_CONSTANT_BUFFER_VIEW_DESC cbvDesc = {};
+    bool constantsWritten;
 
     // fsr upscaling
     if (Config::Instance()->OutputScalingDownscaler.value_or_default() == Scaler::FSR1)
     {
-        // Copy the updated constant buffer data to the constant buffer resource
-        UINT8* pCBDataBegin;
-        CD3DX12_RANGE readRange(0, 0); // We do not intend to read from this resource on the CPU
-        _constantBuffer->Map(0, &readRange, reinterpret_cast<void**>(&pCBDataBegin));
-        memcpy(pCBDataBegin, &fsr1Constants, sizeof(fsr1Constants));
-        _constantBuffer->Unmap(0, nullptr);
-
-        cbvDesc.BufferLocation = _constantBuffer->GetGPUVirtualAddress();
-        cbvDesc.SizeInBytes = sizeof(fsr1Constants);
+        constantsWritten = DescriptorRing_Dx12::WriteConstants(InDevice, InCmdList, &fsr1Constants,
+                                                               sizeof(fsr1Constants), currentHeap.GetCbvCPU(0));
     }
     else
     {
-        // Copy the updated constant buffer data to the constant buffer resource
-        UINT8* pCBDataBegin;
-        CD3DX12_RANGE readRange(0, 0); // We do not intend to read from this resource on the CPU
-        _constantBuffer->Map(0, &readRange, reinterpret_cast<void**>(&pCBDataBegin));
-        memcpy(pCBDataBegin, &constants, sizeof(constants));
-        _constantBuffer->Unmap(0, nullptr);
-
-        cbvDesc.BufferLocation = _constantBuffer->GetGPUVirtualAddress();
-        cbvDesc.SizeInBytes = sizeof(constants);
+        constantsWritten = DescriptorRing_Dx12::WriteConstants(InDevice, InCmdList, &constants, sizeof(constants),
+                                                               currentHeap.GetCbvCPU(0));
     }
 
-    InDevice->CreateConstantBufferView(&cbvDesc, currentHeap.GetCbvCPU(0));
+    if (!constantsWritten)
+    {
+        LOG_ERROR("[{0}] Can't write constants!", _name);
+        return false;
+    }
 
-    ID3D12DescriptorHeap* heaps[] = { currentHeap.GetHeapCSU() };
-    InCmdList->SetDescriptorHeaps(_countof(heaps), heaps);
+    DescriptorRing_Dx12::Bind(InCmdList, currentHeap);
 
     InCmdList->SetComputeRootSignature(_rootSignature);
     InCmdList->SetPipelineState(_pipelineState);
@@ -182,11 +175,6 @@ OS_Dx12::OS_Dx12(std::string InName, ID3D12Device* InDevice, bool InUpsample)
         rootSigDesc.Desc_1_1.pStaticSamplers = samplers;
     }
 
-    D3D12_RESOURCE_DESC desc = CD3DX12_RESOURCE_DESC::Buffer(sizeof(Constants));
-    auto heapProps = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD);
-    InDevice->CreateCommittedResource(&heapProps, D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_GENERIC_READ,
-                                      nullptr, IID_PPV_ARGS(&_constantBuffer));
-
     ID3DBlob* errorBlob;
     ID3DBlob* signatureBlob;
 
@@ -379,18 +367,6 @@ OS_Dx12::OS_Dx12(std::string InName, ID3D12Device* InDevice, bool InUpsample)
         }
     }
 
-    ScopedSkipHeapCapture skipHeapCapture {};
-
-    for (int i = 0; i < OS_NUM_OF_HEAPS; i++)
-    {
-        if (!_frameHeaps[i].Initialize(InDevice, 1, 1, 1))
-        {
-            LOG_ERROR("[{0}] Failed to init heap", _name);
-            _init = false;
-            return;
-        }
-    }
-
     _init = true;
 }
 
@@ -411,20 +387,9 @@ OS_Dx12::~OS_Dx12()
         _rootSignature = nullptr;
     }
 
-    for (int i = 0; i < OS_NUM_OF_HEAPS; i++)
-    {
-        _frameHeaps[i].ReleaseHeaps();
-    }
-
     if (_buffer != nullptr)
     {
         _buffer->Release();
         _buffer = nullptr;
     }
-
-    if (_constantBuffer != nullptr)
-    {
-        _constantBuffer->Release();
-        _constantBuffer = nullptr;
-    }
 }
@@ -269,8 +269,8 @@ void OS_Vk::UpdateDescriptorSet(VkCommandBuffer cmdList, int setIndex, VkImageVi
     // 0: UBO
     VkDescriptorBufferInfo bufferInfo {};
     bufferInfo.buffer = _constantBuffer;
-    bufferInfo.offset = 0;
-    bufferInfo.range = sizeof(Constants);
+    bufferInfo.offset = _constantSlotSize * setIndex;
+    bufferInfo.range = _constantSlotSize;
 
     VkWriteDescriptorSet descriptorWriteUBO {};
     descriptorWriteUBO.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
@@ -348,23 +348,20 @@ bool OS_Vk::Dispatch(VkDevice InDevice, VkCommandBuffer InCmdList, VkImageView I
     constants.destWidth = State::Instance().currentFeature->DisplayWidth();
     constants.destHeight = State::Instance().currentFeature->DisplayHeight();
 
-    if (Config::Instance()->OutputScalingDownscaler.value_or_default() == Scaler::FSR1)
-    {
-        if (_mappedConstantBuffer)
-        {
-            memcpy(_mappedConstantBuffer, &fsr1Constants, sizeof(UpscaleShaderConstants));
-        }
-    }
-    else
+    // Each descriptor set has its own constant slot, previous frames may still be reading theirs
+    _currentSetIndex = (_currentSetIndex + 1) % MAX_FRAMES_IN_FLIGHT;
+
+    if (_mappedConstantBuffer)
     {
-        if (_mappedConstantBuffer)
-        {
-            memcpy(_mappedConstantBuffer, &constants, sizeof(Constants));
-        }
+        auto slot = static_cast<uint8_t*>(_mappedConstantBuffer) + _constantSlotSize * _currentSetIndex;
+
+        if (Config::Instance()->OutputScalingDownscaler.value_or_default() == Scaler::FSR1)
+            memcpy(slot, &fsr1Constants, sizeof(UpscaleShaderConstants));
+        else
+            memcpy(slot, &constants, sizeof(Constants));
     }
 
     // Prepare descriptors
-    _currentSetIndex = (_currentSetIndex + 1) % MAX_FRAMES_IN_FLIGHT;
     UpdateDescriptorSet(InCmdList, _currentSetIndex, InResourceView, OutResourceView);
 
     vkCmdBindPipeline(InCmdList, VK_PIPELINE_BIND_POINT_COMPUTE, _pipeline);
@@ -556,12 +553,10 @@ void OS_Vk::SetImageLayout(VkCommandBuffer cmdBuffer, VkImage image, VkImageLayo
 
 void OS_Vk::CreateConstantBuffer()
 {
-    VkDeviceSize bufferSize;
-
-    if (Config::Instance()->OutputScalingDownscaler.value_or_default() == Scaler::FSR1)
-        bufferSize = sizeof(UpscaleShaderConstants);
-    else
-        bufferSize = sizeof(Constants);
+    // Downscaler can be changed from menu, slots fit both constant types
+    _constantSlotSize =
+        Shader_Vk::GetUniformSlotSize(_physicalDevice, (std::max)(sizeof(UpscaleShaderConstants), sizeof(Constants)));
+    VkDeviceSize bufferSize = _constantSlotSize * MAX_FRAMES_IN_FLIGHT;
 
     // Create buffer using Shader_Vk helper
     if (!Shader_Vk::CreateBufferResource(_device, _physicalDevice, &_constantBuffer, &_constantBufferMemory, bufferSize,
@@ -35,6 +35,7 @@ class OS_Vk : public Shader_Vk
     VkDeviceMemory _constantBufferMemory = VK_NULL_HANDLE;
     VkSampler _textureSampler = VK_NULL_HANDLE;
     void* _mappedConstantBuffer = nullptr;
+    VkDeviceSize _constantSlotSize = 0;
     bool _upsample = false;
 
     VkDescriptorPool _descriptorPool = VK_NULL_HANDLE;
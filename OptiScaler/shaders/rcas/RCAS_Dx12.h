@@ -3,11 +3,9 @@
 
 #include <d3d12.h>
 #include <d3dx/d3dx12.h>
-#include <shaders/Shader_Dx12Utils.h>
+#include <shaders/DescriptorRing_Dx12.h>
 #include <shaders/Shader_Dx12.h>
 
-#define RCAS_NUM_OF_HEAPS 2
-
 class RCAS_Dx12 : public Shader_Dx12
 {
   private:
@@ -31,8 +29,6 @@ class RCAS_Dx12 : public Shader_Dx12
         int DisplayHeight;
     };
 
-    FrameDescriptorHeap _frameHeaps[RCAS_NUM_OF_HEAPS];
-
     ID3D12Resource* _buffer = nullptr;
     D3D12_RESOURCE_STATES _bufferState = D3D12_RESOURCE_STATE_COMMON;
 
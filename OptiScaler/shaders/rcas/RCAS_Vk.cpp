@@ -183,8 +183,8 @@ void RCAS_Vk::UpdateDescriptorSet(VkCommandBuffer cmdList, int setIndex, VkImage
     // 0: UBO
     VkDescriptorBufferInfo bufferInfo {};
     bufferInfo.buffer = _constantBuffer;
-    bufferInfo.offset = 0;
-    bufferInfo.range = sizeof(InternalConstants);
+    bufferInfo.offset = _constantSlotSize * setIndex;
+    bufferInfo.range = _constantSlotSize;
 
     VkWriteDescriptorSet descriptorWriteUBO {};
     descriptorWriteUBO.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
@@ -279,13 +279,16 @@ bool RCAS_Vk::Dispatch(VkDevice InDevice, VkCommandBuffer InCmdList, RcasConstan
     else
         constants.MotionTextureScale = (float) InConstants.RenderWidth / (float) InConstants.DisplayWidth;
 
+    // Each descriptor set has its own constant slot, previous frames may still be reading theirs
+    _currentSetIndex = (_currentSetIndex + 1) % MAX_FRAMES_IN_FLIGHT;
+
     if (_mappedConstantBuffer)
     {
-        memcpy(_mappedConstantBuffer, &constants, sizeof(InternalConstants));
+        auto slot = static_cast<uint8_t*>(_mappedConstantBuffer) + _constantSlotSize * _currentSetIndex;
+        memcpy(slot, &constants, sizeof(InternalConstants));
     }
 
     // Prepare descriptors
-    _currentSetIndex = (_currentSetIndex + 1) % MAX_FRAMES_IN_FLIGHT;
     UpdateDescriptorSet(InCmdList, _currentSetIndex, InResourceView, InMotionVectorsView, OutResourceView);
 
     vkCmdBindPipeline(InCmdList, VK_PIPELINE_BIND_POINT_COMPUTE, _pipeline);
@@ -468,7 +471,8 @@ void RCAS_Vk::SetImageLayout(VkCommandBuffer cmdBuffer, VkImage image, VkImageLa
 
 void RCAS_Vk::CreateConstantBuffer()
 {
-    VkDeviceSize bufferSize = sizeof(InternalConstants);
+    _constantSlotSize = Shader_Vk::GetUniformSlotSize(_physicalDevice, sizeof(InternalConstants));
+    VkDeviceSize bufferSize = _constantSlotSize * MAX_FRAMES_IN_FLIGHT;
 
     // Create buffer using Shader_Vk helper
     if (!Shader_Vk::CreateBufferResource(_device, _physicalDevice, &_constantBuffer, &_constantBufferMemory, bufferSize,
@@ -55,6 +55,7 @@ class RCAS_Vk : public Shader_Vk
     VkDeviceMemory _constantBufferMemory = VK_NULL_HANDLE;
     VkSampler _nearestSampler = VK_NULL_HANDLE;
     void* _mappedConstantBuffer = nullptr;
+    VkDeviceSize _constantSlotSize = 0;
 
     VkDescriptorPool _descriptorPool = VK_NULL_HANDLE;
     std::vector<VkDescriptorSet> _descriptorSets;
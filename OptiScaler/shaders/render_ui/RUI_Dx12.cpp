@@ -185,14 +185,12 @@ RUI_Dx12::RUI_Dx12(std::string InName, ID3D12Device* InDevice, bool preMultiplie
 
     ScopedSkipHeapCapture skipHeapCapture {};
 
-    for (int i = 0; i < HC_NUM_OF_HEAPS; i++)
+    // RTV is consumed while recording, shader visible descriptors come from DescriptorRing_Dx12
+    if (!_rtvHeap.Initialize(InDevice, 0, 0, 0, 1))
     {
-        if (!_frameHeaps[i].Initialize(InDevice, 2, 0, 0, 1))
-        {
-            LOG_ERROR("[{0}] Failed to init heap", _name);
-            _init = false;
-            return;
-        }
+        LOG_ERROR("[{0}] Failed to init heap", _name);
+        _init = false;
+        return;
     }
 
     _init = true;
@@ -264,7 +262,13 @@ bool RUI_Dx12::Dispatch(IDXGISwapChain3* sc, ID3D12GraphicsCommandList* cmdList,
     UINT outWidth = scDesc.BufferDesc.Width;
     UINT outHeight = scDesc.BufferDesc.Height;
 
-    FrameDescriptorHeap& currentHeap = _frameHeaps[_counter];
+    auto currentHeap = DescriptorRing_Dx12::Allocate(_device, cmdList, 2, 0, 0);
+
+    if (!currentHeap.IsValid())
+    {
+        LOG_ERROR("[{0}] Can't allocate descriptors", _name);
+        return false;
+    }
 
     // Create views
     {
@@ -289,11 +293,10 @@ bool RUI_Dx12::Dispatch(IDXGISwapChain3* sc, ID3D12GraphicsCommandList* cmdList,
         D3D12_RENDER_TARGET_VIEW_DESC rtv {};
         rtv.ViewDimension = D3D12_RTV_DIMENSION_TEXTURE2D;
         rtv.Format = Shader_Dx12::TranslateTypelessFormats(scDesc.BufferDesc.Format);
-        _device->CreateRenderTargetView(scBuffer, &rtv, currentHeap.GetRtvCPU(0));
+        _device->CreateRenderTargetView(scBuffer, &rtv, _rtvHeap.GetRtvCPU(0));
     }
 
-    ID3D12DescriptorHeap* heaps[] = { currentHeap.GetHeapCSU() };
-    cmdList->SetDescriptorHeaps(_countof(heaps), heaps);
+    DescriptorRing_Dx12::Bind(cmdList, currentHeap);
 
     cmdList->SetGraphicsRootSignature(_rootSignature);
     cmdList->SetPipelineState(_pipelineState);
@@ -301,7 +304,7 @@ bool RUI_Dx12::Dispatch(IDXGISwapChain3* sc, ID3D12GraphicsCommandList* cmdList,
     cmdList->SetGraphicsRootDescriptorTable(0, currentHeap.GetTableGPUStart());
 
     // Set RTV, viewport, scissor
-    D3D12_CPU_DESCRIPTOR_HANDLE rtvHandles[] = { currentHeap.GetRtvCPU(0) };
+    D3D12_CPU_DESCRIPTOR_HANDLE rtvHandles[] = { _rtvHeap.GetRtvCPU(0) };
     cmdList->OMSetRenderTargets(_countof(rtvHandles), rtvHandles, true, nullptr);
 
     D3D12_VIEWPORT vp {};
@@ -339,14 +342,5 @@ RUI_Dx12::~RUI_Dx12()
         _rootSignature = nullptr;
     }
 
-    for (int i = 0; i < HC_NUM_OF_HEAPS; i++)
-    {
-        _frameHeaps[i].ReleaseHeaps();
-    }
-
-    if (_constantBuffer != nullptr)
-    {
-        _constantBuffer->Release();
-        _constantBuffer = nullptr;
-    }
+    _rtvHeap.ReleaseHeaps();
 }
@@ -6,6 +6,7 @@
 #include <d3dx/d3dx12.h>
 #include <dxgi1_6.h>
 #include <shaders/Shader_Dx12Utils.h>
+#include <shaders/DescriptorRing_Dx12.h>
 #include <shaders/Shader_Dx12.h>
 
 #define HC_NUM_OF_HEAPS 2
@@ -14,7 +15,7 @@ class RUI_Dx12 : public Shader_Dx12
 {
   private:
     bool _pm = false;
-    FrameDescriptorHeap _frameHeaps[HC_NUM_OF_HEAPS];
+    FrameDescriptorHeap _rtvHeap;
 
     ID3D12Resource* _buffer[HC_NUM_OF_HEAPS] = {};
     D3D12_RESOURCE_STATES _bufferState[HC_NUM_OF_HEAPS] = { D3D12_RESOURCE_STATE_COMMON, D3D12_RESOURCE_STATE_COMMON };
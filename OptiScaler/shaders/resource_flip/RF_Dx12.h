@@ -4,16 +4,12 @@
 
 #include <d3d12.h>
 #include <d3dx/d3dx12.h>
-#include <shaders/Shader_Dx12Utils.h>
+#include <shaders/DescriptorRing_Dx12.h>
 #include <shaders/Shader_Dx12.h>
 
-#define RF_NUM_OF_HEAPS 2
-
 class RF_Dx12 : public Shader_Dx12
 {
   private:
-    FrameDescriptorHeap _frameHeaps[RF_NUM_OF_HEAPS];
-
     uint32_t InNumThreadsX = 16;
     uint32_t InNumThreadsY = 16;
 
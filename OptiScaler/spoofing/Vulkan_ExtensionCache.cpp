@@ -0,0 +1,286 @@
+#include "pch.h"
+#include "Vulkan_ExtensionCache.h"
+
+#include <algorithm>
+#include <cstring>
+
+static bool NameLess(const VkExtensionProperties& a, const VkExtensionProperties& b)
+{
+    return std::strcmp(a.extensionName, b.extensionName) < 0;
+}
+
+static bool NameEqual(const VkExtensionProperties& a, const VkExtensionProperties& b)
+{
+    return std::strcmp(a.extensionName, b.extensionName) == 0;
+}
+
+template <typename F> VkResult VulkanExtensionCache::Fetch(F&& enumerate, std::vector<VkExtensionProperties>& out)
+{
+    VkResult result = VK_INCOMPLETE;
+
+    // List might grow between count and fill calls (layer loaded meanwhile), retry a few times
+    for (int i = 0; i < 4 && result == VK_INCOMPLETE; i++)
+    {
+        uint32_t count = 0;
+        result = enumerate(&count, nullptr);
+
+        if (result != VK_SUCCESS)
+            return result;
+
+        out.resize(count);
+
+        if (count == 0)
+            break;
+
+        result = enumerate(&count, out.data());
+        out.resize(count);
+    }
+
+    if (result != VK_SUCCESS)
+        return result;
+
+    std::sort(out.begin(), out.end(), NameLess);
+    out.erase(std::unique(out.begin(), out.end(), NameEqual), out.end());
+
+    return VK_SUCCESS;
+}
+
+VulkanExtensionCache::ExtensionList* VulkanExtensionCache::Find(std::vector<ExtensionList>& lists,
+                                                                VkPhysicalDevice physicalDevice,
+                                                                const char* pLayerName)
+{
+    for (auto& list : lists)
+    {
+        if (list.physicalDevice != physicalDevice || list.hasLayer != (pLayerName != nullptr))
+            continue;
+
+        if (pLayerName == nullptr || list.layerName == pLayerName)
+            return &list;
+    }
+
+    return nullptr;
+}
+
+// Caller must hold lock, driver is called without it so a hooked enumerate can't deadlock
+VulkanExtensionCache::ExtensionList* VulkanExtensionCache::GetDeviceList(
+    std::unique_lock<std::mutex>& lock, PFN_vkEnumerateDeviceExtensionProperties enumerate,
+    VkPhysicalDevice physicalDevice, const char* pLayerName, VkResult* result)
+{
+    *result = VK_SUCCESS;
+
+    if (auto list = Find(_deviceLists, physicalDevice, pLayerName); list != nullptr)
+        return list;
+
+    if (enumerate == nullptr)
+    {
+        *result = VK_ERROR_INITIALIZATION_FAILED;
+        return nullptr;
+    }
+
+    ExtensionList list {};
+    list.physicalDevice = physicalDevice;
+    list.hasLayer = pLayerName != nullptr;
+
+    if (pLayerName != nullptr)
+        list.layerName = pLayerName;
+
+    lock.unlock();
+    *result = Fetch([&](uint32_t* pCount, VkExtensionProperties* pProps)
+                    { return enumerate(physicalDevice, pLayerName, pCount, pProps); }, list.real);
+    lock.lock();
+
+    if (*result != VK_SUCCESS)
+    {
+        LOG_ERROR("vkEnumerateDeviceExtensionProperties result: {:X}", (UINT) *result);
+        return nullptr;
+    }
+
+    // Another thread might have read it meanwhile
+    if (auto existing = Find(_deviceLists, physicalDevice, pLayerName); existing != nullptr)
+        return existing;
+
+    LOG_DEBUG("Device {:X} extensions ({}), layer: {}:", (size_t) physicalDevice, list.real.size(),
+              pLayerName != nullptr ? pLayerName : "none");
+
+    for (auto& ext : list.real)
+        LOG_DEBUG("  {}", ext.extensionName);
+
+    _deviceLists.push_back(std::move(list));
+    return &_deviceLists.back();
+}
+
+// Caller must hold lock, driver is called without it
+VulkanExtensionCache::ExtensionList* VulkanExtensionCache::GetInstanceList(
+    std::unique_lock<std::mutex>& lock, PFN_vkEnumerateInstanceExtensionProperties enumerate, const char* pLayerName,
+    VkResult* result)
+{
+    *result = VK_SUCCESS;
+
+    if (auto list = Find(_instanceLists, VK_NULL_HANDLE, pLayerName); list != nullptr)
+        return list;
+
+    if (enumerate == nullptr)
+    {
+        *result = VK_ERROR_INITIALIZATION_FAILED;
+        return nullptr;
+    }
+
+    ExtensionList list {};
+    list.hasLayer = pLayerName != nullptr;
+
+    if (pLayerName != nullptr)
+        list.layerName = pLayerName;
+
+    lock.unlock();
+    *result = Fetch([&](uint32_t* pCount, VkExtensionProperties* pProps)
+                    { return enumerate(pLayerName, pCount, pProps); }, list.real);
+    lock.lock();
+
+    if (*result != VK_SUCCESS)
+    {
+        LOG_ERROR("vkEnumerateInstanceExtensionProperties result: {:X}", (UINT) *result);
+        return nullptr;
+    }
+
+    if (auto existing = Find(_instanceLists, VK_NULL_HANDLE, pLayerName); existing != nullptr)
+        return existing;
+
+    LOG_DEBUG("Instance extensions ({}), layer: {}:", list.real.size(), pLayerName != nullptr ? pLayerName : "none");
+
+    for (auto& ext : list.real)
+        LOG_DEBUG("  {}", ext.extensionName);
+
+    _instanceLists.push_back(std::move(list));
+    return &_instanceLists.back();
+}
+
+const std::vector<VkExtensionProperties>&
+VulkanExtensionCache::Served(ExtensionList& list, const VkExtensionProperties* injected, size_t injectedCount)
+{
+    if (injected == nullptr || injectedCount == 0)
+        return list.real;
+
+    if (list.servedValid && list.servedInjected == injected && list.servedInjectedCount == injectedCount)
+        return list.served;
+
+    list.served = list.real;
+
+    for (size_t i = 0; i < injectedCount; i++)
+    {
+        auto it = std::lower_bound(list.served.begin(), list.served.end(), injected[i], NameLess);
+
+        if (it == list.served.end() || !NameEqual(*it, injected[i]))
+            list.served.insert(it, injected[i]);
+    }
+
+    list.servedInjected = injected;
+    list.servedInjectedCount = injectedCount;
+    list.servedValid = true;
+
+    LOG_DEBUG("Served extension count: {}, driver: {}", list.served.size(), list.real.size());
+
+    return list.served;
+}
+
+bool VulkanExtensionCache::Contains(const std::vector<VkExtensionProperties>& list, const char* name)
+{
+    auto it = std::lower_bound(list.begin(), list.end(), name, [](const VkExtensionProperties& ext, const char* value)
+                               { return std::strcmp(ext.extensionName, value) < 0; });
+
+    return it != list.end() && std::strcmp(it->extensionName, name) == 0;
+}
+
+VkResult VulkanExtensionCache::CopyOut(const std::vector<VkExtensionProperties>& list, uint32_t* pPropertyCount,
+                                       VkExtensionProperties* pProperties)
+{
+    auto size = static_cast<uint32_t>(list.size());
+
+    if (pProperties == nullptr)
+    {
+        *pPropertyCount = size;
+        return VK_SUCCESS;
+    }
+
+    auto count = (std::min)(*pPropertyCount, size);
+
+    if (count > 0)
+        memcpy(pProperties, list.data(), count * sizeof(VkExtensionProperties));
+
+    *pPropertyCount = count;
+
+    return count < size ? VK_INCOMPLETE : VK_SUCCESS;
+}
+
+VkResult VulkanExtensionCache::EnumerateDevice(PFN_vkEnumerateDeviceExtensionProperties enumerate,
+                                               VkPhysicalDevice physicalDevice, const char* pLayerName,
+                                               const VkExtensionProperties* injected, size_t injectedCount,
+                                               uint32_t* pPropertyCount, VkExtensionProperties* pProperties)
+{
+    if (pPropertyCount == nullptr)
+        return VK_ERROR_INITIALIZATION_FAILED;
+
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    VkResult result;
+    auto list = GetDeviceList(lock, enumerate, physicalDevice, pLayerName, &result);
+
+    if (list == nullptr)
+        return result;
+
+    if (pLayerName != nullptr)
+        return CopyOut(list->real, pPropertyCount, pProperties);
+
+    return CopyOut(Served(*list, injected, injectedCount), pPropertyCount, pProperties);
+}
+
+VkResult VulkanExtensionCache::EnumerateInstance(PFN_vkEnumerateInstanceExtensionProperties enumerate,
+                                                 const char* pLayerName, uint32_t* pPropertyCount,
+                                                 VkExtensionProperties* pProperties)
+{
+    if (pPropertyCount == nullptr)
+        return VK_ERROR_INITIALIZATION_FAILED;
+
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    VkResult result;
+    auto list = GetInstanceList(lock, enumerate, pLayerName, &result);
+
+    if (list == nullptr)
+        return result;
+
+    return CopyOut(list->real, pPropertyCount, pProperties);
+}
+
+std::optional<bool> VulkanExtensionCache::DeviceHasExtension(PFN_vkEnumerateDeviceExtensionProperties enumerate,
+                                                             VkPhysicalDevice physicalDevice, const char* name)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    VkResult result;
+    auto list = GetDeviceList(lock, enumerate, physicalDevice, nullptr, &result);
+
+    if (list == nullptr)
+        return std::nullopt;
+
+    return Contains(list->real, name);
+}
+
+std::optional<bool> VulkanExtensionCache::InstanceHasExtension(PFN_vkEnumerateInstanceExtensionProperties enumerate,
+                                                               const char* name)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    VkResult result;
+    auto list = GetInstanceList(lock, enumerate, nullptr, &result);
+
+    if (list == nullptr)
+        return std::nullopt;
+
+    return Contains(list->real, name);
+}
+
+void VulkanExtensionCache::ResetDevices()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _deviceLists.clear();
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "SysUtils.h"
+
+#include <vulkan/vulkan.hpp>
+
+#include <mutex>
+#include <vector>
+#include <optional>
+
+// Driver extension lists, read once and served from memory
+//
+// Lists are cached per physical device (instance extensions per layer), sorted by name and deduplicated.
+// Injected (spoofed) extensions are merged into a separate served list, existing entries keep driver's
+// spec version. Served list is rebuilt only when the injected set changes, callers pass static arrays
+// so the array pointer and count identify the set.
+// Enumerate functions are passed in by the caller, nothing is hooked here.
+
+class VulkanExtensionCache
+{
+  private:
+    struct ExtensionList
+    {
+        VkPhysicalDevice physicalDevice = VK_NULL_HANDLE;
+        std::string layerName;
+        bool hasLayer = false;
+
+        // Sorted by name, driver reported
+        std::vector<VkExtensionProperties> real;
+
+        // Sorted by name, driver reported + injected
+        std::vector<VkExtensionProperties> served;
+        const VkExtensionProperties* servedInjected = nullptr;
+        size_t servedInjectedCount = 0;
+        bool servedValid = false;
+    };
+
+    inline static std::mutex _mutex;
+    inline static std::vector<ExtensionList> _deviceLists;
+    inline static std::vector<ExtensionList> _instanceLists;
+
+    template <typename F> static VkResult Fetch(F&& enumerate, std::vector<VkExtensionProperties>& out);
+
+    static ExtensionList* Find(std::vector<ExtensionList>& lists, VkPhysicalDevice physicalDevice,
+                               const char* pLayerName);
+
+    static ExtensionList* GetDeviceList(std::unique_lock<std::mutex>& lock,
+                                        PFN_vkEnumerateDeviceExtensionProperties enumerate,
+                                        VkPhysicalDevice physicalDevice, const char* pLayerName, VkResult* result);
+    static ExtensionList* GetInstanceList(std::unique_lock<std::mutex>& lock,
+                                          PFN_vkEnumerateInstanceExtensionProperties enumerate,
+                                          const char* pLayerName, VkResult* result);
+
+    static const std::vector<VkExtensionProperties>& Served(ExtensionList& list, const VkExtensionProperties* injected,
+                                                            size_t injectedCount);
+
+    static bool Contains(const std::vector<VkExtensionProperties>& list, const char* name);
+    static VkResult CopyOut(const std::vector<VkExtensionProperties>& list, uint32_t* pPropertyCount,
+                            VkExtensionProperties* pProperties);
+
+  public:
+    // Same semantics as vkEnumerateDeviceExtensionProperties, injected extensions are only
+    // merged into implementation list (pLayerName == nullptr)
+    static VkResult EnumerateDevice(PFN_vkEnumerateDeviceExtensionProperties enumerate,
+                                    VkPhysicalDevice physicalDevice, const char* pLayerName,
+                                    const VkExtensionProperties* injected, size_t injectedCount,
+                                    uint32_t* pPropertyCount, VkExtensionProperties* pProperties);
+
+    static VkResult EnumerateInstance(PFN_vkEnumerateInstanceExtensionProperties enumerate, const char* pLayerName,
+                                      uint32_t* pPropertyCount, VkExtensionProperties* pProperties);
+
+    // Checks driver reported lists, nullopt when list couldn't be read
+    static std::optional<bool> DeviceHasExtension(PFN_vkEnumerateDeviceExtensionProperties enumerate,
+                                                  VkPhysicalDevice physicalDevice, const char* name);
+    static std::optional<bool> InstanceHasExtension(PFN_vkEnumerateInstanceExtensionProperties enumerate,
+                                                    const char* name);
+
+    // Physical device handles of a destroyed instance might be reused for another device
+    static void ResetDevices();
+};
@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "Vulkan_Spoofing.h"
+#include "Vulkan_ExtensionCache.h"
 
 #include <Config.h>
 #include <SysUtils.h>
@@ -13,9 +14,6 @@
 
 #include <vulkan/vulkan_core.h>
 
-static std::map<std::string, bool> vkDeviceExtensions;
-static std::map<std::string, bool> vkInstanceExtensions;
-
 typedef struct VkDummyProps
 {
     VkStructureType sType;
@@ -31,10 +29,53 @@ static PFN_vkGetPhysicalDeviceMemoryProperties2KHR o_vkGetPhysicalDeviceMemoryPr
 static PFN_vkEnumerateDeviceExtensionProperties o_vkEnumerateDeviceExtensionProperties = nullptr;
 static PFN_vkEnumerateInstanceExtensionProperties o_vkEnumerateInstanceExtensionProperties = nullptr;
 
-static uint32_t vkEnumerateInstanceExtensionPropertiesCount = 0;
-static uint32_t vkEnumerateDeviceExtensionPropertiesCount = 0;
-static bool vkEnumerateDeviceExtensionPropertiesListed = false;
-static bool vkEnumerateInstanceExtensionPropertiesListed = false;
+// Reported to games for Nvidia extension spoofing, last two only with DLSSG inputs
+static const VkExtensionProperties spoofedDeviceExtensions[] = {
+    { VK_EXT_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME, VK_EXT_BUFFER_DEVICE_ADDRESS_SPEC_VERSION },
+    { VK_NV_LOW_LATENCY_EXTENSION_NAME, VK_NV_LOW_LATENCY_SPEC_VERSION },
+    { VK_NVX_MULTIVIEW_PER_VIEW_ATTRIBUTES_EXTENSION_NAME, VK_NVX_MULTIVIEW_PER_VIEW_ATTRIBUTES_SPEC_VERSION },
+    { VK_NVX_IMAGE_VIEW_HANDLE_EXTENSION_NAME, VK_NVX_IMAGE_VIEW_HANDLE_SPEC_VERSION },
+    { VK_NVX_BINARY_IMPORT_EXTENSION_NAME, VK_NVX_BINARY_IMPORT_SPEC_VERSION },
+    { VK_NV_OPTICAL_FLOW_EXTENSION_NAME, VK_NV_OPTICAL_FLOW_SPEC_VERSION },
+    { VK_NV_PRESENT_METERING_EXTENSION_NAME, VK_NV_PRESENT_METERING_SPEC_VERSION },
+};
+
+// Streamline's extensions, removed from device create info when not running on Nvidia
+static const char* const streamlineDeviceExtensions[] = {
+    VK_NVX_BINARY_IMPORT_EXTENSION_NAME,
+    VK_NVX_IMAGE_VIEW_HANDLE_EXTENSION_NAME,
+    VK_EXT_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME,
+    VK_NVX_MULTIVIEW_PER_VIEW_ATTRIBUTES_EXTENSION_NAME,
+    VK_NV_LOW_LATENCY_EXTENSION_NAME,
+    VK_NV_OPTICAL_FLOW_EXTENSION_NAME,
+    VK_NV_PRESENT_METERING_EXTENSION_NAME,
+};
+
+// Original functions when hooked, loader's exports otherwise
+static PFN_vkEnumerateDeviceExtensionProperties DeviceEnumerate()
+{
+    return o_vkEnumerateDeviceExtensionProperties != nullptr ? o_vkEnumerateDeviceExtensionProperties
+                                                             : vkEnumerateDeviceExtensionProperties;
+}
+
+static PFN_vkEnumerateInstanceExtensionProperties InstanceEnumerate()
+{
+    return o_vkEnumerateInstanceExtensionProperties != nullptr ? o_vkEnumerateInstanceExtensionProperties
+                                                               : vkEnumerateInstanceExtensionProperties;
+}
+
+// Enabled extension lists keep their capacity between calls and skip duplicates
+static void AddExtension(std::vector<const char*>& list, const char* name)
+{
+    for (auto ext : list)
+    {
+        if (std::strcmp(ext, name) == 0)
+            return;
+    }
+
+    LOG_DEBUG("  Adding {}", name);
+    list.push_back(name);
+}
 
 inline static void hkvkGetPhysicalDeviceMemoryProperties(VkPhysicalDevice physicalDevice,
                                                          VkPhysicalDeviceMemoryProperties* pMemoryProperties)
@@ -264,6 +305,9 @@ VkResult VulkanSpoofing::hkvkCreateInstance(VkInstanceCreateInfo* pCreateInfo, c
     if (pCreateInfo->pApplicationInfo != nullptr && pCreateInfo->pApplicationInfo->pApplicationName != nullptr)
         LOG_DEBUG("ApplicationName: {}", pCreateInfo->pApplicationInfo->pApplicationName);
 
+    // Physical device handles of previous instances might be reused
+    VulkanExtensionCache::ResetDevices();
+
     static std::vector<const char*> newExtensionList;
     newExtensionList.clear();
 
@@ -274,53 +318,27 @@ VkResult VulkanSpoofing::hkvkCreateInstance(VkInstanceCreateInfo* pCreateInfo, c
         newExtensionList.push_back(pCreateInfo->ppEnabledExtensionNames[i]);
     }
 
+    // When driver list can't be read extensions are added anyway
+    auto addIfSupported = [](const char* name)
+    {
+        if (VulkanExtensionCache::InstanceHasExtension(InstanceEnumerate(), name).value_or(true))
+            AddExtension(newExtensionList, name);
+    };
+
     if (State::Instance().isRunningOnNvidia && Config::Instance()->DLSSEnabled.value_or_default())
     {
         LOG_INFO("Adding NVNGX Vulkan extensions");
-        if (vkInstanceExtensions.size() == 0 ||
-            vkInstanceExtensions.contains(std::string(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME)))
-        {
-            LOG_DEBUG("  Adding {}", VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
-            newExtensionList.push_back(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
-        }
-
-        if (vkInstanceExtensions.size() == 0 ||
-            vkInstanceExtensions.contains(std::string(VK_KHR_EXTERNAL_MEMORY_CAPABILITIES_EXTENSION_NAME)))
-        {
-            LOG_DEBUG("  Adding {}", VK_KHR_EXTERNAL_MEMORY_CAPABILITIES_EXTENSION_NAME);
-            newExtensionList.push_back(VK_KHR_EXTERNAL_MEMORY_CAPABILITIES_EXTENSION_NAME);
-        }
-
-        if (vkInstanceExtensions.size() == 0 ||
-            vkInstanceExtensions.contains(std::string(VK_KHR_EXTERNAL_SEMAPHORE_CAPABILITIES_EXTENSION_NAME)))
-        {
-            LOG_DEBUG("  Adding {}", VK_KHR_EXTERNAL_SEMAPHORE_CAPABILITIES_EXTENSION_NAME);
-            newExtensionList.push_back(VK_KHR_EXTERNAL_SEMAPHORE_CAPABILITIES_EXTENSION_NAME);
-        }
+        addIfSupported(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
+        addIfSupported(VK_KHR_EXTERNAL_MEMORY_CAPABILITIES_EXTENSION_NAME);
+        addIfSupported(VK_KHR_EXTERNAL_SEMAPHORE_CAPABILITIES_EXTENSION_NAME);
     }
 
     LOG_INFO("Adding FFX Vulkan extensions");
-    if (vkInstanceExtensions.size() == 0 ||
-        vkInstanceExtensions.contains(std::string(VK_EXT_DEBUG_UTILS_EXTENSION_NAME)))
-    {
-        LOG_DEBUG("  Adding {}", VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
-        newExtensionList.push_back(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
-    }
+    addIfSupported(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
 
     LOG_INFO("Adding Vulkan w/Dx12 extensions");
-    if (vkInstanceExtensions.size() == 0 ||
-        vkInstanceExtensions.contains(std::string(VK_KHR_EXTERNAL_MEMORY_CAPABILITIES_EXTENSION_NAME)))
-    {
-        LOG_DEBUG("  Adding {}", VK_KHR_EXTERNAL_MEMORY_CAPABILITIES_EXTENSION_NAME);
-        newExtensionList.push_back(VK_KHR_EXTERNAL_MEMORY_CAPABILITIES_EXTENSION_NAME);
-    }
-
-    if (vkInstanceExtensions.size() == 0 ||
-        vkInstanceExtensions.contains(std::string(VK_KHR_EXTERNAL_SEMAPHORE_CAPABILITIES_EXTENSION_NAME)))
-    {
-        LOG_DEBUG("  Adding {}", VK_KHR_EXTERNAL_SEMAPHORE_CAPABILITIES_EXTENSION_NAME);
-        newExtensionList.push_back(VK_KHR_EXTERNAL_SEMAPHORE_CAPABILITIES_EXTENSION_NAME);
-    }
+    addIfSupported(VK_KHR_EXTERNAL_MEMORY_CAPABILITIES_EXTENSION_NAME);
+    addIfSupported(VK_KHR_EXTERNAL_SEMAPHORE_CAPABILITIES_EXTENSION_NAME);
 
     LOG_DEBUG("Layer count: {}", pCreateInfo->enabledLayerCount);
     for (size_t i = 0; i < pCreateInfo->enabledLayerCount; i++)
@@ -357,7 +375,7 @@ VkResult VulkanSpoofing::hkvkCreateInstance(VkInstanceCreateInfo* pCreateInfo, c
 
     next->pNext = &debugCreateInfo;
 
-    newExtensionList.push_back(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+    AddExtension(newExtensionList, VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
 #endif
 
     pCreateInfo->enabledExtensionCount = static_cast<uint32_t>(newExtensionList.size());
@@ -374,162 +392,76 @@ VkResult VulkanSpoofing::hkvkCreateDevice(VkPhysicalDevice physicalDevice, VkDev
     static std::vector<const char*> newExtensionList;
     newExtensionList.clear();
 
+    auto removeStreamline =
+        Config::Instance()->VulkanExtensionSpoofing.value_or_default() && !State::Instance().isRunningOnNvidia;
+
+    auto isStreamline = [](const char* extName)
+    {
+        return std::any_of(std::begin(streamlineDeviceExtensions), std::end(streamlineDeviceExtensions),
+                           [extName](const char* name) { return std::strcmp(extName, name) == 0; });
+    };
+
     LOG_DEBUG("Checking extensions and removing Streamline ones");
     for (size_t i = 0; i < pCreateInfo->enabledExtensionCount; i++)
     {
         auto extName = pCreateInfo->ppEnabledExtensionNames[i];
 
-        if (Config::Instance()->VulkanExtensionSpoofing.value_or_default() && !State::Instance().isRunningOnNvidia)
+        if (removeStreamline && isStreamline(extName))
         {
-            auto binaryImport = std::strcmp(extName, VK_NVX_BINARY_IMPORT_EXTENSION_NAME) == 0;
-            auto imgViewHandle = std::strcmp(extName, VK_NVX_IMAGE_VIEW_HANDLE_EXTENSION_NAME) == 0;
-            auto bufferDeviceAddr = std::strcmp(extName, VK_EXT_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME) == 0;
-            auto mvPerViewAttr = std::strcmp(extName, VK_NVX_MULTIVIEW_PER_VIEW_ATTRIBUTES_EXTENSION_NAME) == 0;
-            auto nvLowLatency = std::strcmp(extName, VK_NV_LOW_LATENCY_EXTENSION_NAME) == 0;
-            auto nvOpticalFlow = std::strcmp(extName, VK_NV_OPTICAL_FLOW_EXTENSION_NAME) == 0;
-            auto nvPresentMeter = std::strcmp(extName, VK_NV_PRESENT_METERING_EXTENSION_NAME) == 0;
-
-            if (binaryImport || imgViewHandle || bufferDeviceAddr || mvPerViewAttr || nvLowLatency || nvOpticalFlow ||
-                nvPresentMeter)
-            {
-                LOG_DEBUG("Removing {}", extName);
-                continue;
-            }
+            LOG_DEBUG("Removing {}", extName);
+            continue;
         }
 
         // LOG_DEBUG("Adding {}", extName);
         newExtensionList.push_back(extName);
     }
 
+    // When driver list can't be read extensions are added anyway
+    auto hasExtension = [physicalDevice](const char* name)
+    { return VulkanExtensionCache::DeviceHasExtension(DeviceEnumerate(), physicalDevice, name); };
+
+    auto addIfSupported = [&hasExtension](const char* name)
+    {
+        if (hasExtension(name).value_or(true))
+            AddExtension(newExtensionList, name);
+    };
+
     const bool isPascalOrOlder = State::Instance().isPascalOrOlder;
     if (State::Instance().isRunningOnNvidia)
     {
         LOG_INFO("Adding NVNGX Vulkan extensions");
-        if (vkDeviceExtensions.size() == 0 ||
-            vkDeviceExtensions.contains(std::string(VK_NVX_MULTIVIEW_PER_VIEW_ATTRIBUTES_EXTENSION_NAME)))
-        {
-            LOG_DEBUG("  Adding {}", VK_NVX_MULTIVIEW_PER_VIEW_ATTRIBUTES_EXTENSION_NAME);
-            newExtensionList.push_back(VK_NVX_MULTIVIEW_PER_VIEW_ATTRIBUTES_EXTENSION_NAME);
-        }
-
-        if (vkDeviceExtensions.size() == 0 ||
-            vkDeviceExtensions.contains(std::string(VK_NV_LOW_LATENCY_EXTENSION_NAME)))
-        {
-            LOG_DEBUG("  Adding {}", VK_NV_LOW_LATENCY_EXTENSION_NAME);
-            newExtensionList.push_back(VK_NV_LOW_LATENCY_EXTENSION_NAME);
-        }
-
-        if (vkDeviceExtensions.size() == 0 ||
-            vkDeviceExtensions.contains(std::string(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME)))
-        {
-            LOG_DEBUG("  Adding {}", VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME);
-            newExtensionList.push_back(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME);
-        }
-
-        if (vkDeviceExtensions.size() == 0 ||
-            vkDeviceExtensions.contains(std::string(VK_EXT_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME)))
-        {
-            LOG_DEBUG("  Adding {}", VK_EXT_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME);
-            newExtensionList.push_back(VK_EXT_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME);
-        }
+        addIfSupported(VK_NVX_MULTIVIEW_PER_VIEW_ATTRIBUTES_EXTENSION_NAME);
+        addIfSupported(VK_NV_LOW_LATENCY_EXTENSION_NAME);
+        addIfSupported(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME);
+        addIfSupported(VK_EXT_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME);
 
         if (!isPascalOrOlder)
         {
-            if (vkDeviceExtensions.size() == 0 ||
-                vkDeviceExtensions.contains(std::string(VK_NVX_BINARY_IMPORT_EXTENSION_NAME)))
-            {
-                LOG_DEBUG("  Adding {}", VK_NVX_BINARY_IMPORT_EXTENSION_NAME);
-                newExtensionList.push_back(VK_NVX_BINARY_IMPORT_EXTENSION_NAME);
-            }
-
-            if (vkDeviceExtensions.size() == 0 ||
-                vkDeviceExtensions.contains(std::string(VK_NVX_IMAGE_VIEW_HANDLE_EXTENSION_NAME)))
-            {
-                LOG_DEBUG("  Adding {}", VK_NVX_IMAGE_VIEW_HANDLE_EXTENSION_NAME);
-                newExtensionList.push_back(VK_NVX_IMAGE_VIEW_HANDLE_EXTENSION_NAME);
-            }
+            addIfSupported(VK_NVX_BINARY_IMPORT_EXTENSION_NAME);
+            addIfSupported(VK_NVX_IMAGE_VIEW_HANDLE_EXTENSION_NAME);
         }
     }
 
     LOG_INFO("Adding FFX Vulkan extensions");
-    if (vkDeviceExtensions.size() == 0 ||
-        vkDeviceExtensions.contains(std::string(VK_KHR_GET_MEMORY_REQUIREMENTS_2_EXTENSION_NAME)))
-    {
-        LOG_DEBUG("  Adding {}", VK_KHR_GET_MEMORY_REQUIREMENTS_2_EXTENSION_NAME);
-        newExtensionList.push_back(VK_KHR_GET_MEMORY_REQUIREMENTS_2_EXTENSION_NAME);
-    }
-
-    if (vkDeviceExtensions.size() == 0 ||
-        vkDeviceExtensions.contains(std::string(VK_KHR_EXTERNAL_MEMORY_EXTENSION_NAME)))
-    {
-        LOG_DEBUG("  Adding {}", VK_KHR_EXTERNAL_MEMORY_EXTENSION_NAME);
-        newExtensionList.push_back(VK_KHR_EXTERNAL_MEMORY_EXTENSION_NAME);
-    }
-
-    if (vkDeviceExtensions.size() == 0 ||
-        vkDeviceExtensions.contains(std::string(VK_KHR_EXTERNAL_MEMORY_WIN32_EXTENSION_NAME)))
-    {
-        LOG_DEBUG("  Adding {}", VK_KHR_EXTERNAL_MEMORY_WIN32_EXTENSION_NAME);
-        newExtensionList.push_back(VK_KHR_EXTERNAL_MEMORY_WIN32_EXTENSION_NAME);
-    }
+    addIfSupported(VK_KHR_GET_MEMORY_REQUIREMENTS_2_EXTENSION_NAME);
+    addIfSupported(VK_KHR_EXTERNAL_MEMORY_EXTENSION_NAME);
+    addIfSupported(VK_KHR_EXTERNAL_MEMORY_WIN32_EXTENSION_NAME);
+    addIfSupported(VK_KHR_EXTERNAL_SEMAPHORE_EXTENSION_NAME);
+    addIfSupported(VK_KHR_EXTERNAL_SEMAPHORE_WIN32_EXTENSION_NAME);
+    addIfSupported(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
 
-    if (vkDeviceExtensions.size() == 0 ||
-        vkDeviceExtensions.contains(std::string(VK_KHR_EXTERNAL_SEMAPHORE_EXTENSION_NAME)))
-    {
-        LOG_DEBUG("  Adding {}", VK_KHR_EXTERNAL_SEMAPHORE_EXTENSION_NAME);
-        newExtensionList.push_back(VK_KHR_EXTERNAL_SEMAPHORE_EXTENSION_NAME);
-    }
-
-    if (vkDeviceExtensions.size() == 0 ||
-        vkDeviceExtensions.contains(std::string(VK_KHR_EXTERNAL_SEMAPHORE_WIN32_EXTENSION_NAME)))
-    {
-        LOG_DEBUG("  Adding {}", VK_KHR_EXTERNAL_SEMAPHORE_WIN32_EXTENSION_NAME);
-        newExtensionList.push_back(VK_KHR_EXTERNAL_SEMAPHORE_WIN32_EXTENSION_NAME);
-    }
-
-    if (vkDeviceExtensions.size() == 0 ||
-        vkDeviceExtensions.contains(std::string(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME)))
-    {
-        LOG_DEBUG("  Adding {}", VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
-        newExtensionList.push_back(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
-    }
-
-    if (vkDeviceExtensions.contains(std::string(VK_KHR_DEDICATED_ALLOCATION_EXTENSION_NAME)))
-    {
-        LOG_DEBUG("  Adding {}", VK_KHR_DEDICATED_ALLOCATION_EXTENSION_NAME);
-        newExtensionList.push_back(VK_KHR_DEDICATED_ALLOCATION_EXTENSION_NAME);
-    }
+    // Only when driver reports it
+    if (hasExtension(VK_KHR_DEDICATED_ALLOCATION_EXTENSION_NAME).value_or(false))
+        AddExtension(newExtensionList, VK_KHR_DEDICATED_ALLOCATION_EXTENSION_NAME);
 
     LOG_INFO("Adding XeSS Vulkan extensions");
-    if (vkDeviceExtensions.size() == 0 ||
-        vkDeviceExtensions.contains(std::string(VK_KHR_SHADER_FLOAT16_INT8_EXTENSION_NAME)))
-    {
-        LOG_DEBUG("  Adding {}", VK_KHR_SHADER_FLOAT16_INT8_EXTENSION_NAME);
-        newExtensionList.push_back(VK_KHR_SHADER_FLOAT16_INT8_EXTENSION_NAME);
-    }
-
-    if (vkDeviceExtensions.size() == 0 ||
-        vkDeviceExtensions.contains(std::string(VK_KHR_SHADER_INTEGER_DOT_PRODUCT_EXTENSION_NAME)))
-    {
-        LOG_DEBUG("  Adding {}", VK_KHR_SHADER_INTEGER_DOT_PRODUCT_EXTENSION_NAME);
-        newExtensionList.push_back(VK_KHR_SHADER_INTEGER_DOT_PRODUCT_EXTENSION_NAME);
-    }
-
-    if (vkDeviceExtensions.size() == 0 ||
-        vkDeviceExtensions.contains(std::string(VK_EXT_MUTABLE_DESCRIPTOR_TYPE_EXTENSION_NAME)))
-    {
-        LOG_DEBUG("  Adding {}", VK_EXT_MUTABLE_DESCRIPTOR_TYPE_EXTENSION_NAME);
-        newExtensionList.push_back(VK_EXT_MUTABLE_DESCRIPTOR_TYPE_EXTENSION_NAME);
-    }
+    addIfSupported(VK_KHR_SHADER_FLOAT16_INT8_EXTENSION_NAME);
+    addIfSupported(VK_KHR_SHADER_INTEGER_DOT_PRODUCT_EXTENSION_NAME);
+    addIfSupported(VK_EXT_MUTABLE_DESCRIPTOR_TYPE_EXTENSION_NAME);
 
 #ifdef USE_QUEUE_SUBMIT_2_KHR
     LOG_INFO("Adding QueueSubmit2 Vulkan extensions");
-    if (vkDeviceExtensions.size() == 0 ||
-        vkDeviceExtensions.contains(std::string(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME)))
-    {
-        LOG_DEBUG("  Adding {}", VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME);
-        newExtensionList.push_back(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME);
-    }
+    addIfSupported(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME);
 #endif
 
     pCreateInfo->enabledExtensionCount = static_cast<uint32_t>(newExtensionList.size());
@@ -552,91 +484,29 @@ inline static VkResult hkvkEnumerateDeviceExtensionProperties(VkPhysicalDevice p
 {
     LOG_FUNC();
 
-    uint32_t count = 0;
-
-    if (pPropertyCount != nullptr)
-        count = *pPropertyCount;
-
-    if (pProperties == nullptr)
-        count = 0;
+    if (pPropertyCount == nullptr)
+        return o_vkEnumerateDeviceExtensionProperties(physicalDevice, pLayerName, pPropertyCount, pProperties);
 
-    auto result = o_vkEnumerateDeviceExtensionProperties(physicalDevice, pLayerName, pPropertyCount, pProperties);
-
-    if (result != VK_SUCCESS)
-    {
-        LOG_ERROR("o_vkEnumerateDeviceExtensionProperties({}) result: {:X}", count, (UINT) result);
-        return result;
-    }
+    // Driver is only called once per physical device, spoofed extensions are merged into cached list
+    const VkExtensionProperties* injected = nullptr;
+    size_t injectedCount = 0;
 
     if (!State::Instance().skipSpoofing)
     {
-        // Count query, modify and add 5 to final count
-        if (pProperties == nullptr && pPropertyCount != nullptr && count == 0)
-        {
-            if (State::Instance().activeFgInput == FGInput::DLSSG || State::Instance().activeFgInput == FGInput::Nukems)
-                *pPropertyCount += 7;
-            else
-                *pPropertyCount += 5;
-
-            vkEnumerateDeviceExtensionPropertiesCount = *pPropertyCount;
-            LOG_TRACE("vkEnumerateDeviceExtensionProperties count: {}", *pPropertyCount);
-            return result;
-        }
-
-        // If this is request of our modified count query (count == vkEnumerateDeviceExtensionPropertiesCount)
-        if (pProperties != nullptr && pPropertyCount != nullptr && *pPropertyCount > 0 &&
-            count == vkEnumerateDeviceExtensionPropertiesCount)
-        {
-            // Set back modified extension count
-            *pPropertyCount = count;
-
-            // And fill extension info at the end
-            VkExtensionProperties bi { VK_NVX_BINARY_IMPORT_EXTENSION_NAME, VK_NVX_BINARY_IMPORT_SPEC_VERSION };
-            memcpy(&pProperties[*pPropertyCount - 1], &bi, sizeof(VkExtensionProperties));
+        injected = spoofedDeviceExtensions;
 
-            VkExtensionProperties ivh { VK_NVX_IMAGE_VIEW_HANDLE_EXTENSION_NAME,
-                                        VK_NVX_IMAGE_VIEW_HANDLE_SPEC_VERSION };
-            memcpy(&pProperties[*pPropertyCount - 2], &ivh, sizeof(VkExtensionProperties));
-
-            VkExtensionProperties mpva { VK_NVX_MULTIVIEW_PER_VIEW_ATTRIBUTES_EXTENSION_NAME,
-                                         VK_NVX_MULTIVIEW_PER_VIEW_ATTRIBUTES_SPEC_VERSION };
-            memcpy(&pProperties[*pPropertyCount - 3], &mpva, sizeof(VkExtensionProperties));
-
-            VkExtensionProperties ll { VK_NV_LOW_LATENCY_EXTENSION_NAME, VK_NV_LOW_LATENCY_SPEC_VERSION };
-            memcpy(&pProperties[*pPropertyCount - 4], &ll, sizeof(VkExtensionProperties));
-
-            VkExtensionProperties bda { VK_EXT_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME,
-                                        VK_EXT_BUFFER_DEVICE_ADDRESS_SPEC_VERSION };
-            memcpy(&pProperties[*pPropertyCount - 5], &bda, sizeof(VkExtensionProperties));
-
-            if (State::Instance().activeFgInput == FGInput::DLSSG || State::Instance().activeFgInput == FGInput::Nukems)
-            {
-                VkExtensionProperties of { VK_NV_OPTICAL_FLOW_EXTENSION_NAME, VK_NV_OPTICAL_FLOW_SPEC_VERSION };
-                memcpy(&pProperties[*pPropertyCount - 6], &of, sizeof(VkExtensionProperties));
-
-                VkExtensionProperties pm { VK_NV_PRESENT_METERING_EXTENSION_NAME, VK_NV_PRESENT_METERING_SPEC_VERSION };
-                memcpy(&pProperties[*pPropertyCount - 7], &pm, sizeof(VkExtensionProperties));
-            }
-        }
+        if (State::Instance().activeFgInput == FGInput::DLSSG || State::Instance().activeFgInput == FGInput::Nukems)
+            injectedCount = std::size(spoofedDeviceExtensions);
         else
-        {
-            LOG_DEBUG("Not adding any extensions!");
-        }
+            injectedCount = std::size(spoofedDeviceExtensions) - 2;
     }
 
-    if (!vkEnumerateDeviceExtensionPropertiesListed && count != 0)
-    {
-        vkEnumerateDeviceExtensionPropertiesListed = true;
+    auto result = VulkanExtensionCache::EnumerateDevice(o_vkEnumerateDeviceExtensionProperties, physicalDevice,
+                                                        pLayerName, injected, injectedCount, pPropertyCount,
+                                                        pProperties);
 
-        LOG_DEBUG("Extensions returned:");
-        for (uint32_t i = 0; i < *pPropertyCount; i++)
-        {
-            LOG_DEBUG("  {}", pProperties[i].extensionName);
-
-            if (i < (*pPropertyCount - 5))
-                vkDeviceExtensions.insert_or_assign(std::string(pProperties[i].extensionName), true);
-        }
-    }
+    if (result != VK_SUCCESS && result != VK_INCOMPLETE)
+        LOG_ERROR("EnumerateDevice result: {:X}", (UINT) result);
 
     LOG_FUNC_RESULT(result);
 
@@ -648,59 +518,30 @@ inline static VkResult hkvkEnumerateInstanceExtensionProperties(const char* pLay
 {
     LOG_FUNC();
 
-    auto count = *pPropertyCount;
-
-    if (pProperties == nullptr)
-        count = 0;
-
-    auto result = o_vkEnumerateInstanceExtensionProperties(pLayerName, pPropertyCount, pProperties);
+    if (pPropertyCount == nullptr)
+        return o_vkEnumerateInstanceExtensionProperties(pLayerName, pPropertyCount, pProperties);
 
-    if (result != VK_SUCCESS)
-    {
-        LOG_ERROR("o_vkEnumerateInstanceExtensionProperties({}) result: {:X}", count, (UINT) result);
-        return result;
-    }
+    auto result = VulkanExtensionCache::EnumerateInstance(o_vkEnumerateInstanceExtensionProperties, pLayerName,
+                                                          pPropertyCount, pProperties);
 
-    if (!State::Instance().skipSpoofing)
-    {
-        if (pLayerName == nullptr && pProperties == nullptr && count == 0)
-        {
-            LOG_TRACE("hkvkEnumerateDeviceExtensionProperties count: {}", vkEnumerateDeviceExtensionPropertiesCount);
-            return result;
-        }
-    }
-
-    if (pPropertyCount != nullptr && pProperties != nullptr && count != 0)
-    {
-        if (!vkEnumerateInstanceExtensionPropertiesListed)
-        {
-            vkEnumerateInstanceExtensionPropertiesListed = true;
-
-            LOG_DEBUG("Extensions returned:");
-            for (size_t i = 0; i < *pPropertyCount; i++)
-            {
-                LOG_DEBUG("  {}", pProperties[i].extensionName);
-                vkInstanceExtensions.insert_or_assign(std::string(pProperties[i].extensionName), true);
-            }
-        }
-    }
+    if (result != VK_SUCCESS && result != VK_INCOMPLETE)
+        LOG_ERROR("EnumerateInstance result: {:X}", (UINT) result);
 
     LOG_FUNC_RESULT(result);
 
     return result;
 }
 
-PFN_vkVoidFunction VulkanSpoofing::hkvkGetInstanceProcAddr(const PFN_vkVoidFunction orgFunc, const char* pName)
+// Shared by instance & device proc address hooks, returns nullptr when name is not spoofed
+static PFN_vkVoidFunction GetSpoofedProcAddr(const PFN_vkVoidFunction orgFunc, std::string_view procName)
 {
-    auto procName = std::string(pName);
-
-    auto result = Vulkan_wDx12::GetInstanceProcAddr(orgFunc, pName);
-    if (result != VK_NULL_HANDLE)
-        return result;
+    // All spoofed functions are physical device queries or enumerations
+    if (!procName.starts_with("vkGetPhysicalDevice") && !procName.starts_with("vkEnumerate"))
+        return VK_NULL_HANDLE;
 
     if (Config::Instance()->VulkanSpoofing.value_or_default())
     {
-        if (procName == std::string("vkGetPhysicalDeviceProperties"))
+        if (procName == "vkGetPhysicalDeviceProperties")
         {
             if (o_vkGetPhysicalDeviceProperties == nullptr)
                 o_vkGetPhysicalDeviceProperties = (PFN_vkGetPhysicalDeviceProperties) orgFunc;
@@ -708,7 +549,7 @@ PFN_vkVoidFunction VulkanSpoofing::hkvkGetInstanceProcAddr(const PFN_vkVoidFunct
             LOG_DEBUG("vkGetPhysicalDeviceProperties");
             return (PFN_vkVoidFunction) hkvkGetPhysicalDeviceProperties;
         }
-        else if (procName == std::string("vkGetPhysicalDeviceProperties2"))
+        else if (procName == "vkGetPhysicalDeviceProperties2")
         {
             if (o_vkGetPhysicalDeviceProperties2 == nullptr)
                 o_vkGetPhysicalDeviceProperties2 = (PFN_vkGetPhysicalDeviceProperties2) orgFunc;
@@ -716,7 +557,7 @@ PFN_vkVoidFunction VulkanSpoofing::hkvkGetInstanceProcAddr(const PFN_vkVoidFunct
             LOG_DEBUG("vkGetPhysicalDeviceProperties2");
             return (PFN_vkVoidFunction) hkvkGetPhysicalDeviceProperties2;
         }
-        else if (procName == std::string("vkGetPhysicalDeviceProperties2KHR"))
+        else if (procName == "vkGetPhysicalDeviceProperties2KHR")
         {
             if (o_vkGetPhysicalDeviceProperties2KHR == nullptr)
                 o_vkGetPhysicalDeviceProperties2KHR = (PFN_vkGetPhysicalDeviceProperties2KHR) orgFunc;
@@ -728,7 +569,7 @@ PFN_vkVoidFunction VulkanSpoofing::hkvkGetInstanceProcAddr(const PFN_vkVoidFunct
 
     if (Config::Instance()->VulkanExtensionSpoofing.value_or_default())
     {
-        if (procName == std::string("vkEnumerateInstanceExtensionProperties"))
+        if (procName == "vkEnumerateInstanceExtensionProperties")
         {
             if (o_vkEnumerateInstanceExtensionProperties == nullptr)
                 o_vkEnumerateInstanceExtensionProperties = (PFN_vkEnumerateInstanceExtensionProperties) orgFunc;
@@ -736,7 +577,7 @@ PFN_vkVoidFunction VulkanSpoofing::hkvkGetInstanceProcAddr(const PFN_vkVoidFunct
             LOG_DEBUG("vkEnumerateInstanceExtensionProperties");
             return (PFN_vkVoidFunction) hkvkEnumerateInstanceExtensionProperties;
         }
-        else if (procName == std::string("vkEnumerateDeviceExtensionProperties"))
+        else if (procName == "vkEnumerateDeviceExtensionProperties")
         {
             if (o_vkEnumerateDeviceExtensionProperties == nullptr)
                 o_vkEnumerateDeviceExtensionProperties = (PFN_vkEnumerateDeviceExtensionProperties) orgFunc;
@@ -748,7 +589,7 @@ PFN_vkVoidFunction VulkanSpoofing::hkvkGetInstanceProcAddr(const PFN_vkVoidFunct
 
     if (Config::Instance()->VulkanVRAM.has_value())
     {
-        if (procName == std::string("vkGetPhysicalDeviceMemoryProperties"))
+        if (procName == "vkGetPhysicalDeviceMemoryProperties")
         {
             if (o_vkGetPhysicalDeviceMemoryProperties == nullptr)
                 o_vkGetPhysicalDeviceMemoryProperties = (PFN_vkGetPhysicalDeviceMemoryProperties) orgFunc;
@@ -756,7 +597,7 @@ PFN_vkVoidFunction VulkanSpoofing::hkvkGetInstanceProcAddr(const PFN_vkVoidFunct
             LOG_DEBUG("vkGetPhysicalDeviceMemoryProperties");
             return (PFN_vkVoidFunction) hkvkGetPhysicalDeviceMemoryProperties;
         }
-        else if (procName == std::string("vkGetPhysicalDeviceMemoryProperties2"))
+        else if (procName == "vkGetPhysicalDeviceMemoryProperties2")
         {
             if (o_vkGetPhysicalDeviceMemoryProperties2 == nullptr)
                 o_vkGetPhysicalDeviceMemoryProperties2 = (PFN_vkGetPhysicalDeviceMemoryProperties2) orgFunc;
@@ -764,7 +605,7 @@ PFN_vkVoidFunction VulkanSpoofing::hkvkGetInstanceProcAddr(const PFN_vkVoidFunct
             LOG_DEBUG("vkGetPhysicalDeviceMemoryProperties2");
             return (PFN_vkVoidFunction) hkvkGetPhysicalDeviceMemoryProperties2;
         }
-        else if (procName == std::string("vkGetPhysicalDeviceMemoryProperties2KHR"))
+        else if (procName == "vkGetPhysicalDeviceMemoryProperties2KHR")
         {
             if (o_vkGetPhysicalDeviceMemoryProperties2KHR == nullptr)
                 o_vkGetPhysicalDeviceMemoryProperties2KHR = (PFN_vkGetPhysicalDeviceMemoryProperties2KHR) orgFunc;
@@ -774,92 +615,31 @@ PFN_vkVoidFunction VulkanSpoofing::hkvkGetInstanceProcAddr(const PFN_vkVoidFunct
         }
     }
 
-    return orgFunc;
+    return VK_NULL_HANDLE;
 }
 
-PFN_vkVoidFunction VulkanSpoofing::hkvkGetDeviceProcAddr(const PFN_vkVoidFunction orgFunc, const char* pName)
+PFN_vkVoidFunction VulkanSpoofing::hkvkGetInstanceProcAddr(const PFN_vkVoidFunction orgFunc, const char* pName)
 {
-    auto procName = std::string(pName);
-
-    auto result = Vulkan_wDx12::GetDeviceProcAddr(orgFunc, pName);
+    auto result = Vulkan_wDx12::GetInstanceProcAddr(orgFunc, pName);
     if (result != VK_NULL_HANDLE)
         return result;
 
-    if (Config::Instance()->VulkanSpoofing.value_or_default())
-    {
-        if (procName == std::string("vkGetPhysicalDeviceProperties"))
-        {
-            if (o_vkGetPhysicalDeviceProperties == nullptr)
-                o_vkGetPhysicalDeviceProperties = (PFN_vkGetPhysicalDeviceProperties) orgFunc;
-
-            LOG_DEBUG("vkGetPhysicalDeviceProperties");
-            return (PFN_vkVoidFunction) hkvkGetPhysicalDeviceProperties;
-        }
-        else if (procName == std::string("vkGetPhysicalDeviceProperties2"))
-        {
-            if (o_vkGetPhysicalDeviceProperties2 == nullptr)
-                o_vkGetPhysicalDeviceProperties2 = (PFN_vkGetPhysicalDeviceProperties2) orgFunc;
-
-            LOG_DEBUG("vkGetPhysicalDeviceProperties2");
-            return (PFN_vkVoidFunction) hkvkGetPhysicalDeviceProperties2;
-        }
-        else if (procName == std::string("vkGetPhysicalDeviceProperties2KHR"))
-        {
-            if (o_vkGetPhysicalDeviceProperties2KHR == nullptr)
-                o_vkGetPhysicalDeviceProperties2KHR = (PFN_vkGetPhysicalDeviceProperties2KHR) orgFunc;
-
-            LOG_DEBUG("vkGetPhysicalDeviceProperties2KHR");
-            return (PFN_vkVoidFunction) hkvkGetPhysicalDeviceProperties2KHR;
-        }
-    }
-
-    if (Config::Instance()->VulkanExtensionSpoofing.value_or_default())
-    {
-        if (procName == std::string("vkEnumerateInstanceExtensionProperties"))
-        {
-            if (o_vkEnumerateInstanceExtensionProperties == nullptr)
-                o_vkEnumerateInstanceExtensionProperties = (PFN_vkEnumerateInstanceExtensionProperties) orgFunc;
-
-            LOG_DEBUG("vkEnumerateInstanceExtensionProperties");
-            return (PFN_vkVoidFunction) hkvkEnumerateInstanceExtensionProperties;
-        }
-        else if (procName == std::string("vkEnumerateDeviceExtensionProperties"))
-        {
-            if (o_vkEnumerateDeviceExtensionProperties == nullptr)
-                o_vkEnumerateDeviceExtensionProperties = (PFN_vkEnumerateDeviceExtensionProperties) orgFunc;
-
-            LOG_DEBUG("vkEnumerateDeviceExtensionProperties");
-            return (PFN_vkVoidFunction) hkvkEnumerateDeviceExtensionProperties;
-        }
-    }
-
-    if (Config::Instance()->VulkanVRAM.has_value())
-    {
-        if (procName == std::string("vkGetPhysicalDeviceMemoryProperties"))
-        {
-            if (o_vkGetPhysicalDeviceMemoryProperties == nullptr)
-                o_vkGetPhysicalDeviceMemoryProperties = (PFN_vkGetPhysicalDeviceMemoryProperties) orgFunc;
+    result = GetSpoofedProcAddr(orgFunc, pName);
+    if (result != VK_NULL_HANDLE)
+        return result;
 
-            LOG_DEBUG("vkGetPhysicalDeviceMemoryProperties");
-            return (PFN_vkVoidFunction) hkvkGetPhysicalDeviceMemoryProperties;
-        }
-        else if (procName == std::string("vkGetPhysicalDeviceMemoryProperties2"))
-        {
-            if (o_vkGetPhysicalDeviceMemoryProperties2 == nullptr)
-                o_vkGetPhysicalDeviceMemoryProperties2 = (PFN_vkGetPhysicalDeviceMemoryProperties2) orgFunc;
+    return orgFunc;
+}
 
-            LOG_DEBUG("vkGetPhysicalDeviceMemoryProperties2");
-            return (PFN_vkVoidFunction) hkvkGetPhysicalDeviceMemoryProperties2;
-        }
-        else if (procName == std::string("vkGetPhysicalDeviceMemoryProperties2KHR"))
-        {
-            if (o_vkGetPhysicalDeviceMemoryProperties2KHR == nullptr)
-                o_vkGetPhysicalDeviceMemoryProperties2KHR = (PFN_vkGetPhysicalDeviceMemoryProperties2KHR) orgFunc;
+PFN_vkVoidFunction VulkanSpoofing::hkvkGetDeviceProcAddr(const PFN_vkVoidFunction orgFunc, const char* pName)
+{
+    auto result = Vulkan_wDx12::GetDeviceProcAddr(orgFunc, pName);
+    if (result != VK_NULL_HANDLE)
+        return result;
 
-            LOG_DEBUG("vkGetPhysicalDeviceMemoryProperties2KHR");
-            return (PFN_vkVoidFunction) hkvkGetPhysicalDeviceMemoryProperties2KHR;
-        }
-    }
+    result = GetSpoofedProcAddr(orgFunc, pName);
+    if (result != VK_NULL_HANDLE)
+        return result;
 
     return orgFunc;
 }
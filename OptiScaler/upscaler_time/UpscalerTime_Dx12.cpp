@@ -51,17 +51,15 @@ void UpscalerTimeDx12::UpscaleEnd(ID3D12GraphicsCommandList* cmdList)
         // Resolve the queries to the readback buffer
         cmdList->ResolveQueryData(_queryHeap, D3D12_QUERY_TYPE_TIMESTAMP, 0, 2, _readbackBuffer, 0);
 
-        _dx12UpscaleTrig = true;
+        _dx12UpscaleTrig.store(true, std::memory_order_release);
     }
 }
 
 void UpscalerTimeDx12::ReadUpscalingTime(ID3D12CommandQueue* commandQueue)
 {
-    if (_queryHeap == nullptr || !_dx12UpscaleTrig || _readbackBuffer == nullptr)
+    if (_queryHeap == nullptr || _readbackBuffer == nullptr || !_dx12UpscaleTrig.exchange(false))
         return;
 
-    _dx12UpscaleTrig = false;
-
     UINT64* timestampData;
     _readbackBuffer->Map(0, nullptr, reinterpret_cast<void**>(&timestampData));
 
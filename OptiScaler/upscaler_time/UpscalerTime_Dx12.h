@@ -4,6 +4,8 @@
 
 #include <d3d12.h>
 
+#include <atomic>
+
 class UpscalerTimeDx12
 {
   public:
@@ -15,5 +17,5 @@ class UpscalerTimeDx12
   private:
     static inline ID3D12QueryHeap* _queryHeap = nullptr;
     static inline ID3D12Resource* _readbackBuffer = nullptr;
-    static inline bool _dx12UpscaleTrig = false;
+    static inline std::atomic<bool> _dx12UpscaleTrig { false }; // Set by evaluate, cleared by present
 };
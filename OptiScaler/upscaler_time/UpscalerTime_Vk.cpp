@@ -32,12 +32,12 @@ void UpscalerTimeVk::UpscaleEnd(VkCommandBuffer cmdBuffer)
         return;
 
     vkCmdWriteTimestamp(cmdBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, _queryPool, 1);
-    _vkUpscaleTrig = true;
+    _vkUpscaleTrig.store(true, std::memory_order_release);
 }
 
 void UpscalerTimeVk::ReadUpscalingTime(VkDevice device)
 {
-    if (_vkUpscaleTrig && _queryPool != VK_NULL_HANDLE)
+    if (_vkUpscaleTrig.exchange(false) && _queryPool != VK_NULL_HANDLE)
     {
         // Retrieve timestamps
         uint64_t timestamps[2];
@@ -55,6 +55,4 @@ void UpscalerTimeVk::ReadUpscalingTime(VkDevice device)
             State::Instance().frameTimeMutex.unlock();
         }
     }
-
-    _vkUpscaleTrig = false;
 }
@@ -4,6 +4,8 @@
 
 #include <vulkan/vulkan.hpp>
 
+#include <atomic>
+
 class UpscalerTimeVk
 {
   public:
@@ -15,5 +17,5 @@ class UpscalerTimeVk
   private:
     static inline VkQueryPool _queryPool = VK_NULL_HANDLE;
     static inline double _timeStampPeriod = 1.0;
-    static inline bool _vkUpscaleTrig = false;
+    static inline std::atomic<bool> _vkUpscaleTrig { false }; // Set by evaluate, cleared by present
 };
@@ -0,0 +1,71 @@
+#include "pch.h"
+#include "BarrierBatch_Dx12.h"
+
+void BarrierBatch_Dx12::Remove(UINT index)
+{
+    for (UINT i = index + 1; i < _count; i++)
+        _barriers[i - 1] = _barriers[i];
+
+    _count--;
+}
+
+void BarrierBatch_Dx12::Transition(ID3D12Resource* resource, D3D12_RESOURCE_STATES before,
+                                   D3D12_RESOURCE_STATES after, UINT subresource)
+{
+    if (resource == nullptr || before == after)
+        return;
+
+    // Only the latest pending transition of the resource can be merged, order is kept otherwise
+    for (UINT i = _count; i > 0; i--)
+    {
+        auto& pending = _barriers[i - 1].Transition;
+
+        if (pending.pResource != resource)
+            continue;
+
+        if (pending.Subresource != subresource)
+            break;
+
+        if (pending.StateAfter == before)
+        {
+            pending.StateAfter = after;
+
+            if (pending.StateBefore == pending.StateAfter)
+                Remove(i - 1);
+
+            return;
+        }
+
+        if (pending.StateBefore == before && pending.StateAfter == after)
+        {
+            LOG_TRACE("Skipping repeated transition: {:X}, {:X} -> {:X}", (size_t) resource, (UINT) before,
+                      (UINT) after);
+            return;
+        }
+
+        break;
+    }
+
+    if (_count == MaxBarriers)
+        Flush();
+
+    auto& barrier = _barriers[_count++];
+    barrier = {};
+    barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+    barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+    barrier.Transition.pResource = resource;
+    barrier.Transition.StateBefore = before;
+    barrier.Transition.StateAfter = after;
+    barrier.Transition.Subresource = subresource;
+}
+
+void BarrierBatch_Dx12::Flush()
+{
+    if (_count == 0)
+        return;
+
+    if (_cmdList != nullptr)
+        _cmdList->ResourceBarrier(_count, _barriers.data());
+
+    _count = 0;
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include <d3d12.h>
+
+#include <array>
+
+// Collects transition barriers of a sync point and records them with a single ResourceBarrier call
+//
+// A transition which continues the pending one of the same resource is merged into it
+// (A -> B, B -> C becomes A -> C), pairs which cancel each other (A -> B, B -> A) are dropped
+// and repeated transitions are recorded once. Pending barriers are recorded when Flush is called
+// or the batch goes out of scope, so early returns leave resources in the same state as before.
+
+class BarrierBatch_Dx12
+{
+  private:
+    static constexpr UINT MaxBarriers = 16;
+
+    ID3D12GraphicsCommandList* _cmdList = nullptr;
+    std::array<D3D12_RESOURCE_BARRIER, MaxBarriers> _barriers {};
+    UINT _count = 0;
+
+    void Remove(UINT index);
+
+  public:
+    explicit BarrierBatch_Dx12(ID3D12GraphicsCommandList* cmdList) : _cmdList(cmdList) {}
+    ~BarrierBatch_Dx12() { Flush(); }
+
+    BarrierBatch_Dx12(const BarrierBatch_Dx12&) = delete;
+    BarrierBatch_Dx12& operator=(const BarrierBatch_Dx12&) = delete;
+
+    void Transition(ID3D12Resource* resource, D3D12_RESOURCE_STATES before, D3D12_RESOURCE_STATES after,
+                    UINT subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES);
+
+    // Records pending barriers, must be called before any command which uses the resources
+    void Flush();
+
+    UINT Pending() const { return _count; }
+};
@@ -0,0 +1,100 @@
+#include "pch.h"
+#include "CopyBatch_Dx11.h"
+
+UINT64 CopyBatch_Dx11::SourceId(ID3D11Resource* source)
+{
+    if (source == nullptr)
+        return 0;
+
+    UINT64 id = 0;
+    UINT size = sizeof(id);
+
+    if (source->GetPrivateData(SourceIdGuid, &size, &id) == S_OK && size == sizeof(id) && id != 0)
+        return id;
+
+    id = ++_nextSourceId;
+
+    if (source->SetPrivateData(SourceIdGuid, sizeof(id), &id) != S_OK)
+        return 0;
+
+    return id;
+}
+
+bool CopyBatch_Dx11::NeedsCopy(InteropInput input, const InteropCopyKey& key) const
+{
+    auto index = static_cast<size_t>(input);
+
+    if (index >= InputCount || key.sourceId == 0)
+        return true;
+
+    if (!_valid[index] || !(_last[index] == key))
+        return true;
+
+    // Same input queued twice in a batch with a different key, last one wins
+    for (UINT i = 0; i < _count; i++)
+    {
+        if (_pending[i].input == input && !(_pending[i].key == key))
+            return true;
+    }
+
+    return false;
+}
+
+bool CopyBatch_Dx11::Queue(InteropInput input, const InteropCopyKey& key, ID3D11Resource* target,
+                           ID3D11Resource* source)
+{
+    if (target == nullptr || source == nullptr || static_cast<size_t>(input) >= InputCount)
+        return false;
+
+    if (!NeedsCopy(input, key))
+    {
+        _skipped++;
+        return false;
+    }
+
+    for (UINT i = 0; i < _count; i++)
+    {
+        if (_pending[i].input == input)
+        {
+            _pending[i] = { input, key, target, source };
+            return true;
+        }
+    }
+
+    _pending[_count++] = { input, key, target, source };
+    return true;
+}
+
+UINT CopyBatch_Dx11::Flush(ID3D11DeviceContext* context)
+{
+    auto count = _count;
+
+    for (UINT i = 0; i < count; i++)
+    {
+        auto& copy = _pending[i];
+        context->CopyResource(copy.target, copy.source);
+
+        auto index = static_cast<size_t>(copy.input);
+        _last[index] = copy.key;
+        _valid[index] = true;
+    }
+
+    _issued += count;
+    _count = 0;
+
+    return count;
+}
+
+void CopyBatch_Dx11::Invalidate(InteropInput input)
+{
+    auto index = static_cast<size_t>(input);
+
+    if (index < InputCount)
+        _valid[index] = false;
+}
+
+void CopyBatch_Dx11::Reset()
+{
+    _count = 0;
+    _valid.fill(false);
+}
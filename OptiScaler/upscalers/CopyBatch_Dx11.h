@@ -0,0 +1,97 @@
+#pragma once
+#include <d3d11.h>
+
+#include <array>
+#include <atomic>
+
+// Collects D3D11 -> shared texture copies of Dx11-on-12 inputs and issues them together before the single
+// fence signal of the frame
+//
+// Every input keeps the key of its last copy: source id, shared target, signature and content generation.
+// Source id is a serial stored in the source's private data, a new texture at a freed texture's address
+// gets a new id, so address reuse can't skip a copy.
+// Copies whose key didn't change are skipped, sources which can't change after creation (immutable usage,
+// e.g. a constant exposure texture) keep the same generation and are only copied once per target.
+// Keys are committed when the batch is flushed, a batch dropped by an early return is not remembered.
+
+enum class InteropInput : uint32_t
+{
+    Color,
+    MotionVectors,
+    Depth,
+    Exposure,
+    Reactive,
+    Output, // Only copied back after upscaling
+
+    Count
+};
+
+struct InteropCopyKey
+{
+    UINT64 sourceId = 0; // 0 when the source couldn't be tagged, never skipped
+    uintptr_t target = 0;
+    UINT width = 0;
+    UINT height = 0;
+    UINT format = 0;
+    UINT bindFlags = 0;
+    UINT64 generation = 0;
+
+    bool operator==(const InteropCopyKey& other) const = default;
+};
+
+class CopyBatch_Dx11
+{
+  private:
+    static constexpr size_t InputCount = static_cast<size_t>(InteropInput::Count);
+
+    struct PendingCopy
+    {
+        InteropInput input = InteropInput::Count;
+        InteropCopyKey key {};
+        ID3D11Resource* target = nullptr;
+        ID3D11Resource* source = nullptr;
+    };
+
+    std::array<PendingCopy, InputCount> _pending {};
+    UINT _count = 0;
+
+    std::array<InteropCopyKey, InputCount> _last {};
+    std::array<bool, InputCount> _valid {};
+
+    UINT64 _issued = 0;
+    UINT64 _skipped = 0;
+
+    // Shared by all batches, a source tagged by another feature keeps a unique id
+    inline static std::atomic<UINT64> _nextSourceId = 0;
+
+  public:
+    // {5C2B5D2E-7A4B-4C38-9F0E-3D1A6B8E2F47}
+    inline static const GUID SourceIdGuid = {
+        0x5c2b5d2e, 0x7a4b, 0x4c38, { 0x9f, 0x0e, 0x3d, 0x1a, 0x6b, 0x8e, 0x2f, 0x47 }
+    };
+
+    // Id of the source texture, tags it on first use
+    static UINT64 SourceId(ID3D11Resource* source);
+
+    // Content generation of a source, sources which can't be written after creation never move on
+    static UINT64 Generation(bool immutable, UINT64 frame) { return immutable ? 0 : frame + 1; }
+
+    bool NeedsCopy(InteropInput input, const InteropCopyKey& key) const;
+
+    // Queues the copy unless the last copy of this input had the same key, returns true when queued
+    bool Queue(InteropInput input, const InteropCopyKey& key, ID3D11Resource* target, ID3D11Resource* source);
+
+    // Starts a new batch, drops pending copies of a previous batch which wasn't flushed
+    void Begin() { _count = 0; }
+
+    // Issues pending copies back to back and commits their keys, returns copy count
+    UINT Flush(ID3D11DeviceContext* context);
+
+    // Shared target was recreated, next copy of the input can't be skipped
+    void Invalidate(InteropInput input);
+    void Reset();
+
+    UINT Pending() const { return _count; }
+    UINT64 Issued() const { return _issued; }
+    UINT64 Skipped() const { return _skipped; }
+};
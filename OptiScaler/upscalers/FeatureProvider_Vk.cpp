@@ -15,6 +15,232 @@
 #include "upscalers/xess/XeSSFeature_Vk.h"
 #include "upscalers/fsr31/FSR31Feature_VkOn12.h"
 
+// Presents a retired upscaler waits for its recorded command buffers to show up in a submit
+constexpr uint32_t RetiredSubmitPresents = 16;
+
+// Evaluates remembered per upscaler, older ones were dropped by the game without a submit
+constexpr size_t MaxRecordedCmdBuffers = 8;
+
+void FeatureProvider_Vk::Evaluated(IFeature_Vk* feature, VkDevice device, VkCommandBuffer cmdBuffer)
+{
+    std::scoped_lock lock(_retiredMutex);
+
+    auto& tracking = _liveSubmits[feature];
+    tracking.device = device;
+
+    if (std::find(tracking.recorded.begin(), tracking.recorded.end(), cmdBuffer) == tracking.recorded.end())
+    {
+        if (tracking.recorded.size() >= MaxRecordedCmdBuffers)
+            tracking.recorded.erase(tracking.recorded.begin());
+
+        tracking.recorded.push_back(cmdBuffer);
+    }
+
+    _tracking.store(true, std::memory_order_relaxed);
+}
+
+void FeatureProvider_Vk::Forget(IFeature_Vk* feature)
+{
+    std::scoped_lock lock(_retiredMutex);
+
+    _liveSubmits.erase(feature);
+    UpdateTrackingLocked();
+}
+
+void FeatureProvider_Vk::SubmittedLocked(VkQueue queue, VkCommandBuffer cmdBuffer)
+{
+    auto track = [queue, cmdBuffer](SubmitTracking& tracking)
+    {
+        auto it = std::find(tracking.recorded.begin(), tracking.recorded.end(), cmdBuffer);
+
+        if (it == tracking.recorded.end())
+            return;
+
+        tracking.recorded.erase(it);
+
+        if (std::find(tracking.queues.begin(), tracking.queues.end(), queue) == tracking.queues.end())
+            tracking.queues.push_back(queue);
+    };
+
+    for (auto& [feature, tracking] : _liveSubmits)
+        track(tracking);
+
+    for (auto& retired : _retiredFeatures)
+        track(retired.submits);
+}
+
+void FeatureProvider_Vk::FenceQueueLocked(VkQueue queue, PFN_vkQueueSubmit queueSubmit)
+{
+    if (queueSubmit == nullptr)
+        return;
+
+    for (auto& retired : _retiredFeatures)
+    {
+        auto& queues = retired.submits.queues;
+        auto it = std::find(queues.begin(), queues.end(), queue);
+
+        if (it == queues.end())
+            continue;
+
+        VkFenceCreateInfo fenceInfo {};
+        fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+        VkFence fence = VK_NULL_HANDLE;
+        auto device = retired.submits.device;
+
+        if (auto result = vkCreateFence(device, &fenceInfo, nullptr, &fence); result != VK_SUCCESS)
+        {
+            LOG_ERROR("vkCreateFence error: {0:X}", (UINT) result);
+            continue;
+        }
+
+        // Empty submit, fence is signaled when all work submitted to the queue before it is done
+        if (auto result = queueSubmit(queue, 0, nullptr, fence); result != VK_SUCCESS)
+        {
+            LOG_ERROR("vkQueueSubmit error: {0:X}", (UINT) result);
+            vkDestroyFence(device, fence, nullptr);
+            continue;
+        }
+
+        retired.fences.push_back(fence);
+        queues.erase(it);
+    }
+}
+
+void FeatureProvider_Vk::ReleaseSignaledLocked()
+{
+    std::erase_if(_retiredFeatures,
+                  [](const RetiredFeature& retired)
+                  {
+                      if (!retired.submits.recorded.empty() || !retired.submits.queues.empty())
+                          return false;
+
+                      for (auto fence : retired.fences)
+                      {
+                          if (vkGetFenceStatus(retired.submits.device, fence) != VK_SUCCESS)
+                              return false;
+                      }
+
+                      LOG_DEBUG("Releasing retired feature");
+
+                      for (auto fence : retired.fences)
+                          vkDestroyFence(retired.submits.device, fence, nullptr);
+
+                      return true;
+                  });
+}
+
+void FeatureProvider_Vk::UpdateTrackingLocked()
+{
+    bool tracking = false;
+
+    for (auto& [feature, submits] : _liveSubmits)
+        tracking |= !submits.recorded.empty();
+
+    for (auto& retired : _retiredFeatures)
+        tracking |= !retired.submits.recorded.empty() || !retired.submits.queues.empty();
+
+    _tracking.store(tracking, std::memory_order_relaxed);
+}
+
+void FeatureProvider_Vk::SubmitsHooked(PFN_vkQueueSubmit queueSubmit)
+{
+    std::scoped_lock lock(_retiredMutex);
+    _queueSubmit = queueSubmit;
+}
+
+void FeatureProvider_Vk::QueueSubmitted(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits)
+{
+    std::scoped_lock lock(_retiredMutex);
+
+    for (uint32_t i = 0; i < submitCount; i++)
+    {
+        for (uint32_t j = 0; j < pSubmits[i].commandBufferCount; j++)
+            SubmittedLocked(queue, pSubmits[i].pCommandBuffers[j]);
+    }
+
+    FenceQueueLocked(queue, _queueSubmit);
+    UpdateTrackingLocked();
+}
+
+void FeatureProvider_Vk::QueueSubmitted(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits)
+{
+    std::scoped_lock lock(_retiredMutex);
+
+    for (uint32_t i = 0; i < submitCount; i++)
+    {
+        for (uint32_t j = 0; j < pSubmits[i].commandBufferInfoCount; j++)
+            SubmittedLocked(queue, pSubmits[i].pCommandBufferInfos[j].commandBuffer);
+    }
+
+    FenceQueueLocked(queue, _queueSubmit);
+    UpdateTrackingLocked();
+}
+
+void FeatureProvider_Vk::FramePresented(VkQueue queue)
+{
+    std::scoped_lock lock(_retiredMutex);
+
+    if (_retiredFeatures.empty())
+        return;
+
+    for (auto& retired : _retiredFeatures)
+    {
+        auto& submits = retired.submits;
+
+        if (submits.recorded.empty())
+            continue;
+
+        if (_queueSubmit == nullptr)
+        {
+            // Submits are not hooked, expect the work on the present queue
+            submits.recorded.clear();
+
+            if (std::find(submits.queues.begin(), submits.queues.end(), queue) == submits.queues.end())
+                submits.queues.push_back(queue);
+        }
+        else if (++retired.presents >= RetiredSubmitPresents)
+        {
+            // Command buffers were reset or freed by the game without a submit, they never run
+            LOG_DEBUG("Dropping {} unsubmitted command buffers of retired feature", submits.recorded.size());
+            submits.recorded.clear();
+        }
+    }
+
+    FenceQueueLocked(queue, _queueSubmit != nullptr ? _queueSubmit : vkQueueSubmit);
+    ReleaseSignaledLocked();
+    UpdateTrackingLocked();
+}
+
+void FeatureProvider_Vk::FlushRetired()
+{
+    std::scoped_lock lock(_retiredMutex);
+
+    if (_retiredFeatures.empty())
+        return;
+
+    LOG_DEBUG("Flushing {} retired features", _retiredFeatures.size());
+
+    VkDevice waitedDevice = VK_NULL_HANDLE;
+
+    for (auto& retired : _retiredFeatures)
+    {
+        auto device = retired.submits.device;
+
+        if (device != waitedDevice)
+        {
+            vkDeviceWaitIdle(device);
+            waitedDevice = device;
+        }
+
+        for (auto fence : retired.fences)
+            vkDestroyFence(device, fence, nullptr);
+    }
+
+    _retiredFeatures.clear();
+    UpdateTrackingLocked();
+}
+
 bool FeatureProvider_Vk::GetFeature(std::string upscalerName, UINT handleId, NVSDK_NGX_Parameter* parameters,
                                     std::unique_ptr<IFeature_Vk>* feature)
 {
@@ -135,14 +361,26 @@ bool FeatureProvider_Vk::ChangeFeature(std::string upscalerName, VkInstance inst
 
             dc = nullptr;
 
-            vkDeviceWaitIdle(device);
-
             State::Instance().currentFeature = nullptr;
 
-            LOG_DEBUG("sleeping before reset of current feature for 1000ms");
-            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+            LOG_DEBUG("Retiring current feature");
+
+            {
+                std::scoped_lock lock(_retiredMutex);
+
+                RetiredFeature retired { std::move(contextData->feature) };
+
+                if (auto it = _liveSubmits.find(retired.feature.get()); it != _liveSubmits.end())
+                {
+                    retired.submits = std::move(it->second);
+                    _liveSubmits.erase(it);
+                }
+
+                retired.submits.device = device;
+                _retiredFeatures.push_back(std::move(retired));
+                UpdateTrackingLocked();
+            }
 
-            contextData->feature.reset();
             contextData->feature = nullptr;
         }
         else
@@ -6,9 +6,70 @@
 
 #include <inputs/NVNGX_DLSS.h>
 
+#include <atomic>
+#include <unordered_map>
+
 class FeatureProvider_Vk
 {
+  private:
+    // Game command buffers an upscaler recorded into, and the queues they were submitted to
+    struct SubmitTracking
+    {
+        VkDevice device = VK_NULL_HANDLE;
+        std::vector<VkCommandBuffer> recorded; // Not seen in a submit yet
+        std::vector<VkQueue> queues;           // Ran recorded work, not fenced yet
+    };
+
+    // Replaced upscalers are kept alive until game command buffers recorded with them are
+    // out of flight, instead of idling the whole device
+    struct RetiredFeature
+    {
+        std::unique_ptr<IFeature_Vk> feature;
+        SubmitTracking submits;
+        std::vector<VkFence> fences; // One per queue which ran its work, signaled after that work
+        uint32_t presents = 0;
+    };
+
+    inline static std::mutex _retiredMutex;
+    inline static std::vector<RetiredFeature> _retiredFeatures;
+    inline static std::unordered_map<IFeature_Vk*, SubmitTracking> _liveSubmits;
+
+    // Set while any recorded command buffer or retired queue waits for a submit, keeps submits lock free otherwise
+    inline static std::atomic<bool> _tracking = false;
+
+    // Original vkQueueSubmit, exported one goes through the submit hooks.
+    // Null while submits are not hooked, then only the present queue is fenced
+    inline static PFN_vkQueueSubmit _queueSubmit = nullptr;
+
+    static void SubmittedLocked(VkQueue queue, VkCommandBuffer cmdBuffer);
+    static void FenceQueueLocked(VkQueue queue, PFN_vkQueueSubmit queueSubmit);
+    static void ReleaseSignaledLocked();
+    static void UpdateTrackingLocked();
+
   public:
+    // Called after evaluate, the command buffer is matched against game submits
+    static void Evaluated(IFeature_Vk* feature, VkDevice device, VkCommandBuffer cmdBuffer);
+
+    // Called before a live upscaler is destroyed
+    static void Forget(IFeature_Vk* feature);
+
+    static bool TracksSubmits() { return _tracking.load(std::memory_order_relaxed); }
+
+    // Called when queue submit hooks are attached, with the original vkQueueSubmit
+    static void SubmitsHooked(PFN_vkQueueSubmit queueSubmit);
+
+    // Called from queue submit hooks after a successful submit while the game holds the queue.
+    // Records which queues ran upscaler work and fences retired upscalers on them
+    static void QueueSubmitted(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits);
+    static void QueueSubmitted(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits);
+
+    // Called from present with the present queue, fences retired upscalers which ran on it
+    // and releases the ones whose fences are signaled
+    static void FramePresented(VkQueue queue);
+
+    // Waits device idle and releases every retired upscaler, called before the device goes away
+    static void FlushRetired();
+
     static bool GetFeature(std::string upscalerName, UINT handleId, NVSDK_NGX_Parameter* parameters,
                            std::unique_ptr<IFeature_Vk>* feature);
 
@@ -38,8 +38,9 @@ void IFeature_Dx11wDx12::ResourceBarrier(ID3D12GraphicsCommandList* commandList,
     commandList->ResourceBarrier(1, &barrier);
 }
 
-bool IFeature_Dx11wDx12::CopyTextureFrom11To12(ID3D11Resource* InResource, D3D11_TEXTURE2D_RESOURCE_C* OutResource,
-                                               bool InCopy, bool InDepth, bool InDontUseNTShared)
+bool IFeature_Dx11wDx12::CopyTextureFrom11To12(InteropInput InInput, ID3D11Resource* InResource,
+                                               D3D11_TEXTURE2D_RESOURCE_C* OutResource, bool InCopy, bool InDepth,
+                                               bool InDontUseNTShared)
 {
     ID3D11Texture2D* originalTexture = nullptr;
     D3D11_TEXTURE2D_DESC desc {};
@@ -51,6 +52,15 @@ bool IFeature_Dx11wDx12::CopyTextureFrom11To12(ID3D11Resource* InResource, D3D11
 
     originalTexture->GetDesc(&desc);
 
+    // Copy key is taken before desc is modified for the shared texture
+    InteropCopyKey copyKey {};
+    copyKey.sourceId = CopyBatch_Dx11::SourceId(InResource);
+    copyKey.width = desc.Width;
+    copyKey.height = desc.Height;
+    copyKey.format = (UINT) desc.Format;
+    copyKey.bindFlags = desc.BindFlags;
+    copyKey.generation = CopyBatch_Dx11::Generation(desc.Usage == D3D11_USAGE_IMMUTABLE, _frameCount);
+
     // check shared nt handle usage later
     if (!(desc.MiscFlags & D3D11_RESOURCE_MISC_SHARED) && !(desc.MiscFlags & D3D11_RESOURCE_MISC_SHARED_NTHANDLE) &&
         !InDontUseNTShared)
@@ -72,6 +82,8 @@ bool IFeature_Dx11wDx12::CopyTextureFrom11To12(ID3D11Resource* InResource, D3D11
                 OutResource->Dx12Handle = NULL;
             }
 
+            _copyBatch.Invalidate(InInput);
+
             desc.MiscFlags = D3D11_RESOURCE_MISC_SHARED | D3D11_RESOURCE_MISC_SHARED_NTHANDLE;
             desc.Usage = D3D11_USAGE_DEFAULT;
 
@@ -113,7 +125,10 @@ bool IFeature_Dx11wDx12::CopyTextureFrom11To12(ID3D11Resource* InResource, D3D11
         }
 
         if (InCopy && OutResource->SharedTexture != nullptr)
-            Dx11DeviceContext->CopyResource(OutResource->SharedTexture, InResource);
+        {
+            copyKey.target = (uintptr_t) OutResource->SharedTexture;
+            _copyBatch.Queue(InInput, copyKey, OutResource->SharedTexture, InResource);
+        }
     }
     else if ((desc.MiscFlags & D3D11_RESOURCE_MISC_SHARED) == 0 && InDontUseNTShared)
     {
@@ -168,6 +183,8 @@ bool IFeature_Dx11wDx12::CopyTextureFrom11To12(ID3D11Resource* InResource, D3D11
                     OutResource->Dx12Handle = NULL;
                 }
 
+                _copyBatch.Invalidate(InInput);
+
                 if (desc.Format == DXGI_FORMAT_R24G8_TYPELESS)
                     desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
 
@@ -200,7 +217,10 @@ bool IFeature_Dx11wDx12::CopyTextureFrom11To12(ID3D11Resource* InResource, D3D11
             }
 
             if (InCopy && OutResource->SharedTexture != nullptr)
-                Dx11DeviceContext->CopyResource(OutResource->SharedTexture, InResource);
+            {
+                copyKey.target = (uintptr_t) OutResource->SharedTexture;
+                _copyBatch.Queue(InInput, copyKey, OutResource->SharedTexture, InResource);
+            }
         }
     }
     else
@@ -264,6 +284,8 @@ void IFeature_Dx11wDx12::ReleaseSharedResources()
     SAFE_RELEASE(dx11Reactive.Dx12Resource);
     SAFE_RELEASE(dx11Exp.Dx12Resource);
 
+    _copyBatch.Reset();
+
     ReleaseSyncResources();
 
     SAFE_RELEASE(Dx12CommandList[0]);
@@ -519,6 +541,9 @@ bool IFeature_Dx11wDx12::ProcessDx11Textures(const NVSDK_NGX_Parameter* InParame
 
     auto dontUseNTS = Config::Instance()->DontUseNTShared.value_or_default();
 
+    // Input copies are queued and issued together right before the fence signal
+    _copyBatch.Begin();
+
 #pragma region Texture copies
 
     ID3D11Resource* paramColor;
@@ -528,7 +553,7 @@ bool IFeature_Dx11wDx12::ProcessDx11Textures(const NVSDK_NGX_Parameter* InParame
     if (paramColor)
     {
         LOG_DEBUG("Color exist..");
-        if (CopyTextureFrom11To12(paramColor, &dx11Color, true, false, dontUseNTS) == false)
+        if (CopyTextureFrom11To12(InteropInput::Color, paramColor, &dx11Color, true, false, dontUseNTS) == false)
             return false;
     }
     else
@@ -544,7 +569,7 @@ bool IFeature_Dx11wDx12::ProcessDx11Textures(const NVSDK_NGX_Parameter* InParame
     if (paramMv)
     {
         LOG_DEBUG("MotionVectors exist..");
-        if (CopyTextureFrom11To12(paramMv, &dx11Mv, true, false, dontUseNTS) == false)
+        if (CopyTextureFrom11To12(InteropInput::MotionVectors, paramMv, &dx11Mv, true, false, dontUseNTS) == false)
             return false;
     }
     else
@@ -559,7 +584,8 @@ bool IFeature_Dx11wDx12::ProcessDx11Textures(const NVSDK_NGX_Parameter* InParame
     if (paramOutput[_frameCount % 2])
     {
         LOG_DEBUG("Output exist..");
-        if (CopyTextureFrom11To12(paramOutput[_frameCount % 2], &dx11Out, false, false, dontUseNTS) == false)
+        if (CopyTextureFrom11To12(InteropInput::Output, paramOutput[_frameCount % 2], &dx11Out, false, false,
+                                  dontUseNTS) == false)
             return false;
     }
     else
@@ -576,7 +602,7 @@ bool IFeature_Dx11wDx12::ProcessDx11Textures(const NVSDK_NGX_Parameter* InParame
     {
         LOG_DEBUG("Depth exist..");
 
-        if (CopyTextureFrom11To12(paramDepth, &dx11Depth, true, true, true) == false)
+        if (CopyTextureFrom11To12(InteropInput::Depth, paramDepth, &dx11Depth, true, true, true) == false)
             return false;
     }
     else
@@ -596,7 +622,8 @@ bool IFeature_Dx11wDx12::ProcessDx11Textures(const NVSDK_NGX_Parameter* InParame
         {
             LOG_DEBUG("ExposureTexture exist..");
 
-            if (CopyTextureFrom11To12(paramExposure, &dx11Exp, true, false, dontUseNTS) == false)
+            if (CopyTextureFrom11To12(InteropInput::Exposure, paramExposure, &dx11Exp, true, false, dontUseNTS) ==
+                false)
                 return false;
         }
         else
@@ -619,7 +646,8 @@ bool IFeature_Dx11wDx12::ProcessDx11Textures(const NVSDK_NGX_Parameter* InParame
             Config::Instance()->DisableReactiveMask.set_volatile_value(false);
             LOG_DEBUG("Input Bias mask exist..");
 
-            if (CopyTextureFrom11To12(paramReactiveMask, &dx11Reactive, true, false, dontUseNTS) == false)
+            if (CopyTextureFrom11To12(InteropInput::Reactive, paramReactiveMask, &dx11Reactive, true, false,
+                                      dontUseNTS) == false)
                 return false;
         }
         // This is only needed for XeSS
@@ -666,6 +694,9 @@ bool IFeature_Dx11wDx12::ProcessDx11Textures(const NVSDK_NGX_Parameter* InParame
             }
         }
 
+        auto copies = _copyBatch.Flush(Dx11DeviceContext);
+        LOG_DEBUG("Input copies: {}, skipped total: {}", copies, _copyBatch.Skipped());
+
         // Fence
         LOG_DEBUG("Dx11 Signal & Dx12 Wait!");
 
@@ -722,7 +753,7 @@ bool IFeature_Dx11wDx12::ProcessDx11Textures(const NVSDK_NGX_Parameter* InParame
             return false;
         }
 
-        dx11Mv.Dx11Handle = dx11Mv.Dx12Handle;
+        dx11Mv.Dx12Handle = dx11Mv.Dx11Handle;
     }
 
     if (paramOutput[_frameCount % 2] && dx11Out.Dx12Handle != dx11Out.Dx11Handle)
@@ -1,5 +1,6 @@
 #pragma once
 #include "IFeature_Dx11.h"
+#include "CopyBatch_Dx11.h"
 
 #include <menu/menu_dx11.h>
 
@@ -61,6 +62,8 @@ class IFeature_Dx11wDx12 : public virtual IFeature_Dx11
     HANDLE dx11SHForTextureCopy = nullptr;
     ULONG _fenceValue = 0;
 
+    CopyBatch_Dx11 _copyBatch;
+
     std::unique_ptr<OS_Dx12> OutputScaler = nullptr;
     std::unique_ptr<RCAS_Dx12> RCAS = nullptr;
     std::unique_ptr<Bias_Dx12> Bias = nullptr;
@@ -70,8 +73,9 @@ class IFeature_Dx11wDx12 : public virtual IFeature_Dx11
     void GetHardwareAdapter(IDXGIFactory1* InFactory, IDXGIAdapter** InAdapter, D3D_FEATURE_LEVEL InFeatureLevel,
                             bool InRequestHighPerformanceAdapter);
 
-    bool CopyTextureFrom11To12(ID3D11Resource* InResource, D3D11_TEXTURE2D_RESOURCE_C* OutResource, bool InCopy,
-                               bool InDepth, bool InDontUseNTShared);
+    bool CopyTextureFrom11To12(InteropInput InInput, ID3D11Resource* InResource,
+                               D3D11_TEXTURE2D_RESOURCE_C* OutResource, bool InCopy, bool InDepth,
+                               bool InDontUseNTShared);
     bool ProcessDx11Textures(const NVSDK_NGX_Parameter* InParameters);
     bool CopyBackOutput();
 
@@ -1,6 +1,7 @@
 #include <pch.h>
 #include "IFeature_Dx12.h"
 #include "State.h"
+#include "Config.h"
 
 void IFeature_Dx12::ResourceBarrier(ID3D12GraphicsCommandList* InCommandList, ID3D12Resource* InResource,
                                     D3D12_RESOURCE_STATES InBeforeState, D3D12_RESOURCE_STATES InAfterState) const
@@ -17,6 +18,60 @@ void IFeature_Dx12::ResourceBarrier(ID3D12GraphicsCommandList* InCommandList, ID
     InCommandList->ResourceBarrier(1, &barrier);
 }
 
+bool IFeature_Dx12::UseFusedOutputScaling(bool InUseSS, bool InRcasActive) const
+{
+    if (!InUseSS || !InRcasActive || !Config::Instance()->OutputScalingFuseRcas.value_or_default())
+        return false;
+
+    if (OutputScalerRcas == nullptr || OutputScaler == nullptr || RCAS == nullptr)
+        return false;
+
+    // Needs output scaling buffer from previous frames, first frame uses separate passes
+    if (OutputScaler->IsUpsampling() || !OutputScaler->CanRender() || !RCAS->IsInit())
+        return false;
+
+    return OutputScalerRcas->CanDispatch(TargetWidth(), TargetHeight(), DisplayWidth(), DisplayHeight());
+}
+
+bool IFeature_Dx12::DispatchFusedOutputScaling(ID3D12GraphicsCommandList* InCommandList,
+                                               ID3D12Resource* InMotionVectors, const RcasConstants& InConstants,
+                                               ID3D12Resource* InOutput)
+{
+    if (OutputScalerRcas->Dispatch(Device, InCommandList, OutputScaler->Buffer(), InMotionVectors, InConstants,
+                                   InOutput))
+    {
+        return true;
+    }
+
+    LOG_WARN("Fused output scaling failed, using separate RCAS and output scaling passes");
+    Config::Instance()->OutputScalingFuseRcas.set_volatile_value(false);
+
+    // Upscaler output is already in OutputScaler's buffer, RCAS writes to its own buffer and output scaling reads that
+    auto scalingSource = OutputScaler->Buffer();
+
+    if (RCAS->CreateBufferResource(Device, OutputScaler->Buffer(), D3D12_RESOURCE_STATE_UNORDERED_ACCESS))
+    {
+        RCAS->SetBufferState(InCommandList, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
+
+        if (RCAS->Dispatch(Device, InCommandList, OutputScaler->Buffer(), InMotionVectors, InConstants,
+                           RCAS->Buffer()))
+        {
+            RCAS->SetBufferState(InCommandList, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
+            scalingSource = RCAS->Buffer();
+        }
+        else
+        {
+            Config::Instance()->RcasEnabled.set_volatile_value(false);
+        }
+    }
+    else
+    {
+        Config::Instance()->RcasEnabled.set_volatile_value(false);
+    }
+
+    return OutputScaler->Dispatch(Device, InCommandList, scalingSource, InOutput);
+}
+
 IFeature_Dx12::IFeature_Dx12(unsigned int InHandleId, NVSDK_NGX_Parameter* InParameters) {}
 
 IFeature_Dx12::~IFeature_Dx12()
@@ -35,4 +90,7 @@ IFeature_Dx12::~IFeature_Dx12()
 
     if (Bias != nullptr && Bias.get() != nullptr)
         Bias.reset();
+
+    if (OutputScalerRcas != nullptr && OutputScalerRcas.get() != nullptr)
+        OutputScalerRcas.reset();
 }
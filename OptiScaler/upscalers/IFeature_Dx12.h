@@ -6,8 +6,10 @@
 #include <Util.h>
 #include <menu/menu_dx12.h>
 #include <shaders/output_scaling/OS_Dx12.h>
+#include <shaders/output_scaling/OSRCAS_Dx12.h>
 #include <shaders/rcas/RCAS_Dx12.h>
 #include <shaders/bias/Bias_Dx12.h>
+#include "BarrierBatch_Dx12.h"
 
 class IFeature_Dx12 : public virtual IFeature
 {
@@ -17,10 +19,19 @@ class IFeature_Dx12 : public virtual IFeature
     std::unique_ptr<OS_Dx12> OutputScaler = nullptr;
     std::unique_ptr<RCAS_Dx12> RCAS = nullptr;
     std::unique_ptr<Bias_Dx12> Bias = nullptr;
+    std::unique_ptr<OSRCAS_Dx12> OutputScalerRcas = nullptr;
 
     void ResourceBarrier(ID3D12GraphicsCommandList* InCommandList, ID3D12Resource* InResource,
                          D3D12_RESOURCE_STATES InBeforeState, D3D12_RESOURCE_STATES InAfterState) const;
 
+    // RCAS and output scaling can run as a single pass for this frame
+    bool UseFusedOutputScaling(bool InUseSS, bool InRcasActive) const;
+
+    // Fused RCAS + output scaling from OutputScaler's buffer to InOutput, when the fused dispatch fails
+    // the same frame runs the separate passes. Returns false only if output scaling itself failed.
+    bool DispatchFusedOutputScaling(ID3D12GraphicsCommandList* InCommandList, ID3D12Resource* InMotionVectors,
+                                    const RcasConstants& InConstants, ID3D12Resource* InOutput);
+
   public:
     virtual bool Init(ID3D12Device* InDevice, ID3D12GraphicsCommandList* InCommandList,
                       NVSDK_NGX_Parameter* InParameters) = 0;
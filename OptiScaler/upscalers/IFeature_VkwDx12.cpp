@@ -1455,6 +1455,7 @@ bool IFeature_VkwDx12::CopyBackOutput()
 
     ID3D12CommandList* ppCommandLists[] = { Dx12CommandList[frame] };
     Dx12CommandQueue->ExecuteCommandLists(1, ppCommandLists);
+    DescriptorRing_Dx12::FrameDone(Dx12CommandQueue, ppCommandLists[0]);
 
     // Signal shared fence after processing
     _fenceValue++;
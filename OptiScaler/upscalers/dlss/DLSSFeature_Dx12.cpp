@@ -83,6 +83,9 @@ bool DLSSFeatureDx12::Init(ID3D12Device* InDevice, ID3D12GraphicsCommandList* In
             Imgui = std::make_unique<Menu_Dx12>(Util::GetProcessWindow(), InDevice);
 
         OutputScaler = std::make_unique<OS_Dx12>("OutputScaling", InDevice, (TargetWidth() < DisplayWidth()));
+
+        if (Config::Instance()->OutputScalingFuseRcas.value_or_default() && TargetWidth() > DisplayWidth())
+            OutputScalerRcas = std::make_unique<OSRCAS_Dx12>("Output Scaling RCAS", InDevice);
     }
 
     SetInit(initResult);
@@ -157,10 +160,20 @@ bool DLSSFeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
         // RCAS sharpness & preperation
         _sharpness = GetSharpness(InParameters);
 
-        if (Config::Instance()->RcasEnabled.value_or(rcasEnabled) &&
-            (_sharpness > 0.0f || (Config::Instance()->MotionSharpnessEnabled.value_or_default() &&
-                                   Config::Instance()->MotionSharpness.value_or_default() > 0.0f)) &&
-            RCAS->IsInit() && RCAS->CreateBufferResource(Device, setBuffer, D3D12_RESOURCE_STATE_UNORDERED_ACCESS))
+        bool rcasActive = Config::Instance()->RcasEnabled.value_or(rcasEnabled) &&
+                          (_sharpness > 0.0f || (Config::Instance()->MotionSharpnessEnabled.value_or_default() &&
+                                                 Config::Instance()->MotionSharpness.value_or_default() > 0.0f));
+
+        // DLSS writes directly to output scaling buffer, RCAS is applied while downscaling
+        bool fuseRcas = UseFusedOutputScaling(useSS, rcasActive);
+
+        if (fuseRcas)
+        {
+            // Disable DLSS sharpness
+            InParameters->Set(NVSDK_NGX_Parameter_Sharpness, 0.0f);
+        }
+        else if (rcasActive && RCAS->IsInit() &&
+                 RCAS->CreateBufferResource(Device, setBuffer, D3D12_RESOURCE_STATE_UNORDERED_ACCESS))
         {
             // Disable DLSS sharpness
             InParameters->Set(NVSDK_NGX_Parameter_Sharpness, 0.0f);
@@ -179,11 +192,11 @@ bool DLSSFeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
             return false;
         }
 
+        // RCAS and output scaling run back to back, bind descriptor ring once for both
+        ScopedDescriptorSequence descriptorSequence {};
+
         // Apply CAS
-        if (Config::Instance()->RcasEnabled.value_or(rcasEnabled) &&
-            (_sharpness > 0.0f || (Config::Instance()->MotionSharpnessEnabled.value_or_default() &&
-                                   Config::Instance()->MotionSharpness.value_or_default() > 0.0f)) &&
-            RCAS->CanRender())
+        if (rcasActive && !fuseRcas && RCAS->CanRender())
         {
             if (setBuffer != RCAS->Buffer())
                 ResourceBarrier(InCommandList, setBuffer, D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
@@ -222,7 +235,30 @@ bool DLSSFeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
         }
 
         // Downsampling
-        if (useSS)
+        if (fuseRcas)
+        {
+            LOG_DEBUG("downscaling output with rcas...");
+            OutputScaler->SetBufferState(InCommandList, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
+
+            RcasConstants rcasConstants {};
+
+            rcasConstants.Sharpness = _sharpness;
+            rcasConstants.DisplayWidth = TargetWidth();
+            rcasConstants.DisplayHeight = TargetHeight();
+            InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_X, &rcasConstants.MvScaleX);
+            InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_Y, &rcasConstants.MvScaleY);
+            rcasConstants.DisplaySizeMV = !(GetFeatureFlags() & NVSDK_NGX_DLSS_Feature_Flags_MVLowRes);
+            rcasConstants.RenderHeight = RenderHeight();
+            rcasConstants.RenderWidth = RenderWidth();
+
+            if (!DispatchFusedOutputScaling(InCommandList, paramMotion, rcasConstants, paramOutput))
+            {
+                Config::Instance()->OutputScalingEnabled.set_volatile_value(false);
+                State::Instance().changeBackend[Handle()->Id] = true;
+                return true;
+            }
+        }
+        else if (useSS)
         {
             LOG_DEBUG("downscaling output...");
             OutputScaler->SetBufferState(InCommandList, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
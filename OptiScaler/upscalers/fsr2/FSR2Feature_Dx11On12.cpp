@@ -383,6 +383,7 @@ bool FSR2FeatureDx11on12::Evaluate(ID3D11DeviceContext* InDeviceContext, NVSDK_N
         cmdList->Close();
         ID3D12CommandList* ppCommandLists[] = { cmdList };
         Dx12CommandQueue->ExecuteCommandLists(1, ppCommandLists);
+        DescriptorRing_Dx12::FrameDone(Dx12CommandQueue, cmdList);
         Dx12CommandQueue->Signal(dx12FenceTextureCopy, _fenceValue);
     }
 
@@ -385,6 +385,7 @@ bool FSR2FeatureDx11on12_212::Evaluate(ID3D11DeviceContext* InDeviceContext, NVS
         cmdList->Close();
         ID3D12CommandList* ppCommandLists[] = { cmdList };
         Dx12CommandQueue->ExecuteCommandLists(1, ppCommandLists);
+        DescriptorRing_Dx12::FrameDone(Dx12CommandQueue, cmdList);
         Dx12CommandQueue->Signal(dx12FenceTextureCopy, _fenceValue);
     }
 
@@ -228,6 +228,10 @@ void FinishVersionCheck()
     std::scoped_lock lock(state.versionCheckMutex);
     state.versionCheckInProgress = false;
     state.versionCheckCompleted = true;
+
+    // Lets the menu's hidden frames notice the update without taking the mutex
+    if (state.updateAvailable && !state.latestVersionTag.empty())
+        state.updateNoticePending.store(true, std::memory_order_release);
 }
 
 void RunVersionCheck()
@@ -308,6 +312,7 @@ void VersionCheck::Start()
         state.versionCheckError.clear();
         state.latestVersionTag.clear();
         state.latestVersionUrl.clear();
+        state.updateNoticePending.store(false, std::memory_order_relaxed);
     }
 
     std::thread(
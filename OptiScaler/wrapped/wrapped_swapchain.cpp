@@ -11,6 +11,8 @@
 #include <menu/menu_overlay_dx.h>
 
 #include <misc/FrameLimit.h>
+#include <misc/BenchmarkCapture.h>
+#include <misc/PresentScheduler.h>
 #include <upscaler_time/UpscalerTime_Dx11.h>
 #include <upscaler_time/UpscalerTime_Dx12.h>
 
@@ -41,6 +43,8 @@ static HRESULT LocalPresent(IDXGISwapChain* pSwapChain, UINT SyncInterval, UINT
 
     LOG_DEBUG("{}", _frameCounter);
 
+    PresentScheduler::BeginPresent();
+
     HRESULT presentResult;
 
     auto willPresent = (Flags & DXGI_PRESENT_TEST) == 0;
@@ -160,14 +164,20 @@ static HRESULT LocalPresent(IDXGISwapChain* pSwapChain, UINT SyncInterval, UINT
     }
 
     auto fg = State::Instance().currentFG;
-    if (willPresent && fg != nullptr)
-        ReflexHooks::update(fg->IsActive(), false);
-    else
-        ReflexHooks::update(false, false);
+    {
+        ScopedPresentStep step(PresentStep::Reflex);
+
+        if (willPresent && fg != nullptr)
+            ReflexHooks::update(fg->IsActive(), false);
+        else
+            ReflexHooks::update(false, false);
+    }
 
     // Upscaler GPU time computation
     if (willPresent && (fg == nullptr || !fg->IsActive() || fg->IsPaused()))
     {
+        ScopedPresentStep step(PresentStep::UpscalerTime);
+
         if (cq != nullptr)
         {
             UpscalerTimeDx12::ReadUpscalingTime(cq);
@@ -216,6 +226,8 @@ static HRESULT LocalPresent(IDXGISwapChain* pSwapChain, UINT SyncInterval, UINT
     // DXVK check, it's here because of upscaler time calculations
     if (State::Instance().isRunningOnDXVK)
     {
+        PresentScheduler::EndPresent();
+
         if (pPresentParameters == nullptr)
             presentResult = pSwapChain->Present(SyncInterval, Flags);
         else
@@ -233,16 +245,20 @@ static HRESULT LocalPresent(IDXGISwapChain* pSwapChain, UINT SyncInterval, UINT
     {
         // Tick feature to let it know if it's frozen
         if (auto currentFeature = State::Instance().currentFeature; currentFeature != nullptr)
+        {
+            ScopedPresentStep step(PresentStep::FrozenCheck);
             currentFeature->TickFrozenCheck();
+        }
 
-        // Draw overlay
-        MenuOverlayDx::Present(pSwapChain, SyncInterval, Flags, pPresentParameters, pDevice, hWnd, isUWP);
+        auto fgOutput = State::Instance().activeFgOutput == FGOutput::FSRFG ||
+                        State::Instance().activeFgOutput == FGOutput::XeFG;
+        auto fgIsActive = false;
+        auto isInterpolated = false;
 
-        LOG_DEBUG("Calling fakenvapi");
-        if (State::Instance().activeFgOutput == FGOutput::FSRFG || State::Instance().activeFgOutput == FGOutput::XeFG)
+        if (fgOutput)
         {
             static UINT64 fgPresentFrame = 0;
-            auto fgIsActive = fg != nullptr && fg->IsActive() && !fg->IsPaused();
+            fgIsActive = fg != nullptr && fg->IsActive() && !fg->IsPaused();
 
             if (State::Instance().FGPresentIsCalled)
             {
@@ -250,23 +266,45 @@ static HRESULT LocalPresent(IDXGISwapChain* pSwapChain, UINT SyncInterval, UINT
                 fgPresentFrame = _frameCounter;
             }
 
-            auto isInterpolated = fgIsActive && (_frameCounter - fgPresentFrame) > 0;
+            isInterpolated = fgIsActive && (_frameCounter - fgPresentFrame) > 0;
+        }
 
-            fakenvapi::reportFGPresent(pSwapChain, fgIsActive, isInterpolated);
+        // Frame stats of the overlay separate generated frames
+        State::Instance().presentIsGenerated = isInterpolated;
+
+        // Draw overlay
+        {
+            ScopedPresentStep step(PresentStep::Menu);
+            MenuOverlayDx::Present(pSwapChain, SyncInterval, Flags, pPresentParameters, pDevice, hWnd, isUWP);
         }
 
+        LOG_DEBUG("Calling fakenvapi");
+        if (fgOutput)
+            fakenvapi::reportFGPresent(pSwapChain, fgIsActive, isInterpolated);
+
         _frameCounter++;
         State::Instance().frameCount = _frameCounter;
     }
 
+    PresentScheduler::EndPresent();
+
     LOG_DEBUG("Calling original present");
 
+    auto presentStart = Util::MillisecondsNow();
+
     // swapchain present
     if (pPresentParameters == nullptr)
         presentResult = pSwapChain->Present(SyncInterval, Flags);
     else
         presentResult = ((IDXGISwapChain1*) pSwapChain)->Present1(SyncInterval, Flags, pPresentParameters);
 
+    if (willPresent)
+    {
+        BenchmarkCapture::FramePresented(BenchmarkRuntime::DXGI, (uint64_t) pSwapChain, SyncInterval, Flags,
+                                         presentStart, Util::MillisecondsNow(),
+                                         State::Instance().presentIsGenerated);
+    }
+
     LOG_DEBUG("Original present result: {:X}", (UINT) presentResult);
 
     if (presentResult == S_OK)
@@ -274,6 +312,9 @@ static HRESULT LocalPresent(IDXGISwapChain* pSwapChain, UINT SyncInterval, UINT
     else
         LOG_ERROR("4 {:X}", (UINT) presentResult);
 
+    if (presentResult == DXGI_ERROR_DEVICE_REMOVED || presentResult == DXGI_ERROR_DEVICE_RESET)
+        MenuOverlayDx::InvalidateContext();
+
     LOG_DEBUG("Done");
 
     return presentResult;
@@ -495,7 +536,10 @@ HRESULT STDMETHODCALLTYPE WrappedIDXGISwapChain4::Present(UINT SyncInterval, UIN
         // When Reflex can't be used to limit, sleep in present
         if (!State::Instance().reflexLimitsFps && State::Instance().activeFgOutput == FGOutput::NoFG &&
             !State::Instance().isRunningOnDXVK)
+        {
+            ScopedPresentStep step(PresentStep::FrameLimit);
             FrameLimit::sleep(false);
+        }
     }
     else
     {
@@ -778,7 +822,10 @@ HRESULT STDMETHODCALLTYPE WrappedIDXGISwapChain4::Present1(UINT SyncInterval, UI
         // When Reflex can't be used to limit, sleep in present
         if (!State::Instance().reflexLimitsFps && State::Instance().activeFgOutput == FGOutput::NoFG &&
             !State::Instance().isRunningOnDXVK)
+        {
+            ScopedPresentStep step(PresentStep::FrameLimit);
             FrameLimit::sleep(false);
+        }
     }
     else
     {
@@ -0,0 +1,157 @@
+#include <upscalers/BarrierBatch_Dx12.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+// Records every ResourceBarrier call
+struct FakeCommandList : ID3D12GraphicsCommandList
+{
+    std::vector<std::vector<D3D12_RESOURCE_BARRIER>> calls;
+
+    ULONG AddRef() override { return 1; }
+    ULONG Release() override { return 1; }
+
+    void ResourceBarrier(UINT NumBarriers, const D3D12_RESOURCE_BARRIER* pBarriers) override
+    {
+        calls.emplace_back(pBarriers, pBarriers + NumBarriers);
+    }
+};
+
+// Resources are only compared by address
+ID3D12Resource* Resource(uintptr_t id) { return (ID3D12Resource*) (id * 0x100); }
+
+constexpr auto SRV = D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE;
+constexpr auto UAV = D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
+constexpr auto CopySource = D3D12_RESOURCE_STATE_COPY_SOURCE;
+constexpr auto RenderTarget = D3D12_RESOURCE_STATE_RENDER_TARGET;
+
+void ExpectTransition(const D3D12_RESOURCE_BARRIER& barrier, ID3D12Resource* resource, D3D12_RESOURCE_STATES before,
+                      D3D12_RESOURCE_STATES after)
+{
+    EXPECT_EQ(barrier.Type, D3D12_RESOURCE_BARRIER_TYPE_TRANSITION);
+    EXPECT_EQ(barrier.Transition.pResource, resource);
+    EXPECT_EQ(barrier.Transition.StateBefore, before);
+    EXPECT_EQ(barrier.Transition.StateAfter, after);
+}
+} // namespace
+
+TEST(BarrierBatchTest, RecordsBatchInOneCall)
+{
+    FakeCommandList cmdList;
+
+    {
+        BarrierBatch_Dx12 batch(&cmdList);
+        batch.Transition(Resource(1), RenderTarget, SRV);
+        batch.Transition(Resource(2), RenderTarget, SRV);
+        batch.Transition(Resource(3), SRV, UAV);
+        EXPECT_EQ(batch.Pending(), 3u);
+        EXPECT_TRUE(cmdList.calls.empty());
+    }
+
+    ASSERT_EQ(cmdList.calls.size(), 1u);
+    ASSERT_EQ(cmdList.calls[0].size(), 3u);
+    ExpectTransition(cmdList.calls[0][0], Resource(1), RenderTarget, SRV);
+    ExpectTransition(cmdList.calls[0][2], Resource(3), SRV, UAV);
+}
+
+TEST(BarrierBatchTest, ChainedTransitionsMerge)
+{
+    FakeCommandList cmdList;
+    BarrierBatch_Dx12 batch(&cmdList);
+
+    batch.Transition(Resource(1), RenderTarget, SRV);
+    batch.Transition(Resource(1), SRV, CopySource);
+    batch.Flush();
+
+    ASSERT_EQ(cmdList.calls.size(), 1u);
+    ASSERT_EQ(cmdList.calls[0].size(), 1u);
+    ExpectTransition(cmdList.calls[0][0], Resource(1), RenderTarget, CopySource);
+}
+
+TEST(BarrierBatchTest, CancellingPairIsDropped)
+{
+    FakeCommandList cmdList;
+    BarrierBatch_Dx12 batch(&cmdList);
+
+    batch.Transition(Resource(1), UAV, SRV);
+    batch.Transition(Resource(2), RenderTarget, SRV);
+    batch.Transition(Resource(1), SRV, UAV);
+    EXPECT_EQ(batch.Pending(), 1u);
+
+    batch.Flush();
+    ASSERT_EQ(cmdList.calls.size(), 1u);
+    ExpectTransition(cmdList.calls[0][0], Resource(2), RenderTarget, SRV);
+}
+
+TEST(BarrierBatchTest, RepeatedAndNoOpTransitionsAreSkipped)
+{
+    FakeCommandList cmdList;
+    BarrierBatch_Dx12 batch(&cmdList);
+
+    batch.Transition(Resource(1), RenderTarget, SRV);
+    batch.Transition(Resource(1), RenderTarget, SRV);
+    batch.Transition(Resource(2), SRV, SRV);
+    batch.Transition(nullptr, SRV, UAV);
+    EXPECT_EQ(batch.Pending(), 1u);
+}
+
+TEST(BarrierBatchTest, DifferentSubresourcesAreKept)
+{
+    FakeCommandList cmdList;
+    BarrierBatch_Dx12 batch(&cmdList);
+
+    batch.Transition(Resource(1), RenderTarget, SRV, 0);
+    batch.Transition(Resource(1), SRV, UAV, 1);
+    EXPECT_EQ(batch.Pending(), 2u);
+
+    // All subresources after a single one isn't merged either
+    batch.Transition(Resource(1), UAV, CopySource);
+    EXPECT_EQ(batch.Pending(), 3u);
+}
+
+TEST(BarrierBatchTest, UnrelatedTransitionKeepsOrder)
+{
+    FakeCommandList cmdList;
+    BarrierBatch_Dx12 batch(&cmdList);
+
+    // Before state doesn't continue the pending one, recorded separately after it
+    batch.Transition(Resource(1), RenderTarget, SRV);
+    batch.Transition(Resource(1), UAV, CopySource);
+    batch.Flush();
+
+    ASSERT_EQ(cmdList.calls[0].size(), 2u);
+    ExpectTransition(cmdList.calls[0][0], Resource(1), RenderTarget, SRV);
+    ExpectTransition(cmdList.calls[0][1], Resource(1), UAV, CopySource);
+}
+
+TEST(BarrierBatchTest, FullBatchFlushes)
+{
+    FakeCommandList cmdList;
+
+    {
+        BarrierBatch_Dx12 batch(&cmdList);
+
+        for (uintptr_t i = 1; i <= 20; i++)
+            batch.Transition(Resource(i), RenderTarget, SRV);
+    }
+
+    ASSERT_EQ(cmdList.calls.size(), 2u);
+    EXPECT_EQ(cmdList.calls[0].size(), 16u);
+    EXPECT_EQ(cmdList.calls[1].size(), 4u);
+    ExpectTransition(cmdList.calls[1][3], Resource(20), RenderTarget, SRV);
+}
+
+TEST(BarrierBatchTest, EmptyBatchRecordsNothing)
+{
+    FakeCommandList cmdList;
+
+    {
+        BarrierBatch_Dx12 batch(&cmdList);
+        batch.Transition(Resource(1), UAV, SRV);
+        batch.Transition(Resource(1), SRV, UAV);
+        batch.Flush();
+    }
+
+    EXPECT_TRUE(cmdList.calls.empty());
+}
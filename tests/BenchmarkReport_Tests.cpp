@@ -0,0 +1,244 @@
+#include <misc/BenchmarkReport.h>
+
+#include <gtest/gtest.h>
+
+#include <json.hpp>
+
+#include <sstream>
+#include <vector>
+
+namespace
+{
+// Frames presented at a fixed rate, times are filled like BenchmarkCapture does
+std::vector<BenchmarkFrame> MakeFrames(size_t count, float frameMs)
+{
+    std::vector<BenchmarkFrame> frames(count);
+    double time = 0.0;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        auto& frame = frames[i];
+        frame.timeMs = time;
+        frame.msBetweenPresents = i == 0 ? 0.0f : frameMs;
+        frame.msInPresentApi = 0.5f;
+        frame.swapChain = 0x1234;
+        frame.renderWidth = 1280;
+        frame.renderHeight = 720;
+        frame.displayWidth = 2560;
+        frame.displayHeight = 1440;
+        std::strncpy(frame.upscaler, "FSR 3.1", sizeof(frame.upscaler));
+
+        time += frameMs;
+    }
+
+    return frames;
+}
+
+std::vector<std::string> Split(const std::string& line, char separator)
+{
+    std::vector<std::string> fields;
+    std::string field;
+    bool quoted = false;
+
+    for (size_t i = 0; i < line.size(); i++)
+    {
+        auto c = line[i];
+
+        if (c == '"')
+        {
+            if (quoted && i + 1 < line.size() && line[i + 1] == '"')
+                field += line[++i];
+            else
+                quoted = !quoted;
+        }
+        else if (c == separator && !quoted)
+        {
+            fields.push_back(field);
+            field.clear();
+        }
+        else
+        {
+            field += c;
+        }
+    }
+
+    fields.push_back(field);
+    return fields;
+}
+
+std::vector<std::string> Lines(const std::string& text)
+{
+    std::vector<std::string> lines;
+    std::istringstream stream(text);
+
+    for (std::string line; std::getline(stream, line);)
+        lines.push_back(line);
+
+    return lines;
+}
+} // namespace
+
+TEST(BenchmarkReportTest, EmptyCapture)
+{
+    auto summary = BenchmarkReport::Summarize(nullptr, 0);
+    EXPECT_EQ(summary.frames, 0u);
+    EXPECT_EQ(summary.avgFps, 0.0);
+
+    // Single frame has no present interval
+    auto frames = MakeFrames(1, 10.0f);
+    summary = BenchmarkReport::Summarize(frames.data(), frames.size());
+    EXPECT_EQ(summary.frames, 1u);
+    EXPECT_EQ(summary.meanMs, 0.0);
+    EXPECT_EQ(summary.upscaler, "FSR 3.1");
+}
+
+TEST(BenchmarkReportTest, SteadyFrameRate)
+{
+    auto frames = MakeFrames(101, 10.0f);
+    auto summary = BenchmarkReport::Summarize(frames.data(), frames.size());
+
+    EXPECT_EQ(summary.frames, 101u);
+    EXPECT_DOUBLE_EQ(summary.durationSec, 1.0);
+    EXPECT_DOUBLE_EQ(summary.meanMs, 10.0);
+    EXPECT_DOUBLE_EQ(summary.avgFps, 100.0);
+    EXPECT_DOUBLE_EQ(summary.p99Ms, 10.0);
+    EXPECT_DOUBLE_EQ(summary.low1Fps, 100.0);
+    EXPECT_EQ(summary.stutters, 0u);
+    EXPECT_DOUBLE_EQ(summary.avgPresentApiMs, 0.5);
+    EXPECT_EQ(summary.displayWidth, 2560u);
+}
+
+TEST(BenchmarkReportTest, PercentilesAndStutters)
+{
+    // 1000 intervals: 980 x 10ms, 15 x 25ms, 5 x 50ms
+    auto frames = MakeFrames(1001, 10.0f);
+
+    for (size_t i = 1; i <= 15; i++)
+        frames[i * 50].msBetweenPresents = 25.0f;
+
+    for (size_t i = 1; i <= 5; i++)
+        frames[i * 50 + 25].msBetweenPresents = 50.0f;
+
+    auto summary = BenchmarkReport::Summarize(frames.data(), frames.size());
+
+    EXPECT_DOUBLE_EQ(summary.p50Ms, 10.0);
+    EXPECT_DOUBLE_EQ(summary.p95Ms, 10.0);
+    EXPECT_DOUBLE_EQ(summary.p99Ms, 25.0);
+    EXPECT_DOUBLE_EQ(summary.p999Ms, 50.0);
+    EXPECT_DOUBLE_EQ(summary.maxMs, 50.0);
+    EXPECT_DOUBLE_EQ(summary.low1Fps, 40.0);
+    EXPECT_DOUBLE_EQ(summary.low01Fps, 20.0);
+
+    // Over 2x median, exactly 2x isn't a stutter
+    EXPECT_EQ(summary.stutters, 20u);
+    frames[10].msBetweenPresents = 20.0f;
+    EXPECT_EQ(BenchmarkReport::Summarize(frames.data(), frames.size()).stutters, 20u);
+}
+
+TEST(BenchmarkReportTest, OptionalTimingsAverageReportedFramesOnly)
+{
+    auto frames = MakeFrames(10, 16.0f);
+
+    for (size_t i = 0; i < frames.size(); i += 2)
+    {
+        frames[i].msUpscaler = 2.0f;
+        frames[i].msReflex[static_cast<size_t>(LatencyStage::GpuRender)] = 8.0f;
+        frames[i].fgActive = 1;
+        frames[i].generated = i % 4 == 0;
+    }
+
+    auto summary = BenchmarkReport::Summarize(frames.data(), frames.size());
+
+    EXPECT_DOUBLE_EQ(summary.avgUpscalerMs, 2.0);
+    EXPECT_DOUBLE_EQ(summary.avgReflexMs[static_cast<size_t>(LatencyStage::GpuRender)], 8.0);
+    EXPECT_DOUBLE_EQ(summary.avgReflexMs[static_cast<size_t>(LatencyStage::Driver)], 0.0);
+    EXPECT_EQ(summary.fgActiveFrames, 5u);
+    EXPECT_EQ(summary.generatedFrames, 3u);
+}
+
+TEST(BenchmarkReportTest, CsvHasPresentMonColumnsAndOneRowPerFrame)
+{
+    auto frames = MakeFrames(3, 10.0f);
+    frames[1].generated = 1;
+    frames[2].runtime = BenchmarkRuntime::Vulkan;
+
+    std::string csv;
+    BenchmarkReport::AppendCsv(csv, frames.data(), frames.size(), "Game.exe", 42);
+
+    auto lines = Lines(csv);
+    ASSERT_EQ(lines.size(), 4u);
+
+    auto header = Split(lines[0], ',');
+    const char* presentMon[] = { "Application", "ProcessID", "SwapChainAddress", "Runtime",
+                                 "SyncInterval", "PresentFlags", "FrameType", "TimeInSeconds",
+                                 "MsBetweenPresents", "MsInPresentAPI" };
+
+    for (size_t i = 0; i < std::size(presentMon); i++)
+        EXPECT_EQ(header[i], presentMon[i]);
+
+    EXPECT_EQ(header.back(), "MsReflexTotal");
+
+    for (size_t i = 1; i < lines.size(); i++)
+        EXPECT_EQ(Split(lines[i], ',').size(), header.size());
+
+    auto row = Split(lines[2], ',');
+    EXPECT_EQ(row[0], "Game.exe");
+    EXPECT_EQ(row[1], "42");
+    EXPECT_EQ(row[2], "0x0000000000001234");
+    EXPECT_EQ(row[3], "DXGI");
+    EXPECT_EQ(row[6], "Generated");
+    EXPECT_EQ(row[7], "0.010000");
+    EXPECT_EQ(row[8], "10.000");
+    EXPECT_EQ(row[12], "FSR 3.1");
+
+    EXPECT_EQ(Split(lines[3], ',')[3], "Vulkan");
+}
+
+TEST(BenchmarkReportTest, CsvQuotesFields)
+{
+    auto frames = MakeFrames(1, 10.0f);
+    std::strncpy(frames[0].upscaler, "XeSS, \"DP4a\"", sizeof(frames[0].upscaler));
+
+    std::string csv;
+    BenchmarkReport::AppendCsv(csv, frames.data(), frames.size(), "My, Game", 1);
+
+    auto lines = Lines(csv);
+    ASSERT_EQ(lines.size(), 2u);
+
+    auto row = Split(lines[1], ',');
+    ASSERT_EQ(row.size(), Split(lines[0], ',').size());
+    EXPECT_EQ(row[0], "My, Game");
+    EXPECT_EQ(row[12], "XeSS, \"DP4a\"");
+}
+
+TEST(BenchmarkReportTest, UpscalerNameWithoutTerminator)
+{
+    auto frames = MakeFrames(2, 10.0f);
+    std::memset(frames[1].upscaler, 'A', sizeof(frames[1].upscaler));
+
+    auto summary = BenchmarkReport::Summarize(frames.data(), frames.size());
+    EXPECT_EQ(summary.upscaler, std::string(sizeof(frames[1].upscaler), 'A'));
+}
+
+TEST(BenchmarkReportTest, JsonIsValidAndEscaped)
+{
+    auto frames = MakeFrames(101, 10.0f);
+    std::strncpy(frames.back().upscaler, "DLSS \"Preset\\K\"", sizeof(frames.back().upscaler));
+
+    auto summary = BenchmarkReport::Summarize(frames.data(), frames.size());
+
+    std::string json;
+    BenchmarkReport::AppendJson(json, summary, "C:\\Games\\\"Game\"\n.exe", 7);
+
+    auto parsed = nlohmann::json::parse(json);
+
+    EXPECT_EQ(parsed["application"], "C:\\Games\\\"Game\".exe");
+    EXPECT_EQ(parsed["processId"], 7);
+    EXPECT_EQ(parsed["upscaler"], "DLSS \"Preset\\K\"");
+    EXPECT_EQ(parsed["frames"], 101);
+    EXPECT_EQ(parsed["renderResolution"][0], 1280);
+    EXPECT_DOUBLE_EQ(parsed["averageFps"].get<double>(), 100.0);
+    EXPECT_DOUBLE_EQ(parsed["frameTimeMs"]["p99"].get<double>(), 10.0);
+    EXPECT_EQ(parsed["reflexMs"].size(), BENCHMARK_REFLEX_STAGES);
+    EXPECT_TRUE(parsed["reflexMs"].contains("GpuRender"));
+}
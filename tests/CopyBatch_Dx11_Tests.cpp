@@ -0,0 +1,200 @@
+#include <upscalers/CopyBatch_Dx11.h>
+
+#include <gtest/gtest.h>
+
+#include <new>
+
+namespace
+{
+// Texture with D3D11 private data behaviour, tagging can be made to fail
+struct FakeResource : ID3D11Resource
+{
+    bool hasData = false;
+    UINT64 data = 0;
+    bool setFails = false;
+
+    ULONG AddRef() override { return 1; }
+    ULONG Release() override { return 1; }
+
+    HRESULT GetPrivateData(REFGUID guid, UINT* pDataSize, void* pData) override
+    {
+        if (!hasData || std::memcmp(&guid, &CopyBatch_Dx11::SourceIdGuid, sizeof(GUID)) != 0)
+            return DXGI_ERROR_NOT_FOUND;
+
+        if (*pDataSize < sizeof(data))
+            return E_FAIL;
+
+        *pDataSize = sizeof(data);
+        std::memcpy(pData, &data, sizeof(data));
+        return S_OK;
+    }
+
+    HRESULT SetPrivateData(REFGUID, UINT DataSize, const void* pData) override
+    {
+        if (setFails || DataSize != sizeof(data))
+            return E_FAIL;
+
+        std::memcpy(&data, pData, sizeof(data));
+        hasData = true;
+        return S_OK;
+    }
+};
+
+struct FakeContext : ID3D11DeviceContext
+{
+    std::vector<std::pair<ID3D11Resource*, ID3D11Resource*>> copies;
+
+    ULONG AddRef() override { return 1; }
+    ULONG Release() override { return 1; }
+
+    void CopyResource(ID3D11Resource* pDstResource, ID3D11Resource* pSrcResource) override
+    {
+        copies.push_back({ pDstResource, pSrcResource });
+    }
+};
+
+class CopyBatchTest : public testing::Test
+{
+  protected:
+    CopyBatch_Dx11 batch;
+    FakeContext context;
+    FakeResource source;
+    FakeResource target;
+
+    InteropCopyKey Key(ID3D11Resource* resource, bool immutable, UINT64 frame)
+    {
+        InteropCopyKey key {};
+        key.sourceId = CopyBatch_Dx11::SourceId(resource);
+        key.target = (uintptr_t) &target;
+        key.width = 64;
+        key.height = 32;
+        key.format = 10;
+        key.generation = CopyBatch_Dx11::Generation(immutable, frame);
+        return key;
+    }
+
+    // One frame of a single input, returns copies issued
+    UINT Frame(InteropInput input, ID3D11Resource* resource, bool immutable, UINT64 frame)
+    {
+        batch.Begin();
+        batch.Queue(input, Key(resource, immutable, frame), &target, resource);
+        return batch.Flush(&context);
+    }
+};
+
+constexpr auto Exposure = InteropInput::Exposure;
+constexpr auto Color = InteropInput::Color;
+} // namespace
+
+TEST_F(CopyBatchTest, ImmutableSourceCopiedOnce)
+{
+    EXPECT_EQ(Frame(Exposure, &source, true, 0), 1u);
+    EXPECT_EQ(Frame(Exposure, &source, true, 1), 0u);
+    EXPECT_EQ(Frame(Exposure, &source, true, 2), 0u);
+    EXPECT_EQ(batch.Issued(), 1u);
+    EXPECT_EQ(batch.Skipped(), 2u);
+}
+
+TEST_F(CopyBatchTest, MutableSourceCopiedEveryFrame)
+{
+    for (UINT64 frame = 0; frame < 3; frame++)
+        EXPECT_EQ(Frame(Color, &source, false, frame), 1u);
+
+    EXPECT_EQ(batch.Skipped(), 0u);
+}
+
+TEST_F(CopyBatchTest, SourceIdIsStable)
+{
+    auto id = CopyBatch_Dx11::SourceId(&source);
+    EXPECT_NE(id, 0u);
+    EXPECT_EQ(CopyBatch_Dx11::SourceId(&source), id);
+
+    // Another batch sees the same tag
+    CopyBatch_Dx11 other;
+    EXPECT_EQ(other.SourceId(&source), id);
+}
+
+TEST_F(CopyBatchTest, ReusedAddressIsCopied)
+{
+    alignas(FakeResource) unsigned char storage[sizeof(FakeResource)];
+
+    auto first = new (storage) FakeResource();
+    EXPECT_EQ(Frame(Exposure, first, true, 0), 1u);
+    first->~FakeResource();
+
+    // Game released the texture and created a new immutable one at the same address
+    auto second = new (storage) FakeResource();
+    ASSERT_EQ((void*) first, (void*) second);
+
+    EXPECT_EQ(Frame(Exposure, second, true, 1), 1u);
+    EXPECT_EQ(Frame(Exposure, second, true, 2), 0u);
+    second->~FakeResource();
+}
+
+TEST_F(CopyBatchTest, UntaggedSourceIsNeverSkipped)
+{
+    source.setFails = true;
+    EXPECT_EQ(CopyBatch_Dx11::SourceId(&source), 0u);
+
+    EXPECT_EQ(Frame(Exposure, &source, true, 0), 1u);
+    EXPECT_EQ(Frame(Exposure, &source, true, 1), 1u);
+}
+
+TEST_F(CopyBatchTest, DroppedBatchIsNotCommitted)
+{
+    batch.Begin();
+    EXPECT_TRUE(batch.Queue(Exposure, Key(&source, true, 0), &target, &source));
+    EXPECT_EQ(batch.Pending(), 1u);
+
+    // Early return, never flushed
+    EXPECT_EQ(Frame(Exposure, &source, true, 1), 1u);
+    EXPECT_EQ(context.copies.size(), 1u);
+}
+
+TEST_F(CopyBatchTest, InvalidateForcesCopy)
+{
+    EXPECT_EQ(Frame(Exposure, &source, true, 0), 1u);
+
+    batch.Invalidate(Exposure);
+    EXPECT_EQ(Frame(Exposure, &source, true, 1), 1u);
+
+    batch.Reset();
+    EXPECT_EQ(Frame(Exposure, &source, true, 2), 1u);
+}
+
+TEST_F(CopyBatchTest, SignatureChangeIsCopied)
+{
+    EXPECT_EQ(Frame(Exposure, &source, true, 0), 1u);
+
+    auto key = Key(&source, true, 1);
+    key.width = 128;
+
+    batch.Begin();
+    EXPECT_TRUE(batch.Queue(Exposure, key, &target, &source));
+    EXPECT_EQ(batch.Flush(&context), 1u);
+}
+
+TEST_F(CopyBatchTest, SameInputQueuedTwiceLastWins)
+{
+    FakeResource later;
+
+    batch.Begin();
+    EXPECT_TRUE(batch.Queue(Color, Key(&source, false, 0), &target, &source));
+    EXPECT_TRUE(batch.Queue(Color, Key(&later, false, 0), &target, &later));
+    EXPECT_TRUE(batch.Queue(Exposure, Key(&source, true, 0), &target, &source));
+    EXPECT_EQ(batch.Pending(), 2u);
+
+    EXPECT_EQ(batch.Flush(&context), 2u);
+    ASSERT_EQ(context.copies.size(), 2u);
+    EXPECT_EQ(context.copies[0].second, &later);
+    EXPECT_EQ(context.copies[1].second, &source);
+}
+
+TEST_F(CopyBatchTest, NullResourcesAreNotQueued)
+{
+    batch.Begin();
+    EXPECT_FALSE(batch.Queue(Color, Key(&source, false, 0), nullptr, &source));
+    EXPECT_FALSE(batch.Queue(Color, Key(&source, false, 0), &target, nullptr));
+    EXPECT_EQ(batch.Pending(), 0u);
+    EXPECT_EQ(CopyBatch_Dx11::SourceId(nullptr), 0u);
+}
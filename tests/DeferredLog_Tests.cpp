@@ -0,0 +1,150 @@
+#include <SysUtils.h> // Host one, includes DeferredLog.h after spdlog
+
+#include <spdlog/sinks/ostream_sink.h>
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <thread>
+
+namespace
+{
+std::vector<std::string> Lines(const std::string& text)
+{
+    std::vector<std::string> lines;
+    std::istringstream stream(text);
+
+    for (std::string line; std::getline(stream, line);)
+        lines.push_back(line);
+
+    return lines;
+}
+
+class DeferredLogTest : public testing::Test
+{
+  protected:
+    std::ostringstream output;
+
+    void SetUp() override
+    {
+        auto sink = std::make_shared<spdlog::sinks::ostream_sink_mt>(output);
+        sink->set_pattern("%v");
+
+        auto logger = std::make_shared<spdlog::logger>("deferred_test", sink);
+        logger->set_level(spdlog::level::trace);
+        spdlog::set_default_logger(logger);
+
+        DeferredLog::Init();
+        ASSERT_TRUE(DeferredLog::IsEnabled());
+
+        // Drop the enabled message
+        output.str({});
+    }
+
+    void TearDown() override
+    {
+        DeferredLog::Shutdown();
+        spdlog::drop_all();
+    }
+};
+} // namespace
+
+TEST_F(DeferredLogTest, ImmediateLogsComeAfterDeferred)
+{
+    for (int i = 0; i < 100; i++)
+    {
+        DeferredLog::Log(spdlog::level::debug, "deferred {}", i * 2);
+        DeferredLog::LogNow(spdlog::level::info, "now {}", i * 2 + 1);
+    }
+
+    DeferredLog::Shutdown();
+
+    auto lines = Lines(output.str());
+    ASSERT_EQ(lines.size(), 200u);
+
+    for (int i = 0; i < 200; i++)
+        EXPECT_EQ(lines[i], std::format("{} {}", i % 2 == 0 ? "deferred" : "now", i));
+}
+
+TEST_F(DeferredLogTest, NonDeferrableArgsComeAfterDeferred)
+{
+    DeferredLog::Log(spdlog::level::debug, "first {} {}", 1, 2.5f);
+    DeferredLog::Log(spdlog::level::debug, "second {}", std::string("text"));
+    DeferredLog::Log(spdlog::level::debug, "third {}", true);
+
+    DeferredLog::Shutdown();
+
+    EXPECT_EQ(Lines(output.str()), (std::vector<std::string> { "first 1 2.5", "second text", "third true" }));
+}
+
+TEST_F(DeferredLogTest, ThreadOrderIsKept)
+{
+    constexpr int threadCount = 4;
+    constexpr int perThread = 200;
+
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < threadCount; t++)
+    {
+        threads.emplace_back(
+            [t]
+            {
+                for (int i = 0; i < perThread; i++)
+                {
+                    if (i % 3 == 0)
+                        DeferredLog::LogNow(spdlog::level::warn, "{} {}", t, i);
+                    else
+                        DeferredLog::Log(spdlog::level::trace, "{} {}", t, i);
+                }
+            });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    DeferredLog::Shutdown();
+
+    std::vector<int> next(threadCount, 0);
+
+    for (auto& line : Lines(output.str()))
+    {
+        int t = 0;
+        int i = 0;
+        ASSERT_EQ(sscanf(line.c_str(), "%d %d", &t, &i), 2);
+        EXPECT_EQ(i, next[t]) << "thread " << t;
+        next[t] = i + 1;
+    }
+
+    for (int t = 0; t < threadCount; t++)
+        EXPECT_EQ(next[t], perThread);
+}
+
+TEST_F(DeferredLogTest, ShutdownWritesPendingRecords)
+{
+    // Less than a ring, nothing is dropped even if the log thread never ran
+    for (int i = 0; i < 500; i++)
+        DeferredLog::Log(spdlog::level::debug, "{}", i);
+
+    DeferredLog::Shutdown();
+    EXPECT_FALSE(DeferredLog::IsEnabled());
+
+    auto lines = Lines(output.str());
+    ASSERT_EQ(lines.size(), 500u);
+    EXPECT_EQ(lines.back(), "499");
+
+    // Disabled, logged on the calling thread
+    DeferredLog::Log(spdlog::level::debug, "{}", 500);
+    EXPECT_EQ(Lines(output.str()).back(), "500");
+}
+
+TEST_F(DeferredLogTest, DisabledLevelsAreSkipped)
+{
+    spdlog::default_logger()->set_level(spdlog::level::info);
+
+    DeferredLog::Log(spdlog::level::debug, "{}", 1);
+    DeferredLog::LogNow(spdlog::level::info, "{}", 2);
+
+    DeferredLog::Shutdown();
+
+    EXPECT_EQ(Lines(output.str()), (std::vector<std::string> { "2" }));
+}
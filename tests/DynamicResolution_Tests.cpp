@@ -0,0 +1,202 @@
+#include <Config.h>
+#include <misc/DynamicResolution.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+
+namespace
+{
+// Frame time model of the simulated game, GPU bound part overlaps CPU
+struct Load
+{
+    double cpuMs;
+    double gpuMsAtFull;
+    double upscalerMs;
+};
+
+struct RunResult
+{
+    float scale;
+    double meanMs; // Second half of the run
+    int changes;
+};
+
+double FrameMs(const Load& load, float scale, std::mt19937& rng)
+{
+    std::normal_distribution<double> noise(0.0, 0.3);
+    auto gpuMs = load.gpuMsAtFull * scale * scale + load.upscalerMs;
+    return std::max(load.cpuMs, gpuMs) + noise(rng);
+}
+
+// Game renders the advertised scale on the next frame, or fixedScale when it doesn't follow
+RunResult Simulate(DrsController& controller, const Load& load, int frames, float fixedScale = 0.0f)
+{
+    std::mt19937 rng(1);
+    auto rendered = fixedScale > 0.0f ? fixedScale : controller.Scale();
+    auto last = controller.Scale();
+    auto sum = 0.0;
+    auto changes = 0;
+
+    for (int i = 0; i < frames; i++)
+    {
+        auto ms = FrameMs(load, rendered, rng);
+        auto scale = controller.Update(ms, load.upscalerMs, rendered);
+
+        EXPECT_TRUE(std::isfinite(scale));
+        EXPECT_GE(scale, controller.Settings().minScale);
+        EXPECT_LE(scale, controller.Settings().maxScale);
+
+        if (scale != last)
+            changes++;
+
+        last = scale;
+
+        if (fixedScale == 0.0f)
+            rendered = scale;
+
+        if (i >= frames / 2)
+            sum += ms;
+    }
+
+    return { controller.Scale(), sum / (frames - frames / 2), changes };
+}
+
+class DrsControllerTest : public testing::Test
+{
+  protected:
+    DrsControllerSettings settings {};
+    DrsController controller;
+
+    void Start(float scale)
+    {
+        controller.Configure(settings);
+        controller.Reset(scale);
+    }
+
+    double Band() const { return settings.targetMs * DrsController::Hysteresis; }
+};
+} // namespace
+
+TEST_F(DrsControllerTest, GpuBoundHoldsTarget)
+{
+    Start(1.0f);
+
+    auto result = Simulate(controller, { 5.0, 24.0, 1.0 }, 2000);
+    EXPECT_LT(result.scale, 1.0f);
+    EXPECT_NEAR(result.meanMs, settings.targetMs, Band());
+
+    // Settled, noise stays inside hysteresis
+    EXPECT_LE(Simulate(controller, { 5.0, 24.0, 1.0 }, 1000).changes, 2);
+}
+
+TEST_F(DrsControllerTest, MixedLoadHoldsTarget)
+{
+    Start(1.0f);
+
+    auto result = Simulate(controller, { 12.0, 30.0, 1.0 }, 3000);
+    EXPECT_NEAR(result.meanMs, settings.targetMs, Band());
+    EXPECT_LT(result.changes, 40);
+}
+
+TEST_F(DrsControllerTest, SpikeIsFollowedAndRelieved)
+{
+    Start(1.0f);
+    Simulate(controller, { 5.0, 24.0, 1.0 }, 2000);
+
+    // Load doubles
+    std::mt19937 rng(2);
+    auto rendered = controller.Scale();
+    auto framesOver = 0;
+
+    for (int i = 0; i < 60; i++)
+    {
+        auto ms = FrameMs({ 5.0, 40.0, 1.0 }, rendered, rng);
+        rendered = controller.Update(ms, 1.0, rendered);
+
+        if (i >= 20 && ms > settings.targetMs * 1.1)
+            framesOver++;
+    }
+
+    EXPECT_LT(framesOver, 5);
+
+    auto relief = Simulate(controller, { 5.0, 24.0, 1.0 }, 2000);
+    EXPECT_NEAR(relief.meanMs, settings.targetMs, Band());
+}
+
+TEST_F(DrsControllerTest, LightLoadGoesToMax)
+{
+    Start(0.6f);
+    EXPECT_EQ(Simulate(controller, { 3.0, 8.0, 1.0 }, 2000).scale, settings.maxScale);
+}
+
+TEST_F(DrsControllerTest, CpuBoundGoesToMax)
+{
+    Start(1.0f);
+    EXPECT_EQ(Simulate(controller, { 25.0, 10.0, 1.0 }, 2000).scale, settings.maxScale);
+}
+
+TEST_F(DrsControllerTest, IgnoredScaleDoesNotWindUp)
+{
+    Start(0.67f);
+
+    auto result = Simulate(controller, { 5.0, 40.0, 1.0 }, 2000, 0.67f);
+    EXPECT_LT(result.changes, 20);
+}
+
+TEST_F(DrsControllerTest, ScaleStaysInsideBounds)
+{
+    settings.minScale = 0.7f;
+    settings.maxScale = 0.9f;
+    Start(1.0f);
+    EXPECT_EQ(controller.Scale(), 0.9f);
+
+    // Target out of reach at min scale
+    Simulate(controller, { 5.0, 80.0, 1.0 }, 1000);
+    EXPECT_GE(controller.Scale(), 0.7f);
+}
+
+TEST(DynamicResolution, GeneratedFramesFoldIntoNextRendered)
+{
+    Config::Instance()->DrsControllerEnabled = true;
+    DynamicResolution::Reset();
+
+    EXPECT_EQ(DynamicResolution::CurrentScale(), 0.0f);
+    EXPECT_NEAR(DynamicResolution::RenderScale(0.667f, 0.5f, 1.0f), 0.667f, 1e-6);
+
+    for (int i = 0; i < 300; i++)
+    {
+        DynamicResolution::FramePresented(12.0, false, 1.0, 0.0f);
+        DynamicResolution::FramePresented(12.0, true, 0.0, 0.0f);
+    }
+
+    EXPECT_GE(DynamicResolution::CurrentScale(), 0.5f);
+    EXPECT_NEAR(DynamicResolution::FilteredMs(), 24.0, 0.5);
+
+    DynamicResolution::Reset();
+    Config::Instance()->DrsControllerEnabled.reset();
+}
+
+TEST(DynamicResolution, NewBoundsRestartController)
+{
+    DynamicResolution::Reset();
+    DynamicResolution::RenderScale(0.667f, 0.5f, 1.0f);
+
+    // GPU bound game following the advertised scale
+    for (int i = 0; i < 300; i++)
+    {
+        auto scale = DynamicResolution::CurrentScale();
+        DynamicResolution::FramePresented(1.0 + 40.0 * scale * scale, false, 1.0, scale);
+    }
+
+    EXPECT_LT(DynamicResolution::CurrentScale(), 0.667f);
+
+    // Other quality modes keep the running controller, display change restarts it
+    DynamicResolution::RenderScale(0.5f, 0.5f, 1.0f);
+    EXPECT_LT(DynamicResolution::CurrentScale(), 0.667f);
+
+    EXPECT_NEAR(DynamicResolution::RenderScale(0.58f, 0.4f, 1.0f), 0.58f, 1e-6);
+
+    DynamicResolution::Reset();
+}
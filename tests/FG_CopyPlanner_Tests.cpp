@@ -0,0 +1,154 @@
+#include <framegen/FG_CopyPlanner.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+constexpr uintptr_t Tracked = 0x100;
+constexpr uintptr_t Unrelated = 0x999;
+
+FG_CopyRequest Request(uintptr_t resource = Tracked)
+{
+    FG_CopyRequest request {};
+    request.type = FG_ResourceType::HudlessColor;
+    request.resource = resource;
+    request.width = 1920;
+    request.height = 1080;
+    return request;
+}
+
+class CopyPlannerTest : public testing::Test
+{
+  protected:
+    void SetUp() override { FG_CopyPlanner::Reset(); }
+
+    // One FG frame of the tracked resource: plan, tag, game work, FG consumption
+    FG_CopyMode Frame(bool written, bool observed = true, bool trackedAtTag = true,
+                      FG_CopyRequest request = Request())
+    {
+        auto plan = FG_CopyPlanner::Plan(request, true, false);
+        FG_CopyPlanner::Tagged(request.type, request.resource, trackedAtTag);
+
+        FG_CopyPlanner::Written(Unrelated);
+        if (written)
+            FG_CopyPlanner::Written(request.resource);
+
+        FG_CopyPlanner::Consumed(observed);
+        return plan.mode;
+    }
+
+    void MakeAliasable()
+    {
+        for (UINT i = 0; i < FG_CopyPlanner::AliasCleanFrames; i++)
+            ASSERT_EQ(Frame(false), FG_CopyMode::Full);
+
+        ASSERT_EQ(Frame(false), FG_CopyMode::Alias);
+    }
+};
+} // namespace
+
+TEST_F(CopyPlannerTest, RegionCoversInterpolationRect)
+{
+    auto request = Request();
+    request.rectTop = 140;
+    request.rectWidth = 1920;
+    request.rectHeight = 800;
+
+    auto plan = FG_CopyPlanner::Plan(request, false, true);
+    EXPECT_EQ(plan.mode, FG_CopyMode::Region);
+    EXPECT_EQ(plan.left, 0u);
+    EXPECT_EQ(plan.top, 140u);
+    EXPECT_EQ(plan.right, 1920u);
+    EXPECT_EQ(plan.bottom, 940u);
+
+    EXPECT_EQ(FG_CopyPlanner::Plan(request, false, false).mode, FG_CopyMode::Full);
+
+    request.wholeOnly = true;
+    EXPECT_EQ(FG_CopyPlanner::Plan(request, false, true).mode, FG_CopyMode::Full);
+}
+
+TEST_F(CopyPlannerTest, InvalidRectsCopyWhole)
+{
+    auto request = Request();
+    request.rectWidth = 1920;
+    request.rectHeight = 1080;
+    EXPECT_EQ(FG_CopyPlanner::Plan(request, false, true).mode, FG_CopyMode::Full); // Whole resource
+
+    request.rectTop = 100;
+    EXPECT_EQ(FG_CopyPlanner::Plan(request, false, true).mode, FG_CopyMode::Full); // Out of bounds
+
+    request.rectWidth = 0;
+    EXPECT_EQ(FG_CopyPlanner::Plan(request, false, true).mode, FG_CopyMode::Full); // Not set
+}
+
+TEST_F(CopyPlannerTest, AliasAfterCleanFrames)
+{
+    MakeAliasable();
+    EXPECT_EQ(FG_CopyPlanner::PlannedCount(FG_CopyMode::Full), FG_CopyPlanner::AliasCleanFrames);
+    EXPECT_EQ(FG_CopyPlanner::PlannedCount(FG_CopyMode::Alias), 1u);
+}
+
+TEST_F(CopyPlannerTest, WriteBeforeConsumeStartsCooldown)
+{
+    MakeAliasable();
+
+    EXPECT_EQ(Frame(true), FG_CopyMode::Alias);
+    EXPECT_EQ(FG_CopyPlanner::AliasDrops(), 1u);
+
+    for (UINT i = 0; i < FG_CopyPlanner::AliasCooldownFrames; i++)
+        ASSERT_EQ(Frame(false), FG_CopyMode::Full);
+
+    EXPECT_EQ(Frame(false), FG_CopyMode::Alias);
+}
+
+TEST_F(CopyPlannerTest, WritesAfterConsumeDontCount)
+{
+    for (UINT i = 0; i <= FG_CopyPlanner::AliasCleanFrames; i++)
+    {
+        Frame(false);
+        FG_CopyPlanner::Written(Tracked); // Next frame's rendering
+    }
+
+    EXPECT_EQ(Frame(false), FG_CopyMode::Alias);
+}
+
+TEST_F(CopyPlannerTest, UnobservedFramesNeverProve)
+{
+    for (int i = 0; i < 50; i++)
+        ASSERT_EQ(Frame(false, false), FG_CopyMode::Full);
+
+    // Tracking was off when inputs were tagged, on again at present
+    for (int i = 0; i < 50; i++)
+        ASSERT_EQ(Frame(false, true, false), FG_CopyMode::Full);
+}
+
+TEST_F(CopyPlannerTest, UnobservedFrameDoesNotLeakIntoNext)
+{
+    for (UINT i = 0; i < FG_CopyPlanner::AliasCleanFrames - 1; i++)
+        Frame(false);
+
+    Frame(false, true, false);
+    EXPECT_EQ(Frame(false), FG_CopyMode::Full);
+    EXPECT_EQ(Frame(false), FG_CopyMode::Alias);
+}
+
+TEST_F(CopyPlannerTest, DepthStencilIsNeverAliased)
+{
+    auto request = Request();
+    request.type = FG_ResourceType::Depth;
+    request.depthStencil = true;
+    request.wholeOnly = true;
+
+    for (UINT i = 0; i < FG_CopyPlanner::AliasCleanFrames * 4; i++)
+        ASSERT_EQ(Frame(false, true, true, request), FG_CopyMode::Full);
+}
+
+TEST_F(CopyPlannerTest, NewResourceResetsHistory)
+{
+    MakeAliasable();
+
+    FG_CopyPlanner::Tagged(FG_ResourceType::HudlessColor, 0x200, true);
+    FG_CopyPlanner::Consumed(true);
+
+    EXPECT_EQ(Frame(false), FG_CopyMode::Full);
+}
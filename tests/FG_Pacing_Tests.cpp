@@ -0,0 +1,116 @@
+#include "FG_PacingSim.h"
+
+#include <framegen/IFGFeature.h>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+namespace
+{
+using Event = FG_SimEventType;
+
+constexpr UINT64 Inputs = (1ull << FG_ResourceType::Depth) | (1ull << FG_ResourceType::Velocity);
+
+// Same events every frame
+std::vector<FG_SimEvent> Repeat(std::initializer_list<FG_SimEvent> frame, int count)
+{
+    std::vector<FG_SimEvent> events;
+
+    for (int i = 0; i < count; i++)
+        events.insert(events.end(), frame);
+
+    return events;
+}
+} // namespace
+
+TEST(FG_Pacing, SteadyFramesDispatchEveryFrame)
+{
+    auto events =
+        Repeat({ { Event::NewFrame }, { Event::Tag, Inputs }, { Event::Present }, { Event::Executed } }, 1000);
+    auto report = FG_PacingSim::Run(events, 1);
+
+    EXPECT_EQ(report.frames, 1000u);
+    EXPECT_EQ(report.dispatches, 1000u);
+    EXPECT_EQ(report.dropped, 0u);
+    EXPECT_EQ(report.duplicates, 0u);
+    EXPECT_EQ(report.stale, 0u);
+    EXPECT_EQ(report.notReady, 0u);
+    EXPECT_EQ(report.waitingSkip, 0u);
+}
+
+TEST(FG_Pacing, DoublePresentDoesNotDispatchTwice)
+{
+    auto events = Repeat(
+        { { Event::NewFrame }, { Event::Tag, Inputs }, { Event::Present }, { Event::Present }, { Event::Executed } },
+        1000);
+    auto report = FG_PacingSim::Run(events, 1);
+
+    EXPECT_EQ(report.presents, 2000u);
+    EXPECT_EQ(report.dispatches, 1000u);
+    EXPECT_EQ(report.duplicates, 0u);
+}
+
+TEST(FG_Pacing, LateTagsNeverDispatchStaleBuffers)
+{
+    auto events =
+        Repeat({ { Event::NewFrame }, { Event::Present }, { Event::Tag, Inputs }, { Event::Executed } }, 1000);
+    auto report = FG_PacingSim::Run(events, 1);
+
+    EXPECT_GT(report.dispatches, 0u);
+    EXPECT_EQ(report.duplicates, 0u);
+    EXPECT_EQ(report.stale, 0u);
+}
+
+TEST(FG_Pacing, PauseSkipsPresents)
+{
+    std::vector<FG_SimEvent> events { { Event::NewFrame }, { Event::Tag, Inputs }, { Event::Pause } };
+    auto frames = Repeat({ { Event::NewFrame }, { Event::Tag, Inputs }, { Event::Present }, { Event::Executed } },
+                         (int) FG_Pacing::PauseFrames * 2);
+    events.insert(events.end(), frames.begin(), frames.end());
+
+    auto report = FG_PacingSim::Run(events, 1);
+
+    EXPECT_GT(report.paused, 0u);
+    EXPECT_LE(report.paused, FG_Pacing::PauseFrames);
+    EXPECT_EQ(report.paused + report.dispatches, report.presents);
+}
+
+TEST(FG_Pacing, RandomScriptsAreReproducible)
+{
+    for (uint32_t seed = 1; seed <= 5; seed++)
+    {
+        auto first = FG_PacingSim::Run(FG_PacingSim::RandomScript(20000, seed), 1);
+        auto second = FG_PacingSim::Run(FG_PacingSim::RandomScript(20000, seed), 1);
+
+        EXPECT_EQ(first.dispatches, second.dispatches) << "seed " << seed;
+        EXPECT_EQ(first.dropped, second.dropped) << "seed " << seed;
+        EXPECT_EQ(first.maxLatency, second.maxLatency) << "seed " << seed;
+        EXPECT_EQ(first.duplicates, 0u) << "seed " << seed;
+    }
+}
+
+TEST(FG_Pacing, RacingPresentsClaimFrameOnce)
+{
+    for (int i = 0; i < 2000; i++)
+    {
+        FG_Pacing pacing;
+        pacing.NewFrame();
+        pacing.NewFrame();
+
+        std::atomic<int> wins { 0 };
+        auto present = [&]()
+        {
+            UINT64 willDispatchFrame = 0;
+            if (pacing.Dispatch(1, true, willDispatchFrame) >= 0)
+                wins++;
+        };
+
+        std::thread first(present);
+        std::thread second(present);
+        first.join();
+        second.join();
+
+        ASSERT_EQ(wins.load(), 1);
+    }
+}
@@ -0,0 +1,137 @@
+#include <hooks/FG_ResizeState.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+struct FakeResource : IUnknown
+{
+    int releases = 0;
+
+    ULONG AddRef() override { return 1; }
+    ULONG Release() override { return (ULONG) ++releases; }
+};
+
+class FGResizeStateTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        FGResizeState::Reset(true, 0);
+        FGResizeState::SetTimeout(5000.0);
+    }
+};
+} // namespace
+
+TEST_F(FGResizeStateTest, ResizeRecreatesAfterFencePasses)
+{
+    auto value = FGResizeState::BeginResize(0.0);
+    EXPECT_EQ(FGResizeState::Phase(), FGResizePhase::Retiring);
+
+    // GPU still behind
+    EXPECT_FALSE(FGResizeState::Update(value - 1, 10.0));
+    EXPECT_EQ(FGResizeState::Phase(), FGResizePhase::Retiring);
+
+    // Resize hook waited for the fence, phase moves before the real ResizeBuffers
+    EXPECT_FALSE(FGResizeState::Update(value, 20.0));
+    EXPECT_EQ(FGResizeState::Phase(), FGResizePhase::Recreate);
+
+    // Next present recreates once
+    EXPECT_TRUE(FGResizeState::Update(value, 30.0));
+    EXPECT_EQ(FGResizeState::Phase(), FGResizePhase::Idle);
+    EXPECT_FALSE(FGResizeState::Update(value, 40.0));
+}
+
+TEST_F(FGResizeStateTest, TimeoutRecreatesWithoutFence)
+{
+    FGResizeState::SetTimeout(100.0);
+    FGResizeState::BeginResize(0.0);
+
+    EXPECT_FALSE(FGResizeState::Update(0, 50.0));
+    EXPECT_EQ(FGResizeState::Phase(), FGResizePhase::Retiring);
+
+    EXPECT_FALSE(FGResizeState::Update(0, 150.0));
+    EXPECT_EQ(FGResizeState::Phase(), FGResizePhase::Recreate);
+    EXPECT_TRUE(FGResizeState::Update(0, 160.0));
+}
+
+TEST_F(FGResizeStateTest, RetiredObjectsWaitForTheirSignal)
+{
+    FakeResource first;
+    FakeResource second;
+
+    FGResizeState::Retire(&first);
+    EXPECT_TRUE(FGResizeState::NeedsSignal());
+
+    auto firstValue = FGResizeState::NextSignalValue();
+    EXPECT_FALSE(FGResizeState::NeedsSignal());
+
+    FGResizeState::Retire(&second);
+    auto secondValue = FGResizeState::NextSignalValue();
+
+    FGResizeState::Update(firstValue - 1, 0.0);
+    EXPECT_EQ(first.releases, 0);
+
+    FGResizeState::Update(firstValue, 0.0);
+    EXPECT_EQ(first.releases, 1);
+    EXPECT_EQ(second.releases, 0);
+    EXPECT_EQ(FGResizeState::RetiredCount(), 1u);
+
+    FGResizeState::Update(secondValue, 0.0);
+    EXPECT_EQ(second.releases, 1);
+    EXPECT_EQ(FGResizeState::RetiredCount(), 0u);
+}
+
+TEST_F(FGResizeStateTest, RetireWithoutFenceReleasesImmediately)
+{
+    FGResizeState::Reset(false, 0);
+
+    FakeResource resource;
+    FGResizeState::Retire(&resource);
+
+    EXPECT_EQ(resource.releases, 1);
+    EXPECT_EQ(FGResizeState::RetiredCount(), 0u);
+}
+
+TEST_F(FGResizeStateTest, ResetKeepsObjectsInFlight)
+{
+    FakeResource done;
+    FakeResource inFlight;
+
+    FGResizeState::Retire(&done);
+    auto doneValue = FGResizeState::NextSignalValue();
+    FGResizeState::Retire(&inFlight);
+    FGResizeState::NextSignalValue();
+
+    // Fence recreated, old one only passed the first value
+    FGResizeState::Reset(true, doneValue);
+
+    EXPECT_EQ(done.releases, 1);
+    EXPECT_EQ(inFlight.releases, 0);
+    EXPECT_EQ(FGResizeState::Phase(), FGResizePhase::Idle);
+
+    // Waits for the first value signaled on the new fence
+    EXPECT_TRUE(FGResizeState::NeedsSignal());
+    FGResizeState::Update(0, 0.0);
+    EXPECT_EQ(inFlight.releases, 0);
+
+    auto value = FGResizeState::NextSignalValue();
+    EXPECT_EQ(value, 1u);
+    FGResizeState::Update(value, 0.0);
+    EXPECT_EQ(inFlight.releases, 1);
+}
+
+TEST_F(FGResizeStateTest, ResizeDuringRetireKeepsOrder)
+{
+    FakeResource resource;
+
+    FGResizeState::Retire(&resource);
+    auto resizeValue = FGResizeState::BeginResize(0.0);
+
+    // Resize value is signaled after the retired object's value
+    EXPECT_GE(resizeValue, 1u);
+    FGResizeState::Update(resizeValue, 10.0);
+
+    EXPECT_EQ(resource.releases, 1);
+    EXPECT_EQ(FGResizeState::Phase(), FGResizePhase::Recreate);
+}
@@ -0,0 +1,106 @@
+#include <misc/FrameStats.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <fstream>
+#include <numeric>
+#include <random>
+
+namespace
+{
+// Nearest rank percentile of the last WindowSize samples
+double ReferencePercentile(const std::vector<double>& samples, double p)
+{
+    auto count = std::min(samples.size(), FrameTimeWindow::WindowSize);
+    std::vector<double> window(samples.end() - count, samples.end());
+    std::sort(window.begin(), window.end());
+
+    auto k = std::clamp<size_t>((size_t) std::ceil(p * (double) count), 1, count);
+    return window[k - 1];
+}
+} // namespace
+
+TEST(FrameTimeWindow, PercentilesMatchSortedWindow)
+{
+    std::mt19937 rng(1);
+    std::vector<double> samples;
+    FrameTimeWindow window;
+
+    for (int i = 0; i < 10000; i++)
+    {
+        auto ms = i % 500 == 0 ? 80.0 : 5.0 + (rng() % 1000) / 100.0;
+        window.Add(ms, false, 2.0);
+        samples.push_back(ms);
+
+        if (i % 997 != 0)
+            continue;
+
+        // Bucket middle, within half a bucket plus float storage
+        for (auto p : { 0.5, 0.95, 0.99, 0.999 })
+            ASSERT_NEAR(window.Percentile(p), ReferencePercentile(samples, p), 0.011) << "frame " << i << " p " << p;
+
+        auto count = std::min(samples.size(), FrameTimeWindow::WindowSize);
+        auto sum = std::accumulate(samples.end() - count, samples.end(), 0.0);
+        ASSERT_NEAR(window.Mean(), sum / (double) count, 1e-3);
+
+        auto shortCount = std::min(samples.size(), FrameTimeWindow::ShortWindowSize);
+        auto shortSum = std::accumulate(samples.end() - shortCount, samples.end(), 0.0);
+        ASSERT_NEAR(window.ShortMean(), shortSum / (double) shortCount, 1e-3);
+    }
+
+    // Spikes every 500 frames, the window holds 4 of them
+    FrameTimeSummary summary;
+    window.Summarize(summary);
+    EXPECT_EQ(summary.stutters, 4u);
+    EXPECT_EQ(summary.samples, FrameTimeWindow::WindowSize);
+    EXPECT_NEAR(summary.max, 80.0, 0.011);
+}
+
+TEST(FrameTimeWindow, NoStuttersBeforeMinSamples)
+{
+    FrameTimeWindow window;
+
+    for (size_t i = 0; i + 1 < FrameTimeWindow::MinStutterSamples; i++)
+        EXPECT_FALSE(window.Add(i % 2 == 0 ? 5.0 : 50.0, false, 2.0));
+
+    window.Reset();
+    EXPECT_EQ(window.Count(), 0u);
+    EXPECT_EQ(window.Percentile(0.5), 0.0);
+}
+
+TEST(FrameStats, RenderedFramesSkipGenerated)
+{
+    FrameStats::Reset();
+
+    for (int i = 0; i < 3000; i++)
+        FrameStats::Add(8.0, i % 2 == 1);
+
+    auto summary = FrameStats::Summary();
+    EXPECT_EQ(summary.totalFrames, 3000u);
+    EXPECT_EQ(summary.generated, FrameTimeWindow::WindowSize / 2);
+    EXPECT_NEAR(summary.displayed.p50, 8.0, 0.01);
+    EXPECT_NEAR(summary.rendered.p50, 16.0, 0.01);
+}
+
+TEST(FrameStats, ExportsWindowAsCsv)
+{
+    FrameStats::Reset();
+
+    for (int i = 0; i < 10; i++)
+        FrameStats::Add(10.0 + i, false);
+
+    auto path = std::filesystem::temp_directory_path() / "FrameStats_Tests.csv";
+    ASSERT_TRUE(FrameStats::ExportCsv(path));
+
+    std::ifstream file(path);
+    std::string line;
+    size_t lines = 0;
+
+    while (std::getline(file, line))
+        lines++;
+
+    EXPECT_EQ(lines, 11u); // Header and one row per frame
+
+    std::filesystem::remove(path);
+}
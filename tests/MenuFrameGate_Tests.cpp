@@ -0,0 +1,73 @@
+#include <menu/menu_frame_gate.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+// Splash already shown and over, nothing else visible
+OverlayFrameState Hidden()
+{
+    OverlayFrameState state {};
+    state.splashStart = 1000.0;
+    state.splashLimit = 8000.0;
+    return state;
+}
+} // namespace
+
+TEST(MenuFrameGateTest, HiddenOverlayIsSkipped)
+{
+    EXPECT_FALSE(OverlayFrameNeeded(Hidden(), 10000.0));
+}
+
+TEST(MenuFrameGateTest, VisibleWidgetsNeedFrame)
+{
+    auto state = Hidden();
+    state.menuVisible = true;
+    EXPECT_TRUE(OverlayFrameNeeded(state, 10000.0));
+
+    state = Hidden();
+    state.fpsOverlay = true;
+    EXPECT_TRUE(OverlayFrameNeeded(state, 10000.0));
+
+    state = Hidden();
+    state.updateNoticeVisible = true;
+    EXPECT_TRUE(OverlayFrameNeeded(state, 10000.0));
+}
+
+TEST(MenuFrameGateTest, PendingShortcutNeedsFrame)
+{
+    // Shortcut opens the menu in RenderMenu, skipping would drop the key
+    auto state = Hidden();
+    state.shortcutPending = true;
+    EXPECT_TRUE(OverlayFrameNeeded(state, 10000.0));
+}
+
+TEST(MenuFrameGateTest, PendingUpdateNoticeNeedsFrame)
+{
+    // Version check finished between presents, RenderMenu has to pick the notice up
+    auto state = Hidden();
+    state.updateNoticePending = true;
+    EXPECT_TRUE(OverlayFrameNeeded(state, 10000.0));
+}
+
+TEST(MenuFrameGateTest, SplashWindow)
+{
+    auto state = Hidden();
+
+    EXPECT_FALSE(OverlayFrameNeeded(state, 1000.0));
+    EXPECT_TRUE(OverlayFrameNeeded(state, 1000.5));
+    EXPECT_TRUE(OverlayFrameNeeded(state, 7999.0));
+    EXPECT_FALSE(OverlayFrameNeeded(state, 8000.0));
+
+    state.splashDisabled = true;
+    EXPECT_FALSE(OverlayFrameNeeded(state, 5000.0));
+}
+
+TEST(MenuFrameGateTest, UnscheduledSplashNeedsFrame)
+{
+    // First RenderMenu schedules the splash, needed even when the splash is disabled
+    OverlayFrameState state {};
+    state.splashDisabled = true;
+    EXPECT_TRUE(OverlayFrameNeeded(state, 0.0));
+    EXPECT_TRUE(OverlayFrameNeeded(state, 100000.0));
+}
@@ -0,0 +1,122 @@
+#include <misc/ModuleRanges.h>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+namespace
+{
+const void* Address(uintptr_t value) { return (const void*) value; }
+
+HMODULE Module(uintptr_t base) { return (HMODULE) base; }
+
+class ModuleRangesTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        ModuleRanges::Clear();
+
+        // Added out of order like loader notifications
+        ModuleRanges::Add(0x30000, 0x8000, Module(0x30000), "amdxc64.dll");
+        ModuleRanges::Add(0x10000, 0x4000, Module(0x10000), "game.exe");
+        ModuleRanges::Add(0x20000, 0x1000, Module(0x20000), "sl.interposer.dll");
+    }
+
+    void TearDown() override { ModuleRanges::Clear(); }
+};
+} // namespace
+
+TEST_F(ModuleRangesTest, FindsContainingModule)
+{
+    EXPECT_EQ(ModuleRanges::Count(), 3u);
+
+    EXPECT_EQ(ModuleRanges::Find(Address(0x10000)), Module(0x10000));
+    EXPECT_EQ(ModuleRanges::Find(Address(0x13FFF)), Module(0x10000));
+    EXPECT_EQ(ModuleRanges::Find(Address(0x20800)), Module(0x20000));
+    EXPECT_EQ(ModuleRanges::Find(Address(0x37FFF)), Module(0x30000));
+
+    EXPECT_EQ(ModuleRanges::Name(Address(0x12345)), "game.exe");
+}
+
+TEST_F(ModuleRangesTest, GapsAndEndsAreUnknown)
+{
+    // Before first, between, at end (exclusive) and after last
+    EXPECT_EQ(ModuleRanges::Find(Address(0x0FFFF)), nullptr);
+    EXPECT_EQ(ModuleRanges::Find(Address(0x14000)), nullptr);
+    EXPECT_EQ(ModuleRanges::Find(Address(0x21000)), nullptr);
+    EXPECT_EQ(ModuleRanges::Find(Address(0x38000)), nullptr);
+    EXPECT_EQ(ModuleRanges::Find(nullptr), nullptr);
+    EXPECT_TRUE(ModuleRanges::Name(Address(0x14000)).empty());
+}
+
+TEST_F(ModuleRangesTest, ModuleNameIsCaseInsensitive)
+{
+    EXPECT_TRUE(ModuleRanges::IsInModule(Address(0x30010), "amdxc64.dll"));
+    EXPECT_TRUE(ModuleRanges::IsInModule(Address(0x30010), "AMDXC64.DLL"));
+    EXPECT_FALSE(ModuleRanges::IsInModule(Address(0x30010), "amdxc64"));
+    EXPECT_FALSE(ModuleRanges::IsInModule(Address(0x30010), "sl.interposer.dll"));
+    EXPECT_FALSE(ModuleRanges::IsInModule(Address(0x14000), ""));
+}
+
+TEST_F(ModuleRangesTest, RemoveByBase)
+{
+    ModuleRanges::Remove(0x20000);
+    EXPECT_EQ(ModuleRanges::Count(), 2u);
+    EXPECT_EQ(ModuleRanges::Find(Address(0x20800)), nullptr);
+
+    // Address inside a module isn't its base
+    ModuleRanges::Remove(0x10010);
+    EXPECT_EQ(ModuleRanges::Count(), 2u);
+}
+
+TEST_F(ModuleRangesTest, OverlapReplacesMissedUnload)
+{
+    // sl.interposer.dll unloaded without notification, another module loaded over it and the gap after
+    ModuleRanges::Add(0x20800, 0x2000, Module(0x20800), "nvngx.dll");
+
+    EXPECT_EQ(ModuleRanges::Count(), 3u);
+    EXPECT_EQ(ModuleRanges::Find(Address(0x20000)), nullptr);
+    EXPECT_EQ(ModuleRanges::Name(Address(0x22000)), "nvngx.dll");
+
+    // Same module reported twice, Init and notification race
+    ModuleRanges::Add(0x10000, 0x4000, Module(0x10000), "game.exe");
+    EXPECT_EQ(ModuleRanges::Count(), 3u);
+}
+
+TEST_F(ModuleRangesTest, InvalidRangesAreIgnored)
+{
+    ModuleRanges::Add(0, 0x1000, nullptr, "null.dll");
+    ModuleRanges::Add(0x50000, 0, Module(0x50000), "empty.dll");
+    EXPECT_EQ(ModuleRanges::Count(), 3u);
+}
+
+TEST_F(ModuleRangesTest, LookupsDuringUpdates)
+{
+    std::atomic<bool> done = false;
+    std::atomic<int> wrong = 0;
+
+    std::thread reader(
+        [&]()
+        {
+            while (!done.load())
+            {
+                if (ModuleRanges::Find(Address(0x12000)) != Module(0x10000))
+                    wrong++;
+            }
+        });
+
+    for (uintptr_t i = 0; i < 2000; i++)
+    {
+        auto base = 0x100000 + (i % 64) * 0x1000;
+        ModuleRanges::Add(base, 0x800, Module(base), "plugin.dll");
+
+        if (i % 3 == 0)
+            ModuleRanges::Remove(base);
+    }
+
+    done = true;
+    reader.join();
+
+    EXPECT_EQ(wrong.load(), 0);
+}
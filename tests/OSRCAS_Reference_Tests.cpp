@@ -0,0 +1,251 @@
+#include <Hlsl_Host.h>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <random>
+
+// Fused output scaling + RCAS (OSRCAS_Common.h) against RCAS_Common.h followed by the OS_Common.h downscaler,
+// all three run from the shader text the passes compile. With a float intermediate buffer the results match
+// up to float rounding. Otherwise the two pass result carries the rounding of the intermediate's format:
+// at most the kernel's absolute weight sum (below 2) times the largest rounding step, 2^-m * max value for m
+// mantissa bits.
+
+using namespace hlsl;
+
+namespace
+{
+struct RcasParams
+{
+    float sharpness = 0.8f;
+    float contrast = -100.0f; // Contrast adaptation off
+    int dynamicSharpen = 0;
+    int displaySizeMV = 1;
+    float motionSharpness = 0.4f;
+    float threshold = 0.1f;
+    float scaleLimit = 10.0f;
+};
+
+struct Format
+{
+    const char* name;
+    float (*quantize)(float, int);
+    int mantissaBits; // 0 for float
+};
+
+// Round to nearest even with the format's mantissa, 5 bit exponent like half and packed floats
+float RoundMantissa(float value, int mantissaBits)
+{
+    if (value == 0.0f || !std::isfinite(value))
+        return value;
+
+    int exponent = 0;
+    std::frexp(value, &exponent);
+    exponent = std::max(exponent, -13);
+
+    auto step = std::ldexp(1.0f, exponent - 1 - mantissaBits);
+    return std::nearbyint(value / step) * step;
+}
+
+float QuantizeRgba16F(float value, int) { return RoundMantissa(value, 10); }
+
+// Signed formats only, unsigned ones also clip RCAS undershoot in the two pass path which the fused pass keeps
+const Format formats[] = { { "R32G32B32A32_FLOAT", nullptr, 0 }, { "R16G16B16A16_FLOAT", QuantizeRgba16F, 10 } };
+
+// Upscaler output like content: gradients, noise and hard edges
+Image MakeSource(int width, int height)
+{
+    Image image(width, height);
+    std::mt19937 random(1234);
+    std::uniform_real_distribution<float> noise(-0.08f, 0.08f);
+
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            auto checker = ((x / 5 + y / 3) % 2) == 0 ? 0.7f : 0.2f;
+            auto r = 0.1f + 0.8f * float(x) / float(width) + noise(random);
+            auto g = checker + noise(random);
+            auto b = 0.5f + 0.4f * std::sin(float(x * y) * 0.05f) + noise(random);
+
+            image.At(x, y) = float4(std::clamp(r, 0.02f, 0.98f), std::clamp(g, 0.02f, 0.98f),
+                                    std::clamp(b, 0.02f, 0.98f), 1.0f);
+        }
+    }
+
+    return image;
+}
+
+Image MakeMotion(int width, int height)
+{
+    Image image(width, height);
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> motion(-24.0f, 24.0f);
+
+    for (auto& texel : image.texels)
+        texel = float4(motion(random), motion(random), 0.0f, 0.0f);
+
+    return image;
+}
+
+template <class Shader> void SetRcasConstants(Shader& shader, const RcasParams& params, int width, int height)
+{
+    shader.Sharpness = params.sharpness;
+    shader.Contrast = params.contrast;
+    shader.DynamicSharpenEnabled = params.dynamicSharpen;
+    shader.DisplaySizeMV = params.displaySizeMV;
+    shader.Debug = 0;
+    shader.MotionSharpness = params.motionSharpness;
+    shader.MotionTextureScale = params.displaySizeMV ? 1.0f : 0.5f;
+    shader.MvScaleX = 1.0f / float(width);
+    shader.MvScaleY = 1.0f / float(height);
+    shader.Threshold = params.threshold;
+    shader.ScaleLimit = params.scaleLimit;
+    shader.DisplayWidth = width;
+    shader.DisplayHeight = height;
+}
+
+uint Groups(int size, uint groupSize) { return (uint(size) + groupSize - 1) / groupSize; }
+
+template <class Downscaler>
+Image TwoPass(const Image& source, const Image& motion, const RcasParams& params, const Format& format, int dstWidth,
+              int dstHeight)
+{
+    Image sharpened(source.width, source.height);
+
+    auto rcas = std::make_unique<Rcas>();
+    SetRcasConstants(*rcas, params, source.width, source.height);
+    rcas->Source.image = &source;
+    rcas->Motion.image = &motion;
+    rcas->Dest.image = &sharpened;
+    rcas->Dest.quantize = format.quantize;
+    rcas->Dispatch(Groups(source.width, Rcas::NumThreadsX), Groups(source.height, Rcas::NumThreadsY));
+
+    Image output(dstWidth, dstHeight);
+
+    auto downscaler = std::make_unique<Downscaler>();
+    downscaler->_SrcWidth = source.width;
+    downscaler->_SrcHeight = source.height;
+    downscaler->_DstWidth = dstWidth;
+    downscaler->_DstHeight = dstHeight;
+    downscaler->InputTexture.image = &sharpened;
+    downscaler->OutputTexture.image = &output;
+    downscaler->Dispatch(Groups(dstWidth, Downscaler::NumThreadsX), Groups(dstHeight, Downscaler::NumThreadsY));
+
+    return output;
+}
+
+template <class Fused>
+Image FusedPass(const Image& source, const Image& motion, const RcasParams& params, int dstWidth, int dstHeight)
+{
+    Image output(dstWidth, dstHeight);
+
+    auto fused = std::make_unique<Fused>();
+    SetRcasConstants(*fused, params, source.width, source.height);
+    fused->_SrcWidth = source.width;
+    fused->_SrcHeight = source.height;
+    fused->_DstWidth = dstWidth;
+    fused->_DstHeight = dstHeight;
+    fused->Source.image = &source;
+    fused->Motion.image = &motion;
+    fused->OutputTexture.image = &output;
+    fused->Dispatch(Groups(dstWidth, Fused::NumThreadsX), Groups(dstHeight, Fused::NumThreadsY));
+
+    return output;
+}
+
+struct Difference
+{
+    float maxError = 0.0f;
+    float maxValue = 0.0f;
+};
+
+Difference Compare(const Image& expected, const Image& actual)
+{
+    Difference result;
+
+    for (size_t i = 0; i < expected.texels.size(); i++)
+    {
+        for (int c = 0; c < 3; c++)
+        {
+            result.maxError = std::max(result.maxError, std::fabs(expected.texels[i][c] - actual.texels[i][c]));
+            result.maxValue = std::max(result.maxValue, std::fabs(expected.texels[i][c]));
+        }
+    }
+
+    return result;
+}
+
+struct Scale
+{
+    int srcWidth;
+    int srcHeight;
+    int dstWidth;
+    int dstHeight;
+};
+
+// 1.5x, 2x, non integer and the largest ratio the groupshared tile allows
+const Scale scales[] = { { 48, 48, 32, 32 }, { 64, 40, 32, 20 }, { 50, 30, 23, 17 }, { 56, 28, 16, 8 } };
+
+const RcasParams rcasCases[] = {
+    {},
+    { 0.5f, -0.4f },                                // Contrast adaptation
+    { 0.3f, -100.0f, 1, 1 },                        // Motion adaptive, display size MVs
+    { 0.0f, -100.0f, 1, 0, 0.6f, 0.05f, 4.0f },     // Motion adaptive only, low res MVs
+    { 0.2f, -100.0f, 1, 1, -0.5f, 0.05f, 4.0f },    // Motion reduces sharpness
+};
+
+template <class Downscaler, class Fused> void CompareKernel()
+{
+    for (auto& scale : scales)
+    {
+        auto source = MakeSource(scale.srcWidth, scale.srcHeight);
+        auto motion = MakeMotion(scale.srcWidth, scale.srcHeight);
+
+        for (size_t p = 0; p < std::size(rcasCases); p++)
+        {
+            auto fused = FusedPass<Fused>(source, motion, rcasCases[p], scale.dstWidth, scale.dstHeight);
+
+            for (auto& format : formats)
+            {
+                SCOPED_TRACE(testing::Message() << scale.srcWidth << "x" << scale.srcHeight << " -> " << scale.dstWidth
+                                                << "x" << scale.dstHeight << ", case " << p << ", " << format.name);
+
+                auto twoPass = TwoPass<Downscaler>(source, motion, rcasCases[p], format, scale.dstWidth,
+                                                   scale.dstHeight);
+                auto difference = Compare(twoPass, fused);
+
+                auto allowed = format.mantissaBits == 0
+                                   ? 1e-5f
+                                   : std::ldexp(1.0f, -format.mantissaBits) * std::max(difference.maxValue, 1.0f);
+
+                EXPECT_LE(difference.maxError, allowed);
+                EXPECT_GT(difference.maxValue, 0.0f);
+            }
+        }
+    }
+}
+} // namespace
+
+TEST(OSRCASReferenceTest, Lanczos2MatchesTwoPass) { CompareKernel<OSLanczos2, OSRcasLanczos2>(); }
+
+TEST(OSRCASReferenceTest, Lanczos3MatchesTwoPass) { CompareKernel<OSLanczos3, OSRcasLanczos3>(); }
+
+TEST(OSRCASReferenceTest, Kaiser2MatchesTwoPass) { CompareKernel<OSKaiser2, OSRcasKaiser2>(); }
+
+TEST(OSRCASReferenceTest, Kaiser3MatchesTwoPass) { CompareKernel<OSKaiser3, OSRcasKaiser3>(); }
+
+TEST(OSRCASReferenceTest, SharpeningIsApplied)
+{
+    // Guards the comparison against both paths skipping RCAS
+    auto source = MakeSource(64, 40);
+    auto motion = MakeMotion(64, 40);
+
+    RcasParams off {};
+    off.sharpness = 0.0f;
+
+    auto sharpened = FusedPass<OSRcasLanczos2>(source, motion, {}, 32, 20);
+    auto plain = FusedPass<OSRcasLanczos2>(source, motion, off, 32, 20);
+
+    EXPECT_GT(Compare(plain, sharpened).maxError, 0.01f);
+}
@@ -0,0 +1,379 @@
+#include <Config.h>
+#include <misc/OptimalSettings.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+// Optimal settings callbacks as they were before the tables, reading Config directly
+
+std::optional<float> ReferenceOverrideRatio(NVSDK_NGX_PerfQuality_Value input)
+{
+    auto config = Config::Instance();
+    auto sliderLimit = config->ExtendedLimits.value_or_default() ? 0.1f : 1.0f;
+
+    if (config->UpscaleRatioOverrideEnabled.value_or_default() &&
+        config->UpscaleRatioOverrideValue.value_or_default() >= sliderLimit)
+    {
+        return config->UpscaleRatioOverrideValue.value_or_default();
+    }
+
+    if (!config->QualityRatioOverrideEnabled.value_or_default())
+        return std::nullopt;
+
+    float ratio = 0.0f;
+
+    switch (input)
+    {
+    case NVSDK_NGX_PerfQuality_Value_UltraPerformance:
+        ratio = config->QualityRatio_UltraPerformance.value_or_default();
+        break;
+
+    case NVSDK_NGX_PerfQuality_Value_MaxPerf:
+        ratio = config->QualityRatio_Performance.value_or_default();
+        break;
+
+    case NVSDK_NGX_PerfQuality_Value_Balanced:
+        ratio = config->QualityRatio_Balanced.value_or_default();
+        break;
+
+    case NVSDK_NGX_PerfQuality_Value_MaxQuality:
+        ratio = config->QualityRatio_Quality.value_or_default();
+        break;
+
+    case NVSDK_NGX_PerfQuality_Value_UltraQuality:
+        ratio = config->QualityRatio_UltraQuality.value_or_default();
+        break;
+
+    case NVSDK_NGX_PerfQuality_Value_DLAA:
+        ratio = config->QualityRatio_DLAA.value_or_default();
+        break;
+
+    default:
+        return std::nullopt;
+    }
+
+    if (ratio >= sliderLimit)
+        return ratio;
+
+    return std::nullopt;
+}
+
+OptimalSettingsEntry ReferenceRenderSize(NVSDK_NGX_PerfQuality_Value quality, unsigned int width, unsigned int height)
+{
+    OptimalSettingsEntry entry;
+
+    if (auto ratio = ReferenceOverrideRatio(quality); ratio.has_value())
+    {
+        entry.renderHeight = (unsigned int) ((float) height / ratio.value());
+        entry.renderWidth = (unsigned int) ((float) width / ratio.value());
+        entry.scale = 1.0f / ratio.value();
+        return entry;
+    }
+
+    switch (quality)
+    {
+    case NVSDK_NGX_PerfQuality_Value_UltraPerformance:
+        entry.renderHeight = (unsigned int) ((float) height / 3.0);
+        entry.renderWidth = (unsigned int) ((float) width / 3.0);
+        entry.scale = 0.33333333f;
+        break;
+
+    case NVSDK_NGX_PerfQuality_Value_MaxPerf:
+        entry.renderHeight = (unsigned int) ((float) height / 2.0);
+        entry.renderWidth = (unsigned int) ((float) width / 2.0);
+        entry.scale = 0.5f;
+        break;
+
+    case NVSDK_NGX_PerfQuality_Value_MaxQuality:
+        entry.renderHeight = (unsigned int) ((float) height / 1.5);
+        entry.renderWidth = (unsigned int) ((float) width / 1.5);
+        entry.scale = 1.0f / 1.5f;
+        break;
+
+    case NVSDK_NGX_PerfQuality_Value_UltraQuality:
+        entry.renderHeight = (unsigned int) ((float) height / 1.3);
+        entry.renderWidth = (unsigned int) ((float) width / 1.3);
+        entry.scale = 1.0f / 1.3f;
+        break;
+
+    case NVSDK_NGX_PerfQuality_Value_DLAA:
+        entry.renderHeight = height;
+        entry.renderWidth = width;
+        entry.scale = 1.0f;
+        break;
+
+    default: // Balanced and unknown values
+        entry.renderHeight = (unsigned int) ((float) height / 1.7);
+        entry.renderWidth = (unsigned int) ((float) width / 1.7);
+        entry.scale = 1.0f / 1.7f;
+        break;
+    }
+
+    return entry;
+}
+
+OptimalSettingsEntry ReferenceDlss(NVSDK_NGX_PerfQuality_Value quality, unsigned int width, unsigned int height)
+{
+    auto config = Config::Instance();
+    auto entry = ReferenceRenderSize(quality, width, height);
+
+    if (config->RoundInternalResolution.has_value())
+    {
+        entry.renderHeight -= entry.renderHeight % config->RoundInternalResolution.value();
+        entry.renderWidth -= entry.renderWidth % config->RoundInternalResolution.value();
+        entry.scale = (float) entry.renderWidth / (float) width;
+    }
+
+    auto aboveDisplay = config->ExtendedLimits.value_or_default() && entry.renderWidth > width;
+
+    if (config->DrsMinOverrideEnabled.value_or_default() || quality == NVSDK_NGX_PerfQuality_Value_DLAA ||
+        aboveDisplay)
+    {
+        entry.minWidth = entry.renderWidth;
+        entry.minHeight = entry.renderHeight;
+    }
+    else
+    {
+        entry.minWidth = (unsigned int) ((float) width * 0.5f);
+        entry.minHeight = (unsigned int) ((float) height * 0.5f);
+
+        if (entry.renderWidth < entry.minWidth || entry.renderHeight < entry.minHeight)
+        {
+            entry.minWidth = entry.renderWidth;
+            entry.minHeight = entry.renderHeight;
+        }
+    }
+
+    if (config->DrsMaxOverrideEnabled.value_or_default() || aboveDisplay)
+    {
+        entry.maxWidth = entry.renderWidth;
+        entry.maxHeight = entry.renderHeight;
+    }
+    else
+    {
+        entry.maxWidth = width;
+        entry.maxHeight = height;
+    }
+
+    return entry;
+}
+
+OptimalSettingsEntry ReferenceDlssd(NVSDK_NGX_PerfQuality_Value quality, unsigned int width, unsigned int height)
+{
+    auto config = Config::Instance();
+    auto entry = ReferenceRenderSize(quality, width, height);
+
+    if (config->RoundInternalResolution.has_value())
+    {
+        entry.renderHeight -= entry.renderHeight % config->RoundInternalResolution.value();
+        entry.renderWidth -= entry.renderWidth % config->RoundInternalResolution.value();
+    }
+
+    if (config->DrsMinOverrideEnabled.value_or_default())
+    {
+        entry.minWidth = entry.renderWidth;
+        entry.minHeight = entry.renderHeight;
+    }
+    else if (quality == NVSDK_NGX_PerfQuality_Value_DLAA)
+    {
+        entry.minWidth = width;
+        entry.minHeight = height;
+    }
+    else
+    {
+        entry.minWidth = (unsigned int) ((float) width * 0.5f);
+        entry.minHeight = (unsigned int) ((float) height * 0.5f);
+
+        if (entry.renderWidth < entry.minWidth || entry.renderHeight < entry.minHeight)
+        {
+            entry.minWidth = entry.renderWidth;
+            entry.minHeight = entry.renderHeight;
+        }
+    }
+
+    if (config->DrsMaxOverrideEnabled.value_or_default())
+    {
+        entry.maxWidth = entry.renderWidth;
+        entry.maxHeight = entry.renderHeight;
+    }
+    else
+    {
+        entry.maxWidth = width;
+        entry.maxHeight = height;
+    }
+
+    return entry;
+}
+
+class OptimalSettingsTest : public testing::Test
+{
+  protected:
+    void TearDown() override
+    {
+        auto config = Config::Instance();
+        config->ExtendedLimits.reset();
+        config->UpscaleRatioOverrideEnabled.reset();
+        config->UpscaleRatioOverrideValue.reset();
+        config->QualityRatioOverrideEnabled.reset();
+        config->QualityRatio_DLAA.reset();
+        config->QualityRatio_UltraQuality.reset();
+        config->QualityRatio_Quality.reset();
+        config->QualityRatio_Balanced.reset();
+        config->QualityRatio_Performance.reset();
+        config->QualityRatio_UltraPerformance.reset();
+        config->RoundInternalResolution.reset();
+        config->DrsMinOverrideEnabled.reset();
+        config->DrsMaxOverrideEnabled.reset();
+        OptimalSettings::ConfigChanged();
+    }
+
+    // Compares every quality (and an unknown one) of both features, returns number of mismatches
+    static int CompareAll(unsigned int width, unsigned int height)
+    {
+        auto config = OptimalSettingsConfig::FromConfig();
+        auto mismatches = 0;
+
+        for (int q = 0; q <= (int) OptimalSettings::ModeCount + 1; q++)
+        {
+            auto quality = (NVSDK_NGX_PerfQuality_Value) q;
+
+            auto dlss = OptimalSettings::Compute(config, OptimalSettingsFeature::DLSS, quality, width, height);
+            auto dlssd = OptimalSettings::Compute(config, OptimalSettingsFeature::DLSSD, quality, width, height);
+
+            if (dlss != ReferenceDlss(quality, width, height))
+            {
+                ADD_FAILURE() << "DLSS " << width << "x" << height << " quality " << q;
+                mismatches++;
+            }
+
+            if (dlssd != ReferenceDlssd(quality, width, height))
+            {
+                ADD_FAILURE() << "DLSSD " << width << "x" << height << " quality " << q;
+                mismatches++;
+            }
+        }
+
+        return mismatches;
+    }
+};
+} // namespace
+
+TEST_F(OptimalSettingsTest, MatchesOldCallbacks)
+{
+    const float ratios[] = { 0.05f, 0.1f, 0.5f, 0.99f, 1.0f, 1.3f, 1.77f, 3.0f, 6.0f };
+    const std::optional<int> rounds[] = { std::nullopt, 1, 2, 8, 64 };
+    const unsigned int sizes[][2] = { { 1, 1 },       { 3, 7 },       { 1280, 720 },  { 1920, 1080 },
+                                      { 2560, 1440 }, { 3440, 1440 }, { 3840, 2160 }, { 7680, 4320 } };
+
+    auto config = Config::Instance();
+
+    for (int bits = 0; bits < 32; bits++)
+    {
+        for (auto ratio : ratios)
+        {
+            for (auto& round : rounds)
+            {
+                config->ExtendedLimits = (bool) (bits & 1);
+                config->UpscaleRatioOverrideEnabled = (bool) (bits & 2);
+                config->QualityRatioOverrideEnabled = (bool) (bits & 4);
+                config->DrsMinOverrideEnabled = (bool) (bits & 8);
+                config->DrsMaxOverrideEnabled = (bool) (bits & 16);
+                config->UpscaleRatioOverrideValue = ratio;
+
+                // Mix of ratios above and below slider limits
+                config->QualityRatio_DLAA = ratio;
+                config->QualityRatio_UltraQuality = ratio * 0.5f;
+                config->QualityRatio_Quality = 1.5f;
+                config->QualityRatio_Balanced = ratio + 0.2f;
+                config->QualityRatio_Performance = 0.3f;
+                config->QualityRatio_UltraPerformance = ratio * 2.0f;
+
+                config->RoundInternalResolution.reset();
+                if (round.has_value())
+                    config->RoundInternalResolution = round.value();
+
+                for (auto& size : sizes)
+                    ASSERT_EQ(CompareAll(size[0], size[1]), 0);
+            }
+        }
+    }
+}
+
+TEST_F(OptimalSettingsTest, DlssdKeepsDisplayBoundsWithExtendedLimits)
+{
+    auto config = Config::Instance();
+    config->ExtendedLimits = true;
+    config->UpscaleRatioOverrideEnabled = true;
+    config->UpscaleRatioOverrideValue = 0.5f; // Render at 2x display
+
+    auto settings = OptimalSettingsConfig::FromConfig();
+    auto quality = NVSDK_NGX_PerfQuality_Value_MaxQuality;
+
+    auto dlss = OptimalSettings::Compute(settings, OptimalSettingsFeature::DLSS, quality, 1920, 1080);
+    EXPECT_EQ(dlss.renderWidth, 3840u);
+    EXPECT_EQ(dlss.minWidth, 3840u);
+    EXPECT_EQ(dlss.maxWidth, 3840u);
+    EXPECT_EQ(dlss, ReferenceDlss(quality, 1920, 1080));
+
+    auto dlssd = OptimalSettings::Compute(settings, OptimalSettingsFeature::DLSSD, quality, 1920, 1080);
+    EXPECT_EQ(dlssd.renderWidth, 3840u);
+    EXPECT_EQ(dlssd.minWidth, 960u);
+    EXPECT_EQ(dlssd.maxWidth, 1920u);
+    EXPECT_EQ(dlssd, ReferenceDlssd(quality, 1920, 1080));
+}
+
+TEST_F(OptimalSettingsTest, RoundingKeepsDlssdScale)
+{
+    Config::Instance()->RoundInternalResolution = 64;
+
+    auto settings = OptimalSettingsConfig::FromConfig();
+    auto quality = NVSDK_NGX_PerfQuality_Value_MaxQuality;
+
+    auto dlss = OptimalSettings::Compute(settings, OptimalSettingsFeature::DLSS, quality, 1920, 1080);
+    auto dlssd = OptimalSettings::Compute(settings, OptimalSettingsFeature::DLSSD, quality, 1920, 1080);
+
+    EXPECT_EQ(dlss.renderWidth, 1280u);
+    EXPECT_EQ(dlss.renderHeight, 704u);
+    EXPECT_EQ(dlssd.renderHeight, 704u);
+    EXPECT_EQ(dlss.scale, 1280.0f / 1920.0f);
+    EXPECT_EQ(dlssd.scale, 1.0f / 1.5f);
+}
+
+TEST_F(OptimalSettingsTest, CachedUntilConfigChanged)
+{
+    auto quality = NVSDK_NGX_PerfQuality_Value_MaxPerf;
+    EXPECT_EQ(OptimalSettings::Get(OptimalSettingsFeature::DLSS, quality, 1920, 1080).renderWidth, 960u);
+
+    // Not announced, tables stay as they are
+    auto config = Config::Instance();
+    config->UpscaleRatioOverrideEnabled = true;
+    config->UpscaleRatioOverrideValue = 1.5f;
+    EXPECT_EQ(OptimalSettings::Get(OptimalSettingsFeature::DLSS, quality, 1920, 1080).renderWidth, 960u);
+
+    auto generation = OptimalSettings::Generation();
+    OptimalSettings::ConfigChanged();
+    EXPECT_EQ(OptimalSettings::Generation(), generation + 1);
+
+    EXPECT_EQ(OptimalSettings::Get(OptimalSettingsFeature::DLSS, quality, 1920, 1080).renderWidth, 1280u);
+    EXPECT_EQ(OptimalSettings::Modes(OptimalSettingsFeature::DLSSD, 3840, 2160)[quality].renderWidth, 2560u);
+}
+
+TEST_F(OptimalSettingsTest, CacheKeysOnFeatureAndOutputSize)
+{
+    auto quality = NVSDK_NGX_PerfQuality_Value_DLAA;
+
+    // More sizes than cache slots, evicted ones are rebuilt
+    for (unsigned int i = 1; i <= OptimalSettings::CacheSize * 2; i++)
+    {
+        auto width = 640 * i;
+        ASSERT_EQ(OptimalSettings::Get(OptimalSettingsFeature::DLSS, quality, width, 360 * i).minWidth, width);
+        ASSERT_EQ(OptimalSettings::Get(OptimalSettingsFeature::DLSSD, quality, width, 360 * i).minWidth, width);
+    }
+
+    Config::Instance()->DrsMinOverrideEnabled = true;
+    OptimalSettings::ConfigChanged();
+
+    quality = NVSDK_NGX_PerfQuality_Value_MaxQuality;
+    EXPECT_EQ(OptimalSettings::Get(OptimalSettingsFeature::DLSSD, quality, 1920, 1080).minWidth, 1280u);
+}
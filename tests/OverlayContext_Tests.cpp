@@ -0,0 +1,80 @@
+#include <menu/menu_overlay_context.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+// Present arguments, only compared by address
+int swapChainA;
+int swapChainB;
+int device;
+int otherDevice;
+int window;
+int otherWindow;
+
+class OverlayContextTest : public testing::Test
+{
+  protected:
+    OverlayContextCache cache;
+
+    void Resolve(const void* swapChain, const void* presentDevice, const void* hWnd)
+    {
+        auto generation = cache.Generation();
+        cache.Resolved(swapChain, presentDevice, hWnd, generation);
+    }
+};
+} // namespace
+
+TEST_F(OverlayContextTest, FirstPresentResolves)
+{
+    EXPECT_TRUE(cache.NeedsResolve(&swapChainA, &device, &window));
+
+    // Null arguments match the empty cache but nothing was resolved yet
+    EXPECT_TRUE(cache.NeedsResolve(nullptr, nullptr, nullptr));
+}
+
+TEST_F(OverlayContextTest, SamePresentTargetIsReused)
+{
+    Resolve(&swapChainA, &device, &window);
+
+    for (int i = 0; i < 3; i++)
+        EXPECT_FALSE(cache.NeedsResolve(&swapChainA, &device, &window));
+}
+
+TEST_F(OverlayContextTest, ChangedTargetResolves)
+{
+    Resolve(&swapChainA, &device, &window);
+
+    EXPECT_TRUE(cache.NeedsResolve(&swapChainB, &device, &window));
+    EXPECT_TRUE(cache.NeedsResolve(&swapChainA, &otherDevice, &window));
+    EXPECT_TRUE(cache.NeedsResolve(&swapChainA, &device, &otherWindow));
+
+    // Game presents two swapchains, each switch resolves
+    Resolve(&swapChainB, &device, &window);
+    EXPECT_FALSE(cache.NeedsResolve(&swapChainB, &device, &window));
+    EXPECT_TRUE(cache.NeedsResolve(&swapChainA, &device, &window));
+}
+
+TEST_F(OverlayContextTest, InvalidateResolvesOnNextPresent)
+{
+    Resolve(&swapChainA, &device, &window);
+
+    // ResizeBuffers or device removed
+    cache.Invalidate();
+    EXPECT_TRUE(cache.NeedsResolve(&swapChainA, &device, &window));
+
+    Resolve(&swapChainA, &device, &window);
+    EXPECT_FALSE(cache.NeedsResolve(&swapChainA, &device, &window));
+}
+
+TEST_F(OverlayContextTest, InvalidateWhileResolvingIsKept)
+{
+    ASSERT_TRUE(cache.NeedsResolve(&swapChainA, &device, &window));
+    auto generation = cache.Generation();
+
+    // Resize on another thread after objects were queried
+    cache.Invalidate();
+
+    cache.Resolved(&swapChainA, &device, &window, generation);
+    EXPECT_TRUE(cache.NeedsResolve(&swapChainA, &device, &window));
+}
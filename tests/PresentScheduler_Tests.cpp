@@ -0,0 +1,140 @@
+#include <Config.h>
+#include <misc/PresentScheduler.h>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+namespace
+{
+std::atomic<uint64_t> jobRuns { 0 };
+std::atomic<uint64_t> jobSum { 0 };
+
+void CountJob(uintptr_t arg)
+{
+    jobSum.fetch_add(arg, std::memory_order_relaxed);
+    jobRuns.fetch_add(1, std::memory_order_release);
+}
+
+bool WaitForRuns(uint64_t expected)
+{
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+
+    while (jobRuns.load(std::memory_order_acquire) < expected)
+    {
+        if (std::chrono::steady_clock::now() > deadline)
+            return false;
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    return true;
+}
+
+std::thread::id RunThreadOf(PresentStep step)
+{
+    static std::thread::id runThread;
+
+    PresentScheduler::Defer(step, [](uintptr_t) { runThread = std::this_thread::get_id(); });
+    return runThread;
+}
+
+// Worker must be joined before statics go away, like DLL_PROCESS_DETACH does
+class SchedulerEnvironment : public testing::Environment
+{
+  public:
+    void TearDown() override { PresentScheduler::Shutdown(); }
+};
+
+const auto* environment = testing::AddGlobalTestEnvironment(new SchedulerEnvironment());
+} // namespace
+
+TEST(PresentScheduler, EveryJobRunsOnceWithManyProducers)
+{
+    constexpr uint64_t producers = 3;
+    constexpr uint64_t jobs = 20000; // Enough to overflow the queue, overflow runs inline
+
+    auto runsBefore = jobRuns.load();
+    auto sumBefore = jobSum.load();
+
+    std::vector<std::thread> threads;
+    for (uint64_t t = 0; t < producers; t++)
+    {
+        threads.emplace_back(
+            []
+            {
+                for (uint64_t i = 1; i <= jobs; i++)
+                    PresentScheduler::Defer(PresentStep::LatencyReport, CountJob, (uintptr_t) i);
+            });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    ASSERT_TRUE(WaitForRuns(runsBefore + producers * jobs));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(jobRuns.load(), runsBefore + producers * jobs);
+    EXPECT_EQ(jobSum.load(), sumBefore + producers * jobs * (jobs + 1) / 2);
+}
+
+TEST(PresentScheduler, PresentThreadStepsRunInline)
+{
+    EXPECT_EQ(RunThreadOf(PresentStep::UpscalerTime), std::this_thread::get_id());
+    EXPECT_EQ(RunThreadOf(PresentStep::Menu), std::this_thread::get_id());
+}
+
+TEST(PresentScheduler, DisabledDeferringRunsInline)
+{
+    Config::Instance()->PresentDeferBookkeeping = false;
+
+    EXPECT_FALSE(PresentScheduler::IsDeferring());
+    EXPECT_EQ(RunThreadOf(PresentStep::LatencyReport), std::this_thread::get_id());
+
+    Config::Instance()->PresentDeferBookkeeping.reset();
+}
+
+TEST(PresentScheduler, NestedPresentsCountedOnce)
+{
+    for (int i = 0; i < 240; i++)
+    {
+        PresentScheduler::BeginPresent();
+        PresentScheduler::BeginPresent();
+        PresentScheduler::EndPresent();
+        PresentScheduler::EndPresent();
+    }
+
+    // Unbalanced end is ignored
+    PresentScheduler::EndPresent();
+
+    auto report = PresentScheduler::Report();
+    EXPECT_EQ(report.presents, 240u);
+    EXPECT_EQ(report.steps[static_cast<size_t>(PresentStep::Critical)].count, 240u);
+}
+
+// Last, scheduler stays stopped for the rest of the process
+TEST(PresentScheduler, ShutdownJoinsRunningJob)
+{
+    static std::atomic<bool> started { false };
+    static std::atomic<bool> finished { false };
+
+    PresentScheduler::Defer(PresentStep::Benchmark,
+                            [](uintptr_t)
+                            {
+                                started.store(true);
+                                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                                finished.store(true);
+                            });
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!started.load() && std::chrono::steady_clock::now() < deadline)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    ASSERT_TRUE(started.load());
+
+    PresentScheduler::Shutdown();
+    EXPECT_TRUE(finished.load());
+
+    EXPECT_FALSE(PresentScheduler::IsDeferring());
+    EXPECT_EQ(RunThreadOf(PresentStep::LatencyReport), std::this_thread::get_id());
+}
@@ -0,0 +1,75 @@
+#include <hooks/ProcTable.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace
+{
+using Resolve = int (*)();
+
+int Submit() { return 1; }
+int Submit2() { return 2; }
+int Submit2KHR() { return 3; }
+int BeginCommandBuffer() { return 4; }
+int DrawMeshTasks() { return 5; }
+
+// Same shape as the Vulkan hook table, names sharing prefixes and unsorted on purpose
+constexpr auto table = SortProcTable(std::array {
+    ProcTableEntry<Resolve> { "vkQueueSubmit", Submit },
+    ProcTableEntry<Resolve> { "vkQueueSubmit2KHR", Submit2KHR },
+    ProcTableEntry<Resolve> { "vkQueueSubmit2", Submit2 },
+    ProcTableEntry<Resolve> { "vkCmdDrawMeshTasksEXT", DrawMeshTasks },
+    ProcTableEntry<Resolve> { "vkBeginCommandBuffer", BeginCommandBuffer },
+});
+
+static_assert(ProcTableIsUnique(table));
+static_assert(FindProc(table, "vkQueueSubmit2") != nullptr);
+static_assert(FindProc(table, "vkQueueSubmit3") == nullptr);
+
+constexpr auto duplicates = SortProcTable(std::array {
+    ProcTableEntry<Resolve> { "vkQueueSubmit", Submit },
+    ProcTableEntry<Resolve> { "vkBeginCommandBuffer", BeginCommandBuffer },
+    ProcTableEntry<Resolve> { "vkQueueSubmit", Submit2 },
+});
+
+static_assert(!ProcTableIsUnique(duplicates));
+} // namespace
+
+TEST(ProcTableTest, IsSorted)
+{
+    for (size_t i = 1; i < table.size(); i++)
+        EXPECT_LT(table[i - 1].name, table[i].name);
+}
+
+TEST(ProcTableTest, FindsEveryEntry)
+{
+    EXPECT_EQ(FindProc(table, "vkQueueSubmit")->resolve(), 1);
+    EXPECT_EQ(FindProc(table, "vkQueueSubmit2")->resolve(), 2);
+    EXPECT_EQ(FindProc(table, "vkQueueSubmit2KHR")->resolve(), 3);
+    EXPECT_EQ(FindProc(table, "vkBeginCommandBuffer")->resolve(), 4);
+    EXPECT_EQ(FindProc(table, "vkCmdDrawMeshTasksEXT")->resolve(), 5);
+}
+
+TEST(ProcTableTest, RejectsNearMisses)
+{
+    // Prefixes, extensions and names sorting between or around entries
+    EXPECT_EQ(FindProc(table, ""), nullptr);
+    EXPECT_EQ(FindProc(table, "vkQueue"), nullptr);
+    EXPECT_EQ(FindProc(table, "vkQueueSubmit2KH"), nullptr);
+    EXPECT_EQ(FindProc(table, "vkQueueSubmit2KHRX"), nullptr);
+    EXPECT_EQ(FindProc(table, "vkqueuesubmit"), nullptr);
+    EXPECT_EQ(FindProc(table, "vkAcquireNextImageKHR"), nullptr);
+    EXPECT_EQ(FindProc(table, "vkWaitForFences"), nullptr);
+}
+
+TEST(ProcTableTest, FindsRuntimeNames)
+{
+    // Loader passes names from its own buffers, not the table's literals
+    std::string name = "vkQueueSubmit2";
+    auto entry = FindProc(table, name.c_str());
+
+    ASSERT_NE(entry, nullptr);
+    EXPECT_NE(entry->name.data(), name.c_str());
+    EXPECT_EQ(entry->resolve(), 2);
+}
@@ -0,0 +1,195 @@
+#include <hooks/Reflex_Analytics.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace
+{
+// NV_LATENCY_MARKER_TYPE values
+constexpr uint32_t SimulationStart = 0;
+constexpr uint32_t PresentStart = 4;
+constexpr uint32_t PresentEnd = 5;
+constexpr uint32_t OutOfBandPresentStart = 11;
+
+// Frame with fixed stage durations in microseconds, stages back to back starting at frameId * 100000
+LatencyFrameReport MakeReport(uint64_t frameId, uint64_t stageUs = 1000)
+{
+    LatencyFrameReport report {};
+    report.frameId = frameId;
+
+    auto time = frameId * 100000;
+
+    for (auto& stage : report.stages)
+    {
+        stage.start = time;
+        stage.end = time + stageUs;
+        time = stage.end;
+    }
+
+    return report;
+}
+
+// Last 64 frames ending at newestId, like NvAPI_D3D_GetLatency
+std::vector<LatencyFrameReport> ReportWindow(uint64_t newestId, uint64_t stageUs = 1000)
+{
+    std::vector<LatencyFrameReport> reports;
+
+    for (uint64_t id = newestId - 63; id <= newestId; id++)
+        reports.push_back(MakeReport(id, stageUs));
+
+    return reports;
+}
+
+class ReflexAnalyticsTest : public testing::Test
+{
+  protected:
+    void SetUp() override { ReflexAnalytics::Reset(); }
+    void TearDown() override { ReflexAnalytics::Reset(); }
+};
+} // namespace
+
+TEST_F(ReflexAnalyticsTest, NoMeanBeforeEnoughSamples)
+{
+    EXPECT_FALSE(ReflexAnalytics::StageMeanUs(LatencyStage::GpuRender).has_value());
+    EXPECT_FALSE(ReflexAnalytics::PresentIntervalMs().has_value());
+    EXPECT_FALSE(ReflexAnalytics::MarkerLatencyMs().has_value());
+
+    std::vector<LatencyFrameReport> reports;
+
+    for (uint64_t id = 1; id <= 7; id++)
+        reports.push_back(MakeReport(id));
+
+    EXPECT_EQ(ReflexAnalytics::IngestReports(reports.data(), reports.size()), 7u);
+    EXPECT_FALSE(ReflexAnalytics::StageMeanUs(LatencyStage::GpuRender).has_value());
+
+    auto eighth = MakeReport(8);
+    EXPECT_EQ(ReflexAnalytics::IngestReports(&eighth, 1), 1u);
+    EXPECT_DOUBLE_EQ(ReflexAnalytics::StageMeanUs(LatencyStage::GpuRender).value(), 1000.0);
+}
+
+TEST_F(ReflexAnalyticsTest, OverlappingPollsDontDoubleCount)
+{
+    auto first = ReportWindow(100, 1000);
+    EXPECT_EQ(ReflexAnalytics::IngestReports(first.data(), first.size()), 64u);
+
+    // Polled again 10 frames later, 54 frames are already known
+    auto second = ReportWindow(110, 3000);
+    EXPECT_EQ(ReflexAnalytics::IngestReports(second.data(), second.size()), 10u);
+
+    // Rolling window of 64: 54 frames of 1000us and 10 of 3000us
+    auto expected = (54.0 * 1000.0 + 10.0 * 3000.0) / 64.0;
+    EXPECT_DOUBLE_EQ(ReflexAnalytics::StageMeanUs(LatencyStage::Simulation).value(), expected);
+
+    // Same window again adds nothing
+    EXPECT_EQ(ReflexAnalytics::IngestReports(second.data(), second.size()), 0u);
+}
+
+TEST_F(ReflexAnalyticsTest, TotalSpansSimulationToGpuEnd)
+{
+    auto reports = ReportWindow(64, 500);
+    ReflexAnalytics::IngestReports(reports.data(), reports.size());
+
+    EXPECT_DOUBLE_EQ(ReflexAnalytics::StageMeanUs(LatencyStage::Total).value(),
+                     500.0 * static_cast<double>(REFLEX_REPORT_STAGE_COUNT));
+    EXPECT_FALSE(ReflexAnalytics::StageMeanUs(LatencyStage::Count).has_value());
+}
+
+TEST_F(ReflexAnalyticsTest, MissingStagesAndEmptyFramesAreSkipped)
+{
+    std::vector<LatencyFrameReport> reports;
+
+    for (uint64_t id = 1; id <= 10; id++)
+    {
+        auto report = MakeReport(id);
+        report.stages[static_cast<size_t>(LatencyStage::OsRenderQueue)] = {};
+        reports.push_back(report);
+    }
+
+    // Unused report slots have frame id 0
+    reports.insert(reports.begin(), LatencyFrameReport {});
+
+    EXPECT_EQ(ReflexAnalytics::IngestReports(reports.data(), reports.size()), 10u);
+    EXPECT_FALSE(ReflexAnalytics::StageMeanUs(LatencyStage::OsRenderQueue).has_value());
+    EXPECT_TRUE(ReflexAnalytics::StageMeanUs(LatencyStage::Driver).has_value());
+    EXPECT_EQ(ReflexAnalytics::IngestReports(nullptr, 4), 0u);
+}
+
+TEST_F(ReflexAnalyticsTest, RestartedReportIdsAreAccepted)
+{
+    auto before = ReportWindow(1000);
+    ReflexAnalytics::IngestReports(before.data(), before.size());
+
+    // Game restarted its frame counter
+    auto after = ReportWindow(70);
+    EXPECT_EQ(ReflexAnalytics::IngestReports(after.data(), after.size()), 64u);
+}
+
+TEST_F(ReflexAnalyticsTest, PresentIntervalFromMarkers)
+{
+    for (uint64_t id = 1; id <= 10; id++)
+        ReflexAnalytics::RecordMarker(id, PresentStart, 100.0 + static_cast<double>(id) * 16.0);
+
+    EXPECT_DOUBLE_EQ(ReflexAnalytics::PresentIntervalMs().value(), 16.0);
+
+    // Duplicate marker is ignored, skipped frame ids are spread over the gap
+    ReflexAnalytics::RecordMarker(10, PresentStart, 300.0);
+    ReflexAnalytics::RecordMarker(12, PresentStart, 100.0 + 12.0 * 16.0);
+    EXPECT_DOUBLE_EQ(ReflexAnalytics::PresentIntervalMs().value(), 16.0);
+}
+
+TEST_F(ReflexAnalyticsTest, PausesAndRestartsDontSkewInterval)
+{
+    for (uint64_t id = 1; id <= 10; id++)
+        ReflexAnalytics::RecordMarker(id, PresentStart, static_cast<double>(id) * 10.0);
+
+    // Loading screen
+    ReflexAnalytics::RecordMarker(11, PresentStart, 5000.0);
+    EXPECT_DOUBLE_EQ(ReflexAnalytics::PresentIntervalMs().value(), 10.0);
+
+    // Frame id restart drops the old samples
+    ReflexAnalytics::RecordMarker(1, PresentStart, 6000.0);
+    EXPECT_FALSE(ReflexAnalytics::PresentIntervalMs().has_value());
+}
+
+TEST_F(ReflexAnalyticsTest, MarkerLatencyFromSimulationToPresentEnd)
+{
+    for (uint64_t id = 1; id <= 8; id++)
+    {
+        auto start = static_cast<double>(id) * 20.0;
+        ReflexAnalytics::RecordMarker(id, SimulationStart, start);
+        ReflexAnalytics::RecordMarker(id, PresentEnd, start + 30.0);
+
+        // Second present end of the same frame isn't counted
+        ReflexAnalytics::RecordMarker(id, PresentEnd, start + 90.0);
+    }
+
+    EXPECT_DOUBLE_EQ(ReflexAnalytics::MarkerLatencyMs().value(), 30.0);
+
+    // Present end without its simulation start, evicted from history
+    ReflexAnalytics::RecordMarker(100, SimulationStart, 2000.0);
+    ReflexAnalytics::RecordMarker(92, PresentEnd, 2010.0);
+    EXPECT_DOUBLE_EQ(ReflexAnalytics::MarkerLatencyMs().value(), 30.0);
+}
+
+TEST_F(ReflexAnalyticsTest, AsyncMarkersCountRepeatedIds)
+{
+    // Real frames only
+    for (uint64_t id = 1; id <= 6; id++)
+        EXPECT_EQ(ReflexAnalytics::RecordAsyncMarker(id, OutOfBandPresentStart), 0u);
+
+    // Other marker types are ignored
+    EXPECT_EQ(ReflexAnalytics::RecordAsyncMarker(6, PresentStart), 0u);
+
+    // Generated + real frame with the same id
+    size_t repeats = 0;
+
+    for (uint64_t id = 7; id <= 12; id++)
+    {
+        ReflexAnalytics::RecordAsyncMarker(id, OutOfBandPresentStart);
+        repeats = ReflexAnalytics::RecordAsyncMarker(id, OutOfBandPresentStart);
+    }
+
+    // History holds the last 12 presents, ids 7..12 twice each
+    EXPECT_EQ(repeats, 6u);
+}
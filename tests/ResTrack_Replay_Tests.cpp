@@ -0,0 +1,166 @@
+#include "pch.h"
+#include "ResTrack_Replay.h"
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+// Synthetic trace in the layout written by ResTrack_Trace
+class TraceFile
+{
+  private:
+    std::vector<uint8_t> _data;
+
+    void Append(const void* data, size_t size)
+    {
+        auto bytes = static_cast<const uint8_t*>(data);
+        _data.reserve(_data.size() + size);
+        _data.insert(_data.end(), bytes, bytes + size);
+    }
+
+  public:
+    TraceFile(uint32_t width, uint32_t height, DXGI_FORMAT format)
+    {
+        TraceFileHeader header {};
+        header.magic = TRACE_MAGIC;
+        header.version = TRACE_VERSION;
+        header.swapchainWidth = width;
+        header.swapchainHeight = height;
+        header.swapchainFormat = format;
+        Append(&header, sizeof(header));
+    }
+
+    void Record(TraceOp op, std::initializer_list<uint64_t> args)
+    {
+        TraceRecordHeader header {};
+        header.op = op;
+        header.argCount = (uint16_t) args.size();
+        Append(&header, sizeof(header));
+        Append(args.begin(), args.size() * sizeof(uint64_t));
+    }
+
+    std::filesystem::path Write(const char* name)
+    {
+        auto path = std::filesystem::temp_directory_path() / name;
+        std::ofstream file(path, std::ios::binary);
+        file.write((const char*) _data.data(), _data.size());
+        return path;
+    }
+};
+
+constexpr uint64_t Heap = 0x1000;
+constexpr uint64_t CpuStart = 0x10000;
+constexpr uint64_t GpuStart = 0x20000;
+constexpr uint64_t Increment = 32;
+constexpr uint64_t Scene = 0xA000;
+constexpr uint64_t Small = 0xB000;
+constexpr uint64_t CmdList = 0xC000;
+
+static std::filesystem::path WriteFrameTrace()
+{
+    TraceFile trace(1920, 1080, DXGI_FORMAT_R16G16B16A16_FLOAT);
+
+    trace.Record(TraceOp::CreateHeap, { Heap, CpuStart, GpuStart, 16, Increment });
+    trace.Record(TraceOp::ResourceDesc, { Scene, 1920, 1080,
+                                          DXGI_FORMAT_R16G16B16A16_FLOAT |
+                                              ((uint64_t) D3D12_RESOURCE_DIMENSION_TEXTURE2D << 32),
+                                          D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET });
+    trace.Record(TraceOp::ResourceDesc,
+                 { Small, 640, 360, DXGI_FORMAT_R8G8B8A8_UNORM | ((uint64_t) D3D12_RESOURCE_DIMENSION_TEXTURE2D << 32),
+                   0 });
+
+    // Scene color is a candidate, small target and buffer view are not
+    trace.Record(TraceOp::CreateSRV, { Scene, CpuStart, D3D12_SRV_DIMENSION_TEXTURE2D });
+    trace.Record(TraceOp::CreateSRV, { Small, CpuStart + Increment, D3D12_SRV_DIMENSION_TEXTURE2D });
+    trace.Record(TraceOp::CreateUAV, { Scene, CpuStart + 2 * Increment, D3D12_UAV_DIMENSION_BUFFER });
+    trace.Record(TraceOp::CopyDescriptorsSimple, { Increment << 32, 1, CpuStart + 3 * Increment, CpuStart });
+
+    // Frame 1, copied descriptor is bound and drawn
+    trace.Record(TraceOp::SetGraphicsRootTable, { CmdList, 0, GpuStart + 3 * Increment });
+    trace.Record(TraceOp::DrawInstanced, { CmdList });
+    trace.Record(TraceOp::Present, { 1 });
+
+    // Frame 2, released resource must not come back from a stale slot
+    trace.Record(TraceOp::ReleaseResource, { Scene });
+    trace.Record(TraceOp::SetGraphicsRootTable, { CmdList, 0, GpuStart + 3 * Increment });
+    trace.Record(TraceOp::DrawInstanced, { CmdList });
+    trace.Record(TraceOp::Present, { 2 });
+
+    trace.Record(TraceOp::ReleaseHeap, { Heap });
+
+    // Too few arguments
+    trace.Record(TraceOp::CreateRTV, { Scene });
+
+    return trace.Write("ResTrack_Replay_Tests.rttrace");
+}
+
+class ResTrackReplay : public testing::TestWithParam<bool>
+{
+};
+
+TEST_P(ResTrackReplay, CountsTrackedViewsAndCandidates)
+{
+    ResTrack_TraceReader reader;
+    ASSERT_TRUE(reader.Open(WriteFrameTrace()));
+    EXPECT_EQ(reader.Header().swapchainWidth, 1920u);
+
+    ResTrack_ReplayOptions options {};
+    options.useShards = GetParam();
+
+    ResTrack_ReplayResult result {};
+    ASSERT_TRUE(ResTrack_Replay::Run(reader, options, result));
+
+    EXPECT_EQ(result.frames, 2u);
+    EXPECT_EQ(result.trackedViews, 1u);
+    EXPECT_EQ(result.hudlessCandidates, 1u);
+    EXPECT_EQ(result.skippedRecords, 1u);
+    EXPECT_EQ(result.calls[(size_t) TraceOp::CreateSRV], 2u);
+    EXPECT_EQ(result.calls[(size_t) TraceOp::DrawInstanced], 2u);
+    EXPECT_EQ(result.calls[(size_t) TraceOp::CreateRTV], 0u);
+
+    // Tables are left empty, second run gives the same result
+    ResTrack_ReplayResult again {};
+    ASSERT_TRUE(ResTrack_Replay::Run(reader, options, again));
+    EXPECT_EQ(again.trackedViews, result.trackedViews);
+    EXPECT_EQ(again.hudlessCandidates, result.hudlessCandidates);
+}
+
+INSTANTIATE_TEST_SUITE_P(Shards, ResTrackReplay, testing::Bool());
+
+TEST(ResTrackReplay, RelaxedCheckAcceptsNearSize)
+{
+    TraceFile trace(1920, 1080, DXGI_FORMAT_R16G16B16A16_FLOAT);
+    trace.Record(TraceOp::CreateHeap, { Heap, CpuStart, GpuStart, 4, Increment });
+    trace.Record(TraceOp::ResourceDesc, { Scene, 1920, 1088,
+                                          DXGI_FORMAT_R16G16B16A16_FLOAT |
+                                              ((uint64_t) D3D12_RESOURCE_DIMENSION_TEXTURE2D << 32),
+                                          0 });
+    trace.Record(TraceOp::CreateSRV, { Scene, CpuStart, D3D12_SRV_DIMENSION_TEXTURE2D });
+
+    ResTrack_TraceReader reader;
+    ASSERT_TRUE(reader.Open(trace.Write("ResTrack_Replay_Relaxed.rttrace")));
+
+    ResTrack_ReplayOptions options {};
+    ResTrack_ReplayResult result {};
+    ASSERT_TRUE(ResTrack_Replay::Run(reader, options, result));
+    EXPECT_EQ(result.trackedViews, 0u);
+
+    options.relaxedResolutionCheck = true;
+    ASSERT_TRUE(ResTrack_Replay::Run(reader, options, result));
+    EXPECT_EQ(result.trackedViews, 1u);
+}
+
+TEST(ResTrackReplay, RejectsInvalidFile)
+{
+    TraceFile trace(1920, 1080, DXGI_FORMAT_R16G16B16A16_FLOAT);
+    auto path = trace.Write("ResTrack_Replay_Invalid.rttrace");
+
+    // Corrupt magic
+    std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+    file.put('X');
+    file.close();
+
+    ResTrack_TraceReader reader;
+    EXPECT_FALSE(reader.Open(path));
+    EXPECT_FALSE(reader.Open(std::filesystem::temp_directory_path() / "ResTrack_Replay_Missing.rttrace"));
+}
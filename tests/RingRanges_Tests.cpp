@@ -0,0 +1,200 @@
+#include <shaders/RingRanges.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+// Fake queue fence, test moves the GPU forward
+struct FakeFence
+{
+    UINT64 completed = 0;
+};
+
+int waitCalls = 0;
+bool waitSucceeds = true;
+
+UINT64 FakeCompletedValue(void* fence) { return ((FakeFence*) fence)->completed; }
+
+bool FakeWait(void* fence, UINT64 value)
+{
+    waitCalls++;
+
+    if (!waitSucceeds)
+        return false;
+
+    ((FakeFence*) fence)->completed = value;
+    return true;
+}
+
+constexpr auto Descriptors = RingRanges::Descriptors;
+constexpr auto Constants = RingRanges::Constants;
+constexpr auto Invalid = RingRanges::InvalidOffset;
+
+// Owners stand for command lists
+int listA;
+int listB;
+int listC;
+
+class RingRangesTest : public testing::Test
+{
+  protected:
+    FakeFence fence;
+    RingRanges ring { 16, 1024, FakeCompletedValue, FakeWait };
+
+    void SetUp() override
+    {
+        waitCalls = 0;
+        waitSucceeds = true;
+    }
+};
+} // namespace
+
+TEST_F(RingRangesTest, WrapsAroundAfterRetire)
+{
+    EXPECT_EQ(ring.Allocate(Descriptors, 6, 1, &listA), 0u);
+    ring.Close(&listA, &fence, 1);
+    fence.completed = 1;
+
+    EXPECT_EQ(ring.Allocate(Descriptors, 6, 1, &listB), 6u);
+    EXPECT_EQ(ring.Allocate(Descriptors, 4, 1, &listB), 12u);
+
+    // Doesn't fit at the end, wraps to start after listA's range is retired
+    EXPECT_EQ(ring.Allocate(Descriptors, 6, 1, &listC), 0u);
+    EXPECT_EQ(waitCalls, 0);
+    EXPECT_EQ(ring.SegmentCount(), 2u);
+}
+
+TEST_F(RingRangesTest, RetiresInAllocationOrder)
+{
+    FakeFence slowFence;
+
+    EXPECT_EQ(ring.Allocate(Descriptors, 8, 1, &listA), 0u);
+    EXPECT_EQ(ring.Allocate(Descriptors, 8, 1, &listB), 8u);
+
+    // listB completed first on another queue, listA's range still blocks it
+    ring.Close(&listA, &slowFence, 1);
+    ring.Close(&listB, &fence, 1);
+    fence.completed = 1;
+
+    ring.Retire();
+    EXPECT_EQ(ring.SegmentCount(), 2u);
+
+    slowFence.completed = 1;
+    ring.Retire();
+    EXPECT_EQ(ring.SegmentCount(), 0u);
+}
+
+TEST_F(RingRangesTest, CloseOnlyClosesOwner)
+{
+    ring.Allocate(Descriptors, 2, 1, &listA);
+    ring.Allocate(Descriptors, 2, 1, &listB);
+    ring.Allocate(Descriptors, 2, 1, &listA);
+    EXPECT_EQ(ring.SegmentCount(), 3u);
+    EXPECT_EQ(ring.OpenCount(), 3u);
+
+    ring.Close(&listA, &fence, 1);
+    EXPECT_FALSE(ring.IsOpen(&listA));
+    EXPECT_TRUE(ring.IsOpen(&listB));
+    EXPECT_EQ(ring.OpenCount(), 1u);
+
+    // First listA range retires, listB is not executed yet so the listA range after it is held
+    fence.completed = 1;
+    ring.Retire();
+    EXPECT_EQ(ring.SegmentCount(), 2u);
+}
+
+TEST_F(RingRangesTest, SameOwnerExtendsSegment)
+{
+    ring.Allocate(Descriptors, 2, 1, &listA);
+    ring.Allocate(Constants, 256, 256, &listA);
+    ring.Allocate(Descriptors, 2, 1, &listA);
+    EXPECT_EQ(ring.SegmentCount(), 1u);
+
+    // After close same list gets a new segment
+    ring.Close(&listA, &fence, 1);
+    ring.Allocate(Descriptors, 2, 1, &listA);
+    EXPECT_EQ(ring.SegmentCount(), 2u);
+}
+
+TEST_F(RingRangesTest, ConstantsAreAligned)
+{
+    EXPECT_EQ(ring.Allocate(Constants, 16, 256, &listA), 0u);
+    EXPECT_EQ(ring.Allocate(Constants, 16, 256, &listA), 256u);
+    EXPECT_EQ(ring.Allocate(Constants, 512, 256, &listA), 512u);
+
+    // Ring is full up to the last aligned slot
+    EXPECT_EQ(ring.Allocate(Constants, 16, 256, &listB), Invalid);
+}
+
+TEST_F(RingRangesTest, FullRingWaitsForOldestClosed)
+{
+    EXPECT_EQ(ring.Allocate(Descriptors, 8, 1, &listA), 0u);
+    EXPECT_EQ(ring.Allocate(Descriptors, 8, 1, &listB), 8u);
+    ring.Close(&listA, &fence, 1);
+    ring.Close(&listB, &fence, 2);
+
+    // Only listA's range is needed
+    EXPECT_EQ(ring.Allocate(Descriptors, 4, 1, &listC), 0u);
+    EXPECT_EQ(waitCalls, 1);
+    EXPECT_EQ(fence.completed, 1u);
+    EXPECT_EQ(ring.SegmentCount(), 2u);
+}
+
+TEST_F(RingRangesTest, FullRingWithOpenFrontFails)
+{
+    EXPECT_EQ(ring.Allocate(Descriptors, 8, 1, &listA), 0u);
+    EXPECT_EQ(ring.Allocate(Descriptors, 8, 1, &listB), 8u);
+    ring.Close(&listB, &fence, 1);
+    fence.completed = 1;
+
+    // listA is not executed yet, its range must not be handed out
+    EXPECT_EQ(ring.Allocate(Descriptors, 4, 1, &listC), Invalid);
+    EXPECT_EQ(waitCalls, 0);
+    EXPECT_EQ(ring.SegmentCount(), 2u);
+
+    // Failed allocation didn't move the ring
+    ring.Close(&listA, &fence, 2);
+    fence.completed = 2;
+    EXPECT_EQ(ring.Allocate(Descriptors, 4, 1, &listC), 0u);
+}
+
+TEST_F(RingRangesTest, FailedWaitFails)
+{
+    ring.Allocate(Descriptors, 16, 1, &listA);
+    ring.Close(&listA, &fence, 1);
+
+    waitSucceeds = false;
+    EXPECT_EQ(ring.Allocate(Descriptors, 1, 1, &listB), Invalid);
+    EXPECT_EQ(waitCalls, 1);
+    EXPECT_EQ(ring.SegmentCount(), 1u);
+
+    waitSucceeds = true;
+    EXPECT_EQ(ring.Allocate(Descriptors, 1, 1, &listB), 0u);
+}
+
+TEST_F(RingRangesTest, EmptyRingReusesSkippedEnd)
+{
+    ring.Allocate(Descriptors, 10, 1, &listA);
+    ring.Close(&listA, &fence, 1);
+    fence.completed = 1;
+    ring.Retire();
+
+    // 12 don't fit after 10, nothing in use so whole ring is free from the start
+    EXPECT_EQ(ring.Allocate(Descriptors, 12, 1, &listB), 0u);
+    EXPECT_EQ(ring.Allocate(Descriptors, 4, 1, &listB), 12u);
+}
+
+TEST_F(RingRangesTest, InvalidCounts)
+{
+    EXPECT_EQ(ring.Allocate(Descriptors, 0, 1, &listA), Invalid);
+    EXPECT_EQ(ring.Allocate(Descriptors, 17, 1, &listA), Invalid);
+    EXPECT_EQ(ring.SegmentCount(), 0u);
+}
+
+TEST_F(RingRangesTest, ClearDropsEverything)
+{
+    ring.Allocate(Descriptors, 16, 1, &listA);
+    ring.Clear();
+    EXPECT_EQ(ring.OpenCount(), 0u);
+    EXPECT_EQ(ring.Allocate(Descriptors, 8, 1, &listB), 0u);
+}
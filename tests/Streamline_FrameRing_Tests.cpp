@@ -0,0 +1,188 @@
+#include <inputs/FG/Streamline_FrameRing.h>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+namespace
+{
+uint32_t InputsOf(const Sl_FrameRing& ring, uint32_t frameId)
+{
+    uint32_t inputs = 0;
+    EXPECT_TRUE(ring.Inputs(frameId, inputs)) << "frameId " << frameId;
+    return inputs;
+}
+
+void MarkRequired(Sl_FrameRing& ring, uint32_t frameId)
+{
+    EXPECT_TRUE(ring.Mark(frameId, SlInput_Constants));
+    EXPECT_TRUE(ring.Mark(frameId, SlInput_Depth));
+    EXPECT_TRUE(ring.Mark(frameId, SlInput_Velocity));
+}
+} // namespace
+
+TEST(Sl_FrameRing, UnclaimedTokensAreNotTracked)
+{
+    Sl_FrameRing ring;
+    uint32_t inputs = 0;
+
+    EXPECT_EQ(ring.IndexOf(1), -1);
+    EXPECT_FALSE(ring.Mark(1, SlInput_Depth));
+    EXPECT_FALSE(ring.Inputs(1, inputs));
+    EXPECT_FALSE(ring.IsReady(1));
+
+    // Empty slots hold the invalid token
+    EXPECT_FALSE(ring.Mark(UINT32_MAX, SlInput_Depth));
+}
+
+TEST(Sl_FrameRing, RequiredInputsMakeFrameReady)
+{
+    Sl_FrameRing ring;
+    ring.Claim(10, 2);
+
+    EXPECT_EQ(ring.IndexOf(10), 2);
+    EXPECT_TRUE(ring.Mark(10, SlInput_Depth));
+    EXPECT_TRUE(ring.Mark(10, SlInput_UI));
+    EXPECT_FALSE(ring.IsReady(10));
+
+    EXPECT_TRUE(ring.Mark(10, SlInput_Constants));
+    EXPECT_TRUE(ring.Mark(10, SlInput_Velocity));
+    EXPECT_TRUE(ring.IsReady(10));
+    EXPECT_EQ(InputsOf(ring, 10), (uint32_t) (SlInput_Required | SlInput_UI));
+}
+
+TEST(Sl_FrameRing, WraparoundDropsOldToken)
+{
+    Sl_FrameRing ring;
+
+    for (uint32_t frame = 1; frame <= 100; frame++)
+    {
+        ring.Claim(frame, (int) (frame % BUFFER_COUNT));
+        MarkRequired(ring, frame);
+
+        // Same slot, one lap behind
+        if (frame > Sl_FrameRing::SlotCount)
+        {
+            auto old = frame - Sl_FrameRing::SlotCount;
+            EXPECT_EQ(ring.IndexOf(old), -1);
+            EXPECT_FALSE(ring.Mark(old, SlInput_Hudless));
+            EXPECT_TRUE(Sl_FrameRing::IsStale(old, frame));
+        }
+
+        EXPECT_FALSE(Sl_FrameRing::IsStale(frame, frame));
+        EXPECT_FALSE(Sl_FrameRing::IsStale(frame - 1, frame));
+        EXPECT_EQ(InputsOf(ring, frame), (uint32_t) SlInput_Required);
+    }
+
+    // Token counter wraps, slots follow the low bits
+    ring.Claim(UINT32_MAX - 1, 0);
+    ring.Claim(0, 1);
+    EXPECT_EQ(ring.IndexOf(UINT32_MAX - 1), 0);
+    EXPECT_EQ(ring.IndexOf(0), 1);
+}
+
+TEST(Sl_FrameRing, ReusedBufferDropsOlderToken)
+{
+    Sl_FrameRing ring;
+
+    ring.Claim(1, 0);
+    ring.Claim(2, 1);
+    MarkRequired(ring, 1);
+
+    // FG buffer 0 is used by frame 5 now, frame 1's late inputs must not go to it
+    ring.Claim(5, 0);
+
+    EXPECT_EQ(ring.IndexOf(1), -1);
+    EXPECT_FALSE(ring.Mark(1, SlInput_Present));
+    EXPECT_FALSE(ring.IsReady(1));
+    EXPECT_EQ(ring.IndexOf(2), 1);
+    EXPECT_EQ(InputsOf(ring, 5), 0u);
+}
+
+TEST(Sl_FrameRing, OutOfOrderInputsGoToTheirToken)
+{
+    Sl_FrameRing ring;
+
+    // Next frame started while the previous one still gets tags and its present
+    ring.Claim(20, 0);
+    ring.Claim(21, 1);
+
+    EXPECT_TRUE(ring.Mark(21, SlInput_Constants));
+    EXPECT_TRUE(ring.Mark(20, SlInput_Depth));
+    EXPECT_TRUE(ring.Mark(21, SlInput_Depth));
+    EXPECT_TRUE(ring.Mark(20, SlInput_Present)); // Presented before all inputs arrived
+    EXPECT_TRUE(ring.Mark(20, SlInput_Velocity));
+    EXPECT_TRUE(ring.Mark(20, SlInput_Constants));
+
+    EXPECT_TRUE(ring.IsReady(20));
+    EXPECT_EQ(InputsOf(ring, 20), (uint32_t) (SlInput_Required | SlInput_Present));
+
+    EXPECT_FALSE(ring.IsReady(21));
+    EXPECT_EQ(InputsOf(ring, 21), (uint32_t) (SlInput_Constants | SlInput_Depth));
+}
+
+TEST(Sl_FrameRing, ResetDropsAllTokens)
+{
+    Sl_FrameRing ring;
+
+    ring.Claim(3, 3);
+    MarkRequired(ring, 3);
+    ring.Reset();
+
+    EXPECT_EQ(ring.IndexOf(3), -1);
+    EXPECT_FALSE(ring.IsReady(3));
+}
+
+// Late tags and markers race with claims of newer frames. Inputs are only sent to tokens with bit 3 clear, the token
+// reusing their slot has it set, any input found there was recorded for the wrong frame.
+TEST(Sl_FrameRing, ConcurrentMarksNeverLandOnNewerToken)
+{
+    constexpr uint32_t frames = 100000;
+    constexpr uint32_t targetBit = Sl_FrameRing::SlotCount;
+
+    Sl_FrameRing ring;
+    std::atomic<uint32_t> latest { 0 };
+    std::atomic<bool> done { false };
+    std::atomic<uint32_t> misplaced { 0 };
+
+    auto marker = [&](SlFrameInput input)
+    {
+        while (!done.load(std::memory_order_acquire))
+        {
+            // Oldest tracked token, its slot is claimed next
+            auto frame = latest.load(std::memory_order_acquire) - (Sl_FrameRing::SlotCount - 1);
+
+            if ((frame & targetBit) == 0)
+                ring.Mark(frame, input);
+        }
+    };
+
+    std::vector<std::thread> markers;
+
+    for (auto input : { SlInput_Constants, SlInput_Depth, SlInput_Velocity, SlInput_Hudless })
+        markers.emplace_back(marker, input);
+
+    for (uint32_t frame = 1; frame <= frames; frame++)
+    {
+        // Token leaving the slot
+        if (frame > Sl_FrameRing::SlotCount)
+        {
+            uint32_t inputs = 0;
+            auto old = frame - Sl_FrameRing::SlotCount;
+
+            if ((old & targetBit) != 0 && ring.Inputs(old, inputs) && inputs != 0)
+                misplaced.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Index per slot, tokens live for the whole lap
+        ring.Claim(frame, (int) (frame % Sl_FrameRing::SlotCount));
+        latest.store(frame, std::memory_order_release);
+    }
+
+    done.store(true, std::memory_order_release);
+
+    for (auto& thread : markers)
+        thread.join();
+
+    EXPECT_EQ(misplaced.load(), 0u);
+}
@@ -0,0 +1,123 @@
+#include <hooks/SubmitScratch.h>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+namespace
+{
+bool IsInside(const void* pointer, const void* object, size_t size)
+{
+    auto address = (const char*) pointer;
+    return address >= (const char*) object && address < (const char*) object + size;
+}
+} // namespace
+
+TEST(SubmitScratchTest, SmallCountsStayInline)
+{
+    SubmitScratch<int, 4> scratch;
+
+    for (int i = 0; i < 4; i++)
+        scratch.push_back(i);
+
+    EXPECT_EQ(scratch.size(), 4u);
+    EXPECT_TRUE(IsInside(scratch.data(), &scratch, sizeof(scratch)));
+
+    auto items = scratch.Acquire(3);
+    EXPECT_TRUE(IsInside(items, &scratch, sizeof(scratch)));
+    EXPECT_EQ(scratch.size(), 3u);
+}
+
+TEST(SubmitScratchTest, PushBackSpillKeepsItems)
+{
+    SubmitScratch<int, 4> scratch;
+
+    for (int i = 0; i < 11; i++)
+        scratch.push_back(i * 10);
+
+    ASSERT_EQ(scratch.size(), 11u);
+    EXPECT_FALSE(IsInside(scratch.data(), &scratch, sizeof(scratch)));
+
+    for (int i = 0; i < 11; i++)
+        EXPECT_EQ(scratch.data()[i], i * 10);
+}
+
+TEST(SubmitScratchTest, AcquireSpillsAndReusesCapacity)
+{
+    SubmitScratch<int, 4> scratch;
+
+    auto first = scratch.Acquire(16);
+    EXPECT_EQ(scratch.size(), 16u);
+    EXPECT_FALSE(IsInside(first, &scratch, sizeof(scratch)));
+
+    for (int i = 0; i < 16; i++)
+        first[i] = i;
+
+    // Same or smaller spilled requests don't reallocate
+    scratch.Clear();
+    EXPECT_TRUE(scratch.empty());
+    EXPECT_EQ(scratch.Acquire(16), first);
+    EXPECT_EQ(scratch.Acquire(8), first);
+
+    // Small request goes back inline, spill after it finds the old storage
+    EXPECT_TRUE(IsInside(scratch.Acquire(2), &scratch, sizeof(scratch)));
+    EXPECT_EQ(scratch.Acquire(12), first);
+}
+
+TEST(SubmitScratchTest, PushBackAfterAcquire)
+{
+    SubmitScratch<int, 4> scratch;
+
+    auto items = scratch.Acquire(4);
+
+    for (int i = 0; i < 4; i++)
+        items[i] = i;
+
+    // Appending to a full inline block moves it to the vector
+    scratch.push_back(4);
+    scratch.push_back(5);
+    ASSERT_EQ(scratch.size(), 6u);
+
+    for (int i = 0; i < 6; i++)
+        EXPECT_EQ(scratch.data()[i], i);
+
+    // Spilled by Acquire, growing past the vector size
+    scratch.Clear();
+    items = scratch.Acquire(5);
+
+    for (int i = 0; i < 5; i++)
+        items[i] = i;
+
+    for (int i = 5; i < 20; i++)
+        scratch.push_back(i);
+
+    ASSERT_EQ(scratch.size(), 20u);
+
+    for (int i = 0; i < 20; i++)
+        EXPECT_EQ(scratch.data()[i], i);
+}
+
+TEST(SubmitScratchTest, ThreadLocalInstancesAreIndependent)
+{
+    // Submit hooks use one instance per thread, pointers handed out on one thread aren't touched by another
+    static thread_local SubmitScratch<int, 2> scratch;
+
+    auto mine = scratch.Acquire(8);
+
+    for (int i = 0; i < 8; i++)
+        mine[i] = 7;
+
+    std::thread other(
+        []()
+        {
+            auto items = scratch.Acquire(8);
+
+            for (int i = 0; i < 8; i++)
+                items[i] = -1;
+        });
+
+    other.join();
+
+    for (int i = 0; i < 8; i++)
+        EXPECT_EQ(mine[i], 7);
+}
@@ -0,0 +1,213 @@
+#include <spoofing/Vulkan_ExtensionCache.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+// Fake driver, unsorted with a duplicate like some layers report
+std::vector<std::string> driverExtensions { "VK_b", "VK_a", "VK_c", "VK_a" };
+int driverCalls = 0;
+int growOnFill = 0; // Fill calls which see one extension more than the count call did
+
+VkResult FakeEnumerate(uint32_t* pCount, VkExtensionProperties* pProperties)
+{
+    driverCalls++;
+
+    auto size = (uint32_t) driverExtensions.size();
+
+    if (pProperties == nullptr)
+    {
+        *pCount = size;
+        return VK_SUCCESS;
+    }
+
+    if (growOnFill > 0)
+    {
+        growOnFill--;
+        size++;
+    }
+
+    auto written = (std::min)(*pCount, size);
+
+    for (uint32_t i = 0; i < written; i++)
+    {
+        auto name = i < driverExtensions.size() ? driverExtensions[i] : std::string("VK_late");
+        snprintf(pProperties[i].extensionName, sizeof(pProperties[i].extensionName), "%s", name.c_str());
+        pProperties[i].specVersion = i + 1;
+    }
+
+    *pCount = written;
+    return written < size ? VK_INCOMPLETE : VK_SUCCESS;
+}
+
+VkResult FakeDeviceEnumerate(VkPhysicalDevice, const char*, uint32_t* pCount, VkExtensionProperties* pProperties)
+{
+    return FakeEnumerate(pCount, pProperties);
+}
+
+VkResult FakeInstanceEnumerate(const char*, uint32_t* pCount, VkExtensionProperties* pProperties)
+{
+    return FakeEnumerate(pCount, pProperties);
+}
+
+VkResult FailingDeviceEnumerate(VkPhysicalDevice, const char*, uint32_t*, VkExtensionProperties*)
+{
+    driverCalls++;
+    return VK_ERROR_INITIALIZATION_FAILED;
+}
+
+// Static like the spoofing tables, pointer and count identify the set
+const VkExtensionProperties injected[] = { { "VK_a", 99 }, { "VK_bb", 1 }, { "VK_0", 1 } };
+const VkExtensionProperties otherInjected[] = { { "VK_z", 1 } };
+
+const auto device = (VkPhysicalDevice) 0x10;
+
+std::vector<std::string> Names(const VkExtensionProperties* properties, uint32_t count)
+{
+    std::vector<std::string> names;
+
+    for (uint32_t i = 0; i < count; i++)
+        names.emplace_back(properties[i].extensionName);
+
+    return names;
+}
+
+class ExtensionCacheTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        VulkanExtensionCache::ResetDevices();
+        driverCalls = 0;
+        growOnFill = 0;
+    }
+};
+} // namespace
+
+TEST_F(ExtensionCacheTest, DriverIsReadOnce)
+{
+    uint32_t count = 0;
+    ASSERT_EQ(VulkanExtensionCache::EnumerateDevice(FakeDeviceEnumerate, device, nullptr, nullptr, 0, &count, nullptr),
+              VK_SUCCESS);
+    EXPECT_EQ(count, 3u);
+    EXPECT_EQ(driverCalls, 2);
+
+    VkExtensionProperties properties[8];
+    count = 8;
+    ASSERT_EQ(
+        VulkanExtensionCache::EnumerateDevice(FakeDeviceEnumerate, device, nullptr, nullptr, 0, &count, properties),
+        VK_SUCCESS);
+    EXPECT_EQ(Names(properties, count), (std::vector<std::string> { "VK_a", "VK_b", "VK_c" }));
+
+    EXPECT_TRUE(*VulkanExtensionCache::DeviceHasExtension(FakeDeviceEnumerate, device, "VK_c"));
+    EXPECT_FALSE(*VulkanExtensionCache::DeviceHasExtension(FakeDeviceEnumerate, device, "VK_d"));
+    EXPECT_EQ(driverCalls, 2);
+}
+
+TEST_F(ExtensionCacheTest, InjectedAreMergedSorted)
+{
+    VkExtensionProperties properties[8];
+    uint32_t count = 8;
+    ASSERT_EQ(
+        VulkanExtensionCache::EnumerateDevice(FakeDeviceEnumerate, device, nullptr, injected, 3, &count, properties),
+        VK_SUCCESS);
+
+    EXPECT_EQ(Names(properties, count), (std::vector<std::string> { "VK_0", "VK_a", "VK_b", "VK_bb", "VK_c" }));
+    EXPECT_NE(properties[1].specVersion, 99u); // Driver's entry wins
+
+    // Spoofed extensions are served, not reported as supported by the driver
+    EXPECT_FALSE(*VulkanExtensionCache::DeviceHasExtension(FakeDeviceEnumerate, device, "VK_bb"));
+
+    // Injected set changed
+    count = 8;
+    ASSERT_EQ(VulkanExtensionCache::EnumerateDevice(FakeDeviceEnumerate, device, nullptr, otherInjected, 1, &count,
+                                                    properties),
+              VK_SUCCESS);
+    EXPECT_EQ(Names(properties, count), (std::vector<std::string> { "VK_a", "VK_b", "VK_c", "VK_z" }));
+    EXPECT_EQ(driverCalls, 2);
+}
+
+TEST_F(ExtensionCacheTest, ShortBufferIsIncomplete)
+{
+    VkExtensionProperties properties[8];
+    uint32_t count = 2;
+    EXPECT_EQ(
+        VulkanExtensionCache::EnumerateDevice(FakeDeviceEnumerate, device, nullptr, injected, 3, &count, properties),
+        VK_INCOMPLETE);
+    EXPECT_EQ(count, 2u);
+    EXPECT_EQ(Names(properties, count), (std::vector<std::string> { "VK_0", "VK_a" }));
+}
+
+TEST_F(ExtensionCacheTest, LayerListsAreSeparateAndNotInjected)
+{
+    VkExtensionProperties properties[8];
+    uint32_t count = 8;
+    ASSERT_EQ(VulkanExtensionCache::EnumerateDevice(FakeDeviceEnumerate, device, nullptr, injected, 3, &count,
+                                                    properties),
+              VK_SUCCESS);
+    EXPECT_EQ(driverCalls, 2);
+
+    count = 8;
+    ASSERT_EQ(
+        VulkanExtensionCache::EnumerateDevice(FakeDeviceEnumerate, device, "VK_LAYER_test", injected, 3, &count,
+                                              properties),
+        VK_SUCCESS);
+    EXPECT_EQ(count, 3u);
+    EXPECT_EQ(driverCalls, 4);
+
+    // Other device has its own list
+    count = 0;
+    VulkanExtensionCache::EnumerateDevice(FakeDeviceEnumerate, (VkPhysicalDevice) 0x20, nullptr, nullptr, 0, &count,
+                                          nullptr);
+    EXPECT_EQ(driverCalls, 6);
+}
+
+TEST_F(ExtensionCacheTest, GrowingListIsRetried)
+{
+    growOnFill = 1;
+
+    VkExtensionProperties properties[8];
+    uint32_t count = 8;
+    ASSERT_EQ(
+        VulkanExtensionCache::EnumerateDevice(FakeDeviceEnumerate, device, nullptr, nullptr, 0, &count, properties),
+        VK_SUCCESS);
+    EXPECT_EQ(count, 3u);
+    EXPECT_EQ(driverCalls, 4);
+}
+
+TEST_F(ExtensionCacheTest, FailuresAreNotCached)
+{
+    uint32_t count = 0;
+    EXPECT_EQ(
+        VulkanExtensionCache::EnumerateDevice(FailingDeviceEnumerate, device, nullptr, nullptr, 0, &count, nullptr),
+        VK_ERROR_INITIALIZATION_FAILED);
+    EXPECT_FALSE(VulkanExtensionCache::DeviceHasExtension(nullptr, device, "VK_a").has_value());
+
+    EXPECT_TRUE(*VulkanExtensionCache::DeviceHasExtension(FakeDeviceEnumerate, device, "VK_a"));
+}
+
+TEST_F(ExtensionCacheTest, ResetDropsDeviceLists)
+{
+    EXPECT_TRUE(*VulkanExtensionCache::DeviceHasExtension(FakeDeviceEnumerate, device, "VK_a"));
+
+    VulkanExtensionCache::ResetDevices();
+    EXPECT_FALSE(VulkanExtensionCache::DeviceHasExtension(nullptr, device, "VK_a").has_value());
+}
+
+TEST_F(ExtensionCacheTest, InstanceListIsCached)
+{
+    uint32_t count = 0;
+    ASSERT_EQ(VulkanExtensionCache::EnumerateInstance(FakeInstanceEnumerate, nullptr, &count, nullptr), VK_SUCCESS);
+    EXPECT_EQ(count, 3u);
+
+    EXPECT_TRUE(*VulkanExtensionCache::InstanceHasExtension(FakeInstanceEnumerate, "VK_b"));
+    EXPECT_TRUE(*VulkanExtensionCache::InstanceHasExtension(nullptr, "VK_b"));
+    EXPECT_EQ(driverCalls, 2);
+
+    // Device reset keeps instance lists
+    VulkanExtensionCache::ResetDevices();
+    EXPECT_TRUE(VulkanExtensionCache::InstanceHasExtension(nullptr, "VK_b").has_value());
+}
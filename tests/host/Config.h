@@ -0,0 +1,83 @@
+#pragma once
+#include "SysUtils.h"
+#include "State.h"
+
+// Host build replacement of OptiScaler/Config.h
+//
+// Only the options read by the units under test, defaults must match OptiScaler/Config.h.
+
+enum HasDefaultValue
+{
+    WithDefault,
+    NoDefault,
+    SoftDefault
+};
+
+template <class T, HasDefaultValue defaultState = WithDefault> class CustomOptional : public std::optional<T>
+{
+  private:
+    T _defaultValue;
+
+  public:
+    CustomOptional(T defaultValue)
+        requires(defaultState != NoDefault)
+        : _defaultValue(std::move(defaultValue))
+    {
+    }
+
+    CustomOptional()
+        requires(defaultState == NoDefault)
+        : _defaultValue(T {})
+    {
+    }
+
+    void set_volatile_value(const T& value) { std::optional<T>::operator=(value); }
+
+    CustomOptional& operator=(const T& value)
+    {
+        std::optional<T>::operator=(value);
+        return *this;
+    }
+
+    T value_or_default() const
+        requires(defaultState != NoDefault)
+    {
+        return this->has_value() ? this->value() : _defaultValue;
+    }
+};
+
+class Config
+{
+  public:
+    // Logging
+    CustomOptional<bool> LogAsync { false };
+
+    // Present path
+    CustomOptional<bool> PresentDeferBookkeeping { true };
+    CustomOptional<float> PresentWorkBudget { 0.5f };
+
+    // Upscale ratios
+    CustomOptional<bool> ExtendedLimits { false };
+    CustomOptional<bool> UpscaleRatioOverrideEnabled { false };
+    CustomOptional<float> UpscaleRatioOverrideValue { 1.3f };
+    CustomOptional<bool> QualityRatioOverrideEnabled { false };
+    CustomOptional<float> QualityRatio_DLAA { 1.0f };
+    CustomOptional<float> QualityRatio_UltraQuality { 1.3f };
+    CustomOptional<float> QualityRatio_Quality { 1.5f };
+    CustomOptional<float> QualityRatio_Balanced { 1.7f };
+    CustomOptional<float> QualityRatio_Performance { 2.0f };
+    CustomOptional<float> QualityRatio_UltraPerformance { 3.0f };
+    CustomOptional<int, NoDefault> RoundInternalResolution; // disabled by default
+
+    // Dynamic resolution
+    CustomOptional<bool> DrsMinOverrideEnabled { false };
+    CustomOptional<bool> DrsMaxOverrideEnabled { false };
+    CustomOptional<bool> DrsControllerEnabled { false };
+    CustomOptional<float> DrsTargetFrameTime { 16.667f }; // ms
+
+    static Config* Instance()
+    {
+        static Config instance;
+        return &instance;
+    }
+};
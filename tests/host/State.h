@@ -0,0 +1,16 @@
+#pragma once
+#include "SysUtils.h"
+
+// Host build replacement of OptiScaler/State.h, only the fields read by the units under test
+
+class State
+{
+  public:
+    bool isShuttingDown = false;
+
+    static State& Instance()
+    {
+        static State instance;
+        return instance;
+    }
+};
@@ -0,0 +1,113 @@
+#pragma once
+
+// Host build replacement of OptiScaler/SysUtils.h
+//
+// Windows types and logging macros used by the units under test. Logs are compiled out, units are
+// checked by their results only.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <optional>
+#include <algorithm>
+#include <filesystem>
+#include <unordered_map>
+
+#include <immintrin.h>
+
+#if __has_include(<nvsdk_ngx_defs.h>)
+#include <nvsdk_ngx_defs.h>
+#endif
+
+#ifdef OPTI_HOST_SPDLOG
+#include <spdlog/spdlog.h>
+
+// Resolves to host/format when the standard library has none
+#include <format>
+
+#include "DeferredLog.h"
+#endif
+
+typedef int BOOL;
+typedef int INT;
+typedef unsigned int UINT;
+typedef int32_t LONG;
+typedef uint32_t ULONG;
+typedef uint32_t DWORD;
+typedef int64_t INT64;
+typedef uint64_t UINT64;
+typedef uint64_t ULONG64;
+typedef size_t SIZE_T;
+typedef int32_t HRESULT;
+typedef void* HWND;
+typedef void* HMODULE;
+typedef void* PVOID;
+typedef const wchar_t* LPCWSTR;
+
+struct GUID
+{
+    uint32_t Data1;
+    uint16_t Data2;
+    uint16_t Data3;
+    uint8_t Data4[8];
+};
+
+typedef GUID IID;
+
+// COM objects are passed around by pointer, units under test only release them
+struct IUnknown
+{
+    virtual ULONG AddRef() = 0;
+    virtual ULONG Release() = 0;
+};
+
+#define GET_MODULE_HANDLE_EX_FLAG_PIN 0x00000001
+#define GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS 0x00000004
+
+// Test executables never unload
+inline BOOL GetModuleHandleExW(DWORD, LPCWSTR, HMODULE* module)
+{
+    *module = nullptr;
+    return 1;
+}
+
+#define __forceinline inline __attribute__((always_inline))
+
+#define BUFFER_COUNT 4
+
+#define LOG_TRACE(msg, ...) ((void) 0)
+#define LOG_DEBUG(msg, ...) ((void) 0)
+#define LOG_DEBUG_ONLY(msg, ...) ((void) 0)
+#define LOG_DEBUG_ASYNC(msg, ...) ((void) 0)
+#define LOG_INFO(msg, ...) ((void) 0)
+#define LOG_WARN(msg, ...) ((void) 0)
+#define LOG_ERROR(msg, ...) ((void) 0)
+#define LOG_FUNC() ((void) 0)
+#define LOG_FUNC_RESULT(result) ((void) 0)
+#define LOG_TRACK(msg, ...) ((void) 0)
+
+struct feature_version
+{
+    unsigned int major;
+    unsigned int minor;
+    unsigned int patch;
+
+    bool operator==(const feature_version& other) const = default;
+};
+
+// Paths are narrow on the host
+inline FILE* _wfopen(const std::filesystem::path::value_type* path, const wchar_t* mode)
+{
+    return fopen(path, std::filesystem::path(mode).string().c_str());
+}
+
+inline std::string wstring_to_string(const std::wstring& wide_str)
+{
+    return std::filesystem::path(wide_str).string();
+}
+
+inline std::wstring string_to_wstring(const std::string& str) { return std::filesystem::path(str).wstring(); }
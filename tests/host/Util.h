@@ -0,0 +1,9 @@
+#pragma once
+#include "SysUtils.h"
+
+// Host build replacement of OptiScaler/Util.h, files next to the DLL go to the temp directory
+
+namespace Util
+{
+inline std::filesystem::path DllPath() { return std::filesystem::temp_directory_path() / L"OptiScaler.dll"; }
+} // namespace Util
@@ -0,0 +1,31 @@
+#pragma once
+#include "dxgi.h"
+
+// Host build replacement of d3d11.h
+//
+// Only what CopyBatch_Dx11 calls, tests implement the interfaces with fakes.
+
+#ifndef S_OK
+#define S_OK ((HRESULT) 0L)
+#endif
+
+#ifndef E_FAIL
+#define E_FAIL ((HRESULT) 0x80004005L)
+#endif
+
+#ifndef DXGI_ERROR_NOT_FOUND
+#define DXGI_ERROR_NOT_FOUND ((HRESULT) 0x887A0002L)
+#endif
+
+typedef const GUID& REFGUID;
+
+struct ID3D11Resource : IUnknown
+{
+    virtual HRESULT GetPrivateData(REFGUID guid, UINT* pDataSize, void* pData) = 0;
+    virtual HRESULT SetPrivateData(REFGUID guid, UINT DataSize, const void* pData) = 0;
+};
+
+struct ID3D11DeviceContext : IUnknown
+{
+    virtual void CopyResource(ID3D11Resource* pDstResource, ID3D11Resource* pSrcResource) = 0;
+};
@@ -0,0 +1,42 @@
+#pragma once
+
+// Host build replacement of d3dcompiler.h
+//
+// Shader headers keep their compile helpers, nothing is compiled on the host.
+
+#include "SysUtils.h"
+
+#ifndef FAILED
+#define FAILED(hr) (((HRESULT) (hr)) < 0)
+#endif
+
+#ifndef E_FAIL
+#define E_FAIL ((HRESULT) 0x80004005L)
+#endif
+
+#define D3DCOMPILE_OPTIMIZATION_LEVEL3 (1 << 15)
+
+typedef struct _D3D_SHADER_MACRO
+{
+    const char* Name;
+    const char* Definition;
+} D3D_SHADER_MACRO;
+
+struct ID3DBlob : IUnknown
+{
+    virtual void* GetBufferPointer() = 0;
+    virtual SIZE_T GetBufferSize() = 0;
+};
+
+struct ID3DInclude;
+
+inline HRESULT D3DCompile(const void*, SIZE_T, const char*, const D3D_SHADER_MACRO*, ID3DInclude*, const char*,
+                          const char*, UINT, UINT, ID3DBlob** ppCode, ID3DBlob** ppErrorMsgs)
+{
+    *ppCode = nullptr;
+
+    if (ppErrorMsgs != nullptr)
+        *ppErrorMsgs = nullptr;
+
+    return E_FAIL;
+}
@@ -0,0 +1,3 @@
+#pragma once
+// Host build replacement of dxgi1_6.h
+#include "dxgi.h"
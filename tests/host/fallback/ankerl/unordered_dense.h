@@ -0,0 +1,12 @@
+#pragma once
+
+// Used only when external/unordered_dense submodule is not checked out, same interface subset on std containers
+
+#include <unordered_map>
+#include <unordered_set>
+
+namespace ankerl::unordered_dense
+{
+template <class Key, class T, class Hash = std::hash<Key>> using map = std::unordered_map<Key, T, Hash>;
+template <class Key, class Hash = std::hash<Key>> using set = std::unordered_set<Key, Hash>;
+} // namespace ankerl::unordered_dense
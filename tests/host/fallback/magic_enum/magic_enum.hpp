@@ -0,0 +1,10 @@
+#pragma once
+
+// Used only when external/magic_enum submodule is not checked out, names are only needed by compiled out logs
+
+#include <string_view>
+
+namespace magic_enum
+{
+template <typename E> constexpr std::string_view enum_name(E) { return {}; }
+} // namespace magic_enum
@@ -0,0 +1,4 @@
+#pragma once
+// Host build replacement of OptiScaler/pch.h, resolves to the shims next to it
+#include "SysUtils.h"
+#include "Config.h"
@@ -0,0 +1,58 @@
+// Caller side cost of LOG_DEBUG style calls, deferred to the log thread vs formatted on the calling thread
+//
+//   deferred_log_bench [calls]
+//
+// Logs go to a null sink so only formatting and the ring push are measured. Calls are made in batches smaller
+// than a ring with a pause for the log thread between them, nothing is dropped.
+
+#include <SysUtils.h> // Host one, includes DeferredLog.h after spdlog
+
+#include <spdlog/sinks/null_sink.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+using Clock = std::chrono::steady_clock;
+
+static double NsPerCall(int calls)
+{
+    constexpr int batch = DEFERRED_LOG_RING_SIZE / 2;
+    Clock::duration elapsed {};
+
+    for (int done = 0; done < calls; done += batch)
+    {
+        auto start = Clock::now();
+
+        for (int i = 0; i < batch; i++)
+            DeferredLog::Log(spdlog::level::debug, "frame: {} resource: {:X} scale: {:.3f} ok: {}", done + i,
+                             (uint64_t) (0x1000 + i), 0.667f, (i & 1) == 0);
+
+        elapsed += Clock::now() - start;
+
+        if (DeferredLog::IsEnabled())
+            std::this_thread::sleep_for(std::chrono::milliseconds(4));
+    }
+
+    auto rounded = (calls + batch - 1) / batch * batch;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / rounded;
+}
+
+int main(int argc, char** argv)
+{
+    auto calls = argc > 1 ? atoi(argv[1]) : 200000;
+
+    auto logger = std::make_shared<spdlog::logger>("bench", std::make_shared<spdlog::sinks::null_sink_mt>());
+    logger->set_level(spdlog::level::trace);
+    spdlog::set_default_logger(logger);
+
+    auto immediate = NsPerCall(calls);
+
+    DeferredLog::Init();
+    auto deferred = NsPerCall(calls);
+    DeferredLog::Shutdown();
+
+    printf("calls: %d\nimmediate: %.1f ns/call\ndeferred: %.1f ns/call\n", calls, immediate, deferred);
+    return 0;
+}
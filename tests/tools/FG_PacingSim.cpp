@@ -0,0 +1,200 @@
+#include "pch.h"
+#include "FG_PacingSim.h"
+
+#include <framegen/IFGFeature.h>
+
+#include <random>
+#include <set>
+
+FG_SimReport FG_PacingSim::Run(const std::vector<FG_SimEvent>& events, UINT64 allowedAhead)
+{
+    FG_SimReport report {};
+    FG_Pacing pacing;
+
+    std::set<UINT64> produced;
+    std::set<UINT64> dispatched;
+    uint32_t tagged[BUFFER_COUNT] {}; // What HasResource would see for each buffer
+    UINT64 latencySum = 0;
+
+    // Frame ids restart with the context, count drops of each run separately
+    auto countDropped = [&]()
+    {
+        if (dispatched.empty())
+            return;
+
+        auto lastDispatched = *dispatched.rbegin();
+
+        for (auto frame : produced)
+        {
+            if (frame < lastDispatched && !dispatched.contains(frame))
+                report.dropped++;
+        }
+    };
+
+    for (const auto& event : events)
+    {
+        switch (event.type)
+        {
+        case FG_SimEventType::NewFrame:
+        {
+            auto frame = pacing.NewFrame();
+            tagged[FG_Pacing::IndexOf(frame)] = 0;
+            produced.insert(frame);
+            report.frames++;
+            break;
+        }
+
+        case FG_SimEventType::Tag:
+        {
+            auto index = pacing.GetIndex();
+
+            for (uint32_t type = 0; type < FG_ResourceType::ResourceTypeCOUNT; type++)
+            {
+                if ((event.value & (1ull << type)) == 0)
+                    continue;
+
+                pacing.ResourceTagged((FG_ResourceType) type, index);
+                tagged[index] |= 1u << type;
+            }
+
+            break;
+        }
+
+        case FG_SimEventType::FrameIdHint:
+            pacing.FrameIdHint(event.value, allowedAhead);
+            break;
+
+        case FG_SimEventType::Present:
+        {
+            report.presents++;
+
+            if (pacing.IsPaused())
+            {
+                report.paused++;
+                break;
+            }
+
+            UINT64 willDispatchFrame = 0;
+            auto index = pacing.Dispatch(allowedAhead, tagged[pacing.GetIndex()] != 0, willDispatchFrame);
+
+            if (index < 0)
+                break;
+
+            report.dispatches++;
+
+            auto frame = pacing.FrameCount();
+            auto latency = frame > willDispatchFrame ? frame - willDispatchFrame : 0;
+            latencySum += latency;
+            report.maxLatency = std::max(report.maxLatency, latency);
+
+            if (!dispatched.insert(willDispatchFrame).second)
+                report.duplicates++;
+
+            if (willDispatchFrame + BUFFER_COUNT <= frame)
+                report.stale++;
+
+            if (!pacing.IsReady(FG_ResourceType::Depth, index) || !pacing.IsReady(FG_ResourceType::Velocity, index))
+                report.notReady++;
+
+            if (pacing.WaitingExecution(index))
+                report.waitingSkip++;
+
+            pacing.SetWaitingExecution(index);
+            break;
+        }
+
+        case FG_SimEventType::Executed:
+            for (int i = 0; i < BUFFER_COUNT; i++)
+                pacing.Executed(i);
+
+            break;
+
+        case FG_SimEventType::Pause:
+            pacing.Pause();
+            break;
+
+        case FG_SimEventType::ResetTarget:
+            pacing.ResetTarget();
+            break;
+
+        case FG_SimEventType::Restart:
+            countDropped();
+            produced.clear();
+            dispatched.clear();
+            pacing.Restart();
+            break;
+
+        case FG_SimEventType::DispatchReset:
+            pacing.DispatchReset();
+            break;
+        }
+    }
+
+    countDropped();
+
+    if (report.dispatches > 0)
+        report.avgLatency = (double) latencySum / (double) report.dispatches;
+
+    return report;
+}
+
+std::vector<FG_SimEvent> FG_PacingSim::RandomScript(UINT64 frames, uint32_t seed)
+{
+    // Raw engine output only, distributions are implementation defined
+    std::mt19937 rng(seed);
+    auto chance = [&rng](uint32_t percent) { return (rng() % 100) < percent; };
+
+    const UINT64 inputs = (1ull << FG_ResourceType::Depth) | (1ull << FG_ResourceType::Velocity);
+
+    std::vector<FG_SimEvent> events;
+    events.reserve(frames * 5);
+
+    UINT64 gameFrameId = 0;
+
+    for (UINT64 i = 0; i < frames; i++)
+    {
+        gameFrameId++;
+
+        // Game skipped some frame ids (loading screens, frame id reset to a new base)
+        if (chance(2))
+        {
+            gameFrameId += 1 + rng() % 16;
+            events.push_back({ FG_SimEventType::FrameIdHint, gameFrameId });
+        }
+
+        events.push_back({ FG_SimEventType::NewFrame, 0 });
+
+        auto lateTag = chance(10);
+
+        if (!lateTag)
+            events.push_back({ FG_SimEventType::Tag, chance(3) ? (1ull << FG_ResourceType::Depth) : inputs });
+
+        // Missing present (upscaler called twice per present), double present (present without upscaler)
+        if (!chance(5))
+        {
+            events.push_back({ FG_SimEventType::Present, 0 });
+
+            if (chance(5))
+                events.push_back({ FG_SimEventType::Present, 0 });
+        }
+
+        if (lateTag)
+            events.push_back({ FG_SimEventType::Tag, inputs });
+
+        if (!chance(3))
+            events.push_back({ FG_SimEventType::Executed, 0 });
+
+        if (chance(1))
+            events.push_back({ FG_SimEventType::Pause, 0 });
+
+        // Context recreated (resize, FG switched)
+        if (chance(1))
+        {
+            events.push_back({ FG_SimEventType::Restart, 0 });
+            events.push_back({ FG_SimEventType::DispatchReset, 0 });
+            gameFrameId = 0;
+        }
+    }
+
+    return events;
+}
@@ -0,0 +1,55 @@
+#pragma once
+#include "SysUtils.h"
+
+#include <framegen/FG_Pacing.h>
+
+#include <vector>
+
+// Deterministic replay of FG_Pacing event orderings
+//
+// Runs a script of pacing events on a single thread without a device, events are applied in order the way
+// IFGFeature and FG present paths call them. Used to check pacing changes against odd orderings games produce
+// (late tags, missing or double presents, pauses, context recreation) before trying them in games.
+
+enum class FG_SimEventType : uint8_t
+{
+    NewFrame,
+    Tag,         // value: bit mask of FG_ResourceType, tagged to current frame buffer
+    FrameIdHint, // value: game frame id
+    Present,
+    Executed,
+    Pause,
+    ResetTarget,
+    Restart,
+    DispatchReset,
+};
+
+struct FG_SimEvent
+{
+    FG_SimEventType type = FG_SimEventType::NewFrame;
+    UINT64 value = 0;
+};
+
+struct FG_SimReport
+{
+    UINT64 frames = 0;       // NewFrame events
+    UINT64 presents = 0;     // Present events
+    UINT64 dispatches = 0;   // Presents which dispatched a frame
+    UINT64 paused = 0;       // Presents skipped while paused
+    UINT64 dropped = 0;      // Frames never dispatched and passed by a later dispatch
+    UINT64 duplicates = 0;   // Frame ids dispatched more than once
+    UINT64 stale = 0;        // Dispatched frame buffer was already reused by a newer frame
+    UINT64 notReady = 0;     // Dispatched frame buffer missing depth or velocity
+    UINT64 waitingSkip = 0;  // Dispatches while previous work of the buffer was not executed yet
+    double avgLatency = 0.0; // Frames between current frame and dispatched frame
+    UINT64 maxLatency = 0;
+};
+
+class FG_PacingSim
+{
+  public:
+    static FG_SimReport Run(const std::vector<FG_SimEvent>& events, UINT64 allowedAhead);
+
+    // Reproducible script of given frame count, same seed gives same script on every platform
+    static std::vector<FG_SimEvent> RandomScript(UINT64 frames, uint32_t seed);
+};
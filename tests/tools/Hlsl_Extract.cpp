@@ -0,0 +1,187 @@
+// Writes compute shaders of OptiScaler's shader headers as C++ structs for Hlsl_Host.h
+//
+//   hlsl_extract <output.inl>
+//
+// The HLSL text is taken from the same strings the passes compile at runtime, only the syntax C++ doesn't
+// accept is rewritten: attributes, register bindings, semantics, the cbuffer block and multi component
+// swizzles. Constants, textures and groupshared arrays become members, shader functions member functions.
+
+#include <shaders/rcas/RCAS_Common.h>
+#include <shaders/output_scaling/OS_Common.h>
+#include <shaders/output_scaling/OSRCAS_Common.h>
+
+#include <fstream>
+#include <iostream>
+#include <regex>
+#include <sstream>
+
+namespace
+{
+struct Variant
+{
+    const char* name;
+    const std::string* code;
+    std::vector<std::pair<std::string, std::string>> defines;
+};
+
+std::string Translate(const Variant& variant)
+{
+    auto code = *variant.code;
+    std::smatch match;
+
+    // Thread group size, attribute is dropped
+    std::regex numThreads(R"(\[numthreads\(\s*(\w+)\s*,\s*(\w+)\s*,\s*(\w+)\s*\)\])");
+
+    if (!std::regex_search(code, match, numThreads))
+        throw std::runtime_error(std::string(variant.name) + ": numthreads not found");
+
+    auto groupX = match[1].str();
+    auto groupY = match[2].str();
+    code = std::regex_replace(code, numThreads, "");
+    code = std::regex_replace(code, std::regex(R"(\[(unroll|loop|fastopt)\])"), "");
+
+    // Entry point arguments by semantic
+    std::regex entry(R"(void\s+CSMain\s*\(([^)]*)\))");
+
+    if (!std::regex_search(code, match, entry))
+        throw std::runtime_error(std::string(variant.name) + ": CSMain not found");
+
+    std::vector<std::string> arguments;
+    std::regex semantic(R"(:\s*(SV_\w+))");
+    auto params = match[1].str();
+
+    for (std::sregex_iterator it(params.begin(), params.end(), semantic), end; it != end; ++it)
+    {
+        auto name = (*it)[1].str();
+
+        if (name == "SV_DispatchThreadID")
+            arguments.push_back("dispatchThreadId");
+        else if (name == "SV_GroupID")
+            arguments.push_back("groupId");
+        else if (name == "SV_GroupIndex")
+            arguments.push_back("groupIndex");
+        else if (name == "SV_GroupThreadID")
+            arguments.push_back("groupThreadId");
+        else
+            throw std::runtime_error(std::string(variant.name) + ": unknown semantic " + name);
+    }
+
+    code = std::regex_replace(code, semantic, "");
+    code = std::regex_replace(code, std::regex(R"(\s*:\s*register\([^)]*\))"), "");
+
+    // Constant buffer members become shader members
+    auto cbuffer = code.find("cbuffer");
+
+    if (cbuffer != std::string::npos)
+    {
+        auto open = code.find('{', cbuffer);
+        auto close = code.find("};", open);
+        code.erase(close, 2);
+        code.erase(open, 1);
+        code = std::regex_replace(code, std::regex(R"(\n[ \t]*cbuffer[^\n]*)"), "\n");
+    }
+
+    // Line based rewrites
+    std::istringstream lines(code);
+    std::ostringstream body;
+    std::vector<std::string> macros;
+    std::regex define(R"(^\s*#define\s+(\w+))");
+    std::regex swizzle(R"(\.([xyzwrgba]{2,4})\b)");
+
+    for (std::string line; std::getline(lines, line);)
+    {
+        if (std::regex_search(line, match, define))
+            macros.push_back(match[1].str());
+
+        if (line.rfind("static const ", 0) == 0)
+            line = "static constexpr " + line.substr(13);
+        else if (line.rfind("static ", 0) == 0)
+            line = line.substr(7);
+
+        line = std::regex_replace(line, std::regex(R"(\bgroupshared\s+)"), "");
+
+        std::string rewritten;
+        auto last = line.cbegin();
+
+        for (std::sregex_iterator it(line.begin(), line.end(), swizzle), end; it != end; ++it)
+        {
+            rewritten.append(last, (*it)[0].first);
+            auto components = (*it)[1].str();
+            rewritten += ".Swz<" + std::to_string(components.size()) + ">(\"" + components + "\")";
+            last = (*it)[0].second;
+        }
+
+        rewritten.append(last, line.cend());
+        body << rewritten << "\n";
+    }
+
+    std::ostringstream out;
+
+    for (auto& [name, value] : variant.defines)
+        out << "#define " << name << " " << value << "\n";
+
+    // Group size may use macros of the shader, declared after its body
+    out << "struct " << variant.name << " : ComputeShader<" << variant.name << ">\n{\n";
+    out << body.str();
+    out << "    static constexpr uint NumThreadsX = " << groupX << ";\n";
+    out << "    static constexpr uint NumThreadsY = " << groupY << ";\n";
+    out << "    static constexpr bool UsesGroupSync = "
+        << (code.find("GroupMemoryBarrierWithGroupSync") != std::string::npos ? "true" : "false") << ";\n\n";
+    out << "    void Invoke(uint3 dispatchThreadId, uint3 groupId, uint groupIndex, uint3 groupThreadId)\n    {\n";
+    out << "        CSMain(";
+
+    for (size_t i = 0; i < arguments.size(); i++)
+        out << (i > 0 ? ", " : "") << arguments[i];
+
+    out << ");\n    }\n};\n";
+
+    for (auto& [name, value] : variant.defines)
+        out << "#undef " << name << "\n";
+
+    for (auto& name : macros)
+        out << "#undef " << name << "\n";
+
+    return out.str();
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::cerr << "usage: hlsl_extract <output.inl>\n";
+        return 1;
+    }
+
+    // Fused variants use the defines OSRCAS_Dx12 passes for each downscaler
+    std::vector<Variant> variants = {
+        { "Rcas", &rcasCode, {} },
+        { "OSLanczos2", &downsampleCodeLanczos2, {} },
+        { "OSLanczos3", &downsampleCodeLanczos3, {} },
+        { "OSKaiser2", &downsampleCodeKaiser2, {} },
+        { "OSKaiser3", &downsampleCodeKaiser3, {} },
+        { "OSRcasLanczos2", &osRcasCode, { { "TAP_COUNT", "4" } } },
+        { "OSRcasLanczos3", &osRcasCode, { { "TAP_COUNT", "6" } } },
+        { "OSRcasKaiser2", &osRcasCode, { { "TAP_COUNT", "4" }, { "KERNEL_KAISER", "1" }, { "BETA", "5.0f" } } },
+        { "OSRcasKaiser3", &osRcasCode, { { "TAP_COUNT", "6" }, { "KERNEL_KAISER", "1" }, { "BETA", "6.0f" } } },
+    };
+
+    std::ostringstream out;
+    out << "// Generated by hlsl_extract from OptiScaler shader headers, do not edit\n\n";
+
+    try
+    {
+        for (auto& variant : variants)
+            out << Translate(variant) << "\n";
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "hlsl_extract: " << e.what() << "\n";
+        return 1;
+    }
+
+    std::ofstream file(argv[1], std::ios::trunc);
+    file << out.str();
+
+    return file.good() ? 0 : 1;
+}
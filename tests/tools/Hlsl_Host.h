@@ -0,0 +1,444 @@
+#pragma once
+
+// Runs HLSL compute shaders on the CPU, for comparing passes against each other on the host
+//
+// Covers the subset OptiScaler's compute passes use: float/int/uint vectors with swizzles, the math
+// intrinsics, Texture2D Load and linear clamp SampleLevel, RWTexture2D stores and groupshared memory with
+// GroupMemoryBarrierWithGroupSync. Loads outside the texture return 0 and stores outside it are dropped
+// like on D3D. Shader text is converted by hlsl_extract, math runs in float like the GPU but results are
+// not bit exact with any driver.
+
+#include <array>
+#include <barrier>
+#include <cmath>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace hlsl
+{
+using uint = uint32_t;
+
+template <class T, int N> struct VecStorage;
+
+template <class T> struct VecStorage<T, 2>
+{
+    union
+    {
+        T v[2];
+        struct
+        {
+            T x, y;
+        };
+        struct
+        {
+            T r, g;
+        };
+    };
+};
+
+template <class T> struct VecStorage<T, 3>
+{
+    union
+    {
+        T v[3];
+        struct
+        {
+            T x, y, z;
+        };
+        struct
+        {
+            T r, g, b;
+        };
+    };
+};
+
+template <class T> struct VecStorage<T, 4>
+{
+    union
+    {
+        T v[4];
+        struct
+        {
+            T x, y, z, w;
+        };
+        struct
+        {
+            T r, g, b, a;
+        };
+    };
+};
+
+template <class S> inline constexpr bool IsScalar = std::is_arithmetic_v<S>;
+
+template <class T, int N> struct vec : VecStorage<T, N>
+{
+    vec()
+    {
+        for (int i = 0; i < N; i++)
+            this->v[i] = T();
+    }
+
+    template <class S, std::enable_if_t<IsScalar<S>, int> = 0> vec(S s)
+    {
+        for (int i = 0; i < N; i++)
+            this->v[i] = T(s);
+    }
+
+    template <class... A, std::enable_if_t<sizeof...(A) == N && N >= 2 && (IsScalar<A> && ...), int> = 0>
+    vec(A... a)
+    {
+        T values[] = { T(a)... };
+
+        for (int i = 0; i < N; i++)
+            this->v[i] = values[i];
+    }
+
+    template <class S, int M = N, std::enable_if_t<(M > 2) && IsScalar<S>, int> = 0>
+    vec(const vec<T, N - 1>& head, S last)
+    {
+        for (int i = 0; i < N - 1; i++)
+            this->v[i] = head.v[i];
+
+        this->v[N - 1] = T(last);
+    }
+
+    template <class U, std::enable_if_t<!std::is_same_v<T, U>, int> = 0> explicit vec(const vec<U, N>& other)
+    {
+        for (int i = 0; i < N; i++)
+            this->v[i] = T(other.v[i]);
+    }
+
+    vec(const vec& other)
+    {
+        for (int i = 0; i < N; i++)
+            this->v[i] = other.v[i];
+    }
+
+    vec& operator=(const vec& other)
+    {
+        for (int i = 0; i < N; i++)
+            this->v[i] = other.v[i];
+
+        return *this;
+    }
+
+    T& operator[](int i) { return this->v[i]; }
+    const T& operator[](int i) const { return this->v[i]; }
+
+    template <int M> vec<T, M> Swz(const char* components) const
+    {
+        vec<T, M> result;
+
+        for (int i = 0; i < M; i++)
+        {
+            switch (components[i])
+            {
+            case 'x':
+            case 'r':
+                result.v[i] = this->v[0];
+                break;
+            case 'y':
+            case 'g':
+                result.v[i] = this->v[1];
+                break;
+            case 'z':
+            case 'b':
+                result.v[i] = this->v[2];
+                break;
+            default:
+                result.v[i] = this->v[3];
+                break;
+            }
+        }
+
+        return result;
+    }
+
+    template <class O> vec& operator+=(const O& o) { return *this = *this + o; }
+    template <class O> vec& operator-=(const O& o) { return *this = *this - o; }
+    template <class O> vec& operator*=(const O& o) { return *this = *this * o; }
+    template <class O> vec& operator/=(const O& o) { return *this = *this / o; }
+};
+
+using float2 = vec<float, 2>;
+using float3 = vec<float, 3>;
+using float4 = vec<float, 4>;
+using int2 = vec<int, 2>;
+using int3 = vec<int, 3>;
+using uint2 = vec<uint, 2>;
+using uint3 = vec<uint, 3>;
+
+template <class T, int N, class F> vec<T, N> Map(const vec<T, N>& a, F f)
+{
+    vec<T, N> result;
+
+    for (int i = 0; i < N; i++)
+        result.v[i] = T(f(a.v[i]));
+
+    return result;
+}
+
+template <class T, int N, class F> vec<T, N> Map(const vec<T, N>& a, const vec<T, N>& b, F f)
+{
+    vec<T, N> result;
+
+    for (int i = 0; i < N; i++)
+        result.v[i] = T(f(a.v[i], b.v[i]));
+
+    return result;
+}
+
+#define HLSL_BINARY_OPERATOR(op)                                                                                       \
+    template <class T, int N> vec<T, N> operator op(const vec<T, N>& a, const vec<T, N>& b)                          \
+    {                                                                                                                  \
+        return Map(a, b, [](T x, T y) { return x op y; });                                                             \
+    }                                                                                                                  \
+    template <class T, int N, class S, std::enable_if_t<IsScalar<S>, int> = 0>                                         \
+    vec<T, N> operator op(const vec<T, N>& a, S s)                                                                     \
+    {                                                                                                                  \
+        return a op vec<T, N>(s);                                                                                      \
+    }                                                                                                                  \
+    template <class T, int N, class S, std::enable_if_t<IsScalar<S>, int> = 0>                                         \
+    vec<T, N> operator op(S s, const vec<T, N>& a)                                                                     \
+    {                                                                                                                  \
+        return vec<T, N>(s) op a;                                                                                      \
+    }
+
+HLSL_BINARY_OPERATOR(+)
+HLSL_BINARY_OPERATOR(-)
+HLSL_BINARY_OPERATOR(*)
+HLSL_BINARY_OPERATOR(/)
+
+#undef HLSL_BINARY_OPERATOR
+
+template <class T, int N> vec<T, N> operator-(const vec<T, N>& a)
+{
+    return Map(a, [](T x) { return -x; });
+}
+
+// Scalar arguments of mixed types are computed in float, like HLSL literals
+template <class A, class B>
+using ScalarResult =
+    std::conditional_t<std::is_integral_v<A> && std::is_integral_v<B>, std::common_type_t<A, B>, float>;
+
+template <class A, class B, std::enable_if_t<IsScalar<A> && IsScalar<B>, int> = 0> ScalarResult<A, B> min(A a, B b)
+{
+    return ScalarResult<A, B>(a) < ScalarResult<A, B>(b) ? ScalarResult<A, B>(a) : ScalarResult<A, B>(b);
+}
+
+template <class A, class B, std::enable_if_t<IsScalar<A> && IsScalar<B>, int> = 0> ScalarResult<A, B> max(A a, B b)
+{
+    return ScalarResult<A, B>(a) > ScalarResult<A, B>(b) ? ScalarResult<A, B>(a) : ScalarResult<A, B>(b);
+}
+
+template <class T, int N> vec<T, N> min(const vec<T, N>& a, const vec<T, N>& b)
+{
+    return Map(a, b, [](T x, T y) { return x < y ? x : y; });
+}
+
+template <class T, int N> vec<T, N> max(const vec<T, N>& a, const vec<T, N>& b)
+{
+    return Map(a, b, [](T x, T y) { return x > y ? x : y; });
+}
+
+template <class T, int N, class S, std::enable_if_t<IsScalar<S>, int> = 0> vec<T, N> min(const vec<T, N>& a, S s)
+{
+    return min(a, vec<T, N>(s));
+}
+
+template <class T, int N, class S, std::enable_if_t<IsScalar<S>, int> = 0> vec<T, N> max(const vec<T, N>& a, S s)
+{
+    return max(a, vec<T, N>(s));
+}
+
+template <class A, class B, class C> auto clamp(const A& x, const B& lo, const C& hi) { return min(max(x, lo), hi); }
+
+inline float abs(float x) { return std::fabs(x); }
+inline int abs(int x) { return x < 0 ? -x : x; }
+inline float floor(float x) { return std::floor(x); }
+inline float sqrt(float x) { return std::sqrt(x); }
+inline float sin(float x) { return std::sin(x); }
+inline float exp(float x) { return std::exp(x); }
+inline float rcp(float x) { return 1.0f / x; }
+inline float rsqrt(float x) { return 1.0f / std::sqrt(x); }
+inline float saturate(float x) { return x < 0.0f ? 0.0f : (x > 1.0f ? 1.0f : x); }
+
+template <class A, class B, class C> float lerp(A a, B b, C t) { return float(a) + (float(b) - float(a)) * float(t); }
+
+template <int N> vec<float, N> abs(const vec<float, N>& a) { return Map(a, [](float x) { return std::fabs(x); }); }
+template <int N> vec<float, N> floor(const vec<float, N>& a) { return Map(a, [](float x) { return std::floor(x); }); }
+template <int N> vec<float, N> rcp(const vec<float, N>& a) { return Map(a, [](float x) { return 1.0f / x; }); }
+template <int N> vec<float, N> saturate(const vec<float, N>& a) { return Map(a, [](float x) { return saturate(x); }); }
+
+template <int N> vec<float, N> rsqrt(const vec<float, N>& a)
+{
+    return Map(a, [](float x) { return 1.0f / std::sqrt(x); });
+}
+
+template <int N> float dot(const vec<float, N>& a, const vec<float, N>& b)
+{
+    float result = 0.0f;
+
+    for (int i = 0; i < N; i++)
+        result += a.v[i] * b.v[i];
+
+    return result;
+}
+
+// RGBA float texels, formats are simulated by the store
+struct Image
+{
+    int width = 0;
+    int height = 0;
+    std::vector<float4> texels;
+
+    Image() = default;
+    Image(int w, int h) : width(w), height(h), texels(size_t(w) * size_t(h), float4(0.0f)) {}
+
+    float4& At(int x, int y) { return texels[size_t(y) * size_t(width) + size_t(x)]; }
+    const float4& At(int x, int y) const { return texels[size_t(y) * size_t(width) + size_t(x)]; }
+};
+
+template <class T> T FromTexel(const float4& texel)
+{
+    if constexpr (std::is_same_v<T, float4>)
+        return texel;
+    else if constexpr (std::is_same_v<T, float3>)
+        return float3(texel.x, texel.y, texel.z);
+    else if constexpr (std::is_same_v<T, float2>)
+        return float2(texel.x, texel.y);
+    else
+        return T(texel.x);
+}
+
+inline float4 ToTexel(const float4& value) { return value; }
+inline float4 ToTexel(const float3& value) { return float4(value, 1.0f); }
+inline float4 ToTexel(const float2& value) { return float4(value.x, value.y, 0.0f, 1.0f); }
+
+struct SamplerState
+{
+};
+
+template <class T> struct Texture2D
+{
+    const Image* image = nullptr;
+
+    T Load(const int3& p) const
+    {
+        if (p.z != 0 || p.x < 0 || p.y < 0 || p.x >= image->width || p.y >= image->height)
+            return FromTexel<T>(float4(0.0f));
+
+        return FromTexel<T>(image->At(p.x, p.y));
+    }
+
+    // Bilinear with clamp addressing, exact at texel centers
+    T SampleLevel(const SamplerState&, const float2& uv, float) const
+    {
+        auto fx = uv.x * float(image->width) - 0.5f;
+        auto fy = uv.y * float(image->height) - 0.5f;
+        auto x0 = std::floor(fx);
+        auto y0 = std::floor(fy);
+        auto tx = fx - x0;
+        auto ty = fy - y0;
+
+        auto texel = [this](int x, int y)
+        {
+            x = x < 0 ? 0 : (x >= image->width ? image->width - 1 : x);
+            y = y < 0 ? 0 : (y >= image->height ? image->height - 1 : y);
+            return image->At(x, y);
+        };
+
+        auto top = texel(int(x0), int(y0)) * (1.0f - tx) + texel(int(x0) + 1, int(y0)) * tx;
+        auto bottom = texel(int(x0), int(y0) + 1) * (1.0f - tx) + texel(int(x0) + 1, int(y0) + 1) * tx;
+
+        return FromTexel<T>(top * (1.0f - ty) + bottom * ty);
+    }
+};
+
+template <class T> struct RWTexture2D
+{
+    Image* image = nullptr;
+
+    // Rounding of the texture format, per channel
+    float (*quantize)(float value, int channel) = nullptr;
+
+    struct Texel
+    {
+        RWTexture2D* texture;
+        uint2 position;
+
+        template <class V> Texel& operator=(const V& value)
+        {
+            auto image = texture->image;
+
+            if (position.x >= uint(image->width) || position.y >= uint(image->height))
+                return *this;
+
+            auto texel = ToTexel(value);
+
+            if (texture->quantize != nullptr)
+            {
+                for (int i = 0; i < 4; i++)
+                    texel.v[i] = texture->quantize(texel.v[i], i);
+            }
+
+            image->At(int(position.x), int(position.y)) = texel;
+            return *this;
+        }
+    };
+
+    Texel operator[](const uint2& position) { return { this, position }; }
+};
+
+// Base of generated shaders, runs groups one after another. Threads of a group run concurrently only when
+// the shader syncs them, groupshared members are shared by the group.
+template <class Shader> struct ComputeShader
+{
+    std::barrier<>* groupSync = nullptr;
+
+    void GroupMemoryBarrierWithGroupSync() { groupSync->arrive_and_wait(); }
+
+    void Dispatch(uint groupsX, uint groupsY)
+    {
+        auto& shader = static_cast<Shader&>(*this);
+        constexpr auto threadCount = Shader::NumThreadsX * Shader::NumThreadsY;
+
+        for (uint gy = 0; gy < groupsY; gy++)
+        {
+            for (uint gx = 0; gx < groupsX; gx++)
+            {
+                auto run = [&shader, gx, gy](uint index)
+                {
+                    uint3 local(index % Shader::NumThreadsX, index / Shader::NumThreadsX, 0u);
+                    uint3 group(gx, gy, 0u);
+                    uint3 global(gx * Shader::NumThreadsX + local.x, gy * Shader::NumThreadsY + local.y, 0u);
+                    shader.Invoke(global, group, index, local);
+                };
+
+                if constexpr (Shader::UsesGroupSync)
+                {
+                    std::barrier<> sync(threadCount);
+                    groupSync = &sync;
+
+                    std::vector<std::jthread> threads;
+                    threads.reserve(threadCount);
+
+                    for (uint i = 0; i < threadCount; i++)
+                        threads.emplace_back(run, i);
+                }
+                else
+                {
+                    for (uint i = 0; i < threadCount; i++)
+                        run(i);
+                }
+            }
+        }
+
+        groupSync = nullptr;
+    }
+};
+
+#include "Hlsl_Shaders.inl"
+} // namespace hlsl
@@ -0,0 +1,483 @@
+#include "pch.h"
+#include "ResTrack_Replay.h"
+
+#include <resource_tracking/ResTrack_Tables.h>
+#include <hudfix/Hudfix_Scoring.h>
+
+#include <chrono>
+#include <fstream>
+
+const char* TraceOpName(TraceOp op)
+{
+    switch (op)
+    {
+    case TraceOp::ResourceDesc:
+        return "ResourceDesc";
+    case TraceOp::CreateHeap:
+        return "CreateHeap";
+    case TraceOp::ReleaseHeap:
+        return "ReleaseHeap";
+    case TraceOp::CreateRTV:
+        return "CreateRTV";
+    case TraceOp::CreateSRV:
+        return "CreateSRV";
+    case TraceOp::CreateUAV:
+        return "CreateUAV";
+    case TraceOp::CopyDescriptors:
+        return "CopyDescriptors";
+    case TraceOp::CopyDescriptorsSimple:
+        return "CopyDescriptorsSimple";
+    case TraceOp::SetGraphicsRootTable:
+        return "SetGraphicsRootTable";
+    case TraceOp::SetComputeRootTable:
+        return "SetComputeRootTable";
+    case TraceOp::OMSetRenderTargets:
+        return "OMSetRenderTargets";
+    case TraceOp::DrawInstanced:
+        return "DrawInstanced";
+    case TraceOp::DrawIndexedInstanced:
+        return "DrawIndexedInstanced";
+    case TraceOp::Dispatch:
+        return "Dispatch";
+    case TraceOp::ExecuteCommandLists:
+        return "ExecuteCommandLists";
+    case TraceOp::ReleaseResource:
+        return "ReleaseResource";
+    case TraceOp::Present:
+        return "Present";
+    default:
+        return "Unknown";
+    }
+}
+
+bool ResTrack_TraceReader::Open(const std::filesystem::path& path)
+{
+    _data.clear();
+    _offset = 0;
+
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+
+    if (!file)
+    {
+        fprintf(stderr, "Can't open trace file: %s\n", path.string().c_str());
+        return false;
+    }
+
+    auto size = (size_t) file.tellg();
+
+    if (size < sizeof(TraceFileHeader))
+    {
+        fprintf(stderr, "Trace file is too small: %zu\n", size);
+        return false;
+    }
+
+    _data.resize(size);
+    file.seekg(0);
+
+    if (!file.read((char*) _data.data(), size))
+    {
+        fprintf(stderr, "Can't read trace file, size: %zu\n", size);
+        return false;
+    }
+
+    memcpy(&_header, _data.data(), sizeof(_header));
+
+    if (_header.magic != TRACE_MAGIC || _header.version != TRACE_VERSION)
+    {
+        fprintf(stderr, "Not a valid trace file, magic: %X, version: %u\n", _header.magic, _header.version);
+        return false;
+    }
+
+    _offset = sizeof(TraceFileHeader);
+    return true;
+}
+
+bool ResTrack_TraceReader::Next(TraceRecord& record)
+{
+    if (_offset + sizeof(TraceRecordHeader) > _data.size())
+        return false;
+
+    TraceRecordHeader header {};
+    memcpy(&header, _data.data() + _offset, sizeof(header));
+
+    auto argSize = sizeof(uint64_t) * header.argCount;
+
+    if (_offset + sizeof(header) + argSize > _data.size() || header.op >= TraceOp::COUNT)
+    {
+        fprintf(stderr, "Truncated or corrupt record at offset: %zu\n", _offset);
+        _offset = _data.size();
+        return false;
+    }
+
+    record.op = header.op;
+    record.thread = header.thread;
+    record.timeUs = header.timeUs;
+    record.argCount = header.argCount;
+    record.args = reinterpret_cast<const uint64_t*>(_data.data() + _offset + sizeof(header));
+
+    _offset += sizeof(header) + argSize;
+    return true;
+}
+
+bool ResTrack_Replay::Run(ResTrack_TraceReader& reader, const ResTrack_ReplayOptions& options,
+                          ResTrack_ReplayResult& result)
+{
+    result = {};
+    reader.Rewind();
+
+    auto& header = reader.Header();
+    ResTrack_Tables::Init(options.useShards);
+
+    // Candidate ranking runs on recorded binds, copies are assumed to succeed
+    Hudfix_Scoring::Reset();
+
+    ankerl::unordered_dense::map<ID3D12Resource*, D3D12_RESOURCE_DESC> descs;
+    std::vector<D3D12_CPU_DESCRIPTOR_HANDLE> destStarts;
+    std::vector<UINT> destSizes;
+    std::vector<D3D12_CPU_DESCRIPTOR_HANDLE> srcStarts;
+    std::vector<UINT> srcSizes;
+    ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo> candidates;
+    size_t fIndex = 0;
+
+    auto trackView = [&](const TraceRecord& record, HeapInfo* heap, UINT texture2DDimension, ResourceType type,
+                         CaptureInfo captureInfo)
+    {
+        if (heap == nullptr)
+            return;
+
+        auto resource = (ID3D12Resource*) record.args[0];
+        auto it = descs.find(resource);
+        auto validView = resource != nullptr && it != descs.end() && record.args[2] == texture2DDimension &&
+                         ResTrack_Tables::MatchesSwapchain(it->second, header.swapchainWidth, header.swapchainHeight,
+                                                           options.relaxedResolutionCheck);
+
+        ResTrack_Tables::TrackView(heap, (SIZE_T) record.args[1], resource, validView ? &it->second : nullptr, type,
+                                   captureInfo);
+
+        if (heap->GetByCpuHandle((SIZE_T) record.args[1]) != nullptr)
+            result.trackedViews++;
+    };
+
+    auto trackRootTable = [&](const TraceRecord& record, HeapInfo* heap, D3D12_RESOURCE_STATES state,
+                              CaptureInfo captureInfo)
+    {
+        if (heap == nullptr)
+            return;
+
+        auto capturedBuffer = heap->GetByGpuHandle((SIZE_T) record.args[2]);
+        if (capturedBuffer == nullptr || capturedBuffer->buffer == nullptr)
+            return;
+
+        if (captureInfo == CaptureInfo::SetCR && capturedBuffer->type == UAV)
+            state = D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
+
+        capturedBuffer->state = state;
+        capturedBuffer->captureInfo = captureInfo;
+        ResTrack_Tables::TrackPossibleHudless(fIndex, (ID3D12GraphicsCommandList*) record.args[0], capturedBuffer);
+    };
+
+    auto takeCandidates = [&](const TraceRecord& record)
+    {
+        candidates.clear();
+
+        // Hudless checks need real resources, only count what would have been checked
+        if (!ResTrack_Tables::TakePossibleHudless(fIndex, (ID3D12GraphicsCommandList*) record.args[0], candidates))
+            return;
+
+        result.hudlessCandidates += candidates.size();
+
+        for (auto& [resource, info] : candidates)
+        {
+            // Exact size check of Hudfix_Dx12::CheckResource
+            if (info.width != header.swapchainWidth || info.height != header.swapchainHeight)
+                continue;
+
+            auto key = (uintptr_t) resource;
+            auto write = IsWriteBind(&info);
+
+            Hudfix_Scoring::Observe(result.frames, key, write, info.format == (DXGI_FORMAT) header.swapchainFormat,
+                                    false);
+
+            if (Hudfix_Scoring::Decide(key, write, options.validateBudget, true) == HudlessDecision::Capture)
+            {
+                Hudfix_Scoring::Validated(key, true);
+                result.hudlessRankedCaptures++;
+            }
+        }
+    };
+
+    TraceRecord record {};
+    while (reader.Next(record))
+    {
+        auto start = std::chrono::steady_clock::now();
+        auto handled = true;
+
+        switch (record.op)
+        {
+        case TraceOp::ResourceDesc:
+        {
+            if (record.argCount < 5)
+            {
+                handled = false;
+                break;
+            }
+
+            D3D12_RESOURCE_DESC desc {};
+            desc.Width = record.args[1];
+            desc.Height = (UINT) record.args[2];
+            desc.Format = (DXGI_FORMAT) (record.args[3] & 0xFFFFFFFF);
+            desc.Dimension = (D3D12_RESOURCE_DIMENSION) (record.args[3] >> 32);
+            desc.Flags = (D3D12_RESOURCE_FLAGS) record.args[4];
+            descs.insert_or_assign((ID3D12Resource*) record.args[0], desc);
+            break;
+        }
+
+        case TraceOp::CreateHeap:
+        {
+            if (record.argCount < 5)
+            {
+                handled = false;
+                break;
+            }
+
+            auto numDescriptors = (UINT) (record.args[3] & 0xFFFFFFFF);
+            auto type = (UINT) (record.args[3] >> 32);
+            auto increment = (UINT) record.args[4];
+            auto cpuStart = (SIZE_T) record.args[1];
+            auto gpuStart = (SIZE_T) record.args[2];
+
+            auto size = (SIZE_T) increment * numDescriptors;
+            ResTrack_Tables::RegisterHeap((ID3D12DescriptorHeap*) record.args[0], cpuStart, cpuStart + size, gpuStart,
+                                          gpuStart + size, numDescriptors, increment, type);
+            break;
+        }
+
+        case TraceOp::ReleaseHeap:
+        {
+            if (record.argCount < 1)
+            {
+                handled = false;
+                break;
+            }
+
+            if (auto heap = ResTrack_Tables::FindHeap((ID3D12DescriptorHeap*) record.args[0]); heap != nullptr)
+                ResTrack_Tables::UnregisterHeap(heap);
+
+            break;
+        }
+
+        case TraceOp::CreateRTV:
+            if (record.argCount < 3)
+            {
+                handled = false;
+                break;
+            }
+
+            trackView(record, ResTrack_Tables::GetHeapByCpuHandleRTV((SIZE_T) record.args[1]),
+                      D3D12_RTV_DIMENSION_TEXTURE2D, RTV, CaptureInfo::CreateRTV);
+            break;
+
+        case TraceOp::CreateSRV:
+            if (record.argCount < 3)
+            {
+                handled = false;
+                break;
+            }
+
+            trackView(record, ResTrack_Tables::GetHeapByCpuHandleSRV((SIZE_T) record.args[1]),
+                      D3D12_SRV_DIMENSION_TEXTURE2D, SRV, CaptureInfo::CreateSRV);
+            break;
+
+        case TraceOp::CreateUAV:
+            if (record.argCount < 3)
+            {
+                handled = false;
+                break;
+            }
+
+            trackView(record, ResTrack_Tables::GetHeapByCpuHandleUAV((SIZE_T) record.args[1]),
+                      D3D12_UAV_DIMENSION_TEXTURE2D, UAV, CaptureInfo::CreateUAV);
+            break;
+
+        case TraceOp::CopyDescriptors:
+        {
+            if (record.argCount < 3)
+            {
+                handled = false;
+                break;
+            }
+
+            auto inc = (UINT) (record.args[0] >> 32);
+            auto numDest = (UINT) record.args[1];
+            auto numSrc = (UINT) record.args[2];
+
+            if (record.argCount != 3 + 2 * (size_t) numDest + 2 * (size_t) numSrc)
+            {
+                handled = false;
+                break;
+            }
+
+            destStarts.resize(numDest);
+            destSizes.resize(numDest);
+            srcStarts.resize(numSrc);
+            srcSizes.resize(numSrc);
+
+            auto args = record.args + 3;
+            for (UINT i = 0; i < numDest; i++, args += 2)
+            {
+                destStarts[i].ptr = (SIZE_T) args[0];
+                destSizes[i] = (UINT) args[1];
+            }
+
+            for (UINT i = 0; i < numSrc; i++, args += 2)
+            {
+                srcStarts[i].ptr = (SIZE_T) args[0];
+                srcSizes[i] = (UINT) args[1];
+            }
+
+            ResTrack_Tables::TrackCopyDescriptors(inc, numDest, destStarts.data(), destSizes.data(), numSrc,
+                                                  numSrc > 0 ? srcStarts.data() : nullptr, srcSizes.data());
+            break;
+        }
+
+        case TraceOp::CopyDescriptorsSimple:
+            if (record.argCount < 4)
+            {
+                handled = false;
+                break;
+            }
+
+            ResTrack_Tables::TrackCopyDescriptorsSimple((UINT) (record.args[0] >> 32), (UINT) record.args[1],
+                                                        (SIZE_T) record.args[2], (SIZE_T) record.args[3]);
+            break;
+
+        case TraceOp::SetGraphicsRootTable:
+            if (record.argCount < 3 || record.args[2] == 0)
+            {
+                handled = record.argCount >= 3;
+                break;
+            }
+
+            trackRootTable(record, ResTrack_Tables::GetHeapByGpuHandleGR((SIZE_T) record.args[2]),
+                           D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE, CaptureInfo::SetGR);
+            break;
+
+        case TraceOp::SetComputeRootTable:
+            if (record.argCount < 3 || record.args[2] == 0)
+            {
+                handled = record.argCount >= 3;
+                break;
+            }
+
+            trackRootTable(record, ResTrack_Tables::GetHeapByGpuHandleCR((SIZE_T) record.args[2]),
+                           D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE, CaptureInfo::SetCR);
+            break;
+
+        case TraceOp::OMSetRenderTargets:
+        {
+            if (record.argCount < 4)
+            {
+                handled = false;
+                break;
+            }
+
+            auto cmdList = (ID3D12GraphicsCommandList*) record.args[0];
+            auto numRTVs = (UINT) record.args[1];
+            auto singleHandle = record.args[2] != 0;
+
+            for (UINT i = 0; i < numRTVs; i++)
+            {
+                SIZE_T handle = 0;
+                HeapInfo* heap = nullptr;
+
+                if (singleHandle)
+                {
+                    heap = ResTrack_Tables::GetHeapByCpuHandleRTV((SIZE_T) record.args[3]);
+
+                    if (heap != nullptr)
+                        handle = (SIZE_T) record.args[3] + (i * heap->increment);
+                }
+                else if (3 + i < record.argCount)
+                {
+                    handle = (SIZE_T) record.args[3 + i];
+                    heap = ResTrack_Tables::GetHeapByCpuHandleRTV(handle);
+                }
+
+                if (heap == nullptr)
+                    continue;
+
+                auto capturedBuffer = heap->GetByCpuHandle(handle);
+                if (capturedBuffer == nullptr || capturedBuffer->buffer == nullptr)
+                    continue;
+
+                capturedBuffer->state = D3D12_RESOURCE_STATE_RENDER_TARGET;
+                capturedBuffer->captureInfo = CaptureInfo::OMSetRTV;
+                ResTrack_Tables::TrackPossibleHudless(fIndex, cmdList, capturedBuffer);
+            }
+
+            break;
+        }
+
+        case TraceOp::DrawInstanced:
+        case TraceOp::DrawIndexedInstanced:
+        case TraceOp::Dispatch:
+            if (record.argCount < 1)
+            {
+                handled = false;
+                break;
+            }
+
+            takeCandidates(record);
+            break;
+
+        case TraceOp::ExecuteCommandLists:
+            // Only FG resource command list bookkeeping happens here, nothing to replay without a FG context
+            break;
+
+        case TraceOp::ReleaseResource:
+        {
+            if (record.argCount < 1)
+            {
+                handled = false;
+                break;
+            }
+
+            auto resource = (ID3D12Resource*) record.args[0];
+            ResTrack_Tables::ReleaseResource(resource);
+            descs.erase(resource);
+            break;
+        }
+
+        case TraceOp::Present:
+            ResTrack_Tables::ClearPossibleHudless(fIndex);
+            result.frames++;
+            fIndex = result.frames % BUFFER_COUNT;
+            break;
+
+        default:
+            handled = false;
+            break;
+        }
+
+        if (!handled)
+        {
+            result.skippedRecords++;
+            continue;
+        }
+
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        auto index = (size_t) record.op;
+        result.calls[index]++;
+        result.totalNs[index] += (double) std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    }
+
+    // Leave tables empty for the next replay
+    ResTrack_Tables::UnregisterAllHeaps();
+
+    for (size_t i = 0; i < BUFFER_COUNT; i++)
+        ResTrack_Tables::ClearPossibleHudless(i);
+
+    result.hudlessTopChanges = Hudfix_Scoring::TopChanges();
+    Hudfix_Scoring::Reset();
+    return true;
+}
@@ -0,0 +1,67 @@
+#pragma once
+#include "SysUtils.h"
+
+#include <resource_tracking/ResTrack_Trace.h>
+
+#include <vector>
+#include <filesystem>
+
+struct TraceRecord
+{
+    TraceOp op = TraceOp::COUNT;
+    uint8_t thread = 0;
+    uint32_t timeUs = 0;
+    const uint64_t* args = nullptr;
+    uint16_t argCount = 0;
+};
+
+// Reads whole trace into memory and iterates records without copying arguments
+class ResTrack_TraceReader
+{
+  private:
+    std::vector<uint8_t> _data;
+    size_t _offset = 0;
+    TraceFileHeader _header {};
+
+  public:
+    bool Open(const std::filesystem::path& path);
+    bool Next(TraceRecord& record);
+    void Rewind() { _offset = sizeof(TraceFileHeader); }
+
+    const TraceFileHeader& Header() const { return _header; }
+};
+
+struct ResTrack_ReplayResult
+{
+    UINT64 calls[(size_t) TraceOp::COUNT] {};
+    double totalNs[(size_t) TraceOp::COUNT] {};
+    UINT64 frames = 0;
+    UINT64 hudlessCandidates = 0;
+    UINT64 hudlessRankedCaptures = 0;
+    UINT64 hudlessTopChanges = 0;
+    UINT64 trackedViews = 0;
+    UINT64 skippedRecords = 0;
+
+    double NsPerCall(TraceOp op) const
+    {
+        auto i = (size_t) op;
+        return calls[i] == 0 ? 0.0 : totalNs[i] / (double) calls[i];
+    }
+};
+
+struct ResTrack_ReplayOptions
+{
+    bool useShards = false;              // FGUseShards
+    bool relaxedResolutionCheck = false; // FGRelaxedResolutionCheck
+    UINT validateBudget = 2;             // FGHudfixValidateBudget
+};
+
+const char* TraceOpName(TraceOp op);
+
+// Replays a recorded trace through ResTrack_Tables and Hudfix_Scoring, with recorded values as opaque keys
+// No graphics API is needed, timings are for the table logic only
+class ResTrack_Replay
+{
+  public:
+    static bool Run(ResTrack_TraceReader& reader, const ResTrack_ReplayOptions& options, ResTrack_ReplayResult& result);
+};
@@ -0,0 +1,70 @@
+#include "pch.h"
+#include "ResTrack_Replay.h"
+
+#include <cstdlib>
+
+// Replays an OptiScaler.rttrace recorded from the menu and prints tracking timings per call
+//
+// restrack_replay <trace> [--shards] [--relaxed] [--budget N] [--repeat N]
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        fprintf(stderr, "Usage: %s <trace> [--shards] [--relaxed] [--budget N] [--repeat N]\n", argv[0]);
+        return 1;
+    }
+
+    ResTrack_ReplayOptions options {};
+    int repeat = 1;
+
+    for (int i = 2; i < argc; i++)
+    {
+        std::string arg = argv[i];
+
+        if (arg == "--shards")
+            options.useShards = true;
+        else if (arg == "--relaxed")
+            options.relaxedResolutionCheck = true;
+        else if (arg == "--budget" && i + 1 < argc)
+            options.validateBudget = (UINT) atoi(argv[++i]);
+        else if (arg == "--repeat" && i + 1 < argc)
+            repeat = std::max(1, atoi(argv[++i]));
+        else
+        {
+            fprintf(stderr, "Unknown argument: %s\n", arg.c_str());
+            return 1;
+        }
+    }
+
+    ResTrack_TraceReader reader;
+    if (!reader.Open(argv[1]))
+        return 1;
+
+    auto& header = reader.Header();
+    printf("Trace: %s, frames: %u, swapchain: %ux%u (%u)\n", argv[1], header.recordedFrames, header.swapchainWidth,
+           header.swapchainHeight, header.swapchainFormat);
+
+    for (int run = 0; run < repeat; run++)
+    {
+        ResTrack_ReplayResult result {};
+        ResTrack_Replay::Run(reader, options, result);
+
+        printf("Run %d, frames: %llu, tracked views: %llu, hudless candidates: %llu, skipped records: %llu\n", run + 1,
+               (unsigned long long) result.frames, (unsigned long long) result.trackedViews,
+               (unsigned long long) result.hudlessCandidates, (unsigned long long) result.skippedRecords);
+        printf("Hudless ranking, captures: %llu, top changes: %llu\n",
+               (unsigned long long) result.hudlessRankedCaptures, (unsigned long long) result.hudlessTopChanges);
+
+        for (size_t i = 0; i < (size_t) TraceOp::COUNT; i++)
+        {
+            if (result.calls[i] == 0)
+                continue;
+
+            printf("%-22s calls: %10llu, avg: %10.1f ns\n", TraceOpName((TraceOp) i),
+                   (unsigned long long) result.calls[i], result.NsPerCall((TraceOp) i));
+        }
+    }
+
+    return 0;
+}